@@ -510,6 +510,59 @@ void LSM9DS1Class::readGyro(){
 	}
 }
 
+int LSM9DS1Class::fifoSamples(bool* overrun){
+	int src = readRegister(LSM9DS1_ADDRESS, FIFO_SRC);
+	if (src < 0)
+	{
+		return -1;
+	}
+	if (overrun)
+	{
+		*overrun = (src & 0x40) != 0;	// OVRN bit
+	}
+	return src & 0x3F;	// FSS bits, amount of unread samples
+}
+
+int LSM9DS1Class::readFIFO(int16_t accel[][3], int16_t gyro[][3], int max_samples, bool* overrun){
+	uint8_t temp[LSM9DS1_MAX_BURST_BYTES];
+	const int burst_samples = LSM9DS1_MAX_BURST_BYTES / LSM9DS1_FIFO_SAMPLE_BYTES;
+
+	int samples = fifoSamples(overrun);
+	if (samples <= 0)
+	{
+		return 0;
+	}
+	if (samples > max_samples)
+	{
+		samples = max_samples;
+	}
+
+	int read = 0;
+	while (read < samples)
+	{
+		int count = samples - read < burst_samples ? samples - read : burst_samples;
+		if ( !readRegisters(LSM9DS1_ADDRESS, OUT_X_L_G, temp, count * LSM9DS1_FIFO_SAMPLE_BYTES) )
+		{
+			break;
+		}
+		for (int i = 0; i < count; i++, read++)
+		{
+			const uint8_t* sample = temp + i * LSM9DS1_FIFO_SAMPLE_BYTES;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				gyro[read][axis] = (sample[2 * axis + 1] << 8) | sample[2 * axis];
+				accel[read][axis] = (sample[2 * axis + 7] << 8) | sample[2 * axis + 6];
+				if (settings.accel._autoCalc)
+				{
+					gyro[read][axis] -= gBiasRaw[axis];
+					accel[read][axis] -= aBiasRaw[axis];
+				}
+			}
+		}
+	}
+	return read;
+}
+
 float LSM9DS1Class::calcGyro(int16_t gyro){
 
 	return gRes * gyro;
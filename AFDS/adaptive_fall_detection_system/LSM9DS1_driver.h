@@ -17,6 +17,12 @@
 
 #include "LSM9DS1_Types.h"
 
+#define LSM9DS1_FIFO_SIZE          32               /**<  Amount of accelerometer and gyroscope samples the FIFO holds  */
+#define LSM9DS1_FIFO_SAMPLE_BYTES  12               /**<  Bytes of one FIFO sample: gyroscope x, y, z and accelerometer x, y, z  */
+// Largest I2C read. The Wire receive buffer of the Arduino mbed core is 256 bytes, so a full FIFO is read in two bursts.
+#ifndef LSM9DS1_MAX_BURST_BYTES
+#define LSM9DS1_MAX_BURST_BYTES    252              /**<  Largest amount of bytes read in one I2C transaction (21 FIFO samples)  */
+#endif
 
 
 
@@ -249,6 +255,37 @@ class LSM9DS1Class {
     **/
     void readTemp();
 
+    /**
+    * @brief  fifoSamples(): Read the amount of unread samples in the FIFO
+    *
+    *   Reads FIFO_SRC, which holds the amount of unread samples and the overrun flag.
+    *   The FIFO must be enabled with setContinuousMode().
+    *
+    * @param bool* overrun: Set to true if the FIFO has been full and samples were overwritten. Can be nullptr.
+    * @return int: Amount of unread samples (0 - 32), or -1 if the IMU didn't answer
+    *
+    **/
+    int fifoSamples(bool* overrun = nullptr);
+
+    /**
+    * @brief  readFIFO(): Read the accelerometer and gyroscope samples stored in the FIFO
+    *
+    *   Reads FIFO_SRC once, and then all the unread samples in as few I2C transactions as
+    *   possible. Reading from OUT_X_L_G with auto-increment gives the gyroscope and then
+    *   the accelerometer output registers of a sample, after which the address rolls over
+    *   to the next sample (see application note AN4434), so LSM9DS1_MAX_BURST_BYTES / 12
+    *   samples are read per transaction. The raw values are bias corrected like in
+    *   readAccel() and readGyro(), and are stored oldest sample first.
+    *
+    * @param int16_t accel[][3]: Array where the raw accelerometer x, y and z values are stored.
+    * @param int16_t gyro[][3]: Array where the raw gyroscope x, y and z values are stored.
+    * @param int max_samples: Amount of samples there is room for in the arrays.
+    * @param bool* overrun: Set to true if samples were lost, because the FIFO wasn't read in time. Can be nullptr.
+    * @return int: Amount of read samples
+    *
+    **/
+    int readFIFO(int16_t accel[][3], int16_t gyro[][3], int max_samples, bool* overrun = nullptr);
+
 
     /**
     * @brief  calcGyro(): Converts the raw output from the Gyroscope of the IMU
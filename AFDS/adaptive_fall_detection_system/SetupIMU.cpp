@@ -100,6 +100,19 @@ void SetupMag(bool enableMag, uint8_t scale, uint8_t sampleRate, bool TempCompen
   IMU.settings.mag.operatingMode = 0;
 }
 
+float IMUSampleRate() {
+  // Output data rates of the sample rate settings 1-6
+  static const float gyro_rates[] = {14.9, 59.5, 119, 238, 476, 952};
+  static const float accel_rates[] = {10, 50, 119, 238, 476, 952};
+
+  if (IMU.settings.gyro.enabled) {
+    uint8_t rate = IMU.settings.gyro.sampleRate;
+    return (rate >= 1 && rate <= 6) ? gyro_rates[rate - 1] : 0;
+  }
+  uint8_t rate = IMU.settings.accel.sampleRate;
+  return (rate >= 1 && rate <= 6) ? accel_rates[rate - 1] : 0;
+}
+
 void SetupIMUDefaults() {
   SetupACC(true,16,1,-1);
   SetupGyro(true,2000,1,-1,false);
@@ -74,6 +74,17 @@ bool IsInFreeFall();
   **/
 void SetupIMUDefaults();
 
+/**
+  * @brief  IMUSampleRate(): Get the output data rate of the IMU in Hz
+  *
+  * When the gyroscope is enabled its sample rate is used for both sensors,
+  * otherwise it's the sample rate of the accelerometer.
+  *
+  * @param None.
+  * @return float: The sample rate in Hz, or 0 if the sample rate setting is invalid
+  **/
+float IMUSampleRate();
+
 /**
   * @brief  SetupACC(): Setup accessor for the accelerometer part of the IMU
   *
@@ -31,14 +31,112 @@
 
 #include <TensorFlowLite.h>
 
+// Define CASCADE_MODE to run fall_model_f46 on every signal, and fall_model_f46_2 only on the signals
+// fall_model_f46 is uncertain about
+//#define CASCADE_MODE
+
+// Define AOT_MODE to run the model compiled ahead of time by the host tool aot_compile, without
+// the interpreter and the tensor arena
+//#define AOT_MODE
+#if defined(AOT_MODE) && defined(CASCADE_MODE)
+#error "The cascade runs the models with the interpreter, AOT_MODE can't be used with it"
+#endif
+
+// Define CONTINUOUS_MODE to classify the last SIGNAL_SIZE samples every CONTINUOUS_HOP samples, instead of
+// only the signals exceeding the threshold. The duty cycle and latency are reported every 60 signals.
+//#define CONTINUOUS_MODE
+
+// Define ADAPTIVE_GATE to learn the magnitudes of the wearer, and only record and classify the signals
+// exceeding them, instead of every signal exceeding THRESHOLD. The gate is saved on the MicroSD card.
+//#define ADAPTIVE_GATE
+#if defined(ADAPTIVE_GATE) && defined(CONTINUOUS_MODE)
+#error "The continuous mode classifies every signal, ADAPTIVE_GATE can't be used with it"
+#endif
+
+// Define STAGE_TIMING to measure the time of every stage of the loop. Sending 'T' over the serial port
+// dumps the measurements in binary, and saves them on the MicroSD card. They are decoded by the host
+// tool afds_timing.
+//#define STAGE_TIMING
+
+// Define PROFILE_OPS to count the cycles of every operation of the models, which are reported every
+// 10 inferences
+//#define PROFILE_OPS
+#if defined(PROFILE_OPS) && defined(AOT_MODE)
+#error "The model compiled ahead of time has no operations to profile, PROFILE_OPS can't be used with AOT_MODE"
+#endif
+
+// The model of the sketch, which can be set when building, like -DFALL_MODEL=2. The number is saved as the
+// model id of the fall logs: 1 = fall_model_f46, 2 = fall_model_f46_2, 3 = fall_model_f46_3, and 4 and 5 are
+// the int8 quantized versions of fall_model_f46 and fall_model_f46_2, generated by the host tool quantize_model.
+// The int8 version of fall_model_f46_3 needs the int8 TANH kernel, which this TensorFlow Lite Micro doesn't have.
+#ifndef FALL_MODEL
+#define FALL_MODEL 1
+#endif
+#if defined(CASCADE_MODE) && FALL_MODEL != 1
+#error "The cascade runs the float models fall_model_f46 and fall_model_f46_2, FALL_MODEL has to be 1"
+#endif
+#if defined(AOT_MODE) && FALL_MODEL > 3
+#error "Only the float models are compiled ahead of time, FALL_MODEL has to be 1, 2 or 3 with AOT_MODE"
+#endif
+
 // TensorFlowLite necessary includes
+#if FALL_MODEL == 1
 #include "fall_model_f46.h" // This is the first model generated for the fall detection system
-//#include "fall_model_f46_2.h" // This is the second model generated for the fall detection system
-//#include "fall_model_f46_3.h" // This is the third model generated for the fall detection system
+#define FALL_MODEL_DATA fall_model_data
+#define FALL_MODEL_NAME "fall_model_f46"
+#define FALL_MODEL_ARENA FALL_MODEL_ARENA_SIZE
+#elif FALL_MODEL == 2
+#include "fall_model_f46_2.h" // This is the second model generated for the fall detection system
+#define FALL_MODEL_DATA fall_model_2_data
+#define FALL_MODEL_NAME "fall_model_f46_2"
+#define FALL_MODEL_ARENA FALL_MODEL_2_ARENA_SIZE
+#elif FALL_MODEL == 3
+#include "fall_model_f46_3.h" // This is the third model generated for the fall detection system
+#define FALL_MODEL_DATA fall_model_3_data
+#define FALL_MODEL_NAME "fall_model_f46_3"
+#define FALL_MODEL_ARENA FALL_MODEL_3_ARENA_SIZE
+#elif FALL_MODEL == 4
+#include "fall_model_f46_int8.h"
+#define FALL_MODEL_DATA fall_model_int8_data
+#define FALL_MODEL_NAME "fall_model_f46_int8"
+#define FALL_MODEL_ARENA FALL_MODEL_INT8_ARENA_SIZE
+#elif FALL_MODEL == 5
+#include "fall_model_f46_2_int8.h"
+#define FALL_MODEL_DATA fall_model_2_int8_data
+#define FALL_MODEL_NAME "fall_model_f46_2_int8"
+#define FALL_MODEL_ARENA FALL_MODEL_2_INT8_ARENA_SIZE
+#else
+#error "FALL_MODEL has to be one of the models 1 to 5"
+#endif
+#if !defined(TENSOR_ARENA_SIZE) && !defined(CASCADE_MODE)
+#define TENSOR_ARENA_SIZE FALL_MODEL_ARENA // The tensor arena of the model, from tensor_arena.h
+#endif
+#ifdef CASCADE_MODE
+#include "fall_model_f46_2.h" // The large model of the cascade
+#include "fall_cascade.h"
+#endif
+#ifdef AOT_MODE
+// The model compiled ahead of time
+#if FALL_MODEL == 1
+#include "fall_model_f46_aot.h"
+namespace aot_model = fall_model_f46_aot;
+#elif FALL_MODEL == 2
+#include "fall_model_f46_2_aot.h"
+namespace aot_model = fall_model_f46_2_aot;
+#else
+#include "fall_model_f46_3_aot.h"
+namespace aot_model = fall_model_f46_3_aot;
+#endif
+#endif
 #include "main_functions.h"
+#include "model_quantization.h"
+#include "tensor_arena.h"
 #include "tensorflow/lite/experimental/micro/kernels/all_ops_resolver.h"
 #include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
 #include "tensorflow/lite/experimental/micro/micro_interpreter.h"
+#ifdef PROFILE_OPS
+#include "op_profiler.h"
+#endif
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
 
@@ -49,347 +147,9 @@
 
 // Includes for datalogger, IMU and other help functions
 #include "constants.h"
-#include "feature_calculation.h"
-#include "datalogger.h"
+#include "afds_controller.h"
 #include "SetupIMU.h"
 
-//  : public LSM9DS1Class
-
-class afdsdCtrl1 : public datalogger {
-  public:
-    // Generate arrays for accelerometer and gyroscope values of the signal
-    float acc_x_arr[SIGNAL_SIZE];       /**<  Array used to store the x-axis accelerometer data   */
-    float acc_y_arr[SIGNAL_SIZE];       /**<  Array used to store the y-axis accelerometer data   */
-    float acc_z_arr[SIGNAL_SIZE];       /**<  Array used to store the z-axis accelerometer data   */
-    float gyro_x_arr[SIGNAL_SIZE];      /**<  Array used to store the x-axis gyroscope data   */
-    float gyro_y_arr[SIGNAL_SIZE];      /**<  Array used to store the y-axis gyroscope data   */
-    float gyro_z_arr[SIGNAL_SIZE];      /**<  Array used to store the z-axis gyroscope data   */
-
-    // Generate feature array
-    float features[FEATURE_AMOUNT];     /**<  Array used to store the calculated features from the data signals   */
-
-    // Generate char_array for naming saved fall data
-    char fall_name_array[NAME_SIZE];    /**<  Array used to store the generated fall name   */
-
-    // Variable setup
-    int idx = 0;                        /**<  Int to be incremented to ensure enough data is stored, so inferens can be performed   */
-    int extra_signal = 0;               /**<  Int to be incremented to store more data after the threshold has been exceded   */
-    int fall_nr = 0;                    /**<  Int to be incremented when a fall has been predicted   */
-    char incoming_byte[2];              /**<  Array used to store the incoming UART bytes from the LoPy */
-    float threshold = 1;                /**<  Float for the calculated threshold   */
-    bool got_data = false;              /**<  Bool for checking whether or not, that enough data have been collected in the data signals arrays   */
-    bool initialized = false;           /**<  Bool for checking whether or not, the function has run at least once   */
-
-    /**
-    * @brief  push_array(): Push the new value into the array
-    *
-    *   Pushes the new value into the chosen array, and pops the last array value
-    *   out.
-    *
-    * @param float new_value: The new value to push into the array.
-    * @param float chosen_array[]: Pointer to the chosen array for pushing the new value.
-    * @param int array_length: Int for the length of the chosen array
-    * @return void:
-    *
-    **/
-    void push_array(float new_value, float chosen_array[], int array_length) {
-      for (int i = array_length-1; i >= 0; i--) {
-        if (i == 0) {
-          chosen_array[i] = new_value;
-        }
-        else {
-          chosen_array[i] = chosen_array[i-1];
-        }
-      }
-    };
-
-    /**
-    * @brief  readIMU(): Pushes the read IMU data into the array
-    *
-    *   Pushes the read IMU values into the chosen arrays, and pops the last array values
-    *   out.
-    *
-    * @param float ax: The new accelerometer X-axis value to push into the array.
-    * @param float ay: The new accelerometer Y-axis value to push into the array.
-    * @param float az: The new accelerometer Z-axis value to push into the array.
-    * @param float gx: The new gyroscope X-axis value to push into the array.
-    * @param float gy: The new gyroscope Y-axis value to push into the array.
-    * @param float gz: The new gyroscope Z-axis value to push into the array.
-    * @return void:
-    *
-    **/
-    void readIMU(float ax, float ay, float az, float gx, float gy, float gz) {
-      push_array(-ax, acc_x_arr, SIGNAL_SIZE); // The negative of this value is needed, because the IMU X-axis is reversed compared to the model
-      push_array(ay, acc_y_arr, SIGNAL_SIZE);
-      push_array(az, acc_z_arr, SIGNAL_SIZE);
-      push_array(-gx, gyro_x_arr, SIGNAL_SIZE); // The negative of this value is needed, because the IMU X-axis is reversed compared to the model
-      push_array(gy, gyro_y_arr, SIGNAL_SIZE);
-      push_array(gz, gyro_z_arr, SIGNAL_SIZE);
-    };
-
-    /**
-    * @brief  inc_idx(): // Increment the idx variable and set got_data to true, when enough data is stored in the array
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void inc_idx() {
-      idx++;
-      if (idx >= (SIGNAL_SIZE / 2)) {
-        idx = 0;
-        got_data = true;
-      }
-    };
-
-    /**
-    * @brief  calculate_threshold(): // Calculate new threshold value from the newest accelerometer samples
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void calculate_threshold() {
-      threshold = sqrt(sq(acc_x_arr[0]) + sq(acc_y_arr[0]) + sq(acc_z_arr[0]));
-    };
-
-    /**
-    * @brief  inc_extra(): // Increment the extra variable
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void inc_extra() {
-      extra_signal++;
-    };
-
-    
-    /**
-    * @brief  feature_calculation(): Calculate the features from the signal data from the IMU
-    *
-    *   Calculates the features from the signals data arrays, accelerometer x-axis, y-axis and z-axis
-    *   data arrays and gyroscopes x-axis, y-axus and z-axis data arrays. The calculated features will
-    *   be put in the features array.
-    *
-    * @param none
-    * @return void:
-    *
-    **/
-    void feature_calculation() {
-      feature_calc(features, acc_x_arr, acc_y_arr, acc_z_arr,
-                   gyro_x_arr, gyro_y_arr, gyro_z_arr, SIGNAL_SIZE);
-    };
-
-    /**
-    * @brief  start_audio(): // Starts the Audio PWM signal to generate the alarm
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void start_audio() {
-      // Start Audio PWM signal
-      analogWrite(AUDIO, 50);
-    };
-
-    /**
-    * @brief  stop_audio(): // Stops the Audio PWM signal
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void stop_audio() {
-      // Stop Audio PWM signal
-      analogWrite(AUDIO, 0);
-    };
-
-    /**
-    * @brief  wake_up_lopy(): // Set the wake up pin for the LoPy to high
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void wake_up_lopy() {
-      // Set Wake up pin high
-      digitalWrite(WAKE_UP, HIGH);
-    };
-
-    /**
-    * @brief  stop_wake_up_lopy(): // Set the wake up pin for the LoPy to low
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void stop_wake_up_lopy() {
-      // Set Wake up pin low
-      digitalWrite(WAKE_UP, LOW);
-    };
-
-    /**
-    * @brief  predictor(): Predict whether or not a fall has occured
-    *
-    *   Uses a pointer to the output tensors of the model to predict whether 
-    *   or not a fall has occured.
-    *
-    * @param float* output: Pointer to the output tensor of the TensorFlow Lite model
-    * @return int: 1 = fall detected, 0 = no fall detected.
-    *
-    **/
-    int predictor(float* output) {
-      int this_predict = -1;
-      // If output[1] is bigger than output[0] this means chance of fall is bigger
-      // than the chance of a not fall. The equal is there, because if the model,
-      // is fifty / fifty whether it's a fall or not a fall, we choose it to be a
-      // fall for safety
-      if (output[1] >= output[0]) {
-        // For debugging print the chance of fall
-        Serial.print("F: ");
-        Serial.println(output[1]);
-        // Set the prediction to one, which means a fall
-        this_predict = 1;
-      }
-      // If output[0] is bigger than output[1] this means chance of fall is smaller
-      // than the chance of not fall.
-      else {
-        // For debugging print the chance of fall
-        Serial.print("F: ");
-        Serial.println(output[1]);
-        // Set the prediction to zero, which means not a fall
-        this_predict = 0;
-      }
-      // Return the prediction
-      return this_predict;
-    };
-
-    /**
-    * @brief  generate_fall_name(): Generate a fall name from a fall number
-    *
-    *   Generate a new fall name with "FALL" + fall_number + ".csv", so a new fall
-    *   data file can be generated on the MicroSD card.
-    *
-    * @param char name_array[]: Pointer to the array where the new name is stored
-    * @param int fall_number: Int for fall number wanted in the name_array[]
-    * @return void:
-    *
-    **/
-    void generate_fall_name(char name_array[], int fall_number) {
-      // Generate int to char buffer
-      char int_to_char_str[2];
-      // Read them as int
-      sprintf(int_to_char_str, "%d", fall_number);
-      // Makes sure the first 9 number read 0#, where # is the int number
-      if(fall_number <= 9) {
-        int_to_char_str[1] = int_to_char_str[0];
-        int_to_char_str[0] = '0';
-      }
-      // Generate new array and copy it to the existing array
-      char new_array[] = {'F', 'A', 'L', 'L', int_to_char_str[0], int_to_char_str[1], '.', 'c', 's', 'v',  '\0'};
-      strcpy(name_array, new_array);
-    };
-
-    /**
-    * @brief  lopy_communication(): Communication with LoPy
-    *
-    *   Wake up the LoPy, start the audio alarm, save the signal to the microSD card and then wait for reply from the LoPy. 
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void lopy_communication() {
-      // Set LoPy wake up pin to high, to wake the LoPy
-      wake_up_lopy();
-      // Turn on green LED and Audio to indicate a fall has happened
-      digitalWrite(LEDG, LOW);
-      start_audio();
-      // Increment number of falls
-      fall_nr++;
-
-      // If fall numbers are equal to 100 restart the count at 1
-      if (fall_nr >= 100) {
-        fall_nr = 1;
-      }
-
-      // Function to generate a new name for the file 'FALL' + fall_nr + '.csv'
-      generate_fall_name(fall_name_array, fall_nr);
-
-      Serial.println(fall_name_array);
-      // Save the data to the SD card
-      datalogger::writeSignalValues(CS, fall_name_array, acc_x_arr, acc_y_arr,
-                                    acc_z_arr, gyro_x_arr, gyro_y_arr,
-                                    gyro_z_arr, SIGNAL_SIZE, true);
-
-      // Stay in this loop untill the LoPy sends the "OK" message indicating it has send the fall alarm
-      while (incoming_byte[0] != 'O' && incoming_byte[1] != 'K') {
-        if (Serial1.available() > 0) {
-          // Read the incoming byte:
-          Serial1.readBytes(incoming_byte, 2);
-        }
-      }
-    };
-
-    /**
-    * @brief  reset_fall_variables(): // After communication with the LoPy the system sets the wakeup pin low and stops the audio. It then sets the boolean got_data variable to false.
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void reset_fall_variables() {
-      // Stop the audio warning and set the LoPy wake up pin to low
-      stop_wake_up_lopy();
-      stop_audio();
-      digitalWrite(LEDG, HIGH);
-
-      // Reset variables
-      incoming_byte[0] = '0';
-      incoming_byte[1] = '0';
-      got_data = false;
-    };
-
-    /**
-    * @brief  reset_variables(): // Here the system resets the threshold variable, so it is below the defined threshold, and resets the extra signal variable.
-    *
-    * @param none
-    * @return void
-    *
-    **/
-    void reset_variables() {
-      // Reset variables
-      extra_signal = 0;
-      threshold = 1;
-    };
-
-    /**
-    * @brief  predict_fall(): // Prediction of whether or not a fall has occured and the handling of the scenarios
-    *
-    * @param @param float* TFOutput: Pointer to the output tensor of the TensorFlow Lite model
-    * @return void
-    *
-    **/
-    void predict_fall(float* TFOutput) {
-      // Get prediction value
-      int prediction = predictor(TFOutput);
-
-      // In case of a fall
-      if (prediction == 1) {
-        // Communicate with the LoPy
-        lopy_communication();
-        // Reset fall variables
-        reset_fall_variables();
-      }
-      // Reset variables
-      reset_variables();
-      // This is only for testing and debugging
-      Serial.println(prediction);
-    };
-
-};
-
 // Generate the Ctrl Class object
 afdsdCtrl1 Ctrl;
 
@@ -400,6 +160,26 @@ unsigned long time_end;
 // Int for the input size of the model
 int input_length;                   /**<  Int for the calculated input size of the TensorFlow Lite model   */
 
+#ifdef CONTINUOUS_MODE
+// The overlapping signals, and the time spent on them
+ContinuousWindows windows(CONTINUOUS_HOP);
+ContinuousBudget budget(14.9f, CONTINUOUS_HOP);
+#endif
+
+#ifdef STAGE_TIMING
+// The measured time of the stages of the loop
+StageTimer stage_timer;
+#endif
+
+#ifdef ADAPTIVE_GATE
+// The trigger gate learning the magnitudes of the wearer
+TriggerGate gate;
+#endif
+
+// Arrays for the raw IMU samples read from the FIFO
+int16_t fifo_accel[LSM9DS1_FIFO_SIZE][3];   /**<  Raw accelerometer samples read from the IMU FIFO, oldest first   */
+int16_t fifo_gyro[LSM9DS1_FIFO_SIZE][3];    /**<  Raw gyroscope samples read from the IMU FIFO, oldest first   */
+
 // Globals, used for compatibility with Arduino-style sketches.
 namespace {
 tflite::ErrorReporter* error_reporter = nullptr;
@@ -407,17 +187,39 @@ const tflite::Model* model = nullptr;
 tflite::MicroInterpreter* interpreter = nullptr;
 TfLiteTensor* input = nullptr;
 TfLiteTensor* output = nullptr;
+const float* feature_scales = nullptr;   /**<  The feature scales of the int8 models   */
 
 // Create an area of memory to use for input, output, and intermediate arrays.
-// Finding the minimum value for your model may require some trial and error.
-constexpr int kTensorArenaSize = 70 * 1024;
-uint8_t tensor_arena[kTensorArenaSize];
+// The size is set for each model in tensor_arena.h, and has to be changed with the model.
+// The arena is aligned like the tensor data the planner places in it, so none of it is lost.
+// Define MEASURE_TENSOR_ARENA to report the arena used by the model at start up.
+//#define MEASURE_TENSOR_ARENA
+#ifndef AOT_MODE
+constexpr int kTensorArenaSize = TENSOR_ARENA_SIZE;
+alignas(16) uint8_t tensor_arena[kTensorArenaSize];
+
+#ifdef CASCADE_MODE
+// The cascade splits the arena, the small model uses the start and the large model the rest
+constexpr int kModelArenaSize = FALL_MODEL_ARENA_SIZE;
+tflite::MicroInterpreter* large_interpreter = nullptr;
+TfLiteTensor* large_output = nullptr;
+FallCascade cascade(CASCADE_LOW, CASCADE_HIGH);
+#else
+constexpr int kModelArenaSize = kTensorArenaSize;
+#endif
+
+#ifdef PROFILE_OPS
+// The profilers of the model and the large model of the cascade
+OpProfiler* profiler = nullptr;
+OpProfiler* large_profiler = nullptr;
+#endif
+#endif
 }  // namespace
 
 // The name of this function is important for Arduino compatibility.
 void setup() {
   // Start the two serial connections
-  Serial1.begin(9600); // Communication with the LoPy 4
+  Ctrl.link.begin(LINK_BAUD); // Framed communication with the LoPy 4 on Serial1
   Serial.begin(9600); // This serial communication is only needed for debugging
 
   // Make sure the system doesn't start until UART is connected, only needed for debugging
@@ -431,9 +233,13 @@ void setup() {
   static tflite::MicroErrorReporter micro_error_reporter;
   error_reporter = &micro_error_reporter;
 
+#ifdef AOT_MODE
+  // The model is compiled into the sketch, so there is nothing to set up
+  input_length = aot_model::kInputs;
+#else
   // Map the model into a usable data structure. This doesn't involve any
   // copying or parsing, it's a very lightweight operation.
-  model = tflite::GetModel(fall_model_data); // Changed to model nr: 2
+  model = tflite::GetModel(FALL_MODEL_DATA);
   if (model->version() != TFLITE_SCHEMA_VERSION) {
     error_reporter->Report(
       "Model provided is schema version %d not equal "
@@ -446,12 +252,57 @@ void setup() {
   // This pulls in all the operation implementations we need.
   // NOLINTNEXTLINE(runtime-global-variables)
   static tflite::ops::micro::AllOpsResolver resolver;
+#ifdef PROFILE_OPS
+  // The profilers wrap the resolver, so every operation given to the interpreters is timed
+  static OpProfiler static_profiler(resolver);
+  profiler = &static_profiler;
+  const tflite::OpResolver& model_resolver = static_profiler;
+#else
+  const tflite::OpResolver& model_resolver = resolver;
+#endif
+
+#ifdef MEASURE_TENSOR_ARENA
+  // Paint the arena, so the bytes used by the interpreter can be found
+  paint_arena(tensor_arena, kTensorArenaSize);
+#endif
 
   // Build an interpreter to run the model with.
   static tflite::MicroInterpreter static_interpreter(
-    model, resolver, tensor_arena, kTensorArenaSize, error_reporter);
+    model, model_resolver, tensor_arena, kModelArenaSize, error_reporter);
   interpreter = &static_interpreter;
 
+#ifdef CASCADE_MODE
+  // The large model runs in the rest of the arena. Both models read the features straight from
+  // the feature array of the controller, so the features are only stored once.
+#ifdef PROFILE_OPS
+  static OpProfiler static_large_profiler(resolver);
+  large_profiler = &static_large_profiler;
+  const tflite::OpResolver& large_resolver = static_large_profiler;
+#else
+  const tflite::OpResolver& large_resolver = resolver;
+#endif
+  static tflite::MicroInterpreter static_large_interpreter(
+    tflite::GetModel(fall_model_2_data), large_resolver, tensor_arena + kModelArenaSize,
+    kTensorArenaSize - kModelArenaSize, error_reporter);
+  large_interpreter = &static_large_interpreter;
+  if (interpreter->RegisterPreallocatedInput(reinterpret_cast<uint8_t*>(Ctrl.features), 0) != kTfLiteOk ||
+      large_interpreter->RegisterPreallocatedInput(reinterpret_cast<uint8_t*>(Ctrl.features), 0) != kTfLiteOk ||
+      large_interpreter->AllocateTensors() != kTfLiteOk) {
+    error_reporter->Report("Setting up the cascade failed");
+    // Do not do anything more:
+    while (1);
+  }
+  // Both models read the float features and give float outputs
+  TfLiteTensor* large_input = large_interpreter->input(0);
+  large_output = large_interpreter->output(0);
+  if ((large_input->type != kTfLiteFloat32) || (large_input->dims->size != 2) ||
+      (large_input->dims->data[1] != 46) || (large_output->type != kTfLiteFloat32)) {
+    error_reporter->Report("Bad tensor parameters in the large model of the cascade");
+    // Do not do anything more:
+    while (1);
+  }
+#endif
+
   // Allocate memory from the tensor_arena for the model's tensors.
   TfLiteStatus allocate_status = interpreter->AllocateTensors();
   if (allocate_status != kTfLiteOk) {
@@ -460,19 +311,53 @@ void setup() {
     while (1);
   }
 
+#ifdef MEASURE_TENSOR_ARENA
+  // Report the parts of the arena used by the model, to size the arena in tensor_arena.h
+  ArenaUsage usage = measure_arena(tensor_arena, kModelArenaSize,
+                                   arena_tensor_data(*interpreter, tensor_arena, kModelArenaSize));
+  error_reporter->Report("Tensor arena used: %d of %d bytes (tensor data %d, scratch %d, persistent %d)",
+                         static_cast<int>(usage.total()), kModelArenaSize, static_cast<int>(usage.tensor_data),
+                         static_cast<int>(usage.scratch), static_cast<int>(usage.persistent));
+#endif
+
   // Obtain pointers to the model's input and output tensors.
   // Check if the model input size and dimensions are correct
   input = interpreter->input(0);
   output = interpreter->output(0);
+  // The features are given as floats, or quantized for the int8 models
   if ((input->dims->size != 2) || (input->dims->data[0] != 1) ||
-      (input->dims->data[1] != 46)) {
+      (input->dims->data[1] != 46) ||
+      (input->type != kTfLiteFloat32 && input->type != kTfLiteInt8)) {
     error_reporter->Report("Bad input tensor parameters in model");
     // Do not do anything more:
     while (1);
   }
+  if (output->type != kTfLiteFloat32 && output->type != kTfLiteInt8) {
+    error_reporter->Report("Bad output tensor type in model");
+    // Do not do anything more:
+    while (1);
+  }
+#ifdef CASCADE_MODE
+  // The small model of the cascade reads the float features of the controller
+  if (input->type != kTfLiteFloat32 || output->type != kTfLiteFloat32) {
+    error_reporter->Report("The cascade needs a float model");
+    // Do not do anything more:
+    while (1);
+  }
+#endif
+  // The int8 models keep the scale of every feature, which the features are quantized with
+  if (input->type == kTfLiteInt8) {
+    feature_scales = model_feature_scales(model, input->dims->data[1]);
+    if (feature_scales == nullptr) {
+      error_reporter->Report("The int8 model has no feature scales");
+      // Do not do anything more:
+      while (1);
+    }
+  }
 
-  // Calculate the input length of the model
-  input_length = input->bytes / sizeof(float);
+  // The input length of the model
+  input_length = input->dims->data[1];
+#endif
 
   // Set the Chip Select for the MicroSD card adapter low (There is only one slave for the SPI configuration,
   // therefore it is always low.
@@ -511,6 +396,25 @@ void setup() {
     while (1);
   }
 
+  // Let the IMU store the samples in its FIFO, so they can be read in bursts
+  IMU.setContinuousMode();
+
+  // Save the IMU settings and the model with the fall logs
+  Ctrl.log_info.sample_rate = IMUSampleRate();
+  Ctrl.log_info.accel_resolution = IMU.calcAccel(1);
+  Ctrl.log_info.gyro_resolution = IMU.calcGyro(1);
+  Ctrl.log_info.model_id = FALL_MODEL;
+#ifdef CONTINUOUS_MODE
+  budget.sample_rate = Ctrl.log_info.sample_rate;
+#endif
+#ifdef ADAPTIVE_GATE
+  // Continue with the magnitudes learned before the reboot
+  if (!gate.load(GATE_FILE_NAME)) {
+    error_reporter->Report("No trigger gate saved, learning the wearer");
+  }
+  Ctrl.gate = &gate;
+#endif
+
   // Wait ten seconds until the system starts
   delay(10000);
   Serial.println("Inferens starting!");
@@ -519,67 +423,178 @@ void setup() {
 // The name of this function is important for Arduino compatibility.
 void loop() {
 
-  while (Ctrl.got_data == false) {
-    if (IMU.accelerationAvailable() == true && IMU.gyroscopeAvailable() == true) {
-      // Read the accelerometer and gyroscope output registers
-      IMU.readAccel();
-      IMU.readGyro();
-      // Push the read values to the arrays
-      Ctrl.readIMU(IMU.calcAccel(IMU.ax), IMU.calcAccel(IMU.ay), IMU.calcAccel(IMU.az),
-                   IMU.calcGyro(IMU.gx), IMU.calcGyro(IMU.gy), IMU.calcGyro(IMU.gz));
-      Ctrl.inc_idx();
-    }
+  // Read the samples stored in the IMU FIFO since the last loop in one burst
+  bool overrun = false;
+  STAGE_BEGIN(STAGE_FIFO_READ);
+  int samples = IMU.readFIFO(fifo_accel, fifo_gyro, LSM9DS1_FIFO_SIZE, &overrun);
+  STAGE_END(STAGE_FIFO_READ);
+  if (overrun) {
+    error_reporter->Report("IMU FIFO overrun, samples were lost");
   }
 
-  while (Ctrl.threshold < THRESHOLD) { // Global variable
-    if (IMU.accelerationAvailable() == true && IMU.gyroscopeAvailable() == true) {
-      // Read the accelerometer and gyroscope output registers
-      IMU.readAccel();
-      IMU.readGyro();
-      // Push the read values to the arrays
-      Ctrl.readIMU(IMU.calcAccel(IMU.ax), IMU.calcAccel(IMU.ay), IMU.calcAccel(IMU.az),
-                   IMU.calcGyro(IMU.gx), IMU.calcGyro(IMU.gy), IMU.calcGyro(IMU.gz));
-      // Calculate new threshold value
-      Ctrl.calculate_threshold();
+  for (int i = 0; i < samples; i++) {
+    // Save a new fall signal and handle the reply from the LoPy, without waiting for it. This is done
+    // before the next sample is added, so a fall signal is saved before it's overwritten.
+    Ctrl.update_alarm();
+
+#ifdef CONTINUOUS_MODE
+    // Add the read values to the overlapping signals, until the next signal is complete
+    time_start = micros();
+    STAGE_BEGIN(STAGE_SAMPLE);
+    bool signal_ready = Ctrl.process_continuous_sample(windows, fifo_accel[i][0], fifo_accel[i][1], fifo_accel[i][2],
+                                                       fifo_gyro[i][0], fifo_gyro[i][1], fifo_gyro[i][2]);
+    STAGE_END(STAGE_SAMPLE);
+    budget.add_sample(micros() - time_start);
+    if (signal_ready == false) {
+      continue;
     }
-  }
 
-  Serial.println("R:"); // For debugging
-  // After threshold is exceded, continue to record values for half of the signal size
-  while (Ctrl.extra_signal < (SIGNAL_SIZE / 2)) {
-    if (IMU.accelerationAvailable() == true && IMU.gyroscopeAvailable() == true) {
-      // Read the accelerometer and gyroscope output registers
-      IMU.readAccel();
-      IMU.readGyro();
-      // Push the read values to the arrays
-      Ctrl.readIMU(IMU.calcAccel(IMU.ax), IMU.calcAccel(IMU.ay), IMU.calcAccel(IMU.az),
-                   IMU.calcGyro(IMU.gx), IMU.calcGyro(IMU.gy), IMU.calcGyro(IMU.gz));
-      // Calculate new threshold value
-      Ctrl.inc_extra();
+    // The features of the completed signal are ready, only the last statistics are combined
+    time_start = micros();
+    STAGE_BEGIN(STAGE_FEATURES);
+    Ctrl.continuous_feature_calculation(windows);
+    STAGE_END(STAGE_FEATURES);
+#else
+    // Handle the read values, until the signal after the threshold has been recorded. The raw values
+    // are stored, and only the features are scaled with the IMU resolutions.
+    STAGE_BEGIN(STAGE_SAMPLE);
+    bool signal_ready = Ctrl.process_raw_sample(fifo_accel[i][0], fifo_accel[i][1], fifo_accel[i][2],
+                                                fifo_gyro[i][0], fifo_gyro[i][1], fifo_gyro[i][2]);
+    STAGE_END(STAGE_SAMPLE);
+    if (signal_ready == false) {
+      continue;
     }
-  }
-  
-  if (Ctrl.got_data == true) {
 
     // Calculate features from signals
+    STAGE_BEGIN(STAGE_FEATURES);
     Ctrl.feature_calculation();
-
+    STAGE_END(STAGE_FEATURES);
+#endif
+
+    // The outputs of the model (no fall, fall)
+    float prediction[2];
+
+#ifdef AOT_MODE
+    // Run the model compiled ahead of time straight on the features
+    STAGE_BEGIN(STAGE_INVOKE);
+    aot_model::infer(Ctrl.features, prediction);
+    STAGE_END(STAGE_INVOKE);
+#else
     // Generate pointer to our features array
     const float* fall_features_pointer = Ctrl.features;
 
-    // Place our calculated features values in the model's input tensors
-    for (int i = 0; i < input_length; ++i) {
-      input->data.f[i] = fall_features_pointer[i];
+    // Place our calculated features values in the model's input tensors, quantized with the feature
+    // scales and the scale and zero point of the input for the int8 models
+    if (input->type == kTfLiteInt8) {
+      quantize_features(fall_features_pointer, feature_scales, input->data.int8, input_length,
+                        input->params.scale, input->params.zero_point);
+    }
+    else {
+      for (int j = 0; j < input_length; ++j) {
+        input->data.f[j] = fall_features_pointer[j];
+      }
     }
 
     // Run inference, and report any error
+    STAGE_BEGIN(STAGE_INVOKE);
+#ifdef PROFILE_OPS
+    profiler->begin_invoke();
+#endif
     TfLiteStatus invoke_status = interpreter->Invoke();
+    STAGE_END(STAGE_INVOKE);
+#ifdef PROFILE_OPS
+    profiler->end_invoke();
+    if (profiler->invokes() % 10 == 0) {
+      profiler->report(error_reporter, FALL_MODEL_NAME);
+    }
+#endif
     if (invoke_status != kTfLiteOk) {
       error_reporter->Report("Invoke failed");
-      return;
+      continue;
     }
 
+    // The outputs of the model, dequantized for the int8 models
+    if (output->type == kTfLiteInt8) {
+      dequantize_outputs(output->data.int8, prediction, 2, output->params.scale, output->params.zero_point);
+    }
+    else {
+      prediction[0] = output->data.f[0];
+      prediction[1] = output->data.f[1];
+    }
+#endif
+
+#ifdef CASCADE_MODE
+    // When the small model is uncertain, the large model decides. It reads the same features.
+    // The fall log gets the id of the model that decided.
+    Ctrl.log_info.model_id = FALL_MODEL;
+    if (cascade.escalate(prediction)) {
+      Ctrl.log_info.model_id = 2; // fall_model_f46_2
+      STAGE_BEGIN(STAGE_INVOKE);
+#ifdef PROFILE_OPS
+      large_profiler->begin_invoke();
+#endif
+      TfLiteStatus large_status = large_interpreter->Invoke();
+      STAGE_END(STAGE_INVOKE);
+#ifdef PROFILE_OPS
+      large_profiler->end_invoke();
+      if (large_profiler->invokes() % 10 == 0) {
+        large_profiler->report(error_reporter, "fall_model_f46_2");
+      }
+#endif
+      if (large_status != kTfLiteOk) {
+        error_reporter->Report("Invoke of the large model failed");
+        continue;
+      }
+      // The output type was checked in setup()
+      prediction[0] = large_output->data.f[0];
+      prediction[1] = large_output->data.f[1];
+    }
+    if (cascade.decisions % 10 == 0) {
+      error_reporter->Report("Cascade escalated %d of %d signals", static_cast<int>(cascade.escalations),
+                             static_cast<int>(cascade.decisions));
+    }
+#endif
+
+#ifdef CONTINUOUS_MODE
+    // The time of the features and inference, and the budget of the hop with it
+    time_end = micros();
+    budget.add_window(time_end - time_start);
+    if (budget.windows % 60 == 0) {
+      error_reporter->Report("Continuous hop %d: duty cycle %d per mille, latency %d ms (sample %d us, signal %d us)",
+                             budget.hop, static_cast<int>(budget.duty_cycle() * 1000),
+                             static_cast<int>(budget.latency_ms()), static_cast<int>(budget.sample_us / budget.samples),
+                             static_cast<int>(budget.window_us / budget.windows));
+    }
+#endif
+
     // Predict fall and handle the prediction
-    Ctrl.predict_fall(interpreter->output(0)->data.f);
+    Ctrl.predict_fall(prediction);
   }
+  Ctrl.update_alarm();
+
+#ifdef STAGE_TIMING
+  // Dump the stage timing when it is asked for
+  if (Serial.available() > 0 && Serial.read() == 'T') {
+    stage_timer.dump(Serial);
+    if (!stage_timer.save(STAGE_DUMP_NAME)) {
+      error_reporter->Report("Saving the stage timing failed");
+    }
+  }
+#endif
+
+#ifdef ADAPTIVE_GATE
+  // Save the gate now and then, so it isn't learned again after a reboot
+  if (gate.save_due()) {
+    if (!gate.save(GATE_FILE_NAME)) {
+      error_reporter->Report("Saving the trigger gate failed");
+    }
+    error_reporter->Report("Trigger gate at %d mg: %d triggers, %d inferences, %d falls in %d samples",
+                           static_cast<int>(gate.level() * 1000), static_cast<int>(gate.triggers),
+                           static_cast<int>(gate.inferences), static_cast<int>(gate.alarms),
+                           static_cast<int>(gate.samples));
+  }
+#endif
+
+  // Sleep while the FIFO is filled
+  delay(FIFO_READ_INTERVAL);
 }
@@ -0,0 +1,725 @@
+/**
+  *
+  *
+  * @file:    afds_controller.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Controller holding the signals, features and fall handling of the system
+  *
+  *   The controller doesn't depend on TensorFlow Lite, so it can also be built
+  *   and tested on the workstation.
+  *
+**/
+
+#ifndef AFDS_CONTROLLER_H_
+#define AFDS_CONTROLLER_H_
+
+#include <Arduino.h>
+
+#include "constants.h"
+#include "continuous_windows.h"
+#include "datalogger.h"
+#include "fall_log.h"
+#include "feature_calculation.h"
+#include "lopy_link.h"
+#include "signal_buffer.h"
+#include "stage_timer.h"
+#include "trigger_gate.h"
+
+// States of the fall alarm
+enum AlarmState {
+  ALARM_IDLE,                         /**<  No fall alarm is being sent   */
+  ALARM_WAITING,                      /**<  The LoPy has been woken up, and the acknowledgement of the alarm is awaited   */
+  ALARM_RETRY                         /**<  The wake up pin is low, before the LoPy is woken up again   */
+};
+
+class afdsdCtrl1 : public datalogger {
+  public:
+    // Generate ring buffers for the raw accelerometer and gyroscope values of the signal
+    RawSignalBuffer acc_x_arr;          /**<  Ring buffer used to store the raw x-axis accelerometer data   */
+    RawSignalBuffer acc_y_arr;          /**<  Ring buffer used to store the raw y-axis accelerometer data   */
+    RawSignalBuffer acc_z_arr;          /**<  Ring buffer used to store the raw z-axis accelerometer data   */
+    RawSignalBuffer gyro_x_arr;         /**<  Ring buffer used to store the raw x-axis gyroscope data   */
+    RawSignalBuffer gyro_y_arr;         /**<  Ring buffer used to store the raw y-axis gyroscope data   */
+    RawSignalBuffer gyro_z_arr;         /**<  Ring buffer used to store the raw z-axis gyroscope data   */
+
+    // Generate feature array
+    float features[FEATURE_AMOUNT];     /**<  Array used to store the calculated features from the data signals   */
+    RawFeatureExtractor extractor;      /**<  Extractor updating the features while the signal after the threshold is recorded   */
+
+    // Generate char_array for naming saved fall data
+    char fall_name_array[NAME_SIZE];    /**<  Array used to store the generated fall name   */
+    // Settings saved with the fall signals, and the resolutions used to scale the raw signals. The defaults are
+    // the settings of SetupIMUDefaults() and model f46, and setup() updates them from the IMU.
+    FallLogInfo log_info = {14.9f, 0.000732f, 0.07f, FIRMWARE_VERSION, 1};    /**<  Settings saved in the header of the fall logs   */
+
+    // Variable setup
+    int idx = 0;                        /**<  Int to be incremented to ensure enough data is stored, so inferens can be performed   */
+    int extra_signal = 0;               /**<  Int to be incremented to store more data after the threshold has been exceded   */
+    int fall_nr = 0;                    /**<  Int to be incremented when a fall has been predicted   */
+    float threshold = 1;                /**<  Float for the calculated threshold   */
+    bool got_data = false;              /**<  Bool for checking whether or not, that enough data have been collected in the data signals arrays   */
+    bool initialized = false;           /**<  Bool for checking whether or not, the function has run at least once   */
+
+    // Fall alarm variables
+    AlarmState alarm_state = ALARM_IDLE;  /**<  State of the fall alarm   */
+    unsigned long alarm_time = 0;       /**<  Time in ms when the fall alarm entered its state   */
+    int alarm_attempt = 0;              /**<  Number of the current attempt of sending the fall alarm   */
+    int alarm_failures = 0;             /**<  Amount of fall alarms the LoPy never answered   */
+    bool alarm_repeat = false;          /**<  Bool for a new fall while the fall alarm was sent, so it has to be sent again   */
+    bool log_pending = false;           /**<  Bool for a fall signal which still has to be saved on the MicroSD card   */
+    int alarm_cancels = 0;              /**<  Amount of fall alarms cancelled with the stop button of the LoPy   */
+
+    // The framed link with the LoPy
+    LopyLink link{Serial1};             /**<  The link with the LoPy on Serial1   */
+    AlarmMessage alarm_message = {};    /**<  The alarm being sent to the LoPy, unchanged until it is acknowledged   */
+    AlarmMessage next_alarm = {};       /**<  The alarm of the last fall, sent when the alarm being sent is acknowledged   */
+    uint8_t alarm_seq = 0;              /**<  Sequence number of the alarm frame being sent   */
+    unsigned long alarm_sent_time = 0;  /**<  Time in ms when the alarm frame was last sent   */
+    float alarm_confidence = 0;         /**<  Fall probability of the model for the last fall   */
+    unsigned long lopy_heartbeat = 0;   /**<  Time in ms of the last heartbeat from the LoPy   */
+
+    // The adaptive trigger gate, when it is set the gate decides when the threshold is exceeded
+    TriggerGate* gate = nullptr;        /**<  Pointer to the trigger gate learning the magnitudes of the wearer, or nullptr for the fixed THRESHOLD   */
+
+    /**
+    * @brief  readIMU(): Pushes the raw IMU data into the ring buffers
+    *
+    *   Pushes the raw IMU values into the signal ring buffers, overwriting the oldest
+    *   values.
+    *
+    * @param int16_t ax: The new raw accelerometer X-axis value to push into the array.
+    * @param int16_t ay: The new raw accelerometer Y-axis value to push into the array.
+    * @param int16_t az: The new raw accelerometer Z-axis value to push into the array.
+    * @param int16_t gx: The new raw gyroscope X-axis value to push into the array.
+    * @param int16_t gy: The new raw gyroscope Y-axis value to push into the array.
+    * @param int16_t gz: The new raw gyroscope Z-axis value to push into the array.
+    * @return void:
+    *
+    **/
+    void readIMU(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz) {
+      acc_x_arr.push(negate_raw(ax)); // The negative of this value is needed, because the IMU X-axis is reversed compared to the model
+      acc_y_arr.push(ay);
+      acc_z_arr.push(az);
+      gyro_x_arr.push(negate_raw(gx)); // The negative of this value is needed, because the IMU X-axis is reversed compared to the model
+      gyro_y_arr.push(gy);
+      gyro_z_arr.push(gz);
+    };
+
+    /**
+    * @brief  inc_idx(): // Increment the idx variable and set got_data to true, when enough data is stored in the array
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void inc_idx() {
+      idx++;
+      if (idx >= (SIGNAL_SIZE / 2)) {
+        idx = 0;
+        got_data = true;
+      }
+    };
+
+    /**
+    * @brief  calculate_threshold(): // Calculate new threshold value from the newest accelerometer samples
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void calculate_threshold() {
+      int32_t x = acc_x_arr.newest();
+      int32_t y = acc_y_arr.newest();
+      int32_t z = acc_z_arr.newest();
+      // The squares of the raw values are summed unsigned, as three full scale values don't fit in an int32_t
+      uint32_t magnitude_sq = static_cast<uint32_t>(x * x) + static_cast<uint32_t>(y * y) + static_cast<uint32_t>(z * z);
+      threshold = sqrt(static_cast<float>(magnitude_sq)) * log_info.accel_resolution;
+    };
+
+    /**
+    * @brief  inc_extra(): // Increment the extra variable
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void inc_extra() {
+      extra_signal++;
+    };
+
+    
+    /**
+    * @brief  start_features(): Start the feature extraction when the threshold is exceeded
+    *
+    *   Adds the first half of the signal, which is already stored in the signal ring buffers,
+    *   to the feature extractor oldest first. The rest of the signal is added by update_features()
+    *   while it is recorded.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void start_features() {
+      extractor.reset();
+      for (int i = (SIGNAL_SIZE / 2) - 1; i >= 0; i--) {
+        extractor.add_sample(acc_x_arr[i], acc_y_arr[i], acc_z_arr[i],
+                             gyro_x_arr[i], gyro_y_arr[i], gyro_z_arr[i]);
+      }
+    };
+
+    /**
+    * @brief  update_features(): Add the newest sample in the signal ring buffers to the feature extractor
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void update_features() {
+      extractor.add_sample(acc_x_arr.newest(), acc_y_arr.newest(), acc_z_arr.newest(),
+                           gyro_x_arr.newest(), gyro_y_arr.newest(), gyro_z_arr.newest());
+    };
+
+    /**
+    * @brief  process_raw_sample(): Handle a new raw IMU sample
+    *
+    *   Runs step 1 to 3 of the main loop for a single sample, so the loop never blocks
+    *   while waiting for samples, and the same path can be driven by recorded signals:
+    *
+    *   1: (Get data) Until enough data is stored, the sample is only stored. <br>
+    *   2: (Check for threshold) The threshold is calculated from the sample. When it is exceeded, or
+    *   the trigger gate opens if one is set, the feature extraction is started with the stored part
+    *   of the signal. <br>
+    *   3: (Save extra amount of signal) The features are updated with the sample, until half of the
+    *   signal has been recorded after the threshold was exceeded. <br>
+    *
+    * @param int16_t ax: The new raw accelerometer X-axis value.
+    * @param int16_t ay: The new raw accelerometer Y-axis value.
+    * @param int16_t az: The new raw accelerometer Z-axis value.
+    * @param int16_t gx: The new raw gyroscope X-axis value.
+    * @param int16_t gy: The new raw gyroscope Y-axis value.
+    * @param int16_t gz: The new raw gyroscope Z-axis value.
+    * @return bool: true when the signal is ready for feature calculation and inference, otherwise false.
+    *
+    **/
+    bool process_raw_sample(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz) {
+      // Push the read values to the ring buffers
+      readIMU(ax, ay, az, gx, gy, gz);
+
+      if (got_data == false) {
+        inc_idx();
+        return false;
+      }
+
+      if (threshold < THRESHOLD) { // Global variable
+        // Calculate new threshold value
+        calculate_threshold();
+        if (gate != nullptr) {
+          // The gate learns the magnitude, and only counts it as exceeding the threshold when the gate opens
+          threshold = gate->update(threshold) ? THRESHOLD : 0;
+        }
+        if (threshold >= THRESHOLD) {
+          Serial.println("R:"); // For debugging
+          // Add the part of the signal recorded before the threshold was exceeded to the features
+          start_features();
+        }
+        return false;
+      }
+
+      // Update the features with the new values
+      update_features();
+      inc_extra();
+      return extra_signal >= (SIGNAL_SIZE / 2);
+    };
+
+    /**
+    * @brief  process_continuous_sample(): Handle a new raw IMU sample in the continuous mode
+    *
+    *   Instead of waiting for the threshold, the sample is added to the overlapping signals, and
+    *   every hop samples the signal made of the last SIGNAL_SIZE samples is ready. After a fall
+    *   reset_fall_variables() starts the signals over, so the same fall isn't predicted by the
+    *   signals overlapping it.
+    *
+    * @param ContinuousWindows& windows: The overlapping signals.
+    * @param int16_t ax: The new raw accelerometer X-axis value.
+    * @param int16_t ay: The new raw accelerometer Y-axis value.
+    * @param int16_t az: The new raw accelerometer Z-axis value.
+    * @param int16_t gx: The new raw gyroscope X-axis value.
+    * @param int16_t gy: The new raw gyroscope Y-axis value.
+    * @param int16_t gz: The new raw gyroscope Z-axis value.
+    * @return bool: true when a signal is ready for continuous_feature_calculation() and inference, otherwise false.
+    *
+    **/
+    bool process_continuous_sample(ContinuousWindows& windows, int16_t ax, int16_t ay, int16_t az,
+                                   int16_t gx, int16_t gy, int16_t gz) {
+      // Push the read values to the ring buffers, which hold the signal saved with a fall
+      readIMU(ax, ay, az, gx, gy, gz);
+
+      if (got_data == false) {
+        windows.reset();
+        got_data = true;
+      }
+      // The signals get the same values as the ring buffers, with the X-axis reversed
+      return windows.add_sample(acc_x_arr.newest(), acc_y_arr.newest(), acc_z_arr.newest(),
+                                gyro_x_arr.newest(), gyro_y_arr.newest(), gyro_z_arr.newest());
+    };
+
+    /**
+    * @brief  continuous_feature_calculation(): Calculate the features of the signal completed in the continuous mode
+    *
+    * @param const ContinuousWindows& windows: The overlapping signals.
+    * @return void:
+    *
+    **/
+    void continuous_feature_calculation(const ContinuousWindows& windows) {
+      windows.calc_features(features, log_info.accel_resolution, log_info.gyro_resolution);
+    };
+
+    /**
+    * @brief  process_sample(): Handle a new IMU sample in g's and degrees per second
+    *
+    *   Converts the sample to raw IMU values with the resolutions in log_info, and handles it
+    *   like process_raw_sample(). Used for recorded signals, which are saved in physical units.
+    *
+    * @param float ax: The new accelerometer X-axis value.
+    * @param float ay: The new accelerometer Y-axis value.
+    * @param float az: The new accelerometer Z-axis value.
+    * @param float gx: The new gyroscope X-axis value.
+    * @param float gy: The new gyroscope Y-axis value.
+    * @param float gz: The new gyroscope Z-axis value.
+    * @return bool: true when the signal is ready for feature calculation and inference, otherwise false.
+    *
+    **/
+    bool process_sample(float ax, float ay, float az, float gx, float gy, float gz) {
+      const float inv_accel = 1.0f / log_info.accel_resolution;
+      const float inv_gyro = 1.0f / log_info.gyro_resolution;
+      return process_raw_sample(to_raw(ax, inv_accel), to_raw(ay, inv_accel), to_raw(az, inv_accel),
+                                to_raw(gx, inv_gyro), to_raw(gy, inv_gyro), to_raw(gz, inv_gyro));
+    };
+
+    /**
+    * @brief  feature_calculation(): Calculate the features from the signal data from the IMU
+    *
+    *   Gets the features of the signal from the feature extractor, which has been updated
+    *   with every sample since the threshold was exceeded. The features are scaled with the
+    *   IMU resolutions in log_info, and put in the features array.
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void feature_calculation() {
+      extractor.calc_features(features, log_info.accel_resolution, log_info.gyro_resolution);
+    };
+
+    /**
+    * @brief  start_audio(): // Starts the Audio PWM signal to generate the alarm
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void start_audio() {
+      // Start Audio PWM signal
+      analogWrite(AUDIO, 50);
+    };
+
+    /**
+    * @brief  stop_audio(): // Stops the Audio PWM signal
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void stop_audio() {
+      // Stop Audio PWM signal
+      analogWrite(AUDIO, 0);
+    };
+
+    /**
+    * @brief  wake_up_lopy(): // Set the wake up pin for the LoPy to high
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void wake_up_lopy() {
+      // Set Wake up pin high
+      digitalWrite(WAKE_UP, HIGH);
+    };
+
+    /**
+    * @brief  stop_wake_up_lopy(): // Set the wake up pin for the LoPy to low
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void stop_wake_up_lopy() {
+      // Set Wake up pin low
+      digitalWrite(WAKE_UP, LOW);
+    };
+
+    /**
+    * @brief  predictor(): Predict whether or not a fall has occured
+    *
+    *   Uses a pointer to the output tensors of the model to predict whether 
+    *   or not a fall has occured.
+    *
+    * @param float* output: Pointer to the output tensor of the TensorFlow Lite model
+    * @return int: 1 = fall detected, 0 = no fall detected.
+    *
+    **/
+    int predictor(float* output) {
+      int this_predict = -1;
+      // If output[1] is bigger than output[0] this means chance of fall is bigger
+      // than the chance of a not fall. The equal is there, because if the model,
+      // is fifty / fifty whether it's a fall or not a fall, we choose it to be a
+      // fall for safety
+      if (output[1] >= output[0]) {
+        // For debugging print the chance of fall
+        Serial.print("F: ");
+        Serial.println(output[1]);
+        // Set the prediction to one, which means a fall
+        this_predict = 1;
+      }
+      // If output[0] is bigger than output[1] this means chance of fall is smaller
+      // than the chance of not fall.
+      else {
+        // For debugging print the chance of fall
+        Serial.print("F: ");
+        Serial.println(output[1]);
+        // Set the prediction to zero, which means not a fall
+        this_predict = 0;
+      }
+      // Return the prediction
+      return this_predict;
+    };
+
+    /**
+    * @brief  generate_fall_name(): Generate a fall name from a fall number
+    *
+    *   Generate a new fall name with "FALL" + fall_number + ".afl", so a new fall
+    *   log can be generated on the MicroSD card.
+    *
+    * @param char name_array[]: Pointer to the array where the new name is stored
+    * @param int fall_number: Int for fall number wanted in the name_array[]
+    * @return void:
+    *
+    **/
+    void generate_fall_name(char name_array[], int fall_number) {
+      // The first 9 numbers read 0#, where # is the fall number. The fall numbers go to 99, like the name.
+      snprintf(name_array, NAME_SIZE, "FALL%02u.afl", static_cast<unsigned>(fall_number) % 100);
+    };
+
+    /**
+    * @brief  lopy_communication(): Communication with LoPy
+    *
+    *   Start the fall alarm: Wake up the LoPy, send it the alarm frame and start the audio alarm. The signal is
+    *   saved to the microSD card and the frames from the LoPy are handled by update_alarm(), so the loop keeps
+    *   sampling the IMU while the alarm is sent. If a fall alarm is already being sent, the alarm of this fall is
+    *   sent when the LoPy has acknowledged it.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void lopy_communication() {
+      // Increment number of falls
+      fall_nr++;
+
+      // If fall numbers are equal to 100 restart the count at 1
+      if (fall_nr >= 100) {
+        fall_nr = 1;
+      }
+
+      // Function to generate a new name for the file 'FALL' + fall_nr + '.afl'
+      generate_fall_name(fall_name_array, fall_nr);
+      Serial.println(fall_name_array);
+      // The signal is still in the ring buffers in the next loop, where it is saved by update_alarm()
+      log_pending = true;
+      // The alarm of the newest fall is sent to the LoPy, with the GPS packet set by set_gps_packet()
+      next_alarm.fall_number = fall_nr;
+      next_alarm.confidence = static_cast<uint8_t>(constrain(alarm_confidence, 0.0f, 1.0f) * 255 + 0.5f);
+      next_alarm.features_digest = link_features_digest(features, FEATURE_AMOUNT);
+
+      // The alarm being sent keeps its fall, since the frames sent again have the same sequence number
+      if (alarm_state != ALARM_IDLE) {
+        alarm_repeat = true;
+        return;
+      }
+      alarm_message = next_alarm;
+      // Any frames received before the alarm are not an answer
+      link.flush();
+      // Set LoPy wake up pin to high, to wake the LoPy
+      wake_up_lopy();
+      send_alarm();
+      // Turn on green LED and Audio to indicate a fall has happened
+      digitalWrite(LEDG, LOW);
+      start_audio();
+      STAGE_BEGIN(STAGE_LOPY);
+      alarm_state = ALARM_WAITING;
+      alarm_attempt = 1;
+      alarm_time = millis();
+    };
+
+    /**
+    * @brief  update_alarm(): Handle the fall alarm without blocking
+    *
+    *   Called every loop. Saves a pending fall signal to the microSD card and handles the frames from the LoPy.
+    *   The alarm frame is sent every LINK_RESEND_INTERVAL ms, until the LoPy acknowledges it. If the LoPy doesn't
+    *   acknowledge it within ALARM_TIMEOUT ms, the wake up pin is set low for ALARM_WAKE_PULSE ms and the LoPy is
+    *   woken up again, until ALARM_ATTEMPTS attempts have been made. Then the alarm is given up, which is shown
+    *   with the red LED.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void update_alarm() {
+      if (log_pending == true) {
+        STAGE_SCOPE(STAGE_SD_WRITE);
+        // Save the data to the SD card as a binary fall log
+        datalogger::writeSignalLog(CS, fall_name_array, log_info, acc_x_arr, acc_y_arr,
+                                   acc_z_arr, gyro_x_arr, gyro_y_arr,
+                                   gyro_z_arr, true);
+        log_pending = false;
+      }
+
+      LinkFrame frame;
+      while (link.receive(&frame)) {
+        if (handle_frame(frame)) {
+          return;
+        }
+      }
+
+      if (alarm_state == ALARM_WAITING) {
+        if (millis() - alarm_sent_time >= LINK_RESEND_INTERVAL) {
+          resend_alarm();
+        }
+        if (millis() - alarm_time >= ALARM_TIMEOUT) {
+          stop_wake_up_lopy();
+          if (alarm_attempt >= ALARM_ATTEMPTS) {
+            alarm_failed();
+          }
+          else {
+            alarm_state = ALARM_RETRY;
+            alarm_time = millis();
+          }
+        }
+      }
+      else if (alarm_state == ALARM_RETRY) {
+        if (millis() - alarm_time >= ALARM_WAKE_PULSE) {
+          // Wake the LoPy again
+          alarm_attempt++;
+          wake_up_lopy();
+          send_alarm();
+          alarm_state = ALARM_WAITING;
+          alarm_time = millis();
+        }
+      }
+    };
+
+    /**
+    * @brief  handle_frame(): Handle a frame received from the LoPy
+    *
+    *   The acknowledgement of the alarm frame being sent means the LoPy has sent the alarm. A cancel from the
+    *   stop button stops the alarm. Cancels and heartbeats are acknowledged.
+    *
+    * @param const LinkFrame& frame: The frame.
+    * @return bool: true when the frame ended the alarm
+    *
+    **/
+    bool handle_frame(const LinkFrame& frame) {
+      switch (frame.type) {
+        case LINK_ACK:
+          if (alarm_state == ALARM_WAITING && frame.seq == alarm_seq) {
+            alarm_sent();
+            return true;
+          }
+          break;
+        case LINK_CANCEL:
+          link.send_ack(frame.seq);
+          if (alarm_state != ALARM_IDLE) {
+            alarm_cancelled();
+            return true;
+          }
+          break;
+        case LINK_HEARTBEAT:
+          link.send_ack(frame.seq);
+          lopy_heartbeat = millis();
+          break;
+      }
+      return false;
+    };
+
+    /**
+    * @brief  send_alarm(): // Send the alarm of the last fall to the LoPy as a new frame
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void send_alarm() {
+      uint8_t payload[LINK_MAX_PAYLOAD];
+      uint8_t length = link_encode_alarm(alarm_message, payload);
+      alarm_seq = link.send(LINK_ALARM, payload, length);
+      alarm_sent_time = millis();
+    };
+
+    /**
+    * @brief  resend_alarm(): // Send the alarm frame again, with the same sequence number, so the LoPy can tell it is the same alarm
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void resend_alarm() {
+      uint8_t payload[LINK_MAX_PAYLOAD];
+      uint8_t length = link_encode_alarm(alarm_message, payload);
+      link.resend(LINK_ALARM, alarm_seq, payload, length);
+      alarm_sent_time = millis();
+    };
+
+    /**
+    * @brief  set_gps_packet(): // Set the GPS packet of the last known fix, which is sent with the alarms. A length of 0 sends the alarms without a position.
+    *
+    *   The Nano of this board has no GPS, so the sketch doesn't call it, and the LoPy takes the fix itself with its
+    *   own GPS when it is woken up (get_current_pos() of boot.py). It is kept for a board with the GPS on the Nano.
+    *   The LoPy deep-sleeps after every alarm and loses the key of the delta packets, so only absolute packets
+    *   are sent, and other packets send the alarms without a position.
+    *
+    * @param const uint8_t* packet: The GPS packet, encoded with encodeAbsoluteGPSPacket() of the GPS driver.
+    * @param uint8_t length: Length of the GPS packet, LINK_GPS_MAX_SIZE or 0.
+    * @return void
+    *
+    **/
+    void set_gps_packet(const uint8_t* packet, uint8_t length) {
+      next_alarm.gps_length = length == LINK_GPS_MAX_SIZE ? length : 0;
+      memcpy(next_alarm.gps, packet, next_alarm.gps_length);
+    };
+
+    /**
+    * @brief  alarm_sent(): // The LoPy has answered the fall alarm. If another fall happened meanwhile, it is sent as a new alarm, otherwise the alarm is stopped.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void alarm_sent() {
+      STAGE_END(STAGE_LOPY);
+      stop_wake_up_lopy();
+      // Turn off the red LED, in case an earlier alarm failed
+      digitalWrite(LEDR, HIGH);
+      if (alarm_repeat == true) {
+        alarm_repeat = false;
+        alarm_message = next_alarm;
+        alarm_attempt = 0;
+        STAGE_BEGIN(STAGE_LOPY);
+        alarm_state = ALARM_RETRY;
+        alarm_time = millis();
+        return;
+      }
+      stop_alarm();
+    };
+
+    /**
+    * @brief  alarm_cancelled(): // The wearer pressed the stop button of the LoPy. The alarm is stopped, also the alarm of a fall waiting to be sent.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void alarm_cancelled() {
+      STAGE_END(STAGE_LOPY);
+      alarm_cancels++;
+      alarm_repeat = false;
+      stop_alarm();
+    };
+
+    /**
+    * @brief  alarm_failed(): // The LoPy never answered the fall alarm. The alarm is stopped and the red LED is turned on.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void alarm_failed() {
+      alarm_failures++;
+      alarm_repeat = false;
+      digitalWrite(LEDR, LOW);
+      stop_alarm();
+    };
+
+    /**
+    * @brief  stop_alarm(): // Stops the audio and sets the wakeup pin low, which ends the fall alarm.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void stop_alarm() {
+      // Stop the audio warning and set the LoPy wake up pin to low
+      stop_wake_up_lopy();
+      stop_audio();
+      digitalWrite(LEDG, HIGH);
+      alarm_state = ALARM_IDLE;
+    };
+
+    /**
+    * @brief  reset_fall_variables(): // After a fall the system sets the boolean got_data variable to false, so the signal is collected from the start while the alarm is sent.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void reset_fall_variables() {
+      // Reset variables
+      got_data = false;
+    };
+
+    /**
+    * @brief  reset_variables(): // Here the system resets the threshold variable, so it is below the defined threshold, and resets the extra signal variable.
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void reset_variables() {
+      // Reset variables
+      extra_signal = 0;
+      threshold = 1;
+    };
+
+    /**
+    * @brief  predict_fall(): // Prediction of whether or not a fall has occured and the handling of the scenarios
+    *
+    * @param @param float* TFOutput: Pointer to the output tensor of the TensorFlow Lite model
+    * @return void
+    *
+    **/
+    void predict_fall(float* TFOutput) {
+      // Get prediction value
+      int prediction = predictor(TFOutput);
+      if (gate != nullptr) {
+        gate->inferences++;
+        gate->alarms += prediction == 1;
+      }
+
+      // In case of a fall
+      if (prediction == 1) {
+        alarm_confidence = TFOutput[1];
+        // Start the fall alarm through the LoPy
+        lopy_communication();
+        // Reset fall variables
+        reset_fall_variables();
+      }
+      // Reset variables
+      reset_variables();
+      // This is only for testing and debugging
+      Serial.println(prediction);
+    };
+
+};
+
+#endif  // AFDS_CONTROLLER_H_
@@ -0,0 +1,57 @@
+/**
+  *
+  *
+  * @file:    continuous_windows.cpp
+  * @date:    17-10-2026 07:26:46
+  *
+  * @brief    Overlapping signals for the continuous mode
+  *
+  *
+  *
+  *
+**/
+
+#include "continuous_windows.h"
+
+ContinuousWindows::ContinuousWindows(int hop) {
+  hop_samples = hop < CONTINUOUS_MIN_HOP ? CONTINUOUS_MIN_HOP : (hop > SIGNAL_SIZE ? SIGNAL_SIZE : hop);
+  // Signal k + window_amount starts after signal k is complete, so it can reuse its extractor
+  window_amount = (SIGNAL_SIZE + hop_samples - 1) / hop_samples;
+  reset();
+}
+
+void ContinuousWindows::reset() {
+  samples = 0;
+  completed = -1;
+}
+
+bool ContinuousWindows::add_sample(int16_t acc_x, int16_t acc_y, int16_t acc_z,
+                                   int16_t gyro_x, int16_t gyro_y, int16_t gyro_z) {
+  // A new signal starts every hop samples, in the extractor of the signal window_amount signals earlier
+  if (samples % hop_samples == 0) {
+    extractors[(samples / hop_samples) % window_amount].reset();
+  }
+  samples++;
+
+  // The signals in progress are the last window_amount started, of which the oldest can be complete
+  unsigned long started = (samples + hop_samples - 1) / hop_samples;
+  unsigned long first = started > static_cast<unsigned long>(window_amount) ? started - window_amount : 0;
+  for (unsigned long k = first; k < started; k++) {
+    if (k * hop_samples + SIGNAL_SIZE >= samples) {
+      extractors[k % window_amount].add_sample(acc_x, acc_y, acc_z, gyro_x, gyro_y, gyro_z);
+    }
+  }
+
+  // Signal k is complete with sample k * hop + SIGNAL_SIZE
+  if (samples < static_cast<unsigned long>(SIGNAL_SIZE) || (samples - SIGNAL_SIZE) % hop_samples != 0) {
+    return false;
+  }
+  completed = ((samples - SIGNAL_SIZE) / hop_samples) % window_amount;
+  return true;
+}
+
+void ContinuousWindows::calc_features(float calc_feat[], float accel_resolution, float gyro_resolution) const {
+  if (completed >= 0) {
+    extractors[completed].calc_features(calc_feat, accel_resolution, gyro_resolution);
+  }
+}
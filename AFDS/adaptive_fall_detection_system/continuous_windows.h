@@ -0,0 +1,163 @@
+/**
+  *
+  *
+  * @file:    continuous_windows.h
+  * @date:    17-10-2026 07:26:46
+  *
+  * @brief    Overlapping signals for the continuous mode, and its duty cycle and latency budget
+  *
+  *   In the continuous mode the features and inference run on the last
+  *   SIGNAL_SIZE samples every hop samples, no matter if the threshold is
+  *   exceeded, so falls with a soft impact are classified as well. A new signal
+  *   starts every hop samples, and every signal in progress has its own
+  *   RawFeatureExtractor, which is updated with each sample. When a signal is
+  *   complete its features are ready, so a hop only costs calc_features() and
+  *   the inference, and no signal is run through an extractor again.
+  *
+**/
+
+#ifndef CONTINUOUS_WINDOWS_H_
+#define CONTINUOUS_WINDOWS_H_
+
+#include <stdint.h>
+
+#include "constants.h"
+#include "feature_calculation.h"
+
+// Amount of signals in progress at the smallest hop
+const int CONTINUOUS_MAX_WINDOWS = (SIGNAL_SIZE + CONTINUOUS_MIN_HOP - 1) / CONTINUOUS_MIN_HOP;
+
+/**
+* @brief  ContinuousWindows: The overlapping signals of the continuous mode
+*
+*   Signal k starts with sample k * hop and is complete with sample
+*   k * hop + SIGNAL_SIZE - 1. Its features are the same as the features of the
+*   signal ring buffers of the controller at that sample.
+*
+**/
+class ContinuousWindows {
+  public:
+    /**
+    * @brief  ContinuousWindows(): Set the hop between two signals
+    *
+    * @param int hop: Samples between two signals, clamped to [CONTINUOUS_MIN_HOP, SIGNAL_SIZE].
+    *
+    **/
+    explicit ContinuousWindows(int hop = CONTINUOUS_HOP);
+
+    /**
+    * @brief  reset(): Forget the signals in progress, the next sample starts a new signal
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  add_sample(): Add the next raw sample to the signals in progress
+    *
+    * @param int16_t acc_x: The new raw accelerometer X-axis value.
+    * @param int16_t acc_y: The new raw accelerometer Y-axis value.
+    * @param int16_t acc_z: The new raw accelerometer Z-axis value.
+    * @param int16_t gyro_x: The new raw gyroscope X-axis value.
+    * @param int16_t gyro_y: The new raw gyroscope Y-axis value.
+    * @param int16_t gyro_z: The new raw gyroscope Z-axis value.
+    * @return bool: true when a signal is complete, and its features can be calculated with calc_features()
+    *
+    **/
+    bool add_sample(int16_t acc_x, int16_t acc_y, int16_t acc_z,
+                    int16_t gyro_x, int16_t gyro_y, int16_t gyro_z);
+
+    /**
+    * @brief  calc_features(): Put the features of the last completed signal in the features array
+    *
+    * @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+    * @param float accel_resolution: Accelerometer resolution in g's per LSB.
+    * @param float gyro_resolution: Gyroscope resolution in degrees per second per LSB.
+    * @return void:
+    *
+    **/
+    void calc_features(float calc_feat[], float accel_resolution, float gyro_resolution) const;
+
+    /**
+    * @brief  hop(): Samples between two signals
+    *
+    * @param none
+    * @return int: The hop
+    *
+    **/
+    int hop() const { return hop_samples; };
+
+    /**
+    * @brief  windows(): Amount of signals in progress at the same time, each with a feature extractor
+    *
+    * @param none
+    * @return int: SIGNAL_SIZE divided by the hop, rounded up
+    *
+    **/
+    int windows() const { return window_amount; };
+
+  private:
+    RawFeatureExtractor extractors[CONTINUOUS_MAX_WINDOWS];   /**<  Extractor of every signal in progress   */
+    int hop_samples;          /**<  Samples between two signals   */
+    int window_amount;        /**<  Extractors used for the hop   */
+    unsigned long samples;    /**<  Samples added since the last reset   */
+    int completed;            /**<  Extractor of the last completed signal, or -1   */
+};
+
+/**
+* @brief  ContinuousBudget: Duty cycle and latency of the continuous mode
+*
+*   The time of every sample (adding it to the signals in progress) and of
+*   every signal (calc_features() and the inference) is measured with micros()
+*   on the board. The part of the CPU time used at the sample rate of the IMU
+*   tells if a hop fits, and what is left for the rest of the system.
+*
+**/
+struct ContinuousBudget {
+  float sample_rate;                  /**<  Sample rate of the IMU in Hz   */
+  int hop;                            /**<  Samples between two signals   */
+  unsigned long samples = 0;          /**<  Samples measured   */
+  unsigned long windows = 0;          /**<  Signals measured   */
+  unsigned long sample_us = 0;        /**<  Total time of the samples in us   */
+  unsigned long window_us = 0;        /**<  Total time of the signals in us   */
+  unsigned long max_window_us = 0;    /**<  Longest signal in us   */
+
+  ContinuousBudget(float sample_rate, int hop) : sample_rate(sample_rate), hop(hop) {};
+
+  void add_sample(unsigned long us) { samples++; sample_us += us; };
+  void add_window(unsigned long us) {
+    windows++;
+    window_us += us;
+    if (us > max_window_us) max_window_us = us;
+  };
+
+  /**
+  * @brief  duty_cycle(): Part of the CPU time used by the continuous mode
+  *
+  * @return float: The mean time of a sample and of a hop of signals per second of samples, 0 to 1
+  *
+  **/
+  float duty_cycle() const {
+    float per_sample = samples > 0 ? static_cast<float>(sample_us) / samples : 0.0f;
+    float per_window = windows > 0 ? static_cast<float>(window_us) / windows : 0.0f;
+    return (per_sample + per_window / hop) * sample_rate / 1e6f;
+  };
+
+  /**
+  * @brief  latency_ms(): Longest time from a complete fall signal to its prediction
+  *
+  *   The last sample of a fall can come just after a signal is completed, so it
+  *   waits up to a hop for the next signal to complete, and then for the
+  *   longest feature calculation and inference.
+  *
+  * @return float: Latency in ms
+  *
+  **/
+  float latency_ms() const {
+    return hop * 1000.0f / sample_rate + max_window_us / 1000.0f;
+  };
+};
+
+#endif  // CONTINUOUS_WINDOWS_H_
@@ -18,6 +18,10 @@
 
 #include <SD.h>
 
+#include "fall_log.h"
+#include "sd_reader.h"
+#include "signal_buffer.h"
+
 class datalogger{
   public:
 
@@ -44,12 +48,98 @@ class datalogger{
                                    float acc_z_arr[], float gyro_x_arr[], float gyro_y_arr[],
                                    float gyro_z_arr[], int signal_length, bool overwrite);
 
-    size_t readField(File* file, char* str, size_t size, char* delim);
+    /**
+      * @brief  writeSignalValues(): Write the signal values stored in the ring buffers to the SD card
+      *
+      *   Same as above, but the values are read directly from the signal ring buffers newest first,
+      *   so the signals don't need to be copied into arrays before they are saved.
+    
+      *
+      * @param int cs: The int value for the chip select pin
+      * @param char name[]: Pointer to the name array. This will be the name of the file on the MicroSD card.
+      * @param SignalBuffer acc_x_sig: Ring buffer with the stored accelerometer x-axis data.
+      * @param SignalBuffer acc_y_sig: Ring buffer with the stored accelerometer y-axis data.
+      * @param SignalBuffer acc_z_sig: Ring buffer with the stored accelerometer z-axis data.
+      * @param SignalBuffer gyro_x_sig: Ring buffer with the stored gyroscope x-axis data.
+      * @param SignalBuffer gyro_y_sig: Ring buffer with the stored gyroscope y-axis data.
+      * @param SignalBuffer gyro_z_sig: Ring buffer with the stored gyroscope z-axis data.
+      * @param bool overwrite: Bool to check whether or not to overwrite existing data.
+      * @return void
+      *
+      **/  
+    virtual void writeSignalValues(int cs, char name[], const SignalBuffer& acc_x_sig, const SignalBuffer& acc_y_sig,
+                                   const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig, const SignalBuffer& gyro_y_sig,
+                                   const SignalBuffer& gyro_z_sig, bool overwrite);
+
+    /**
+      * @brief  writeSignalLog(): Write the signal values stored in the ring buffers to the SD card as a binary fall log
+      *
+      *   The signals are encoded as raw int16 samples after a header with the settings in fall_log.h, and
+      *   written with a single write of whole sectors. No Strings are made, so the heap isn't used.
+    
+      *
+      * @param int cs: The int value for the chip select pin
+      * @param char name[]: Pointer to the name array. This will be the name of the file on the MicroSD card.
+      * @param const FallLogInfo& info: The settings saved in the header of the fall log.
+      * @param SignalBuffer acc_x_sig: Ring buffer with the stored accelerometer x-axis data.
+      * @param SignalBuffer acc_y_sig: Ring buffer with the stored accelerometer y-axis data.
+      * @param SignalBuffer acc_z_sig: Ring buffer with the stored accelerometer z-axis data.
+      * @param SignalBuffer gyro_x_sig: Ring buffer with the stored gyroscope x-axis data.
+      * @param SignalBuffer gyro_y_sig: Ring buffer with the stored gyroscope y-axis data.
+      * @param SignalBuffer gyro_z_sig: Ring buffer with the stored gyroscope z-axis data.
+      * @param bool overwrite: Bool to check whether or not to overwrite existing data.
+      * @return bool: true if the whole fall log was written
+      *
+      **/  
+    virtual bool writeSignalLog(int cs, char name[], const FallLogInfo& info, const SignalBuffer& acc_x_sig,
+                                const SignalBuffer& acc_y_sig, const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig,
+                                const SignalBuffer& gyro_y_sig, const SignalBuffer& gyro_z_sig, bool overwrite);
+
+    /**
+      * @brief  writeSignalLog(): Write the raw signal values stored in the ring buffers to the SD card as a binary fall log
+      *
+      *   Same as above, but the raw IMU values are saved as they are.
+    
+      *
+      * @param int cs: The int value for the chip select pin
+      * @param char name[]: Pointer to the name array. This will be the name of the file on the MicroSD card.
+      * @param const FallLogInfo& info: The settings saved in the header of the fall log.
+      * @param RawSignalBuffer acc_x_sig: Ring buffer with the raw accelerometer x-axis data.
+      * @param RawSignalBuffer acc_y_sig: Ring buffer with the raw accelerometer y-axis data.
+      * @param RawSignalBuffer acc_z_sig: Ring buffer with the raw accelerometer z-axis data.
+      * @param RawSignalBuffer gyro_x_sig: Ring buffer with the raw gyroscope x-axis data.
+      * @param RawSignalBuffer gyro_y_sig: Ring buffer with the raw gyroscope y-axis data.
+      * @param RawSignalBuffer gyro_z_sig: Ring buffer with the raw gyroscope z-axis data.
+      * @param bool overwrite: Bool to check whether or not to overwrite existing data.
+      * @return bool: true if the whole fall log was written
+      *
+      **/  
+    virtual bool writeSignalLog(int cs, char name[], const FallLogInfo& info, const RawSignalBuffer& acc_x_sig,
+                                const RawSignalBuffer& acc_y_sig, const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig,
+                                const RawSignalBuffer& gyro_y_sig, const RawSignalBuffer& gyro_z_sig, bool overwrite);
+
+    /**
+    * @brief  readField(): Read a field of a csv file
+    *
+    *   The field ends at a comma, a line break or the end of the file. Carriage returns are skipped,
+    *   and the rest of a field longer than the buffer is skipped.
+  
+    *
+    * @param SdBlockReader* reader: The reader of the file.
+    * @param char* str: Buffer of the field, which is ended with a zero byte.
+    * @param size_t size: Size of the buffer.
+    * @param char* delimiter: Set to the ',' or '\n' which ended the field, or 0 at the end of the file.
+    * @return size_t: The length of the field
+    *
+    **/
+    size_t readField(SdBlockReader* reader, char* str, size_t size, char* delimiter);
 
     /**
     * @brief  readSignalValues(): Read the signal values stored in the file on the SD card
     *
     *   This function looks for a file on the SD card opens it and reads values one line at a time into the chosen arrays.
+    *   The file is read a sector at a time, and the card has to be started with SD.begin() first, like for the
+    *   write functions.
   
     *
     * @param int cs: The int value for the chip select pin
@@ -60,10 +150,10 @@ class datalogger{
     * @param float gyro_x_arr[]: Pointer to the array where the user wants to store gyroscope x-axis data.
     * @param float gyro_y_arr[]: Pointer to the array where the user wants to store gyroscope y-axis data.
     * @param float gyro_z_arr[]: Pointer to the array where the user wants to store gyroscope z-axis data.
-    * @return void
+    * @return int: The amount of lines read, or -1 if the file couldn't be opened
     *
     **/ 
-    virtual void readSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
+    virtual int readSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
                                   float acc_z_arr[], float gyro_x_arr[], float gyro_y_arr[],
                                   float gyro_z_arr[]);
 
@@ -0,0 +1,66 @@
+/**
+  *
+  *
+  * @file:    fall_cascade.h
+  * @date:    17-10-2026 07:09:41
+  *
+  * @brief    Cascade of a small and a large fall model
+  *
+  *   The small model classifies every signal. Only when its fall probability
+  *   is inside the uncertainty band, the large model classifies the signal
+  *   again and decides. Most signals are clearly a fall or clearly not, so the
+  *   cascade costs little more than the small model on average.
+  *
+**/
+
+#ifndef FALL_CASCADE_H_
+#define FALL_CASCADE_H_
+
+/**
+* @brief  FallCascade: Decides when the large model is run, and counts how often it is
+*
+**/
+class FallCascade {
+  public:
+    /**
+    * @brief  FallCascade(): The uncertainty band of the fall probability of the small model
+    *
+    * @param float low: Lowest fall probability the large model is run for.
+    * @param float high: Highest fall probability the large model is run for.
+    *
+    **/
+    FallCascade(float low, float high) : low(low), high(high) {};
+
+    /**
+    * @brief  escalate(): Check if the large model has to classify the signal
+    *
+    * @param const float* output: The two outputs of the small model (no fall, fall).
+    * @return bool: true if the fall probability is inside the uncertainty band
+    *
+    **/
+    bool escalate(const float* output) {
+      decisions++;
+      if (output[1] >= low && output[1] <= high) {
+        escalations++;
+        return true;
+      }
+      return false;
+    };
+
+    /**
+    * @brief  escalation_rate(): The part of the signals classified by the large model
+    *
+    * @return float: Escalations divided by the decisions, 0 before the first decision
+    *
+    **/
+    float escalation_rate() const {
+      return decisions > 0 ? static_cast<float>(escalations) / decisions : 0.0f;
+    };
+
+    float low;                        /**<  Lowest fall probability of the uncertainty band   */
+    float high;                       /**<  Highest fall probability of the uncertainty band   */
+    unsigned long decisions = 0;      /**<  Amount of signals classified by the small model   */
+    unsigned long escalations = 0;    /**<  Amount of signals also classified by the large model   */
+};
+
+#endif  // FALL_CASCADE_H_
@@ -0,0 +1,118 @@
+/**
+  *
+  *
+  * @file:    fall_log.cpp
+  * @date:    17-10-2026 06:47:17
+  *
+  * @brief    Binary format of the fall signals saved on the MicroSD card
+  *
+  *
+  *
+  *
+**/
+
+#include "fall_log.h"
+
+#include <string.h>
+
+static const char FALL_LOG_MAGIC[4] = {'A', 'F', 'D', 'L'};
+
+// The fields are copied byte by byte, because the header fields aren't aligned
+template <typename T>
+static void put(uint8_t* data, int offset, T value) {
+  memcpy(data + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static T get(const uint8_t* data, int offset) {
+  T value;
+  memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+// Write the header of a fall log with SIGNAL_SIZE samples at the start of the block
+static void put_header(uint8_t block[], const FallLogInfo& info) {
+  memset(block, 0, FALL_LOG_BLOCK_SIZE);
+  memcpy(block, FALL_LOG_MAGIC, sizeof(FALL_LOG_MAGIC));
+  put<uint16_t>(block, 4, FALL_LOG_VERSION);
+  put<uint16_t>(block, 6, FALL_LOG_HEADER_SIZE);
+  put<uint16_t>(block, 8, SIGNAL_SIZE);
+  put<uint8_t>(block, 10, FALL_LOG_CHANNELS);
+  put<uint8_t>(block, 11, info.model_id);
+  put<float>(block, 12, info.sample_rate);
+  put<float>(block, 16, info.accel_resolution);
+  put<float>(block, 20, info.gyro_resolution);
+  put<uint16_t>(block, 24, info.firmware_version);
+}
+
+int fall_log_encode(uint8_t block[], const FallLogInfo& info, const SignalBuffer& acc_x_sig,
+                    const SignalBuffer& acc_y_sig, const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig,
+                    const SignalBuffer& gyro_y_sig, const SignalBuffer& gyro_z_sig) {
+  put_header(block, info);
+  const float inv_accel = 1.0f / info.accel_resolution;
+  const float inv_gyro = 1.0f / info.gyro_resolution;
+  int16_t sample[FALL_LOG_CHANNELS];
+  uint8_t* pos = block + FALL_LOG_HEADER_SIZE;
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    sample[0] = to_raw(acc_x_sig[i], inv_accel);
+    sample[1] = to_raw(acc_y_sig[i], inv_accel);
+    sample[2] = to_raw(acc_z_sig[i], inv_accel);
+    sample[3] = to_raw(gyro_x_sig[i], inv_gyro);
+    sample[4] = to_raw(gyro_y_sig[i], inv_gyro);
+    sample[5] = to_raw(gyro_z_sig[i], inv_gyro);
+    memcpy(pos, sample, sizeof(sample));
+    pos += sizeof(sample);
+  }
+  return FALL_LOG_BLOCK_SIZE;
+}
+
+int fall_log_encode(uint8_t block[], const FallLogInfo& info, const RawSignalBuffer& acc_x_sig,
+                    const RawSignalBuffer& acc_y_sig, const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig,
+                    const RawSignalBuffer& gyro_y_sig, const RawSignalBuffer& gyro_z_sig) {
+  put_header(block, info);
+  int16_t sample[FALL_LOG_CHANNELS];
+  uint8_t* pos = block + FALL_LOG_HEADER_SIZE;
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    sample[0] = acc_x_sig[i];
+    sample[1] = acc_y_sig[i];
+    sample[2] = acc_z_sig[i];
+    sample[3] = gyro_x_sig[i];
+    sample[4] = gyro_y_sig[i];
+    sample[5] = gyro_z_sig[i];
+    memcpy(pos, sample, sizeof(sample));
+    pos += sizeof(sample);
+  }
+  return FALL_LOG_BLOCK_SIZE;
+}
+
+int fall_log_decode(const uint8_t data[], size_t size, FallLogInfo& info,
+                    float values[][FALL_LOG_CHANNELS], int max_samples) {
+  if (size < static_cast<size_t>(FALL_LOG_HEADER_SIZE) || memcmp(data, FALL_LOG_MAGIC, sizeof(FALL_LOG_MAGIC)) != 0 ||
+      get<uint16_t>(data, 4) != FALL_LOG_VERSION || get<uint8_t>(data, 10) != FALL_LOG_CHANNELS) {
+    return -1;
+  }
+  // Newer versions may have a bigger header, so the samples start after the saved header size
+  uint16_t header_size = get<uint16_t>(data, 6);
+  int count = get<uint16_t>(data, 8);
+  if (header_size < FALL_LOG_HEADER_SIZE || size < header_size + count * FALL_LOG_CHANNELS * sizeof(int16_t)) {
+    return -1;
+  }
+  info.model_id = get<uint8_t>(data, 11);
+  info.sample_rate = get<float>(data, 12);
+  info.accel_resolution = get<float>(data, 16);
+  info.gyro_resolution = get<float>(data, 20);
+  info.firmware_version = get<uint16_t>(data, 24);
+
+  if (count > max_samples) {
+    count = max_samples;
+  }
+  const uint8_t* pos = data + header_size;
+  for (int i = 0; i < count; i++) {
+    for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+      float resolution = c < 3 ? info.accel_resolution : info.gyro_resolution;
+      values[i][c] = get<int16_t>(pos, 0) * resolution;
+      pos += sizeof(int16_t);
+    }
+  }
+  return count;
+}
@@ -0,0 +1,120 @@
+/**
+  *
+  *
+  * @file:    fall_log.h
+  * @date:    17-10-2026 06:47:17
+  *
+  * @brief    Binary format of the fall signals saved on the MicroSD card
+  *
+  *   A fall log is a 32 byte header followed by the signal as raw int16 IMU
+  *   samples, padded to whole 512 byte sectors, so it can be written to the
+  *   MicroSD card with a single write and without any String conversions.
+  *   All values are little-endian, like on the nRF52840.
+  *
+  *   Header:
+  *   | Offset | Type     | Content                                        |
+  *   |--------|----------|------------------------------------------------|
+  *   | 0      | char[4]  | "AFDL"                                         |
+  *   | 4      | uint16   | Format version (FALL_LOG_VERSION)              |
+  *   | 6      | uint16   | Header size in bytes (FALL_LOG_HEADER_SIZE)    |
+  *   | 8      | uint16   | Amount of samples                              |
+  *   | 10     | uint8    | Channels per sample (6: ax, ay, az, gx, gy, gz)|
+  *   | 11     | uint8    | Model id                                       |
+  *   | 12     | float    | Sample rate in Hz                              |
+  *   | 16     | float    | Accelerometer resolution in g's per LSB        |
+  *   | 20     | float    | Gyroscope resolution in degrees/s per LSB      |
+  *   | 24     | uint16   | Firmware version                               |
+  *   | 26     | uint8[6] | Reserved (zero)                                |
+  *
+  *   The samples are stored like in the signal ring buffers, newest sample
+  *   first and with the x-axes reversed, which is the same order and frame as
+  *   the CSV files written by datalogger::writeSignalValues().
+  *
+**/
+
+#ifndef FALL_LOG_H_
+#define FALL_LOG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constants.h"
+#include "signal_buffer.h"
+
+const uint16_t FALL_LOG_VERSION = 1;          /**<  Version of the fall log format   */
+const int FALL_LOG_HEADER_SIZE = 32;          /**<  Size of the fall log header in bytes   */
+const int FALL_LOG_CHANNELS = 6;              /**<  Signals saved per sample (acc x, y, z and gyro x, y, z)   */
+const int FALL_LOG_SECTOR_SIZE = 512;         /**<  Sector size of the MicroSD card   */
+// Size of a fall log with SIGNAL_SIZE samples, rounded up to whole sectors
+const int FALL_LOG_BLOCK_SIZE = ((FALL_LOG_HEADER_SIZE + SIGNAL_SIZE * FALL_LOG_CHANNELS * 2 + FALL_LOG_SECTOR_SIZE - 1) /
+                                 FALL_LOG_SECTOR_SIZE) * FALL_LOG_SECTOR_SIZE;    /**<  Size of the written fall log in bytes   */
+
+/**
+* @brief  FallLogInfo: The settings saved in the header of a fall log
+*
+**/
+struct FallLogInfo {
+  float sample_rate;                  /**<  Sample rate of the signal in Hz   */
+  float accel_resolution;             /**<  Accelerometer resolution in g's per LSB   */
+  float gyro_resolution;              /**<  Gyroscope resolution in degrees per second per LSB   */
+  uint16_t firmware_version;          /**<  Version of the firmware that saved the signal   */
+  uint8_t model_id;                   /**<  Id of the model that predicted the fall (1 = f46, 2 = f46_2, 3 = f46_3, 4-6 = their int8 versions)   */
+};
+
+/**
+* @brief  fall_log_encode(): Encode the signal ring buffers as a fall log
+*
+*   The values are converted back to the raw IMU values with the resolutions in the info,
+*   which is lossless for values read with the same resolutions.
+*
+* @param uint8_t block[]: Array of FALL_LOG_BLOCK_SIZE bytes where the fall log is stored.
+* @param const FallLogInfo& info: The settings saved in the header.
+* @param SignalBuffer acc_x_sig: Ring buffer with the stored accelerometer x-axis data.
+* @param SignalBuffer acc_y_sig: Ring buffer with the stored accelerometer y-axis data.
+* @param SignalBuffer acc_z_sig: Ring buffer with the stored accelerometer z-axis data.
+* @param SignalBuffer gyro_x_sig: Ring buffer with the stored gyroscope x-axis data.
+* @param SignalBuffer gyro_y_sig: Ring buffer with the stored gyroscope y-axis data.
+* @param SignalBuffer gyro_z_sig: Ring buffer with the stored gyroscope z-axis data.
+* @return int: The size of the fall log, FALL_LOG_BLOCK_SIZE.
+*
+**/
+int fall_log_encode(uint8_t block[], const FallLogInfo& info, const SignalBuffer& acc_x_sig,
+                    const SignalBuffer& acc_y_sig, const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig,
+                    const SignalBuffer& gyro_y_sig, const SignalBuffer& gyro_z_sig);
+
+/**
+* @brief  fall_log_encode(): Encode the raw signal ring buffers as a fall log
+*
+*   The raw IMU values are copied as they are, so the resolutions in the info must be the
+*   resolutions the signals were read with.
+*
+* @param uint8_t block[]: Array of FALL_LOG_BLOCK_SIZE bytes where the fall log is stored.
+* @param const FallLogInfo& info: The settings saved in the header.
+* @param RawSignalBuffer acc_x_sig: Ring buffer with the raw accelerometer x-axis data.
+* @param RawSignalBuffer acc_y_sig: Ring buffer with the raw accelerometer y-axis data.
+* @param RawSignalBuffer acc_z_sig: Ring buffer with the raw accelerometer z-axis data.
+* @param RawSignalBuffer gyro_x_sig: Ring buffer with the raw gyroscope x-axis data.
+* @param RawSignalBuffer gyro_y_sig: Ring buffer with the raw gyroscope y-axis data.
+* @param RawSignalBuffer gyro_z_sig: Ring buffer with the raw gyroscope z-axis data.
+* @return int: The size of the fall log, FALL_LOG_BLOCK_SIZE.
+*
+**/
+int fall_log_encode(uint8_t block[], const FallLogInfo& info, const RawSignalBuffer& acc_x_sig,
+                    const RawSignalBuffer& acc_y_sig, const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig,
+                    const RawSignalBuffer& gyro_y_sig, const RawSignalBuffer& gyro_z_sig);
+
+/**
+* @brief  fall_log_decode(): Decode a fall log into the signal values
+*
+* @param const uint8_t data[]: The fall log.
+* @param size_t size: Size of the fall log in bytes.
+* @param FallLogInfo& info: The settings read from the header.
+* @param float values[][]: Array where the values of every sample are stored, newest first, in g's and degrees per second.
+* @param int max_samples: Amount of samples there is room for in values.
+* @return int: The amount of decoded samples, or -1 if the data isn't a valid fall log.
+*
+**/
+int fall_log_decode(const uint8_t data[], size_t size, FallLogInfo& info,
+                    float values[][FALL_LOG_CHANNELS], int max_samples);
+
+#endif  // FALL_LOG_H_
@@ -0,0 +1,2109 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_2_aot.h
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    The model f46_2 compiled ahead of time to C++
+  *
+  *   Runs the model without the interpreter and the tensor arena. The
+  *   layers do the same float operations in the same order as the reference
+  *   kernels of TensorFlow Lite Micro, so the outputs are the same as Invoke().
+  *
+**/
+
+// Generated from fall_model_2_data with the host tool:
+// aot_compile --out adaptive_fall_detection_system f46_2
+
+#ifndef FALL_MODEL_F46_2_AOT_H_
+#define FALL_MODEL_F46_2_AOT_H_
+
+#include <cmath>
+
+namespace fall_model_f46_2_aot {
+
+constexpr int kInputs = 46;      /**<  Amount of features   */
+constexpr int kHidden = 192;      /**<  Amount of neurons in the hidden layer   */
+constexpr int kOutputs = 2;      /**<  The outputs (no fall, fall)   */
+
+constexpr float kHiddenWeights[192][46] = {
+  {
+    0.24866496f, 0.0795638338f, 0.331166595f, -0.112826943f, -0.198546752f, -0.0987770706f,
+    -0.245303228f, 0.491398275f, 0.332291573f, 0.0260419976f, 0.296949655f, -0.256806582f,
+    0.727952182f, 0.620207667f, 0.435996562f, 0.122211128f, 0.080639869f, -0.128454894f,
+    -0.0732073635f, 0.165000677f, 0.192206994f, -0.00735795079f, 0.279612422f, -0.142433658f,
+    0.566185057f, 0.10932f, 0.0187335033f, 0.0571630299f, -0.0161409862f, -0.0211137645f,
+    0.419798821f, 0.0797603577f, 0.407286495f, 0.658871531f, 0.25359571f, 0.285902619f,
+    0.13027738f, -0.269976228f, 0.317132652f, 0.010762115f, 0.394837141f, -0.0390205681f,
+    0.360553384f, -0.0508035049f, -0.0216571987f, -0.0394505821f
+  },
+  {
+    -0.26131317f, -0.519497633f, -0.66058892f, -0.017225923f, 0.106626846f, 0.183998093f,
+    -0.348799676f, -1.18532026f, -0.192909688f, -0.0727177933f, -0.220906585f, -0.116481557f,
+    -0.521152258f, -0.858822584f, -0.644744813f, 0.018335646f, -0.194042966f, 0.111512877f,
+    0.309624463f, -0.553437352f, 0.48339951f, -0.144710168f, -0.204400495f, 0.0784607008f,
+    -0.361102641f, -0.129509792f, -0.478164166f, -0.0823676735f, 0.129254416f, -0.0418882668f,
+    -0.457359374f, 0.00293110916f, -0.885641098f, -0.815490544f, -0.771736205f, -0.0458658487f,
+    -0.279388607f, 0.516868711f, -0.672147751f, -0.200223029f, -0.456739753f, 0.139812246f,
+    -0.539339304f, 0.00995092373f, -0.0925348103f, 0.0120362882f
+  },
+  {
+    -0.337945312f, 0.347836196f, -0.00768028619f, 0.174665004f, -0.108417071f, 0.160907865f,
+    0.0883562416f, -0.0426231399f, -0.81923604f, -0.37692526f, -0.00613686489f, -0.422168285f,
+    0.0109386193f, 0.109788254f, -0.462721229f, -0.114092514f, -0.0930568725f, 0.147878706f,
+    0.0621655062f, -0.128469974f, -0.2607086f, -0.0692616254f, 0.0777484179f, -0.124601096f,
+    0.00469634216f, 0.0525050759f, -0.0614747405f, 0.149894089f, -0.0288677998f, 0.0370537341f,
+    -0.176503599f, -0.0225994382f, -0.0356846154f, -0.170431226f, -0.652679682f, -0.328922838f,
+    0.00197193981f, 0.12050052f, 0.0631110966f, 0.016766116f, -0.103767358f, 0.152674347f,
+    -0.0741793588f, 0.0836497396f, -0.096975483f, 0.126982987f
+  },
+  {
+    -0.604363859f, -0.722169816f, -0.905440032f, 0.108813703f, 0.153600156f, 0.293322146f,
+    0.489713132f, -1.41535485f, -1.15621066f, -0.146145433f, 0.0423725247f, -0.280671567f,
+    -0.386629879f, -0.946230054f, -0.639055371f, -0.00738702016f, -0.00306875096f, 0.0610780567f,
+    0.465898186f, -0.427199662f, 0.376729101f, 0.0114746811f, -0.00271778763f, -0.0366223827f,
+    -0.523903787f, -0.0575205348f, -0.396608531f, -0.00826898962f, -0.0248094089f, -0.102965593f,
+    -0.125751078f, 0.153443679f, -0.933561623f, -0.967047632f, -0.901584327f, -0.270069301f,
+    -0.259144813f, 0.712149382f, -0.602519453f, -0.0632852837f, -0.370881438f, 0.22816731f,
+    -0.165781751f, 0.0126296971f, 0.0148264226f, 0.0627502427f
+  },
+  {
+    -0.17903614f, -0.174836084f, -0.168426022f, -0.0259358454f, -0.193453044f, 0.016406538f,
+    -0.0595834069f, 0.258379549f, 0.154160097f, -0.17826061f, 0.0412190035f, 0.0254632961f,
+    -0.131906778f, 0.168391466f, -0.168604091f, -0.210613251f, 0.064204827f, -0.131517276f,
+    0.00832740311f, 0.0759754106f, 0.077856198f, 0.0434891768f, 0.132906795f, 0.0580669194f,
+    0.0469917431f, 0.0511342995f, 0.100596011f, 0.000165218065f, -0.0050680018f, -0.211374655f,
+    -0.113671221f, -0.0896929428f, 0.193549126f, -0.0222511496f, 0.10569948f, 0.146841437f,
+    0.0198261291f, 0.0204065833f, 0.064734228f, -0.175169811f, -0.0660909265f, 0.0301714446f,
+    0.138671666f, 0.122461446f, -0.182168826f, -0.144485906f
+  },
+  {
+    -0.0728397518f, -0.173101932f, -0.138387665f, -0.00443519047f, 0.0285809319f, -0.151778772f,
+    0.00282839593f, -0.195552588f, 0.201869428f, -0.0561902747f, -0.0307320431f, -0.199745536f,
+    -0.142847389f, -0.100205258f, -0.108133316f, -0.118222192f, -0.0865162686f, 0.0348673351f,
+    0.0722055733f, -0.0708654523f, 0.0609614886f, 0.145943895f, 0.129384503f, 0.0923850611f,
+    -0.0451052785f, -0.0750811473f, -0.0314062126f, -0.0780486017f, 0.13711302f, -0.108638585f,
+    -0.0297966115f, 0.0240128506f, -0.263716996f, -0.166998506f, 0.0263932087f, -0.0476900935f,
+    -0.0608704425f, 0.178956047f, 0.051344227f, -0.0293249041f, -0.0899781734f, -0.0650542974f,
+    -0.172508985f, -0.0795110241f, -0.0647177026f, -0.166049436f
+  },
+  {
+    -0.0429387242f, 0.103327438f, -0.0855374485f, 0.0230615176f, -0.0687391534f, -0.108482212f,
+    -0.0855686739f, 0.0891690031f, 0.224112481f, 0.168247908f, -0.0148191471f, 0.0349856131f,
+    0.023568362f, -0.0429394431f, -0.0177405421f, 0.0610244684f, -0.0537787043f, -0.133589298f,
+    0.190671369f, 0.0680114999f, 0.173187211f, 0.0875667632f, 0.0474992432f, 0.0520268008f,
+    -0.180593684f, 0.00814492162f, -0.0252744239f, -0.0920824111f, -0.0601512343f, -0.0923986211f,
+    -0.0177792255f, 0.0652391016f, 0.1911183f, 0.0337620787f, 0.0887556598f, -0.0546045676f,
+    0.108608186f, 0.0410355628f, 0.028175883f, -0.111488946f, -0.123757266f, 0.0802457631f,
+    0.113374688f, -0.185344905f, -0.0488443151f, 0.0119695133f
+  },
+  {
+    -0.0682398453f, -0.089305602f, -0.161210746f, -0.123725526f, -0.0672040358f, -0.0305491351f,
+    0.203598768f, -0.042494107f, 0.131021827f, 0.0793390274f, -0.116020501f, -0.0569662489f,
+    0.0826453269f, 0.239686593f, -0.0665179864f, -0.0830600262f, 0.121897295f, -0.145319536f,
+    -0.114157595f, 0.0361614786f, 0.17646578f, 0.18099378f, -0.0227451641f, -0.0287437215f,
+    0.114490539f, 0.0798222497f, 0.0441129096f, 0.127264366f, -0.05562016f, -0.13835749f,
+    -0.0359938964f, 0.137553975f, 0.239286035f, -0.051499784f, 0.0615177006f, 0.112039037f,
+    -0.00437207287f, -0.15146935f, -0.012331089f, -0.0855321735f, 0.147466406f, -0.0772839189f,
+    0.0903386474f, -0.140840814f, -0.0546456091f, -0.0995736495f
+  },
+  {
+    -0.180447623f, 0.0206398293f, -0.045435261f, -0.0236575436f, -0.117834546f, -0.0955518857f,
+    -0.0885925964f, -0.0185029525f, -0.155587554f, -0.108689159f, -0.0449550152f, -0.00504145026f,
+    -0.047463879f, -0.175258532f, 0.0454453938f, 0.0515740104f, -0.176487669f, 0.0916408971f,
+    0.0172925331f, 0.100891441f, -0.0431437977f, 0.0807363316f, 0.0745049939f, 0.0864727348f,
+    -0.094661966f, -0.175078183f, 0.0365047269f, -0.144453958f, -0.0565207563f, -0.107303545f,
+    -0.127181992f, 0.00576044992f, -0.0698610842f, -0.0262418278f, -0.0595808178f, 0.191028014f,
+    -0.187204614f, 0.0714599863f, -0.0901684389f, 0.0390004329f, 0.0726603717f, -0.155007005f,
+    0.0996549651f, -0.0150581263f, 0.0113713406f, -0.153941616f
+  },
+  {
+    0.078615725f, 0.00225346745f, -0.0121833654f, 0.162265316f, 0.111704178f, -0.0638051108f,
+    0.144774765f, 0.101983473f, 0.137603864f, 0.14938955f, -0.109211236f, -0.100483693f,
+    -0.0595575646f, -0.0402134806f, -0.107188843f, 0.132922977f, 0.194039226f, 0.0849005431f,
+    -0.0509635396f, 0.032598298f, 0.109977491f, -0.0529416651f, -0.204665244f, -0.0666130483f,
+    0.0723975301f, 0.0766036958f, 0.107801788f, 0.168407679f, 0.0991548151f, 0.0100512635f,
+    -0.136499718f, 0.018143706f, 0.10979639f, 0.0729429275f, -0.0371323824f, -0.056962654f,
+    0.0385212637f, 0.0776801854f, 0.142963007f, 0.0582349859f, -0.0575384013f, 0.0255551934f,
+    -0.100170776f, 0.111536443f, -0.0599966832f, 0.140139505f
+  },
+  {
+    -0.108888425f, -0.185714543f, 0.0182879064f, 0.0981066972f, -0.154190302f, -0.169260964f,
+    -0.00749821449f, 0.0692207515f, -0.216111332f, 0.0220755059f, -0.146893591f, -0.0624182597f,
+    -0.0609878674f, -0.103014097f, 0.0585108958f, 0.00294922688f, 0.0302173607f, -0.131916106f,
+    0.0519129224f, 0.0174864121f, 0.0319560319f, -0.0409022011f, 0.0944415405f, -0.0859311298f,
+    -0.0822254643f, -0.110498279f, 0.00189706939f, -0.108390778f, -0.165925607f, -0.114493117f,
+    0.0705488622f, 0.0685769096f, 0.0470222868f, 0.123283289f, -0.147560805f, 0.0402201228f,
+    0.0172196031f, 0.0108238887f, -0.0346147679f, -0.122643769f, 0.0252861902f, 0.0171944983f,
+    -0.0172453076f, 0.0155456504f, -0.205995277f, -0.00718445797f
+  },
+  {
+    0.0419794247f, 0.0387630127f, 0.0534258969f, -0.137263685f, 0.0399550796f, 0.151177928f,
+    -0.0995493159f, -0.0443747602f, -0.107515208f, -0.164836138f, 0.0604950972f, 0.0789870843f,
+    -0.127628565f, -0.121036582f, -0.0662359372f, -0.0580507517f, 0.115899764f, 0.0096906554f,
+    0.0278222729f, 0.090952009f, -0.0411786921f, -0.0927489251f, -0.0255573522f, -0.0865463316f,
+    -0.0534902886f, 0.0069283382f, 0.108669959f, 0.16886656f, 0.0773227811f, -0.049612619f,
+    -0.117050551f, -0.126850232f, -0.0879181176f, 0.113479659f, 0.0289124455f, 0.0777390599f,
+    -0.030876521f, 0.108229779f, 0.0437840186f, 0.148548007f, 0.0892661437f, 0.124286346f,
+    -0.0295152646f, 0.14578332f, 0.0871492848f, 0.125776023f
+  },
+  {
+    0.0749836564f, -0.102100573f, -0.16194357f, 0.23704806f, 0.0442246385f, 0.348337054f,
+    -0.130026206f, -0.256634921f, 0.999757409f, 0.403740704f, 0.020754274f, -0.263397098f,
+    -0.391226798f, -0.434297234f, 0.0575876124f, 0.0137030203f, 0.0485442989f, -0.0886783972f,
+    0.172993273f, -0.0836063772f, 0.0786572248f, -0.0498732366f, -0.0773238242f, 0.0357034281f,
+    -0.237452522f, 0.0161335059f, -0.0115469638f, -0.155429795f, 0.0768031031f, 0.0770078674f,
+    0.062594533f, 0.142033368f, -0.457875639f, -0.10586904f, 0.29747349f, 0.133124545f,
+    0.00946546812f, 0.417978346f, -0.363012344f, -0.176493421f, -0.485207409f, -0.20217894f,
+    -0.304381669f, -0.147107065f, -0.104334071f, -0.0645992085f
+  },
+  {
+    -0.201461643f, 0.0298314299f, 0.074133426f, -0.172672987f, -0.106757484f, -0.207239315f,
+    -0.0042457981f, 0.451330662f, -0.312037945f, -0.370007455f, -0.121358007f, 0.323009282f,
+    0.119409814f, 0.16778776f, 0.0900419652f, 0.1780155f, 0.055238992f, -0.0406305939f,
+    0.0593363717f, 0.104222193f, -0.128930598f, -0.0402161516f, 0.0838542208f, 0.123716921f,
+    0.0245398339f, -0.0740498826f, 0.168129042f, -0.0235170126f, 0.0961464122f, -0.102080703f,
+    -0.0344182402f, -0.0509153195f, 0.214458689f, 0.183461577f, 0.0251016859f, -0.304979175f,
+    0.105249532f, -0.455074161f, 0.0265780017f, 0.0210404303f, 0.148666441f, 0.0802272186f,
+    0.100679539f, 0.141552076f, 0.161886677f, 0.127418503f
+  },
+  {
+    0.0811356083f, -0.180073127f, -0.170545012f, -0.151719823f, 0.0647105426f, -0.0179351307f,
+    0.0467702635f, 0.144689798f, 0.0991698653f, 0.0592521057f, -0.0441130623f, 0.142270342f,
+    -0.0515690595f, -0.196142465f, -0.0131960837f, -0.112777188f, -0.192991778f, -0.168609262f,
+    -0.0789147019f, 0.0329324491f, 0.124177523f, 0.0520013832f, -0.0301272571f, 0.129677027f,
+    0.0294433273f, -0.0891581848f, 0.00862346124f, -0.036060717f, -0.148112386f, -0.164029047f,
+    -0.168566212f, -0.000241910122f, 0.0728119835f, 0.210833102f, -0.0330962129f, 0.127326727f,
+    -0.213722885f, 0.0285070091f, -0.0628878474f, 0.0902467221f, 0.0892655477f, 0.0010125424f,
+    -0.153314725f, -0.0124431076f, -0.0658815876f, -0.072440207f
+  },
+  {
+    0.11329072f, 0.133587271f, 0.111560546f, -0.055617746f, 0.0616961718f, 0.138786197f,
+    -0.0870228335f, 0.0549411774f, -0.0117561789f, -0.145979971f, 0.0694773197f, -0.135163113f,
+    -0.0916244164f, -0.141424462f, 0.0128331445f, 0.214406848f, 0.156467363f, 0.209949419f,
+    0.0833469257f, 0.0687520579f, 0.0642569289f, -0.0590621047f, -0.149578586f, -0.140138149f,
+    -0.105461024f, 0.0573714636f, 0.0597935393f, 0.0748355761f, 0.158304945f, 0.00633395836f,
+    0.133138061f, 0.0164721794f, 0.0530541427f, 0.113429092f, 0.104880065f, 0.00377950096f,
+    0.0196837503f, 0.171663865f, 0.104094774f, -0.0141902538f, 0.0496237166f, -0.0447303727f,
+    -0.0999017134f, 0.189676389f, 0.0404814556f, 0.022335425f
+  },
+  {
+    0.0556975231f, -0.0830211416f, 0.0170926154f, -0.145966813f, 0.0324038081f, 0.0564634986f,
+    0.214136228f, -0.0699749812f, 0.150477558f, 0.03236017f, 0.0788183957f, -0.169683337f,
+    -0.055597648f, -0.223463178f, -0.0906640217f, -0.0342980735f, -0.0122501422f, -0.0732948929f,
+    0.16841948f, -0.0250255354f, 0.0600725971f, 0.076441735f, 0.0173166599f, 0.106501661f,
+    -0.0914191902f, -0.0515084304f, -0.185471296f, -0.0767818615f, -0.0514360815f, 0.0233118068f,
+    0.0679478124f, -0.062654905f, -0.18713516f, -0.0797095597f, -0.0205220301f, 0.152676061f,
+    0.0548498854f, 0.218803525f, -0.13265349f, 0.0452311523f, -0.213186607f, -0.096990481f,
+    -0.104272902f, -0.138277486f, 0.0254193563f, -0.20536989f
+  },
+  {
+    0.220261872f, 0.344219357f, 0.459326029f, -0.349269956f, -0.147499457f, -0.351671994f,
+    0.480018079f, 0.878162265f, -1.09236372f, -0.668916941f, -0.269549996f, -0.163571373f,
+    0.64417541f, 0.945504785f, -0.0921613201f, -0.110624425f, 0.00973372255f, -0.0517185703f,
+    -0.489221275f, 0.414960474f, -0.780916989f, -0.0793236643f, -0.0386343822f, -0.114751488f,
+    0.644346833f, 0.0298673268f, 0.468041778f, -0.0081699593f, -0.0302321427f, 0.00856621191f,
+    0.0257404707f, 0.12266881f, 0.821553409f, 0.750866055f, -0.289163113f, -0.232460052f,
+    0.0172372926f, -0.302022696f, 0.565096796f, 0.0820980445f, 0.398433685f, -0.361831278f,
+    0.444814891f, 0.0842403844f, -0.0342466012f, 0.00552453892f
+  },
+  {
+    0.147531986f, 0.312350512f, 0.297587991f, -0.195196584f, -0.180971637f, -0.400841147f,
+    -0.800745666f, 0.655516028f, -0.195147187f, -0.370170146f, -0.392885834f, 0.866926849f,
+    0.123645097f, 0.678606808f, 0.72017014f, -0.174394399f, 0.0500000641f, 0.118067712f,
+    -0.42164281f, 0.539512873f, -0.301454753f, 0.0166318957f, -0.113091141f, 0.246976703f,
+    0.304737061f, -0.225251228f, 0.473421514f, 0.108685888f, -0.0788747668f, 0.0612537637f,
+    -0.218812972f, -0.246316284f, 0.676104665f, 0.555035889f, 0.609355032f, -0.178326145f,
+    0.228804976f, -0.154744387f, 0.456698865f, 0.136949927f, 0.465349227f, -0.510916412f,
+    0.648333967f, 0.00302041951f, 0.0434253253f, -0.014835882f
+  },
+  {
+    -0.0353287756f, -0.153495654f, 0.0828598365f, 0.0572588183f, -0.0741752982f, -0.163665906f,
+    0.0598166808f, 0.142232716f, 0.216671497f, 0.14405033f, 0.0622444153f, 0.121540785f,
+    0.0560644306f, 0.0167400129f, -0.0967579186f, 0.0594279878f, 0.109965801f, -0.208431393f,
+    0.01098016f, 0.0588542856f, 0.142758757f, 0.0998281017f, 0.207871512f, -0.100706458f,
+    0.0387390591f, -0.0955292732f, -0.190303579f, -0.0818679035f, -0.0858222693f, -0.108686775f,
+    -0.0459585339f, -0.0194377266f, 0.0563390031f, 0.0617376901f, -0.0913341865f, 0.160701066f,
+    0.055998683f, 0.0860398412f, -0.113015041f, -0.188861832f, -0.132326081f, -0.177704543f,
+    0.000946162327f, -0.0560207106f, -0.156230375f, -0.173514843f
+  },
+  {
+    0.0948085412f, -0.0420893431f, 0.00465742871f, 0.0820107311f, 0.0183749795f, 0.180633262f,
+    0.0661724731f, -0.247207999f, -0.0971026421f, -0.106825039f, 0.0866368413f, -0.155491024f,
+    0.0971923769f, -0.0219755154f, -0.0291980878f, -0.0346027315f, -0.142313108f, 0.0471035652f,
+    0.0810507759f, -0.132963732f, 0.0406716689f, 0.164032608f, -0.0462353751f, -0.0598056428f,
+    -0.187411249f, 0.0527613387f, -0.0984767973f, -0.0593504086f, -0.0692333728f, 0.0986486673f,
+    -0.117059804f, 0.168943703f, -0.111648396f, -0.0345709622f, -0.169333905f, -0.0126653994f,
+    -0.173534423f, 0.242093891f, -0.117394194f, -0.183322579f, -0.0135019505f, -0.125449657f,
+    -0.141730562f, -0.130866781f, -0.217613295f, 0.066095002f
+  },
+  {
+    0.252820045f, -0.136947855f, -0.153819129f, -0.105344124f, -0.0243419744f, 0.0187760759f,
+    -0.0277082622f, -0.243323267f, -0.0469982065f, -0.0900831744f, 0.250896543f, -0.00985988881f,
+    -0.365473688f, -0.46008718f, -0.212950945f, -0.13843438f, 0.10015659f, 0.00638324069f,
+    0.167288736f, -0.0486274585f, 0.140545234f, 0.0820342451f, -0.0457090512f, -0.0320648849f,
+    -0.0635903105f, 0.0375474244f, -0.130384058f, -0.0713884309f, 0.110185184f, 0.0469525792f,
+    0.0763435587f, -0.0761833638f, -0.465444386f, -0.249323294f, -0.0997667313f, 0.113415718f,
+    -0.21279794f, 0.326716065f, -0.123797826f, -0.0681394711f, -0.240208849f, 0.0398268066f,
+    -0.188276574f, 0.0403301753f, -0.245163247f, -0.219942451f
+  },
+  {
+    -0.0672187284f, 0.150923938f, 0.124869727f, 0.184000969f, 0.0679338276f, 0.0136242406f,
+    0.10037297f, -0.11968004f, -0.188091516f, -0.062626943f, 0.0269214995f, -0.0727896169f,
+    -0.0705552772f, -0.0313188098f, 0.043030493f, 0.0257095117f, 0.18280752f, -0.0190368146f,
+    0.0398217961f, 0.0874191672f, -0.0304908399f, -0.0609409139f, -0.20886901f, -0.182382748f,
+    0.0889192969f, 0.0852077454f, 0.139794275f, -0.0128784385f, 0.0673637837f, 0.199998945f,
+    -0.0307139177f, 0.0136882532f, -0.0654429272f, 0.0831999257f, -0.156272069f, -0.0107999183f,
+    0.137405261f, 0.139885277f, 0.175942749f, 0.0608083494f, 0.132285461f, 0.187698334f,
+    0.199085549f, 0.203063384f, 0.0498347618f, 0.109957673f
+  },
+  {
+    0.153588966f, 0.164791524f, -0.0563377663f, 0.238543704f, 0.000395889074f, 0.177538589f,
+    -0.101582058f, -0.0963142887f, -0.099300392f, 0.0411463529f, 0.243038788f, -0.0800149813f,
+    -0.0730623752f, -0.218994722f, 0.158651754f, 0.0067791054f, -0.0728867874f, -0.0482023768f,
+    -0.174224615f, -0.162560388f, 0.055596482f, -0.0613040999f, -0.0616393089f, 0.066839911f,
+    0.129973695f, 0.0224867687f, 0.228329346f, 0.0706377476f, 0.11110016f, 0.226651251f,
+    0.15920788f, -0.164714471f, -0.172639161f, 0.0645176247f, 0.086163722f, -0.0629503131f,
+    0.0562618412f, -0.0584893487f, -0.00544009078f, 0.096124813f, 0.145815894f, -0.0565032773f,
+    0.00118428259f, 0.115892097f, 0.0104608126f, 0.0204808135f
+  },
+  {
+    -0.10324201f, 0.0780531615f, -0.110222854f, -0.0514037646f, 0.0333281718f, 0.123728178f,
+    -0.00738533912f, -0.0890419707f, -0.13821502f, -0.33308664f, 0.048841618f, -0.121371917f,
+    0.0164667275f, -0.193360075f, -0.0148731824f, -0.120220706f, -0.0959073007f, -0.152230814f,
+    -0.0771879777f, -0.104088798f, 0.0324804522f, 0.0320933014f, 0.0934445634f, 0.0822871923f,
+    -0.177288875f, -0.222521201f, -0.143863842f, 0.170612067f, -0.0432302617f, -0.0644541234f,
+    -0.1735771f, 0.136615068f, -0.346028179f, 0.0028757432f, -0.251919538f, -0.186868012f,
+    0.151883438f, 0.145740762f, 0.102587499f, -0.180136025f, -0.0580123663f, -0.0456824675f,
+    -0.197597399f, -0.10707593f, -0.164976478f, 0.0856434032f
+  },
+  {
+    -0.0232901797f, -0.0226207152f, 0.0837737918f, -0.0522704199f, 0.035703972f, 0.102031283f,
+    -0.0940532684f, -0.0481527001f, -0.0163535867f, -0.0928920731f, 0.0201210491f, -0.136345983f,
+    -0.122635715f, -0.202689856f, 0.00848711189f, 0.15050301f, 0.0365220979f, -0.0420260951f,
+    0.0701918676f, -0.0612417385f, -0.0209525861f, -0.137864143f, -0.196666822f, -0.0449022688f,
+    -0.0888876319f, -0.115488522f, 0.181715906f, 0.172283649f, 0.16247049f, 0.102875806f,
+    0.0877058059f, 0.0376550816f, -0.208349735f, -0.147752449f, -0.0397741012f, 0.100102022f,
+    -0.0382958949f, 0.222517401f, 0.131595314f, 0.0803529769f, -0.012873604f, -0.124549381f,
+    0.158804044f, 0.10217528f, 0.0643622205f, 0.150438204f
+  },
+  {
+    -0.0347607285f, 0.0657983571f, 0.149849281f, -0.0556042194f, 0.023247648f, -0.138267532f,
+    0.112039514f, 0.201324195f, 0.166849285f, -0.0239250846f, -0.115117215f, 0.108467139f,
+    0.00903006271f, 0.245638147f, 0.322183102f, 0.0375775173f, -0.115494974f, 0.134635329f,
+    0.0878252536f, 0.222307011f, -0.119055234f, 0.0882381201f, 0.00735515356f, -0.168691367f,
+    0.142050087f, -0.0146189528f, 0.205473557f, -0.0669915527f, 0.131851047f, -0.0707282424f,
+    0.0642198697f, -0.0461947434f, 0.431706488f, 0.25386706f, 0.138689741f, 0.111756518f,
+    0.155145228f, -0.209090352f, -0.00399954291f, 0.247243404f, 0.19424437f, 0.175752729f,
+    0.209767237f, 0.185737133f, 0.145178944f, -0.0668837354f
+  },
+  {
+    -0.0194685906f, -0.0102709085f, -0.0140272425f, -0.0697452575f, -0.17410256f, -0.0794304758f,
+    0.13642472f, 0.271203876f, -0.187495723f, -0.16557835f, -0.111634038f, -0.39141959f,
+    0.228429481f, 0.345287412f, 0.0685510486f, -0.139346808f, 0.0347427763f, -0.118572436f,
+    0.0237600934f, 0.0886326805f, -0.220937252f, -0.0207791124f, -0.118637741f, -0.148863271f,
+    0.125016093f, 0.093745552f, 0.174229383f, -0.0581401326f, -0.0577788167f, 0.00614330778f,
+    -0.128684878f, 0.145614609f, 0.101764061f, 0.095694527f, -0.0930380374f, 0.0959516168f,
+    -0.0795802176f, -0.0428507887f, 0.15717268f, 0.176302969f, 0.250187278f, -0.0483441316f,
+    0.14743568f, -0.10551551f, 0.0940272808f, 0.0617056973f
+  },
+  {
+    0.102938153f, 0.0144833047f, -0.0199535582f, 0.00363036804f, -0.0102758743f, 0.0683591217f,
+    -0.214994639f, 0.0956024528f, -0.0626783222f, -0.0648825243f, -0.00622136472f, 0.0148124462f,
+    0.0722649172f, -0.0405550413f, -0.00440651737f, 0.12436676f, 0.18363975f, -0.0158949327f,
+    0.0628226399f, -0.00405584183f, -0.100178465f, 0.0638640299f, -0.129001975f, 0.0418958627f,
+    0.0512444898f, 0.039937567f, 0.175516963f, 0.0419050865f, 0.1309762f, 0.15790844f,
+    0.0196142197f, -0.153035194f, 0.17128624f, -0.0202081446f, 0.161310211f, -0.0300368275f,
+    0.19725287f, -0.155045286f, -0.00387845305f, 0.0879412517f, 0.0114842234f, 0.195476055f,
+    0.0783883035f, -0.0509587936f, 0.0518525839f, 0.0377922766f
+  },
+  {
+    -0.059638679f, -0.193206966f, -0.0906193852f, -0.207410768f, -0.079830125f, 0.0516140945f,
+    -0.0487251841f, -0.0189693589f, 0.101188414f, 0.0966404229f, -0.0746094882f, 0.0941344351f,
+    -0.158552125f, 0.14423795f, 0.102069534f, -0.106421269f, -0.123749658f, -0.179421887f,
+    0.191006601f, 0.132113785f, 0.00739419321f, -0.0111969393f, 0.109898046f, 0.0671381727f,
+    0.0695267767f, -0.0753444135f, 0.0343760476f, -0.0696324632f, -0.0247439742f, -0.11193528f,
+    -0.030682696f, -0.0626724809f, 0.181900784f, 0.168821335f, 0.0187515374f, 0.0878689587f,
+    -0.204003021f, -0.0204579309f, 0.0592956543f, -0.158339232f, 0.104449093f, -0.0518745333f,
+    -0.14513427f, 0.0548745617f, -0.187241957f, -0.0654474646f
+  },
+  {
+    -0.236612082f, -0.186626017f, -0.207292587f, 0.110939361f, -0.0869012699f, -0.0760745779f,
+    0.0189051349f, -0.372124165f, -0.234315842f, -0.000304545101f, 0.362108171f, -0.362919599f,
+    -0.053185951f, -0.365533561f, -0.297222316f, -0.0194592625f, -0.124149203f, -0.20227249f,
+    0.00278168684f, -0.119062878f, 0.126901537f, -0.0912694111f, -0.0562533326f, 0.152388945f,
+    -0.147531867f, -0.290269077f, -0.118566483f, 0.0347447582f, -0.0972554833f, -0.203681394f,
+    0.033367943f, 0.208439529f, -0.343177408f, -0.139538676f, -0.444442987f, 0.0427629426f,
+    -0.0180536304f, 0.152996406f, -0.175369903f, -0.113265477f, -0.175641313f, -0.0471887887f,
+    -0.115817986f, 0.0185137186f, -0.181515098f, -0.141437069f
+  },
+  {
+    -0.146318167f, -0.200758398f, -0.0314642675f, 0.0967994183f, -0.0613807254f, -0.159868389f,
+    0.0748124719f, -0.125244662f, -0.0568456687f, 0.0744702294f, 0.0788825005f, 0.00765362661f,
+    -0.0095908111f, -0.0512660965f, -0.167299807f, -0.0145824542f, -0.129502416f, 0.010371685f,
+    0.202755049f, -0.0453063846f, 0.0129372599f, -0.0684353039f, 0.0768154785f, 0.114543833f,
+    -0.0488697812f, -0.165227741f, -0.161010981f, -0.0358563475f, -0.145719871f, 0.068434678f,
+    -0.0802802891f, 0.20332174f, -0.178284526f, -0.117071934f, -0.241353124f, -0.00885643251f,
+    0.04952145f, 0.209475219f, -0.102415673f, -0.211700022f, -0.0594321974f, -0.0958454236f,
+    0.0114235654f, -0.0363395214f, -0.0925208852f, -0.168958306f
+  },
+  {
+    -0.0482862592f, 0.645086765f, 0.396889478f, -0.109870799f, -0.171989575f, -0.314774007f,
+    -0.669752538f, 0.717756152f, -0.71450609f, -0.0369165353f, -0.0289393105f, 0.511153579f,
+    0.336861402f, 0.479938388f, 0.176659182f, -0.0125629865f, 0.034084186f, 0.0727455541f,
+    -0.479511142f, 0.238133907f, -0.740460575f, 0.0246236604f, -0.030887207f, -0.105087154f,
+    0.481260478f, 0.447797775f, 0.630581498f, 0.12610139f, -0.117375128f, -0.0564332195f,
+    0.149279803f, -0.197104037f, 0.658750057f, 0.531354487f, -0.0489848182f, -0.563888252f,
+    0.170123503f, -0.557334721f, 0.474947006f, 0.354148f, 0.497898072f, 0.183710679f,
+    0.320782244f, -0.0530535802f, -0.00594744412f, 0.0820103213f
+  },
+  {
+    0.0985004529f, 0.416147888f, 0.192631677f, 0.0225207638f, -0.205622301f, 0.112257592f,
+    0.133381382f, 0.27725172f, 0.253002584f, 0.53360939f, -0.173223019f, 0.257495135f,
+    0.115219355f, 0.398759514f, 0.417820513f, -0.163143367f, 0.0367548503f, 0.0537194274f,
+    -0.170108289f, 0.300017834f, -0.145628676f, 0.0952891186f, -0.0168243628f, -0.0355005525f,
+    0.12702699f, 0.17843762f, 0.376386106f, -0.0555327944f, 0.112525851f, 0.0771687105f,
+    0.118523419f, -0.225664392f, 0.635624409f, 0.390546978f, 0.340780377f, 0.135000229f,
+    -0.0408358537f, -0.28345713f, 0.262961775f, 0.211222559f, 0.218097076f, -4.50274019e-05f,
+    0.396628082f, 0.115809664f, 0.147520065f, 0.0202705879f
+  },
+  {
+    -0.183147341f, 0.290556759f, 0.235443547f, -0.156148896f, -0.277858734f, -0.357290566f,
+    0.0617898628f, 0.43259415f, -0.502622604f, 0.0732141212f, -0.0908532515f, -0.243333995f,
+    0.521936476f, 0.636494875f, 0.400289595f, -0.0190100744f, 0.0144441454f, 0.0615484491f,
+    -0.380013496f, 0.183563769f, -0.539189756f, 0.100078665f, -0.0665021837f, -0.0736823007f,
+    0.530769944f, 0.521986961f, 0.344384968f, 0.0911157504f, -0.113757387f, -0.0886236504f,
+    0.235149831f, 0.14360854f, 0.660265803f, 0.405811876f, 0.00627931533f, -0.201050952f,
+    0.238929272f, -0.464915544f, 0.388189882f, 0.498912275f, 0.621154249f, 0.425016731f,
+    0.466860712f, 0.0525290854f, 0.194278374f, 0.143266812f
+  },
+  {
+    -0.185034707f, -0.012645307f, 0.00377079542f, 0.0963517427f, -0.130653694f, -0.151517823f,
+    0.314980626f, -0.280840874f, -0.336388499f, 0.00618993212f, 0.154922828f, -0.210049272f,
+    -0.184623852f, -0.32331109f, -0.256846279f, -0.144486189f, -0.153233111f, -0.0984276608f,
+    0.210341662f, 0.0651348829f, 0.0539218597f, 0.0409239791f, 0.084543176f, 0.0634231493f,
+    -0.134906277f, 0.0251107663f, -0.0952589959f, 0.150429562f, 0.111235484f, -0.0228352044f,
+    0.00356727f, 0.00776644796f, -0.374092311f, -0.265162259f, -0.265668839f, -0.110264719f,
+    0.0294519905f, 0.103268608f, -0.183299348f, 0.0138363354f, -0.152271166f, -0.208527759f,
+    -0.185019374f, -0.0711415112f, -0.119416624f, -0.0259705894f
+  },
+  {
+    0.116067901f, 0.00117131136f, 0.156846523f, -0.146504417f, -0.053260237f, -0.0788245797f,
+    -0.149227932f, 0.196496069f, 0.310041457f, 0.385576785f, -0.152073175f, 0.216735542f,
+    0.154467061f, 0.239124283f, 0.312921792f, 0.0574880317f, -0.0161512047f, 0.0430624112f,
+    0.0244128536f, 0.174613282f, 0.20716162f, 0.227780268f, 0.0929450914f, -0.040805988f,
+    0.0975487977f, -0.0449960865f, 0.0385285392f, 0.101950876f, -0.0938342661f, -0.0736149326f,
+    0.049455706f, -0.141881719f, 0.271280795f, 0.0666448772f, 0.164106503f, -0.00010461577f,
+    0.0663616881f, 0.0113069061f, 0.0400092788f, 0.0209983904f, 0.108868472f, 0.134278342f,
+    0.0924865901f, -0.0655776113f, -0.104220085f, -0.00511573162f
+  },
+  {
+    -0.100522019f, -0.810811877f, -0.742405355f, 0.131739452f, 0.0953620151f, 0.313470125f,
+    0.949875355f, -1.2454195f, 0.418690771f, -0.282113135f, 0.118849479f, -0.596822858f,
+    -0.661357045f, -0.957667112f, -0.544831693f, -0.0522437543f, 0.0988123417f, -0.132435128f,
+    0.438843578f, -0.453285784f, 0.637765884f, 0.057013426f, -0.132782191f, 0.119848534f,
+    -0.570952177f, -0.522274494f, -0.422359526f, 0.0400116183f, -0.115718991f, 0.0884033889f,
+    -0.23444052f, 0.0568102598f, -0.939457178f, -1.08876348f, -0.391853184f, 0.21432063f,
+    -0.38654238f, 0.678097188f, -0.593128741f, -0.3882083f, -0.60727632f, 0.0714910477f,
+    -0.177634895f, 0.00599900773f, 0.0190120693f, 0.0273678117f
+  },
+  {
+    -0.0741309226f, -0.410647482f, -0.57562834f, 0.235306457f, -0.068393141f, 0.163725764f,
+    1.06154406f, -1.05649853f, -0.512987077f, -0.256133229f, -0.0881630629f, -0.387271821f,
+    -0.458341628f, -1.07891929f, -0.458285779f, 0.0566091388f, -0.000845408707f, 0.106694199f,
+    0.245114088f, -0.460314393f, 0.0151851503f, -0.0106613943f, -0.0404881798f, -0.107208654f,
+    -0.475214303f, -0.443332225f, -0.52948612f, -0.0156315453f, -0.0742897838f, -0.0777929947f,
+    -0.209981874f, 0.0886827335f, -1.1150645f, -0.892055571f, -0.669002295f, -0.281610101f,
+    -0.266382903f, 0.573234439f, -0.469132841f, -0.440366179f, -0.496247441f, -0.267148912f,
+    -0.402025014f, -0.0223137271f, 0.0196745824f, -0.0264785253f
+  },
+  {
+    -0.0926525965f, -0.0499948114f, -0.0245340932f, -0.0471586846f, -0.0645010248f, 0.083188422f,
+    0.0837346613f, -0.116536811f, -0.0752619728f, -0.114611395f, 0.0359854549f, 0.0348881558f,
+    0.210361391f, -0.0344025232f, -0.0571274571f, 0.12966913f, 0.145947874f, 0.0223428812f,
+    0.0713484213f, 0.0234681461f, 0.0968801677f, -0.173779398f, 0.0448852852f, -0.161191732f,
+    -0.0826720744f, -0.0162443593f, 0.084064208f, 0.0657804981f, 0.155787483f, 0.015186497f,
+    -0.0950342417f, 0.0804303363f, 0.147992834f, 0.0602404512f, 0.0894369483f, -0.155889422f,
+    0.151977524f, -0.0800072551f, -0.0874506086f, 0.0400770418f, 0.0468208119f, -0.0606048852f,
+    0.155088216f, -0.0248720143f, 0.194585919f, 0.0267962962f
+  },
+  {
+    0.155846775f, -0.143376827f, -0.0415089838f, -0.0440336056f, 0.124574468f, -0.0056216591f,
+    -0.177752972f, -0.32473883f, 0.765574157f, 0.605024874f, -0.0632071346f, -0.0632629693f,
+    -0.209039271f, -0.130879402f, 0.286844671f, -0.0111291958f, 0.104694903f, -0.14322418f,
+    0.0665689111f, 0.0628265962f, 0.222255588f, -0.0448116958f, -0.104922891f, 0.130648062f,
+    -0.0680788532f, -0.184150845f, 0.0304291379f, -0.133526161f, 0.0879967734f, 0.0818014219f,
+    0.0873100609f, -0.17032066f, -0.282372832f, -0.227804422f, 0.298047185f, 0.0391898118f,
+    -0.0847361311f, 0.347244412f, -0.118278936f, -0.0950764939f, -0.00455520116f, 0.102870435f,
+    0.0284844544f, -0.159106955f, -0.0799188614f, -0.167663634f
+  },
+  {
+    0.0243038312f, 0.17662701f, 0.114402704f, 0.0892935321f, -0.236389264f, -0.166227832f,
+    0.305192739f, 0.303668827f, -0.176635399f, -0.0591579266f, -0.122127108f, -0.0110658323f,
+    0.197407648f, 0.473623663f, 0.108346649f, 0.0135754794f, 0.0388393365f, -0.135703996f,
+    -0.276307017f, 0.0800056532f, -0.198711291f, -0.0701661408f, 0.143739164f, 0.0561922118f,
+    0.17234154f, 0.199302122f, 0.167830512f, 0.115943685f, -0.0923248678f, 0.0231668577f,
+    0.273004651f, 0.110312775f, 0.404960364f, 0.0969398841f, -0.0270228814f, -0.0996709913f,
+    0.154936865f, -0.259393036f, 0.156962663f, -0.000518967398f, 0.156739071f, 0.156369269f,
+    0.0339597724f, 0.0541131347f, 0.0641704798f, 0.129480198f
+  },
+  {
+    0.598280966f, -0.752325654f, -0.60321182f, 0.00999992061f, 0.0163884312f, 0.0894253626f,
+    0.216911197f, -1.30661201f, 1.84319925f, -0.513541281f, 0.290022492f, 0.305443376f,
+    -0.334345728f, -1.25256324f, 0.129387483f, 0.0722776204f, -0.0314771682f, 0.135819003f,
+    0.478763044f, 0.268806934f, 0.948483646f, -0.0663451925f, 0.0255061872f, -0.134155229f,
+    -0.422498554f, -0.748692453f, -0.818392873f, -0.064599067f, 0.0342204161f, -0.118746042f,
+    0.0095852362f, -0.0498459265f, -1.2482996f, -0.282874912f, 0.336179763f, 1.03864825f,
+    -0.491588533f, 0.826413274f, -0.96781981f, -0.857178569f, -0.532666981f, -0.799751043f,
+    -0.451670587f, 0.0185233429f, 0.00674162479f, -0.0490814373f
+  },
+  {
+    -0.40295285f, -0.765075862f, -0.87798214f, 0.165662676f, 0.107308805f, 0.253410578f,
+    -0.27298978f, -1.48273158f, -0.692484677f, 0.073389329f, 0.0742061436f, -0.335233837f,
+    -0.688795388f, -1.1513418f, -0.57423377f, 0.0389576182f, 0.0530807935f, 0.025289692f,
+    0.342487544f, -0.515262663f, 0.548916459f, -0.0485710092f, -0.0437938832f, -0.0041762162f,
+    -0.40590468f, -0.384755224f, -0.553820848f, -0.0639392436f, -0.0648636445f, -0.039943561f,
+    -0.406406611f, -0.0929734036f, -1.14899635f, -1.19579268f, -0.850309491f, 0.0089126993f,
+    -0.146865398f, 0.646801293f, -0.545750022f, -0.431820214f, -0.215349287f, 0.233065069f,
+    -0.398640662f, 0.0100998404f, 0.0194049869f, 0.0156352874f
+  },
+  {
+    0.118735f, -0.184151277f, -0.0290673673f, -0.0653319657f, 0.0958710089f, 0.00288236444f,
+    -0.540455282f, -0.259987652f, 0.37699005f, 0.32079798f, -0.0818459466f, 0.913085043f,
+    -0.232054353f, -0.41132623f, -0.138228416f, -0.0498878025f, -0.058335036f, 0.0867902562f,
+    0.098451905f, -0.332852364f, 0.160011888f, 0.115951747f, -0.132342994f, 0.102669932f,
+    -0.149190813f, -0.121542968f, -0.0903726742f, -0.125141189f, 0.0456635356f, 0.0635224655f,
+    -0.258131087f, -0.296944052f, -0.478689402f, -0.233897895f, -0.128655389f, -0.0605626144f,
+    0.0508295111f, 0.1934174f, -0.18220216f, -0.0718995705f, -0.304283977f, 0.00605818536f,
+    -0.189167306f, 0.133239731f, -0.057880424f, 0.109793261f
+  },
+  {
+    0.105515301f, -0.0908989087f, 0.151799589f, -0.01656425f, -0.0598850101f, 0.123781003f,
+    -0.0165320095f, -0.223197207f, -0.148380712f, -0.00336126611f, 0.11868526f, 0.0339033641f,
+    0.0336605087f, -0.0521922484f, 0.182254612f, -0.00397457974f, 0.0389112234f, 0.00401921617f,
+    0.097493872f, 0.0423321649f, -0.0204849355f, -0.0664756969f, 0.0793421194f, -0.200781986f,
+    0.0785025358f, 0.0533508882f, 0.192684874f, 0.182816282f, 0.174250275f, 0.170592636f,
+    -0.0998492092f, -0.105148561f, -0.0766395554f, -0.200311422f, 0.157750055f, 0.0342906713f,
+    0.185155287f, -0.0260476228f, 0.0928331614f, -0.025614839f, -0.0897660181f, -0.0861988738f,
+    0.134956837f, -0.0444689654f, -0.0494703166f, -0.0417978317f
+  },
+  {
+    -0.0895392671f, -0.108721577f, -0.088687703f, -0.0414306857f, -0.100551248f, 0.160330489f,
+    -0.00880928803f, -0.0882434994f, 0.172909677f, -0.130495116f, -0.0196456835f, 0.243884996f,
+    0.16675052f, 0.207609206f, 0.135868907f, -0.094663091f, 0.154632449f, 0.0663117692f,
+    -0.12106657f, -0.0473627225f, -0.0780898854f, 0.10349521f, 0.0868498459f, 0.0550344177f,
+    0.172831848f, 0.0499989726f, 0.181008935f, 0.0865319818f, 0.191674829f, 0.0690516531f,
+    0.15205586f, -0.0200844835f, -0.0313237235f, 0.0423491597f, 0.112524949f, 0.0541199073f,
+    0.186076343f, -0.125528157f, -0.00821876526f, 0.0573690236f, -0.076984413f, 0.0370403603f,
+    -0.0807955489f, 0.0892987475f, -0.041697707f, -0.0253763292f
+  },
+  {
+    -0.0180992223f, -0.00646548066f, -0.00379392412f, 0.00166312268f, 0.214220628f, 0.0631192029f,
+    -0.136458427f, -0.22902678f, -0.513684034f, -0.343443573f, 0.196403384f, -0.333878607f,
+    -0.315980852f, -0.467280388f, -0.329173177f, -0.200702652f, -0.0689136684f, 0.0618208311f,
+    -0.00743739493f, -0.315539092f, -0.0723068565f, -0.117627315f, 0.064436242f, -0.047694128f,
+    -0.375677615f, -0.0673536584f, -0.00728253694f, 0.0653743148f, 0.0464822203f, -0.0284058489f,
+    -0.247596204f, 0.109753057f, -0.388080865f, -0.297583729f, -0.377685308f, -0.185467795f,
+    0.0101684351f, 0.124895521f, -0.248475432f, -0.130383059f, -0.340348065f, 0.211428732f,
+    -0.296903044f, 0.0836396664f, 0.0346610472f, -0.142649293f
+  },
+  {
+    -0.0592919365f, 0.0479649976f, 0.14333728f, -0.00816768873f, 0.189756915f, -0.00692868093f,
+    0.0867404789f, -0.104096577f, -0.163898081f, 0.101057075f, -0.0237256847f, 0.0692594945f,
+    -0.0392067432f, -0.061871551f, -0.0814610496f, 0.0976701453f, 0.123991489f, 0.0653822049f,
+    -0.131857589f, -0.0994721949f, -0.179282814f, -0.10617926f, -0.0783948228f, -0.201994151f,
+    0.00774170738f, 0.098115094f, -0.109427057f, 0.0794136152f, 0.195170984f, 0.135494843f,
+    0.121029273f, -0.0549654774f, -0.168618619f, -0.141939625f, 0.0648971349f, 0.106382243f,
+    0.0792964026f, 0.032023903f, -0.0359644443f, 0.0948876441f, 0.109329216f, -0.0589525215f,
+    0.00342467264f, 0.133785173f, 0.10907796f, -0.0423868224f
+  },
+  {
+    0.0397491828f, -0.134512037f, 0.0752761811f, -0.121804878f, 0.0161754563f, 0.00175435538f,
+    0.0560839698f, -0.07493411f, -0.020070985f, -0.100306965f, 0.0541040264f, 0.134919852f,
+    -0.0199725945f, 0.0161724035f, 0.0772080198f, -0.210692361f, -0.0822333321f, 0.0104401009f,
+    0.0869467705f, 0.0891077593f, -0.039307259f, -0.0522446297f, 0.0472757593f, 0.088828437f,
+    -0.196962655f, 0.0187819917f, 0.101045862f, -0.203613251f, 0.0924056694f, -0.0565674491f,
+    -0.158108354f, -0.0137559325f, -0.177264079f, -0.0832048133f, -0.131826088f, 0.0819048807f,
+    -0.11822062f, -0.0569262244f, -0.146536276f, -0.14522323f, -0.0294290837f, -0.0902633816f,
+    -0.181738004f, 0.059872102f, -0.131620884f, 0.10359066f
+  },
+  {
+    -0.0469392054f, -0.323161393f, 0.0852478817f, 0.137509868f, 0.0395596363f, 0.0512884371f,
+    0.301511824f, -0.182520986f, -0.380675018f, 0.0218090471f, 0.350436568f, -0.254789829f,
+    -0.0886958018f, -0.342559576f, -0.233709559f, -0.0765330419f, -0.0111490907f, 0.018504627f,
+    0.245963246f, -0.0854691863f, -0.0294548124f, -0.090549767f, 0.0737514198f, -0.068157658f,
+    -0.191499829f, -0.284912646f, -0.0529679842f, 0.080466032f, -0.172192618f, -0.106107377f,
+    -0.0869948715f, 0.133439064f, -0.345287561f, -0.306145877f, -0.309322536f, -0.0880857632f,
+    -0.00817592815f, 0.231599689f, -0.0371222086f, -0.136649102f, -0.0588313229f, -0.0659925416f,
+    -0.180239856f, -0.188425586f, 0.012518758f, -0.0708127692f
+  },
+  {
+    0.0638911873f, 0.336344182f, 0.31120494f, -0.251424223f, -0.0966736004f, -0.341435611f,
+    -0.513026357f, 0.649892807f, 0.720665991f, 0.165062323f, 0.218819425f, -0.0596434809f,
+    0.202325493f, 0.809268713f, 0.817576945f, 0.0616528243f, 0.0302248206f, 0.0149948876f,
+    -0.324925929f, 0.398970872f, -0.0640718117f, -0.121306874f, 0.00238764053f, 0.00977660995f,
+    0.401207834f, 0.181756556f, 0.337542892f, -0.13564685f, 0.0437023863f, 0.0658457428f,
+    0.00657430012f, 0.0104630878f, 0.851601064f, 0.843166828f, 0.605546296f, 0.417522311f,
+    0.115534239f, -0.369655162f, 0.498265743f, 0.0954735503f, 0.246952027f, 0.0241663773f,
+    0.192558616f, 0.0536128953f, -0.0105542587f, -0.0448817685f
+  },
+  {
+    0.188543648f, 0.107508093f, 0.128993362f, -0.0342462324f, -0.0283709764f, -0.0661836937f,
+    -0.07473021f, 0.448735267f, 0.295183897f, 0.60623312f, -0.143789232f, 0.326645344f,
+    -0.00531838089f, 0.517682612f, 0.583221078f, -0.00570918014f, -0.00131626357f, 0.109214917f,
+    -0.0774695128f, 0.049443122f, -0.251523167f, 0.0851099566f, -0.137900218f, -0.116261467f,
+    0.179777458f, 0.117908478f, 0.319568694f, -0.0969231278f, 0.0663551465f, 0.147484779f,
+    -0.0473447554f, -0.147858351f, 0.368228287f, 0.29186669f, 0.396435201f, -0.0980375335f,
+    0.0258488506f, -0.271998942f, 0.334601998f, 0.329638988f, 0.0470927916f, 0.182674989f,
+    0.315146476f, 0.131570101f, 0.101835862f, -0.0848467574f
+  },
+  {
+    -0.0612150654f, -0.14332898f, -0.253946841f, 0.124719106f, 0.00197829213f, 0.134770259f,
+    0.038797766f, -0.288145155f, -0.356732756f, -0.525405347f, 0.114682667f, -0.00654951297f,
+    -0.225512236f, -0.34147644f, -0.390743136f, -0.0726699382f, -0.0176415313f, -0.0294095632f,
+    0.0615408346f, -0.188659355f, 0.128195837f, -0.0590604283f, 0.0879409537f, 0.0115781203f,
+    -0.0181298461f, -0.00364415837f, -0.480861396f, 0.0673972964f, -0.184435695f, 0.042606432f,
+    -0.249457568f, -0.0129688f, -0.440847993f, -0.356981814f, -0.472527027f, 0.134945467f,
+    0.0224911999f, 0.314300895f, -0.119622692f, -0.0904521272f, -0.15392381f, -0.25505811f,
+    -0.313063443f, 0.017519163f, -0.145293459f, 0.0265729669f
+  },
+  {
+    0.0798334405f, 0.0496120304f, 0.0135076307f, -0.139351621f, -0.0901422426f, 0.0564155169f,
+    -0.0231798477f, 0.0785617232f, 0.063340053f, 0.00665800925f, 0.0166827347f, 0.0397356935f,
+    -0.0265917741f, 0.117363505f, 0.0859779492f, 0.00228971243f, -0.112103537f, -0.0429160111f,
+    -0.158927158f, 0.0223749056f, 0.151274458f, 0.143241286f, -0.00910666492f, 0.0874763653f,
+    0.00755945919f, 0.0775778517f, -0.0703630745f, -0.188819543f, 0.0265977178f, -0.112219617f,
+    -0.0326548144f, 0.0499680936f, 0.233303249f, 0.145348474f, -0.0311185922f, -0.0666495711f,
+    -0.144834653f, -0.0731336996f, -0.00338014704f, -0.113031216f, -0.101840824f, 0.0640272126f,
+    0.0211513471f, -0.0398586541f, 0.0530843288f, 0.0889246613f
+  },
+  {
+    -0.12969099f, -0.0947116166f, 0.0939639285f, 0.0766013116f, -0.114521831f, 0.0356611274f,
+    -0.1090298f, 0.0581268817f, 0.0957730189f, 0.198206291f, 0.0879727602f, 0.160832077f,
+    -0.0750496238f, 0.0662766472f, -0.188645899f, -0.187705457f, -0.0779600814f, -0.00328261894f,
+    -0.0512064397f, -0.096972771f, 0.0828043818f, 0.115115613f, -0.0234935302f, -0.0570457131f,
+    -0.212206274f, -0.159740224f, -0.153307319f, -0.187112227f, -0.0396991707f, -0.180411488f,
+    -0.149068847f, 0.135233641f, 0.208674163f, 0.205500633f, 0.0788586438f, 0.148776129f,
+    0.0706268176f, -0.177368984f, 0.042932868f, 0.0287484713f, 0.0848747641f, 0.0849469304f,
+    -0.197554201f, -0.0451337397f, -0.127656028f, -0.108423784f
+  },
+  {
+    -0.167988017f, 0.104712188f, -0.0337028541f, 0.00893972721f, -0.104893744f, 0.0409767106f,
+    -0.0611945838f, 0.149457365f, 0.200809032f, 0.0283891577f, -0.214015722f, 0.171625584f,
+    -0.0294861626f, 0.163839474f, -0.00381632033f, 0.0568272434f, -0.171325907f, 0.0878690258f,
+    0.0408605225f, 0.0730251223f, 0.0705378652f, 0.191398382f, 0.0552990064f, -0.0813796967f,
+    -0.00134051405f, 0.110179015f, -0.0969133973f, 0.00284020533f, -0.0382998399f, -0.014720832f,
+    -0.165307209f, -0.0195242558f, 0.197915331f, -0.0118971774f, 0.120388992f, 0.0551487841f,
+    -0.147377729f, -0.238855585f, 0.0503049195f, -0.0549612641f, -0.0723443776f, 0.10884773f,
+    0.0456514731f, -0.191233456f, -0.121725686f, 0.0805481672f
+  },
+  {
+    0.324956328f, -0.0519389473f, 0.032071732f, -0.00384738948f, 0.0921868458f, 0.112324126f,
+    0.518002212f, -0.12384218f, -0.327502012f, -0.538004696f, 0.0889299884f, -0.421257198f,
+    0.0616731644f, -0.500850737f, -0.288868248f, -0.186823487f, 0.0721225217f, -0.16325815f,
+    0.280139029f, -0.228960827f, 0.11120595f, -0.0990723372f, 0.0847156271f, -0.191379443f,
+    -0.144807026f, -0.17744872f, -0.111452371f, 0.0430268198f, 0.0816774517f, -0.041698318f,
+    0.143103123f, 0.0277051646f, -0.156214908f, -0.126967192f, -0.41159752f, -0.0133201787f,
+    -0.0497272722f, 0.0685447976f, -0.0948171988f, -0.150181592f, -0.168862417f, 0.0463819131f,
+    -0.346710891f, 0.0779505447f, -0.106970772f, 0.0978133976f
+  },
+  {
+    -0.0456111468f, -0.11720112f, -0.116911769f, 0.00178739685f, -0.123848781f, 0.0403995626f,
+    -0.0777285397f, -0.0508193932f, -0.0301690679f, -0.0516231284f, -0.124671221f, 0.0724923685f,
+    -0.0630844906f, -0.199681729f, -0.0982853994f, 0.0286944229f, 0.0567734726f, 0.0928604826f,
+    -0.0923558176f, 0.0148544172f, 0.181472361f, 0.164187714f, 0.206631705f, -0.0164695717f,
+    -0.0691554099f, -0.167655542f, 0.0575101115f, -0.170707181f, -0.201639608f, 0.0543885343f,
+    -0.0397346057f, 0.0779285356f, -0.204007506f, 0.021133678f, -0.154097855f, 0.198672354f,
+    -0.114525497f, 0.0106150247f, -0.020010706f, -0.186306924f, 0.00645840587f, 0.0319110788f,
+    0.019349141f, -0.175456569f, 0.0750806257f, 0.0126348147f
+  },
+  {
+    -0.142209604f, 0.032972943f, 0.0709317923f, -0.180375233f, -0.14014031f, -0.23117213f,
+    0.0976647362f, 0.214835256f, 0.0750348419f, 0.0792886019f, -0.00537055172f, 0.0188297797f,
+    -0.246323138f, -0.0606078058f, -0.0350627527f, -0.0719151869f, 0.0164883342f, -0.147862881f,
+    0.113184668f, 0.0692814365f, -0.0584676526f, 0.0901830643f, 0.093340531f, 0.0190789495f,
+    -0.208477885f, -0.030767018f, -0.0303695537f, -0.164875507f, 0.0307152849f, -0.0916273072f,
+    0.00244462746f, 0.182244748f, -0.0413407795f, 0.200897545f, -0.124600105f, 0.124767952f,
+    -0.182089075f, -0.0770355836f, 0.0570398979f, 0.00531172473f, -0.222060651f, 0.0651651397f,
+    -0.10307581f, -0.222617254f, -0.240161315f, -0.154650524f
+  },
+  {
+    0.133209005f, 0.0543595999f, 0.134585708f, 0.174357533f, 0.129916966f, 0.172085166f,
+    -0.255220115f, 0.0629686862f, -0.0323678404f, -0.245078549f, -0.0224934481f, 0.0224159323f,
+    0.0471382514f, -0.0731800199f, 0.0915401205f, -0.00285522407f, -0.0984237641f, 0.112191729f,
+    -0.120244406f, 0.0466406532f, 0.042162329f, -0.197910413f, -0.0918514505f, 0.0781963095f,
+    -0.00375995785f, -0.0316140205f, -0.104784317f, 0.014543172f, 0.0649614111f, 0.150865108f,
+    -0.0811000615f, -0.0307840966f, -0.0258598253f, -0.167844385f, 0.159366474f, 0.0724773407f,
+    -0.110838667f, -0.0400871299f, 0.0532339811f, -0.0452643894f, -0.0456794687f, -0.0610764399f,
+    0.0213102289f, 0.0101729343f, 0.0836050957f, 0.189672723f
+  },
+  {
+    -0.083696045f, 0.0352861434f, 0.107608631f, -0.103454009f, -0.0162551347f, 0.0316812471f,
+    0.0720407739f, -0.15535979f, -0.0495368987f, 0.179132625f, 0.120389864f, -0.0745058954f,
+    0.0488308407f, -0.134627268f, 0.0767153278f, -0.0172657873f, 0.040419396f, -0.0937707052f,
+    -0.00158405583f, 0.100543514f, 0.0611394681f, -0.100512423f, 0.0135840327f, 0.157873198f,
+    -0.125608534f, -0.194558516f, 0.0810374618f, -0.00127364637f, -0.0137363793f, -0.111364298f,
+    -0.0113862073f, 0.0946944878f, 0.0251385644f, 0.0960627347f, -0.00393342786f, 0.139584884f,
+    -0.0811617151f, -0.0436545648f, -0.0783460811f, -0.0516710132f, -0.068905957f, 0.06173186f,
+    -0.0664936453f, -0.112471402f, -0.0979899392f, 0.0014168286f
+  },
+  {
+    -0.0419540331f, 0.0365838856f, 0.0160817597f, 0.00608813763f, 0.0302300155f, -0.138057053f,
+    0.417751968f, -0.103312686f, -0.102645546f, -0.0709320977f, 0.14259246f, 0.036860507f,
+    -0.179113731f, -0.265505731f, -0.27722013f, -0.0286009274f, -0.168027088f, -0.132465497f,
+    0.209611401f, -0.122197933f, -0.018164983f, 0.0509297475f, -0.0728238896f, -0.105163328f,
+    -0.0893671587f, -0.069787778f, -0.265813589f, 0.138591379f, -0.0900694579f, -0.186963618f,
+    -0.0369279794f, 0.0398010574f, -0.357063413f, -0.0167954247f, -0.229339808f, 0.122628778f,
+    0.0350493155f, 0.151626661f, 0.0206418224f, -0.159660369f, -0.032534048f, 0.0438075848f,
+    -0.0640466884f, -0.0297987964f, -0.042575758f, -0.0221478101f
+  },
+  {
+    -0.133250728f, -0.0246449523f, 0.726434171f, -0.0701633394f, -0.0148542076f, -0.417206287f,
+    0.843234539f, 1.37576556f, 0.493910015f, 0.978999853f, 0.729614079f, -0.342652947f,
+    0.412143588f, 0.636938334f, 0.464634538f, 0.072698392f, 0.291096777f, -0.161553398f,
+    -0.0411513597f, 0.328561872f, 0.214087978f, 0.212184832f, 0.151537821f, -0.133296818f,
+    0.281033039f, 0.00123890734f, 0.176345572f, 0.0140218185f, -0.128221065f, 0.0682574287f,
+    0.290397942f, 0.372934431f, 0.768839836f, 0.854907393f, 0.449259967f, 0.320219249f,
+    0.086112f, -0.921072066f, 0.244336575f, 0.194513425f, 0.241075441f, -0.206809372f,
+    -0.0300776847f, 0.0318523422f, -0.0419881903f, 0.0111308899f
+  },
+  {
+    -0.0816580951f, -0.117369525f, -0.0667564943f, -0.145463571f, 0.0663335174f, -0.00122533203f,
+    0.0546360277f, 0.0972275808f, 0.102060623f, 0.128489882f, 0.0848452151f, 0.0146277063f,
+    -0.0262799915f, 0.0190536119f, -0.119340926f, -0.0825926438f, -0.196542621f, -0.209494665f,
+    -0.0858881548f, 0.121744968f, -0.00987381302f, 0.162942052f, 0.126989469f, 0.119618922f,
+    -0.106076822f, -0.137763172f, -0.0561338365f, -0.226200342f, -0.14856112f, 0.0322073884f,
+    -0.0752052441f, 0.0465755537f, -0.108927973f, 0.112852618f, 0.0531622581f, 0.101270027f,
+    0.00315019372f, 0.0353728756f, -0.0164417047f, 0.0325216874f, 0.0962137729f, -0.015605473f,
+    -0.00653210795f, -0.202943146f, 0.0351127386f, 0.0491218716f
+  },
+  {
+    0.225397974f, 0.596103013f, 0.145842105f, -0.185841426f, -0.22686258f, -0.203670412f,
+    -0.489242285f, 0.702767372f, -1.13032281f, -0.943707883f, 0.0244368762f, 1.32150245f,
+    0.669617474f, 1.07438338f, -0.463393301f, -0.148749322f, -0.107365489f, 0.0867845044f,
+    -0.327307105f, 0.620038807f, -0.874924183f, -0.199720919f, 0.05920377f, 0.18943958f,
+    0.3478899f, -0.0477662869f, 0.476450473f, -0.0558305345f, 0.0525407232f, 0.0568314567f,
+    -0.156755924f, -0.126129046f, 0.969276965f, 0.545994282f, -0.394271493f, -0.40082106f,
+    0.192540318f, -0.432363391f, 0.441745579f, 0.088115938f, 0.29268083f, -0.176684543f,
+    0.572751999f, -0.0468700863f, 0.0771220699f, 0.0854990929f
+  },
+  {
+    0.0387511104f, -0.272363991f, 0.0325090922f, 0.251001865f, 0.184998959f, 0.144379526f,
+    -0.176453352f, -0.418703139f, 0.0714645609f, 0.211322799f, 0.162945315f, 0.186427489f,
+    -0.610432446f, -0.548155725f, -0.315502852f, -0.123122275f, 0.0497680865f, -0.0370693952f,
+    0.179087907f, -0.36359024f, 0.399173975f, 0.108899415f, -0.066164881f, 0.00821113959f,
+    -0.346404552f, -0.186013445f, -0.245373353f, 0.0587134548f, 0.0767951608f, -0.011825311f,
+    -0.457750738f, -0.250036925f, -0.551906765f, -0.301229715f, -0.0448586829f, 0.112765938f,
+    -0.267957538f, 0.444149464f, -0.126110345f, -0.282673329f, -0.45199886f, -0.174915224f,
+    -0.358532995f, -0.0834765658f, -0.112594426f, -0.191790715f
+  },
+  {
+    0.107022777f, 0.0389345251f, 0.0859364569f, 0.0100606615f, -0.180275798f, 0.218570694f,
+    -0.038123183f, -0.0140193412f, -0.0735181943f, 0.155049503f, -0.17467317f, 0.239960939f,
+    -0.089044176f, -0.0371033885f, 0.00175533968f, -0.134336606f, -0.0578624345f, -0.0325530767f,
+    -0.080925338f, 0.0800609216f, 0.16100511f, 0.0206429604f, 0.139206856f, 0.0920319781f,
+    -0.125919074f, 0.090762943f, -0.13581787f, -0.163213521f, -0.103547856f, 0.0696810409f,
+    -0.203087971f, -0.14990972f, -0.0317155831f, -0.161859661f, -0.0285392795f, 0.174899369f,
+    0.0915619656f, 0.10849873f, 0.00541759795f, -0.174174711f, -0.147639111f, -0.027237054f,
+    -0.101792902f, -0.0113075152f, -0.0294372942f, -0.0707907677f
+  },
+  {
+    -0.20655638f, 0.0284249429f, -0.124547809f, -0.0254563149f, 0.0386720933f, -0.00942648295f,
+    -0.0279254075f, 0.0469195172f, 0.0196058806f, 0.197353333f, -0.201002419f, 0.00983275473f,
+    -0.0247759111f, 0.0791560635f, -0.0932688564f, -0.0570740588f, -0.16778709f, 0.0730000436f,
+    0.155038908f, 0.154008448f, 0.125014991f, 0.109241821f, 0.148668185f, 0.122846842f,
+    -0.117471553f, -0.0507105328f, -0.0813900456f, 0.0335952193f, -0.171653286f, -0.2171987f,
+    -0.198060796f, -0.0662125722f, -0.0125721879f, 0.155513391f, 0.0878604874f, -0.072360374f,
+    0.00985707995f, -0.0342081301f, 0.0187513232f, -0.127452791f, -0.120360568f, -0.12451221f,
+    -0.0240531322f, -0.131149828f, -0.0630630925f, -0.100390635f
+  },
+  {
+    -0.0169729237f, 0.0632394999f, 0.00367511017f, -0.0361075029f, -0.0197632294f, -0.00844990462f,
+    0.029375622f, -0.0624559708f, 0.141792908f, 0.0825411007f, 0.0353580788f, -0.0186415408f,
+    -0.0468683504f, 0.162110642f, 0.145810723f, 0.0461687297f, 0.0817497969f, -0.0485363491f,
+    0.0727206469f, 0.0678064078f, -0.0182603803f, -0.149791628f, -0.112084277f, -0.0588827133f,
+    -0.0449453779f, 0.0828570649f, -0.0235049538f, 0.0320503153f, 0.152793944f, 0.192182884f,
+    -0.0428839177f, -0.0227740761f, 0.149235874f, -0.0242675506f, 0.160708517f, -0.144759074f,
+    0.104372345f, -0.0275603961f, 0.184696883f, 0.0490340814f, -0.0701389313f, -0.0688045174f,
+    -0.0706735849f, 0.160104156f, -0.0514796302f, -0.0543544814f
+  },
+  {
+    0.00388738257f, 0.193155006f, 0.0352344252f, 0.207110718f, 0.199228272f, -0.0454620309f,
+    -0.0334984735f, -0.00484005548f, 0.0130147813f, 0.0923233256f, -0.0487680025f, 0.00834421534f,
+    -0.0448084138f, 0.191637427f, 0.0697312281f, 0.153268456f, 0.0149741443f, -0.0511876941f,
+    -0.0845857114f, -0.0607207231f, -0.0603627339f, -0.203576475f, 0.0770705417f, -0.141072646f,
+    0.0450216942f, 0.0558444895f, -0.060034968f, 0.0139406156f, 0.156343207f, 0.0574130267f,
+    0.126090869f, -0.185846567f, 0.204720423f, -0.0643668696f, -0.0921125188f, -0.11211434f,
+    0.0167630687f, 0.210240602f, 0.141483516f, 0.0221775658f, 0.049985826f, 0.0666387901f,
+    -0.058826156f, -0.0575468093f, 0.111859694f, 0.169065356f
+  },
+  {
+    0.156711251f, 0.113281585f, -0.131752148f, 0.0905286521f, 0.163621694f, -0.0580960102f,
+    0.0835110173f, 0.0675200447f, 0.0685624704f, -0.00349345733f, 0.0485899374f, 0.030583119f,
+    0.0791906267f, 0.0373964906f, -0.0491453633f, 0.0576240942f, 0.0576363653f, 0.0878595859f,
+    0.0925457776f, 0.0616556592f, -0.10367649f, -0.221244797f, -0.202064678f, -0.188775286f,
+    0.0685701892f, -0.140956059f, -0.0117139779f, 0.0379914716f, 0.132161021f, 0.141774252f,
+    -0.13213785f, 0.0701073781f, 0.0262615196f, 0.100958295f, 0.0823348686f, -0.136477098f,
+    -0.0692476556f, 0.165527955f, 0.114764608f, 0.0373475775f, 0.0815597549f, 0.0918704569f,
+    0.108433656f, 0.194968432f, 0.0294485372f, 0.160528824f
+  },
+  {
+    -0.240437269f, -0.0752005205f, -0.215147719f, -0.116644301f, -0.225266621f, -0.10828872f,
+    0.0650676265f, 0.107233703f, -0.150849149f, 0.169018254f, -0.0770433471f, -0.17224656f,
+    -0.0653652027f, 0.0210789647f, -0.112236604f, -0.172977686f, -0.0124491015f, -0.0887570605f,
+    0.0370497257f, 0.0658534914f, 0.11040654f, 0.201615825f, 0.262398958f, -0.0185215864f,
+    0.0209469181f, -0.0350415707f, -0.212085292f, -0.229435816f, 0.0276881829f, 0.0145916259f,
+    0.0199941751f, 0.153254718f, -0.113063544f, -0.0167096592f, -0.0733322129f, 0.240625709f,
+    -0.134892851f, -0.207345247f, 0.0418795794f, -0.00164688926f, -0.0354622528f, -0.0450053141f,
+    -0.0049670469f, -0.0351989828f, -0.0295295864f, -0.173194245f
+  },
+  {
+    -0.170731962f, -0.106848925f, -0.0888675079f, 0.0989722386f, -0.159889668f, -0.204375312f,
+    0.0528439321f, -0.148935691f, -0.235564277f, -0.0291332807f, 0.267298937f, -0.202001154f,
+    -0.151493832f, -0.167124659f, -0.467435896f, 0.0702603981f, -0.029494781f, 0.045674935f,
+    0.174780101f, -0.129505858f, -0.0620590858f, -0.007802248f, -0.0761732161f, 0.180684298f,
+    -0.256341994f, -0.0407333337f, -0.269718885f, 0.130461752f, -0.128162622f, -0.193502396f,
+    -0.0190636739f, 0.215356424f, -0.477732152f, -0.0503354482f, -0.124511562f, -0.091172941f,
+    0.0826546773f, 0.168261319f, -0.233818561f, -0.188036948f, -0.0684784502f, -0.1701691f,
+    -0.0687780306f, -0.112030074f, -0.0784183145f, -0.120360814f
+  },
+  {
+    0.00567400362f, 0.103289254f, 0.234945625f, -0.163698748f, -0.307974964f, -0.170424089f,
+    0.0818349272f, 0.554252744f, -0.458115131f, -0.467389613f, -0.11635346f, -0.726259708f,
+    0.347225398f, 0.799480319f, 0.167554647f, -0.104934104f, 0.0380941816f, -0.146993935f,
+    -0.165497392f, 0.563021541f, -0.357653916f, -0.151121348f, 0.112849899f, -0.167998135f,
+    0.27451095f, -0.137477934f, 0.329612136f, -0.076025784f, 0.00392751442f, -0.00887952186f,
+    0.00327903708f, 0.221595883f, 0.610953987f, 0.631486833f, -0.242248535f, -0.147192582f,
+    -0.148401439f, -0.17267251f, 0.364977151f, -0.00864462741f, 0.316584438f, -0.423897624f,
+    0.119106993f, 0.107409082f, 0.14861837f, -0.0485492423f
+  },
+  {
+    -0.0148266871f, -0.154153928f, 0.0449413471f, -0.115844972f, -0.105334915f, -0.0914218128f,
+    0.0553136803f, -0.0889177099f, -0.124637663f, -0.0846418813f, -0.115679771f, -0.199505806f,
+    -0.00484982412f, -0.0808716044f, -0.118220747f, 0.0751500577f, -0.0125926398f, -0.0259895325f,
+    0.00385041162f, -0.0787674785f, 0.184741929f, -0.0356931128f, 0.0300200861f, 0.135954738f,
+    0.00166369451f, -0.148516312f, -0.191573322f, -0.189282313f, -0.195772767f, -0.055726897f,
+    -0.130581558f, 0.0988869295f, -0.215539902f, 0.190835252f, -0.0780518427f, 0.101345398f,
+    -0.00922178011f, -0.103203766f, -0.0322637074f, -0.0308553465f, 0.0798499733f, -0.101198018f,
+    0.0296201669f, 0.0805706531f, -0.0298538543f, -0.1178279f
+  },
+  {
+    -0.118041702f, 0.0553952567f, -0.0845489651f, 0.0243055411f, 0.0170283783f, 0.0358136222f,
+    -0.106160864f, 0.167438477f, 0.0359619446f, -0.137324333f, -0.131270811f, 0.127216041f,
+    0.0167786181f, -0.0573359206f, -0.103845067f, -0.188713834f, -0.117173903f, -0.236234233f,
+    -0.0685463846f, -0.0113802729f, 0.147555605f, 0.0876501352f, 0.030543372f, 0.0437661931f,
+    -0.116633616f, -0.227378204f, 0.00645373808f, -0.209330767f, -0.024544986f, -0.129408613f,
+    -0.215549409f, 0.0343205146f, -0.00532346219f, 0.18292065f, -0.0787393525f, 0.151026651f,
+    -0.102092646f, 0.0394430272f, -0.068705447f, 0.00361103029f, 0.0567274541f, -0.209228054f,
+    -0.0605041273f, -0.109054111f, -0.0506814793f, 0.0282063521f
+  },
+  {
+    0.0721466839f, 0.109646425f, 0.0959496647f, 0.153284445f, 0.0266825873f, 0.178235784f,
+    -0.146271497f, -0.0524891093f, 0.0134538738f, -0.108765833f, 0.0582394861f, 0.0595200621f,
+    0.0357230306f, -0.0592488572f, 0.0591094084f, 0.0448704548f, 0.131706238f, -0.0331535712f,
+    0.118384421f, -0.166897371f, -0.0700194314f, -0.212241545f, -0.0138288876f, -0.194358021f,
+    -0.0455341302f, 0.0109044984f, 0.101976208f, 0.175446674f, 0.0127133364f, 0.193018943f,
+    0.112978399f, 0.0773381218f, -0.0185059812f, 0.0646229759f, 0.121032521f, -0.0867561921f,
+    0.066454947f, -0.0959961489f, -0.142445385f, 0.06157225f, -0.127580583f, 0.117532238f,
+    -0.112422392f, 0.151032165f, 0.0645470694f, 0.215615198f
+  },
+  {
+    0.108370237f, 0.566265881f, 0.64657706f, -0.178655624f, 0.0534065701f, -0.190820456f,
+    -0.61698848f, 0.929099441f, -0.253508985f, 0.109798059f, -0.0387896262f, -0.319996864f,
+    0.518155396f, 0.914232135f, 0.31823349f, 0.0707393736f, -0.106944486f, -0.0364041254f,
+    -0.453130037f, 0.542034686f, -0.644428372f, -0.0720896944f, 0.0875705406f, 0.0320195146f,
+    0.708016336f, 0.448137283f, 0.483306199f, -0.0560381226f, 0.0460108928f, 0.0973602608f,
+    0.310231507f, -0.243205607f, 0.737172604f, 1.14072907f, 0.148558691f, -0.37872237f,
+    0.161066025f, -0.659018397f, 0.557599306f, 0.432878643f, 0.635997951f, 0.495229423f,
+    0.312302411f, -0.0172919184f, 0.0533247367f, -0.0379275978f
+  },
+  {
+    -0.103197612f, -0.0634623244f, -0.192897856f, 0.212141514f, 0.126731068f, 0.0272160396f,
+    -0.0350491554f, -0.549172103f, -0.536868513f, -0.271367759f, 0.105594575f, 0.104626149f,
+    -0.103891283f, -0.527064621f, -0.338176042f, -0.0151889548f, -0.126130909f, 0.0535701327f,
+    0.216142818f, -0.0545425825f, 0.375599056f, -0.0837076083f, 0.12287648f, -0.0524389185f,
+    -0.219173446f, -0.120024644f, -0.179481804f, -0.00435577473f, -0.0638723969f, 0.0618672706f,
+    -0.0318882428f, 0.102028832f, -0.582795382f, -0.448195249f, -0.210605323f, -0.0570034012f,
+    -0.0634668842f, 0.322062016f, -0.355734587f, -0.0426340178f, -0.303355992f, -0.0353484303f,
+    -0.493095875f, 0.0100753726f, -0.121401817f, -0.0569969714f
+  },
+  {
+    0.211480394f, 0.43246907f, 0.293153882f, -0.0607543401f, -0.303829253f, -0.163418561f,
+    0.638298035f, 0.794012666f, 0.83762157f, 0.312732369f, -0.0632395893f, -0.0609411411f,
+    0.749385417f, 0.862654388f, 0.982340038f, 0.0705246925f, 0.107740335f, 0.0518052392f,
+    -0.312617987f, 0.4233706f, 0.273457646f, 0.224235103f, 0.045103386f, 0.0260920785f,
+    0.556392312f, 0.111800537f, 0.531992435f, 0.0337709486f, -0.0777326971f, 0.121110514f,
+    0.35748136f, 0.391848445f, 0.819342077f, 0.682020366f, 0.580357134f, 0.455298215f,
+    0.200738937f, -0.58212322f, 0.634314001f, 0.315478325f, 0.500914991f, -0.0404529646f,
+    0.554447591f, -0.073199451f, 0.0766418576f, -0.0510037541f
+  },
+  {
+    -0.0422208793f, 0.460823715f, 0.342997164f, 0.108064935f, 0.06738282f, -0.189280108f,
+    -0.0369358547f, 1.2711885f, -0.384506494f, 0.794096649f, 0.594774723f, 0.0998631269f,
+    0.141103685f, 0.880175769f, 0.293538898f, 0.0809685662f, 0.0665934831f, -0.145568028f,
+    -0.192634746f, -0.309490263f, -0.0854324251f, 0.276123166f, 0.100789919f, -0.183635831f,
+    0.128380209f, 0.330193758f, 0.202513367f, 0.0635153577f, -0.0139986537f, 0.0473610312f,
+    -0.0175859649f, 0.0465435162f, 1.04935586f, 0.231004328f, 0.408543259f, -0.246840507f,
+    0.288543165f, -1.56998527f, 0.396614015f, 0.283322185f, 0.324738085f, 0.462808222f,
+    0.352427334f, -0.140663072f, -0.0369896106f, -0.0939434767f
+  },
+  {
+    -0.0028391087f, 0.0801684335f, -0.070594959f, -0.0968339369f, -0.119394667f, 0.0721072629f,
+    0.0488603562f, 0.214176789f, -0.151979864f, 0.0628291667f, 0.0661691725f, 0.133393794f,
+    -0.0389641263f, 0.191054493f, -0.12203256f, 0.0119936317f, -0.0266799796f, -0.178693607f,
+    0.0520990603f, 0.150752723f, -0.0440547988f, 0.105755068f, 0.0888647288f, 0.105524033f,
+    -0.110503033f, -0.0232200995f, -0.16119884f, -0.217392623f, 0.067888841f, -0.081281729f,
+    0.0660305396f, 0.0375004224f, 0.101264857f, 0.0475289449f, 0.0240914356f, 0.0711046904f,
+    0.0114073008f, -0.230027661f, -0.071796678f, -0.140741646f, 0.121523865f, 0.0960823447f,
+    0.071762383f, -0.184360906f, -0.0216120612f, 0.0311775878f
+  },
+  {
+    -0.0787658319f, 0.0251049995f, 0.120460413f, 0.0365425423f, 0.003372401f, -0.0423626266f,
+    0.170675546f, -0.116383821f, 0.0674331933f, -0.0437239408f, -0.0240795352f, -0.0701702684f,
+    -0.0905533656f, -0.120201997f, -0.000996722723f, 0.169425726f, 0.0636797473f, 0.097949408f,
+    0.0700168833f, -0.139572293f, -0.0456895642f, 0.110397086f, -0.106962807f, -0.140994892f,
+    0.0617869869f, 0.00520506594f, 0.00652364222f, 0.0413639955f, 0.120669477f, 0.102551095f,
+    -0.0788700208f, 0.12078575f, -0.266654789f, 0.0222540274f, 0.116127774f, 0.00325810979f,
+    0.0152349211f, 0.0526015386f, 0.163668558f, 0.140329137f, 0.115240574f, 0.0413234159f,
+    -0.132499725f, 0.015181357f, 0.0769807398f, -0.118574589f
+  },
+  {
+    0.0223582666f, -0.0069585545f, 0.0602150746f, -0.0117303738f, 0.197431162f, 0.159154713f,
+    0.0616587847f, -0.0254242178f, -0.00699704513f, 0.00437047565f, 0.11499729f, -0.0310845412f,
+    -0.0134228645f, 0.189350069f, 0.0146855209f, 0.0556565933f, 0.0451447815f, 0.141134813f,
+    -0.154934391f, -0.153151855f, 0.0841485858f, -0.198768377f, -0.0679746196f, -0.107318893f,
+    0.117299013f, -0.0301501267f, -0.0551419333f, 0.127258837f, 0.105150327f, -0.084694095f,
+    0.00865811016f, -0.15974772f, 0.225413144f, -0.118284315f, 0.0527415872f, -0.200743318f,
+    -0.0776820257f, -0.0693647042f, 0.144339725f, 0.171475992f, 0.219238937f, 0.042955678f,
+    0.0162599999f, 0.133247897f, -0.0841355473f, 0.16968812f
+  },
+  {
+    0.132575646f, 0.00726769725f, 0.0258115027f, 0.231181324f, -0.0870239511f, 0.148533076f,
+    0.175190285f, -0.280035257f, 0.159175321f, -0.14405857f, 0.177358404f, -0.232155949f,
+    0.249982312f, -0.0493270382f, 0.163357809f, 0.156033039f, 0.120077536f, -0.146548569f,
+    0.10926982f, 0.0393060297f, -0.0238037705f, -0.0139813395f, -0.102576099f, -0.117541969f,
+    0.0142039685f, 0.00924564246f, 0.140421525f, 0.119040079f, 0.15190734f, -0.0500522666f,
+    0.143104434f, -0.0521030314f, -0.00794799998f, 0.0357420966f, 0.0279031377f, 0.027154861f,
+    0.166873932f, 0.012438939f, -0.0828446597f, -0.0491678119f, -0.108120978f, -0.100353174f,
+    0.0679189935f, 0.152078256f, 0.0653907284f, -0.0811033472f
+  },
+  {
+    0.0268867612f, 0.00626286818f, 0.120762222f, 0.136161432f, 0.162360087f, 0.00917995255f,
+    0.111242957f, 0.103183322f, 0.130484924f, -0.0590917245f, -0.0864916444f, -0.0687710419f,
+    0.17904596f, 0.0470124893f, 0.191071361f, -0.0740945637f, 0.0439144224f, 0.12666364f,
+    -0.155714482f, -0.0521851517f, -0.138408959f, -0.0478536077f, -0.130615115f, -0.135447353f,
+    -0.0876473263f, 0.115371868f, -0.0358018056f, 0.106860936f, -0.00904611778f, 0.000762772514f,
+    0.186338291f, -0.0529448055f, -0.0713851005f, -0.00140267727f, -0.0799629465f, 2.37249624e-05f,
+    0.166839838f, -0.0868529007f, -0.042641446f, 0.184358284f, 0.175915435f, 0.162111893f,
+    0.0335817151f, 0.169238687f, 0.0907472894f, -0.00277643581f
+  },
+  {
+    -0.01634413f, 0.180094704f, 0.156972095f, -0.00296298135f, -0.0762418285f, 0.078905575f,
+    -0.0808023438f, 0.0945982859f, 0.0226251353f, -0.194128975f, 0.175856084f, 0.0321580954f,
+    0.077153936f, -0.0716362223f, -0.0505686104f, 0.120264024f, 0.0264425129f, 0.208895326f,
+    0.00715186959f, 0.0293311533f, -0.159974113f, -0.106667496f, -0.137458667f, 0.00221750117f,
+    0.161916763f, 0.0324964374f, 0.213002801f, 0.0227580331f, 0.0423936583f, 0.135756865f,
+    0.0510317869f, 0.0497018471f, 0.13261202f, 0.0777326301f, 0.215338007f, -0.109425686f,
+    0.108653449f, 0.17776975f, 0.123706661f, 0.122813374f, 0.156414688f, 0.0338223539f,
+    0.184784219f, 0.101985551f, 0.134568706f, -0.0967078283f
+  },
+  {
+    -0.0288518518f, -0.167936549f, -0.195438012f, 0.0582650006f, -0.0136116119f, -0.161386907f,
+    0.113811426f, -0.0769886076f, 0.0363284387f, 0.141003668f, 0.0583643019f, 0.0793901384f,
+    0.106516935f, 0.00326697715f, -0.0386491977f, -0.0845247209f, -0.181602538f, -0.0628936887f,
+    0.177841067f, -0.0643296763f, 0.196944222f, -0.0917728543f, 0.19184953f, 0.17112571f,
+    -0.0343505889f, -0.0804153904f, -0.0855248794f, 0.115432538f, -0.189856261f, -0.136081904f,
+    0.0254434124f, 0.000914101081f, -0.157927081f, 0.0505342446f, -0.0538510084f, 0.00637448765f,
+    -0.222308069f, -0.0787232891f, -0.12527591f, -0.047548078f, -0.155324876f, -0.0951348543f,
+    -0.196180105f, -0.150015101f, 0.0410890803f, 0.0539668649f
+  },
+  {
+    0.12677072f, 0.173789069f, 0.122441545f, -0.0497960448f, 0.0650690719f, 0.0201169271f,
+    -0.0453108102f, 0.00102570292f, -0.0388533808f, -0.0276698936f, -0.196847543f, 0.147413775f,
+    -0.122988246f, 0.223030716f, 0.0305458587f, 0.128876626f, -0.0301560517f, 0.0260308962f,
+    -0.196656853f, -0.0561402924f, -0.00698348228f, -0.00155326934f, 0.0260002892f, -0.0788302422f,
+    0.000613370968f, -0.0654000714f, 0.175797924f, 0.182361364f, 0.0875765532f, 0.130129308f,
+    -0.163077652f, 0.0227281284f, 0.149056107f, 0.114049479f, -0.18357636f, 0.0260252096f,
+    -0.0114513189f, 0.0213616379f, 0.187969163f, 0.206125423f, 0.0839618891f, -0.0217386f,
+    0.164396659f, 0.0228533149f, -0.0209534373f, 0.167127535f
+  },
+  {
+    -0.0747677237f, -0.199763358f, -0.134420589f, 0.0317298658f, 0.264432877f, 0.126292601f,
+    -0.100206405f, -0.409065962f, 0.840244412f, 0.489563972f, 0.0310387481f, 0.186339781f,
+    -0.380079061f, -0.537099421f, 0.352058083f, 0.173866972f, -0.0459392741f, 0.176798135f,
+    0.242081121f, -0.434149474f, 0.300457478f, 0.0387503505f, -0.0495264344f, 0.234404251f,
+    -0.267420352f, 0.0921865329f, -0.201110601f, -0.037656676f, -0.00191860448f, 0.0664098039f,
+    -0.196824625f, -0.210087135f, -0.612298012f, -0.45879364f, 0.687694311f, 0.0864773989f,
+    -0.0794182196f, 0.365489125f, -0.217006728f, 0.0538172312f, -0.250305891f, 0.275690168f,
+    -0.291366249f, 0.0303847361f, -0.161938339f, -0.0217574555f
+  },
+  {
+    -0.0794844702f, -0.0550195314f, -0.0545491092f, -0.103364229f, -0.144669995f, -0.122242622f,
+    -0.101778418f, -0.283618599f, -0.00140977826f, 0.045153033f, 0.0642285571f, 0.0492059551f,
+    0.012812607f, 0.0104904557f, 0.0558032468f, 0.0429545641f, 0.00168756209f, -0.130178139f,
+    0.136758834f, 0.102710076f, 0.0995856598f, 0.0448907688f, -0.0689449608f, 0.0207483787f,
+    -0.185881183f, 0.0354877003f, 0.121033281f, -0.108677402f, -0.169391066f, 0.0272765364f,
+    -0.0925229341f, -0.193121299f, -0.179417044f, -0.0562158339f, -0.116447195f, -0.10462416f,
+    -0.00647191983f, 0.211290926f, -0.00162121817f, -0.0460055731f, 0.0503120944f, 0.0914717168f,
+    -0.0962435901f, -0.1469329f, -0.176087588f, -0.05148701f
+  },
+  {
+    0.175561622f, 0.015109146f, 0.418859482f, 0.00981119368f, -0.166639075f, -0.147548363f,
+    -0.322888881f, 0.50016427f, 0.0555529408f, -0.119339712f, 0.00322240242f, 0.471888393f,
+    0.211263657f, 0.614936233f, 0.523110747f, 0.0249539539f, 0.114758007f, 0.0749003515f,
+    -0.259902388f, 0.417570472f, -0.0975159407f, 0.124726094f, -0.138367832f, -0.0430244021f,
+    -0.00926258788f, 0.139341652f, 0.263289481f, 0.0287610535f, 0.00738760503f, 0.022008691f,
+    0.107843533f, -0.272573382f, 0.446597755f, 0.404832065f, 0.478362173f, -0.0284728054f,
+    0.0513175428f, -0.321812391f, 0.260669827f, 0.194502011f, 0.144153818f, -0.0392034501f,
+    0.188935146f, -0.108501673f, 0.0287613962f, -0.0282824431f
+  },
+  {
+    0.0903731957f, 0.1277273f, -0.00609075511f, 0.0739299133f, 0.148180619f, 0.229523107f,
+    0.0383693725f, -0.176367044f, -0.0794519782f, -0.00692535797f, 0.24682796f, 0.0308027193f,
+    -0.00587007822f, -0.251785964f, 0.0205571912f, 0.0155122122f, 0.0684847906f, 0.123796858f,
+    0.0436528772f, -0.189572886f, -0.00749607896f, -0.113401435f, -0.031668406f, 0.0221417379f,
+    0.167167142f, 0.02481056f, 0.0797583461f, -0.0235848688f, 0.257934928f, 0.0249102507f,
+    0.225911677f, -0.241493344f, -0.151130736f, -0.159554631f, -0.0364540778f, 0.000345411652f,
+    0.0116839819f, 0.0453608222f, -0.119697943f, -0.0652470738f, -0.0714118555f, -0.102218829f,
+    -0.127035826f, 0.157271758f, 0.0399085432f, 0.0652736053f
+  },
+  {
+    -0.0522786453f, -0.658483326f, -0.698647618f, 0.180282652f, 0.332692504f, 0.315623492f,
+    1.22025251f, -0.926589191f, 0.331945568f, 0.0160796121f, 0.37469399f, -0.48516807f,
+    -0.545161247f, -0.998729527f, -0.557097018f, -0.0165672004f, 0.0480473936f, -0.0412625633f,
+    0.527541101f, -0.363212317f, 0.619550288f, 0.0491393134f, -0.025190182f, 0.052979432f,
+    -0.744139016f, -0.153347149f, -0.716832757f, 0.00722585339f, -0.055329524f, 0.00981801469f,
+    -0.0786576569f, -0.00604677992f, -0.825768709f, -0.65261066f, -0.294972807f, 0.188043207f,
+    -0.260419786f, 0.754468024f, -0.684102237f, -0.418309212f, -0.348840326f, 0.270264328f,
+    -0.342199445f, 0.0220274571f, 0.00255809701f, 0.024477208f
+  },
+  {
+    -0.176983342f, 0.0415594615f, 0.402590722f, -0.202873126f, -0.220562533f, -0.31483227f,
+    0.339871883f, 1.05164993f, -1.16689944f, 0.0548115857f, -0.0791368857f, 0.0138573302f,
+    0.464441508f, 1.01188648f, -0.0499952435f, 0.0612748861f, 0.0659536123f, 0.00312297558f,
+    0.17373389f, 0.582942009f, -0.0781152993f, -0.0267056581f, 0.0815101564f, -0.0793326348f,
+    0.170052677f, -0.0971485972f, 0.25377053f, -0.0208931807f, -0.0230925847f, -0.0427039228f,
+    0.204170033f, 0.5643242f, 0.766563773f, 1.06585181f, -0.116592564f, -0.000114339025f,
+    -0.089424856f, -0.557066202f, 0.270875722f, -0.0878482834f, 0.212008357f, -0.23796092f,
+    -0.107526153f, 0.0781368241f, 0.0034231788f, 0.0918903649f
+  },
+  {
+    0.0352242738f, -0.149559751f, -0.0300566964f, -0.189100355f, -0.113246128f, -0.0583175458f,
+    -0.0487557277f, 0.00527547952f, 0.110336646f, 0.0964145958f, 0.0602571405f, 0.173694089f,
+    -0.234462202f, 0.0577870347f, 0.124562487f, -0.144695088f, 0.00551486947f, -0.146037817f,
+    0.0795074701f, -0.125501737f, 0.0793463364f, -0.038295649f, -0.00422026264f, -0.035039328f,
+    -0.133839667f, -0.204841182f, -0.100900345f, -0.215023994f, -0.0890148804f, 0.108474225f,
+    -0.148059949f, 0.0957104489f, -0.203687817f, 0.016695885f, 0.0941333249f, 0.0497444384f,
+    -0.104456954f, -0.0791986957f, -0.0684924349f, 0.0683887005f, -0.149845675f, -0.0208661444f,
+    -0.105249777f, -0.201454103f, 0.0918767005f, -0.0451315679f
+  },
+  {
+    -0.0587434024f, -0.0367339924f, -0.0983776972f, 0.095403932f, 0.0430608913f, -0.100594953f,
+    0.867143869f, 0.0785617158f, -0.225504905f, -0.651767135f, 0.00535507221f, -0.569345057f,
+    0.38032943f, 0.472417027f, -0.143563107f, -0.102792978f, -0.0213528033f, -0.227622956f,
+    0.0529364906f, 0.038360931f, -0.22496663f, -0.094978705f, -0.0503669605f, -0.196883604f,
+    0.0557069629f, 0.105100952f, 0.0633943975f, -0.135034695f, -0.0442653596f, 0.00786023121f,
+    0.269888312f, 0.155418947f, 0.488932103f, 0.249613315f, -0.0254101828f, -0.0259200577f,
+    0.0408649258f, 0.0485107452f, 0.0946907103f, -0.0721503645f, 0.229963809f, -0.28934586f,
+    -0.0352492817f, -0.0315268226f, 0.0721173584f, 0.1116357f
+  },
+  {
+    0.151649714f, 0.1137973f, 0.0968826413f, -0.0973043293f, -4.66579404e-05f, 0.0656637698f,
+    -0.0735716224f, 0.083347857f, -0.013822672f, 0.0421684273f, -0.0305135511f, 0.138855159f,
+    0.143075615f, 0.0150245009f, 0.120085463f, -0.0839119107f, -0.22391668f, -0.218458936f,
+    0.0311088767f, -0.00426030951f, 0.087912105f, 0.0196451545f, 0.105969399f, 0.192579851f,
+    -0.014522464f, 0.126044005f, -0.0283767898f, -0.109732784f, -0.105788052f, -0.220283747f,
+    -0.0967497081f, -0.0428215526f, 0.16170907f, 0.00944686215f, -0.155157253f, 0.0090660993f,
+    -0.131481335f, 0.0345128812f, -0.124644324f, -0.13660346f, 0.134796724f, 0.0947590396f,
+    0.0103914132f, -0.107041575f, -0.0361303166f, -0.0355724022f
+  },
+  {
+    0.0910490453f, -0.200405017f, 0.0622144639f, -0.0457090437f, -0.162576094f, 0.0660953224f,
+    -0.0701595619f, 0.057970982f, -0.0585692823f, -0.0272923056f, -0.0776601732f, -0.0270350315f,
+    0.0583197847f, 0.0326007605f, -0.0901465341f, -0.136639461f, -0.0706146583f, 0.0375108197f,
+    0.208468467f, 0.156475604f, 0.1066681f, 0.148754984f, 0.157940462f, 0.0854800045f,
+    -0.14793472f, -0.0980141386f, -0.028661117f, 0.0443383865f, -0.0696265474f, -0.0166903157f,
+    -0.0930697918f, -0.0350370221f, -0.191916227f, 0.152034715f, -0.0202317778f, 0.0957810283f,
+    0.0734289736f, 0.106265627f, -0.0123582026f, -0.058603622f, -0.186232165f, -0.107931577f,
+    -0.033600077f, 0.00862406101f, -0.0631409436f, -0.0870971382f
+  },
+  {
+    0.0857902616f, -0.0769373477f, -0.0871147886f, 0.162112519f, 0.0235290192f, -0.038415581f,
+    -0.100474626f, -0.0345363952f, -0.0197271295f, -0.00150362076f, 0.0631003603f, -0.113042019f,
+    -0.0135743441f, 0.146127313f, 0.199555248f, 0.0648340583f, -0.0502411686f, 0.102961339f,
+    0.0491975434f, 0.0302470569f, 0.014657299f, -0.0703677461f, -0.0633780733f, -0.10967271f,
+    0.0577977337f, 0.0502803549f, -0.00702872453f, 0.129951864f, 0.114363685f, 0.0699025542f,
+    0.0753180906f, -0.0129306195f, -0.068627052f, -0.0585171096f, 0.0236702133f, -0.0171355885f,
+    0.197182879f, -0.152611971f, 0.184068799f, -0.038406793f, 0.141093031f, 0.112965643f,
+    0.0101454146f, 0.133902401f, 0.0697605312f, -0.0742747113f
+  },
+  {
+    0.1021237f, -0.181225061f, -0.0339849554f, -0.107433937f, 0.0375659876f, -0.187046647f,
+    -0.0365001261f, -0.0594416633f, 0.0160510335f, -0.129161283f, -0.0705409795f, -0.13063632f,
+    -0.137156203f, 0.0393439643f, -0.0963689908f, 0.0147387711f, 0.0456610918f, -0.167495534f,
+    0.0335151367f, 0.0749567375f, 0.0357530154f, 0.21594134f, 0.0754564852f, 0.196701065f,
+    -0.120102011f, 0.00818012375f, -0.044331111f, -0.0841402262f, -0.187221438f, 0.00534208212f,
+    -0.102426887f, -0.0708107203f, 0.0371265225f, 0.213437513f, 0.0605441704f, 0.161801621f,
+    -0.106711827f, 0.083918184f, 0.0364947431f, -0.0795218423f, -0.196668118f, 0.00777267851f,
+    0.00493980898f, -0.00828404073f, -0.0235527828f, -0.026225226f
+  },
+  {
+    -0.00171660737f, -0.154224843f, 0.0194772221f, -0.140716374f, 0.214295879f, 0.00626394153f,
+    -0.159808218f, -0.296270549f, 0.0287763402f, 0.359745681f, 0.179527491f, -0.119956829f,
+    -0.0636986122f, -0.308566213f, 0.000111545756f, -0.139685974f, -0.0494049117f, -0.0057998877f,
+    -0.0304342303f, -0.202484027f, 7.74677028e-05f, -0.021800641f, -0.0540853739f, 0.00870814919f,
+    0.0265663117f, -0.0733516514f, -0.0920567364f, -0.177537188f, 0.114816248f, 0.069693923f,
+    0.103032947f, 0.144141346f, -0.385070801f, -0.039507512f, 0.000539136934f, 0.0666438788f,
+    -0.0672825649f, 0.0416516326f, 0.0188958831f, 0.0184270572f, -0.173486799f, 0.0838714987f,
+    -0.178244382f, -0.172488853f, 0.0501344167f, 0.0311698783f
+  },
+  {
+    -0.117594019f, 0.0193466209f, -0.0258708335f, 0.112910949f, -0.10228578f, 0.00819631945f,
+    -0.0147634987f, -0.214843288f, -0.179260761f, 0.0304105766f, 0.096591495f, -0.0401001982f,
+    0.0312521756f, -0.252868265f, -0.205771357f, -0.123858534f, -0.16156508f, -0.162815213f,
+    0.128702715f, 0.0916780978f, 0.0886660814f, 0.0773639306f, -0.082232371f, -0.00232418953f,
+    0.00281623518f, 0.0234549828f, -0.0475740917f, 0.0582677796f, -0.0425551571f, -0.0899697095f,
+    -0.195459172f, -0.0686864406f, -0.268397063f, -0.143146977f, -0.138096422f, 0.140810385f,
+    -0.171143502f, 0.139694557f, 0.0715910494f, -0.108500727f, -0.0468302369f, -0.01602084f,
+    0.0468287468f, 0.108577758f, -0.058303941f, -0.0306269769f
+  },
+  {
+    -0.153276414f, 0.0183472745f, -0.273170143f, 0.00113715371f, 0.185924962f, -0.038056884f,
+    0.845160067f, -0.456790507f, -0.212729335f, -0.513984919f, 0.178971305f, -0.690373003f,
+    0.000362247723f, -0.567376912f, -0.390568316f, -0.162473097f, 0.159426883f, -0.121591702f,
+    0.165185273f, -0.098902978f, 0.103686929f, 0.00829672441f, 0.211510018f, -0.0600053295f,
+    -0.248431504f, -0.0750939101f, -0.347252131f, 0.072955139f, 0.071603559f, 0.0484608114f,
+    0.23579441f, 0.168579206f, -0.778512836f, -0.21010755f, -0.420861274f, -0.0258527994f,
+    0.0718593746f, 0.322045088f, -0.309395254f, -0.158894911f, -0.116283365f, 0.214924887f,
+    -0.158366203f, 0.0832080245f, -0.181290641f, 0.0884698629f
+  },
+  {
+    -0.142834142f, -0.164134607f, -0.00718475552f, 0.0206620265f, -0.05365384f, -0.105549082f,
+    0.0551904067f, 0.00888905767f, -0.12190482f, -0.0274707545f, -0.0797895044f, -0.0642850846f,
+    -0.0918220654f, -0.046611201f, -0.112912707f, -0.053973157f, -0.129738703f, -0.10849835f,
+    0.107337803f, 0.0574532524f, 0.153989524f, 0.131425455f, 0.010145897f, 0.131530404f,
+    -0.0053758719f, 0.0348270647f, -0.0465993769f, -0.00605926802f, -0.165515974f, -0.05329144f,
+    -0.205224857f, 0.146854624f, -0.17188172f, -0.11344105f, 0.0746583119f, -0.042596247f,
+    -0.0088773109f, 0.0151384491f, -0.00806984399f, -0.106685773f, -0.128445446f, 0.0591599867f,
+    0.0527424663f, 0.00928251073f, -0.125097066f, -0.030181732f
+  },
+  {
+    -0.274570405f, -0.15805988f, -0.338909119f, 0.166773155f, 0.0811012611f, -0.0743313357f,
+    0.824758768f, -0.32452476f, -0.563785017f, -0.493201703f, 0.113102898f, -0.562289536f,
+    0.0600867048f, -0.646631956f, -0.764558077f, -0.168507487f, 0.087320514f, -0.103623539f,
+    0.402758688f, -0.252703488f, -0.0954742804f, -0.162616044f, 0.158424228f, -0.190037206f,
+    -0.439234614f, 0.163454294f, -0.411596775f, 0.0354481153f, 0.0664356351f, -0.00845939852f,
+    0.0843276158f, 0.33453244f, -0.601605654f, -0.380725563f, -0.631298363f, -0.251495361f,
+    -0.0252827611f, 0.209534556f, -0.279079199f, -0.0407995395f, -0.384262264f, 0.29863131f,
+    -0.436702698f, -0.0173768718f, 0.0501688346f, -0.0332876109f
+  },
+  {
+    -0.124202162f, -0.186419562f, -0.124410264f, -0.131828085f, 0.132781357f, -0.167334303f,
+    0.0593899004f, -0.096671313f, 0.00908745639f, 0.199769005f, -0.00456532044f, 0.160577059f,
+    -0.109411776f, -0.166681141f, 0.0601979867f, -0.178205803f, 0.130726814f, -0.172722697f,
+    -0.0904618576f, -0.0122711174f, 0.103251316f, -0.0640047118f, 0.0801794603f, 0.171368569f,
+    0.0090870345f, 0.00527804252f, -0.027348591f, -0.204938427f, -0.0299553182f, -0.11052049f,
+    -0.0251158383f, -0.0570418909f, -0.230933771f, 0.0185041297f, 0.168323427f, 0.207652807f,
+    -0.0447659455f, 0.188762203f, -0.106452122f, -0.0275427364f, 0.0265091546f, 0.0168491937f,
+    -0.0628697127f, 0.0723137558f, -0.0584475733f, 0.00383210927f
+  },
+  {
+    -0.042903319f, -0.0362844393f, 0.0352894999f, -0.144289553f, -0.105877064f, 0.0735735223f,
+    -0.0550171658f, 0.0845793635f, 0.074180454f, 0.109971479f, -0.0654282495f, 0.0208112895f,
+    0.0470601507f, -0.0371333063f, 0.0816288218f, -0.193766713f, -0.145748749f, 0.0415289067f,
+    -0.0716680586f, 0.0811984688f, 0.00714979833f, 0.0282733887f, 0.168490738f, 0.150151327f,
+    -0.0958880559f, -0.180647016f, 0.0899416059f, -0.00848128647f, -0.00233370857f, -0.1500341f,
+    0.0965713188f, 0.0759370551f, 0.185637221f, -0.0273473263f, 0.0733820722f, 0.111334376f,
+    -0.0136080654f, -0.092822805f, -0.0788987502f, -0.0541678146f, 0.148897737f, 0.122732677f,
+    0.123755641f, -0.0267478563f, -0.00327783753f, 0.0928701684f
+  },
+  {
+    -0.064482756f, 0.0868753046f, 0.0138279134f, -0.0440427624f, 0.0715773851f, 0.0972998291f,
+    0.495275944f, -0.032036528f, 0.143817291f, 0.246742293f, 0.212708205f, -0.238091961f,
+    -0.00334082684f, -0.183882177f, 0.117693402f, 0.18430537f, 0.00573188486f, -0.199269071f,
+    0.316311866f, -0.142347053f, 0.126210257f, 0.0250349473f, 0.00780637376f, -0.175277352f,
+    0.0095259212f, 0.114872091f, 0.0118274279f, -0.00761126867f, 0.0221013371f, -0.0365593918f,
+    0.0914899036f, -0.00667697517f, 0.0202874877f, -0.143219322f, 0.00607426744f, 0.072267592f,
+    0.0238806475f, -0.00745932944f, -0.151735291f, 0.0506372862f, -0.293212771f, -0.0498758294f,
+    -0.105271608f, -0.0646378174f, 0.045576077f, 0.00136933743f
+  },
+  {
+    0.0915762559f, -0.00981138833f, -0.0135987317f, -0.00429677358f, -0.00458113523f, -0.125307724f,
+    -0.0254874025f, 0.25867936f, -0.258598894f, -0.223769158f, -0.0886576548f, 0.127689034f,
+    -0.0927098915f, 0.153340518f, 0.071013473f, -0.175491989f, -0.0477352962f, -0.122557536f,
+    -0.0755188614f, -0.0563963503f, -0.0640646517f, 0.0974732041f, 0.00187609112f, 0.0963940918f,
+    0.0195914917f, 0.0247217603f, -0.138700828f, -0.19083035f, -0.0495060794f, -0.0458209887f,
+    -0.058930736f, 0.149823651f, 0.176207975f, 0.225187659f, -0.0409384482f, 0.197091445f,
+    -0.0332681499f, -0.189414382f, -0.0829724818f, -0.0780310556f, -0.072702691f, -0.0344361179f,
+    0.0591372363f, 0.0300808158f, 0.044892285f, 0.0171131827f
+  },
+  {
+    0.00368954381f, 0.343309551f, 0.71373415f, -0.0972247198f, -0.298152775f, -0.330334097f,
+    0.404988676f, 0.9139992f, 1.02188492f, 0.0192098524f, 0.550248682f, 0.163686737f,
+    0.572338641f, 0.642876089f, 0.572704434f, 0.0988903269f, 0.134542271f, -0.170619354f,
+    -0.0149582755f, 0.534845293f, -0.159246519f, -0.0183310527f, 0.192619443f, -0.145696267f,
+    0.505391717f, 0.0177282467f, 0.272577018f, 0.0591230318f, -0.0726574659f, 0.0759949312f,
+    0.447207063f, 0.737970114f, 0.734199226f, 0.966402829f, 0.343364298f, 0.724602699f,
+    -0.0923223644f, -0.458819062f, 0.469873399f, 0.0728983507f, 0.324029118f, -0.321576834f,
+    0.234802708f, -0.0333552696f, -0.0157129131f, -0.110969067f
+  },
+  {
+    -0.110519499f, 0.0110223508f, 0.0750414655f, -0.0270526558f, 0.0636597276f, 0.137243301f,
+    -0.11163985f, 0.115969099f, -0.03516265f, -0.145316824f, -0.0731287822f, -0.010119942f,
+    0.00971176196f, 0.143881783f, -0.0293887146f, 0.0395859368f, -0.0622201487f, 0.0710174143f,
+    -0.160359532f, 0.115430355f, -0.10616073f, -0.0853706077f, -0.0951028019f, -0.0330298021f,
+    -0.13319549f, -0.0541858636f, 0.073443599f, 0.0678753108f, 0.104830235f, 0.115668736f,
+    0.0258253366f, 0.00488252658f, -0.0623450093f, -0.102052957f, 0.0964723676f, 0.1145197f,
+    0.0593857467f, -0.12218795f, 0.057300508f, 0.0518500656f, -0.0475308783f, -0.111268006f,
+    -0.0642725825f, 0.0810157433f, 0.19676511f, -0.0187905896f
+  },
+  {
+    0.0576751418f, 0.100846536f, 0.174286485f, -0.155646071f, -0.0724882931f, -0.0187196918f,
+    -0.0872723535f, 0.3068358f, 0.293608606f, 0.609666824f, -0.210749924f, 0.100045703f,
+    0.0698047653f, 0.390616894f, 0.283784419f, -0.0829598457f, 0.119710393f, -0.0962569788f,
+    -0.0848137513f, -0.00428595068f, -0.146839425f, 0.134167597f, -0.138197124f, 0.0606955327f,
+    0.160566494f, 0.170367926f, 0.0820499361f, 0.0429821834f, 0.0412181206f, 0.0511233285f,
+    0.212165594f, 0.0111621739f, 0.400235206f, 0.186683118f, 0.373542279f, 0.111770056f,
+    0.122775175f, -0.284474105f, 0.0563450903f, 0.0394789353f, 0.0453453362f, 0.0227642003f,
+    0.381513506f, 0.0450112857f, 0.0610226579f, 0.0279799402f
+  },
+  {
+    0.452669561f, 0.355937332f, 0.609692156f, -0.291502327f, -0.290181577f, -0.212701976f,
+    0.821315587f, 0.833989382f, -0.70475316f, -0.498707592f, -0.160086989f, -0.705570817f,
+    0.636104882f, 1.10853434f, 0.423540473f, -0.0369039811f, 0.11504145f, -0.171348691f,
+    -0.297274172f, 0.616199255f, -0.513441205f, -0.176468f, 0.021218745f, -0.189335778f,
+    0.60706073f, 0.0440444686f, 0.58825314f, -0.0480688028f, -0.0486006215f, -0.00441715308f,
+    0.381344795f, -0.0463607833f, 0.882723153f, 0.562234104f, 0.0876117647f, -0.291334003f,
+    0.108863942f, -0.394489825f, 0.736251891f, 0.0578769743f, 0.648929417f, -0.279416561f,
+    0.434898704f, -0.0239865668f, -0.000403638522f, -0.00818154961f
+  },
+  {
+    -0.110093623f, 0.0930310637f, 0.184965879f, -0.0671005547f, 0.0637286827f, -0.0540427119f,
+    0.203095898f, -0.0584867224f, -0.0219707582f, -0.323065341f, -0.037701156f, -0.231756166f,
+    0.113338828f, 0.0129614007f, -0.218336105f, 0.00110328803f, 0.09013246f, 0.031055769f,
+    -0.159790531f, 0.00771336723f, -0.172024876f, -0.211283475f, 0.0639518946f, 0.0641676113f,
+    0.0408060923f, 0.0659881532f, -0.0247858763f, -0.0490793996f, 0.114055991f, 0.168804109f,
+    0.0238956772f, -0.123272091f, -0.163905069f, 0.0279619191f, -0.14235653f, 0.0742449462f,
+    0.0136649432f, 0.078886278f, -0.0318982899f, -0.128360689f, -0.0315187946f, 0.0309706032f,
+    -0.155801401f, 0.0780196711f, 0.128802881f, -0.0843588561f
+  },
+  {
+    -0.195748717f, 0.16968447f, -0.18822819f, -0.0556344725f, 0.0232482646f, 0.0471898839f,
+    0.0526714101f, 0.0624616109f, -0.444901079f, -0.0375853665f, -0.212930426f, 0.187094003f,
+    0.0659647658f, 0.325926185f, -0.161692619f, 0.0637099966f, -0.118961617f, -0.0356863104f,
+    -0.0758433565f, 0.0457974449f, -0.151969612f, -0.175360277f, 0.0588189662f, -0.144529641f,
+    0.141022339f, -0.0319548473f, 0.146755323f, 0.0252815168f, -0.0890062153f, 0.177750677f,
+    -0.115213156f, 0.0635408685f, 0.210044861f, -0.158930361f, 0.0442790724f, -0.0960148647f,
+    -0.0922242478f, -0.0783697516f, -0.0446875133f, 0.230525777f, 0.182209432f, -0.0622354224f,
+    0.210731491f, 0.195170566f, 0.0609060004f, -0.0482804663f
+  },
+  {
+    0.181562975f, 0.312872529f, 0.466037214f, -0.0220757835f, -0.129492342f, 0.065207161f,
+    0.219209194f, 0.31170103f, 0.452640444f, 0.517469227f, -0.124224789f, 0.142071977f,
+    0.0788264573f, 0.398777544f, 0.555842638f, 0.0272416137f, -0.0542513318f, -0.0431797951f,
+    -0.21173434f, 0.203616962f, -0.104276918f, 0.0196563136f, -0.102117039f, 0.0997232124f,
+    0.132270709f, 0.0928056017f, 0.456199169f, -0.102946512f, 0.146498367f, 0.0896051973f,
+    0.120905794f, 0.00601447187f, 0.671662331f, 0.344879299f, 0.365442336f, -0.0499521047f,
+    0.120623194f, -0.272243053f, 0.371463418f, 0.220474333f, 0.161615461f, 0.117699578f,
+    0.301055849f, 0.0602434054f, 0.184115857f, -0.0226223506f
+  },
+  {
+    -0.0351122096f, 0.0510526299f, -0.0975612625f, -0.0195274949f, 0.131189898f, 0.0253063869f,
+    -0.0135537712f, 0.0960514992f, -0.18404603f, -0.172757417f, 0.0318244584f, -0.0966270566f,
+    0.160593271f, -0.17988202f, 0.0788653716f, 0.177056104f, 0.148166031f, 0.207959607f,
+    -0.171688229f, -0.054993391f, 0.0644710064f, -0.159550145f, 0.00806405209f, -0.182580501f,
+    -0.016437687f, 0.0120141879f, -0.0208567772f, 0.0112848245f, 0.0866241008f, -0.0538237989f,
+    0.00875959639f, -0.0703403577f, -0.179538906f, -0.197892874f, 0.00570897106f, -0.0554087274f,
+    -0.0470643491f, 0.112251885f, 0.174138874f, 0.0467244312f, 0.0324731171f, 0.201190397f,
+    -0.11185658f, -0.0995733216f, 0.102429248f, 0.14584735f
+  },
+  {
+    -0.0957836509f, 0.338497072f, -0.0990766883f, 0.104557283f, -0.358916283f, -0.148335859f,
+    0.208336607f, 0.420830041f, -0.919818878f, -0.533620536f, -0.17241694f, -0.397528589f,
+    0.2592825f, 0.306378514f, -0.452335536f, -0.0343618467f, -0.105486736f, 0.0922387764f,
+    0.187798187f, 0.0445448309f, -0.218553975f, -0.0696323365f, 0.0872823894f, -0.176579595f,
+    0.297753692f, 0.0926878005f, -0.0747206807f, 0.13865824f, -0.0546500385f, 0.0502829216f,
+    0.043053776f, 0.300151885f, 0.382862628f, 0.134613305f, -0.396457672f, -0.50212276f,
+    0.0944065452f, -0.542905748f, 0.295467257f, 0.219856471f, 0.160119548f, 0.0650229678f,
+    0.187543869f, 0.0712299272f, 0.0182781778f, 0.181129202f
+  },
+  {
+    -0.0999492407f, 0.15241915f, 0.0922207683f, 0.0208425354f, -0.0671284869f, -0.142759144f,
+    0.156205177f, -0.0812312439f, 0.118926682f, 0.0107458886f, -0.0251589213f, -0.111635044f,
+    0.0967702121f, -0.125626415f, 0.0678208694f, -0.09869349f, 0.0279176272f, -0.120925702f,
+    0.165420443f, -0.0477003492f, -0.0267544594f, 0.141783118f, 0.206831649f, 0.104519024f,
+    0.0376817882f, -0.0554793105f, 0.108381949f, -0.175738871f, -0.0830360278f, -0.101304881f,
+    0.00875452813f, 0.12133804f, 0.0754785612f, -0.0851489082f, 0.0990170315f, -0.00887008477f,
+    0.110528424f, -0.108546048f, 0.0799355209f, -0.0611134358f, -0.0850111619f, 0.0270852484f,
+    0.0199415851f, -0.139432937f, -0.211586654f, -0.0744923428f
+  },
+  {
+    0.262836307f, 0.105840206f, 0.174053177f, 0.00610453403f, 0.190952763f, 0.0399861485f,
+    0.096350491f, 0.169653729f, 0.211458325f, 0.231230944f, -0.0245566536f, 0.15745458f,
+    0.00774900895f, 0.410936296f, 0.764902711f, -0.00168753928f, 0.0911480933f, 0.0460811295f,
+    -0.151096404f, 0.258876085f, -0.251440287f, 0.121144772f, -0.181405559f, 0.0220166184f,
+    0.278577924f, 0.0795774311f, 0.333941877f, -0.114759438f, 0.065844357f, 0.125918552f,
+    -0.0336062834f, 0.0057291491f, 0.381056815f, 0.19171907f, 0.556596339f, -0.137598962f,
+    0.202433348f, -0.150506586f, 0.0930672735f, 0.171449721f, 0.250324726f, 0.188242063f,
+    0.534904838f, 0.158932105f, -0.0288830698f, -0.10914854f
+  },
+  {
+    0.0925337598f, -0.0477325842f, -0.0157472007f, -0.118986003f, -0.108030163f, -0.0431994386f,
+    0.211448804f, 0.0439002998f, 0.0622274242f, -0.044584576f, -0.0646755695f, 0.128997192f,
+    -0.0342731997f, -0.0650123656f, 0.1196943f, 0.174950972f, 0.0825426206f, 0.0445151851f,
+    0.0748082995f, -0.121988975f, -0.052711077f, -0.0794967413f, -0.14806889f, 0.0891615376f,
+    -0.104983389f, -0.0140676405f, -0.104749151f, -0.0293428227f, 0.0374156348f, -0.000237038825f,
+    -0.0342211984f, -0.172274604f, 0.226096109f, -0.116981521f, 0.0382028893f, -0.125455871f,
+    0.0228544921f, 0.0844004303f, -0.105080277f, -0.099041611f, 0.0970221311f, 0.0973214582f,
+    -0.0313764624f, 0.196709096f, -0.026389407f, 0.0690894425f
+  },
+  {
+    0.152867436f, 0.346831292f, 0.170932934f, -0.0072783241f, -0.10964857f, -0.217911944f,
+    -0.382781357f, 0.431210637f, -0.037510246f, 0.563888252f, 0.0171309188f, 0.077537775f,
+    0.411643982f, 0.656507134f, 0.326027066f, 0.00574326841f, -0.0578295626f, -0.134578884f,
+    -0.211653426f, -0.0270945579f, -0.204573631f, 0.00435807509f, -0.0172717739f, 0.116984971f,
+    0.467607349f, 0.461608261f, 0.483777016f, -0.087194629f, 0.112543911f, -0.040652521f,
+    0.26942125f, -0.214066133f, 0.79254204f, 0.249667183f, 0.195291564f, -0.197212785f,
+    0.179226696f, -0.296554297f, 0.381539673f, 0.613581657f, 0.481125474f, 0.528192461f,
+    0.473639339f, 0.0807636455f, 0.214344308f, 0.203904048f
+  },
+  {
+    -0.0543749258f, -0.067353785f, -0.113709904f, -0.0162492674f, -0.058570344f, 0.0773682743f,
+    0.120466202f, -0.0141280694f, -0.117631182f, 0.0433894768f, -0.135281831f, 0.0431162082f,
+    0.128583118f, -0.0780759603f, 0.0692989752f, -0.0385024473f, 0.18934685f, 0.0556605235f,
+    0.127598286f, 0.0466206297f, 0.0269312505f, -0.163597628f, -0.197169408f, -0.130145609f,
+    0.10605558f, -0.132606253f, 0.0184420496f, 0.133005455f, -0.0474926494f, 0.147093669f,
+    0.150160074f, -0.11443539f, -0.0851533487f, 0.0809285194f, 0.0234245583f, 0.0177187268f,
+    -0.0292762071f, -0.113779172f, 0.0446373299f, -0.140247509f, 0.156968236f, 0.000995703507f,
+    0.00711844908f, 0.151412934f, 0.0987225845f, -0.105518602f
+  },
+  {
+    -0.0839774236f, -0.0508496687f, -0.0361613147f, 0.06217435f, 0.0389007553f, 0.148960143f,
+    0.342892289f, -0.406298459f, 0.0874908343f, 0.521164298f, 0.00669279415f, -0.634269893f,
+    -0.044519145f, -0.554102182f, -0.0412865356f, 0.0648714826f, 0.137925342f, -0.220417112f,
+    0.333420068f, -0.253552437f, 0.326616049f, 0.225477412f, 0.0635710284f, -0.122710809f,
+    -0.272781104f, 0.0567772985f, -0.120983057f, 0.109863408f, 0.00137323863f, 0.0693728924f,
+    0.211353883f, 0.000134804519f, -0.632710457f, -0.193403691f, -0.0409901328f, 0.158382624f,
+    0.0838021711f, 0.164020747f, -0.325089008f, -0.0920271724f, -0.149558425f, 0.123188883f,
+    -0.259914756f, -0.0159031358f, -0.0181141365f, -0.0898229405f
+  },
+  {
+    -0.0787633657f, -0.168893069f, -0.135667548f, -0.136937454f, 0.0105239293f, -0.0420627706f,
+    0.135152549f, 0.1041997f, 0.0213938374f, 0.0423107557f, 0.0661642849f, 0.12923269f,
+    -0.157501623f, 0.108331315f, 0.0486104749f, -0.0371736027f, -0.0890312046f, -0.169711322f,
+    -0.0627460107f, 0.00135543407f, 0.107152879f, 0.127389222f, 0.0206314549f, 0.0701788887f,
+    0.070986852f, -0.193062529f, -0.128900558f, -0.0145393042f, -0.0474647246f, -0.170559093f,
+    -0.0354912728f, -0.049607724f, 0.0250931103f, 0.0318367779f, 0.0467250422f, 0.0653143749f,
+    -0.122172199f, -0.20050551f, -0.0461366586f, -0.150681213f, 0.0140715847f, -0.147169679f,
+    0.126570538f, 0.0107819485f, -0.163197577f, -0.0774407536f
+  },
+  {
+    0.263596743f, 0.227624997f, 0.10024263f, -0.0589433759f, -0.110209957f, -0.0211265907f,
+    0.528991222f, 0.223921865f, 0.124157608f, -0.314712375f, -0.224210456f, 0.554507315f,
+    0.209154502f, 0.598093927f, 0.369145334f, 0.0936265588f, 0.0469115265f, 0.112964459f,
+    -0.251799583f, 0.362109184f, -0.0841688886f, 0.0112943212f, -0.132396176f, -0.0518793613f,
+    0.0594405979f, 0.128392503f, 0.278033495f, -0.0647589862f, 0.084097974f, 0.125705451f,
+    0.0276164021f, -0.0234397035f, 0.448560178f, 0.403318733f, 0.274077147f, -0.0591838472f,
+    -0.0620388947f, -0.291668355f, 0.158218578f, 0.12359146f, 0.17597419f, 0.0842341706f,
+    0.278137803f, -0.146143854f, -0.0973846838f, 0.0324436799f
+  },
+  {
+    -0.0870603099f, -0.00227145711f, 0.101884328f, -0.110184498f, -0.20621942f, -0.154454604f,
+    0.127998009f, 0.0790942535f, 0.00447099749f, -0.00266418653f, 0.0600700267f, -0.195144847f,
+    -0.139733166f, 0.0405115336f, -0.11742527f, -0.100336224f, -0.0596364625f, 0.0314442515f,
+    -0.00689862203f, -0.0197449196f, -0.0185182299f, 0.148882553f, 0.0773194581f, 0.195895702f,
+    0.102643907f, 0.0525748879f, 0.0566845536f, -0.194331467f, -0.0225667693f, -0.0301635582f,
+    0.0656406656f, 0.194966093f, -0.155127332f, -0.0623125099f, 0.118210331f, 0.0525820442f,
+    -0.00531949196f, -0.0548337251f, -0.000715578266f, -0.0639036819f, 0.00852448121f, 0.0805393904f,
+    -0.129013285f, -0.156032741f, -0.062005505f, 0.0284028389f
+  },
+  {
+    -0.104504831f, -0.00341215986f, -0.0470615476f, -0.196684808f, -0.20319964f, -0.121699966f,
+    -0.121728405f, 0.125082105f, -0.0136673888f, 0.013055834f, -0.000425898063f, 0.156621888f,
+    -0.2119831f, 0.0272210408f, 0.125127986f, 0.0179630145f, -0.109153315f, -0.127935216f,
+    0.0791526362f, 0.139796644f, 0.114225522f, 0.0413052402f, 0.0403788909f, 0.115034439f,
+    0.0509745851f, -0.0506003313f, 0.0851057917f, -0.0257594846f, -0.199808076f, -0.20786947f,
+    0.0563126914f, 0.162446424f, 0.150655791f, 0.101748936f, 0.126487166f, 0.205710799f,
+    -0.000399395096f, -0.0955719501f, -0.166921198f, -0.160851613f, -0.063517727f, -0.158989057f,
+    0.120458074f, -0.0831242204f, -0.0165630355f, -0.196702242f
+  },
+  {
+    -0.0761242807f, 0.0954078957f, -0.157061145f, -0.0735293925f, -0.0366380662f, 0.0137595227f,
+    -0.146992445f, 0.00305315387f, -0.112726316f, 0.0957101807f, -0.124613516f, -0.010579505f,
+    -0.133625969f, 0.133807406f, 0.109434374f, 0.127619758f, 0.0265111774f, 0.0584867895f,
+    0.0588559359f, 0.125580639f, -0.0594347678f, -0.0590663925f, -0.0718942955f, -0.171639696f,
+    -0.0416079536f, -0.0145764267f, -0.0731724501f, 0.140595838f, 0.0837248042f, 0.0585693829f,
+    -0.137899503f, -0.0465450063f, 0.00475595193f, 0.0826742277f, -0.033841867f, 0.0865506604f,
+    0.0296588447f, -0.0991980955f, -0.00844240095f, -0.0388351381f, 0.0389020182f, -0.0461177528f,
+    0.130031765f, -0.0215508845f, 0.157965004f, 0.135892048f
+  },
+  {
+    0.036119055f, -0.175184965f, -0.103205174f, -0.14800556f, -0.233245671f, -0.0822792873f,
+    -0.0615802407f, -0.0139350165f, -0.00901136175f, 0.16812773f, -0.00799657032f, 0.0372656137f,
+    -0.119898416f, 0.0674111396f, -0.104220167f, -0.0660244375f, -0.144352123f, -0.258099914f,
+    0.144602612f, -0.0279668011f, 0.0797521994f, 0.154549509f, -0.0199716408f, 0.176153392f,
+    -0.0355354734f, -0.204592243f, -0.0747987479f, -0.0559226722f, 0.000463090983f, -0.131511092f,
+    -0.0175790954f, -0.0515759028f, -0.0607935712f, 0.049616497f, -0.0123915235f, -0.0625447184f,
+    0.0099639846f, -0.114015356f, -0.0920094699f, -0.0468010567f, -0.0108988639f, -0.072989352f,
+    -0.176388264f, 0.060795214f, -0.0922106951f, -0.145944834f
+  },
+  {
+    -0.0183737557f, 0.142852068f, 0.0868411288f, -0.0392457396f, -0.112316683f, -0.0127931591f,
+    0.926554203f, 0.101430677f, 0.044334393f, 0.651067138f, 0.22420232f, -0.92584908f,
+    0.360767841f, 0.221494377f, 0.197130322f, 0.084096007f, 0.133472726f, 0.0506537631f,
+    0.0801166594f, 0.0741327778f, 0.0682323053f, 0.142120197f, 0.172727302f, -0.160397276f,
+    -0.00284879305f, 0.0837944299f, 0.0773703307f, 0.0195661057f, -0.0218815673f, -0.103946984f,
+    0.106409505f, 0.102168247f, 0.1077976f, 0.150643691f, 0.154625997f, -0.0237115622f,
+    0.0451137275f, 0.0507003292f, 0.108336493f, 0.231172293f, -0.0329904556f, -0.0408514775f,
+    -0.018772224f, -0.0899933353f, 0.0678259432f, -0.0342410877f
+  },
+  {
+    -0.139261201f, -0.0642941892f, 0.0887367949f, 0.184737548f, -0.0271699298f, -0.0158301517f,
+    0.208277673f, -0.292179942f, -0.0834764913f, 0.14973186f, 0.173739552f, -0.184854493f,
+    -0.0690988526f, -0.27293998f, -0.196761355f, -0.036450997f, 0.148749694f, -0.047673367f,
+    0.201633736f, -0.244884416f, 0.0978278518f, -0.0363432579f, -0.079989031f, -0.212240413f,
+    -0.0513712279f, -0.0785917044f, -0.145078331f, 0.01360239f, -0.0456474349f, 0.00813651737f,
+    -0.130359381f, -0.0679811165f, -0.463465154f, -0.13362743f, -0.185861334f, -0.0851288661f,
+    0.0652731732f, 0.129710838f, -0.315807223f, 0.0674663261f, -0.0980075598f, 0.0621245913f,
+    -0.0774480775f, -0.178699106f, 0.0524744503f, -0.145698339f
+  },
+  {
+    0.147785276f, -0.0942859501f, 0.17221874f, -0.0375760086f, 0.193556041f, 0.133380055f,
+    0.233608708f, -0.0715958476f, 0.082938239f, 0.149746239f, 0.0148725072f, -0.168689579f,
+    -0.0665463731f, -0.0996286646f, 0.0928579196f, 0.124072626f, 0.190524429f, 0.0666935518f,
+    -0.179266915f, -0.152785227f, 0.00573762367f, -0.00342234597f, 0.0887658671f, -0.204973638f,
+    -0.0542856008f, -0.0947913975f, -0.0107141351f, 0.0616888665f, -0.076463297f, 0.152523264f,
+    0.0731976777f, 0.099290289f, 0.0262597241f, -0.167367876f, -0.0716316402f, -0.0406716503f,
+    0.0956191197f, 0.103304654f, 0.150317252f, -0.10424424f, 0.0878309757f, 0.192223191f,
+    0.00903530512f, 0.156711042f, 0.172860563f, 0.156767815f
+  },
+  {
+    -0.0320165269f, -0.132161796f, -0.11514274f, -0.175428271f, 0.0401456244f, -0.173097819f,
+    0.0371856727f, -0.206283823f, 0.12014012f, 0.0409063213f, 0.0434723906f, -0.189533383f,
+    0.110853232f, 0.0790193677f, 0.00329050468f, -0.0382664204f, 0.0347107723f, -0.0142732728f,
+    0.00894249231f, -0.0647282675f, 0.139960214f, 0.0882591456f, 0.126263559f, 0.0834163651f,
+    0.0481564775f, -0.0813264921f, -0.0133457147f, -0.103435613f, -0.0769828409f, -0.136650771f,
+    -0.182968944f, -0.0148831941f, -0.0517557338f, -0.14478074f, -0.0679126531f, -0.0685666576f,
+    -0.134592801f, 0.015442878f, 0.104867525f, 0.0741251931f, 0.0625955537f, 0.0876169428f,
+    0.0102306753f, -0.116366647f, -0.000132969624f, -0.0950598195f
+  },
+  {
+    0.225754306f, -0.0114372596f, 0.0805480853f, 0.139325872f, 0.178496644f, 0.186947688f,
+    -0.2705926f, -0.426986903f, 0.650029957f, 0.438215315f, 0.107048422f, -0.214883447f,
+    -0.208442047f, -0.364661723f, -0.007300172f, -0.132880479f, 0.0934664905f, 0.0277178623f,
+    0.310046285f, -0.27729249f, 0.270748824f, 0.0083662821f, -0.101715162f, -0.0242114682f,
+    -0.25633055f, -0.073097907f, -0.0355128236f, -0.165029258f, 0.116920441f, -0.0714476854f,
+    -0.0140334144f, -0.107705057f, -0.371543467f, -0.170540109f, 0.272949547f, 0.0476477109f,
+    -0.0225074142f, 0.398863375f, -0.11618486f, 0.0216239169f, -0.383006364f, -0.150672972f,
+    -0.15145126f, -0.0201839805f, -0.202793837f, -0.130708992f
+  },
+  {
+    0.637842476f, 0.801953554f, 0.868233085f, -0.120116562f, -0.177595034f, -0.194133177f,
+    -0.110117458f, 1.4355135f, 1.35870492f, 0.162920296f, 0.0212800354f, 0.41222018f,
+    0.560577035f, 1.11454701f, 0.528504789f, -0.0610551871f, 0.0670751706f, -0.056846451f,
+    -0.409054548f, 0.588388741f, -0.268289387f, 0.0510466099f, -0.0698807538f, 0.0366226695f,
+    0.413983345f, 0.291272908f, 0.534503758f, 0.075281553f, -0.0420615673f, 0.0884324908f,
+    0.237620696f, 0.259012401f, 1.1324476f, 1.2978096f, 0.769056976f, 0.253081471f,
+    0.144525841f, -0.579737008f, 0.696644783f, 0.201765969f, 0.231641084f, -0.179804444f,
+    0.290396512f, -0.0120915463f, -0.0194124077f, -0.0477987006f
+  },
+  {
+    0.0118223038f, 0.0538545549f, 0.049123764f, -0.0638297796f, -0.176812172f, -0.00813924242f,
+    0.165850475f, -0.308957875f, -0.0692792013f, -0.0485517979f, -0.0277858414f, -0.0436670706f,
+    -0.172586352f, -0.178593487f, -0.367135257f, -0.0466792323f, -0.105448231f, 0.00135355233f,
+    0.236232743f, 0.126076713f, 0.0199630167f, 0.0492306389f, 0.180818185f, 0.192543358f,
+    -0.195441127f, -0.113732576f, -0.138153553f, 0.0921217725f, -0.0111688869f, -0.0252348166f,
+    -0.0359771736f, 0.100707822f, -0.152178541f, -0.163598061f, -0.288651913f, -0.0493538044f,
+    0.0705820099f, 0.197151691f, -0.143640205f, -0.236098379f, 0.0424303599f, -0.024719514f,
+    -0.227588549f, -0.084400408f, -0.0931665525f, -0.201066643f
+  },
+  {
+    -0.0845962018f, 0.0267312955f, -0.0941285565f, 0.143399313f, 0.0973658934f, 0.0457720906f,
+    0.296146303f, -0.130345419f, -0.143261567f, -0.40621689f, 0.182258502f, -0.236351267f,
+    -0.0931158736f, -0.10633935f, -0.326057017f, -0.100918859f, -0.127840295f, -0.0501408502f,
+    0.0615194924f, 0.0563070923f, 0.0370712914f, 0.0495415479f, -0.0215820335f, 0.154963523f,
+    -0.0354371965f, -0.104788877f, -0.242030621f, 0.0980050862f, -0.159903988f, 0.00729118939f,
+    -0.0645607933f, 0.0850492492f, -0.407094389f, -0.153451398f, -0.111229226f, 0.0369749404f,
+    -0.184616819f, 0.0808318257f, -0.167805091f, -0.197168827f, 0.0349084921f, -0.00865916163f,
+    -0.170052916f, 0.0979376435f, 0.0122583862f, -0.0820593908f
+  },
+  {
+    -0.0374885798f, -0.18596974f, 0.0493776575f, 0.0548430309f, -0.0242554639f, 0.05001463f,
+    0.179636225f, -0.112718426f, 0.444629669f, 0.330125242f, 0.0212861765f, 0.092020236f,
+    -0.01182942f, -0.0555055439f, 0.108023465f, -0.125346676f, 0.195423543f, 0.0534268208f,
+    0.170169607f, -0.175567403f, -0.0260370634f, 0.0235036295f, -0.119292296f, -0.0512847938f,
+    -0.215013891f, 0.00789007731f, -0.193394199f, -0.086991556f, 0.0217791051f, -0.123139516f,
+    0.122259617f, -0.168154851f, -0.193010449f, -0.10782025f, 0.269759208f, -0.0235754885f,
+    0.100685604f, 0.376503795f, -0.0360872708f, 0.0316184536f, -0.0861236751f, -0.0968434513f,
+    -0.177901462f, -0.0420284048f, -0.157055587f, -0.0219766069f
+  },
+  {
+    0.056945987f, -0.00970234443f, -0.0470076986f, 0.0282590576f, -0.104295164f, -0.195481434f,
+    -0.0453375392f, 0.150292322f, 0.0452344567f, 0.010888367f, 0.0828540176f, -0.020536432f,
+    -0.039892666f, -0.10371463f, -0.215030894f, -0.0489276238f, -0.211128801f, -0.0437696986f,
+    0.0406596661f, -0.0203697961f, -0.0472448282f, 0.100929976f, 0.0348918438f, 0.236295298f,
+    -0.0915480256f, -0.137999445f, -0.160909638f, 0.0266079195f, -0.173105478f, -0.0975208357f,
+    -0.117743604f, 0.0188033637f, 0.0825253576f, -0.0754518285f, 0.0490401573f, 0.0826562569f,
+    -0.171198934f, -0.0163425039f, -0.211720601f, -0.0637443736f, 0.00808242243f, -0.200800791f,
+    0.0513298362f, -0.248785019f, -0.0758781657f, -0.0941826254f
+  },
+  {
+    0.241578192f, 0.324983567f, 0.366078943f, -0.0711529553f, -0.0691631213f, -0.0650435984f,
+    0.0720778704f, 0.389762193f, -0.0430690683f, 0.152213752f, -0.185297266f, 0.666553736f,
+    0.124158844f, 0.614391983f, 0.637841344f, 0.0236064047f, 0.0264695678f, 0.0973708108f,
+    -0.0551458225f, 0.360968709f, -0.493219823f, 0.110698298f, -0.115998678f, -0.08785934f,
+    0.119244926f, 0.12416251f, 0.398413122f, -0.109718747f, 0.173741594f, 0.0334082656f,
+    0.100189731f, 0.00271388446f, 0.623935699f, 0.296349913f, 0.40694052f, -0.299559057f,
+    0.163200498f, -0.20678255f, 0.277543992f, 0.230907768f, 0.0475470014f, -0.0363857336f,
+    0.518022239f, 0.0627710298f, -0.0917372927f, 0.121563762f
+  },
+  {
+    0.0740548074f, 0.213167116f, 0.208906174f, 0.0200048666f, -0.0611666553f, 0.215536535f,
+    0.085654147f, -0.0711420029f, -0.129048973f, -0.190802395f, -0.171794698f, 0.126290113f,
+    -0.0150180077f, 0.122902967f, 0.209690869f, 0.0331293494f, 0.112299472f, -0.0120521188f,
+    -0.141565189f, -0.000641194347f, -0.051477734f, -0.0507591181f, 0.0190205593f, -0.161841929f,
+    0.097459957f, 0.146500096f, 0.00688531855f, 0.202060804f, 0.0571412668f, -0.0617513023f,
+    0.155159906f, -0.0313865021f, 0.14169544f, -0.0783693492f, 0.023992531f, -0.0593637563f,
+    0.149283573f, 0.116628535f, -0.045098234f, 0.0871131793f, 0.0927714407f, 0.17439124f,
+    0.0442932323f, 0.157684922f, 0.217359364f, 0.182620138f
+  },
+  {
+    0.15578787f, -0.0797354057f, -0.0562095866f, 0.0698079988f, 0.0289430674f, 0.19188185f,
+    0.188144192f, 0.0533801839f, -0.084035188f, 0.010828021f, -0.113939881f, -0.136101425f,
+    0.131206736f, 0.104986206f, 0.00679307524f, -0.00317423977f, 0.0440894663f, 0.0310520791f,
+    -0.178185508f, -0.01873184f, -0.124822326f, -0.121203706f, -0.146595448f, 0.0522775091f,
+    -0.0950278565f, 0.107747212f, 0.000712419511f, 0.0395595655f, 0.185033247f, 0.201009437f,
+    -0.0991422832f, -0.117008559f, -0.0652269945f, 0.0674187765f, 0.207799837f, -0.12902236f,
+    -0.0823796317f, 0.083547093f, 0.188855305f, -0.0725580305f, 0.0324331596f, -0.0365767032f,
+    0.00203618943f, 0.194596589f, -0.0635466948f, 0.00399027858f
+  },
+  {
+    -0.0844278932f, -0.228595942f, -0.144099772f, -0.0269525573f, 0.00983188953f, 0.0295387227f,
+    0.2322696f, -0.115201473f, -0.366304189f, -0.329302847f, 0.00302547473f, -0.0690792724f,
+    -0.0273080226f, -0.16091004f, -0.338049024f, 0.0209354833f, -0.165574446f, -0.160812408f,
+    0.0633344576f, -0.0899798274f, -0.0136557389f, -0.155513749f, 0.112268753f, -0.0628430918f,
+    0.00832401309f, -0.0336712338f, -0.0585362129f, -0.0679762363f, -0.0336771719f, -0.149493739f,
+    0.0562597401f, 0.134239286f, -0.149300843f, -0.161087275f, -0.405489922f, 0.115387537f,
+    0.103516616f, 0.111398377f, -0.00407446641f, 0.0677042678f, -0.0195769779f, -0.142130047f,
+    -0.265388548f, 0.136126384f, 0.064876698f, -0.151610106f
+  },
+  {
+    0.0890973657f, -0.154712901f, -0.0887209773f, 0.0318556912f, -0.0552149229f, 0.081769757f,
+    -0.0440922193f, -0.18850936f, 0.0938631445f, 0.0420406424f, -0.016750548f, 0.0674769953f,
+    -0.182015553f, -0.233169094f, -0.115171477f, -0.159384817f, -0.113167681f, 0.0487560593f,
+    -0.0144198639f, -0.120342478f, 0.224419251f, 0.183814451f, -0.0957004055f, -0.0289156772f,
+    -0.0823296234f, -0.202023119f, -0.00826369505f, 0.014730297f, 0.00683163153f, -0.164449513f,
+    -0.19398351f, 0.170667499f, -0.198331028f, -0.217569634f, -0.19444254f, -0.00371609209f,
+    -0.0413195454f, 0.120995574f, -0.0799384415f, -0.0654935166f, -0.269589722f, -0.263320893f,
+    -0.278988212f, -0.0306133255f, -0.247972772f, -0.254414588f
+  },
+  {
+    0.0100649986f, 0.111118749f, -0.0311952829f, -0.00798840262f, 0.100529037f, -0.0248092469f,
+    -0.0500639528f, 0.0954219103f, 0.067548357f, -0.0622229874f, -0.153470114f, 0.071071431f,
+    -0.0773578361f, 0.0549063906f, -0.0606069081f, 0.112491846f, 0.0491236076f, -0.03592664f,
+    0.00965626631f, 0.000561461202f, -0.17861782f, -0.0116255917f, 0.0750824511f, 0.00729986466f,
+    0.177115127f, 0.040812511f, 0.0263100155f, 0.0790828615f, 0.171554014f, 0.169197738f,
+    0.19969973f, 0.0664631352f, -0.0590102486f, -0.0216104016f, -0.00254266965f, -0.00870892033f,
+    -0.0750285089f, -0.11138279f, -0.0565478019f, 0.085134387f, 0.0290585496f, 0.136837989f,
+    0.038155444f, 0.102908604f, 0.0385117717f, -0.0181436781f
+  },
+  {
+    0.157238692f, 0.0172341969f, -0.052018594f, 0.0704177842f, 0.0971833467f, -0.0242079496f,
+    0.14287439f, 0.0945090279f, -0.143852875f, -0.131619424f, 0.0755456686f, -0.129130721f,
+    0.0736637935f, -0.111590542f, -0.00968682673f, 0.0247511752f, -0.0063074301f, 0.160482958f,
+    0.105950825f, -0.155597478f, -0.0155524146f, -0.172855854f, -0.103138395f, 0.00673025055f,
+    -0.0677175745f, -0.0386100076f, 0.00799810793f, 0.13558583f, 0.229837373f, 0.174940214f,
+    0.116227858f, 0.0409963503f, 0.103714004f, -0.092756182f, 0.018887125f, -0.0311339721f,
+    0.102421112f, 0.165673554f, 0.12890324f, -0.0117273293f, 0.115473069f, -0.0239077732f,
+    -0.110636428f, 0.150263354f, 0.113789976f, -0.0301724169f
+  },
+  {
+    -0.177408531f, 0.103806548f, -0.0971064866f, -0.0579438135f, -0.251351029f, -0.0828588828f,
+    -0.035847947f, 0.441734165f, -0.318335861f, -0.308017224f, -0.340166241f, 0.127728373f,
+    0.204743937f, 0.307398021f, -0.0123535804f, -0.0667190924f, -0.0387961455f, 0.151458547f,
+    -0.201754332f, 0.227499068f, -0.333045691f, 0.105286606f, 0.104876414f, -0.123499483f,
+    0.181111783f, 0.056116987f, 0.190056786f, 0.123358898f, -0.0414606556f, -0.0715623796f,
+    0.0124934968f, 0.0830599293f, 0.410717428f, 0.0515563153f, 0.0815037489f, -0.0587312207f,
+    0.023750985f, -0.474651664f, 0.175611496f, 0.0742266625f, 0.320433408f, 0.178415731f,
+    0.208408609f, 0.13457641f, 0.0907733515f, 0.0790312439f
+  },
+  {
+    0.297227323f, 0.493885517f, 0.0836305097f, -0.22046639f, -0.166573316f, -0.269482583f,
+    -0.376439869f, 0.925809562f, -0.996847093f, -1.10289145f, -0.392852068f, 1.06350172f,
+    0.384742737f, 0.842051148f, -0.236524001f, -0.171366945f, -0.03128995f, 0.239303142f,
+    -0.459119618f, 0.599834621f, -0.649076283f, -0.143584087f, -0.00474364683f, 0.350740135f,
+    0.433936417f, 0.201733842f, 0.284898311f, 0.0182186756f, 0.0180366915f, 0.0720362216f,
+    -0.0270666126f, -0.158463746f, 0.934978366f, 0.494064182f, -0.437913686f, -0.161661282f,
+    0.183522105f, -0.3665286f, 0.398532361f, 0.095437251f, 0.514636338f, -0.181491882f,
+    0.444052547f, -0.101136327f, 0.0444767289f, 0.0116019752f
+  },
+  {
+    0.0303886738f, -0.241969332f, -0.290599883f, -0.0277366079f, 0.125852957f, 0.213734448f,
+    0.862436235f, -0.45245418f, -0.776047349f, -0.345150471f, 0.138217643f, -0.641792536f,
+    0.0536143221f, -0.483757824f, -0.571169734f, -0.114060894f, 0.0638553575f, -0.194195524f,
+    0.202610984f, -0.210772842f, -0.095810771f, -0.0632925704f, 0.107023694f, -0.263503641f,
+    -0.100797795f, 0.224882603f, -0.351973802f, 0.0431991778f, 0.0323456563f, -0.0344218276f,
+    0.219205931f, -0.00588320429f, -0.536866248f, -0.348518968f, -0.475928426f, -0.152009681f,
+    0.107531525f, 0.280731976f, -0.377726585f, -0.00158193067f, -0.325052857f, 0.0468681864f,
+    -0.51174283f, 0.0065725306f, -0.0742640123f, 0.0933516249f
+  },
+  {
+    -0.199559689f, -0.0448090471f, -0.15024744f, 0.014240752f, -0.120868906f, 0.00620426191f,
+    -0.0932714567f, 0.00732718315f, 0.157694191f, 0.21840255f, 0.0387732945f, -0.211969972f,
+    -0.021809753f, 0.0248569809f, 0.026572926f, -0.187003061f, -0.187287748f, 0.0445776954f,
+    -0.0780221745f, -0.017952051f, 0.00899519771f, 0.0445716083f, 0.130149931f, 0.142868295f,
+    0.0464906581f, 0.00787791144f, -0.167739034f, -0.105393514f, 0.0637884811f, -0.115225941f,
+    -0.00871468708f, -0.0914794579f, 0.00217561377f, -0.067007415f, 0.0515816398f, 0.0135741169f,
+    -0.110201523f, -0.146703422f, -0.101143695f, 0.0661135837f, -0.0329995491f, -0.023343632f,
+    -0.124266542f, -0.137916118f, 0.0274642687f, -0.068872191f
+  },
+  {
+    0.101051673f, -0.0662326962f, 0.0957798958f, 0.164156899f, 0.0891068131f, -0.0916248336f,
+    0.0786928535f, -0.0571880601f, 0.026524771f, -0.132232293f, -0.00912135001f, -0.0440831557f,
+    -0.0615414158f, -0.130610839f, 0.017740069f, 0.157319799f, 0.108762272f, -0.0115370359f,
+    -0.155568987f, -0.0287582055f, -0.126026884f, 0.0292453598f, -0.213768125f, -0.0771470144f,
+    0.0384035222f, -0.0847695395f, -0.0483653657f, 0.134608313f, 0.236529976f, 0.066937767f,
+    0.0539413132f, 0.0958080143f, -0.166987434f, -0.0502028801f, -0.133002296f, -0.146211356f,
+    -0.0780405104f, -0.0774006993f, 0.0236693472f, -0.0285157915f, -0.0871456116f, 0.0380786695f,
+    0.0527573191f, 0.196906999f, 0.0771841556f, 0.0258238316f
+  },
+  {
+    -0.480616868f, 0.368562371f, 1.08811021f, -0.0311007686f, -0.353633404f, -0.214640349f,
+    0.822342694f, 1.47369742f, -1.16157746f, -0.377423406f, 0.131554395f, 0.264505863f,
+    0.834512711f, 0.990291834f, 0.479949564f, -0.0104147391f, 0.0162789151f, -0.0814743713f,
+    -0.0885984227f, 1.09313583f, -0.432768911f, 0.0630793646f, -0.04482897f, 0.0624381118f,
+    0.635851264f, -0.190756112f, 0.470797181f, 0.0588253848f, -0.000603039633f, 0.105896786f,
+    0.0782855749f, 0.564547896f, 1.04845583f, 1.3940922f, 0.202412695f, -0.278849065f,
+    -0.0114574758f, -1.45757627f, 0.622765303f, -0.251469165f, 0.302574277f, -0.753401339f,
+    0.362786353f, -0.00374723179f, -0.0029255338f, -0.00192375737f
+  },
+  {
+    -0.0879780799f, 0.606896818f, 0.428451449f, 0.133629426f, -0.144400463f, -0.0148037178f,
+    -0.584207177f, 0.928951919f, 0.565116704f, 0.269988477f, -0.200970277f, 1.03606319f,
+    0.16090259f, 1.01790309f, 0.763682127f, 0.107607521f, -0.0928042531f, 0.172174782f,
+    -0.446035415f, 0.314708918f, -0.473405123f, -0.00985567924f, -0.0630533993f, 0.191143304f,
+    0.434055299f, 0.00776760373f, 0.683736086f, -0.0588178672f, -0.00827147346f, -0.040668048f,
+    -0.231387079f, -0.26706928f, 0.775949836f, 0.548868537f, 0.563771904f, -0.105340026f,
+    0.262945324f, -0.613939166f, 0.773205101f, 0.429968148f, 0.48121357f, -0.270931244f,
+    0.738967299f, -0.0691079423f, 0.0660378858f, -0.00310050393f
+  },
+  {
+    -0.0247667246f, 0.0796420276f, -0.146251217f, 0.0156424977f, -0.201818794f, -0.209795728f,
+    0.214672565f, 0.0826472938f, 0.00534794852f, -0.110282585f, -0.0906440243f, -0.117233977f,
+    -0.133008435f, 0.184908003f, -0.0893478915f, -0.179972321f, 0.108375967f, 0.0447130054f,
+    0.0733134672f, 0.200597182f, 0.0280148238f, 0.0414322093f, 0.174341857f, 0.0436642244f,
+    -0.111816578f, -0.118166514f, 0.094376713f, -0.046119526f, -0.184692129f, 0.0264523719f,
+    0.101132609f, 0.181945264f, 0.176168919f, 0.204148531f, -0.0858890638f, -0.0958205163f,
+    -0.032223355f, -0.102771126f, 0.0852599218f, 0.107016146f, -0.0592765585f, 0.116065972f,
+    -0.0378000811f, 0.0271063074f, -0.0329414606f, -0.0335924961f
+  },
+  {
+    0.112001061f, -0.0660682395f, 0.116580218f, 0.0809559971f, 0.00501958514f, 0.0904632509f,
+    -0.267638505f, 0.170413464f, 0.281615734f, 0.4489187f, -0.249420211f, 0.10730131f,
+    -0.055417534f, 0.190101936f, 0.317660302f, 0.0240867548f, 0.181197852f, 0.043668706f,
+    0.0253026746f, 0.0754077435f, -0.0809163153f, 0.116944537f, -0.19980441f, -0.133079901f,
+    0.228389248f, -0.0770578161f, 0.066129446f, -0.0549129806f, 0.186935812f, -0.0203950871f,
+    -0.054425437f, -0.187013224f, 0.306105316f, 0.218471974f, 0.393365473f, -0.0665550306f,
+    -0.121497504f, -0.0333329737f, 0.170308366f, 0.0324206613f, 0.118846163f, -0.0044654198f,
+    0.262378842f, 0.0657057017f, -0.0348680057f, 0.125652418f
+  },
+  {
+    -0.17744115f, -0.0991378576f, 0.0268816911f, -0.0529118292f, -0.133366361f, -0.00992306694f,
+    0.00371526205f, 0.115850277f, 0.0413242988f, -0.0142011018f, 0.0577738099f, -0.000663233164f,
+    -0.0364813581f, 0.148615226f, -0.120732807f, -0.0765735954f, -0.0996495932f, -0.167741731f,
+    0.0872329026f, 0.216049746f, 0.242270023f, 0.09919177f, 0.230083629f, 0.136045009f,
+    -0.164996639f, -0.0652573407f, -0.0712581053f, -0.0427920446f, -0.0593830682f, -0.190907463f,
+    -0.132364586f, -0.0684184805f, -0.0279642101f, 0.0626166314f, -0.00639336044f, 0.203516215f,
+    -0.0663740486f, -0.0807923749f, -0.082941629f, -0.246461287f, 0.0391488262f, -0.129408449f,
+    -0.22422111f, -0.0556700155f, -0.108439051f, 0.00413971581f
+  },
+  {
+    -0.20531553f, -0.0948752239f, -0.113905825f, 0.0645902902f, -0.00594582967f, -0.0992147997f,
+    -0.186694875f, 0.156309694f, -0.023598982f, 0.0431190282f, 0.0468139425f, -0.0418460481f,
+    0.00666685542f, -0.0345028937f, -0.0886408389f, -0.196085826f, -0.1690685f, 0.0177855007f,
+    -0.0222786386f, -0.099939771f, -0.142875478f, -0.111890115f, 0.0622063987f, 0.21922873f,
+    0.0338281356f, -0.129636839f, -0.0309234001f, -0.0818182752f, 0.0289486293f, -0.0472643375f,
+    -0.170180693f, 0.188743204f, 0.114957362f, 0.194628745f, -0.0137547683f, 0.147726148f,
+    -0.056566298f, -0.0723778903f, -0.145742521f, 0.046389848f, 0.149675846f, 0.16242066f,
+    -0.0687813833f, 0.00394452969f, -0.0951795727f, -0.130458891f
+  },
+  {
+    0.00959101599f, -0.134985402f, 0.00969945267f, -0.154566512f, -0.0153747741f, -0.038585607f,
+    -0.155191943f, -0.00172645366f, 0.0376470797f, -0.108353317f, 0.126229003f, -0.130251378f,
+    0.095200263f, -0.0108405445f, 0.0709240809f, -0.0738418773f, -0.0880688354f, -0.154065013f,
+    0.0153231788f, -0.129489526f, 0.109391831f, 0.0400904976f, -0.0574517436f, 0.139037505f,
+    0.0548899807f, -0.0976012126f, 0.127954453f, -0.124626376f, -0.140342906f, -0.0638114139f,
+    0.143368438f, 0.134247214f, 0.0235501081f, 0.0337282307f, -0.158453748f, -0.0527836457f,
+    -0.0424537323f, -0.0498079881f, 0.107281446f, -0.0438814238f, -0.129591882f, 0.0864574984f,
+    -0.0923094079f, 0.0890339836f, -0.0167615525f, -0.138273597f
+  },
+  {
+    -0.0588043332f, 0.0419305861f, 0.0576000772f, 0.13892664f, -0.0641243905f, 0.204210699f,
+    -0.0216649324f, 0.025924731f, -0.181116089f, 0.041036468f, 0.205965132f, 0.0940265283f,
+    0.106132291f, -0.0287874099f, 0.118608281f, 0.0323731788f, 0.0685262233f, 0.0645483211f,
+    -0.160332531f, -0.0975915343f, -0.0472310521f, -0.150760308f, -0.144046709f, -0.059840329f,
+    0.0841434672f, 0.0514452085f, 0.149319679f, -0.0208425168f, 0.165947914f, -0.0216318555f,
+    0.0136688678f, 0.0597451925f, -0.172573403f, 0.091015771f, 0.120616719f, -0.137782425f,
+    -0.0737708732f, 0.184501633f, 0.013536158f, 0.175595269f, 0.097833477f, -0.107332267f,
+    0.0740666017f, 0.09361393f, -0.0555679314f, 0.107823819f
+  },
+  {
+    0.0541011505f, -0.134522557f, 0.126237437f, -0.154410213f, -0.0308616441f, -0.0708798394f,
+    -0.0413513109f, 0.153014243f, -0.0656727552f, -0.0147548029f, 0.0959912017f, -0.0562995858f,
+    0.00541574694f, -0.0715312511f, -0.113740623f, 0.0329676792f, -0.0260272976f, 0.0309652928f,
+    0.153665602f, 0.193783104f, -0.122899786f, 0.10275124f, 0.141515732f, 0.0187251028f,
+    0.0695824251f, 0.0242781341f, -0.0498119257f, -0.114564002f, -0.181108162f, -0.0594352782f,
+    -0.069134295f, -0.0741161704f, -0.179555163f, 0.0171700399f, 0.108481556f, -0.130607188f,
+    0.0201727618f, -0.0339724831f, -0.0108515462f, -0.152942255f, 0.0820974484f, 0.0303018447f,
+    0.0906132832f, -0.0179250464f, -0.0917628407f, -0.13986519f
+  },
+  {
+    -0.0587510802f, 0.629203975f, 0.208755866f, -0.0289891865f, -0.462171823f, -0.618284941f,
+    -0.318086177f, 0.636835217f, -0.327648908f, -0.535638034f, 0.105683021f, -0.646748841f,
+    0.647075057f, 0.875925541f, -0.172818661f, 0.0842270777f, -0.0350289419f, -0.0591748953f,
+    -0.64211911f, 0.532416046f, -0.192625865f, -0.0155288773f, 0.0660959706f, -0.0409712084f,
+    0.624311447f, -0.00831140019f, -0.0626269877f, -0.038781248f, 0.071389176f, 0.0391381942f,
+    0.149846107f, 0.259523243f, 0.653689444f, 0.504587531f, -0.244454071f, -0.0779801235f,
+    0.122316487f, -0.236676753f, 0.322322607f, -0.0992487296f, 0.34784919f, -0.477402806f,
+    -0.0100257359f, -0.0773614869f, 0.0738763735f, 0.079461351f
+  },
+  {
+    -0.0131293479f, -0.489820272f, -0.578949213f, 0.24586308f, 0.146402404f, 0.200679943f,
+    0.264112055f, -1.04007673f, 1.46117854f, 0.78076762f, 0.053256195f, -0.107452966f,
+    -0.742324412f, -0.848878026f, -0.409603387f, -0.0359474532f, -0.000508250727f, 0.0820368975f,
+    0.346135646f, -0.724977016f, 0.578139603f, -0.0497639067f, -0.0543663949f, -0.0588709973f,
+    -0.447375268f, -0.0183962174f, -0.671887159f, -0.122615919f, 0.0348005407f, -0.0942145139f,
+    -0.391174674f, -0.270636648f, -0.755352616f, -0.957268119f, -0.092319198f, 0.505260468f,
+    -0.30836603f, 0.688468099f, -0.739742875f, -0.313855261f, -0.620755851f, 0.198982656f,
+    -0.453495502f, 0.0785409585f, -0.0342008993f, -0.0212084465f
+  },
+  {
+    0.061495889f, -0.0969094336f, -0.0728759468f, -0.132236794f, 0.0094356956f, 0.0262533203f,
+    -0.137943611f, 0.10570509f, 0.130850255f, -0.0545696616f, -0.0947417393f, -0.123326987f,
+    -0.0473716445f, 0.145506933f, 0.114424586f, -0.023713002f, 0.0798081905f, -0.0484354235f,
+    0.124788344f, -0.139335439f, 0.103233732f, -0.160039887f, -0.15509975f, -0.0479987413f,
+    0.0990971923f, -0.111119039f, -0.141743585f, 0.121380031f, 0.200795338f, 0.0190166309f,
+    0.131538138f, 0.00241334434f, 0.0928683579f, -0.108229592f, 0.08625599f, -0.0393729471f,
+    0.0650962815f, 0.0477585755f, -0.109586135f, -0.0191251431f, -0.0659882724f, 0.095989421f,
+    -0.0014418721f, 0.148380995f, 0.132993296f, 0.172767565f
+  },
+  {
+    -0.419461578f, 0.502415478f, 0.160391405f, -0.248005435f, 0.0174178127f, -0.0846149996f,
+    0.153471351f, 0.352855623f, -1.12613618f, -0.653032839f, -0.313386291f, -0.0450183935f,
+    0.343311101f, 0.548981488f, 0.0339179412f, -0.0169215184f, -0.0269019287f, -0.0359498709f,
+    -0.52477777f, 0.047615353f, -0.940568268f, 0.120084971f, 0.0321556255f, 0.0352007411f,
+    0.451258034f, 0.541394174f, 0.360149264f, 0.0277439244f, -0.0281762164f, -0.096799545f,
+    -0.0471167304f, 0.166722313f, 0.546468914f, 0.34399882f, -0.167851806f, -0.808859527f,
+    0.494945943f, -0.649675727f, 0.660235882f, 0.678180814f, 0.44421488f, 0.565740764f,
+    0.544570208f, 0.140009567f, 0.143344045f, 0.382358104f
+  },
+  {
+    -0.104437359f, -0.0963922366f, -0.186989382f, 0.109301791f, 0.184752524f, 0.219224319f,
+    0.494359076f, -0.371681511f, 0.262930721f, -0.0460297167f, 0.161403596f, 0.11394228f,
+    -0.186160237f, -0.352212816f, -0.0640531555f, -0.0714955777f, 0.0372519307f, -0.0101017011f,
+    0.508190334f, -0.183413312f, 0.23192884f, 0.0486660786f, 0.0239248723f, 0.0910297111f,
+    -0.417717934f, 0.0667768642f, -0.298415303f, -0.11084374f, 0.108400255f, -0.0308662746f,
+    0.164203539f, 0.124578834f, -0.161649004f, -0.282279849f, 0.00285189133f, 0.275885165f,
+    -0.173760533f, 0.263024926f, -0.33445102f, -0.0517629683f, -0.27731216f, 0.122610398f,
+    -0.0824529007f, 0.134150535f, -0.132304162f, 0.0164243598f
+  },
+  {
+    0.0382747464f, 0.0121156741f, 0.144684702f, -0.109968744f, -0.0820828155f, -0.0546808653f,
+    0.0550920814f, -0.0958773196f, 0.102349699f, -0.128843769f, 0.0731484294f, 0.0964120924f,
+    0.0924138054f, 0.00444138469f, 0.0249424856f, -0.0174529832f, -0.109339461f, 0.0527108945f,
+    -0.0433147289f, -0.048638016f, -0.00952637475f, -0.00399822975f, 0.0964421853f, -0.134021372f,
+    0.0948521793f, -0.0748945922f, 0.0343595967f, 0.185282484f, 0.176240742f, 0.178075209f,
+    0.0562814064f, 0.131988019f, 0.0038274806f, -0.107958578f, 0.114415184f, -0.151917458f,
+    0.0020727457f, -0.0712313578f, -0.0238845963f, 0.0394733995f, -0.145274475f, -0.103577241f,
+    0.0160686579f, 0.0830199048f, 0.161098629f, -0.0293932389f
+  },
+  {
+    -0.0619281568f, -0.00704391999f, 0.149135903f, 0.0423195809f, 0.0134884166f, 0.0693926662f,
+    0.0800326541f, 0.0865324065f, -0.268404514f, -0.0294234063f, -0.110144332f, 0.154571488f,
+    -0.0820033997f, -0.0301586185f, 0.056787651f, 0.169627637f, -0.0260051861f, -0.0706635565f,
+    -0.192605942f, 0.0074749859f, -0.167669758f, -0.188307151f, -0.0576217361f, -0.147670209f,
+    0.21225664f, 0.0503281206f, 0.0136057325f, 0.168189213f, -0.0148953181f, 0.0794021115f,
+    -0.0738091245f, -0.00384815922f, 0.181163177f, -0.0415888317f, 0.0197158977f, 0.0865171105f,
+    0.0514906347f, -0.0901489854f, 0.107171461f, 0.0882189423f, -0.0841160715f, -0.075906232f,
+    -0.074777998f, -0.0292758495f, -0.0752412751f, 0.0946394205f
+  },
+  {
+    0.103993222f, 0.219743997f, 0.162319273f, -0.0732414275f, -0.148569807f, 0.131955743f,
+    -0.171828866f, 0.290310115f, 0.0251255687f, 0.520644367f, -0.071344927f, 0.183362827f,
+    0.205934018f, 0.744985759f, 0.411636412f, -0.0660718307f, -0.0512778573f, 0.0913542584f,
+    -0.44378683f, 0.0944409221f, -0.202800632f, 0.139561743f, -0.115644678f, 0.0253310315f,
+    0.302868456f, 0.158232078f, 0.44543767f, -0.0524740294f, 0.148508504f, 0.124752901f,
+    0.196038201f, -0.178807527f, 0.619468749f, 0.23382695f, 0.456364214f, 0.0086339293f,
+    0.169665083f, -0.313406706f, 0.100714445f, 0.357537985f, 0.307438076f, 0.287589222f,
+    0.605944753f, 0.10825514f, 0.214563951f, -0.135652423f
+  },
+  {
+    0.689619601f, -1.19917905f, -0.878789365f, 0.283964783f, 0.0306019951f, 0.581827998f,
+    0.830175221f, -0.965161026f, 1.69044197f, 0.0422305986f, 0.107818238f, -0.037778087f,
+    -0.702627838f, -0.997263074f, -0.131131679f, -0.137160107f, -0.0643180907f, 0.0108428895f,
+    0.745634317f, -0.189938888f, 1.36868834f, 0.117689736f, 0.0363739356f, -0.0255198777f,
+    -0.721015275f, -0.758737683f, -0.710966527f, 0.11135076f, 0.0604449771f, -0.0555677041f,
+    0.00953135639f, -0.0463718101f, -0.820292592f, -0.311215043f, 0.0413664095f, 1.08013105f,
+    -0.472900629f, 0.905089438f, -1.02795887f, -0.985456944f, -0.672973156f, -0.724549532f,
+    -0.711721182f, 0.0289223921f, -0.00681194058f, -0.0518854968f
+  },
+  {
+    0.202574089f, 0.385894746f, 0.465925515f, -0.160836697f, 0.00639571855f, 0.14102982f,
+    -1.21907246f, 0.780399978f, 0.47518f, 0.625293911f, -0.0987302586f, 0.650590241f,
+    -0.146237284f, 0.672523499f, 0.682936192f, 0.058238402f, 0.0329382122f, 0.0416209884f,
+    -0.441546321f, 0.342942715f, -0.236690924f, -0.0323599912f, -0.128519446f, 0.0317858756f,
+    0.0935627371f, -0.0140269324f, 0.451721191f, -0.0471659862f, 0.178654969f, 0.0558155105f,
+    -0.240636766f, -0.648312211f, 0.528771222f, 0.462582588f, 0.751432836f, -0.0540752783f,
+    0.0675658137f, -0.58554858f, 0.239473522f, 0.358890772f, -0.032800585f, 0.21899496f,
+    0.450140238f, -0.102201305f, -0.016070608f, 0.0371661521f
+  },
+  {
+    -0.0370505676f, 0.0132501153f, 0.219459668f, 0.0449965224f, -0.0504397564f, 0.160840437f,
+    -0.0664624199f, -0.127780616f, 0.248120919f, -0.112558506f, 0.0334728174f, 0.0669789612f,
+    0.139687017f, -0.13827683f, 0.135780558f, 0.209328219f, 0.222142652f, 0.197043896f,
+    -0.0468175597f, -0.00956378318f, 0.0244768374f, 0.00633606827f, 0.0162849817f, -0.107874863f,
+    -0.0931753516f, -0.0534645617f, -0.074644208f, 0.174343005f, -0.0451095924f, 0.189035207f,
+    -0.00414971588f, 0.018790409f, -0.248576611f, -0.208308429f, 0.068902649f, -0.058339674f,
+    0.22146149f, -0.0547134429f, 0.172889739f, -0.0530046262f, -0.00927326083f, -0.0894721672f,
+    0.118611425f, 0.191560268f, -0.00578034064f, 0.0762037933f
+  },
+  {
+    -0.0200273693f, 0.0180930141f, 0.0525908247f, -0.0470417514f, 0.0400695503f, -0.0450698547f,
+    0.500595868f, -0.414171964f, -0.323547214f, -0.072559379f, 0.144219458f, -0.106755167f,
+    -0.0664856806f, -0.363021821f, -0.151549548f, 0.0567909069f, -0.0313493796f, 0.0486097783f,
+    0.113757938f, -0.160225645f, -0.180858523f, 0.0279629175f, -0.0704258084f, -0.115211517f,
+    -0.0232626759f, -0.177293554f, -0.117477477f, 0.112957284f, -0.159402415f, 0.0516537875f,
+    -0.0927032307f, -0.0643368438f, -0.396035969f, -0.187183678f, -0.347797841f, -0.265738159f,
+    0.00167954492f, 0.168721125f, -0.0628509596f, 0.0991299227f, -0.113821335f, 0.0727631077f,
+    -0.177843124f, -0.105621904f, -0.0152389333f, -0.175688192f
+  },
+  {
+    0.0791360214f, -0.161647588f, 0.0922864899f, 0.0298846941f, -0.0924918577f, -0.0108030364f,
+    -0.0450257733f, -0.0466906577f, 0.0361527428f, 0.022616487f, -0.0847746357f, 0.0167296082f,
+    -0.18061471f, 0.290984273f, -0.0370375812f, -0.126583517f, 0.0628173128f, 0.106381118f,
+    0.0939397663f, 0.18988131f, 0.12416707f, -0.0236359295f, 0.136566862f, 0.157571763f,
+    0.0138608264f, 0.0527128428f, -0.018718306f, 0.0143837761f, -0.0509358086f, -0.208427608f,
+    -0.187266529f, 0.00655717263f, 0.254378796f, 0.0842662379f, -0.142743438f, -0.0632518381f,
+    -0.0131353904f, 0.0204341207f, 0.0974276811f, -0.0263125319f, -0.0903027281f, -0.0695543513f,
+    -0.121476799f, -0.170256227f, -0.173261687f, -0.0199624058f
+  },
+  {
+    -0.0938253254f, -0.135072052f, -0.0418430567f, -0.0848904103f, 0.0720504895f, 0.116665557f,
+    0.0084154252f, -0.264650732f, 0.0811986402f, 0.137605131f, 0.117907874f, 0.139170364f,
+    -0.0164205097f, -0.210596696f, -0.0288709179f, -0.144384459f, -0.0242414456f, -0.00326753687f,
+    0.0766358748f, 0.0365663357f, -0.0870138183f, -0.0920167267f, 0.0898043141f, -0.0457953364f,
+    -0.192120105f, 0.0343286246f, -0.145611599f, -0.127440974f, -0.143099397f, -0.123914234f,
+    -0.141168803f, 0.0757680237f, -0.0715720803f, -0.0747956261f, -0.17448999f, 0.113545142f,
+    0.00644605607f, 0.278956056f, -0.120744199f, 0.102201901f, 0.0279063601f, -0.191911235f,
+    0.0249685869f, -0.13357535f, 0.0244246274f, -0.0102579584f
+  },
+  {
+    -0.135188475f, 0.118378863f, 0.0375027657f, -0.151500911f, -0.154302493f, 0.0647098646f,
+    -0.0381765775f, 0.0574640445f, 0.0300694462f, 0.102381639f, -0.148846775f, 0.214522302f,
+    0.0114706494f, 0.160233423f, -0.0745605603f, 0.0329794958f, -0.0632254258f, -0.0211010333f,
+    0.0203096699f, -0.034219835f, 0.144341066f, 0.0589846857f, -0.0319229551f, 0.0903275236f,
+    0.0511267707f, -0.0705989674f, -0.0385519899f, -0.190005183f, 0.0320554152f, -0.0325769261f,
+    -0.208893567f, -0.101633385f, 0.271656245f, 0.135691002f, -0.0619997121f, 0.00304016843f,
+    -0.0117039923f, -0.0423349254f, 0.0584678985f, -0.133010179f, 0.20610334f, -0.0178599209f,
+    0.140873551f, -0.111826085f, -0.0662325099f, 0.132655367f
+  },
+  {
+    -0.094271943f, 0.056192372f, -0.122372895f, 0.0207148362f, 0.163646847f, 0.172994509f,
+    -0.335882962f, -0.242073938f, -0.524640739f, -0.390211165f, 0.164883524f, 0.248591959f,
+    -0.228176504f, -0.17920211f, -0.240991175f, 0.0393452756f, 0.0551865548f, 0.0764308274f,
+    0.173850775f, -0.162946835f, -0.12251813f, -0.0683290139f, 0.105117254f, 0.179082945f,
+    -0.0910253674f, -0.0567608699f, -0.168174759f, -0.0473223068f, 0.117897056f, -0.030569274f,
+    -0.0472517312f, 0.0808726475f, -0.268282443f, -0.328911781f, -0.0446166582f, -0.0352416858f,
+    -0.0377475582f, 0.2499329f, -0.171841919f, -0.166358501f, -0.0540501662f, 0.106785052f,
+    -0.301557571f, -0.122439079f, 0.127237722f, 0.107165046f
+  },
+  {
+    0.0510282181f, -0.041329693f, 0.0459846519f, -0.0283940118f, 0.057847999f, 0.0264982693f,
+    0.0491236709f, 0.153894678f, 0.0304637309f, 0.190974995f, 0.0256642513f, 0.110104412f,
+    0.000679603079f, 0.165594861f, 0.127157107f, -0.0483162589f, 0.0618480407f, 0.0333617069f,
+    -0.160312012f, -0.150074109f, -0.0734206364f, -0.163378209f, -0.142649621f, -0.0789208934f,
+    -0.0932687372f, -0.0323368721f, 0.0446494371f, 0.0541673265f, 0.00525992503f, 0.0276506934f,
+    -0.0196466185f, 0.0786034986f, -0.0801331028f, -0.0225584488f, -0.0192928668f, -0.00594523642f,
+    0.0201631766f, -0.105373219f, -0.037537545f, 0.212889433f, 0.199679732f, -0.0414506719f,
+    -0.0896536782f, 0.175357118f, 0.198887214f, 0.1003986f
+  },
+  {
+    -0.187028512f, -0.0268632006f, -0.0793786943f, 0.111420661f, 0.170066759f, 0.00340424688f,
+    -0.208803594f, -0.320967048f, 0.480958253f, 0.262940079f, 0.067939952f, 0.124426894f,
+    -0.323263377f, -0.117936745f, 0.106631264f, -0.137401968f, 0.0277649481f, -0.0256723799f,
+    0.290771395f, -0.110694416f, 0.407368213f, 0.135814875f, -0.112657778f, -0.0207729097f,
+    -0.283683836f, 0.114852697f, -0.121332169f, -0.0265942775f, 0.0541584715f, -0.0493054464f,
+    -0.107120156f, -0.106792256f, -0.0118225105f, -0.259655058f, 0.244463593f, 0.162266433f,
+    -0.0103665162f, 0.00362041313f, -0.371509314f, -0.122357488f, -0.403319657f, 0.319396943f,
+    -0.0182794947f, 0.0997423828f, -0.0972772017f, -0.0304222032f
+  },
+  {
+    0.0721968636f, -0.0937392786f, 0.0393244959f, 0.0612674132f, 0.00490506738f, 0.0600120425f,
+    -0.00087837578f, 0.0121886181f, 0.358054549f, 0.396687388f, -0.104792535f, -0.220044523f,
+    -0.0530835912f, 0.341715604f, 0.0381629542f, 0.175018787f, 0.0393461473f, -0.00558501482f,
+    -0.155025661f, 0.104840644f, 0.126974791f, -0.13332288f, -0.148702964f, 0.0903000161f,
+    0.026673859f, -0.011481382f, -0.0526539385f, -0.117668413f, 0.178334296f, 0.0660102963f,
+    -0.0457264148f, 0.0211944133f, 0.0884317234f, 0.19170785f, 0.0908308551f, 0.00276031578f,
+    -0.0187232736f, -0.0806087106f, 0.0761465132f, 0.0858686119f, 0.21799317f, -0.0478993058f,
+    0.0343753919f, -0.134335399f, 0.0340916477f, 0.0840140581f
+  },
+  {
+    0.0580494404f, 0.0687926486f, 0.126162976f, 0.0435138308f, -0.0488228649f, 0.156972721f,
+    -0.0648071691f, 0.0537925251f, -0.011704064f, 0.0349630602f, 0.0713044927f, 0.196314394f,
+    0.115374357f, -0.00526663056f, 0.0264193434f, 0.0644217581f, 0.148327783f, -0.111901358f,
+    0.108945511f, 0.0212901514f, 0.149315879f, -0.088617444f, -0.194263518f, -0.163997248f,
+    0.00409591058f, 0.155404106f, 0.106506333f, 0.0122660575f, 0.0569800101f, 0.00814951584f,
+    0.160026193f, -0.144744501f, 0.0170802176f, 0.145153001f, -0.0310541578f, -0.116748668f,
+    0.0253687631f, 0.0891204551f, 0.072561793f, -0.0469006561f, -0.0814289823f, -0.0177132636f,
+    0.157819554f, 0.169564575f, 0.0962058529f, 0.183325484f
+  },
+  {
+    -0.0778905451f, -0.0183113255f, -0.226688281f, 0.234026194f, -0.0219288841f, 0.12302465f,
+    0.614592969f, -0.31230548f, -0.129545152f, 0.0205525383f, 0.263438612f, -0.475217998f,
+    0.0607548393f, -0.390579611f, -0.396967173f, 0.1265257f, -0.147761062f, -0.173050269f,
+    0.0723583698f, -0.39364481f, 0.327405453f, 0.00715355296f, 0.127630949f, 0.0673074052f,
+    -0.170910716f, -0.041112639f, -0.218486682f, 0.0849280804f, -0.106913134f, -0.163787156f,
+    -0.0438232608f, 0.213174343f, -0.325580448f, -0.403074563f, -0.506795764f, -0.0869252607f,
+    -0.0971757993f, 0.115704902f, -0.159578025f, -0.212386698f, -0.131997153f, 0.0567183569f,
+    -0.388751984f, 0.0833938867f, -0.05784408f, -0.139780074f
+  },
+  {
+    -0.0741556957f, 0.0110566244f, -0.145415142f, -0.0253254343f, -0.218579277f, -0.0562964194f,
+    -0.0572697669f, -0.00267408183f, -0.0427636243f, -0.210062191f, 0.00986636709f, 0.246198535f,
+    -0.0201329701f, 0.185516596f, -0.000997001305f, 0.146382511f, -0.00978116412f, 0.11506594f,
+    -0.0205123313f, -0.12635541f, -0.202663034f, -0.141719088f, 0.0999450162f, -0.0366757736f,
+    0.0282724183f, 0.180933312f, -0.033507999f, 0.0786597207f, 0.0791779906f, 0.0469729155f,
+    -0.032445062f, -0.160095692f, 0.135360703f, 0.156236663f, 0.0806894973f, -0.0832203925f,
+    0.078420192f, -0.223905489f, -0.0203687865f, 0.0467701107f, 0.187422752f, -0.0361216255f,
+    0.16360341f, 0.123729989f, 0.0239786375f, 0.109480403f
+  },
+  {
+    0.00314783677f, -0.050215967f, 0.15490678f, 0.068874523f, -0.13006781f, 0.0837881193f,
+    0.0415085778f, -0.00692679361f, 0.0142744081f, -0.108906254f, 0.00928183459f, 0.0651312023f,
+    0.106750377f, 0.079670012f, -0.124916449f, -0.174745649f, -0.131612405f, -0.0506635755f,
+    -0.156105652f, 0.105003096f, 0.149033338f, 0.198343053f, 0.0586736426f, 0.130167648f,
+    -0.0931085274f, -0.0905413926f, 0.117781885f, -0.134454146f, -0.118498459f, -0.171309561f,
+    -0.0545936376f, -0.0549387522f, -0.0137190931f, 0.108471133f, -0.0333252735f, 0.0370682925f,
+    -0.132320598f, 0.0931743309f, 0.00370996492f, 0.0913143456f, 0.0591778569f, -0.106011726f,
+    -0.0500485525f, -0.0956715271f, -0.0161589738f, 0.102491803f
+  },
+  {
+    0.184060112f, -0.0691346154f, -0.0196406618f, -0.121620245f, -0.291058928f, 0.0137114329f,
+    0.621437013f, 0.318227649f, 0.0368217155f, -0.31312862f, -0.118381374f, 0.13613385f,
+    0.356134951f, 0.609683692f, 0.152710184f, -0.026749922f, 0.121374086f, 0.0319750793f,
+    -0.0843599811f, 0.246163473f, -0.0185536798f, -0.00400356902f, -0.0664176717f, -0.0747381747f,
+    0.256379247f, -0.0986214578f, 0.143682197f, -0.0271505006f, 0.12463893f, -0.0550209805f,
+    0.180969372f, 0.0923510864f, 0.543840468f, 0.206131086f, 0.107794613f, 0.143966675f,
+    -0.13930355f, -0.140692458f, 0.213988408f, 0.160949051f, 0.287535429f, -0.0614890456f,
+    0.273793995f, -0.153983727f, -0.00715935882f, 0.0659171864f
+  },
+  {
+    -0.0947717875f, -0.208204299f, -0.0469079763f, 0.249367401f, 0.35948056f, 0.367291749f,
+    0.210646048f, -0.452595025f, -0.268507749f, 0.0636886507f, 0.0308310036f, -0.440330058f,
+    -0.122856051f, -0.560070753f, -0.377229303f, 0.125051111f, 0.187464952f, -0.147456959f,
+    0.321738273f, -0.259715647f, 0.190886095f, 0.140567258f, 0.124784909f, -0.159582213f,
+    -0.402476519f, 0.123383015f, -0.388667971f, 0.0616077483f, 0.00407932047f, -0.0553789549f,
+    -0.0599138662f, 0.201576024f, -0.441504031f, -0.497885942f, -0.153712466f, -0.031913057f,
+    -0.043110013f, 0.0340154283f, -0.159319401f, 0.00112359494f, -0.254995912f, 0.243461251f,
+    -0.248440489f, -0.0693274736f, -0.0605163462f, -0.0753687099f
+  },
+  {
+    -0.12677747f, 0.822180927f, 0.647787631f, -0.225336403f, -0.238504529f, -0.406718761f,
+    -0.924164414f, 1.18628871f, -0.725678623f, 0.157964289f, -0.512570739f, 0.474791974f,
+    0.427684397f, 1.17832255f, 0.26458773f, -0.0713931248f, -0.0466694385f, 0.00177267659f,
+    -0.65446949f, 0.67217797f, -0.583938956f, 0.0499638058f, -0.0526014343f, -0.117390126f,
+    0.614470124f, 0.033463411f, 0.581289113f, 0.0826780871f, -0.0652447119f, 0.0592260323f,
+    -0.145529181f, -0.122538872f, 1.08737361f, 1.03092241f, 0.215771526f, -0.0953519419f,
+    0.139719784f, -0.691697121f, 0.776826441f, 0.366504967f, 0.365513593f, -0.369837433f,
+    0.41598466f, -0.00893066917f, 0.116382249f, -0.0662552342f
+  },
+  {
+    -0.131499007f, -0.11244873f, -0.040069446f, -0.0426634662f, -0.151161805f, -0.163034126f,
+    0.0801164806f, -0.0834075287f, 0.218626425f, 0.06474033f, -0.0558626391f, 0.0591991097f,
+    -0.188068911f, -0.0175087657f, 0.000640758546f, -0.207695752f, -0.100934148f, 0.059868332f,
+    -0.0910308212f, -0.0760973021f, 0.0152476383f, 0.0964477137f, 0.191997424f, -0.0504901223f,
+    0.0349063165f, -0.208316341f, -0.122288972f, -0.0294928513f, 0.0056153792f, 0.00511953328f,
+    -0.0590678565f, -0.0579185411f, -0.104368031f, 0.0969905928f, 0.0361004621f, 0.0271827169f,
+    -0.115447856f, 0.0658238754f, 0.00840986427f, 0.00587678468f, 0.00252889399f, -0.169741049f,
+    0.062652342f, 0.0288988352f, -0.119575582f, -0.0483644977f
+  },
+  {
+    -0.156043187f, 0.113041565f, 0.109675311f, 0.0567734204f, 0.0289751031f, 0.236872911f,
+    -0.314986855f, -0.350584835f, -0.269611388f, 0.0919968113f, 0.012436768f, -0.0394815914f,
+    -0.222674027f, -0.431360662f, -0.18118833f, 0.15035744f, 0.0884239003f, 0.0670020282f,
+    -0.0475739799f, -0.266554713f, 0.203656271f, 0.113275833f, 0.0972176418f, 0.128355637f,
+    -0.240234807f, -0.149061218f, -0.0324459895f, 0.0862733051f, 0.0443868041f, 0.0688480213f,
+    -0.081169337f, -0.0259025544f, -0.239546403f, -0.148710743f, 0.0102529023f, -0.162945077f,
+    0.117652714f, 0.0516323783f, -0.11861255f, -0.189238384f, -0.205522686f, 0.0100996774f,
+    -0.254577726f, -0.0371490903f, -0.110963359f, -0.0996435508f
+  },
+  {
+    0.00555119989f, 0.162440985f, 0.11809478f, 0.0771508887f, -0.139800891f, -0.0203031991f,
+    0.108670101f, 0.268957347f, 0.320390284f, 0.389603972f, -0.059848588f, 0.152242318f,
+    0.181716248f, 0.326663733f, 0.499701262f, -0.0868246257f, 0.101733819f, 0.0628415346f,
+    -0.233726606f, 0.182366714f, -0.0467795953f, -0.0142075075f, -0.0624952167f, -0.107430078f,
+    0.295943558f, 0.18011187f, 0.2242807f, -0.123637207f, -0.0678193644f, 0.096857436f,
+    0.27006647f, 0.0405327268f, 0.489296257f, 0.339731663f, 0.348929942f, 0.17533049f,
+    0.170240447f, -0.147338897f, 0.20468311f, 0.252942741f, 0.206607044f, 0.214917451f,
+    0.213864625f, 0.145293638f, 0.0548144951f, 0.123781338f
+  }
+};
+
+constexpr float kHiddenBias[192] = {
+  -0.361481249f, 0.653161407f, -0.000444329839f, 0.78740716f, -0.0760916024f, 0.0809449852f,
+  -0.0551746339f, -0.0867613107f, -0.0776011199f, 0.00993671734f, -0.0217069481f, -0.00831646379f,
+  0.278246671f, -0.206584454f, -0.0507190153f, 0.0228208937f, 0.0714788213f, -0.390829831f,
+  -0.308671445f, -0.0637667626f, 0.0603879243f, 0.188357756f, 0.0790203363f, 0.0917498693f,
+  0.137805238f, 0.0683835f, -0.139710411f, -0.0991699398f, -0.00510821724f, -0.0625981688f,
+  0.173212782f, 0.0296606328f, -0.421092302f, -0.227009326f, -0.358001918f, 0.130727753f,
+  -0.0714415461f, 0.999091864f, 0.594130814f, 0.0575155579f, 0.221189201f, -0.228659362f,
+  1.09702945f, 0.890352964f, 0.235408768f, 0.0602663644f, -0.0241108332f, 0.214634046f,
+  0.0451928824f, -0.0545908324f, 0.22054483f, -0.437660605f, -0.213364512f, 0.227772534f,
+  -0.0647710413f, -0.0605065189f, -0.0778798237f, 0.144430548f, -0.0361416563f, -0.0860065073f,
+  0.0615651533f, 0.0537214465f, 0.115888819f, -0.890392005f, -0.0216320343f, -0.578451157f,
+  0.409225285f, 0.0903681964f, -0.0731896907f, 0.0235607196f, 0.0576430298f, 0.0209842138f,
+  -0.101778209f, 0.162195519f, -0.350332588f, -0.0421654135f, -0.0820678696f, 0.0458303764f,
+  -0.960655153f, 0.321809083f, -0.538394034f, -0.675464272f, -0.0853468254f, 0.0662965402f,
+  -0.0352266803f, 0.119794726f, -0.00507405913f, 0.0489580743f, -0.00184317236f, -0.100331537f,
+  0.353473008f, 0.0744271204f, -0.207390383f, 0.165984347f, 0.754133761f, -0.634826481f,
+  0.0242031366f, -0.106838614f, -0.0253048223f, -0.0342583023f, 0.0391968451f, -0.0578015596f,
+  0.136594176f, 0.0541324764f, 0.236967668f, -0.0433279797f, 0.226756468f, 0.00475729397f,
+  -0.0540013351f, 0.049255494f, -0.0788802654f, -0.764766097f, 0.010660409f, -0.167959198f,
+  -0.417597204f, 0.0541496016f, -0.108587421f, -0.245106995f, 0.05549144f, -0.379912198f,
+  -0.0310327318f, -0.177573994f, -0.0225289278f, -0.331816167f, 0.00749769574f, 0.162201613f,
+  -0.0695575848f, -0.204008251f, -0.0353039876f, -0.0761059448f, 0.0027587926f, -0.0951853022f,
+  -0.0591882952f, 0.169189677f, 0.0741361305f, 0.0265128128f, 0.26442945f, -0.916440547f,
+  0.0711355805f, 0.0793359429f, 0.161375761f, -0.0766380131f, -0.307011753f, 0.0521143191f,
+  0.0421441235f, 0.111877888f, 0.0771587044f, 0.0524283685f, 0.018727446f, -0.276950449f,
+  -0.536455989f, 0.284344822f, -0.0584902316f, 0.0178028177f, -1.44956362f, -0.605003953f,
+  -0.0572333634f, -0.135591239f, -0.085019663f, -0.0736111924f, -0.000937532925f, 0.0532792583f,
+  -0.024046462f, -0.435079455f, 0.829864442f, 0.00392106129f, -0.554717779f, 0.190492466f,
+  0.0021963208f, -0.026639495f, -0.23511751f, 0.858604133f, -0.390789926f, 0.0940633491f,
+  0.162791967f, -0.0805324167f, 0.0546641536f, -0.0701177269f, 0.131666154f, 0.0169084575f,
+  0.135478601f, -0.0513336286f, -0.0607199483f, 0.259061664f, -0.108240344f, -0.00923746638f,
+  -0.201907814f, 0.215253472f, -0.965677857f, -0.0345325395f, 0.176113769f, -0.184226915f
+};
+
+constexpr float kOutputWeights[2][192] = {
+  {
+    -0.120163575f, 0.154972106f, 0.0774205253f, 1.12086153f, 0.0230651367f, 0.104336925f,
+    -0.108523376f, 0.000591080054f, -0.126819298f, -0.0496424995f, 0.122372769f, 0.0317080915f,
+    0.183071584f, -0.0906407684f, -0.0248256493f, 0.0362546295f, 0.101423398f, -0.304746717f,
+    -0.165903836f, -0.0725528821f, 0.0808507949f, 0.125589043f, 0.101905569f, 0.0949821845f,
+    0.0584748425f, 0.147868946f, -0.0696251169f, -0.163543418f, -0.111453258f, 0.115991697f,
+    0.0124963606f, -0.023789376f, -0.17835632f, -0.0486399457f, -0.352093667f, 0.0742217153f,
+    -0.144055188f, 0.670372844f, 0.261442155f, -0.0448468886f, 0.120644853f, -0.222740158f,
+    0.972833395f, 1.03984249f, 0.201063111f, -0.0946446434f, -0.0378922708f, 0.189910308f,
+    0.0481991582f, 0.151717022f, 0.0879276469f, 0.0106342817f, -0.0899228677f, 0.252047658f,
+    0.0689858496f, 0.100447319f, -0.144255906f, 0.211074591f, 0.00745824445f, 0.121428959f,
+    0.101246096f, 0.057261873f, -0.0139333252f, -0.171023339f, 0.037441317f, -0.559390366f,
+    -0.0453153998f, 0.0668594539f, -0.00521107204f, -0.099276565f, -0.00715626776f, 0.00336488523f,
+    -0.134598315f, 0.104222201f, -0.399825335f, 0.0464387648f, -0.0483113043f, -0.0466186889f,
+    -0.0938550979f, 0.0825310722f, -0.545815885f, -0.267727494f, -0.0292555857f, 0.044670824f,
+    0.0105829351f, 0.0907271653f, 0.014382829f, -0.106449202f, 0.10175921f, -0.0168775618f,
+    0.0160776824f, 0.150030762f, 0.0172905568f, 0.116090573f, 0.921443045f, -0.172136366f,
+    -0.0162694231f, -0.243425027f, 0.0390431881f, -0.0174452513f, -0.0862038285f, -0.169023901f,
+    -0.110658534f, -0.0905815661f, 0.163768321f, 0.0410334803f, 0.136623859f, -0.034458939f,
+    -0.0438110009f, 0.131873831f, 0.0537585095f, -0.206861973f, -0.159973502f, -0.177369669f,
+    -0.473503292f, 0.129425421f, -0.0605634041f, -0.0119393552f, 0.0401303358f, -0.17711404f,
+    0.0345275067f, 0.00528870663f, -0.056313049f, -0.210890904f, 0.143335208f, 0.270801485f,
+    0.117720716f, -0.141106382f, 0.076109089f, 0.0459940583f, -0.126295596f, -0.0265516657f,
+    -0.325269938f, 0.167812675f, 0.073887974f, 0.0462385789f, 0.156669006f, -0.116262637f,
+    0.0749200508f, 0.101617791f, -0.00771258958f, 0.203980431f, -0.121263489f, -0.149523109f,
+    -0.0651055425f, 0.0772620365f, 0.0500320978f, -0.0959094316f, 0.141978323f, 0.0404952466f,
+    -0.016638428f, 0.171865016f, 0.0302331652f, 0.0247441456f, -0.0348399654f, -0.621762812f,
+    -0.0511627235f, -0.0148624247f, -0.11489284f, -0.111516841f, -0.102951482f, 0.017082952f,
+    -0.182769597f, -0.255722851f, 0.49888593f, -0.0501842424f, 0.0348943956f, 0.0340881459f,
+    -0.146507859f, -0.151646987f, 0.0584700182f, 0.429147214f, -0.167241931f, 0.0904799849f,
+    0.040625833f, -0.0991836935f, 0.0862244815f, 0.0142089548f, 0.0769485608f, 0.121466033f,
+    0.2063272f, -0.0454077534f, -0.0693015084f, 0.0766083002f, -0.187883615f, -0.111613363f,
+    -0.0612448603f, 0.315175921f, 0.0721223429f, 0.102493584f, 0.0880403891f, -0.189960182f
+  },
+  {
+    0.264523327f, -0.339582324f, 0.160114452f, -0.931374907f, 0.112971336f, 0.110550418f,
+    -0.121736638f, 0.0771574974f, -0.0143962419f, -0.0418916233f, -0.00334271486f, 0.100742862f,
+    -0.00164540973f, 0.0553819351f, -0.0463146567f, -0.0160193164f, -0.0665779337f, 0.337067276f,
+    0.186796978f, -0.0312422235f, -0.0875061601f, 0.0641983226f, 0.100727238f, -0.0650038719f,
+    -0.184700131f, -0.131824106f, 0.222949654f, 0.17741251f, 0.0676158145f, 0.0331657566f,
+    -0.122267149f, -0.053724993f, -0.0214908812f, 0.209883615f, 0.304334104f, -0.165100679f,
+    0.0394649468f, -0.791202366f, -0.430665106f, 0.0849174932f, -0.0356134996f, 0.240956202f,
+    -0.947664976f, -1.3150382f, -0.00407832954f, -0.102860361f, 0.168122679f, -0.195230424f,
+    -0.00638780277f, 0.154631272f, -0.258826673f, 0.242485672f, 0.0901869759f, -0.133779943f,
+    -0.0187339056f, 0.0832529962f, -0.141312301f, -0.218573019f, 0.0442306399f, 0.0754091069f,
+    -0.118415758f, -0.07948374f, -0.0856127813f, 0.44458726f, 0.0672409832f, 0.577519119f,
+    -0.167037517f, -0.0674016327f, -0.0452699251f, 0.0542723499f, 0.183924332f, -0.101582535f,
+    -0.10861025f, 0.0588878095f, 0.454502314f, 0.0595444478f, 0.0116005121f, -0.0903697833f,
+    0.0722527951f, -0.0812559277f, 0.62008357f, 0.188561723f, 0.0498889014f, 0.0958263651f,
+    0.108529195f, -0.120469801f, 0.148846f, 0.155239999f, -0.0316586345f, 0.134758979f,
+    -0.23034668f, -0.137357891f, 0.183707803f, -0.00425301353f, -0.64710933f, 0.117136538f,
+    -0.0317426659f, 0.176070735f, 0.000144959849f, 0.0227933377f, 0.119710922f, -0.107628644f,
+    -0.142955765f, -0.0789707229f, -0.151783556f, 0.118227705f, -0.173430339f, -0.0403225794f,
+    -0.0914420709f, -0.11948479f, 0.0109252669f, 0.0284407027f, -0.124135092f, 0.067781277f,
+    0.310112655f, -0.119133197f, 0.157647863f, 0.199684992f, 0.0218720753f, 0.176841497f,
+    0.0508585311f, 0.164696455f, 0.142519578f, -0.0336628295f, 0.178699359f, -0.0133832609f,
+    0.0493872352f, 0.174758613f, 0.189420074f, -0.0201553889f, -0.106359936f, -0.0558564626f,
+    0.170129955f, 0.00610578852f, -0.0872268453f, -0.0538583882f, -0.0781284943f, 0.165637776f,
+    0.025213467f, 0.0259946845f, -0.198058918f, 0.124705642f, 0.0254351497f, 0.0705661625f,
+    0.175956488f, -0.0800491422f, -0.0932750329f, 0.0171004348f, -0.130012438f, 0.187269837f,
+    0.207909852f, -0.234445214f, 0.121726513f, -0.141611129f, 0.16607672f, 0.830283523f,
+    0.00362944906f, 0.187427357f, -0.119180486f, -0.0836677402f, -0.138685241f, -0.122210912f,
+    -0.134540901f, -0.0442278422f, -0.587861836f, -0.114882126f, 0.221034989f, -0.0753268003f,
+    -0.118331395f, 0.10544394f, 0.197171748f, -0.401157916f, 0.209666699f, -0.0747830048f,
+    -0.050602518f, -0.00385075645f, -0.132309258f, -0.0214929413f, -0.0698716491f, 0.186074764f,
+    -0.0656687319f, 0.0797135904f, 0.191044137f, -0.177875251f, -0.00391768338f, 0.0451795384f,
+    0.196490422f, -0.403870493f, 0.23726429f, 0.15965499f, -0.101036005f, 0.134141386f
+  }
+};
+
+constexpr float kOutputBias[2] = {
+  -0.026345456f, 0.026345415f
+};
+
+/**
+* @brief  infer(): Run the model on the features
+*
+* @param const float in[]: The features of the signal.
+* @param float out[]: The two outputs of the model (no fall, fall).
+* @return void
+*
+**/
+inline void infer(const float in[kInputs], float out[kOutputs]) {
+  // FULLY_CONNECTED and LOGISTIC
+  float hidden[kHidden];
+  for (int o = 0; o < kHidden; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kInputs; d++) {
+      total += in[d] * kHiddenWeights[o][d];
+    }
+    hidden[o] = 1.f / (1.f + std::exp(-(total + kHiddenBias[o])));
+  }
+
+  // FULLY_CONNECTED
+  float logits[kOutputs];
+  for (int o = 0; o < kOutputs; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kHidden; d++) {
+      total += hidden[d] * kOutputWeights[o][d];
+    }
+    logits[o] = total + kOutputBias[o];
+  }
+
+  // SOFTMAX with beta 1
+  float max_coeff = logits[0];
+  for (int i = 1; i < kOutputs; i++) {
+    if (logits[i] > max_coeff) max_coeff = logits[i];
+  }
+  float exp_sum = 0.0;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] = std::exp((logits[i] - max_coeff) * 1.0f);
+    exp_sum += out[i];
+  }
+  float reciprocal_sum_exp = 1.f / exp_sum;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] *= reciprocal_sum_exp;
+  }
+}
+
+}  // namespace fall_model_f46_2_aot
+
+#endif  // FALL_MODEL_F46_2_AOT_H_
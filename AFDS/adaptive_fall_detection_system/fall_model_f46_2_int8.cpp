@@ -0,0 +1,1036 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_2_int8.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    The int8 quantized version of the model f46_2, in a C byte array form
+  *
+  *
+  *
+  *
+**/
+
+// Generated from the float model with the host tool:
+// quantize_model --out adaptive_fall_detection_system f46_2
+
+#include "fall_model_f46_2_int8.h"
+
+// We need to keep the data array aligned on some architectures.
+#ifdef __has_attribute
+#define HAVE_ATTRIBUTE(x) __has_attribute(x)
+#else
+#define HAVE_ATTRIBUTE(x) 0
+#endif
+#if HAVE_ATTRIBUTE(aligned) || (defined(__GNUC__) && !defined(__clang__))
+#define DATA_ALIGN_ATTRIBUTE __attribute__((aligned(16)))
+#else
+#define DATA_ALIGN_ATTRIBUTE
+#endif
+
+const unsigned char fall_model_2_int8_data[] DATA_ALIGN_ATTRIBUTE = {
+  0x24, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb0, 0x2e, 0x00, 0x00, 0xa4, 0x2e, 0x00, 0x00,
+  0xa0, 0x0b, 0x00, 0x00, 0x2c, 0x08, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
+  0x6c, 0x07, 0x00, 0x00, 0x24, 0x07, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00,
+  0xf8, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00,
+  0xc4, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x51, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x62, 0x79,
+  0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x58, 0x2d, 0x00, 0x00, 0x50, 0x0a, 0x00, 0x00,
+  0xec, 0x06, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x4c, 0x06, 0x00, 0x00,
+  0x08, 0x06, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00,
+  0x44, 0x03, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19,
+  0xd6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xde, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x72,
+  0xfa, 0xff, 0xff, 0xff, 0x00, 0x0e, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x66, 0x65, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x00, 0x00,
+  0xe6, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0xa5, 0xf7, 0xeb, 0x3e, 0x08, 0x8d, 0x8b, 0x3f, 0xe0, 0x5e, 0x1f, 0x3f,
+  0x57, 0xa6, 0xc7, 0x42, 0x6c, 0xc3, 0x50, 0x42, 0xbd, 0x77, 0x59, 0x42,
+  0xf6, 0x14, 0x52, 0x3f, 0xa0, 0xd7, 0x7e, 0x3f, 0x9a, 0xa4, 0x4a, 0x3f,
+  0xf7, 0x60, 0xfe, 0x40, 0xb3, 0xcd, 0x86, 0x41, 0xda, 0x60, 0x7c, 0x40,
+  0x00, 0x6c, 0x50, 0x40, 0x00, 0xf0, 0x71, 0x3f, 0x00, 0x4c, 0x2d, 0x40,
+  0xe6, 0x1a, 0x87, 0x43, 0x00, 0xe2, 0x6e, 0x43, 0x00, 0xfe, 0x7d, 0x43,
+  0xcf, 0x56, 0x72, 0x40, 0x00, 0xc4, 0xea, 0x40, 0x00, 0xbc, 0x61, 0x40,
+  0x00, 0x00, 0x80, 0x43, 0xf5, 0x1b, 0x62, 0x43, 0x00, 0x00, 0x80, 0x43,
+  0xf3, 0xab, 0x93, 0x40, 0x00, 0x81, 0x04, 0x41, 0x00, 0x84, 0xc7, 0x40,
+  0x00, 0xff, 0xfe, 0x43, 0x00, 0xe5, 0xb2, 0x43, 0x00, 0xff, 0xfe, 0x43,
+  0x00, 0x78, 0xfa, 0x3f, 0x67, 0xb7, 0xf0, 0x3f, 0x55, 0x65, 0x60, 0x3f,
+  0xab, 0xa6, 0xdf, 0x40, 0x55, 0x6d, 0x21, 0x40, 0x55, 0xfd, 0x4d, 0x40,
+  0x79, 0x97, 0xee, 0x40, 0x4b, 0xba, 0x2d, 0x3f, 0x29, 0xdb, 0x8e, 0x3f,
+  0x33, 0xbb, 0x1c, 0x40, 0x4b, 0x8f, 0x4b, 0x40, 0x00, 0xd8, 0xde, 0x40,
+  0x00, 0xcc, 0x64, 0x40, 0x00, 0xff, 0xfe, 0x43, 0x00, 0x7c, 0x9e, 0x43,
+  0x00, 0x47, 0x9f, 0x43, 0xae, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xd2, 0xf6, 0xff, 0xff,
+  0x00, 0x00, 0x80, 0x3f, 0x5a, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x30, 0xd4, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdc, 0xd4, 0xff, 0xff,
+  0x4c, 0xfc, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x64, 0x65, 0x6e,
+  0x74, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0xd5, 0xff, 0xff,
+  0x7c, 0xfc, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x44, 0xd5, 0xff, 0xff, 0xba, 0xd5, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb4, 0xd5, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x35, 0xbf, 0x1e, 0x3d, 0xa4, 0xd5, 0xff, 0xff, 0x1a, 0xd6, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0xd6, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x79, 0xa6, 0x29, 0x38, 0x06, 0xf9, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x75, 0xfd, 0xff, 0xff,
+  0x8b, 0x02, 0x00, 0x00, 0x82, 0xd6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x7c, 0xd6, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x79, 0xa6, 0x29, 0x3c,
+  0x76, 0xf9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0xf4, 0x0f, 0x07, 0x6c, 0x02, 0x0a, 0xf6, 0x00, 0xf4, 0xfb, 0x0c, 0x03,
+  0x12, 0xf7, 0xfe, 0x04, 0x0a, 0xe3, 0xf0, 0xf9, 0x08, 0x0c, 0x0a, 0x09,
+  0x06, 0x0e, 0xf9, 0xf0, 0xf5, 0x0b, 0x01, 0xfe, 0xef, 0xfb, 0xde, 0x07,
+  0xf2, 0x41, 0x19, 0xfc, 0x0c, 0xea, 0x5e, 0x64, 0x13, 0xf7, 0xfc, 0x12,
+  0x05, 0x0f, 0x08, 0x01, 0xf7, 0x18, 0x07, 0x0a, 0xf2, 0x14, 0x01, 0x0c,
+  0x0a, 0x06, 0xff, 0xef, 0x04, 0xca, 0xfc, 0x06, 0xff, 0xf6, 0xff, 0x00,
+  0xf3, 0x0a, 0xd9, 0x04, 0xfb, 0xfb, 0xf7, 0x08, 0xcb, 0xe6, 0xfd, 0x04,
+  0x01, 0x09, 0x01, 0xf6, 0x0a, 0xfe, 0x02, 0x0e, 0x02, 0x0b, 0x59, 0xef,
+  0xfe, 0xe8, 0x04, 0xfe, 0xf8, 0xf0, 0xf5, 0xf7, 0x10, 0x04, 0x0d, 0xfd,
+  0xfc, 0x0d, 0x05, 0xec, 0xf1, 0xef, 0xd2, 0x0c, 0xfa, 0xff, 0x04, 0xef,
+  0x03, 0x01, 0xfb, 0xec, 0x0e, 0x1a, 0x0b, 0xf2, 0x07, 0x04, 0xf4, 0xfd,
+  0xe1, 0x10, 0x07, 0x04, 0x0f, 0xf5, 0x07, 0x0a, 0xff, 0x14, 0xf4, 0xf2,
+  0xfa, 0x07, 0x05, 0xf7, 0x0e, 0x04, 0xfe, 0x11, 0x03, 0x02, 0xfd, 0xc4,
+  0xfb, 0xff, 0xf5, 0xf5, 0xf6, 0x02, 0xee, 0xe7, 0x30, 0xfb, 0x03, 0x03,
+  0xf2, 0xf1, 0x06, 0x29, 0xf0, 0x09, 0x04, 0xf6, 0x08, 0x01, 0x07, 0x0c,
+  0x14, 0xfc, 0xf9, 0x07, 0xee, 0xf5, 0xfa, 0x1e, 0x07, 0x0a, 0x09, 0xee,
+  0x1a, 0xdf, 0x0f, 0xa6, 0x0b, 0x0b, 0xf4, 0x07, 0xff, 0xfc, 0x00, 0x0a,
+  0x00, 0x05, 0xfc, 0xfe, 0xfa, 0x21, 0x12, 0xfd, 0xf8, 0x06, 0x0a, 0xfa,
+  0xee, 0xf3, 0x16, 0x11, 0x07, 0x03, 0xf4, 0xfb, 0xfe, 0x14, 0x1d, 0xf0,
+  0x04, 0xb4, 0xd6, 0x08, 0xfd, 0x17, 0xa4, 0x81, 0x00, 0xf6, 0x10, 0xed,
+  0xff, 0x0f, 0xe7, 0x17, 0x09, 0xf3, 0xfe, 0x08, 0xf2, 0xeb, 0x04, 0x07,
+  0xf5, 0xf8, 0xf8, 0x2b, 0x06, 0x38, 0xf0, 0xf9, 0xfc, 0x05, 0x12, 0xf6,
+  0xf6, 0x06, 0x2c, 0x06, 0x01, 0xf7, 0x07, 0xf8, 0x3c, 0x12, 0x05, 0x09,
+  0x0a, 0xf4, 0x0e, 0x0f, 0xfd, 0x0d, 0xea, 0xf3, 0x12, 0x00, 0xc2, 0x0b,
+  0xfd, 0x11, 0x00, 0x02, 0x0c, 0xf6, 0xf2, 0xf8, 0xf1, 0x0b, 0xef, 0xfc,
+  0xf7, 0xf4, 0x01, 0x03, 0xf4, 0x07, 0x1e, 0xf4, 0x0f, 0x13, 0x02, 0x11,
+  0x05, 0x10, 0x0e, 0xfd, 0x11, 0xff, 0x05, 0x11, 0x12, 0xfe, 0xf6, 0xfb,
+  0x10, 0x01, 0xf8, 0xfb, 0xf8, 0x10, 0x02, 0x03, 0xed, 0x0c, 0x02, 0x07,
+  0x11, 0xf8, 0xf7, 0x02, 0xf3, 0x12, 0x14, 0xe9, 0x0c, 0xf2, 0x10, 0x50,
+  0x00, 0x12, 0xf4, 0xf8, 0xf3, 0xf4, 0xf3, 0xfc, 0xc7, 0xf5, 0x15, 0xf9,
+  0xf5, 0x0a, 0x13, 0xd9, 0x14, 0xf9, 0xfb, 0x00, 0xf3, 0xfe, 0xf9, 0x12,
+  0xfa, 0x08, 0x12, 0xef, 0x00, 0x04, 0x13, 0xd9, 0x17, 0x0f, 0xf6, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x6c, 0xd8, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3b, 0x5c, 0xd8, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
+  0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x73,
+  0x69, 0x67, 0x6d, 0x6f, 0x69, 0x64, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x90, 0xd8, 0xff, 0xff,
+  0x0c, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xd4, 0xd8, 0xff, 0xff, 0x4a, 0xd9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x44, 0xd9, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x4c, 0x50, 0x7a, 0x40, 0x34, 0xd9, 0xff, 0xff, 0xaa, 0xd9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x9c, 0xd9, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x61, 0x00, 0x3c, 0x96, 0xfc, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xd2, 0xff, 0xff, 0xff,
+  0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+  0xf6, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0xe6, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xee, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+  0xd2, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0xe3, 0xff, 0xff, 0xff, 0x8c, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xfd, 0xff, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0xc8, 0xff, 0xff, 0xff,
+  0xe5, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00,
+  0xfb, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0xff,
+  0xfd, 0xff, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff,
+  0x15, 0x00, 0x00, 0x00, 0xd3, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+  0xf6, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff,
+  0x29, 0x00, 0x00, 0x00, 0xbb, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0xf2, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+  0x05, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
+  0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0x06, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0xeb, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff,
+  0x07, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
+  0x07, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+  0xe9, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff,
+  0xe6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+  0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff,
+  0xd9, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xdd, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff,
+  0x24, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+  0x47, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
+  0xef, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff,
+  0xc8, 0xff, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb9, 0xff, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfd, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00,
+  0xce, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0xf6, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff,
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00,
+  0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff,
+  0x1b, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+  0x16, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x0a, 0xdd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68,
+  0x74, 0x73, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x04, 0xdd, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x43, 0xc1, 0x7f, 0x3f, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf5, 0xf6, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff,
+  0x02, 0x01, 0x01, 0x21, 0x13, 0xdf, 0x00, 0x01, 0x01, 0xfe, 0x3f, 0xdc,
+  0x03, 0x01, 0x00, 0x1d, 0xfa, 0xf5, 0x01, 0x00, 0x00, 0x05, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xe6, 0xf9, 0xf3, 0x00, 0xff,
+  0x00, 0xfe, 0x06, 0x0a, 0x00, 0xff, 0x00, 0xff, 0xfc, 0x00, 0xfe, 0xff,
+  0xfe, 0x05, 0xd2, 0x1c, 0x01, 0xfc, 0x02, 0xdb, 0xd2, 0x14, 0xfe, 0xff,
+  0xfd, 0xd6, 0x2e, 0xeb, 0xff, 0x00, 0xff, 0xfa, 0xfe, 0x00, 0xfe, 0x00,
+  0xff, 0x00, 0xff, 0x01, 0xfe, 0x05, 0xe3, 0x04, 0x00, 0x00, 0x00, 0x11,
+  0xfa, 0x09, 0x00, 0x00, 0xff, 0xfd, 0x00, 0xfe, 0x00, 0x00, 0xff, 0xe1,
+  0xea, 0x26, 0x00, 0xff, 0xff, 0xee, 0x12, 0xe0, 0x00, 0x00, 0x00, 0x4d,
+  0xf6, 0x13, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x2b, 0xe1, 0x28, 0x00, 0xff, 0xff, 0x0b, 0x08, 0x10,
+  0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x10,
+  0x02, 0xfd, 0x01, 0x03, 0xff, 0xf7, 0xfe, 0x00, 0xfe, 0xfc, 0xf7, 0xcb,
+  0x00, 0x00, 0xff, 0xf9, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x02,
+  0xff, 0x06, 0x05, 0x14, 0x00, 0x00, 0x00, 0xfd, 0xf6, 0x01, 0x00, 0x00,
+  0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x0f, 0xdf, 0x00, 0x01,
+  0x00, 0x0b, 0x1e, 0x0f, 0x00, 0x00, 0x01, 0x00, 0xfe, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0xc6, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0xe0, 0xeb, 0x09, 0x00, 0xff, 0x00, 0x25,
+  0x1d, 0x18, 0x00, 0xff, 0x00, 0xd8, 0x31, 0xc9, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xeb, 0xcb,
+  0x00, 0x00, 0x00, 0x02, 0xfc, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0xf3, 0xde, 0x01, 0x00, 0x01, 0x16, 0x0b, 0x0d,
+  0xff, 0x00, 0x00, 0xd1, 0xea, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa1, 0xf1, 0x04, 0x00, 0x00,
+  0x00, 0xf4, 0xfc, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0xea, 0x1d, 0xdb, 0x00, 0x00, 0x01, 0x2e, 0xfb, 0xf9, 0x01, 0x01,
+  0x00, 0x41, 0xec, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xb8, 0xef, 0xe0, 0x00, 0x00, 0x00, 0xfe,
+  0xfa, 0xfb, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0xd6, 0x17, 0x00, 0x01, 0x00, 0x15, 0x11, 0x16, 0x00, 0xff, 0x00, 0xb6,
+  0xec, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xf8, 0x04, 0xcf, 0x00, 0x00, 0x00, 0x10, 0x06, 0xfd,
+  0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x24, 0x2e, 0x16,
+  0x00, 0x00, 0x00, 0xf2, 0xd2, 0xef, 0x00, 0x01, 0x01, 0x56, 0x24, 0x05,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0xed, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0xf8, 0xf7, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xde, 0x00, 0x00,
+  0x00, 0xf6, 0x15, 0xea, 0x00, 0xff, 0x00, 0xc9, 0xc5, 0xc6, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xbf, 0xfe, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x08, 0x00, 0x00, 0x00, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x02, 0x00, 0x01, 0x00, 0xe8,
+  0xfa, 0xea, 0x00, 0x00, 0x01, 0x56, 0x1c, 0xe7, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x1c, 0x28,
+  0x00, 0x00, 0x00, 0x18, 0x02, 0x13, 0x00, 0x00, 0x01, 0x03, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0x04, 0x0c, 0xe9, 0x01, 0xff, 0x00, 0xf3, 0xee, 0x09,
+  0xff, 0x00, 0x00, 0xb1, 0x1c, 0x27, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xb5, 0xdf, 0xeb, 0x00, 0x00,
+  0x00, 0xef, 0xfa, 0xf5, 0x00, 0x00, 0x00, 0xfd, 0xfe, 0x01, 0x00, 0x00,
+  0x00, 0x30, 0x0d, 0xf6, 0x00, 0x01, 0x00, 0xf6, 0x13, 0x20, 0x00, 0xff,
+  0x01, 0xf4, 0x22, 0xcc, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x48, 0x33, 0x29, 0x00, 0x00, 0x00, 0xf1,
+  0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xe1,
+  0xd2, 0xd5, 0x00, 0x00, 0x00, 0x0d, 0xf9, 0x21, 0x00, 0xff, 0x00, 0xee,
+  0xcb, 0xac, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xfa, 0xeb, 0xe9, 0x00, 0x00, 0x00, 0xfa, 0x03, 0x08,
+  0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x00, 0x00, 0x00, 0x3a, 0x25, 0x35,
+  0x00, 0x01, 0x00, 0xf1, 0xde, 0xdc, 0x00, 0x00, 0x00, 0x26, 0x39, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0x0d, 0x07, 0x00, 0x00, 0x00, 0xf1, 0x02, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xf7, 0xfd, 0xed, 0x01, 0x00,
+  0x00, 0x14, 0x04, 0x1b, 0x00, 0x00, 0xff, 0xd9, 0xee, 0x0c, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xb9,
+  0x08, 0xbf, 0x00, 0x00, 0x00, 0xdd, 0xf8, 0xed, 0x00, 0x01, 0xff, 0xfb,
+  0xfb, 0xff, 0x02, 0x01, 0x00, 0xe2, 0x02, 0xf3, 0xfe, 0x03, 0xfd, 0xec,
+  0xf7, 0xe3, 0x03, 0x00, 0x03, 0xfc, 0xf5, 0x04, 0x00, 0x00, 0x01, 0x05,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0xfd, 0x02, 0x2b, 0xf5, 0x02,
+  0x00, 0x00, 0x00, 0xec, 0xf7, 0xea, 0xff, 0x01, 0x00, 0xfd, 0xf9, 0x03,
+  0x00, 0x01, 0x02, 0xd1, 0x0c, 0x1e, 0xfe, 0x04, 0xff, 0x04, 0xe6, 0x3f,
+  0x01, 0xfe, 0x03, 0x37, 0xe4, 0x1f, 0x00, 0x00, 0x01, 0x04, 0x02, 0xff,
+  0x02, 0x00, 0x01, 0x00, 0x01, 0xfc, 0x02, 0x02, 0x0e, 0xfb, 0x00, 0x00,
+  0x00, 0x06, 0xfc, 0xf7, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x1a, 0xcb, 0x00, 0x00, 0x01, 0x1a, 0x2f, 0xe6, 0x00, 0xff,
+  0xff, 0xd6, 0xe1, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xe3, 0xce, 0xc9, 0x00, 0x00, 0x00, 0x08,
+  0x01, 0x0a, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x00, 0x00, 0x00, 0xf7,
+  0xde, 0x0c, 0x00, 0xff, 0x00, 0x2a, 0xf6, 0xf1, 0xff, 0x00, 0xff, 0xe2,
+  0xe7, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xbd, 0xbb, 0x15, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x01,
+  0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0xff, 0x00, 0xff, 0xdb, 0x18, 0x02,
+  0x01, 0x00, 0x00, 0x15, 0xf6, 0xf8, 0x00, 0x00, 0xff, 0xdc, 0x27, 0x18,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0xff, 0x15, 0xb2, 0xba, 0x00, 0x00, 0x00, 0x12, 0x04, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2c, 0xfb, 0x00, 0x01,
+  0x00, 0xf0, 0xd1, 0xd1, 0x00, 0x01, 0x01, 0xf9, 0x18, 0x66, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x68,
+  0x10, 0x23, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xf4, 0xff, 0xff, 0x00, 0xf0,
+  0xf2, 0x11, 0x01, 0x00, 0x01, 0x24, 0x28, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x03, 0x07,
+  0x00, 0x00, 0x00, 0xfb, 0x02, 0x07, 0x00, 0x00, 0x00, 0xfd, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0xe9, 0xd9, 0x00, 0xff, 0x00, 0x08, 0x15, 0x15,
+  0xff, 0xfe, 0xff, 0x57, 0xf1, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0xcc, 0x1b, 0x00, 0x00,
+  0x00, 0xfb, 0x02, 0x06, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x29, 0x09, 0xf5, 0x00, 0x00, 0x00, 0xdd, 0xd3, 0xf4, 0x00, 0xff,
+  0x01, 0x58, 0x3a, 0x35, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x01, 0x34, 0x14, 0x30, 0x00, 0x00, 0x00, 0xfa,
+  0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x0a,
+  0xe4, 0x22, 0x00, 0x02, 0x00, 0x17, 0x02, 0xd5, 0x01, 0x00, 0x01, 0xde,
+  0x2f, 0xdc, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x5f, 0x2e, 0xeb, 0x00, 0x00, 0x00, 0xf9, 0xf7, 0xfc,
+  0x00, 0x00, 0x00, 0xff, 0xfe, 0xfe, 0x01, 0x00, 0x00, 0xda, 0x08, 0xe2,
+  0x00, 0x01, 0xff, 0xfb, 0xe5, 0xda, 0x01, 0x01, 0x01, 0xe2, 0xeb, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0xca, 0x1e, 0x14, 0x00, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2c, 0xfc, 0x00, 0x00,
+  0x00, 0x10, 0xe3, 0x0b, 0x00, 0x00, 0x01, 0x15, 0x2f, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe6,
+  0x10, 0x0c, 0x00, 0x00, 0x00, 0xeb, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0xff, 0x00, 0x00, 0xe3, 0xe2, 0xd2, 0x01, 0x01, 0x00, 0xfd,
+  0x19, 0x11, 0x00, 0xff, 0x00, 0xdc, 0xf7, 0xc7, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1c, 0xc5, 0xeb,
+  0x00, 0x00, 0x00, 0x0b, 0xfb, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff,
+  0x00, 0x00, 0xff, 0xfb, 0xe2, 0xcd, 0x00, 0xff, 0x00, 0xe9, 0xf3, 0x27,
+  0xff, 0xfe, 0xff, 0x12, 0xdd, 0x98, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x09, 0xc6, 0xd3, 0x00, 0x00,
+  0x00, 0x0a, 0xfd, 0xf7, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0xfc, 0xe1, 0x03, 0x01, 0x00, 0x00, 0xee, 0x11, 0x1d, 0x00, 0xff,
+  0xff, 0xee, 0xcc, 0x23, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0xed, 0xe3, 0xca, 0x00, 0x01, 0x00, 0xf5,
+  0xf7, 0xef, 0xff, 0x01, 0xff, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0xfd,
+  0x08, 0x12, 0xfe, 0x02, 0xfd, 0x06, 0xf9, 0xe5, 0x02, 0x04, 0x04, 0x40,
+  0xd6, 0xe3, 0x00, 0x00, 0x01, 0x04, 0x00, 0xfe, 0x01, 0x00, 0x01, 0x01,
+  0x02, 0x01, 0x01, 0xe5, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x02, 0xf5, 0x06,
+  0x00, 0x00, 0x00, 0x04, 0xfd, 0x01, 0x00, 0x00, 0x01, 0xd4, 0x09, 0x0e,
+  0xff, 0x02, 0xff, 0x18, 0xfc, 0xf7, 0x01, 0x01, 0x02, 0xe4, 0x28, 0x27,
+  0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+  0x01, 0x3b, 0x2f, 0x06, 0x00, 0x00, 0x00, 0xf0, 0xf1, 0xed, 0x00, 0x00,
+  0x00, 0x01, 0xfe, 0xff, 0x02, 0x01, 0x01, 0xfb, 0x03, 0x10, 0xff, 0x01,
+  0xfe, 0x1a, 0xf1, 0xed, 0x02, 0x04, 0x02, 0x2f, 0xd7, 0xd3, 0x00, 0x00,
+  0x01, 0x03, 0x00, 0xff, 0x02, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x1b,
+  0x3e, 0x2e, 0x00, 0x00, 0x00, 0x0a, 0xf9, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0xff, 0x00, 0xff, 0xd9, 0xdb, 0xe7, 0x01, 0x00, 0x00, 0x0a,
+  0x13, 0x10, 0xff, 0x00, 0xff, 0x4d, 0x28, 0xf4, 0x00, 0x00, 0x00, 0xfe,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xdc, 0xda, 0xf8,
+  0x00, 0x00, 0x00, 0xf1, 0xfd, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xfd, 0x01,
+  0x01, 0x00, 0x01, 0x10, 0xfc, 0x0b, 0x00, 0x01, 0x01, 0x3a, 0x15, 0xf6,
+  0x00, 0x00, 0x00, 0x34, 0xde, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xdf, 0xdf, 0xfe, 0x00, 0xff,
+  0x00, 0x0d, 0x05, 0x11, 0x01, 0xff, 0x00, 0xfe, 0x02, 0xfe, 0xfe, 0xff,
+  0xff, 0xf2, 0x18, 0xde, 0x02, 0xfd, 0x02, 0x0f, 0xe2, 0x1f, 0xfd, 0xfc,
+  0xfd, 0x14, 0xd7, 0x2d, 0x00, 0x00, 0xff, 0xf8, 0xff, 0x01, 0xfd, 0x00,
+  0xff, 0xff, 0xfe, 0x00, 0xff, 0x03, 0x06, 0x09, 0x00, 0x00, 0x00, 0x18,
+  0xfc, 0x09, 0x01, 0xff, 0x00, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0f,
+  0x00, 0x1b, 0x01, 0xfd, 0x00, 0xfd, 0xf7, 0xe5, 0xfe, 0xfc, 0xfd, 0xf8,
+  0xe5, 0xd8, 0x00, 0x00, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0x00, 0xff, 0xff,
+  0xfe, 0xfe, 0xff, 0xf5, 0x06, 0xf8, 0x00, 0x00, 0x00, 0xfb, 0xfd, 0x05,
+  0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x23, 0x23, 0x06,
+  0x00, 0x00, 0x00, 0xd3, 0x0a, 0xd7, 0x00, 0x00, 0x01, 0x22, 0x38, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xf3, 0x3e, 0x09, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x00,
+  0x01, 0x05, 0xff, 0x00, 0xff, 0x00, 0x01, 0xfd, 0x19, 0xdc, 0x00, 0x00,
+  0x01, 0xf5, 0xe8, 0x21, 0x00, 0xfe, 0x00, 0xbc, 0x20, 0x2a, 0x00, 0x00,
+  0x00, 0xfe, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf,
+  0xe7, 0xcb, 0x00, 0x00, 0x00, 0x09, 0xf4, 0xf7, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x01, 0x00, 0x00, 0x04, 0x09, 0xdd, 0xff, 0x01, 0xff, 0xee,
+  0x21, 0x0e, 0x01, 0x02, 0x01, 0x3b, 0xdf, 0x0c, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x14, 0x29,
+  0x00, 0xff, 0x00, 0x01, 0x01, 0x05, 0x00, 0xff, 0x01, 0xfc, 0x05, 0x01,
+  0xff, 0xff, 0x00, 0x14, 0xf8, 0x23, 0x02, 0x02, 0x03, 0xef, 0x06, 0xde,
+  0xfe, 0xfa, 0xfb, 0xdf, 0x0c, 0xc3, 0x00, 0x00, 0xff, 0xfe, 0x01, 0x03,
+  0xfc, 0x01, 0xff, 0xfe, 0xfe, 0xfa, 0xfe, 0x09, 0x02, 0xf0, 0x00, 0xff,
+  0xff, 0x11, 0x06, 0x0e, 0x00, 0xff, 0xff, 0x01, 0x01, 0xff, 0xfe, 0xff,
+  0xfe, 0x0b, 0x0d, 0x06, 0x01, 0xfc, 0x02, 0xf4, 0xf6, 0xff, 0xfe, 0xfd,
+  0xfd, 0xdf, 0xe9, 0xec, 0xff, 0x00, 0xff, 0xf8, 0xfe, 0x00, 0xff, 0x00,
+  0xff, 0xff, 0xff, 0x02, 0xff, 0x05, 0x06, 0x05, 0x00, 0x00, 0x00, 0xf9,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x04, 0xff, 0x00, 0x00, 0xf3,
+  0xf2, 0x16, 0x00, 0xfe, 0x01, 0x1e, 0xe2, 0x1a, 0xff, 0xff, 0xff, 0xc0,
+  0x10, 0x20, 0xff, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0xff, 0x44, 0xee, 0x23, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x09, 0x01,
+  0x00, 0x00, 0x00, 0xef, 0x12, 0xcd, 0x00, 0x00, 0x01, 0x5d, 0x3e, 0x57,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xe9, 0xf0, 0xf3, 0x00, 0x00, 0x00, 0xfc, 0xfb, 0x09, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x01, 0x01, 0x00, 0x00, 0xe6, 0x25, 0x11, 0x00, 0x00,
+  0x00, 0x1b, 0x14, 0x0e, 0x01, 0x00, 0x01, 0x2c, 0x45, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+  0xf3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x00, 0xfd,
+  0x03, 0xff, 0xff, 0x00, 0xff, 0xca, 0xf0, 0x10, 0x00, 0xfe, 0x00, 0xe2,
+  0x0f, 0xf4, 0xfe, 0xff, 0x00, 0x21, 0x11, 0xf1, 0x00, 0x00, 0x00, 0xfe,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x2b, 0x0b, 0xd3,
+  0x00, 0x00, 0x00, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0x1e, 0x11, 0x00, 0xff, 0xff, 0xe5, 0xee, 0xcc,
+  0x00, 0x01, 0xff, 0x29, 0x46, 0x45, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x23, 0xf2, 0x00, 0x00,
+  0x00, 0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0xc7, 0xec, 0x03, 0x00, 0x01, 0x00, 0xf3, 0x0b, 0x17, 0xff, 0x00,
+  0x01, 0x98, 0x21, 0xe3, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0xd6, 0x21, 0x00, 0x00, 0x00, 0x0e,
+  0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x00, 0x00, 0xff, 0xeb,
+  0xfd, 0x05, 0x01, 0xff, 0x00, 0xe9, 0x11, 0xef, 0xff, 0xfe, 0x00, 0x29,
+  0xc2, 0xca, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xa0, 0x04, 0xe9, 0x00, 0x00, 0x00, 0xe7, 0xfb, 0xed,
+  0x00, 0x01, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x02, 0x11, 0x07, 0x04,
+  0xff, 0x03, 0x00, 0xe1, 0x01, 0x03, 0x02, 0x02, 0x02, 0xbb, 0x10, 0x22,
+  0x00, 0x00, 0x01, 0x06, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x1b, 0xfd, 0xf2, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfc, 0x00, 0x00,
+  0x00, 0x05, 0xfe, 0x01, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x1c, 0x00, 0x00,
+  0xff, 0x16, 0xe1, 0xe2, 0x01, 0x01, 0x02, 0xcf, 0x18, 0x4b, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x43,
+  0x20, 0xe5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfc,
+  0x02, 0x00, 0xff, 0x00, 0xff, 0xec, 0xfc, 0xf9, 0x00, 0xff, 0x00, 0xf1,
+  0x14, 0x03, 0x00, 0x00, 0xfd, 0x22, 0xbe, 0x16, 0x00, 0x00, 0x00, 0xfe,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x09, 0xd2, 0x08,
+  0x00, 0x00, 0x00, 0xf2, 0xfb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xe5, 0xf5, 0xff, 0x00, 0x01, 0x25, 0xfe, 0x16,
+  0x00, 0x01, 0x00, 0xa0, 0x0a, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0x11, 0x1c, 0x00, 0x00,
+  0x00, 0x08, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00,
+  0xff, 0xcd, 0xed, 0xff, 0x00, 0xff, 0x00, 0x1d, 0xfb, 0xf1, 0xff, 0xff,
+  0xff, 0xa0, 0xf2, 0xa4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0xe9, 0xd7, 0xdd, 0x00, 0x00, 0x00, 0x01,
+  0xfb, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x0f,
+  0xd7, 0x16, 0x00, 0x01, 0x00, 0x31, 0x0d, 0xeb, 0x00, 0x01, 0xff, 0x01,
+  0xf2, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x9e, 0xd9, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+  0x00, 0x00, 0x00, 0xfc, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xcd, 0x11, 0xd6,
+  0x01, 0xfe, 0x00, 0xe7, 0x13, 0xcf, 0xff, 0xff, 0xff, 0x16, 0x1d, 0xeb,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+  0xff, 0x28, 0xde, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x18, 0x00, 0x00,
+  0x01, 0x2a, 0x2f, 0xfc, 0x00, 0xff, 0x00, 0xa9, 0xb8, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6,
+  0x18, 0x04, 0x00, 0x00, 0x00, 0xee, 0xf9, 0xf3, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xed, 0x04, 0xda, 0x00, 0x01, 0x00, 0x17,
+  0x15, 0x05, 0xff, 0x00, 0x00, 0xac, 0x0b, 0xd1, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x8e, 0xb4, 0xcf,
+  0x00, 0x00, 0x00, 0x11, 0x07, 0x09, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xe8, 0x1d, 0x00, 0x00, 0x00, 0xcd, 0xeb, 0x14,
+  0x00, 0x00, 0xff, 0x07, 0x17, 0x4d, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1b, 0x3c, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0xfb, 0x0a, 0xe8, 0x00, 0x01, 0x00, 0xe6, 0x03, 0x28, 0xff, 0xfe,
+  0x01, 0xff, 0xfb, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0xff, 0x00, 0xff, 0xf8,
+  0xd8, 0xde, 0x01, 0xff, 0x00, 0x0d, 0xf0, 0xe5, 0x00, 0xff, 0xfe, 0x47,
+  0xe0, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf1, 0xf2, 0xf9, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xe9,
+  0x01, 0x01, 0x00, 0x08, 0x0c, 0xff, 0x01, 0x01, 0x01, 0x14, 0x46, 0xd7,
+  0x00, 0x02, 0x01, 0x36, 0x22, 0xde, 0x01, 0x00, 0x01, 0x07, 0xd2, 0x23,
+  0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0xff, 0x00, 0x00, 0x01, 0xff,
+  0x00, 0x10, 0xf3, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xea, 0xd1, 0xcb, 0x00, 0x01,
+  0x00, 0x2a, 0x1d, 0x1f, 0x00, 0xff, 0x00, 0x8d, 0xcb, 0x10, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98,
+  0x0b, 0x10, 0x00, 0x01, 0x00, 0xed, 0xf4, 0xf5, 0x00, 0x01, 0xff, 0xf8,
+  0x00, 0x05, 0x02, 0x01, 0xff, 0xd8, 0xe6, 0x16, 0xff, 0x05, 0xfd, 0xcd,
+  0x0d, 0x31, 0x02, 0x00, 0x03, 0xe3, 0x13, 0x1d, 0x00, 0x00, 0x01, 0x04,
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0x02, 0xe8, 0x18, 0x1b,
+  0x00, 0x00, 0x00, 0x19, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x02, 0x03, 0x01,
+  0xfe, 0xff, 0xff, 0xdf, 0x0c, 0xf7, 0x01, 0xfd, 0x01, 0x1c, 0xf1, 0x02,
+  0xfe, 0xfe, 0xfe, 0x1e, 0x1c, 0xfa, 0xff, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xdc, 0xc3, 0x00, 0x00,
+  0x00, 0x01, 0xf7, 0x0c, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00,
+  0x00, 0xdc, 0xf2, 0xf8, 0x00, 0x01, 0x01, 0x05, 0x20, 0x18, 0xff, 0x01,
+  0xff, 0xad, 0xdb, 0x24, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xf7, 0xe9, 0x00, 0x00, 0x00, 0xfd,
+  0x02, 0xff, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xf1,
+  0xd8, 0x13, 0x01, 0x01, 0x00, 0x1c, 0x22, 0x1f, 0xff, 0x00, 0xff, 0x11,
+  0xc3, 0x91, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xbd, 0xec, 0xe0, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0xf4,
+  0x00, 0x00, 0x00, 0xda, 0xe7, 0xf1, 0x00, 0x01, 0x00, 0x10, 0x37, 0x62,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x52, 0xf0, 0xef, 0x00, 0x00, 0x00, 0x15, 0x0a, 0xfe, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x29, 0x04, 0xf3, 0x00, 0x00,
+  0x00, 0xcc, 0x11, 0xdc, 0x00, 0x00, 0x00, 0x07, 0x38, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+  0x23, 0x36, 0x00, 0x00, 0x00, 0x09, 0x09, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x16, 0x00, 0x00, 0x00, 0xc7,
+  0xd2, 0xd0, 0x00, 0xff, 0x00, 0x13, 0x2f, 0x48, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0x09, 0x33,
+  0x00, 0x00, 0x00, 0xf4, 0xf4, 0xfa, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0xd1, 0xfd, 0xe9, 0x00, 0x00, 0x00, 0x34, 0x3b, 0xfb,
+  0x00, 0x00, 0xff, 0x8b, 0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xf7, 0xc9, 0x00, 0x00,
+  0x00, 0x0a, 0xf8, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x00, 0x00,
+  0xff, 0x13, 0xf9, 0x0c, 0x01, 0xff, 0x00, 0xfe, 0xef, 0x2e, 0xff, 0x00,
+  0xfe, 0x43, 0xd2, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xc7, 0xe7, 0xda, 0x00, 0x00, 0x00, 0xf0,
+  0xf0, 0xf7, 0x00, 0x01, 0x00, 0xfc, 0xfe, 0xfd, 0x01, 0x01, 0x00, 0xe4,
+  0x09, 0xdb, 0xff, 0x04, 0xff, 0xd9, 0x1a, 0xd5, 0x01, 0xff, 0x02, 0xd9,
+  0x01, 0xfb, 0x00, 0x00, 0x01, 0x04, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x01, 0xfd, 0x00, 0x37, 0x2f, 0xf1, 0x00, 0x00, 0x00, 0xf4, 0xfa, 0xfb,
+  0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x14, 0xfd, 0xf9,
+  0x00, 0xff, 0x01, 0xf7, 0x07, 0x23, 0x00, 0xff, 0xff, 0x9f, 0xba, 0xe4,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x29, 0xf7, 0xda, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00,
+  0x00, 0xff, 0xfe, 0x01, 0x00, 0x00, 0x00, 0xcd, 0xe4, 0xc4, 0x00, 0x00,
+  0x01, 0x16, 0x07, 0x0b, 0xff, 0xfe, 0x00, 0x95, 0xf7, 0xbe, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xc8,
+  0xf0, 0x09, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x0a, 0x00, 0x00, 0x00, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1f, 0xf8, 0x00, 0xff, 0x00, 0xca,
+  0xfd, 0xce, 0x00, 0x00, 0x01, 0x5a, 0x05, 0x63, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x14, 0x45,
+  0x00, 0x01, 0x00, 0xee, 0x03, 0xf6, 0xff, 0x01, 0x00, 0x01, 0xff, 0xff,
+  0x02, 0x01, 0x01, 0x13, 0xe6, 0xf7, 0xfe, 0x04, 0xfe, 0xee, 0x14, 0x08,
+  0x03, 0x04, 0x03, 0xe3, 0x10, 0x32, 0x01, 0x00, 0x01, 0x08, 0x00, 0xff,
+  0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x01, 0xf7, 0x11, 0xf4, 0x00, 0x00,
+  0x00, 0x15, 0x07, 0x01, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xfc, 0xe2, 0x0e, 0x01, 0x00, 0x01, 0xeb, 0x1c, 0xf3, 0xff, 0xff,
+  0xff, 0xfe, 0xe9, 0x20, 0x00, 0x00, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0xfe, 0x05, 0xd9, 0xee, 0x00, 0x00, 0x00, 0xfa,
+  0xf0, 0xf7, 0x01, 0x01, 0x01, 0x02, 0xff, 0x00, 0x02, 0x01, 0x03, 0x13,
+  0x1a, 0x0d, 0xff, 0x03, 0x01, 0x39, 0x0a, 0x07, 0x03, 0x01, 0x03, 0x11,
+  0xe4, 0x3e, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+  0x02, 0x00, 0x02, 0xdb, 0x18, 0xf0, 0x00, 0x01, 0x00, 0x0b, 0x04, 0xf6,
+  0x00, 0x01, 0x00, 0x06, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x16, 0x10, 0xdb,
+  0xff, 0xfe, 0x00, 0x47, 0x17, 0xd1, 0x01, 0x03, 0x01, 0x20, 0xfb, 0x18,
+  0x00, 0x00, 0x01, 0x02, 0x01, 0xff, 0x02, 0xff, 0x00, 0x01, 0x01, 0x03,
+  0x01, 0xb8, 0xf4, 0xe2, 0x00, 0x00, 0x00, 0xf6, 0xfa, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0xfa, 0xd3, 0x00, 0x01,
+  0x00, 0x1b, 0x14, 0x1b, 0xff, 0x00, 0xff, 0x91, 0x18, 0xd7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa2,
+  0xf9, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x19, 0x00, 0xff, 0x00, 0x1c,
+  0xe8, 0xdc, 0x00, 0x00, 0x00, 0x15, 0x2b, 0x34, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0xda,
+  0x00, 0x00, 0x00, 0xff, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x0b, 0x24, 0xff, 0xff, 0x00, 0xcd, 0xf1, 0xe5,
+  0x01, 0x00, 0x00, 0x41, 0x26, 0xd5, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x44, 0xe5, 0x36, 0x00, 0x00,
+  0x00, 0x17, 0xfb, 0x08, 0x00, 0x00, 0x00, 0xff, 0x03, 0xff, 0x01, 0x00,
+  0x00, 0x2a, 0x1d, 0xdb, 0x00, 0x00, 0x00, 0xfc, 0xe9, 0xe2, 0x00, 0x00,
+  0x01, 0x3d, 0x36, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x4e, 0x15, 0xe6, 0x00, 0x00, 0x00, 0x0e,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x01, 0xec,
+  0x0b, 0x20, 0xff, 0x00, 0x00, 0xf4, 0xe2, 0xdd, 0x00, 0x01, 0x00, 0x37,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x00, 0x56, 0x1d, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x04,
+  0x00, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x00, 0x00, 0x21, 0x06, 0x35,
+  0x00, 0x00, 0xff, 0xe5, 0xe1, 0x01, 0x01, 0x00, 0x01, 0x0c, 0x0f, 0x45,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x34, 0x2b, 0xe1, 0x00, 0x00, 0x00, 0x06, 0xff, 0xf7, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xd5, 0xf0, 0x01, 0x00,
+  0x01, 0xe8, 0x2b, 0x2c, 0x00, 0xff, 0xff, 0x3b, 0xbc, 0xbb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb3,
+  0x0d, 0x11, 0x00, 0x00, 0x00, 0xfb, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xfd, 0x01, 0x00, 0x00, 0x00, 0x23, 0xf9, 0x07, 0xff, 0x00, 0x00, 0x00,
+  0x06, 0xec, 0x00, 0xff, 0x01, 0x5d, 0x1f, 0x42, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0c, 0xf9, 0x35,
+  0x00, 0x00, 0x00, 0x03, 0x0e, 0x07, 0x00, 0x00, 0x01, 0x04, 0x01, 0x01,
+  0xff, 0xff, 0x01, 0x2f, 0xf5, 0x2d, 0x01, 0xfd, 0x01, 0x0a, 0xf5, 0x3c,
+  0xff, 0x01, 0xff, 0xed, 0xff, 0x22, 0x00, 0x00, 0xff, 0xfd, 0x02, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0xff, 0x10, 0xcd, 0xf9, 0x00, 0x00,
+  0x00, 0xf6, 0xf8, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0xdf, 0x01, 0x01, 0x00, 0x0c, 0xf0, 0x05, 0xff, 0x00,
+  0x01, 0xc9, 0xc3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xb5, 0xc8, 0xf0, 0x00, 0x00, 0x00, 0x01,
+  0xf7, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x00, 0x02, 0x01, 0x01, 0x01, 0x07,
+  0x1b, 0x13, 0xff, 0x03, 0x00, 0x20, 0xe1, 0xf5, 0x00, 0x01, 0x02, 0x0f,
+  0x03, 0x0b, 0x00, 0xff, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xc9, 0x09, 0xf7, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x1f,
+  0x00, 0xff, 0x00, 0xe3, 0xf9, 0x06, 0x01, 0x00, 0x00, 0xf4, 0x5c, 0x0d,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x50, 0x0d, 0x15, 0x00, 0xff, 0x00, 0x12, 0x11, 0x11, 0x01, 0xff,
+  0x00, 0x00, 0x06, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0x0b, 0xf6, 0x02, 0xfd,
+  0x02, 0x0d, 0xfa, 0x0e, 0xfd, 0xff, 0xfc, 0x04, 0xec, 0x05, 0x00, 0x00,
+  0xff, 0xfb, 0xff, 0x01, 0xfe, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0x0b,
+  0x01, 0x08, 0x00, 0x00, 0x00, 0xec, 0xf4, 0xef, 0x00, 0x01, 0xff, 0x00,
+  0xff, 0x00, 0x02, 0x01, 0x00, 0x11, 0x10, 0x01, 0x01, 0x04, 0x00, 0xf9,
+  0x12, 0xec, 0x01, 0xff, 0x02, 0xf5, 0xf8, 0xea, 0x00, 0x01, 0x01, 0x07,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x28, 0x01, 0x1d,
+  0x00, 0x00, 0x00, 0xed, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0xff, 0x00, 0x00, 0xd9, 0x01, 0xdb, 0x00, 0xff, 0x00, 0xf6, 0xff, 0xf7,
+  0xff, 0xfe, 0xff, 0x92, 0xe0, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x1d, 0xf2, 0x00, 0x00,
+  0x00, 0x0a, 0x02, 0xfb, 0x01, 0x00, 0x00, 0xfb, 0x00, 0xfe, 0x01, 0x00,
+  0x00, 0xe4, 0xfb, 0xc6, 0x00, 0x00, 0xff, 0xe8, 0xf5, 0xce, 0x00, 0x01,
+  0x00, 0xbb, 0xf0, 0x04, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xfe, 0x00, 0xf0, 0x17, 0x24, 0x00, 0x00, 0x00, 0xf6,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xe9,
+  0xca, 0xc8, 0x00, 0x00, 0x00, 0x05, 0x18, 0x31, 0x00, 0x01, 0x00, 0xc8,
+  0xda, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xc9, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xfb, 0xf8, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xef, 0x0a,
+  0x01, 0x01, 0x00, 0x26, 0x24, 0x16, 0xff, 0xff, 0x00, 0x17, 0xe7, 0xf7,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x04, 0xec, 0xe4, 0x00, 0x00, 0x00, 0x10, 0x01, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x12, 0xf4, 0x1a, 0x00, 0x00,
+  0x00, 0xee, 0xf2, 0xe4, 0x00, 0x00, 0x00, 0x42, 0x29, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44,
+  0x16, 0xe8, 0x00, 0x00, 0x00, 0xf5, 0x02, 0xf6, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 0x0b, 0xd5, 0x00, 0x01, 0x00, 0x37,
+  0x11, 0x32, 0xff, 0x00, 0x00, 0xd5, 0xbd, 0x03, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xfc, 0xf9, 0xf8,
+  0x00, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0xda, 0xf4, 0xff, 0x00, 0xff, 0x00, 0xfa, 0xf4, 0x02,
+  0x00, 0xff, 0xff, 0xa5, 0x29, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0xa8, 0x10, 0x0a, 0x00, 0x00,
+  0x00, 0x0b, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xff, 0xdf, 0xd9, 0xd7, 0x00, 0x01, 0x00, 0x14, 0xed, 0xff, 0x00, 0x00,
+  0x00, 0x1e, 0xf1, 0xd2, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xee, 0xf6, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xfe, 0x01, 0x00, 0x00, 0xfc, 0x03, 0xfd, 0x00, 0xff, 0xff, 0xd4,
+  0x26, 0xe1, 0x01, 0xff, 0x00, 0x02, 0x30, 0xf1, 0xff, 0xff, 0xfe, 0x25,
+  0x1a, 0x19, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x2a, 0xc6, 0x1c, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xfa,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xe1, 0xe4,
+  0x00, 0x00, 0x01, 0x22, 0x02, 0x22, 0x00, 0x00, 0x00, 0xfd, 0xc5, 0xe5,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xd8, 0xf6, 0x00, 0x00, 0x00, 0x11, 0x04, 0xfc, 0x01, 0x00,
+  0x00, 0xfc, 0x02, 0xfe, 0x00, 0xff, 0xfe, 0xd2, 0x15, 0xe6, 0x02, 0xfe,
+  0x00, 0xd6, 0x24, 0xcf, 0xfe, 0x01, 0xfd, 0x12, 0x18, 0xfc, 0x00, 0x01,
+  0xff, 0xfd, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xfe, 0xf7,
+  0x10, 0xf5, 0x00, 0x00, 0x00, 0xf3, 0x07, 0xf7, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x1f, 0xd4, 0x00, 0x00, 0x00, 0xf0,
+  0x12, 0x2c, 0x00, 0x00, 0x00, 0x97, 0xf5, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xed, 0x01,
+  0x00, 0x00, 0x00, 0xf2, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0xcc, 0xdd, 0x0b, 0x00, 0x01, 0x00, 0x07, 0x26, 0x26,
+  0x00, 0xff, 0x01, 0xfc, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xff, 0x1e, 0x00, 0x00,
+  0x00, 0xfc, 0x04, 0x05, 0x00, 0x00, 0x00, 0x02, 0x04, 0xff, 0x00, 0x00,
+  0x00, 0x32, 0x01, 0xcd, 0x01, 0xff, 0x00, 0x06, 0x02, 0xd3, 0x00, 0x01,
+  0x00, 0xfc, 0x08, 0xed, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xdf, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf9, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd1,
+  0xf5, 0xe1, 0x00, 0x00, 0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0xff, 0x9f,
+  0xee, 0xe9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x0e, 0x05, 0x00, 0x00, 0x00, 0xf6, 0xf0, 0xee,
+  0x00, 0x01, 0x01, 0x00, 0x09, 0x01, 0x02, 0x01, 0x02, 0x1b, 0x20, 0xd5,
+  0x00, 0x04, 0xff, 0xfb, 0x2c, 0xdb, 0x02, 0x00, 0x02, 0x1e, 0xe6, 0x27,
+  0x01, 0x01, 0x01, 0x07, 0x01, 0x02, 0xff, 0x00, 0x01, 0x00, 0x01, 0xfe,
+  0x01, 0xef, 0xfb, 0xdd, 0x00, 0x00, 0x00, 0xfd, 0x03, 0x07, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf1, 0x12, 0xff, 0x01,
+  0x00, 0xea, 0xea, 0xf8, 0xff, 0x00, 0x00, 0x23, 0x26, 0x3b, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x29,
+  0x3e, 0xfa, 0x00, 0x00, 0x00, 0xf0, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x05,
+  0xfc, 0x00, 0x00, 0x00, 0x01, 0xea, 0x1d, 0xe8, 0x00, 0x00, 0xff, 0x22,
+  0xe1, 0x10, 0x01, 0x01, 0x01, 0x16, 0x0f, 0x1a, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x13, 0x09,
+  0x00, 0x00, 0x00, 0xe3, 0xf1, 0xf4, 0x01, 0x01, 0xff, 0xfc, 0xfd, 0xfd,
+  0x02, 0x01, 0x01, 0xf6, 0x1c, 0xd4, 0xff, 0x05, 0xfe, 0xd3, 0x05, 0xcf,
+  0x03, 0x00, 0x04, 0xe7, 0xef, 0xfe, 0x01, 0x00, 0x01, 0x04, 0x00, 0xff,
+  0x01, 0x00, 0x01, 0x00, 0x02, 0xfe, 0x02, 0xf4, 0x00, 0xfd, 0x00, 0x00,
+  0x00, 0xf9, 0x03, 0xfd, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x00, 0x00,
+  0xff, 0x00, 0x16, 0x08, 0xff, 0x00, 0xff, 0xca, 0x0e, 0x10, 0x00, 0x01,
+  0x00, 0xe7, 0x29, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x28, 0x29, 0xe5, 0x00, 0x00, 0x00, 0xfa,
+  0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x11,
+  0xe4, 0xf7, 0x00, 0x00, 0xff, 0xd3, 0x0d, 0xdb, 0x01, 0x00, 0x01, 0x0d,
+  0xe0, 0x5b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x64, 0x13, 0xf1, 0x00, 0x00, 0x00, 0xfe, 0xf9, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0xfe, 0x01, 0x00, 0x00, 0x02, 0x07, 0xf3, 0xf5,
+  0xff, 0x01, 0x00, 0x05, 0xe9, 0x1a, 0x01, 0x01, 0x03, 0xcb, 0x34, 0x2e,
+  0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x1f, 0x3a, 0xf9, 0x00, 0x00, 0x00, 0xfe, 0x07, 0x01, 0x00, 0x00,
+  0x00, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x30, 0x23, 0x35, 0xff, 0x00,
+  0x00, 0xd7, 0x02, 0xd1, 0x00, 0x00, 0x00, 0x06, 0x1f, 0xe5, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xcd,
+  0x20, 0x2f, 0x00, 0x00, 0x00, 0x0a, 0xed, 0xf8, 0x00, 0x00, 0xff, 0xfc,
+  0xfd, 0xfe, 0x01, 0x00, 0xff, 0xf7, 0xe7, 0x17, 0x01, 0x00, 0xff, 0xee,
+  0x14, 0xd3, 0x01, 0x01, 0x00, 0x47, 0xec, 0x1a, 0x00, 0x01, 0x00, 0x01,
+  0xff, 0xfe, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x24, 0x06, 0x3a,
+  0x00, 0x00, 0x00, 0x02, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe5, 0x07, 0xe1, 0x01, 0x00, 0x00, 0x24, 0x2f, 0x1b,
+  0x00, 0x00, 0x01, 0xa6, 0xe2, 0xcc, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xbd, 0xe8, 0x00, 0x00,
+  0x00, 0x01, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x16, 0x0c, 0xff, 0x02, 0xff, 0x1f, 0xd7, 0x06, 0x01, 0x01,
+  0x02, 0xc5, 0x18, 0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x51, 0xf7, 0xdd, 0x00, 0x00, 0x00, 0xf4,
+  0xfa, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x2f,
+  0x14, 0x0b, 0x00, 0xff, 0x00, 0xec, 0xde, 0x17, 0x00, 0x00, 0xff, 0xf1,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x64, 0xf8, 0x16, 0x00, 0x00, 0x00, 0xff, 0xfa, 0xf4,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0xf2, 0xde,
+  0xff, 0x00, 0xff, 0x01, 0xfc, 0x1e, 0x02, 0x04, 0x03, 0xd3, 0x28, 0xeb,
+  0x01, 0x00, 0x01, 0x02, 0x00, 0xff, 0x01, 0x00, 0x00, 0x02, 0x02, 0x04,
+  0x02, 0x29, 0x44, 0x41, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x2d, 0x0e, 0x00, 0x00,
+  0x00, 0xd6, 0xd3, 0xdf, 0x00, 0xff, 0x00, 0x44, 0xef, 0x4b, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
+  0x1f, 0xde, 0x00, 0x00, 0x00, 0x06, 0x02, 0x08, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0xfd, 0x00, 0xff, 0x00, 0x12, 0x21, 0xc8, 0x01, 0xfe, 0x01, 0x3a,
+  0x0e, 0xe1, 0xff, 0x00, 0xff, 0x38, 0x00, 0x23, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0xfa, 0xe3,
+  0x00, 0x00, 0x00, 0xf2, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0xff, 0x00, 0x00, 0xf6, 0xeb, 0xd5, 0x00, 0x00, 0x00, 0x21, 0x05, 0x12,
+  0x00, 0xfe, 0xff, 0xf9, 0xef, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x06, 0xcc, 0xe7, 0x00, 0x00,
+  0x00, 0xfa, 0xfa, 0xff, 0x00, 0x00, 0x00, 0xfd, 0xfc, 0x02, 0x01, 0x01,
+  0x01, 0x19, 0x0b, 0x1d, 0xff, 0x03, 0x00, 0x03, 0xe2, 0xf3, 0x00, 0x01,
+  0x02, 0xdf, 0x1e, 0x40, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0xb5, 0xe1, 0x0a, 0x00, 0x00, 0x00, 0xf5,
+  0xf5, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xe5,
+  0xf2, 0x08, 0x00, 0x00, 0x00, 0x26, 0x11, 0x32, 0x00, 0x00, 0x00, 0x9d,
+  0xf8, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xb0, 0xec, 0x09, 0x00, 0x00, 0x00, 0xec, 0xf5, 0xf9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x05, 0xe6, 0xdf,
+  0x00, 0x01, 0x00, 0x0b, 0x09, 0x1d, 0x00, 0x00, 0x01, 0xf3, 0xb8, 0x96,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xd6, 0xfb, 0xc1, 0x00, 0x00, 0x00, 0xf9, 0xfe, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x23, 0x06, 0x0f, 0x00, 0x01,
+  0x00, 0xf1, 0xf0, 0xd4, 0x00, 0x00, 0x00, 0x48, 0x1e, 0x1e, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5,
+  0x32, 0x2b, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0xfc, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xdd, 0xbe, 0x01, 0x00, 0x00, 0x28,
+  0xfb, 0x2d, 0x00, 0xfe, 0x00, 0xe3, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1f, 0xe3, 0xd1,
+  0x00, 0x00, 0x00, 0xfc, 0xfa, 0xff, 0x01, 0x00, 0x00, 0x05, 0x04, 0xfc,
+  0x01, 0x00, 0x01, 0x17, 0x20, 0x0d, 0x00, 0x01, 0x00, 0x24, 0x27, 0xd7,
+  0x00, 0x01, 0x00, 0x0a, 0xf8, 0xcb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd2, 0x16, 0xf5, 0x00, 0x00,
+  0x00, 0x12, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x03, 0xff, 0x00, 0x00,
+  0xff, 0xf6, 0x24, 0xf4, 0x01, 0xfe, 0x00, 0xf7, 0xee, 0xca, 0x00, 0xff,
+  0xff, 0x07, 0xf0, 0x04, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x11, 0xd2, 0x00, 0x00, 0x00, 0xfc,
+  0x0a, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x22,
+  0x2e, 0x11, 0xff, 0xff, 0x00, 0xff, 0x14, 0xcb, 0x00, 0xff, 0x00, 0x1f,
+  0xe5, 0x4e, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x50, 0x37, 0x32, 0x00, 0x00, 0x00, 0xee, 0x02, 0xf7,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xf6, 0x08, 0xfc,
+  0x00, 0x00, 0x00, 0x17, 0x1d, 0x15, 0x00, 0xff, 0x00, 0xcb, 0xe4, 0xba,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0xc5, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x0a, 0x00, 0x00,
+  0x01, 0x03, 0x02, 0xff, 0xff, 0x00, 0x00, 0xdc, 0x16, 0x07, 0x01, 0xfe,
+  0x01, 0x02, 0xe9, 0xfa, 0xff, 0xff, 0x00, 0xac, 0x2a, 0xdc, 0x00, 0x00,
+  0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf6,
+  0xc0, 0xd6, 0x00, 0x01, 0x01, 0xf4, 0xf7, 0xf5, 0x00, 0x01, 0x01, 0x01,
+  0x00, 0x02, 0x02, 0x01, 0x01, 0xef, 0x10, 0xf2, 0xfe, 0x04, 0xff, 0x0d,
+  0xf0, 0x09, 0x02, 0x02, 0x03, 0x26, 0xf1, 0x2d, 0x00, 0x00, 0x01, 0x09,
+  0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0xff, 0x01, 0xfa, 0xfa, 0xf1,
+  0x00, 0x00, 0x00, 0xfa, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0xff, 0xf3, 0xe7, 0x00, 0x01, 0x01, 0x00, 0x0d, 0x29, 0x31,
+  0xff, 0xff, 0xff, 0x2f, 0xfc, 0xf3, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xd5, 0xe2, 0xc0, 0x00, 0x00,
+  0x00, 0x0e, 0x05, 0x02, 0x00, 0x00, 0x00, 0xfd, 0x03, 0xff, 0x00, 0x00,
+  0xff, 0xe5, 0xe1, 0xf3, 0x00, 0x00, 0x00, 0x0d, 0xfb, 0x28, 0x00, 0xff,
+  0xfe, 0x32, 0xc7, 0x04, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x32, 0x04, 0xe6, 0x00, 0x00, 0x00, 0x05,
+  0xff, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde,
+  0x2f, 0x0e, 0x01, 0xff, 0x00, 0x06, 0xe5, 0xf3, 0xff, 0x00, 0xff, 0xd4,
+  0x08, 0xc1, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xeb, 0xce, 0xf9, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xce, 0xf5,
+  0x00, 0x00, 0x00, 0x1a, 0x08, 0x3d, 0x00, 0xff, 0xff, 0x0e, 0xc2, 0xce,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x81, 0xe8, 0xe2, 0x00, 0x00, 0x00, 0xf9, 0xfc, 0xfc, 0x00, 0x00,
+  0x00, 0x01, 0xfd, 0x03, 0x00, 0x01, 0x02, 0x06, 0x06, 0x19, 0x00, 0x03,
+  0xfe, 0x1c, 0xe6, 0xe9, 0x01, 0x01, 0x02, 0xc8, 0x3e, 0x11, 0x00, 0x00,
+  0x01, 0x02, 0x01, 0xff, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x20,
+  0xe3, 0x27, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x0c, 0x00, 0x00, 0x00, 0xfe,
+  0xfd, 0x00, 0x00, 0x00, 0x01, 0x09, 0x1b, 0xfd, 0xff, 0x00, 0x00, 0xf3,
+  0x04, 0xd7, 0x00, 0x01, 0x00, 0x67, 0x14, 0xe0, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x45, 0x3a,
+  0x00, 0x00, 0x00, 0x07, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0xff, 0x0b, 0x08, 0xff, 0x00, 0x00, 0xe1, 0xdf, 0x0d,
+  0x00, 0x01, 0x00, 0x14, 0x42, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xec, 0x01, 0x00, 0x00,
+  0x00, 0xfd, 0x01, 0x02, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x06, 0xd8, 0xd7, 0x00, 0xff, 0x00, 0xd8, 0x19, 0xf0, 0x00, 0x00,
+  0x00, 0xdd, 0xf4, 0xb4, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x45, 0x15, 0xd0, 0x00, 0x00, 0x00, 0x03,
+  0xfd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xd5,
+  0xe5, 0x0c, 0x00, 0xff, 0x01, 0x2f, 0xea, 0xf9, 0x00, 0xfe, 0x00, 0x08,
+  0x02, 0xac, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xfe, 0xff, 0xf0, 0xb1, 0xaf, 0x00, 0x00, 0x00, 0xff, 0x05, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xf7,
+  0x00, 0x00, 0xff, 0xfd, 0x11, 0x02, 0x01, 0x00, 0x00, 0x28, 0x3d, 0x56,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x35, 0x0c, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x05, 0xff, 0x00, 0x00,
+  0x00, 0xff, 0x01, 0xff, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x29, 0x00, 0xff,
+  0x00, 0xd4, 0xe9, 0x02, 0x00, 0x00, 0x00, 0x45, 0x52, 0x59, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
+  0x24, 0xf6, 0x00, 0x00, 0x00, 0xfa, 0xf3, 0xfb, 0x00, 0x00, 0x00, 0xfe,
+  0xfa, 0x01, 0x01, 0x00, 0x00, 0xee, 0xf7, 0x27, 0xff, 0x02, 0xff, 0x1b,
+  0x18, 0xe0, 0x01, 0x00, 0x01, 0x3f, 0xf1, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x45, 0x1d, 0x19,
+  0x00, 0x01, 0x00, 0xea, 0xf7, 0xf1, 0x00, 0x01, 0xff, 0xf7, 0xf9, 0x04,
+  0x01, 0x01, 0xff, 0xd2, 0xf9, 0x3d, 0xfe, 0x04, 0xfe, 0xdb, 0xff, 0x5a,
+  0x02, 0x02, 0x02, 0x09, 0x06, 0x25, 0x00, 0x00, 0x01, 0x03, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0xff, 0x02, 0xcc, 0x0e, 0x04, 0x00, 0x00,
+  0x00, 0xfd, 0x07, 0x0c, 0x01, 0x00, 0xff, 0xfd, 0x02, 0xfd, 0x00, 0x00,
+  0xfe, 0xe1, 0x0f, 0xcf, 0x01, 0xfe, 0x00, 0xf0, 0x18, 0xbc, 0x00, 0x02,
+  0xfe, 0x16, 0x0c, 0xee, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0xfe, 0x03, 0xe8, 0x1e, 0x00, 0x00, 0x00, 0x01,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xcd,
+  0xd3, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x1d, 0x25, 0x00, 0x00, 0xff, 0xca,
+  0x17, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x09, 0xea, 0x00, 0x00, 0x00, 0x10, 0x05, 0xfb,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x1a, 0xfd,
+  0xff, 0x00, 0x00, 0x07, 0xd0, 0xec, 0x00, 0xff, 0x00, 0x45, 0x55, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x65, 0x18, 0x08, 0x00, 0x00, 0x01, 0xfd, 0xee, 0xf4, 0x01, 0x01,
+  0xff, 0xfd, 0x02, 0x01, 0x03, 0x01, 0x01, 0xfd, 0x04, 0xeb, 0x00, 0x08,
+  0xfe, 0x10, 0xf6, 0x10, 0x03, 0xfe, 0x03, 0x1e, 0x00, 0x36, 0x00, 0x01,
+  0x01, 0x0a, 0x01, 0xff, 0x00, 0xff, 0x01, 0xff, 0x01, 0xfb, 0x01, 0xfe,
+  0xff, 0xff, 0x00, 0x01, 0x00, 0x0d, 0xf8, 0xff, 0x00, 0x01, 0x00, 0x02,
+  0xfd, 0x04, 0x01, 0x01, 0x02, 0x1d, 0xea, 0x2c, 0xfe, 0x02, 0xfe, 0xfd,
+  0xf2, 0x31, 0x02, 0x00, 0x04, 0xe2, 0xfd, 0xeb, 0x00, 0xff, 0x01, 0x04,
+  0x01, 0x00, 0x02, 0x00, 0x01, 0x01, 0x02, 0xfe, 0x03, 0xdd, 0x15, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0xf5, 0xf5, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0xcf, 0x1a, 0x0b, 0x00, 0x01, 0x00, 0x0b, 0x27, 0x0b,
+  0xff, 0xff, 0x01, 0xe8, 0xbe, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0xf6, 0xf5, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x2b, 0x0b, 0x00, 0x01, 0x00, 0x1e, 0xd3, 0xde, 0x01, 0xff,
+  0x00, 0xe4, 0x43, 0xf6, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0xf5, 0x28, 0x00, 0x00, 0x00, 0xfb,
+  0xf9, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xeb,
+  0xe8, 0xd5, 0x00, 0x02, 0x01, 0x19, 0x34, 0x23, 0xff, 0xff, 0x00, 0xea,
+  0xeb, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xff, 0xff, 0xe4, 0xde, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0xfb,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xd8, 0x05,
+  0x00, 0xff, 0xff, 0xe3, 0x0e, 0x38, 0x00, 0xff, 0x00, 0xd6, 0x0a, 0xe8,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x02, 0xe2, 0xd6, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xfe, 0x00, 0x00,
+  0x00, 0xff, 0x02, 0xff, 0x00, 0x00, 0x00, 0xec, 0xeb, 0xd9, 0x00, 0xff,
+  0x00, 0x0a, 0xf3, 0x24, 0x00, 0xff, 0x01, 0xc0, 0xce, 0xdf, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d,
+  0xfb, 0xd4, 0x00, 0x00, 0x00, 0x0e, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x10, 0xff, 0xff, 0x00, 0xd9,
+  0xdf, 0xf1, 0x00, 0x00, 0x01, 0xf5, 0x3b, 0xf5, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x30, 0xee, 0x22,
+  0x00, 0x00, 0x00, 0xf1, 0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xfa, 0x08, 0x01, 0x01, 0x00, 0x1a, 0x20, 0x05,
+  0x00, 0x00, 0x00, 0xc6, 0xbf, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xe3, 0xd3, 0x00, 0x01,
+  0x00, 0xfd, 0xe8, 0xde, 0x00, 0x01, 0x00, 0xfc, 0x02, 0xfd, 0x02, 0x01,
+  0x00, 0x17, 0xf8, 0xf1, 0xfe, 0x04, 0xff, 0xfc, 0x0f, 0xf6, 0x03, 0x00,
+  0x00, 0xec, 0x1a, 0x14, 0x00, 0x00, 0x01, 0x04, 0xff, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x01, 0xfd, 0x00, 0xd9, 0x17, 0x19, 0x00, 0xff, 0x00, 0x19,
+  0x08, 0x0b, 0x00, 0xff, 0x01, 0x06, 0x01, 0x00, 0xfe, 0xff, 0xff, 0xf6,
+  0x00, 0x15, 0x01, 0xfb, 0x02, 0xf3, 0xf4, 0xf1, 0xfe, 0x00, 0xfc, 0xc1,
+  0x0c, 0xd0, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x02, 0xfe, 0x00, 0xff, 0xff,
+  0xfe, 0x01, 0xfe, 0x28, 0xf5, 0xf9, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x13, 0xf4,
+  0x00, 0xff, 0x00, 0xd7, 0xdd, 0xf4, 0x00, 0xff, 0xff, 0x3e, 0x48, 0x0a,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x4c, 0x2a, 0x37, 0x00, 0x01, 0x00, 0xe7, 0x01, 0xfb, 0x00, 0x00,
+  0xff, 0xfb, 0xfb, 0x00, 0x01, 0x01, 0x00, 0xfb, 0xfa, 0xf7, 0xfe, 0x00,
+  0xfd, 0x1f, 0x07, 0x09, 0x02, 0x04, 0x02, 0x0e, 0xf6, 0xcf, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0xfd, 0x04, 0x00, 0x01, 0x02, 0x01, 0x04, 0x02, 0x47,
+  0x2d, 0x7a, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0xff, 0x00, 0x00, 0xed, 0x09, 0xfd, 0x02, 0xff, 0x01, 0x0c,
+  0x05, 0x17, 0xfe, 0x01, 0xfe, 0xc7, 0x27, 0xf0, 0x00, 0x00, 0x00, 0xfe,
+  0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x44, 0xd6, 0x05,
+  0x00, 0x00, 0x00, 0xf5, 0xfc, 0xfd, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xfb, 0xe6, 0x0d, 0x00, 0x00, 0x00, 0xff, 0x16, 0xde,
+  0x00, 0xff, 0x00, 0x5f, 0x3f, 0x5b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2a, 0x33, 0xf7, 0x00, 0x00,
+  0x00, 0x04, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00,
+  0x00, 0x2e, 0xfa, 0xee, 0xff, 0x00, 0xff, 0xd0, 0xf3, 0xda, 0x01, 0x00,
+  0x00, 0x56, 0xfb, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0xf1, 0xe8, 0x1e, 0x00, 0x00, 0x00, 0xf9,
+  0xf8, 0x07, 0x00, 0x00, 0x00, 0x04, 0xff, 0x01, 0x01, 0x01, 0x01, 0xee,
+  0xf4, 0x17, 0xfe, 0x01, 0xff, 0x24, 0xe6, 0x06, 0x01, 0x01, 0x03, 0xe5,
+  0x35, 0x40, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x01, 0x02, 0x02, 0x37, 0x44, 0xd5, 0x00, 0xff, 0xff, 0x1c, 0x02, 0x20,
+  0x01, 0xff, 0x01, 0x00, 0x02, 0x00, 0xfe, 0xff, 0x00, 0xdb, 0xf1, 0x03,
+  0x03, 0xff, 0x05, 0x1e, 0x08, 0xf9, 0xfd, 0xfa, 0xfc, 0x39, 0x16, 0xe4,
+  0x00, 0x00, 0xff, 0xfe, 0x00, 0x03, 0xfc, 0x01, 0xff, 0xfe, 0xfe, 0xfb,
+  0xfd, 0x0f, 0xfe, 0xef, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x08, 0xff, 0x01,
+  0x00, 0x05, 0xfe, 0x03, 0x00, 0x01, 0x02, 0x10, 0x08, 0x0b, 0xfe, 0x03,
+  0xff, 0xf8, 0xe3, 0x08, 0x00, 0x00, 0x03, 0xe8, 0x40, 0x1c, 0x00, 0xff,
+  0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0xcc,
+  0xfb, 0x0c, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x09, 0x00, 0x00, 0x00, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x39, 0x35, 0x32, 0x00, 0x00, 0x00, 0x02,
+  0x04, 0xe4, 0x00, 0x00, 0x00, 0x59, 0xf0, 0x60, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x62, 0xfe, 0x18,
+  0x00, 0x00, 0x00, 0xfb, 0x02, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xf9, 0x0c, 0x00, 0xff, 0xff, 0x07, 0xf0, 0xe2,
+  0x00, 0xff, 0xff, 0x3a, 0xc7, 0x1a, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xca, 0xfb, 0xc8, 0x00, 0x00,
+  0x00, 0x03, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0x00, 0xde, 0x0f, 0x1b, 0x00, 0x01, 0x00, 0xfa, 0x1f, 0x28, 0x00, 0x00,
+  0x00, 0x07, 0xee, 0x96, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xc9, 0xfa, 0x00, 0x00, 0x00, 0xf8,
+  0x04, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0xd9,
+  0xfa, 0xff, 0x00, 0x00, 0x00, 0xe8, 0x14, 0xf4, 0xff, 0x00, 0xff, 0xbf,
+  0xcd, 0xc1, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xbc, 0x08, 0xfd, 0x00, 0x00, 0x00, 0xf1, 0xf8, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x09, 0xf1, 0xfb,
+  0x00, 0x00, 0x01, 0x0f, 0xf9, 0x17, 0x00, 0xff, 0x00, 0x9f, 0x0b, 0xef,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x01, 0xc7, 0xeb, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x09, 0x09, 0x00, 0x00,
+  0x00, 0xfd, 0x03, 0x01, 0xff, 0x00, 0xff, 0x0b, 0x0d, 0x13, 0x01, 0xff,
+  0x00, 0xee, 0x18, 0x2e, 0x00, 0x00, 0xff, 0xe8, 0x2a, 0xf0, 0x00, 0x00,
+  0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc1,
+  0x28, 0x22, 0x00, 0x00, 0x00, 0xfd, 0x03, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f, 0x08, 0xff, 0xff, 0x00, 0xd6,
+  0xe0, 0xec, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x5a, 0x3f, 0x20,
+  0x00, 0x00, 0x00, 0x0b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+  0xff, 0x00, 0x00, 0xdb, 0x07, 0xf9, 0x01, 0xff, 0x01, 0x23, 0xe7, 0xfb,
+  0xff, 0x01, 0xff, 0xf2, 0x13, 0xe7, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x33, 0xe1, 0xf6, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00, 0x00,
+  0x00, 0x2f, 0x09, 0xff, 0xff, 0x01, 0x00, 0xde, 0xde, 0x17, 0x00, 0x00,
+  0x00, 0xc4, 0x40, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xbb, 0x0b, 0x1b, 0x00, 0x00, 0x00, 0x04,
+  0xfd, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x11,
+  0x23, 0xe4, 0x00, 0x00, 0x01, 0xe9, 0xd4, 0xd6, 0x00, 0x01, 0x01, 0x06,
+  0x14, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x57, 0x1f, 0x3a, 0x00, 0x00, 0x00, 0x17, 0xff, 0x07,
+  0x01, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00, 0xff, 0x22, 0xdd, 0xd4,
+  0x00, 0xfd, 0x01, 0x02, 0x1d, 0x11, 0xff, 0x00, 0xff, 0x2b, 0xda, 0xac,
+  0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xff, 0x2b, 0xee, 0xd3, 0x00, 0x00, 0x00, 0xfd, 0xf5, 0xfd, 0x00, 0x00,
+  0x00, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0xfe, 0x1d, 0x00, 0xff,
+  0xff, 0xdc, 0x17, 0xf7, 0x00, 0x01, 0x00, 0x28, 0x1c, 0x18, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x3f,
+  0x08, 0x23, 0x00, 0x00, 0x00, 0x07, 0xf9, 0x05, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xe1, 0xf3, 0xff, 0x01, 0x01, 0x33,
+  0x0d, 0x21, 0x00, 0xff, 0x01, 0xbb, 0xd6, 0xa9, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xcf, 0xfb, 0x21,
+  0x00, 0x00, 0x00, 0xf4, 0xf1, 0x01, 0x01, 0x00, 0x00, 0xfe, 0xfe, 0x01,
+  0x01, 0x01, 0x00, 0xf9, 0x1d, 0x08, 0x00, 0x02, 0x00, 0xff, 0xf1, 0xed,
+  0x01, 0xff, 0x01, 0xf2, 0x2d, 0xe4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xb1, 0xfe, 0x15, 0x00, 0x00,
+  0x00, 0x19, 0x13, 0x14, 0x00, 0x00, 0x00, 0x01, 0x01, 0xfe, 0x00, 0xff,
+  0xff, 0x22, 0x2d, 0xdb, 0x01, 0xfe, 0x01, 0x24, 0x1c, 0xd7, 0xfe, 0x01,
+  0xfe, 0x1f, 0x01, 0xe4, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x02, 0xff, 0xdd, 0xed, 0xe8, 0x00, 0x01, 0x00, 0xe9,
+  0xf4, 0xea, 0xff, 0x01, 0xff, 0x01, 0xf7, 0x02, 0x01, 0x01, 0x01, 0xed,
+  0xf5, 0x00, 0xfe, 0x05, 0xfe, 0x0d, 0xf4, 0xe2, 0x03, 0x00, 0x04, 0x2a,
+  0xe9, 0x1e, 0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x01, 0xfd, 0x01, 0xfb, 0x25, 0xeb, 0x00, 0x00, 0x00, 0xfc, 0xf8, 0xf7,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0x00, 0xc8, 0xe8, 0x0f,
+  0x00, 0xff, 0x00, 0x19, 0x2b, 0xf3, 0x00, 0xfe, 0xff, 0xf1, 0x02, 0x03,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x0f, 0xda, 0xf1, 0x00, 0x00, 0x00, 0x06, 0x02, 0x0d, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x29, 0x15, 0x11, 0x00, 0xfe,
+  0x01, 0x1d, 0x16, 0x21, 0xff, 0xff, 0x00, 0x2c, 0x10, 0x23, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xed,
+  0xdd, 0xe0, 0x00, 0x00, 0x00, 0x08, 0xf9, 0xff, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0x01, 0x01, 0x00, 0x01, 0xe9, 0x18, 0x10, 0xff, 0x01, 0x00, 0xfc,
+  0xf2, 0xe4, 0x01, 0x01, 0x01, 0xc1, 0xe8, 0x31, 0x01, 0x00, 0x00, 0x02,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x4a, 0x11, 0x27,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x00, 0x3c, 0xfc, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00
+};
+const int fall_model_2_int8_data_len = 12032;
@@ -0,0 +1,819 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_3_aot.h
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    The model f46_3 compiled ahead of time to C++
+  *
+  *   Runs the model without the interpreter and the tensor arena. The
+  *   layers do the same float operations in the same order as the reference
+  *   kernels of TensorFlow Lite Micro, so the outputs are the same as Invoke().
+  *
+**/
+
+// Generated from fall_model_3_data with the host tool:
+// aot_compile --out adaptive_fall_detection_system f46_3
+
+#ifndef FALL_MODEL_F46_3_AOT_H_
+#define FALL_MODEL_F46_3_AOT_H_
+
+#include <cmath>
+
+namespace fall_model_f46_3_aot {
+
+constexpr int kInputs = 46;      /**<  Amount of features   */
+constexpr int kHidden = 69;      /**<  Amount of neurons in the hidden layer   */
+constexpr int kOutputs = 2;      /**<  The outputs (no fall, fall)   */
+
+constexpr float kHiddenWeights[69][46] = {
+  {
+    0.0166117661f, 0.242125526f, 0.0666215643f, 0.187791482f, 0.118306138f, 0.00556713901f,
+    0.22546941f, -0.0481983237f, -0.0183636099f, -0.22227639f, -0.0269085355f, -0.232519135f,
+    0.169686094f, 0.186597005f, 0.0399391912f, 0.0692913011f, 0.273092985f, 0.261946291f,
+    0.074667193f, 0.0541376099f, -0.199065387f, -0.047339078f, -0.132205829f, -0.24982354f,
+    -0.126870394f, -0.0758448765f, 0.279536039f, 0.111385815f, 0.0187399425f, -0.0207985882f,
+    0.172651604f, -0.0252312478f, 0.111608207f, 0.0379394703f, 0.0500520766f, 0.143689334f,
+    0.262304068f, 0.0706533343f, 0.200564787f, 0.236550093f, -0.0095472252f, 0.170985445f,
+    0.0226284098f, -0.0259545725f, 0.101835527f, 0.113445021f
+  },
+  {
+    0.216431782f, 0.670871973f, 0.467791796f, -0.125997901f, -0.0886765495f, -0.209587753f,
+    0.612653792f, 1.36833894f, 0.926917613f, 0.924165845f, 0.0444026664f, -0.535592139f,
+    0.58896929f, 0.984048128f, 0.962738454f, 0.103778556f, 0.0978222191f, -0.174755409f,
+    -0.170476958f, 0.715262949f, 0.793749273f, 0.223242491f, 0.313136071f, -0.32165882f,
+    0.666320562f, 0.159589723f, 0.410357744f, 0.000555841136f, 0.0462693274f, -0.0515594259f,
+    0.514680326f, 0.374510646f, 0.983274341f, 1.02721024f, 1.16668749f, 0.56772083f,
+    0.0899096951f, -0.504023671f, 0.294760197f, 0.122509949f, 0.651539922f, -0.122466348f,
+    0.400048375f, 0.0515790284f, 0.0538836606f, -0.0694395006f
+  },
+  {
+    0.038457077f, 0.0397944711f, 0.157299638f, 0.11614541f, -0.18713823f, -0.190019459f,
+    0.579884708f, 0.810086846f, 0.50810802f, 0.123585843f, 0.415798843f, 0.237163976f,
+    0.196904853f, 0.602435112f, 0.363062054f, 0.0608262643f, -0.0354711525f, -0.00494031655f,
+    -0.134048954f, 0.594018757f, 0.147072151f, -0.19276388f, 0.0602764636f, 0.0353016257f,
+    0.231504202f, -0.214753523f, -0.0352909416f, 0.182757482f, -0.177552819f, 0.128312483f,
+    0.094285734f, 0.189117745f, 0.272337735f, 0.560515881f, 0.529532433f, 0.0380698033f,
+    -0.241767958f, -0.384429395f, -0.134589612f, -0.0580654815f, 0.127121672f, -0.0890863612f,
+    -0.0231138337f, -0.265312612f, -0.261977315f, -0.00644242484f
+  },
+  {
+    0.0462949798f, 0.154904842f, -0.118577026f, -0.039893996f, -0.0747891963f, 0.140040368f,
+    -0.0732860193f, -0.238659725f, -0.266893506f, 0.0256104916f, 0.296520829f, -0.24775295f,
+    0.190076292f, 0.00188994699f, 0.0992963314f, 0.26594317f, 0.104833946f, 0.150772363f,
+    -0.191142842f, -0.177448913f, 0.00175099634f, -0.136879012f, -0.238699824f, -0.225891799f,
+    0.197415411f, -0.0704785809f, -0.0172388665f, -0.0982906148f, 0.262173653f, 0.210520998f,
+    -0.0616234839f, -0.284629285f, -0.198335901f, -0.244730756f, -0.232043624f, -0.250479102f,
+    0.0958109722f, -0.0492451414f, 0.0192949399f, 0.00358232693f, 0.263412118f, -0.0538853109f,
+    -0.0390233882f, 0.324135602f, -0.142165259f, 0.126138896f
+  },
+  {
+    -0.00791374687f, -0.296488851f, 0.0525094606f, 0.275954753f, 0.239011884f, -0.0134340255f,
+    -0.033668939f, -0.532144248f, 0.671385646f, 0.407523185f, 0.394700319f, 0.00286946981f,
+    -0.40102756f, -0.740446866f, -0.0359700993f, 0.114008397f, 0.154487789f, 0.14635925f,
+    0.259864777f, -0.109979272f, 0.175940931f, -0.0880267918f, 0.225481689f, 0.00541409012f,
+    -0.222190097f, 0.0618420579f, -0.0515360534f, 0.0841844976f, -0.178222686f, 0.0129120117f,
+    -0.410203815f, 0.184604645f, -0.701888859f, -0.530953288f, 0.0411835313f, 0.182211429f,
+    -0.2025837f, 0.258191556f, -0.193178996f, -0.302972466f, -0.267676502f, -0.0219812226f,
+    -0.249783635f, 0.0535723157f, -0.0690087825f, -0.207309499f
+  },
+  {
+    -0.093742393f, -0.167964205f, 0.0131404046f, -0.00392539892f, -0.0613412894f, 0.0200464856f,
+    0.58386749f, -0.538577259f, -0.478897095f, -0.127938494f, 0.483304918f, 0.0394554585f,
+    -0.172977746f, -0.566675901f, -0.367406368f, 0.0750977248f, 0.0717644989f, -0.118244939f,
+    0.24254787f, -0.56644839f, -0.138193384f, -0.139559641f, -0.164047211f, 0.163495526f,
+    -0.220622882f, -0.231447771f, -0.127237454f, 0.0432805493f, -0.194172546f, -0.181258976f,
+    0.088683717f, 0.152975321f, -0.752397716f, -0.495710075f, -0.740533412f, -0.397068501f,
+    -0.00107297546f, 0.335607022f, -0.0963102281f, -0.212175831f, -0.0794311836f, -0.0531841181f,
+    -0.557679534f, 0.073415488f, -0.254118502f, -0.141128212f
+  },
+  {
+    -0.0117708463f, 1.46165514f, 0.694688916f, -0.378499418f, -0.285975724f, -0.438866526f,
+    -0.226487577f, 1.77778721f, -1.66103292f, 0.275524586f, -0.0875317156f, -0.79188025f,
+    1.12035263f, 2.39069009f, -0.212442607f, 0.00322387344f, -0.00669325981f, -0.0710283518f,
+    0.0220750179f, 1.1446923f, -1.18712139f, -0.0845983997f, 0.0446179733f, -0.0893565863f,
+    0.87729013f, 0.408661306f, 0.848896563f, -0.0194720998f, 0.0354816802f, 0.047390949f,
+    0.624218583f, 0.249161124f, 2.17074656f, 1.02469921f, -0.578276813f, -0.967836857f,
+    0.0280076489f, -1.27673864f, 1.08995461f, 0.573875368f, 0.610720694f, -0.427874744f,
+    0.967730641f, -0.00716638751f, 0.0135954907f, -0.0783366337f
+  },
+  {
+    0.174434677f, 0.10709326f, 0.0491905957f, 0.138061479f, -0.133807167f, -0.155566886f,
+    0.0218488127f, 0.058229968f, 0.026533708f, -0.0935987234f, -0.07947281f, 0.180797145f,
+    0.0493085831f, -0.215590551f, -0.111459248f, 0.070193544f, -0.12272533f, 0.0298614055f,
+    0.162740454f, 0.189450666f, -0.00544574857f, 0.201239273f, -0.0803358704f, 0.110473439f,
+    -0.210867241f, -0.0521637499f, -0.183607802f, -0.162346333f, -0.101414293f, -0.00409333408f,
+    0.206787571f, 0.0575102717f, 0.046989426f, 0.0792036802f, -0.109404363f, -0.0475099385f,
+    -0.220157564f, 0.00669117272f, 0.127275392f, 0.0993341953f, 0.158620372f, 0.181155041f,
+    0.105737284f, 0.0839064568f, 0.1335565f, -0.0980703235f
+  },
+  {
+    0.14306508f, -0.0037525855f, 0.150123969f, -0.0243181251f, 0.173469082f, 0.110088937f,
+    0.190621793f, 0.0404149629f, -0.122111171f, -0.30117923f, 0.23270905f, -0.189569443f,
+    0.0898355618f, -0.215664536f, -0.17598708f, -0.1582883f, -0.158665001f, -0.209624588f,
+    -0.0587132871f, 0.0749106407f, -0.0561006293f, 0.155801311f, -0.172788247f, 0.175716966f,
+    -0.197802886f, -0.146392077f, -0.109699041f, 0.146382809f, -0.142031223f, -0.0558238849f,
+    -0.196954355f, 0.20471862f, -0.0834954306f, 0.06128411f, 0.125897527f, 0.12538752f,
+    0.0534031503f, -0.0508791655f, -0.204893515f, 0.102693163f, 0.0445685647f, -0.25355798f,
+    -0.157185331f, -0.248306721f, 0.0924175382f, 0.0845409855f
+  },
+  {
+    0.019639004f, -0.586845338f, -0.723928213f, -0.10133151f, 0.0143984118f, 0.415501565f,
+    0.590893328f, -1.28812253f, -0.293751717f, -0.735196471f, 0.114292108f, -0.489716619f,
+    -0.321323186f, -1.43119943f, -0.74523735f, -0.271664411f, 0.0751989111f, -0.102238044f,
+    0.537742198f, -0.232869729f, -0.0965075791f, -0.140028104f, -0.0445081927f, 0.00451474637f,
+    -0.586117327f, -0.232523933f, -0.659297824f, 0.121774793f, -0.0570648722f, 0.0230576508f,
+    0.191982284f, 0.16685842f, -1.60570943f, -0.72592032f, -0.898371994f, 0.00883864425f,
+    -0.325441658f, 0.961115539f, -0.430516958f, -0.493264407f, -0.727672517f, 0.164597288f,
+    -0.651180804f, 0.136289045f, 0.0759149492f, -0.174740449f
+  },
+  {
+    0.0159306061f, -0.0400877558f, 0.172936797f, 0.299607486f, -0.135505825f, 0.230361253f,
+    0.197611079f, 0.061107453f, 0.0703485757f, 0.108696274f, 0.163944557f, -0.0439918749f,
+    0.105644345f, 0.0586195439f, -0.259520888f, 0.000188736172f, -0.0990154073f, 0.222598106f,
+    -0.260245472f, 0.0559532493f, -0.19310455f, 0.0572035164f, -0.249760032f, -0.0645035654f,
+    0.160105288f, -0.144817248f, 0.266037434f, 0.142209053f, -0.0176321398f, 0.228683129f,
+    -0.0910843238f, -0.0861474425f, -0.144602746f, 0.0396976843f, -0.246265516f, -0.308795661f,
+    0.0571841225f, 0.125086784f, -0.180100486f, -0.0215869062f, 0.0394259989f, -0.175279826f,
+    0.0210341122f, 0.166241631f, -0.0196070205f, -0.110126562f
+  },
+  {
+    -0.156483293f, 0.000881039712f, -0.095451422f, 0.387571931f, -0.100963503f, -0.163294137f,
+    0.670332968f, -0.317859888f, -0.209120035f, -0.466747314f, 0.1364443f, -0.0567135923f,
+    0.0254469048f, -0.563604414f, -0.878751755f, 0.0826789066f, 0.125091761f, -0.103754319f,
+    0.207991868f, -0.297056168f, 0.0289470498f, -0.098477006f, 0.117233805f, 0.172062635f,
+    -0.162354052f, -0.226105973f, -0.120527096f, -0.0277508367f, -0.152559742f, 0.0342590772f,
+    -0.19077222f, 0.0251206513f, -0.680553913f, -0.522630274f, -0.610444784f, -0.327831f,
+    0.210843608f, 0.37579003f, -0.258657515f, 0.0895451382f, -0.216289848f, 0.0479861349f,
+    -0.505086601f, -0.0685817152f, -0.107010961f, 0.0813714564f
+  },
+  {
+    0.184602648f, 0.204005539f, 0.262495995f, -0.0415603928f, -0.164023757f, 0.263505667f,
+    -0.178165942f, 0.0126102231f, 0.13160041f, -0.139640942f, -0.00459082611f, -0.172523811f,
+    -0.0843489021f, -0.145545185f, 0.0607369244f, 0.131271124f, 0.280603945f, 0.182559684f,
+    -0.278050125f, -0.240151331f, -0.0183952097f, -0.0795547515f, -0.129643753f, 0.144784063f,
+    -0.129522264f, 0.14359042f, -0.0957409889f, 0.209312573f, -0.0639168993f, -0.0516913198f,
+    0.130790427f, -0.259439021f, 0.108712047f, 0.0921849981f, 0.0676580817f, -0.208979547f,
+    0.0650467798f, -0.053825777f, 0.0787828341f, -0.0416823626f, 0.119822718f, 0.0574729256f,
+    0.206591308f, 0.0656041428f, 0.0461896211f, 0.203219995f
+  },
+  {
+    -0.154050499f, -0.332263023f, -0.440525174f, -0.181333303f, -0.0859497339f, 0.156958207f,
+    0.0970883518f, -0.99055177f, -0.397570491f, -0.585341454f, 0.551883399f, -0.0360031389f,
+    0.0855843201f, -0.608519793f, -0.309312016f, 0.105330065f, -0.269343555f, -0.162889034f,
+    -0.0591057688f, -0.0194572452f, -0.0996769071f, -0.106559828f, -0.133915469f, 0.188826397f,
+    -0.216930687f, -0.312254578f, -0.243621886f, -0.0606683157f, -0.215884149f, -0.0270650815f,
+    0.172322482f, 0.109107904f, -0.743034124f, -0.498002291f, -0.448044688f, -0.482078671f,
+    -0.129072249f, 1.0658592f, -0.364433616f, -0.202008873f, 0.143681169f, -0.035481289f,
+    -0.167281523f, 0.0803820267f, 0.00740433903f, 0.0977289453f
+  },
+  {
+    0.0322580189f, 0.0296129063f, 0.303415447f, -0.199555561f, -0.147581562f, -0.243530393f,
+    -0.40177688f, 0.909059644f, -0.222635984f, -0.141124144f, -0.311716497f, 0.21386373f,
+    0.260749966f, 0.337712914f, -0.0330721661f, 0.129749671f, -0.124300279f, -0.0678307489f,
+    -0.0756508633f, 0.256490618f, -0.122649111f, -0.0731912926f, 0.167372853f, 0.264404386f,
+    0.0564187095f, 0.200343475f, 0.234610766f, 0.134103984f, -0.134969488f, -0.0370038599f,
+    0.0413992628f, 0.0766244456f, 0.575825453f, 0.629769027f, 0.192653447f, -0.0448227115f,
+    0.127778813f, -0.706381977f, 0.390982985f, 0.0097025428f, 0.132941902f, -0.146110222f,
+    0.129639819f, 0.140627936f, -0.150315419f, -0.220370859f
+  },
+  {
+    -0.000876843929f, 0.11533846f, -0.0422906727f, 0.195880488f, 0.046006605f, 0.193371907f,
+    0.00548987091f, 0.117799446f, -0.175468147f, 0.084686175f, -0.181259111f, -0.139313817f,
+    0.121896073f, -0.129741833f, -0.0183690041f, 0.21239154f, -0.0176423639f, -0.194507971f,
+    -0.20304659f, -0.105340548f, -0.0156186819f, -0.17641224f, 0.14742358f, 0.0498200208f,
+    0.0249743611f, 0.206120417f, -0.151414737f, 0.207109198f, 0.140978232f, 0.0707122535f,
+    0.0321973115f, 0.0576927811f, -0.126238406f, 0.0410388261f, 0.0827683657f, -0.102386057f,
+    0.0536801666f, -0.168202981f, 0.0101562589f, -0.0376614779f, -0.211423591f, -0.210654303f,
+    0.0046647042f, 0.183788821f, -0.189298123f, 0.10220252f
+  },
+  {
+    0.116957471f, 0.12073496f, -0.00980962068f, -0.141758874f, 0.028779678f, 0.0402548835f,
+    -0.242134556f, 0.00759957405f, -0.0173537675f, 0.0796676725f, 0.109264106f, -0.0533333421f,
+    0.0766831264f, 0.0422989763f, -0.150989622f, -0.00462553184f, 0.053235691f, 0.195640877f,
+    -0.188763231f, 0.00986461341f, -0.168256417f, 0.143853724f, -0.0813287124f, -0.27565816f,
+    0.182787567f, 0.00840680394f, 0.15548943f, 0.261865884f, -0.118808977f, -0.0820879936f,
+    0.248915225f, 0.106447734f, 0.184892312f, 0.128094986f, 0.0291888788f, 0.150663182f,
+    0.275081336f, 0.129030004f, 0.0603386946f, 0.0929444134f, 0.103094742f, 0.219644934f,
+    -0.047461126f, 0.0459752418f, 0.165828973f, 0.182266861f
+  },
+  {
+    -0.0466156118f, 0.0249941796f, -0.5769912f, 0.0368005335f, -0.0690142587f, 0.261744857f,
+    -0.296473622f, -0.890732646f, -0.771829188f, -0.767865121f, 0.00861542299f, 0.115076296f,
+    -0.596499622f, -0.975290954f, -0.726012707f, -0.121967793f, -0.225469515f, 0.260935754f,
+    0.350874126f, -0.459358364f, -0.252256244f, -0.173522398f, -0.0929927826f, 0.0801459029f,
+    -0.591601968f, 0.151644289f, -0.470849097f, -0.0198728666f, 0.154932722f, -0.0749810264f,
+    -0.242400914f, 0.11277286f, -1.46632445f, -0.691078126f, -0.864423573f, -0.206837803f,
+    -0.275093079f, 0.71157074f, -0.752975643f, -0.376903802f, -0.541521251f, 0.392151356f,
+    -0.473527819f, 0.12949273f, -0.142763063f, -0.00769587606f
+  },
+  {
+    0.123254322f, -0.123575218f, -0.0756253228f, -0.0826293379f, -0.143521786f, -0.119854741f,
+    -0.0350836515f, -0.240110278f, 0.231120333f, -0.281231016f, 0.214413047f, 0.00189220265f,
+    0.0669240206f, 0.184463754f, 0.122684129f, 0.273868442f, 0.0957962871f, -0.0785618201f,
+    0.0192481875f, 0.105234481f, 0.0979471877f, -0.188711122f, -0.287483394f, 0.0691680461f,
+    -0.144465342f, 0.211544812f, 0.293601632f, 0.177161351f, 0.276657015f, 0.067903772f,
+    -0.00934774708f, 0.0910875872f, 0.102245443f, -0.23484841f, 0.0709211603f, 0.0741346404f,
+    -0.0337405428f, 0.172953382f, 0.0883905664f, -0.0532393008f, -0.161453918f, 0.0662333518f,
+    0.274198174f, 0.25799349f, 0.089156881f, -0.0474197082f
+  },
+  {
+    -0.129702747f, -0.0792188272f, 0.156536207f, -0.272244751f, -0.0381397419f, -0.171645641f,
+    0.203388065f, 0.213097036f, -0.0275286753f, -0.16886349f, -0.0115234684f, 0.0729245692f,
+    0.0299713816f, -0.0864105001f, -0.119936064f, 0.150500536f, -0.122021236f, 0.132488012f,
+    0.137979537f, 0.0305424314f, 0.0866455883f, 0.204149216f, -0.131914914f, 0.288537562f,
+    0.10054177f, -0.0356348604f, -0.0672168955f, -0.151551411f, -0.0727014542f, -0.187392414f,
+    -0.0487726331f, -0.0523558967f, -0.168813467f, -0.059538424f, 0.157118529f, -0.0772270933f,
+    0.115672f, -0.232668236f, -0.109552711f, -0.272219896f, -0.12456011f, 0.114474252f,
+    0.098411046f, 0.00623612897f, 0.14267537f, -0.259382367f
+  },
+  {
+    0.105641343f, 0.149771109f, -0.0622845888f, -0.179657355f, 0.198916405f, -0.197153524f,
+    -0.00642663287f, 0.206786245f, 0.155326754f, -0.198760614f, -0.0747886077f, -0.0871626213f,
+    0.172174692f, 0.00598052423f, -0.0208802857f, 0.00710536679f, -0.129565582f, 0.217437044f,
+    -0.0723025873f, 0.0587070473f, 0.221426174f, -0.102002777f, -0.00597628439f, 0.100766703f,
+    0.212433234f, 0.0386608951f, 0.0733347312f, 0.128858253f, 0.0863007158f, 0.200492039f,
+    0.0766295865f, 0.108892001f, 0.0930524766f, -0.107330285f, -0.061691545f, -0.142964989f,
+    0.0929514766f, -0.16936785f, -0.0383353531f, 0.0080151502f, -0.0740360692f, -0.0637651756f,
+    -0.173393682f, -0.0238135774f, -0.00898153707f, 0.033647567f
+  },
+  {
+    0.0822878405f, -0.0758271515f, -0.00342741166f, -0.132271826f, 0.0667231232f, -0.221779257f,
+    0.0914035439f, 0.244393542f, -0.205836773f, -0.0958193615f, -0.243004471f, 0.183256671f,
+    0.0864715055f, -0.101237588f, -0.27334851f, -0.0495948195f, -0.192399174f, 0.0273297895f,
+    0.0915462598f, 0.110119686f, -0.00447769137f, 0.19413434f, 0.0155697651f, -0.10953927f,
+    -0.234487101f, -0.0751804411f, -0.068921797f, -0.212126166f, 0.0237285923f, -0.0682095736f,
+    -0.220779136f, 0.0599788949f, 0.151137248f, 0.0696432814f, -0.164835244f, 0.199967161f,
+    -0.0418653488f, -0.0046026879f, 0.00949468836f, -0.204819173f, -0.0706879348f, 0.0838561058f,
+    -0.23385939f, -0.0641279221f, -0.0466347337f, -0.167012811f
+  },
+  {
+    0.0154148275f, -0.251129508f, -0.15761739f, -0.208843455f, -0.261117399f, 0.127499893f,
+    0.0289546177f, -0.0958477333f, 0.154666945f, -0.257348925f, 0.161564007f, 0.118035041f,
+    0.0520334467f, -0.273594201f, -0.00624156231f, 0.10070575f, -0.215457469f, 0.0784358233f,
+    0.247632608f, 0.275891542f, -0.0654470846f, -0.0469855741f, 0.285772115f, 0.277756751f,
+    0.0511414148f, 0.124268338f, -0.119012728f, -0.243796378f, 0.099481374f, 0.00716509623f,
+    0.158890978f, 0.213615283f, 0.00258329068f, 0.0977389514f, 0.00610827142f, 0.109430984f,
+    -0.0287672281f, 0.0450601801f, -0.0988019109f, -0.281134516f, -0.089561142f, -0.00963621121f,
+    0.0229691379f, -0.0173973385f, -0.24685511f, 0.0343190394f
+  },
+  {
+    -0.310957134f, -0.571488321f, -0.465931386f, -0.0107897995f, 0.365163952f, 0.491055429f,
+    -1.36466503f, -1.43445468f, -0.0610325597f, 0.150851026f, -0.0360441431f, 0.18061474f,
+    -0.95000124f, -0.642427325f, -0.0871485472f, -0.00187683071f, -0.181085333f, 0.154597208f,
+    0.264295518f, -0.486637622f, 0.623891115f, 0.0545838475f, -0.193101496f, 0.129039243f,
+    -0.379639715f, -0.196985558f, -0.102738246f, -0.140480801f, 0.0770271197f, 0.148363993f,
+    -0.521289766f, -0.34274441f, -0.580019772f, -0.930312574f, 0.133690327f, 0.227114394f,
+    -0.323566467f, 0.718828976f, -0.491841823f, -0.317567796f, -0.474478573f, 0.10233473f,
+    -0.358739853f, 0.0481850579f, -0.00860255305f, -0.226461738f
+  },
+  {
+    0.0348051116f, -0.910369277f, -0.285214812f, 0.357795596f, 0.604035437f, 0.512840569f,
+    -0.576011121f, -1.33564472f, 0.985553145f, 0.669521928f, 0.504317462f, -0.783270121f,
+    -0.834645033f, -1.12209785f, -0.0148460185f, 0.233378589f, 0.0551104061f, -0.0319649167f,
+    0.542684197f, -0.661206067f, 0.538447201f, 0.281558067f, -0.0418091118f, 0.0538467839f,
+    -0.801978052f, 0.0130997868f, -0.430335611f, 0.0407260954f, -0.0603823438f, -0.0150396517f,
+    -0.048506394f, -0.430928797f, -1.06373537f, -0.776938736f, 0.713849902f, 0.54014641f,
+    -0.122768424f, 0.559134424f, -0.41159305f, -0.167658836f, -0.548142314f, 0.445713073f,
+    -0.615375698f, -0.0131669305f, -0.0568207987f, -0.0244648531f
+  },
+  {
+    0.161483362f, -0.226293728f, -0.0669572577f, -0.202930778f, -0.072043322f, -0.260073543f,
+    -0.196283743f, 0.302603751f, -0.0176632144f, 0.0455006026f, 0.116487131f, 0.104535542f,
+    0.0327552892f, 0.189125299f, 0.153313711f, -0.112186387f, -0.0367493629f, -0.256645858f,
+    -0.042957969f, -0.0329696275f, 0.0327014998f, 0.284023941f, -0.0700533167f, 0.0721387118f,
+    -0.0884179175f, -0.117170259f, 0.0476743206f, 0.00281542004f, -0.257748425f, -0.106504388f,
+    -0.0300311334f, -0.161702305f, 0.0275059715f, 0.135409668f, 0.0211329479f, 0.249083683f,
+    -0.132762715f, 0.0902706906f, 0.142343104f, -0.151667476f, -0.101402894f, 0.101462722f,
+    0.0804457814f, 0.0596527308f, 0.165993437f, -0.00379999634f
+  },
+  {
+    -0.680573821f, -1.40382779f, -1.28708935f, 0.183335394f, 0.197362423f, 0.357061803f,
+    1.83716846f, -2.55706191f, -0.225096807f, -0.100908957f, 0.0636957958f, -0.403021395f,
+    -0.731376171f, -1.97584426f, -0.696812093f, 0.0377651192f, -0.0406644158f, 0.0303488486f,
+    0.800372183f, -0.829875886f, 0.697146773f, -0.0486274138f, 0.0290995091f, 0.0019363407f,
+    -1.14891958f, -0.295307696f, -0.792118669f, -0.0683927983f, 0.011494359f, -0.0541536212f,
+    -0.192770526f, 0.0918582082f, -1.82427776f, -1.20139563f, -0.651792884f, 0.00819091965f,
+    -0.470870525f, 1.55010152f, -1.31828225f, -0.296787739f, -0.870102644f, 0.215565488f,
+    -0.562070072f, 0.0204615407f, 0.0159413051f, 0.0504673645f
+  },
+  {
+    -0.149835289f, -0.993996739f, -0.881526887f, 0.111060552f, 0.279258609f, 0.594504654f,
+    0.00566099491f, -2.39146161f, 1.30306673f, 0.153731644f, -0.209350005f, 0.0905926079f,
+    -0.707829356f, -1.48535144f, -0.264515698f, 0.0445885286f, -0.115256943f, -0.0365392044f,
+    0.65936166f, -0.776224315f, 0.68267709f, -0.125470534f, -0.0474385582f, 0.103916973f,
+    -0.678924024f, -0.36581859f, -0.694932401f, -0.118089549f, 0.10791871f, -0.17711471f,
+    -0.115734786f, -0.299414128f, -1.15660322f, -1.41080058f, -0.163842499f, 0.686183274f,
+    -0.391436636f, 1.02142251f, -0.928163528f, -0.38170135f, -0.665478766f, -0.00920755602f,
+    -0.320180684f, 0.0750451833f, -0.0574191622f, 0.185490847f
+  },
+  {
+    0.0185148325f, -0.82827723f, -0.484410286f, 0.584098637f, 0.480920464f, 0.340044796f,
+    0.263106167f, -1.32332373f, 1.16583824f, 1.24530172f, 0.379606247f, -0.438813865f,
+    -0.388612717f, -1.32968104f, -0.314330101f, 0.295443863f, 0.209383145f, -0.120933846f,
+    1.06643617f, -0.945134819f, 0.893895626f, 0.183686331f, -0.0599575825f, 0.0755834356f,
+    -0.700417161f, 0.308460385f, -0.685149014f, 0.0186519362f, -0.144445315f, 0.0303117186f,
+    0.261738509f, 0.0217370056f, -1.49451256f, -1.14189076f, 0.0774963796f, 0.325224847f,
+    -0.139940843f, 0.748926461f, -0.802238822f, -0.00835092459f, -0.850614011f, 0.337512165f,
+    -0.963569462f, -0.102660432f, -0.0568294935f, 0.0430029556f
+  },
+  {
+    -0.249653652f, 0.143563867f, -0.247273833f, 0.0292077549f, 0.052684851f, -0.326873183f,
+    0.00757204229f, 0.399031848f, -0.289862603f, -0.550378978f, -0.14291887f, 0.389302343f,
+    0.320003152f, 0.402098119f, 0.283981889f, -0.0123336855f, -0.134930208f, -0.085492231f,
+    0.0931271911f, 0.0330910198f, -0.019726662f, -0.102346525f, -0.00605904683f, -0.0240806527f,
+    0.33829242f, 0.205485418f, 0.311407536f, 0.197694898f, -0.152880251f, -0.0410198681f,
+    -0.0425731502f, -0.108071409f, 0.605915844f, 0.376305342f, -0.127445728f, -0.282007486f,
+    0.0923805684f, -0.40831247f, 0.208132401f, -0.0229070485f, 0.0832300559f, 0.0594618693f,
+    0.249846637f, 0.212501913f, -0.107505143f, 0.318763435f
+  },
+  {
+    0.255262107f, 0.198816359f, -0.106390677f, -0.119693324f, 0.253333688f, 0.170001f,
+    0.641305923f, -0.185737744f, -0.152216598f, 0.274716586f, 0.0679662228f, -0.361369312f,
+    -0.0437265635f, -0.228359103f, -0.129900277f, -0.143824473f, -0.207327947f, 0.00376545591f,
+    0.373839408f, 0.0761798471f, 0.199247479f, 0.108648904f, -0.146009237f, -0.203474715f,
+    -0.170886829f, 0.164379522f, -0.220605835f, -0.223604485f, -0.0901522413f, 0.199277535f,
+    0.0463927947f, 0.283457607f, -0.123992451f, -0.136594966f, -0.121903241f, 0.0715974942f,
+    -0.0305360481f, 0.193132922f, -0.273195982f, 0.0451075919f, -0.289657444f, 0.143549293f,
+    0.0462453924f, 0.14550969f, -0.0622115694f, -0.148733556f
+  },
+  {
+    0.0114070447f, 1.69026017f, 0.960942328f, -0.27576071f, -0.531345844f, -0.406110197f,
+    -2.12562418f, 1.71756816f, -0.0523357578f, -0.11823158f, -0.452335268f, 1.09856462f,
+    0.662095547f, 2.53860879f, 0.730577528f, -0.0306023844f, 0.152676865f, 0.0615277477f,
+    -1.33440244f, 0.792359769f, -1.41381896f, -0.0166451354f, -0.165093005f, -0.0578171201f,
+    0.916342258f, 0.286578923f, 1.04095411f, 0.0365253426f, -0.13272953f, -0.0121645601f,
+    -0.257401824f, -0.594509363f, 2.27713633f, 1.03518128f, 0.29563272f, -0.416341126f,
+    0.643782496f, -0.732874811f, 1.40980589f, 0.346139789f, 1.12027383f, -0.124941587f,
+    0.844952762f, -0.0306956507f, -0.00238769245f, -0.0389955305f
+  },
+  {
+    0.325172395f, -0.0444885194f, 0.145978063f, 0.00121913676f, -0.113083549f, 0.0593651272f,
+    -0.384253293f, 0.387891918f, 0.637609303f, 0.716201305f, -0.114286706f, 0.532413781f,
+    0.203821227f, 0.422458708f, 0.551383972f, 0.129976302f, -0.118989304f, 0.0461509787f,
+    -0.268367022f, 0.123590395f, 0.050287433f, -0.0472567976f, -0.112281941f, 0.0864881203f,
+    0.308340281f, 0.209595293f, 0.0207187477f, -0.156538442f, 0.238569275f, 0.196525648f,
+    -0.0316697545f, -0.0856845975f, 0.575896561f, 0.454916626f, 0.637757242f, 0.0487806574f,
+    0.162339926f, -0.618577957f, 0.400785327f, 0.254205048f, 0.100142241f, 0.33667165f,
+    0.0803228319f, -0.0330660753f, 0.106143281f, 0.0370153375f
+  },
+  {
+    0.018588068f, 0.499177277f, 0.96173805f, -0.319660217f, -0.365444601f, -0.300461799f,
+    -1.57797372f, 1.16527343f, 0.0251681581f, 0.304047018f, -0.364237994f, 0.762053847f,
+    -0.0340205245f, 1.00129139f, 0.53253901f, -0.0706556961f, -0.103487626f, 0.217571735f,
+    -0.623581707f, 0.477093607f, -0.501873136f, 0.0673089847f, -0.024464881f, -0.114759371f,
+    0.583141804f, 0.179552913f, 0.624682426f, 0.111146376f, 0.0489495918f, -0.13348873f,
+    -0.257914692f, -0.424445212f, 0.820050716f, 0.778469503f, 0.764661133f, -0.440079063f,
+    -0.0136955045f, -0.240880787f, 0.767159641f, 0.253529638f, 0.569374561f, -0.393980056f,
+    0.882673919f, -0.0184026398f, 0.0406158417f, -0.0813468397f
+  },
+  {
+    0.0195066091f, 0.155706868f, 0.211728349f, -0.149663284f, 0.0626459196f, -0.297807664f,
+    -0.964621961f, 0.674145103f, 0.430856675f, 0.367103577f, -0.233524844f, 0.640595913f,
+    -0.0190876964f, 0.842473507f, 0.21121332f, 0.104692012f, 0.0559226535f, -0.129446745f,
+    -0.183343545f, 0.419469804f, -0.366611004f, 0.0780891329f, 0.0146212038f, 0.106728278f,
+    0.150406882f, 0.305937856f, 0.158393502f, -0.107560642f, 0.207815126f, -0.140602142f,
+    -0.166409731f, -0.300092399f, 0.658451438f, 0.484377027f, 0.603699625f, 0.215371788f,
+    0.16644381f, -0.780776978f, 0.390648752f, 0.333161324f, 0.231854796f, 0.587916732f,
+    0.595951021f, 0.123629667f, 0.334065586f, 0.221895501f
+  },
+  {
+    0.0259127896f, 0.406330764f, 0.397020608f, -0.252486736f, 0.222452536f, -0.145582765f,
+    -0.698771358f, 0.710645795f, 0.337465525f, 0.190837532f, -0.185339868f, 0.724808574f,
+    -0.0236535408f, 0.74192512f, 1.01499701f, -0.0118717682f, 0.151636854f, 0.23347573f,
+    -0.374929219f, 0.480589628f, -0.0932557434f, -0.0248820707f, -0.277163088f, 0.118071504f,
+    0.00509645231f, -0.151338831f, 0.323803633f, -0.128427401f, -0.0136842299f, 0.0264760591f,
+    0.0825211108f, -0.354684681f, 0.751037121f, 0.487317115f, 1.00360072f, 0.255930334f,
+    -0.142514423f, -0.790069699f, 0.071452409f, -0.0333518945f, 0.144344866f, -0.211538419f,
+    0.426442593f, 0.0320037454f, 0.0620022975f, 0.192413181f
+  },
+  {
+    0.0581504591f, -0.165130183f, -0.12242309f, -0.129189804f, 0.383667648f, 0.184109613f,
+    0.22971043f, -0.892487168f, 1.60843909f, 0.563640118f, 0.567935467f, 0.262813181f,
+    -0.386670858f, -0.784942329f, 0.288648576f, -0.164228633f, 0.125263572f, 0.0063763042f,
+    0.260695547f, -0.0884391442f, 0.315769166f, 0.121725038f, -0.140808791f, 0.099114567f,
+    -0.328759789f, 0.0521377139f, -0.12320938f, -0.0514893495f, 0.070308432f, -0.0427874587f,
+    -0.0804006606f, 0.0516771488f, -0.86806798f, -0.209261805f, 0.14098613f, 0.235166535f,
+    0.0933164209f, 0.484489053f, -0.296241909f, -0.25538817f, -0.435097545f, -0.0707443804f,
+    -0.208822221f, -0.0885374695f, -0.120716631f, -0.116074435f
+  },
+  {
+    -0.168393329f, 0.0389605835f, -0.0740706846f, 0.0256011672f, 0.088165693f, -0.0817950442f,
+    0.269507647f, 0.115635186f, -0.194890633f, -0.0591848865f, -0.0243346877f, -0.265752077f,
+    0.227813378f, 0.241504937f, 0.208642721f, 0.0246576425f, 0.268240631f, 0.2737104f,
+    -0.199864641f, -0.0531793833f, -0.161973894f, 0.114420205f, -0.0237025749f, 0.145121649f,
+    0.0209878162f, 0.25720492f, 0.267968714f, 0.271887332f, 0.235705718f, -0.0279504154f,
+    0.170000151f, -0.00798797607f, 0.250617594f, 0.147154778f, -0.146536946f, 0.0665918291f,
+    0.251180649f, -0.0338241309f, -0.0219681356f, -0.0539560877f, 0.177399248f, 0.249303818f,
+    -0.0536306165f, -0.145811334f, 0.0568620823f, 0.0988469049f
+  },
+  {
+    -0.256451815f, -0.380259097f, -0.264122069f, 0.331851006f, -0.00304625719f, -0.119046092f,
+    -0.0101832412f, -0.978978276f, -0.818775833f, -0.410176843f, 0.223672867f, -0.29905045f,
+    -0.398378193f, -1.05313861f, -0.733128548f, 0.0323043838f, -0.0933976471f, 0.122561231f,
+    0.294540733f, -0.559378982f, -0.252044201f, 0.0543199293f, 0.0154751716f, -0.10399504f,
+    -0.417556524f, 0.0363831818f, -0.40863508f, 0.0835795105f, -0.0386341885f, 0.0232951958f,
+    -0.309305549f, -0.0910261944f, -1.11297309f, -0.976213098f, -0.643932939f, -0.110765055f,
+    0.0455638804f, 0.257579029f, -0.136731207f, 0.136737928f, -0.0926428884f, -0.0268052183f,
+    -0.193892166f, -0.0866882429f, -0.0354374722f, -0.235274047f
+  },
+  {
+    -0.041233141f, -0.171384737f, -0.141119227f, -0.00657587638f, 0.0629315749f, 0.192505062f,
+    0.0335333347f, -0.101328261f, 0.0589032993f, -0.268811941f, -0.127953902f, -0.00588279357f,
+    0.0816312432f, -0.110787779f, 0.0324185863f, -0.0134573933f, -0.20583576f, 0.0853731632f,
+    -0.0273739155f, 0.207210347f, -0.0639415309f, -0.127530858f, 0.235111028f, -0.152762637f,
+    -0.103257678f, 0.0664813221f, -0.0199670922f, -0.110786065f, 0.0185518786f, 0.0756319761f,
+    -0.162786573f, -0.152490422f, -0.352792352f, -0.249472588f, 0.0560884662f, -0.121823139f,
+    -0.110706925f, 0.344597995f, 0.0795242861f, 0.133007407f, -0.140568167f, -0.0702925846f,
+    -0.178711072f, 0.012916768f, -0.279212654f, -0.0738086477f
+  },
+  {
+    -0.340648472f, -0.167806432f, 0.0761614814f, 0.175313398f, -0.151848838f, -0.0832163543f,
+    0.436106682f, -0.461041182f, -0.368140072f, 0.161264718f, 0.633394718f, -0.577193081f,
+    -0.0290844236f, -0.49171567f, -0.418255955f, 0.174491107f, 0.039540723f, -0.135895804f,
+    0.360230178f, -0.566403329f, 0.0112158153f, -0.019291386f, -0.146752104f, 0.0888803378f,
+    -0.153663158f, -0.0937466696f, -0.0689715147f, 0.00229554623f, -0.163189337f, -0.226871178f,
+    0.0447496325f, 0.159905687f, -0.63908577f, -0.555466831f, -0.352545053f, -0.364953279f,
+    0.0295566227f, 0.604733825f, -0.228506073f, -0.203322023f, -0.239371911f, 0.211630747f,
+    -0.252332717f, 0.150844827f, -0.116791837f, -0.137198538f
+  },
+  {
+    -0.466054738f, 0.95961833f, 1.10951424f, 0.0709294528f, -0.269992679f, -0.210256085f,
+    -1.22117794f, 1.78501129f, 1.2213937f, 0.352921784f, -0.0821468383f, 1.8683759f,
+    0.152364105f, 1.8967489f, 1.08431017f, 0.143128648f, -0.137249336f, 0.162724629f,
+    -0.924690843f, 0.750012815f, -0.670669794f, -0.0613718145f, -0.0214748923f, 0.465193182f,
+    0.954507351f, 0.558270216f, 1.19115245f, -0.0942194983f, 0.063708432f, 0.0897829533f,
+    -0.612554371f, -0.747067869f, 1.72018123f, 1.0521524f, 0.953269303f, -0.151490778f,
+    0.549320042f, -1.08748996f, 1.50666559f, 0.636761487f, 1.0645957f, 0.670487821f,
+    0.925958276f, -0.0804506093f, 0.0117251286f, -0.0247029457f
+  },
+  {
+    -0.0816654041f, 0.000163985591f, -0.197346896f, 0.152093828f, -0.0163265355f, -0.136567071f,
+    -0.0349614248f, 0.0606139079f, 0.0431059562f, -0.0415849835f, -0.210241422f, -0.131817162f,
+    -0.160385236f, -0.170664743f, -0.143472493f, 0.0172666311f, 0.0577526465f, -0.146302015f,
+    -0.103017733f, -0.16984725f, -0.224040911f, -0.100747123f, 0.0916515142f, 0.0359014943f,
+    0.0654134601f, 0.0266239904f, 0.123267882f, 0.0605354048f, 0.129797637f, 0.0958125442f,
+    -0.0518947728f, 0.050384827f, -0.0519875921f, 0.172841236f, -0.102700181f, -0.0816660374f,
+    -0.133260429f, 0.0167172067f, -0.155452952f, -0.0780567974f, 0.100362889f, 0.0507465266f,
+    -0.104002595f, 0.151482493f, -0.0570182614f, 0.071392186f
+  },
+  {
+    -0.182020709f, -0.0998421535f, -0.123509519f, -0.278174162f, -0.256448597f, 0.0313980952f,
+    0.158426538f, 0.141559467f, -0.207463652f, 0.241648823f, 0.207846418f, -0.24332951f,
+    0.0562027134f, -0.210564196f, 0.151535809f, -0.111960605f, -0.284897596f, -0.0399405025f,
+    0.0533776283f, -0.140686288f, -0.0774156898f, 0.166289896f, -0.0709195733f, 0.207036749f,
+    0.0353829823f, 0.157708198f, -0.137216628f, -0.192298099f, 0.00979517587f, 0.0836285502f,
+    -0.147120595f, 0.0951926112f, -0.155378655f, -0.0660208166f, -0.203392401f, -0.0341281369f,
+    0.0305637401f, -0.0359101892f, 0.0298215896f, -0.177195176f, 0.110658571f, -0.158879489f,
+    -0.129083425f, -0.0549109578f, -0.25269264f, -0.132209495f
+  },
+  {
+    0.0517540984f, 0.0501220785f, -0.104503721f, -0.0142987119f, 0.0107878149f, 0.0780753195f,
+    0.0954778716f, 0.385896951f, 0.192382947f, 0.199155748f, -0.0888723657f, 0.297500908f,
+    -0.0546693541f, 0.0806397498f, 0.3521851f, -0.0627590567f, 0.0246421006f, 0.12673673f,
+    -0.222754031f, 0.251608849f, 0.0261019841f, -0.0856211856f, -0.252448082f, -0.199152529f,
+    0.104289301f, 0.171765566f, 0.0525061078f, -0.151720181f, -0.0124293827f, 0.0119762551f,
+    0.231974795f, -0.194450304f, 0.239857465f, 0.374280155f, 0.147550955f, -0.0836333781f,
+    -0.230702072f, -0.0331774987f, -0.136991605f, -0.140703604f, 0.179925859f, -0.141647279f,
+    -0.0891785398f, -0.00523066428f, 0.210135087f, -0.0320743322f
+  },
+  {
+    0.16248183f, -0.156879604f, 0.0486424714f, 0.209261701f, -0.104319721f, -0.213705838f,
+    0.0947213918f, 0.0995171815f, 0.166414842f, -0.114360102f, -0.204503536f, -0.105605491f,
+    -0.204371244f, -0.0731406808f, -0.0537858009f, -0.206563756f, -0.125004917f, -0.148999393f,
+    0.110267922f, -0.143195674f, -0.0993139893f, 0.0717293173f, 0.170761719f, -0.0773744583f,
+    0.15407972f, -0.0391433984f, 0.0460776836f, -0.197164789f, -0.168355018f, -0.215770915f,
+    0.0826206654f, -0.0725948364f, -0.0810492784f, -0.112635069f, -0.121980168f, 0.0850607604f,
+    -0.0638456196f, 0.0533345193f, 0.0739238411f, -0.210002765f, -0.0318474621f, 0.106221035f,
+    -0.0314810723f, 0.215526447f, 0.155057594f, -0.130680472f
+  },
+  {
+    0.00119237602f, 0.057262823f, -0.00980810821f, 0.214233533f, 0.151727453f, 0.0398098677f,
+    0.0674230605f, 0.191275701f, 0.159557298f, 0.173188433f, -0.185672984f, -0.172788441f,
+    -0.0766504258f, 0.227783993f, -0.192469254f, -0.127398968f, 0.15974997f, 0.0241146237f,
+    -0.200703025f, -0.0181058645f, -0.169722855f, -0.21253705f, 0.189701334f, 0.221181706f,
+    0.0685925633f, 0.105496779f, -0.0794180781f, 0.0806246549f, 0.198812887f, 0.125124946f,
+    -0.0272446275f, 0.201297447f, 0.207726881f, 0.0688815862f, -0.00413368642f, -0.0382266939f,
+    -0.194392353f, -0.107820593f, -0.218015373f, -0.198515534f, -0.190557703f, -0.047968477f,
+    0.128521189f, 0.0877831429f, 0.120411649f, 0.120247796f
+  },
+  {
+    -0.176514596f, -1.14752018f, -1.38332653f, 0.388944477f, 0.309250683f, 0.494842023f,
+    0.958432317f, -2.09255123f, 0.743462324f, 0.733113647f, 0.00163209368f, -0.251441807f,
+    -0.986350656f, -1.87731349f, -1.14869392f, 0.0279167984f, -0.0640098974f, 0.0864664689f,
+    0.751284003f, -0.726685107f, 0.974147975f, -0.0803778321f, 0.0507609136f, -0.0599319339f,
+    -0.786285698f, -0.33896634f, -1.16792166f, -0.127820462f, 0.081098482f, -0.151984513f,
+    -0.0187460668f, 0.15031001f, -1.93299472f, -1.70165801f, -0.689183652f, 0.586831272f,
+    -0.359154373f, 1.44640052f, -1.43801391f, -0.419635206f, -1.04624557f, 0.0262683425f,
+    -0.948033929f, 0.0247052889f, -0.00107134064f, 0.0275095068f
+  },
+  {
+    -0.0641397536f, -0.322865218f, -0.266289443f, 0.164524928f, 0.0176315177f, 0.0361806527f,
+    0.867420852f, -0.619059861f, -0.283932209f, -0.470530748f, 0.69831419f, -0.528041482f,
+    0.0567894578f, -0.9733513f, -0.202509671f, 0.0321252905f, -0.111645214f, -0.15407224f,
+    0.0683332384f, -0.449031085f, 0.461628467f, -0.139370233f, 0.0169346612f, 0.011506197f,
+    0.0211482942f, -0.323830158f, -0.217772499f, 0.0519269034f, 0.0475378186f, -0.0452480726f,
+    0.0257959068f, 0.329608589f, -0.866973877f, -0.613671541f, -0.388831645f, 0.0445441827f,
+    0.118384264f, 0.900956333f, -0.236068845f, -0.326784641f, -0.122336872f, -0.127063662f,
+    -0.286147565f, -0.247588545f, -0.191057652f, -0.0952458829f
+  },
+  {
+    0.0322695002f, 0.125058234f, -0.221489236f, -0.186306164f, 0.0287125595f, 0.0347313322f,
+    -0.0926454887f, 0.140083551f, 0.0585775934f, -0.122117586f, -0.211098373f, -0.0401905067f,
+    0.121383794f, -0.0494088866f, -0.074475117f, -0.238636538f, 0.102420896f, 0.00180891063f,
+    0.275825441f, 0.129208177f, 0.0916113928f, -0.151865751f, -0.0454996489f, -0.0874137506f,
+    0.0871391594f, -0.0675044507f, 0.032630641f, -0.253281474f, -0.219106629f, -0.283030897f,
+    0.123014048f, 0.00606755121f, -0.0851762742f, 0.0708507821f, -0.24286215f, 0.0152715622f,
+    0.0695734397f, -0.0250646472f, -0.0444985777f, -0.0295830872f, -0.0545061454f, 0.124192886f,
+    -0.156310022f, -0.0576319136f, 0.142653927f, 0.0341614336f
+  },
+  {
+    0.135716051f, 0.00145940762f, -0.24076426f, -0.275121957f, 0.143404797f, -0.234233886f,
+    -0.0341812819f, 0.185116366f, 0.0602909885f, 0.0145214209f, 0.135642305f, -0.0784871355f,
+    -0.239640385f, 0.109787524f, 0.0192987975f, -0.263285756f, -0.121102303f, -0.278089672f,
+    0.0921203494f, 0.211765394f, 0.170094192f, -0.102712974f, 0.101527132f, 0.221917421f,
+    -0.137838006f, 0.126549721f, -0.0225157626f, -0.0279330332f, -0.20687905f, -0.2923145f,
+    -0.155528829f, 0.0341507681f, -0.14796029f, 0.0485740602f, 0.172704041f, 0.144503549f,
+    -0.000167181628f, -0.284696937f, -0.0408303216f, -0.279443294f, -0.0449923351f, -0.195105642f,
+    0.109766528f, -0.0697292686f, -0.30678758f, -0.212045848f
+  },
+  {
+    -0.0127205318f, 0.189547643f, 0.323032975f, 0.023997644f, -0.237656862f, -0.357279778f,
+    1.38046968f, 0.652617216f, -0.806728065f, 0.0170704704f, 0.240713641f, -0.145041585f,
+    0.719725192f, 0.857147694f, 0.128880352f, 0.13469933f, -0.0634727925f, -0.110920511f,
+    -0.0990763977f, 0.497750282f, -0.493387073f, -0.0928019732f, 0.246822879f, -0.148294926f,
+    0.221373245f, 0.0387163274f, 0.314448982f, 0.0470569283f, 0.0856326595f, -0.13701193f,
+    0.40467751f, 0.300248057f, 0.329116076f, 0.688561022f, -0.418672413f, -0.481904924f,
+    -0.148865044f, -0.192033172f, 0.334413648f, -0.00534815341f, 0.0242602248f, -0.137554824f,
+    0.231577188f, 0.0192075465f, 0.114039794f, 0.0849474519f
+  },
+  {
+    0.20226191f, -0.0935413316f, -0.177473605f, -0.249616116f, 0.0374294557f, 0.187244713f,
+    0.397320211f, -0.383972436f, 0.589929402f, 0.0657821372f, -0.147198409f, 0.045562055f,
+    -0.149208754f, 0.0974917114f, -0.120138794f, -0.0377983116f, -0.114746094f, 0.0264682863f,
+    0.144982308f, 0.0178340618f, 0.262462497f, 0.0758791417f, -0.150595918f, -0.0468972251f,
+    -0.040549919f, -0.0162680671f, 0.137336656f, -0.0772561729f, 0.043667946f, 0.160835698f,
+    -0.0953227654f, 0.0403373502f, -0.270625353f, 0.149701551f, -0.125329107f, 0.0274154171f,
+    0.121027045f, 0.138968423f, -0.141933292f, -0.23319231f, -0.0363049358f, 0.167625993f,
+    0.00848093722f, -0.221379578f, -0.154044732f, -0.102113649f
+  },
+  {
+    0.458750963f, 0.214115039f, 0.308925867f, 0.0965827927f, 0.322953284f, 0.634753883f,
+    -0.02467498f, -0.735955417f, 1.3705889f, 0.111652948f, 0.259249598f, 0.297748297f,
+    -0.101336241f, -0.557661355f, 0.098531343f, -0.0761141255f, -0.0584408045f, 0.0425049923f,
+    0.0980231464f, 0.0981676355f, 0.352654666f, -0.0117378086f, 0.0431304723f, -0.0357927606f,
+    -0.19179596f, 0.0303137284f, -0.278654009f, -0.0874355957f, 0.05067477f, 0.0597657673f,
+    0.1631134f, -0.414129198f, -0.665361702f, -0.30949071f, 0.576173246f, 0.577092052f,
+    -0.16129972f, 0.861963809f, -0.407311231f, -0.293336689f, -0.357351661f, -0.392549634f,
+    -0.413586468f, -0.125043988f, -0.000941700244f, -0.255332559f
+  },
+  {
+    -0.0764086097f, 0.213368446f, -0.101920739f, 0.238433138f, 0.275610775f, -0.171476692f,
+    -0.232603744f, 0.0974874049f, -0.243460372f, -0.0121277478f, -0.255855203f, 0.16533573f,
+    0.0303275529f, -0.0157482121f, 0.0866550431f, 0.192587212f, 0.161812201f, -0.129504353f,
+    -0.257797569f, -0.13984026f, -0.252372086f, -0.178841382f, 0.0711987242f, -0.0127804549f,
+    0.114239335f, -0.155282199f, 0.143703654f, 0.163551405f, 0.112192668f, -0.0240017697f,
+    0.177136496f, -0.248474762f, -0.0757269487f, -0.00382866152f, -0.128499657f, 0.00906756148f,
+    0.175799981f, 0.0591711476f, 0.0466922708f, -0.0780370757f, -0.0371234305f, 0.222605228f,
+    0.0682791993f, 0.0178764295f, 0.206748575f, -0.0906893834f
+  },
+  {
+    -0.251203805f, 0.599960983f, 0.10574013f, -0.380200088f, -0.282651901f, -0.31406036f,
+    0.549052f, 0.660077989f, -1.04362178f, 0.503225982f, -0.642050862f, -0.245068878f,
+    0.912996054f, 0.968063116f, 0.038680356f, -0.0225496832f, -0.0377440117f, 0.00462062564f,
+    0.115538746f, 0.286752015f, -0.643197417f, 0.0523652993f, 0.0724673122f, -0.078278549f,
+    0.42834273f, 0.437856317f, 0.569493115f, 0.0673750341f, -0.0206940472f, -0.0553232208f,
+    0.566101611f, 0.508272231f, 0.757671893f, 0.364636809f, -0.443042934f, -0.865048349f,
+    0.171385348f, -1.14333689f, 0.510525048f, 0.443475902f, 0.73575145f, 0.623687267f,
+    0.458661824f, 0.101821847f, 0.130865261f, 0.378251731f
+  },
+  {
+    -0.0653189942f, -0.140570864f, 0.174179107f, -0.0382508039f, 0.182716429f, 0.459289908f,
+    0.510921776f, -0.965092719f, 0.763404429f, 0.55418396f, 0.279046088f, -1.15102327f,
+    -0.0568957403f, -0.731415033f, -0.0658812895f, 0.194775596f, 0.00680830143f, -0.144486517f,
+    0.551106453f, -0.625442803f, 0.512813926f, -0.0444231443f, -0.012331618f, -0.261952996f,
+    -0.182252362f, 0.0613657311f, -0.240502864f, -0.105296984f, -0.00557434512f, -0.0329519548f,
+    0.44390732f, 0.252560645f, -0.921370506f, -0.498544514f, 0.197352245f, 0.0734581277f,
+    -0.178864658f, 0.797200143f, -0.468072385f, -0.15912585f, -0.378175169f, 0.387963057f,
+    -0.596821547f, 0.0216996036f, -0.026451176f, -0.106751494f
+  },
+  {
+    -0.0747833699f, 0.0965105891f, 0.214236721f, 0.187093332f, 0.0646717548f, 0.0450297333f,
+    0.166267022f, 0.243519202f, -0.166580096f, -0.0127544943f, 0.0845568404f, 0.0900969431f,
+    -0.172348276f, 0.0331744701f, 0.118772402f, 0.133204803f, -0.0560541265f, 0.236057729f,
+    -0.227141663f, 0.112526834f, -0.0110896518f, -0.249133617f, -0.23411347f, -0.247024164f,
+    0.0522184521f, 0.0958404914f, -0.0536604784f, -0.043095246f, -0.183036074f, 0.255797416f,
+    0.128801584f, -0.0838873759f, -0.0675150678f, -0.203297079f, 0.0803261995f, 0.0992964134f,
+    0.159110397f, -0.10356582f, -0.0311272927f, 0.0892705023f, -0.137594432f, -0.0670868829f,
+    0.270442337f, -0.047045961f, -0.0392602831f, -0.000797096058f
+  },
+  {
+    -0.297318488f, -0.385854542f, -0.0227811504f, -0.123610944f, -0.17280668f, -0.228106514f,
+    0.459885716f, -0.592690825f, -0.621577561f, -0.423428595f, -0.0450645611f, -0.38679862f,
+    0.0473284461f, -0.528320312f, -0.143168941f, 0.128332332f, 0.0325175039f, -0.0989450812f,
+    0.15057756f, -0.0981257036f, -0.0695476159f, -0.0470854156f, -0.0691533238f, 0.0748712346f,
+    -0.21548894f, -0.0620907247f, -0.0150728915f, 0.126093701f, -0.0650611967f, -0.20917131f,
+    -0.173248664f, 0.302992642f, -0.519943416f, -0.160724759f, -0.485624582f, -0.223548681f,
+    -0.233079001f, 0.567533493f, -0.275293291f, -0.0197710544f, 0.0518726371f, -0.134076461f,
+    -0.096967645f, -0.178687528f, -0.0395504199f, -0.0975387171f
+  },
+  {
+    -0.119755216f, -0.186181635f, -0.0639615953f, 0.133558363f, -0.21535483f, 0.126844838f,
+    -0.0851606876f, 0.0763883442f, 0.0793892294f, -0.103169248f, 0.103700124f, 0.0831329077f,
+    -0.0795813054f, -0.0390603878f, 0.158643246f, 0.159322977f, -0.232139096f, 0.150398582f,
+    -0.0321885459f, -0.211553067f, 0.324486643f, -0.0250547733f, 0.184465095f, -0.0780530944f,
+    0.113740608f, 0.0247869398f, -0.166418046f, -0.0882178098f, -0.263780326f, 0.169471487f,
+    0.0835507363f, 0.15898025f, -0.0516820699f, 0.0520396531f, 0.286186457f, -0.0298796296f,
+    0.248724148f, 0.370634288f, 0.0475263558f, 0.123600647f, -0.182446957f, -0.188957751f,
+    0.0729698837f, 0.131767347f, -0.102746136f, 0.113743469f
+  },
+  {
+    0.0934701934f, -0.507627547f, -0.571039736f, 0.237360537f, 0.265069783f, 0.214139268f,
+    -0.530351102f, -0.871541977f, -0.0537342802f, -0.271069258f, 0.393522352f, -0.143547043f,
+    -0.67665875f, -0.676398873f, -0.656634271f, 0.119019754f, 0.080178529f, 0.0393639691f,
+    -0.0375075117f, -0.254631549f, 0.299818188f, -0.100538023f, 0.0124848038f, -0.0823827907f,
+    -0.356324553f, -0.434576154f, -0.226325363f, 0.0641537532f, -0.178650782f, 0.0968669802f,
+    -0.570501626f, 0.00610761438f, -1.12635374f, -0.329047859f, -0.264739335f, -0.0308981501f,
+    -0.346465737f, 0.873038948f, -0.483654648f, -0.217784986f, -0.452769369f, -0.452621996f,
+    -0.474248677f, -0.242126554f, -0.117446125f, -0.309307337f
+  },
+  {
+    -0.0506395102f, 0.167543754f, 0.0950608402f, -0.127023637f, -0.13142401f, -0.101211011f,
+    0.0945753306f, -0.157542646f, 0.0110621303f, 0.140279964f, 0.0306085795f, -0.0539202094f,
+    0.210640296f, 0.042874977f, -0.0829367489f, 0.126026019f, 0.0596441478f, 0.104460701f,
+    -0.121183328f, -0.142517939f, -0.0591286868f, 0.204869881f, -0.132131636f, -0.194204912f,
+    -0.132762924f, 0.208463863f, 0.149067625f, -0.201602295f, -0.167360395f, -0.136932343f,
+    -0.10213086f, 0.222678229f, -0.221440986f, -0.140554979f, 0.211775765f, -0.0406847447f,
+    -0.190719277f, 0.217085972f, -0.100127339f, -0.0392147899f, -0.212222174f, -0.198967427f,
+    0.00771526992f, -0.0369662493f, -0.0531849563f, -0.091416508f
+  },
+  {
+    0.0264402442f, 0.312602878f, 0.335136205f, 0.0199712422f, 0.0573115349f, 0.372233957f,
+    -0.0318669043f, 0.0143080549f, 0.117901199f, -0.130108088f, 0.15847905f, -0.231080964f,
+    -0.01686012f, -0.00236839266f, 0.0640723333f, 0.266390651f, 0.059377104f, 0.119426206f,
+    -0.262144625f, -0.318870574f, -0.00105417974f, -0.301676154f, -0.167659104f, -0.238986775f,
+    0.194691911f, 0.100407906f, 0.316185415f, 0.104183853f, 0.0297486782f, 0.108125016f,
+    0.044544965f, 0.0239728689f, -0.246468902f, -0.181826621f, 0.218598798f, 0.0124542424f,
+    -0.0385687798f, -0.0623918511f, 0.00725704292f, 0.338090152f, 0.233638048f, -0.0470306724f,
+    0.327392787f, -0.0227243826f, 0.00399390748f, 0.0166976452f
+  },
+  {
+    0.230773225f, 0.135894552f, -0.0724667311f, -0.0351301357f, 0.0946582705f, -0.0794470012f,
+    0.0160000715f, 0.156045511f, -0.174378008f, 0.139423728f, -0.0508382022f, -0.0090316413f,
+    0.0831376538f, -0.104268968f, 0.100071654f, -0.159289211f, 0.24633351f, -0.185217202f,
+    -0.130730972f, -0.155379102f, 0.116337784f, -0.256442457f, -0.255763948f, 0.12875165f,
+    0.125204712f, 0.164639667f, -0.12565659f, 0.24917759f, 0.127943605f, 0.10477221f,
+    0.0222814679f, 0.199934617f, -0.155647635f, 0.0718245283f, -0.104105555f, 0.00550428312f,
+    0.0159405582f, -0.0138023542f, 0.0969656706f, 0.242989212f, 0.0220732819f, -0.04808015f,
+    -0.0474988781f, 0.13027598f, 0.110007636f, 0.0282203685f
+  },
+  {
+    -0.148423821f, -0.118122377f, 0.00502027571f, -0.0601536483f, 0.125863567f, -0.0360053331f,
+    0.204865828f, -0.11111442f, -0.123435847f, 0.17306672f, -0.00723025203f, -0.00399568677f,
+    -0.103290617f, 0.0121186227f, 0.120676115f, 0.0810637623f, 0.0839978904f, -0.192703977f,
+    -0.120294727f, 0.103354618f, 0.209687814f, -0.093846187f, -0.210828841f, 0.0360781997f,
+    -0.101694331f, 0.0452960879f, -0.088752225f, 0.166852936f, 0.191947475f, 0.0855120569f,
+    0.212012127f, 0.0726528913f, 0.0731948763f, 0.226420507f, -0.206812575f, 0.0518927723f,
+    -0.172108695f, -0.154153898f, 0.107222542f, 0.20859845f, 0.134226874f, 0.120258734f,
+    -0.207637951f, 0.120297626f, -0.0676602274f, 0.0567497164f
+  },
+  {
+    -0.100634314f, -0.200787649f, -0.218686447f, 0.148928106f, 0.0903650299f, 0.146928892f,
+    0.971637189f, -0.68970567f, -0.828184783f, -0.584715664f, 0.155667439f, -1.02857566f,
+    0.132483035f, -0.533292294f, -0.743414879f, -0.0625000373f, -0.154827952f, -0.0713752061f,
+    0.353126377f, -0.485324979f, 0.0097364122f, -0.22086376f, 0.0291016512f, 0.227340192f,
+    -0.042494081f, 0.204138994f, -0.314773798f, -0.00404136814f, -0.173422948f, -0.0544105098f,
+    -0.0531019978f, 0.183515191f, -0.321470201f, -0.62139827f, -0.610717416f, -0.194006622f,
+    -0.13716197f, 0.562540948f, -0.492906839f, 0.222238913f, -0.165681109f, 0.0359319784f,
+    -0.30701676f, 0.162333742f, 0.0596801974f, -0.108107962f
+  },
+  {
+    -0.0713886321f, 0.0896024257f, 0.0890296698f, -0.103643976f, 0.0288155414f, -0.213817164f,
+    0.0543074496f, -0.0439851061f, -0.114513226f, -0.226798713f, 0.153143406f, -0.189042032f,
+    -0.156058595f, -0.219705284f, 0.165643677f, 0.0202622321f, -0.00646339869f, 0.226886094f,
+    0.191555932f, 0.177179337f, 0.0229623616f, 0.112619109f, 0.211417243f, 0.0510731041f,
+    0.0141401794f, -0.13808848f, 0.217679024f, 0.00984480884f, -0.185952753f, -0.134009212f,
+    0.015780706f, 0.0185239445f, -0.0811425969f, -0.0947882012f, 0.109525405f, -0.0212698579f,
+    -0.214279145f, -0.098591283f, -0.225044861f, -0.0148892794f, -0.129525825f, 0.0455054566f,
+    0.12953645f, -0.160092726f, -0.0469896272f, -0.126251906f
+  },
+  {
+    0.349125147f, 0.156352133f, -0.298753858f, -0.142178342f, 0.460449964f, 0.414290577f,
+    1.03769505f, -0.641180813f, -0.0594551712f, 0.373860002f, 0.429630816f, -0.570028365f,
+    0.883546889f, -0.64445132f, -0.873428226f, 0.0601669289f, 0.372021675f, -0.117630765f,
+    0.539013743f, -0.331571728f, -0.0386667065f, -0.250047356f, 0.161960885f, -0.203996152f,
+    -0.490074396f, 0.208164468f, -0.235998243f, -0.0397385582f, -0.00881254394f, -0.113781147f,
+    1.01909935f, 0.607909977f, -0.52633661f, -0.663829982f, -0.461260229f, 0.0866423994f,
+    -0.221945897f, 0.22619094f, -0.596171439f, -0.057309363f, -0.28260994f, 0.254673153f,
+    -0.0868218243f, -0.0353265293f, -0.212681279f, 0.0418032482f
+  },
+  {
+    0.213084504f, 0.0611009188f, 0.0843058303f, 0.213406354f, 0.128009498f, -0.16845189f,
+    0.113843232f, 0.30857569f, -0.00717356848f, -0.196373418f, 0.127575979f, 0.232429698f,
+    -0.124369919f, -0.0727317631f, -0.0812668577f, -0.061524041f, -0.0467102192f, -0.14302586f,
+    0.0802810192f, -0.0764217973f, -0.0452572815f, 0.163081139f, -0.223812893f, -0.135004088f,
+    0.0211167932f, -0.108296961f, 0.143764958f, 0.201886937f, -0.0998583212f, 0.0945866033f,
+    0.099221617f, -0.208939224f, 0.274508297f, 0.18799445f, -0.0627191737f, -0.177469388f,
+    -0.0415709019f, -0.0827115774f, -0.0464003906f, 0.0914686024f, 0.130674705f, -0.0087185679f,
+    -0.0318285488f, 0.122998022f, 0.224820569f, 0.031821534f
+  }
+};
+
+constexpr float kHiddenBias[69] = {
+  0.045224335f, -0.743227184f, -0.30966565f, 0.151074558f, 0.332068175f, 0.340750813f,
+  -1.20304918f, 0.0f, 0.0247441195f, 0.746685922f, 0.124815114f, 0.348954469f,
+  0.0501158647f, 0.469748437f, -0.458910197f, 0.0f, 0.0387612134f, 0.607498288f,
+  0.0753276646f, -0.0592164807f, -9.1892085e-05f, -0.0552173331f, -0.05915685f, 0.63236475f,
+  0.768199682f, -0.0740203708f, 1.37828159f, 1.25383973f, 0.906852663f, -0.290308088f,
+  0.196053326f, -1.1119715f, -0.340652883f, -0.510663986f, -0.523227215f, -0.450010657f,
+  0.423347354f, 0.0597267598f, 0.431846589f, 0.139721662f, 0.414779931f, -1.16826773f,
+  -7.1520546e-05f, -0.0618455186f, -0.150751948f, 0.0f, 0.0f, 1.54384625f,
+  0.530321062f, -0.0609804317f, -0.0724980682f, -0.380011499f, 0.0466283634f, 0.590412617f,
+  0.0223483536f, -0.879709125f, 0.567326844f, 0.0315690674f, 0.266850591f, 0.0118082771f,
+  0.490223408f, 0.0f, 0.161187261f, 0.0127763404f, 0.0f, 0.4158687f,
+  -9.15768669e-06f, 0.343371809f, 0.0039297645f
+};
+
+constexpr float kOutputWeights[2][69] = {
+  {
+    0.233284429f, -0.417332888f, -0.262315273f, -0.128926486f, 0.0963065624f, 0.0029675744f,
+    -0.566310108f, 0.0850307569f, 0.0318184607f, 0.245749965f, 0.17899482f, 0.118681833f,
+    0.0489140004f, -0.0276039969f, -0.205052882f, -0.18989636f, -0.222132415f, 0.664271593f,
+    0.0370830223f, 0.160502255f, -0.324828535f, 0.155847132f, -0.134030655f, 0.186397806f,
+    0.243414134f, -0.159404203f, 0.518900096f, 0.45879063f, 0.0189286824f, -0.118080333f,
+    -0.15884918f, -0.517735422f, -0.268407822f, -0.558066785f, -0.0560396798f, -0.351619095f,
+    0.476589411f, -0.181601867f, 0.284999758f, 0.250455528f, 0.185071602f, -0.198162019f,
+    -0.164623991f, 0.287173331f, 0.0421288945f, 0.0133213988f, -0.104416706f, 0.441390187f,
+    0.113519996f, 0.26673156f, -0.168580636f, -0.295153439f, 0.125599116f, 0.360704094f,
+    0.0452766605f, -0.341017872f, 0.412936151f, -0.0815186054f, 0.179127246f, 0.0458778292f,
+    0.0971111879f, 0.0465102568f, 0.118823752f, 0.199278414f, 0.0242102966f, 0.174992755f,
+    -0.210278407f, 0.432439178f, -0.0872831345f
+  },
+  {
+    0.00929731876f, 0.640588105f, -0.0455011316f, -0.209904179f, -0.00601372495f, -0.221643135f,
+    0.538804591f, -0.0919776261f, -0.0513505563f, -0.620601535f, -0.202528402f, -0.166609302f,
+    0.213841066f, -0.223493665f, -0.0741232485f, 0.0376369581f, 0.17266053f, -0.67066896f,
+    -0.0182945132f, 0.145204023f, 0.323586226f, 0.238142699f, -0.253721237f, -0.271230578f,
+    -0.643882036f, 0.2422501f, -0.933305681f, -0.53096664f, -0.507932007f, 0.0450431034f,
+    -0.245831713f, 0.4704023f, 0.199917182f, 0.548587441f, 0.393350065f, -0.124462835f,
+    -0.137376621f, 0.232113302f, -0.273450881f, -0.144008845f, 0.0715083033f, 0.576173186f,
+    0.307784498f, -0.218592465f, 0.045440305f, 0.173154205f, -0.0230007563f, -0.520605922f,
+    -0.413403541f, -0.207793564f, 0.0199998301f, 0.107987978f, 0.154539168f, -0.0489325635f,
+    0.167964011f, 0.24595578f, -0.651355267f, 0.254703254f, -0.0187425837f, 0.22854875f,
+    -0.267087489f, 0.0663535595f, 0.0522242002f, 0.256161869f, 0.0844528675f, -0.181410834f,
+    -0.165709764f, -0.164149985f, -0.038589783f
+  }
+};
+
+constexpr float kOutputBias[2] = {
+  -0.0345527492f, 0.0345530882f
+};
+
+/**
+* @brief  infer(): Run the model on the features
+*
+* @param const float in[]: The features of the signal.
+* @param float out[]: The two outputs of the model (no fall, fall).
+* @return void
+*
+**/
+inline void infer(const float in[kInputs], float out[kOutputs]) {
+  // FULLY_CONNECTED and TANH
+  float hidden[kHidden];
+  for (int o = 0; o < kHidden; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kInputs; d++) {
+      total += in[d] * kHiddenWeights[o][d];
+    }
+    hidden[o] = std::tanh(total + kHiddenBias[o]);
+  }
+
+  // FULLY_CONNECTED
+  float logits[kOutputs];
+  for (int o = 0; o < kOutputs; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kHidden; d++) {
+      total += hidden[d] * kOutputWeights[o][d];
+    }
+    logits[o] = total + kOutputBias[o];
+  }
+
+  // SOFTMAX with beta 1
+  float max_coeff = logits[0];
+  for (int i = 1; i < kOutputs; i++) {
+    if (logits[i] > max_coeff) max_coeff = logits[i];
+  }
+  float exp_sum = 0.0;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] = std::exp((logits[i] - max_coeff) * 1.0f);
+    exp_sum += out[i];
+  }
+  float reciprocal_sum_exp = 1.f / exp_sum;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] *= reciprocal_sum_exp;
+  }
+}
+
+}  // namespace fall_model_f46_3_aot
+
+#endif  // FALL_MODEL_F46_3_AOT_H_
@@ -0,0 +1,503 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_3_int8.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    The int8 quantized version of the model f46_3, in a C byte array form
+  *
+  *
+  *
+  *
+**/
+
+// Generated from the float model with the host tool:
+// quantize_model --out adaptive_fall_detection_system f46_3
+
+#include "fall_model_f46_3_int8.h"
+
+// We need to keep the data array aligned on some architectures.
+#ifdef __has_attribute
+#define HAVE_ATTRIBUTE(x) __has_attribute(x)
+#else
+#define HAVE_ATTRIBUTE(x) 0
+#endif
+#if HAVE_ATTRIBUTE(aligned) || (defined(__GNUC__) && !defined(__clang__))
+#define DATA_ALIGN_ATTRIBUTE __attribute__((aligned(16)))
+#else
+#define DATA_ALIGN_ATTRIBUTE
+#endif
+
+const unsigned char fall_model_3_int8_data[] DATA_ALIGN_ATTRIBUTE = {
+  0x24, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb0, 0x15, 0x00, 0x00, 0xa4, 0x15, 0x00, 0x00,
+  0xc0, 0x08, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x00,
+  0x6c, 0x06, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00,
+  0xf8, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00,
+  0xc4, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x51, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x62, 0x79,
+  0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x58, 0x14, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00,
+  0xec, 0x05, 0x00, 0x00, 0x88, 0x05, 0x00, 0x00, 0x4c, 0x05, 0x00, 0x00,
+  0x0c, 0x05, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00,
+  0x44, 0x03, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19,
+  0xd6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xde, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x72,
+  0xfa, 0xff, 0xff, 0xff, 0x00, 0x1c, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x66, 0x65, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x00, 0x00,
+  0xc6, 0xf8, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0xa5, 0xf7, 0xeb, 0x3e, 0x08, 0x8d, 0x8b, 0x3f, 0xe0, 0x5e, 0x1f, 0x3f,
+  0x57, 0xa6, 0xc7, 0x42, 0x6c, 0xc3, 0x50, 0x42, 0xbd, 0x77, 0x59, 0x42,
+  0xf6, 0x14, 0x52, 0x3f, 0xa0, 0xd7, 0x7e, 0x3f, 0x9a, 0xa4, 0x4a, 0x3f,
+  0xf7, 0x60, 0xfe, 0x40, 0xb3, 0xcd, 0x86, 0x41, 0xda, 0x60, 0x7c, 0x40,
+  0x00, 0x6c, 0x50, 0x40, 0x00, 0xf0, 0x71, 0x3f, 0x00, 0x4c, 0x2d, 0x40,
+  0xe6, 0x1a, 0x87, 0x43, 0x00, 0xe2, 0x6e, 0x43, 0x00, 0xfe, 0x7d, 0x43,
+  0xcf, 0x56, 0x72, 0x40, 0x00, 0xc4, 0xea, 0x40, 0x00, 0xbc, 0x61, 0x40,
+  0x00, 0x00, 0x80, 0x43, 0xf5, 0x1b, 0x62, 0x43, 0x00, 0x00, 0x80, 0x43,
+  0xf3, 0xab, 0x93, 0x40, 0x00, 0x81, 0x04, 0x41, 0x00, 0x84, 0xc7, 0x40,
+  0x00, 0xff, 0xfe, 0x43, 0x00, 0xe5, 0xb2, 0x43, 0x00, 0xff, 0xfe, 0x43,
+  0x00, 0x78, 0xfa, 0x3f, 0x67, 0xb7, 0xf0, 0x3f, 0x55, 0x65, 0x60, 0x3f,
+  0xab, 0xa6, 0xdf, 0x40, 0x55, 0x6d, 0x21, 0x40, 0x55, 0xfd, 0x4d, 0x40,
+  0x79, 0x97, 0xee, 0x40, 0x4b, 0xba, 0x2d, 0x3f, 0x29, 0xdb, 0x8e, 0x3f,
+  0x33, 0xbb, 0x1c, 0x40, 0x4b, 0x8f, 0x4b, 0x40, 0x00, 0xd8, 0xde, 0x40,
+  0x00, 0xcc, 0x64, 0x40, 0x00, 0xff, 0xfe, 0x43, 0x00, 0x7c, 0x9e, 0x43,
+  0x00, 0x47, 0x9f, 0x43, 0xae, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xb2, 0xf9, 0xff, 0xff,
+  0x00, 0x00, 0x80, 0x3f, 0x5a, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x30, 0xed, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xdc, 0xed, 0xff, 0xff,
+  0x4c, 0xfd, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x64, 0x65, 0x6e,
+  0x74, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0xee, 0xff, 0xff,
+  0x7c, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x44, 0xee, 0xff, 0xff, 0xba, 0xee, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xb4, 0xee, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2d, 0x13, 0x1e, 0x3d, 0xa4, 0xee, 0xff, 0xff, 0x1a, 0xef, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0xef, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbc, 0xce, 0x70, 0x38, 0xe6, 0xfb, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa6, 0xfd, 0xff, 0xff,
+  0x5a, 0x02, 0x00, 0x00, 0x82, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x7c, 0xef, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbc, 0xce, 0xf0, 0x3b,
+  0x56, 0xfc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+  0x20, 0xc7, 0xdc, 0xee, 0x0d, 0x00, 0xb3, 0x0c, 0x04, 0x21, 0x18, 0x10,
+  0x07, 0xfc, 0xe4, 0xe6, 0xe2, 0x5a, 0x05, 0x16, 0xd4, 0x15, 0xee, 0x19,
+  0x21, 0xea, 0x47, 0x3e, 0x03, 0xf0, 0xea, 0xba, 0xdb, 0xb4, 0xf8, 0xd0,
+  0x41, 0xe7, 0x27, 0x22, 0x19, 0xe5, 0xea, 0x27, 0x06, 0x02, 0xf2, 0x3c,
+  0x0f, 0x24, 0xe9, 0xd8, 0x11, 0x31, 0x06, 0xd2, 0x38, 0xf5, 0x18, 0x06,
+  0x0d, 0x06, 0x10, 0x1b, 0x03, 0x18, 0xe3, 0x3b, 0xf4, 0x01, 0x57, 0xfa,
+  0xe3, 0xff, 0xe2, 0x49, 0xf3, 0xf9, 0xac, 0xe4, 0xe9, 0x1d, 0xe2, 0xf6,
+  0x05, 0x17, 0xa5, 0xfe, 0x14, 0x2c, 0x20, 0xdd, 0xdb, 0xa8, 0x21, 0x81,
+  0xb8, 0xbb, 0x06, 0xdf, 0x40, 0x1b, 0x4b, 0x36, 0xef, 0xed, 0x20, 0xdb,
+  0xec, 0x0a, 0x4e, 0x2a, 0xe2, 0x06, 0x18, 0xfd, 0xb9, 0xc8, 0xe4, 0x03,
+  0x0f, 0x15, 0xf9, 0x17, 0x21, 0xa7, 0x23, 0xfd, 0x1f, 0xdc, 0x09, 0x07,
+  0x23, 0x0b, 0xe7, 0xe9, 0xea, 0xfb, 0x00, 0x00, 0x76, 0xf0, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x74, 0xf0, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0x60, 0xf0, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x74,
+  0x61, 0x6e, 0x68, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x90, 0xf0, 0xff, 0xff, 0x0c, 0x00, 0x10, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0xd4, 0xf0, 0xff, 0xff, 0x4a, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x44, 0xf1, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x3e, 0x9a, 0x40,
+  0x34, 0xf1, 0xff, 0xff, 0xaa, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
+  0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x9c, 0xf1, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfa, 0x42, 0x27, 0x3c, 0x76, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x14, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff,
+  0xe2, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x22, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0xd3, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+  0x3e, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0x87, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+  0xe4, 0xff, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00, 0x93, 0xff, 0xff, 0xff,
+  0xdf, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff,
+  0xd4, 0xff, 0xff, 0xff, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x8e, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
+  0xf1, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x97, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
+  0xf9, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+  0x3a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xff,
+  0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0xf3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x24, 0xf3, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb6, 0x9b, 0xa6, 0x3f,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x66, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x0e,
+  0x32, 0x33, 0x00, 0x00, 0xff, 0xf7, 0xe9, 0xcf, 0x00, 0x00, 0x01, 0x2c,
+  0x05, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0xf6, 0x19, 0x1c, 0x00, 0x01, 0x00, 0xf6, 0xfc, 0xf7,
+  0x00, 0x01, 0x01, 0x06, 0x01, 0xfe, 0x01, 0x01, 0x02, 0x16, 0x12, 0xde,
+  0x00, 0x04, 0x02, 0x2c, 0x36, 0xc1, 0x02, 0x01, 0x02, 0x00, 0x0d, 0xec,
+  0x01, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0x01, 0x14, 0x0d, 0xef, 0x00, 0x00, 0x00, 0x09, 0xf8, 0xf8, 0x00, 0x01,
+  0x00, 0x01, 0x05, 0x01, 0x00, 0x00, 0x01, 0x0d, 0xf9, 0xff, 0x00, 0x03,
+  0x00, 0xda, 0x0a, 0x07, 0x01, 0xff, 0x00, 0x48, 0xcf, 0x32, 0x00, 0x00,
+  0x00, 0x03, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98,
+  0xc0, 0xfe, 0x00, 0x00, 0x00, 0xfd, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xff, 0x00, 0x00, 0x00, 0x37, 0x13, 0x1d, 0xff, 0xff, 0x00, 0xe5,
+  0xd7, 0xd4, 0x01, 0x00, 0x00, 0xd9, 0x48, 0x52, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7f, 0xdd, 0x1f,
+  0x00, 0x00, 0x00, 0x15, 0x0a, 0xff, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00,
+  0xff, 0xff, 0x00, 0x18, 0x1c, 0x1d, 0x01, 0xff, 0x00, 0xef, 0x27, 0x01,
+  0xff, 0x00, 0x00, 0x21, 0xcf, 0x05, 0xff, 0x00, 0x00, 0xfd, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x15, 0xef, 0xcd, 0x00, 0x00,
+  0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x00, 0x00,
+  0xff, 0x10, 0x0d, 0xe9, 0x01, 0xfd, 0x00, 0xe5, 0xe4, 0x20, 0xff, 0xff,
+  0xff, 0x11, 0xcb, 0xb9, 0x00, 0x00, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0x1d, 0xc2, 0xdd, 0x00, 0x01, 0x00, 0xe3,
+  0xf5, 0xee, 0x00, 0x01, 0xff, 0x02, 0xff, 0xfe, 0x03, 0x02, 0x00, 0x01,
+  0xff, 0xf2, 0x00, 0x06, 0xfd, 0xef, 0x08, 0xee, 0x03, 0x03, 0x04, 0xf8,
+  0x0a, 0x13, 0x01, 0x00, 0x01, 0x06, 0xff, 0xfe, 0x00, 0xff, 0x01, 0x01,
+  0x01, 0xfe, 0x03, 0xfd, 0x03, 0xed, 0x00, 0x00, 0x00, 0x0b, 0xfb, 0xfa,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xe9, 0x06,
+  0x00, 0x01, 0x00, 0x28, 0xf2, 0x16, 0xff, 0x00, 0xff, 0xc0, 0xe4, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x21, 0x21, 0xe8, 0x00, 0x00, 0x00, 0xfe, 0x07, 0x05, 0x00, 0x00,
+  0x00, 0xfe, 0x03, 0xff, 0x00, 0x00, 0x00, 0xdf, 0xe3, 0xd7, 0x00, 0x00,
+  0x00, 0x1f, 0xe2, 0x23, 0xff, 0xff, 0xff, 0x39, 0xd9, 0xea, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x9f,
+  0x17, 0x15, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x11, 0x00, 0xff, 0x00, 0xfc,
+  0x01, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x0e, 0xec, 0x02, 0xff, 0x00, 0xe4,
+  0xf8, 0x01, 0xfe, 0xff, 0xfd, 0x30, 0xf0, 0x09, 0x00, 0x00, 0xff, 0xfc,
+  0xfe, 0x00, 0xfe, 0x01, 0x00, 0xff, 0xfe, 0x01, 0xfe, 0x35, 0x12, 0xd5,
+  0x00, 0x00, 0x00, 0x17, 0xfb, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0xee, 0x2b, 0xff, 0x00, 0xff, 0x0b, 0xd5, 0xf3,
+  0x01, 0xff, 0x01, 0x38, 0xfb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x41, 0xfb, 0xe5, 0x00, 0x00,
+  0x00, 0x1e, 0xfc, 0xf9, 0x00, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0x00,
+  0xfe, 0x11, 0x17, 0xec, 0x01, 0xfe, 0x00, 0xed, 0x14, 0x22, 0xff, 0xff,
+  0xff, 0xf5, 0xd6, 0x0d, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0xff, 0x00, 0xff, 0xe5, 0xe6, 0x14, 0x00, 0x00, 0x00, 0xfd,
+  0xf9, 0x0b, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x1b,
+  0x33, 0x24, 0xff, 0xff, 0x00, 0xf0, 0xe9, 0x1c, 0x00, 0x01, 0x00, 0x52,
+  0xee, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x1a, 0x0b, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xfd, 0x07,
+  0x00, 0xff, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x00, 0xff, 0x16, 0xcf, 0xe0,
+  0x00, 0x00, 0x00, 0xeb, 0xe9, 0x25, 0xff, 0xfe, 0xff, 0xe8, 0xc5, 0xf5,
+  0x00, 0x00, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x02, 0x18, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0xf6, 0x00, 0x01,
+  0x00, 0xff, 0xfc, 0x01, 0x01, 0x00, 0x00, 0x1b, 0xe9, 0xf3, 0x00, 0x01,
+  0x00, 0xf2, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x35, 0xdb, 0xf2, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x37,
+  0xdb, 0xca, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0xda, 0xff, 0xff, 0x00, 0xdd,
+  0x1a, 0x0a, 0x00, 0x01, 0xff, 0x51, 0x27, 0x1c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0xd2, 0x19,
+  0x00, 0x00, 0x00, 0xf5, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x0a, 0x26, 0xff, 0x00, 0x00, 0x1c, 0xf2, 0xca,
+  0x01, 0x00, 0x01, 0x67, 0xdf, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x28, 0x2d, 0x00, 0x00,
+  0x00, 0x03, 0xfd, 0x0b, 0x00, 0xff, 0x00, 0xfb, 0x00, 0x00, 0xff, 0xff,
+  0xfe, 0xe7, 0xd7, 0x33, 0x01, 0xfd, 0xff, 0xde, 0xf0, 0x10, 0xfe, 0x01,
+  0xfe, 0xf8, 0x2b, 0xe3, 0x00, 0x00, 0xff, 0xfc, 0xfe, 0xff, 0xfe, 0x00,
+  0xff, 0xff, 0xff, 0x02, 0xff, 0x33, 0xdd, 0xfe, 0x00, 0x00, 0x00, 0xfa,
+  0xfa, 0xfb, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x00, 0x00, 0x39,
+  0x12, 0xf1, 0x00, 0x01, 0x00, 0xdb, 0xce, 0x0e, 0xff, 0x01, 0x01, 0x45,
+  0x4c, 0x1b, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x65, 0x16, 0xf4, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xf9,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xea, 0x1a,
+  0x00, 0x00, 0x00, 0x28, 0xe9, 0x39, 0x00, 0x00, 0x00, 0xc5, 0xec, 0xb7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x01,
+  0x00, 0x02, 0x23, 0xc1, 0x00, 0x00, 0x00, 0xf2, 0x08, 0xf8, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe8, 0x2a, 0x00, 0x00,
+  0x01, 0xec, 0xff, 0x14, 0x01, 0x00, 0x00, 0x32, 0x18, 0x4f, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7,
+  0xfe, 0x08, 0x00, 0x00, 0x00, 0xf6, 0x03, 0xf7, 0x00, 0x00, 0x00, 0xff,
+  0xfd, 0x01, 0x00, 0x00, 0xff, 0xf6, 0xdd, 0x05, 0x00, 0x01, 0x00, 0x26,
+  0x03, 0xea, 0xff, 0x00, 0x00, 0xad, 0x07, 0xe5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xf5, 0xd7,
+  0x00, 0x00, 0x00, 0xf0, 0xf6, 0x05, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0xd8, 0x0f, 0x01, 0x02, 0x00, 0xf7, 0x32, 0x37,
+  0x00, 0x01, 0xff, 0xa0, 0x1b, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf9, 0xc4, 0x08, 0x00, 0x00,
+  0x00, 0xff, 0x0f, 0x15, 0xff, 0xff, 0x00, 0x01, 0x00, 0x01, 0xfe, 0x00,
+  0x00, 0x00, 0xdf, 0x1e, 0x01, 0xfd, 0x02, 0x0b, 0xde, 0x19, 0xff, 0xff,
+  0x00, 0xc9, 0x15, 0x3a, 0xff, 0x00, 0x00, 0xfb, 0x00, 0x01, 0xfe, 0x00,
+  0x00, 0xff, 0xff, 0x01, 0xff, 0x13, 0xfe, 0xc9, 0x00, 0xff, 0x00, 0x1b,
+  0x18, 0x15, 0x00, 0xff, 0x01, 0x04, 0x07, 0xfe, 0xfe, 0xff, 0x00, 0x30,
+  0x0a, 0xfa, 0x02, 0xfc, 0x01, 0x37, 0xf9, 0x0b, 0xfd, 0x00, 0xfe, 0x10,
+  0xef, 0xfa, 0x00, 0xff, 0xff, 0xfc, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00,
+  0xff, 0x02, 0xfe, 0xfb, 0xf2, 0xfa, 0x00, 0x00, 0x00, 0xf0, 0xfd, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf9, 0xce,
+  0x00, 0x00, 0x00, 0x38, 0xf4, 0x0e, 0x00, 0xff, 0x00, 0x01, 0xb9, 0xd6,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x17, 0x28, 0xff, 0x00, 0xff, 0xff, 0x0e, 0x08, 0x0f, 0x01, 0xfe,
+  0x00, 0xff, 0x01, 0xff, 0xfe, 0xff, 0xff, 0x08, 0xf9, 0x06, 0x02, 0xfb,
+  0x02, 0xf6, 0x05, 0x00, 0xfc, 0xfe, 0xfc, 0xe5, 0x03, 0xeb, 0x00, 0x00,
+  0xff, 0xfa, 0xff, 0x00, 0xfd, 0x01, 0xff, 0xff, 0xfe, 0x01, 0xfe, 0x08,
+  0x04, 0x0c, 0x00, 0xff, 0x00, 0x09, 0x0b, 0x19, 0x00, 0xfe, 0x01, 0x01,
+  0xfd, 0x00, 0xfe, 0xff, 0xff, 0x09, 0xeb, 0xf9, 0x02, 0xfc, 0x02, 0xe7,
+  0xf8, 0x14, 0xfe, 0xfe, 0xfd, 0xd2, 0x1e, 0xbb, 0x00, 0x00, 0xff, 0xf8,
+  0x00, 0x02, 0xfe, 0x01, 0xff, 0xff, 0xfe, 0x00, 0xff, 0x1d, 0xf2, 0x2d,
+  0x00, 0xff, 0x00, 0x2d, 0x13, 0x0e, 0x00, 0xff, 0x01, 0x08, 0x05, 0xff,
+  0xff, 0xff, 0xff, 0x3d, 0x26, 0xe8, 0x03, 0xfb, 0x02, 0x24, 0xf6, 0x0f,
+  0xfe, 0x02, 0xfd, 0x07, 0xd8, 0x0c, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x01,
+  0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0xfd, 0xd8, 0xf2, 0x0b, 0x00, 0x00,
+  0x00, 0x02, 0x02, 0xf2, 0x00, 0x00, 0x00, 0xfd, 0xfe, 0x01, 0x01, 0x00,
+  0x01, 0xfd, 0xe7, 0xef, 0x00, 0x00, 0x00, 0xec, 0xff, 0xfb, 0x01, 0x01,
+  0x01, 0x4d, 0xd6, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x53, 0xe6, 0x4e, 0x00, 0x00, 0x00, 0xf7,
+  0x0a, 0x07, 0x00, 0x00, 0x00, 0x02, 0x01, 0xff, 0x00, 0x00, 0x00, 0xe2,
+  0xda, 0x01, 0x01, 0x00, 0x01, 0x15, 0xe7, 0xd8, 0xff, 0x01, 0xff, 0xa8,
+  0xe7, 0x4e, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x01, 0x00, 0x39, 0xf1, 0xdc, 0x00, 0x01, 0x00, 0xeb, 0xeb, 0xef,
+  0xff, 0x01, 0x00, 0xff, 0xfa, 0x03, 0x02, 0x02, 0x02, 0xfa, 0x1c, 0x0c,
+  0xfc, 0x04, 0xfc, 0xfd, 0xe3, 0xf5, 0x03, 0x02, 0x05, 0x0e, 0xdc, 0xfb,
+  0x00, 0xff, 0x02, 0x06, 0x01, 0xff, 0x04, 0x00, 0x01, 0x01, 0x03, 0xff,
+  0x02, 0xf4, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00,
+  0x00, 0x04, 0xff, 0x02, 0x01, 0x00, 0x01, 0x1b, 0xea, 0x09, 0xff, 0x01,
+  0x00, 0xf7, 0xec, 0x11, 0x01, 0x01, 0x00, 0xc3, 0x42, 0x4d, 0x00, 0x00,
+  0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xf3,
+  0x1a, 0x09, 0x00, 0x00, 0x00, 0xe7, 0xf1, 0xf3, 0xff, 0x01, 0x00, 0x02,
+  0xfb, 0x02, 0x00, 0x01, 0x01, 0xf1, 0xed, 0x2a, 0xfe, 0x03, 0xff, 0x0d,
+  0xfc, 0xe9, 0x02, 0x01, 0x03, 0x2c, 0x0d, 0xcc, 0x00, 0xff, 0x01, 0x04,
+  0x01, 0xff, 0x00, 0x00, 0x01, 0x00, 0x01, 0xfe, 0x02, 0xf9, 0x0a, 0xec,
+  0x00, 0x00, 0x00, 0xf5, 0x03, 0xf4, 0xff, 0x01, 0x00, 0x02, 0xfd, 0x02,
+  0x00, 0x01, 0x00, 0x16, 0x0a, 0xe7, 0xff, 0x02, 0xff, 0x0f, 0x03, 0x15,
+  0x01, 0x02, 0x01, 0xd6, 0x39, 0xc9, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x03, 0x02, 0x30, 0x51, 0x36, 0x00, 0x00,
+  0x00, 0xed, 0x09, 0xfa, 0x00, 0x01, 0x00, 0x01, 0xfe, 0x02, 0x00, 0x01,
+  0x02, 0xfe, 0x1c, 0x2e, 0xff, 0x03, 0x00, 0xfb, 0xd0, 0x17, 0x00, 0xff,
+  0x02, 0xce, 0xfc, 0x0a, 0x00, 0xff, 0x01, 0x03, 0x02, 0x01, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x01, 0x0d, 0x0f, 0x2f, 0x00, 0x00, 0x00, 0xf6,
+  0x0f, 0x08, 0x00, 0xff, 0x01, 0x03, 0x07, 0x01, 0xff, 0xff, 0x01, 0xde,
+  0x17, 0x01, 0x01, 0x00, 0x01, 0x18, 0xe8, 0x13, 0xff, 0x00, 0xff, 0xec,
+  0x13, 0xef, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0xff, 0xdd, 0xe3, 0xe4, 0x00, 0x00, 0x00, 0x02, 0x04, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x05, 0x31, 0x35,
+  0xff, 0x00, 0x00, 0x17, 0xfc, 0x1d, 0x00, 0x02, 0x01, 0x6b, 0x41, 0xf5,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0xc7, 0x0e, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0xfb, 0x00, 0xff,
+  0x00, 0xfd, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x07, 0xef, 0x18, 0x01, 0xfd,
+  0xff, 0x0b, 0x03, 0xec, 0xff, 0x00, 0xfe, 0x21, 0xf5, 0x09, 0x00, 0x00,
+  0xff, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde,
+  0xf7, 0xc6, 0x00, 0x00, 0x00, 0xff, 0x03, 0x08, 0x00, 0x00, 0x00, 0xfe,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xda, 0x11, 0x00, 0x01, 0x00, 0xe7,
+  0x29, 0xe2, 0x00, 0x00, 0x00, 0xd5, 0x05, 0x1e, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbc, 0xee,
+  0x00, 0x00, 0x00, 0x0d, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x01, 0x08, 0xfe,
+  0x00, 0x00, 0xff, 0x24, 0x07, 0xe5, 0x01, 0xfd, 0x00, 0xfc, 0xe7, 0x11,
+  0xff, 0xff, 0x00, 0x01, 0xd3, 0xa7, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x3b, 0xe4, 0xde, 0x00, 0x01,
+  0x01, 0x05, 0xf5, 0xf7, 0xff, 0x01, 0x01, 0x02, 0xff, 0x06, 0x00, 0x01,
+  0x02, 0x1e, 0xe7, 0x20, 0xfd, 0x04, 0xfe, 0xf4, 0xfc, 0x5b, 0x03, 0x04,
+  0x06, 0xdb, 0x12, 0x23, 0xff, 0xff, 0x01, 0x06, 0x02, 0x00, 0x03, 0xff,
+  0x01, 0x01, 0x03, 0x04, 0x03, 0xe0, 0x03, 0xfa, 0x00, 0x00, 0x00, 0x0c,
+  0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x0b, 0xe3, 0x00, 0xff, 0xff, 0xec, 0x10, 0x07, 0x00, 0x00, 0x01, 0x18,
+  0x24, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3b, 0xf2, 0x11, 0x00, 0x00, 0x00, 0xeb, 0xf6, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x03, 0xff, 0x00, 0x00, 0x00, 0xe9, 0xcc, 0xf8,
+  0x00, 0xff, 0x00, 0x21, 0xf4, 0x29, 0x00, 0x01, 0xff, 0xb5, 0x03, 0x21,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0xea, 0xc2, 0xe0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x01, 0x00, 0x00, 0x01, 0xf3, 0x05, 0x19, 0xff, 0x01,
+  0x00, 0xef, 0xd4, 0xd9, 0x00, 0x01, 0x00, 0xc5, 0xfd, 0x05, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xfe,
+  0x33, 0xf8, 0x00, 0x00, 0x00, 0x10, 0xfc, 0xf7, 0x00, 0x00, 0x00, 0xff,
+  0xfd, 0x00, 0xff, 0x00, 0x00, 0xd5, 0xe9, 0xe3, 0x00, 0xff, 0x00, 0x0e,
+  0x1e, 0xf1, 0x01, 0x00, 0x00, 0xb3, 0xd2, 0xab, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x26, 0xe0,
+  0x00, 0x00, 0x00, 0x10, 0x06, 0x02, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xff,
+  0x00, 0x00, 0x00, 0xe6, 0x1d, 0x05, 0xff, 0x00, 0x00, 0xd6, 0x21, 0x2c,
+  0x00, 0x01, 0x00, 0x20, 0x37, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1d, 0x1d, 0x00, 0xff,
+  0xff, 0x1e, 0x0c, 0x15, 0x01, 0xfe, 0x00, 0x04, 0x00, 0xff, 0xfe, 0xff,
+  0xfe, 0x06, 0xf4, 0x11, 0x02, 0xfc, 0x03, 0xf0, 0x09, 0xf4, 0xfd, 0xfe,
+  0xfa, 0xce, 0x16, 0xc4, 0x00, 0x00, 0xff, 0xf7, 0xff, 0x01, 0xfe, 0x01,
+  0xff, 0xff, 0xfd, 0x00, 0xfd, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0d,
+  0x01, 0x02, 0x01, 0x00, 0x00, 0xfd, 0x09, 0xfe, 0x00, 0xff, 0x00, 0x07,
+  0xec, 0xe2, 0x00, 0xfd, 0x01, 0xe5, 0x03, 0x02, 0x00, 0xfe, 0xff, 0x14,
+  0x0d, 0xee, 0x00, 0x00, 0xff, 0xfd, 0xff, 0x00, 0x01, 0x00, 0x00, 0xff,
+  0x00, 0xff, 0xff, 0x9f, 0xd1, 0xe9, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xce, 0x13, 0x00,
+  0x01, 0x01, 0x00, 0xe2, 0xf8, 0xef, 0x00, 0x00, 0x00, 0x9d, 0xc4, 0x91,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0xe9, 0x23, 0x08, 0x00, 0x00, 0x00, 0xeb, 0x06, 0xf6, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0xff, 0x00, 0x00, 0xc9, 0xea, 0xca, 0x00, 0x01,
+  0x00, 0xec, 0x12, 0x2c, 0x00, 0x01, 0x00, 0xf5, 0xc7, 0x8d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xe5,
+  0xb5, 0xcc, 0x00, 0x00, 0x00, 0x02, 0xf6, 0xf1, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x02, 0x01, 0x00, 0x1c, 0xf4, 0xea, 0x00, 0x03, 0xff, 0xee,
+  0x2b, 0xe3, 0x01, 0x00, 0x02, 0x12, 0x18, 0xca, 0x01, 0x00, 0x00, 0x04,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x08, 0x1c, 0x15,
+  0x00, 0x00, 0x00, 0xed, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0xf8, 0xeb, 0x05, 0x00, 0x00, 0x01, 0x0f, 0xe6, 0xf7,
+  0x00, 0x00, 0x01, 0xe2, 0x0c, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa9, 0xda, 0xe7, 0x00, 0x00,
+  0x00, 0x07, 0x0d, 0x1b, 0x00, 0xff, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00,
+  0x00, 0xf0, 0xf5, 0x08, 0x00, 0x01, 0x01, 0xfe, 0x07, 0xf9, 0xff, 0x00,
+  0xff, 0xde, 0x0e, 0x17, 0x00, 0xff, 0x00, 0xfe, 0x01, 0x01, 0xff, 0x00,
+  0x00, 0xff, 0xff, 0xfe, 0xff, 0xcf, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x12,
+  0x0b, 0xf9, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x28,
+  0x1e, 0xe7, 0xff, 0xff, 0xff, 0xdd, 0x0c, 0xfd, 0x00, 0xff, 0x01, 0x40,
+  0x1f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x07, 0x32, 0xea, 0x00, 0x01, 0x00, 0xe3, 0xf5, 0xf3,
+  0x00, 0x01, 0xff, 0x03, 0xf8, 0xff, 0x02, 0x01, 0x00, 0xfb, 0xf9, 0x01,
+  0x00, 0x02, 0xfe, 0x0a, 0x0d, 0xf1, 0x02, 0x03, 0x03, 0x1a, 0xfa, 0xea,
+  0x01, 0x01, 0x01, 0x02, 0xff, 0xfe, 0x01, 0xff, 0x00, 0x01, 0x02, 0x03,
+  0x01, 0x28, 0x20, 0x5d, 0x00, 0x00, 0x00, 0xfd, 0x07, 0x13, 0x00, 0xff,
+  0x00, 0x03, 0x04, 0xfd, 0x00, 0xff, 0x00, 0x28, 0x01, 0xe4, 0x02, 0xfc,
+  0x01, 0xf7, 0xfe, 0xcc, 0xff, 0x00, 0xff, 0xd7, 0xfe, 0xf3, 0x01, 0x00,
+  0xff, 0xfd, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x02, 0xfe, 0x09,
+  0xfa, 0xe6, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xf6, 0x2e, 0xff, 0x01, 0x00, 0xcf,
+  0xd7, 0xcf, 0x00, 0x01, 0x00, 0xef, 0xce, 0x64, 0x00, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xee, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0xf7, 0xf9, 0xf6, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x1b, 0x06, 0xed, 0x00, 0xff, 0x00, 0xf7, 0xf4, 0x0f,
+  0xff, 0x00, 0x00, 0x31, 0xee, 0xae, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xba, 0xf6, 0xe8, 0x00, 0x00,
+  0x00, 0x0a, 0xf7, 0x05, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0xd5, 0x1d, 0x00, 0xff, 0x01, 0xfb, 0x20, 0xf1, 0x00, 0x00,
+  0xff, 0xdd, 0xb7, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x34, 0xe7, 0x1c, 0x00, 0x00, 0x00, 0x12,
+  0x0b, 0x09, 0x00, 0xff, 0x00, 0xfe, 0x05, 0x00, 0xfe, 0x00, 0xff, 0x19,
+  0x0f, 0x08, 0x00, 0xff, 0x01, 0xec, 0x02, 0xf0, 0xff, 0xfd, 0xff, 0x19,
+  0xcf, 0x26, 0xff, 0x00, 0xff, 0xfe, 0xff, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0xff, 0xfe, 0xff, 0xa1, 0xe3, 0xb4, 0x00, 0x00, 0x00, 0xf6, 0xfb, 0xfc,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1a, 0x0b, 0x14,
+  0x00, 0xff, 0x00, 0x28, 0xe9, 0xda, 0x00, 0x01, 0x01, 0xb1, 0xd2, 0xca,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0xf2, 0xf3, 0xea, 0x00, 0x00, 0x00, 0x02, 0x02, 0x10, 0x00, 0x00,
+  0x00, 0xff, 0x02, 0xff, 0x00, 0x00, 0x00, 0x37, 0x0b, 0x17, 0xff, 0xfe,
+  0x00, 0xc5, 0xe3, 0xd1, 0x01, 0x01, 0x02, 0x29, 0x08, 0x2a, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0xf7,
+  0x01, 0x04, 0x00, 0x00, 0x00, 0xfd, 0x04, 0xfd, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x2d, 0xdc, 0x00, 0xff, 0x00, 0xce,
+  0xd4, 0x19, 0x00, 0x01, 0xff, 0x62, 0x23, 0x29, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1b, 0x07,
+  0x00, 0x00, 0x00, 0xfb, 0x05, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x0f, 0xda, 0x00, 0x01, 0x01, 0xee, 0xdb, 0x07,
+  0x00, 0x00, 0x00, 0x41, 0x35, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x2f, 0xf0, 0x0e, 0x00, 0x00,
+  0x00, 0x0b, 0x04, 0x06, 0x01, 0xff, 0xff, 0xfc, 0x02, 0xfd, 0x00, 0x00,
+  0xfe, 0xf3, 0xe4, 0xf2, 0x01, 0xfd, 0x00, 0xd5, 0x05, 0x2d, 0x00, 0x01,
+  0xfe, 0xfe, 0xd0, 0xeb, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x00, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0x40, 0x0f, 0xe6, 0x00, 0x00, 0x00, 0xf8,
+  0x01, 0xf7, 0x00, 0x00, 0x00, 0xff, 0x02, 0xff, 0x00, 0x00, 0x00, 0x04,
+  0xff, 0x2c, 0x01, 0x01, 0x00, 0x16, 0x25, 0x0a, 0x00, 0xff, 0x01, 0x04,
+  0xcd, 0xcb, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc1, 0xf5, 0xe1, 0x00, 0x00, 0x00, 0xf5, 0x12, 0x11,
+  0x01, 0x00, 0x00, 0x02, 0x06, 0xfe, 0x02, 0x00, 0xfe, 0x0c, 0x44, 0xe9,
+  0x02, 0xfe, 0x00, 0xcf, 0x1c, 0xd8, 0xfe, 0x01, 0xff, 0xf0, 0xfe, 0xd3,
+  0x02, 0x01, 0x00, 0xfc, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01,
+  0x00, 0xf2, 0xcc, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x05, 0xf9, 0x00, 0x00,
+  0x00, 0xff, 0x02, 0x01, 0x00, 0x00, 0x00, 0xf3, 0xf7, 0xe4, 0x00, 0x00,
+  0x00, 0x20, 0xd9, 0xe5, 0x00, 0xff, 0x01, 0x4f, 0xe5, 0x25, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x37, 0x08, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00,
+  0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x81, 0x80, 0x00, 0x3c, 0xfc, 0xff, 0xff, 0xff, 0x04, 0x00, 0x04, 0x00,
+  0x04, 0x00, 0x00, 0x00
+};
+const int fall_model_3_int8_data_len = 5632;
@@ -0,0 +1,441 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_aot.h
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    The model f46 compiled ahead of time to C++
+  *
+  *   Runs the model without the interpreter and the tensor arena. The
+  *   layers do the same float operations in the same order as the reference
+  *   kernels of TensorFlow Lite Micro, so the outputs are the same as Invoke().
+  *
+**/
+
+// Generated from fall_model_data with the host tool:
+// aot_compile --out adaptive_fall_detection_system f46
+
+#ifndef FALL_MODEL_F46_AOT_H_
+#define FALL_MODEL_F46_AOT_H_
+
+#include <cmath>
+
+namespace fall_model_f46_aot {
+
+constexpr int kInputs = 46;      /**<  Amount of features   */
+constexpr int kHidden = 33;      /**<  Amount of neurons in the hidden layer   */
+constexpr int kOutputs = 2;      /**<  The outputs (no fall, fall)   */
+
+constexpr float kHiddenWeights[33][46] = {
+  {
+    0.0722127259f, 1.50808728f, 0.958453953f, -0.247457251f, -0.487507015f, -0.609816134f,
+    -1.25714719f, 1.31289029f, -0.772933185f, -0.4545964f, -0.483111352f, 0.477158546f,
+    0.783028185f, 1.69706666f, 0.567394614f, -0.0326839462f, 0.141086608f, -0.129371449f,
+    -1.17549813f, 0.779317379f, -1.25816584f, -0.0572732948f, -0.158816755f, 0.146509349f,
+    0.81870997f, -0.0769378766f, 1.17187917f, -0.00371452561f, -0.126411021f, 0.223809779f,
+    -0.448988408f, -0.0750802457f, 1.34900117f, 0.923398077f, 0.11903736f, -0.475917399f,
+    0.739851534f, -0.813611805f, 1.06196165f, 0.304543942f, 0.722429633f, -0.721271992f,
+    1.02058542f, -0.00421846844f, 0.00729217986f, -0.0633922145f
+  },
+  {
+    -0.189701721f, 0.0124605456f, -0.101084359f, -0.0648190081f, -0.231804773f, 0.181280762f,
+    0.0766917095f, 0.123414449f, 0.247372478f, 0.0506155863f, -0.122382119f, 0.00890611671f,
+    0.0110758226f, 0.220116004f, -0.00416601636f, 0.0751467124f, -0.239536166f, 0.0654050484f,
+    -0.091219902f, -0.2247722f, -0.185327426f, -0.290330023f, -0.247092009f, -0.0258605033f,
+    0.257321268f, -0.0411157981f, 0.0810532644f, -0.00918069389f, 0.274798036f, 0.240012705f,
+    0.0415350646f, 0.18383719f, 0.0358749852f, 0.032673087f, -0.208228081f, 0.0990384966f,
+    0.202177927f, 0.153553262f, 0.211653575f, -0.213306367f, -0.164145112f, 0.125520438f,
+    0.123311564f, 0.218081251f, 0.274442762f, 0.231576055f
+  },
+  {
+    0.0492089316f, -0.179545566f, -0.194016844f, 0.262751162f, -0.083906956f, -0.061821416f,
+    -0.100031562f, 0.0534102581f, -0.216901317f, 0.101380646f, -0.0266498942f, 0.0246554185f,
+    0.221378744f, 0.049900692f, 0.0759812146f, 0.0235081092f, -0.27161938f, 0.133470625f,
+    0.119744807f, -0.181527868f, -0.140459836f, 0.0330438539f, 0.109176092f, 0.147273213f,
+    0.17357187f, 0.0580540374f, -0.220283166f, -0.252318978f, 0.0475032479f, -0.217443407f,
+    -0.0056014522f, 0.238508359f, 0.191309303f, -0.219645649f, 0.148257613f, -0.0641180351f,
+    0.0482209511f, -0.218888626f, -0.15334563f, -0.141986653f, 0.114574887f, -0.266717255f,
+    0.251563817f, -0.183246717f, 0.136157811f, 0.263761908f
+  },
+  {
+    -0.244069695f, 0.0319164209f, 0.212313965f, 0.252842635f, 0.230706453f, -0.0751138851f,
+    -0.147107959f, -0.148656502f, 0.149544716f, 0.0803566799f, 0.193186343f, -0.182351127f,
+    0.00686639966f, 0.211061165f, -0.204707161f, -0.0817420259f, 0.154766068f, 0.150252044f,
+    -0.248128816f, 0.0929973423f, 0.179570109f, -0.190173283f, -0.0295172166f, -0.274906814f,
+    0.229380116f, -0.123137623f, -0.0490604006f, 0.214862153f, -0.196407735f, 0.260266304f,
+    -0.167443961f, 0.00066428195f, 0.132966265f, 0.0604084581f, 0.0438750796f, -0.000224427713f,
+    0.0384116098f, 0.104864821f, -0.000245525618f, 0.181799799f, 0.196895361f, -0.138791963f,
+    0.205722749f, 0.0918056965f, 0.23021847f, 0.148327708f
+  },
+  {
+    -0.197342172f, -0.134149522f, -0.0487999469f, -0.179052025f, -0.00578643056f, -0.243776426f,
+    -0.108338103f, 0.245879784f, -0.182743102f, -0.227558121f, 0.063602902f, -0.20725891f,
+    -0.203938156f, -0.194015384f, 0.150090605f, -0.277216136f, -0.0470405184f, -0.0749046952f,
+    0.144815594f, 0.0420382023f, 0.0852833167f, -0.0994427577f, 0.224360198f, 0.062594831f,
+    -0.152127787f, 0.0448690727f, 0.0551856384f, -0.0734136105f, -0.176284045f, -0.176745921f,
+    -0.132896468f, -0.145270318f, -0.171458617f, 0.0383757129f, 0.178771421f, -0.158112794f,
+    0.253120691f, -0.178765938f, -0.0629505739f, -0.0204675477f, -0.0497388355f, -0.0190507378f,
+    -0.060899917f, -0.220652401f, -0.272775859f, 0.0492537431f
+  },
+  {
+    -0.579099894f, 1.39775193f, 0.916165888f, -0.399243414f, -0.289985597f, -0.405777603f,
+    0.0749426037f, 1.03492534f, -1.16833222f, 0.196558788f, -0.287195057f, -0.565919399f,
+    0.753558517f, 1.3264997f, 0.642457128f, -0.10624557f, 0.00151545403f, 0.0414969809f,
+    -1.0908097f, 0.0780715644f, -1.41073251f, 0.0979317948f, 0.0165678095f, -0.038807299f,
+    1.19133902f, 1.39402533f, 1.04901612f, 0.127261832f, 0.0156898201f, -0.0168724526f,
+    0.300953776f, -0.32591787f, 1.24554574f, 0.633249938f, -0.268905312f, -0.933812082f,
+    0.884346306f, -0.634598136f, 1.56656766f, 1.02825701f, 0.845619798f, 0.95147413f,
+    0.830361545f, -0.0269668754f, 0.00609399518f, 0.0100727016f
+  },
+  {
+    0.0687557459f, 0.010358979f, 0.235746101f, -0.36722669f, -0.0774806142f, -0.0640441105f,
+    -0.12577045f, 0.26881516f, 0.152782366f, -0.0972042754f, 0.109217986f, -0.0734639987f,
+    0.112011239f, 0.18767722f, -0.175009593f, 0.155520573f, -0.326858431f, -0.226062223f,
+    -0.0459545814f, 0.296672314f, -0.0520804524f, 0.0683649257f, 0.0958868936f, 0.107959762f,
+    0.168209687f, -0.285714507f, -0.253846228f, -0.305930316f, -0.196734354f, -0.319017321f,
+    -0.00164178852f, 0.124450006f, 0.0481040664f, 0.0726847947f, -0.106556602f, 0.352753907f,
+    -0.157033637f, -0.188420713f, -0.216546282f, -0.327551067f, -0.00863035489f, -0.0202629324f,
+    -0.328644663f, 0.142579317f, -0.102402158f, -0.0972985104f
+  },
+  {
+    0.195185125f, 1.27458382f, 1.19175684f, -0.214816406f, -0.213053331f, -0.591648757f,
+    -0.373310506f, 1.81421447f, -1.53362906f, -0.0628139824f, -0.0530137606f, 0.00531889684f,
+    1.34748185f, 1.45926332f, 0.634992957f, -0.0317757502f, 0.0298922416f, -0.10598696f,
+    -0.516123354f, 0.811407447f, -0.924049556f, 0.0658890381f, -0.0309452992f, 0.109735452f,
+    1.18950236f, 0.0785921216f, 0.916222572f, 0.090560697f, -0.0168121941f, 0.181754395f,
+    0.181846812f, 0.0568938404f, 1.19751203f, 1.16968429f, -0.114685684f, -0.635771334f,
+    0.175496504f, -1.2585758f, 1.23754621f, 0.14477317f, 1.00327516f, -0.41314587f,
+    0.941582859f, -0.0276874024f, -0.0461440682f, -0.0176675674f
+  },
+  {
+    -0.308736622f, 1.02299607f, 0.327171296f, -0.703375399f, -0.350921005f, -0.372203439f,
+    0.824216306f, 1.69612491f, -1.21870065f, -0.443403661f, -0.283804595f, -0.626435459f,
+    1.13732445f, 1.78790128f, 0.356048763f, -0.13554877f, 0.0899391174f, -0.0913724005f,
+    -0.61415714f, 1.44676816f, -1.5243125f, -0.187984392f, 0.004286699f, -0.275169522f,
+    0.969570339f, -0.0314964429f, 0.927758992f, -0.0114805931f, -0.0713942945f, -0.0585150644f,
+    0.130281448f, 0.587226033f, 1.57300532f, 1.33423615f, -0.273382902f, -0.606936097f,
+    0.20970422f, -1.18610549f, 1.28250873f, 0.0291802529f, 1.28673029f, -0.422378272f,
+    1.01879334f, 0.0485891588f, 0.0244788863f, 0.0375224166f
+  },
+  {
+    0.482306808f, 1.62848544f, 1.70949948f, -0.123717032f, -0.343292624f, -0.586084664f,
+    1.0522244f, 2.09773445f, -0.70097971f, 0.649291217f, 0.339507878f, -0.279873997f,
+    1.24153352f, 2.31508279f, 0.641530037f, 0.0133590167f, 0.137108847f, -0.0111367078f,
+    -0.668013215f, 1.20107365f, -0.365641057f, 0.0487114303f, 0.020740049f, -0.1422382f,
+    1.52124679f, 0.621170759f, 1.15279126f, 0.0395039804f, -0.0810465962f, -0.015180774f,
+    1.2514317f, -0.201492414f, 2.03408003f, 1.36173069f, 0.418898135f, -0.150409982f,
+    0.410843104f, -1.07399619f, 1.09942603f, 0.696727633f, 1.30534136f, -0.292815208f,
+    1.06045282f, -0.0439248532f, 0.0360156409f, -0.0549050234f
+  },
+  {
+    0.172517464f, 0.144675806f, 0.139118567f, -0.0490702987f, -0.000459098374f, -0.0348281115f,
+    -0.0101841558f, -0.194650099f, -0.194960654f, 0.128069341f, 0.0127160782f, -0.153295621f,
+    -0.0517421998f, -0.026017895f, -0.18512325f, -0.324355215f, 0.0470654406f, -0.188502148f,
+    0.058089301f, 0.0837595612f, 0.178268269f, 0.242677659f, 0.16440931f, 0.20712626f,
+    0.0806761459f, -0.106435768f, 0.095448032f, 0.000630915514f, -0.243898228f, 0.13475439f,
+    0.155649737f, -0.0446382053f, -0.0746148303f, -0.00237740669f, -0.150632754f, 0.152545556f,
+    -0.016746372f, -0.189566746f, -0.123006098f, 0.117569305f, -0.218132809f, 0.0167215075f,
+    0.0795762986f, -0.0562549233f, 0.00433337968f, -0.0266244821f
+  },
+  {
+    0.326159626f, 0.603207827f, 1.0728364f, -0.390775234f, -0.0908977091f, 0.286562264f,
+    -0.250495523f, 0.759048283f, 0.477745116f, 0.303915471f, -0.462642342f, 0.0723570287f,
+    0.192921698f, 0.616811991f, 1.11139584f, 0.0640301108f, 0.282695889f, -0.139183179f,
+    -0.429924905f, 0.823338211f, -0.549618959f, 0.298621565f, -0.000474313361f, 0.0447856747f,
+    0.228246868f, -0.166417271f, 0.935716212f, 0.0550773405f, 0.262199998f, 0.151954412f,
+    -0.308512956f, -0.378762811f, 0.567886353f, 0.826166332f, 1.16034889f, -0.195613176f,
+    -0.228661016f, -0.392534286f, 0.463930577f, 0.176930875f, -0.0242889132f, -0.284438193f,
+    0.905760288f, -0.197582453f, 0.220381796f, -0.0228289329f
+  },
+  {
+    0.00113651762f, 0.0731430426f, -0.514452279f, 0.229688898f, 0.512609482f, 0.61680758f,
+    0.920167923f, -0.774847686f, 0.173852742f, 0.694912791f, 0.538816988f, -0.514302194f,
+    0.289976388f, -0.808833718f, -0.413074076f, 0.183653519f, 0.0812910646f, -0.21139349f,
+    1.08598602f, -0.555257499f, 0.295192987f, 0.194077313f, 0.25043273f, -0.215379015f,
+    -0.781965673f, 0.0408782326f, -0.62229979f, 0.0607852414f, 0.132096961f, -0.0512533188f,
+    0.516894937f, 0.759541273f, -0.689699411f, -0.651211858f, -0.496142089f, 0.229668707f,
+    -0.145705193f, 0.502123594f, -0.709478378f, 0.00317202974f, -0.724646449f, 0.324730396f,
+    -0.589078069f, -0.0242962744f, -0.128945217f, -0.0921683982f
+  },
+  {
+    0.188628465f, -1.52067292f, -1.31046975f, 0.148382947f, 0.627374172f, 0.385383546f,
+    1.23650336f, -1.76430535f, 0.944243312f, -0.110148489f, 0.652392209f, -1.30712867f,
+    -0.645400643f, -1.43220067f, -1.16284585f, -0.169138685f, -0.0401670672f, 0.171346501f,
+    1.14763045f, -0.932012618f, 1.06182861f, 0.169149578f, 0.0703431442f, -0.240471944f,
+    -1.08486903f, -0.667135894f, -1.00103056f, 0.150787339f, 0.0243375488f, -0.231914416f,
+    0.381545544f, 0.319750577f, -1.24983752f, -1.27590346f, -0.500691712f, 0.401825726f,
+    -0.636215329f, 0.687166452f, -1.21642756f, -0.219635069f, -0.661927164f, 0.324798703f,
+    -0.959766507f, 0.020600317f, -0.0242389627f, 0.0289014168f
+  },
+  {
+    -0.0585065521f, 0.00528489053f, -0.0538006797f, 0.108680643f, 0.12238615f, -0.275695503f,
+    0.093941316f, -0.0560701527f, -0.247746915f, -0.188075706f, -0.26008302f, 0.171426818f,
+    -0.0483394191f, 0.186204225f, -0.0448686182f, -0.165718511f, 0.147525713f, -0.228947386f,
+    -0.099583827f, 0.26942566f, 0.134874091f, 0.250527978f, 0.268360764f, 0.208089978f,
+    -0.0226935707f, -0.293535411f, 0.0623983778f, -0.281697243f, 0.0708964244f, 0.140555128f,
+    -0.0442507826f, -0.0442886464f, 0.20352985f, -0.0533399209f, -0.215557814f, 0.0235838294f,
+    -0.287371993f, 0.170125589f, -0.145531252f, -0.322711468f, -0.0441662818f, 0.194826886f,
+    -0.135351315f, -0.274007559f, 0.0085994415f, -0.106018193f
+  },
+  {
+    -0.263880879f, -0.108830534f, 0.0865216255f, -0.235586986f, -0.0848461464f, 0.138159484f,
+    -0.136691973f, 0.00438996404f, -0.0364554934f, 0.271426767f, -0.211793825f, 0.0512693226f,
+    -0.203824088f, 0.166725472f, 0.027409818f, -0.166603342f, -0.177073479f, -0.0961653739f,
+    0.323543489f, 0.240796015f, 0.253502935f, 0.0472312234f, 0.219295442f, 0.255152255f,
+    -0.243483335f, -0.0182359777f, -0.0907512456f, -0.299259812f, 0.153608024f, 0.0880155414f,
+    0.00209236774f, -0.0339371748f, 0.298628002f, 0.148282155f, -0.210083768f, 0.20935747f,
+    -0.0515086465f, -0.0256097671f, -0.115169331f, -0.287727475f, 0.0148056522f, -0.245494589f,
+    -0.090433985f, 0.205394536f, -0.182470113f, -0.189723238f
+  },
+  {
+    -0.220639095f, -0.163862437f, -0.0760322884f, -0.0663414448f, 0.0807519853f, -0.0622369498f,
+    0.0906214267f, -0.146768689f, 0.24997218f, 0.185710728f, 0.141417369f, 0.206563711f,
+    0.12461558f, -0.189545661f, 0.170898616f, -0.00840092171f, -0.149167567f, -0.146622822f,
+    -0.107546337f, 0.0123525495f, 0.259391993f, -0.0679728314f, 0.309991807f, 0.264860839f,
+    -0.21023646f, 0.116650149f, 0.162856638f, -0.0928005129f, -0.274442315f, -0.119554132f,
+    -0.0734431893f, -0.172665104f, -0.0474704131f, 0.31294474f, 0.280194491f, 0.0779440477f,
+    0.0930833295f, -0.283489615f, -0.25013271f, 0.0497489572f, -0.0303769913f, -0.251967847f,
+    -0.264988422f, -0.203330457f, 0.183316022f, -0.246396244f
+  },
+  {
+    -0.098037906f, 0.0558950864f, 0.12193162f, -0.0912095606f, 0.282944858f, 0.295337379f,
+    0.254657149f, -0.0545758493f, 0.321735442f, -0.171971351f, 0.130277738f, -0.24119392f,
+    -0.126956433f, 0.073868148f, -0.0416017622f, -0.131783515f, -0.0786503702f, 0.156744137f,
+    0.0355243534f, -0.0459287427f, 0.116765223f, -0.00474080071f, 0.0209659524f, -0.0596220568f,
+    0.0181482621f, -0.113285013f, -0.0331606381f, 0.26679197f, 0.227845475f, 0.277489603f,
+    0.0908314437f, -0.313739806f, -0.182016954f, -0.0738000125f, 0.080037564f, 0.00101306441f,
+    -0.098707512f, -0.0821321532f, -0.0337750986f, -0.0861967579f, 0.238695294f, 0.244935751f,
+    0.319708914f, 0.0491805896f, -0.117793992f, 0.134697914f
+  },
+  {
+    -0.119883627f, -0.0332557559f, 0.0379807055f, -0.0122335255f, 0.24366203f, 0.113631815f,
+    0.0236074328f, 0.11608997f, -0.13959983f, 0.0984363556f, -0.0896978229f, -0.0689302087f,
+    0.261473566f, 0.270341843f, 0.135664195f, 0.241915613f, 0.00899726152f, 0.140256494f,
+    0.0458639264f, -0.00758597255f, -0.233130664f, -0.26036948f, -0.0487379581f, 0.195596009f,
+    0.233399779f, 0.0739826262f, -0.0667615235f, 0.213737398f, 0.270183176f, 0.0405187309f,
+    -0.127876908f, -0.132742658f, 0.251768082f, -0.104919121f, 0.226713449f, -0.0694873184f,
+    -0.0971621722f, 0.123228103f, 0.0589191616f, 0.223457158f, 0.0207256377f, -0.135311484f,
+    -0.179458469f, -0.0818858892f, 0.0212437809f, 0.18650797f
+  },
+  {
+    -0.154153928f, 0.13673161f, -0.122625843f, -0.0117012495f, -0.0736422762f, 0.00383276632f,
+    -0.210421279f, -0.0622332543f, -0.255602837f, 0.246709496f, -0.198094785f, -0.0955827907f,
+    -0.159883723f, 0.117202938f, -0.214769155f, 0.23137024f, 0.224742532f, -0.105633229f,
+    -0.027298307f, 0.0967601016f, -0.263872415f, -0.0304708146f, -0.108630218f, -0.116032779f,
+    0.178683877f, 0.220260412f, 0.205401868f, 0.32549569f, 0.0426137261f, 0.0820557177f,
+    0.239295676f, -0.275136262f, -0.148329765f, -0.00323297665f, 0.236375645f, 0.0173706263f,
+    0.266688734f, -0.155683622f, -0.164103329f, -0.223861739f, 0.0295291953f, -0.162765861f,
+    -0.194202349f, 0.040073555f, 0.0474809036f, 0.253182203f
+  },
+  {
+    0.607009232f, -1.13484383f, -1.11800063f, 0.172085017f, 0.261577725f, 0.771582544f,
+    0.0796956196f, -1.33732796f, 0.141811118f, -0.175058454f, -0.198835954f, -0.91093272f,
+    -1.14470971f, -0.93196255f, -0.935833395f, 0.0355702527f, -0.232330009f, 0.0871083736f,
+    0.708555996f, -0.821515143f, 0.73613435f, -0.143844843f, 0.157841399f, -0.210612625f,
+    -1.41115677f, -0.15677014f, -1.02272725f, -0.121323973f, 0.199740708f, -0.217066869f,
+    -0.264118433f, 0.389471292f, -0.805675864f, -1.02632403f, -0.675669014f, 0.113904484f,
+    -0.324827343f, 0.599444866f, -1.12204766f, -0.127603039f, -1.18583417f, 0.366921395f,
+    -0.576266408f, 0.0666233525f, 0.00569418771f, -0.0165250842f
+  },
+  {
+    -0.737677217f, 0.518239737f, -0.695411801f, -0.416620791f, -0.289872497f, -0.67866993f,
+    0.57854563f, 1.11233497f, -2.20968318f, 0.145973101f, -0.495260835f, -1.06803858f,
+    1.07184756f, 1.44412005f, -0.808448911f, 0.0821910352f, -0.00488740765f, -0.202553242f,
+    0.00362904044f, -0.610953927f, -1.32074273f, 0.0072991699f, -0.0224612653f, 0.191156998f,
+    0.721565962f, 0.792835593f, 0.228476658f, 0.0381698869f, -0.0386001877f, 0.123732999f,
+    0.178005248f, 0.811689794f, 1.42290533f, -0.267858267f, -1.22914517f, -1.26797473f,
+    0.515886128f, -1.29976785f, 0.624367356f, 0.638324738f, 0.903062046f, 1.10933995f,
+    0.739767134f, 0.199290916f, -0.026987996f, 0.274205208f
+  },
+  {
+    0.190877482f, -0.131796554f, 0.174202666f, -0.224272832f, 0.176644757f, 0.0610683821f,
+    -0.00638514617f, -0.310832411f, 0.160244644f, -0.0166204721f, -0.265284657f, 0.237069577f,
+    -0.340476811f, 0.0618982427f, -0.277140886f, -0.306907415f, 0.0687789172f, 0.181205258f,
+    0.243146747f, 0.207627997f, -0.0722170174f, 0.334005713f, 0.3191441f, -0.190233961f,
+    -0.00868642144f, -0.173530191f, -0.0410325341f, -0.251688927f, -0.32465446f, -0.0132939648f,
+    -0.00231586886f, -0.175656766f, -0.0820039064f, 0.249024883f, 0.141938284f, 0.210858315f,
+    0.0184756387f, -0.0227491222f, -0.00760568911f, -0.0357447974f, 0.078300938f, -0.212623522f,
+    0.084184587f, -0.0813997313f, 0.00508432323f, -0.0108759953f
+  },
+  {
+    0.209048718f, 0.216991007f, 0.0635015517f, 0.000728998915f, 0.158591613f, 0.0251601152f,
+    -0.237275228f, 0.050629627f, -0.121686392f, -0.0761934519f, 0.202408746f, 0.152239829f,
+    0.0974854231f, -0.142117649f, 0.133759052f, 0.126812026f, -0.158130839f, 0.145913526f,
+    -0.299357206f, 0.088836357f, -0.198530063f, -0.0480506755f, -0.212470144f, -0.230781034f,
+    0.0314846374f, -0.176433653f, 0.113875628f, 0.27662012f, 0.0944805145f, -0.131842479f,
+    -0.170471668f, 0.0102012297f, 0.124428548f, 0.00147596339f, -0.136092782f, 0.0400428735f,
+    0.0421647578f, 0.105517209f, -0.0779560581f, -0.146168277f, -0.00589847006f, 0.219995201f,
+    0.0737191811f, -0.121409677f, 0.228228182f, 0.289168f
+  },
+  {
+    -0.784120619f, 0.816733301f, 1.05021679f, -0.303199023f, -0.395787358f, -0.449003935f,
+    0.129937723f, 1.16790235f, -0.614248991f, 0.102120452f, 0.0469251759f, 0.36783877f,
+    0.928063214f, 1.65210164f, 1.01883876f, 0.111410104f, 0.0557945594f, 0.0908829048f,
+    -1.18080306f, 0.709251106f, 0.466936439f, 0.0925658047f, 0.00752699189f, -0.13453342f,
+    1.39195621f, 0.12470977f, 0.532621145f, -0.000599089079f, -0.0107904598f, -0.0595168509f,
+    0.494730324f, -0.105559506f, 1.39915228f, 0.67246604f, 0.614210784f, 0.126821876f,
+    0.7709077f, -1.25922287f, 0.848025322f, 0.360948175f, 1.30404603f, -0.43212682f,
+    0.405211151f, -0.073911123f, -0.0136094298f, 0.0402421616f
+  },
+  {
+    -1.91698873f, -1.57725906f, -2.08480096f, 0.210160226f, 0.108992971f, 0.059039332f,
+    0.606102943f, -2.66421795f, -1.61894226f, 0.0455410741f, -0.20020099f, -0.301269531f,
+    -0.914741457f, -1.72157919f, -1.23322701f, -0.214121878f, 0.108120628f, 0.0904728025f,
+    0.976443887f, -1.18285108f, 0.524862409f, 0.211199522f, -0.103232928f, -0.0709613115f,
+    -0.833799899f, -0.839597821f, -1.0436399f, 0.194136262f, -0.118035011f, -0.107615739f,
+    -0.0333038755f, 0.832212806f, -1.68947995f, -2.14379764f, -1.64693463f, -0.681886196f,
+    -0.512811363f, 1.2448858f, -1.06067467f, -0.739016593f, -0.183583722f, -0.272954255f,
+    -0.564163208f, 0.00878598355f, 0.0148083605f, 0.066266261f
+  },
+  {
+    -0.554572284f, 0.403224707f, 0.35487026f, -0.45085156f, -0.39026323f, -0.551304042f,
+    0.378108442f, 0.692093134f, -1.42841935f, -0.496402621f, -0.402655363f, 0.0958817825f,
+    0.448025852f, 1.04446137f, -0.432381183f, 0.126855552f, -0.104485467f, 0.0140068121f,
+    -0.0917183086f, -0.0273723416f, -1.0448122f, 0.0541004948f, 0.163650393f, -0.00221031997f,
+    0.204393893f, 0.619059622f, 0.473288149f, 0.0980397388f, 0.0558446832f, -0.112928003f,
+    -0.12818788f, 0.446304202f, 0.868089378f, 0.0220583975f, -0.570844948f, -1.08601069f,
+    0.123692691f, -0.958934247f, 0.481537223f, 0.506391287f, 0.60607487f, 0.962347388f,
+    0.907049716f, 0.055598557f, 0.118181057f, 0.438971043f
+  },
+  {
+    0.13632524f, 0.134896219f, 0.00163721771f, 0.0504312627f, 0.23770237f, 0.215262666f,
+    0.0639525428f, -0.33208403f, 0.0319264196f, 0.0743157119f, -0.139081091f, -0.115068294f,
+    0.160872087f, -0.157026514f, 0.1788176f, -0.113510258f, 0.0877823159f, 0.323562592f,
+    -0.240150124f, -0.291460246f, 0.124288224f, -0.14733237f, -0.197474778f, -0.258818448f,
+    0.263755918f, 0.188409507f, 0.219135985f, 0.270128518f, -0.140815407f, 0.0393518247f,
+    -0.0602402613f, -0.201072589f, -0.0533192456f, -0.0669093579f, -0.0874714106f, -0.30670473f,
+    0.104194842f, 0.0952149928f, 0.00445146905f, -0.0359008983f, 0.0839238465f, -0.09490899f,
+    0.0319789723f, 0.178293839f, 0.296374798f, -0.11072439f
+  },
+  {
+    0.105126135f, -0.212349698f, 0.0152871488f, 0.00704611931f, -0.0414786302f, -0.00599782821f,
+    0.0711798072f, -0.171509653f, 0.0120340642f, 0.0674216822f, 0.200223967f, -0.215802565f,
+    0.0428624861f, -0.249325082f, -0.20621331f, 0.250666857f, -0.106747366f, -0.064920038f,
+    0.0713678673f, 0.159531593f, -0.123577327f, 0.180830553f, -0.306252658f, -0.187707916f,
+    -0.118030138f, 0.304756582f, 0.211970553f, 0.293790996f, 0.0541292392f, 0.196366474f,
+    -0.0659879744f, -0.08993949f, 0.239780217f, -0.203180537f, 0.0725316703f, -0.109635465f,
+    -0.137796775f, -0.0481659845f, -0.158690766f, -0.182545424f, -0.0129486946f, 0.044278305f,
+    0.282254666f, 0.199266255f, 0.21364814f, 0.264587611f
+  },
+  {
+    -0.230603471f, -0.17050831f, -0.0205911919f, 0.0453912653f, 0.165102646f, 0.0486112051f,
+    0.00560458563f, -0.706085682f, -0.266023993f, -0.15731664f, 0.200688034f, -0.412626415f,
+    -0.523411155f, -0.46032995f, -0.621420205f, 0.0346855409f, -0.15446946f, 0.0914731771f,
+    0.260778278f, -0.711482048f, 0.017278906f, 0.0738451108f, 0.264486462f, -0.124323793f,
+    -0.0232759174f, -0.217104748f, -0.29131487f, 0.211345673f, -0.311340839f, -0.0594260022f,
+    0.0653073117f, 0.2602925f, -0.22642684f, -0.345842898f, -0.69191134f, -0.147835508f,
+    -0.14236784f, 0.287451982f, -0.10997507f, -0.304664373f, -0.129672617f, 0.108683415f,
+    -0.564530313f, 0.0179931f, 0.033393383f, -0.319518179f
+  },
+  {
+    -0.849025905f, -0.604973912f, -1.00056279f, 0.120361805f, -0.229315147f, -0.0764736608f,
+    -0.0789597034f, -1.14586866f, -0.792892814f, -0.535003304f, 0.610533834f, -0.740938187f,
+    -0.24380368f, -1.17552972f, -1.00431776f, -0.0521448068f, -0.118134506f, -0.0397528298f,
+    0.341883242f, -0.327394933f, 0.658336163f, -0.14901033f, 0.151192799f, -0.197477117f,
+    -0.740930855f, -0.496297747f, -0.554357529f, 0.140086949f, -0.242043346f, -0.195580855f,
+    -0.287604421f, 0.327268869f, -1.25092506f, -0.840017021f, -1.28784132f, 0.116133995f,
+    0.134393603f, 0.379958004f, -0.799443305f, -0.73083514f, -0.585546911f, -0.586985648f,
+    -0.622427881f, -0.139339685f, -0.239898711f, 0.276974022f
+  },
+  {
+    0.143513605f, 0.0821802914f, 0.0131011782f, -0.172544673f, 0.344405413f, -0.124311388f,
+    0.0644754171f, -0.243381247f, -0.154065356f, 0.155302405f, -0.0445044152f, 0.0288923625f,
+    0.0368143953f, -0.221924067f, 0.24540253f, 0.333820403f, 0.186893031f, 0.0956221446f,
+    -0.194992796f, -0.326334357f, -0.165674075f, -0.265152544f, 0.0844184756f, -0.208971173f,
+    0.133268014f, 0.0427704789f, 0.0034549369f, -0.154487729f, 0.0341663472f, 0.320140421f,
+    0.203179523f, -0.0227638558f, 0.121775754f, -0.327693015f, 0.00339812832f, -0.228448316f,
+    0.178851992f, 0.234338135f, 0.235935122f, 0.122559249f, 0.137451127f, -0.177035719f,
+    -0.0660696849f, 0.0206199475f, 0.135024518f, 0.0939187482f
+  },
+  {
+    -0.55003643f, -0.735774755f, -0.717458844f, 0.0208837464f, -0.00202184147f, 0.161806181f,
+    0.666757345f, -1.08819163f, -0.780048609f, -0.405225992f, 0.56926167f, -0.72092545f,
+    -0.352430046f, -1.16402936f, -0.919836879f, 0.179503247f, -0.0269286986f, -0.201824412f,
+    0.486342937f, -0.96789062f, 0.510000408f, -0.239722893f, -0.0652104691f, -0.00600084616f,
+    -0.072565265f, 0.0473446809f, -0.948192418f, -0.088968493f, -0.216249689f, -0.00844232924f,
+    0.155451998f, 0.256181002f, -0.933269739f, -0.795355737f, -1.19199157f, 0.0633144304f,
+    -0.249714494f, 0.591203809f, -0.694717228f, -0.358653665f, 0.0297685098f, -0.47870329f,
+    -1.00926733f, -0.0604527518f, 0.093657583f, -0.109468855f
+  }
+};
+
+constexpr float kHiddenBias[33] = {
+  -0.877825797f, 0.0038274317f, 3.27962916e-05f, 0.00101204391f, -0.0199675951f, -1.043033f,
+  -0.0879513621f, -1.4035337f, -1.34044409f, -1.52667987f, -0.049001202f, -0.584570467f,
+  0.54650104f, 1.14051759f, -0.0679145455f, -0.0654476285f, -0.0652128831f, 0.0443290621f,
+  0.0f, 0.0246695895f, 0.977772117f, -0.994665623f, 0.0431292467f, 0.0976803154f,
+  -1.22325695f, 1.65700376f, -0.783295333f, 0.0657426044f, 0.0441807657f, 0.364892095f,
+  0.657741189f, 0.0758768171f, 0.667996705f
+};
+
+constexpr float kOutputWeights[2][33] = {
+  {
+    -1.17975581f, 0.420376271f, 0.0804494321f, 0.194269463f, -0.305080086f, -0.694460332f,
+    0.013326548f, -0.702038884f, -1.02692187f, -1.18301404f, 0.119989142f, -0.137081757f,
+    0.757662356f, 1.22987902f, 0.117752165f, -0.113339804f, -0.276946187f, -0.290041745f,
+    0.0107984086f, 0.0837003887f, 0.81674844f, -0.3185305f, 0.152071774f, 0.172535151f,
+    -1.20526052f, 1.44499505f, -0.378109962f, -0.0228557661f, 0.364648372f, 0.036779508f,
+    0.67583698f, -0.0434703492f, 0.494752526f
+  },
+  {
+    0.491870344f, -0.389699191f, -0.34658891f, -0.104436256f, -0.11273133f, 1.07336879f,
+    0.157127544f, 0.819883347f, 1.83249271f, 0.802743196f, 0.299470961f, 0.48757726f,
+    -0.768261731f, -0.762539506f, 0.013775738f, 0.0680504218f, -0.0101406453f, 0.273467898f,
+    0.141015425f, 0.299140781f, -0.551805675f, 0.192550272f, -0.266458154f, -0.00569406478f,
+    0.92695111f, -1.249259f, 0.563351929f, -0.165774763f, -0.153338477f, -0.195496753f,
+    -0.839593351f, -0.202752411f, -0.208254173f
+  }
+};
+
+constexpr float kOutputBias[2] = {
+  0.0380993783f, -0.0380993336f
+};
+
+/**
+* @brief  infer(): Run the model on the features
+*
+* @param const float in[]: The features of the signal.
+* @param float out[]: The two outputs of the model (no fall, fall).
+* @return void
+*
+**/
+inline void infer(const float in[kInputs], float out[kOutputs]) {
+  // FULLY_CONNECTED and LOGISTIC
+  float hidden[kHidden];
+  for (int o = 0; o < kHidden; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kInputs; d++) {
+      total += in[d] * kHiddenWeights[o][d];
+    }
+    hidden[o] = 1.f / (1.f + std::exp(-(total + kHiddenBias[o])));
+  }
+
+  // FULLY_CONNECTED
+  float logits[kOutputs];
+  for (int o = 0; o < kOutputs; o++) {
+    float total = 0.f;
+    for (int d = 0; d < kHidden; d++) {
+      total += hidden[d] * kOutputWeights[o][d];
+    }
+    logits[o] = total + kOutputBias[o];
+  }
+
+  // SOFTMAX with beta 1
+  float max_coeff = logits[0];
+  for (int i = 1; i < kOutputs; i++) {
+    if (logits[i] > max_coeff) max_coeff = logits[i];
+  }
+  float exp_sum = 0.0;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] = std::exp((logits[i] - max_coeff) * 1.0f);
+    exp_sum += out[i];
+  }
+  float reciprocal_sum_exp = 1.f / exp_sum;
+  for (int i = 0; i < kOutputs; i++) {
+    out[i] *= reciprocal_sum_exp;
+  }
+}
+
+}  // namespace fall_model_f46_aot
+
+#endif  // FALL_MODEL_F46_AOT_H_
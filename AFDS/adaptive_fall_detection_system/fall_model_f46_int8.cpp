@@ -0,0 +1,348 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_int8.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    The int8 quantized version of the model f46, in a C byte array form
+  *
+  *
+  *
+  *
+**/
+
+// Generated from the float model with the host tool:
+// quantize_model --out adaptive_fall_detection_system f46
+
+#include "fall_model_f46_int8.h"
+
+// We need to keep the data array aligned on some architectures.
+#ifdef __has_attribute
+#define HAVE_ATTRIBUTE(x) __has_attribute(x)
+#else
+#define HAVE_ATTRIBUTE(x) 0
+#endif
+#if HAVE_ATTRIBUTE(aligned) || (defined(__GNUC__) && !defined(__clang__))
+#define DATA_ALIGN_ATTRIBUTE __attribute__((aligned(16)))
+#else
+#define DATA_ALIGN_ATTRIBUTE
+#endif
+
+const unsigned char fall_model_int8_data[] DATA_ALIGN_ATTRIBUTE = {
+  0x24, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0x64, 0x0e, 0x00, 0x00,
+  0xf0, 0x07, 0x00, 0x00, 0xec, 0x06, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00,
+  0x2c, 0x06, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0xac, 0x05, 0x00, 0x00,
+  0xf8, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00,
+  0xc4, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x51, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x74, 0x38, 0x20, 0x62, 0x79,
+  0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x5f, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xcc, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0xa8, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x18, 0x0d, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00,
+  0xac, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x0c, 0x05, 0x00, 0x00,
+  0xc8, 0x04, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00,
+  0x44, 0x03, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0xce, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x19,
+  0xd6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xde, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0xe6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x72,
+  0xfa, 0xff, 0xff, 0xff, 0x00, 0x0e, 0x06, 0x00, 0x06, 0x00, 0x05, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x66, 0x65, 0x61, 0x74,
+  0x75, 0x72, 0x65, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x00, 0x00,
+  0x96, 0xf9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+  0xa5, 0xf7, 0xeb, 0x3e, 0x08, 0x8d, 0x8b, 0x3f, 0xe0, 0x5e, 0x1f, 0x3f,
+  0x57, 0xa6, 0xc7, 0x42, 0x6c, 0xc3, 0x50, 0x42, 0xbd, 0x77, 0x59, 0x42,
+  0xf6, 0x14, 0x52, 0x3f, 0xa0, 0xd7, 0x7e, 0x3f, 0x9a, 0xa4, 0x4a, 0x3f,
+  0xf7, 0x60, 0xfe, 0x40, 0xb3, 0xcd, 0x86, 0x41, 0xda, 0x60, 0x7c, 0x40,
+  0x00, 0x6c, 0x50, 0x40, 0x00, 0xf0, 0x71, 0x3f, 0x00, 0x4c, 0x2d, 0x40,
+  0xe6, 0x1a, 0x87, 0x43, 0x00, 0xe2, 0x6e, 0x43, 0x00, 0xfe, 0x7d, 0x43,
+  0xcf, 0x56, 0x72, 0x40, 0x00, 0xc4, 0xea, 0x40, 0x00, 0xbc, 0x61, 0x40,
+  0x00, 0x00, 0x80, 0x43, 0xf5, 0x1b, 0x62, 0x43, 0x00, 0x00, 0x80, 0x43,
+  0xf3, 0xab, 0x93, 0x40, 0x00, 0x81, 0x04, 0x41, 0x00, 0x84, 0xc7, 0x40,
+  0x00, 0xff, 0xfe, 0x43, 0x00, 0xe5, 0xb2, 0x43, 0x00, 0xff, 0xfe, 0x43,
+  0x00, 0x78, 0xfa, 0x3f, 0x67, 0xb7, 0xf0, 0x3f, 0x55, 0x65, 0x60, 0x3f,
+  0xab, 0xa6, 0xdf, 0x40, 0x55, 0x6d, 0x21, 0x40, 0x55, 0xfd, 0x4d, 0x40,
+  0x79, 0x97, 0xee, 0x40, 0x4b, 0xba, 0x2d, 0x3f, 0x29, 0xdb, 0x8e, 0x3f,
+  0x33, 0xbb, 0x1c, 0x40, 0x4b, 0x8f, 0x4b, 0x40, 0x00, 0xd8, 0xde, 0x40,
+  0x00, 0xcc, 0x64, 0x40, 0x00, 0xff, 0xfe, 0x43, 0x00, 0x7c, 0x9e, 0x43,
+  0x00, 0x47, 0x9f, 0x43, 0xae, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x82, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x80, 0x3f, 0x5a, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x07, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x70, 0xf4, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x10, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0xf5, 0xff, 0xff,
+  0x8c, 0xfd, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x64, 0x65, 0x6e,
+  0x74, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4c, 0xf5, 0xff, 0xff,
+  0xbc, 0xfd, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x84, 0xf5, 0xff, 0xff, 0xfa, 0xf5, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xf4, 0xf5, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe3, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x51, 0x9d, 0x03, 0x3d, 0xe4, 0xf5, 0xff, 0xff, 0x5a, 0xf6, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2f, 0x62, 0x69, 0x61, 0x73, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4c, 0xf6, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xef, 0x67, 0x6c, 0x38, 0xb6, 0xfc, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+  0x5c, 0xfd, 0xff, 0xff, 0xc2, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x2f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0xbc, 0xf6, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xef, 0x67, 0x6c, 0x3c,
+  0x26, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0xae, 0x1d, 0x06, 0x0d, 0xeb, 0xd0, 0x01, 0xcf, 0xb9, 0xae, 0x08, 0xf6,
+  0x35, 0x55, 0x08, 0xf8, 0xed, 0xec, 0x01, 0x06, 0x39, 0xea, 0x0b, 0x0c,
+  0xac, 0x64, 0xe6, 0xfe, 0x19, 0x03, 0x2f, 0xfd, 0x22, 0x22, 0xe5, 0xe8,
+  0xf9, 0xf8, 0x4a, 0x0b, 0x39, 0x7f, 0x38, 0x15, 0x22, 0xcb, 0xcb, 0x01,
+  0x05, 0xff, 0x13, 0x0a, 0x15, 0xda, 0x0d, 0xee, 0x00, 0x40, 0xa9, 0x27,
+  0xf5, 0xf5, 0xf2, 0xc6, 0xf2, 0xf2, 0x00, 0x00, 0x6e, 0xf7, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x09, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x76,
+  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x6c, 0xf7, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x5c, 0xf7, 0xff, 0xff,
+  0xcc, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64,
+  0x65, 0x6e, 0x2f, 0x73, 0x69, 0x67, 0x6d, 0x6f, 0x69, 0x64, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x90, 0xf7, 0xff, 0xff, 0x0c, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xd4, 0xf7, 0xff, 0xff,
+  0x4a, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x44, 0xf8, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x5e, 0x92, 0x8f, 0x40, 0x34, 0xf8, 0xff, 0xff,
+  0xaa, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x62,
+  0x69, 0x61, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x9c, 0xf8, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa5, 0xf6, 0x27, 0x3c,
+  0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0xaa, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff,
+  0xf7, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff,
+  0x6b, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff,
+  0x35, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+  0x9f, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x89, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xff, 0xff,
+  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9a, 0xf9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x2f, 0x77,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x73, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x94, 0xf9, 0xff, 0xff,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xae, 0x4e, 0xa7, 0x3f, 0x00, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xee, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xed, 0xed, 0xe7, 0xff, 0x01,
+  0x00, 0xfd, 0xfa, 0x01, 0x02, 0x01, 0x01, 0xf9, 0x1a, 0xe7, 0xfd, 0x04,
+  0xfd, 0xf5, 0xe5, 0x1d, 0x03, 0x00, 0x06, 0xff, 0xdd, 0x57, 0xff, 0x00,
+  0x01, 0x05, 0x00, 0xff, 0x04, 0x00, 0x01, 0x01, 0x02, 0xfc, 0x03, 0xfe,
+  0x02, 0xf1, 0x00, 0x00, 0x00, 0xfb, 0xf7, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd4, 0x0d, 0x00, 0xff, 0xff, 0xc7,
+  0xd5, 0xfb, 0x01, 0x00, 0x00, 0xfc, 0x4b, 0x5e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55, 0x43, 0x38,
+  0x00, 0x00, 0x00, 0x14, 0xfd, 0xfd, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x05, 0xce, 0x1a, 0x00, 0xff, 0x00, 0x06, 0x13, 0x1d,
+  0x01, 0x00, 0xff, 0x9e, 0x0d, 0xab, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xb9, 0x21, 0x40, 0x00, 0x00,
+  0x00, 0x13, 0x09, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x00, 0x00,
+  0x00, 0xef, 0x1c, 0x1d, 0xff, 0x01, 0x00, 0xdb, 0xfb, 0xca, 0x01, 0xff,
+  0x00, 0x54, 0xca, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x01, 0x24, 0x38, 0x24, 0x00, 0x00, 0x00, 0xf2,
+  0x00, 0xf6, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0xff, 0x00, 0x00, 0xc7,
+  0xf7, 0xf1, 0x00, 0x00, 0x00, 0xed, 0x27, 0x0c, 0xff, 0x00, 0x00, 0xe3,
+  0xd0, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaa, 0xbe, 0x0c, 0x00, 0x01, 0x00, 0xe2, 0xf4, 0xef,
+  0x00, 0x01, 0xff, 0x01, 0xfc, 0xfe, 0x02, 0x01, 0x01, 0xea, 0x00, 0x08,
+  0xfd, 0x00, 0xfc, 0x13, 0x03, 0xf8, 0x04, 0x09, 0x05, 0x32, 0x04, 0xf9,
+  0x00, 0x00, 0x01, 0x03, 0xff, 0xfe, 0x05, 0x00, 0x01, 0x02, 0x02, 0x05,
+  0x02, 0xf5, 0x01, 0x02, 0x00, 0x00, 0x00, 0xe4, 0xfd, 0xfd, 0x00, 0x00,
+  0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc4, 0xd4, 0x00, 0x02,
+  0x00, 0x0d, 0x11, 0x15, 0x01, 0xfe, 0xff, 0x89, 0xca, 0x84, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x38,
+  0xe7, 0xe8, 0x00, 0x01, 0x01, 0xf0, 0xf7, 0xe7, 0x00, 0x01, 0xff, 0x00,
+  0xff, 0x00, 0x03, 0x01, 0x01, 0xf9, 0x05, 0xeb, 0xff, 0x05, 0xfe, 0x0d,
+  0xfb, 0x15, 0x04, 0x00, 0x04, 0x23, 0xfb, 0x47, 0x00, 0x00, 0x01, 0x06,
+  0x00, 0xfe, 0x01, 0xff, 0x01, 0x00, 0x02, 0xfe, 0x03, 0xf5, 0xf5, 0xfc,
+  0x00, 0x01, 0x00, 0xca, 0xf2, 0xf1, 0x01, 0x01, 0xff, 0xfd, 0xfc, 0xfe,
+  0x03, 0x01, 0x01, 0xe4, 0x10, 0xee, 0xfe, 0x08, 0xfc, 0xdb, 0x01, 0xca,
+  0x03, 0x00, 0x04, 0xfc, 0xec, 0xe9, 0x00, 0x01, 0x01, 0x07, 0xff, 0xff,
+  0x01, 0xff, 0x01, 0x00, 0x03, 0xfe, 0x03, 0x13, 0x06, 0x09, 0x00, 0x01,
+  0x01, 0xf7, 0xf2, 0xe8, 0x01, 0x02, 0x00, 0x04, 0x04, 0xff, 0x03, 0x02,
+  0x01, 0x03, 0x19, 0xfe, 0xfe, 0x07, 0xff, 0x0a, 0x04, 0xe4, 0x05, 0x04,
+  0x05, 0x0f, 0xea, 0xfa, 0x02, 0x00, 0x01, 0x07, 0x01, 0x00, 0x02, 0xff,
+  0x01, 0x01, 0x03, 0xfe, 0x03, 0xef, 0x09, 0xf3, 0x00, 0x00, 0x00, 0xfc,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd,
+  0x09, 0xdb, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x29, 0x00, 0xff, 0x00, 0x00,
+  0xbd, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xea, 0x01, 0xfa, 0x00, 0x01, 0x01, 0xe2, 0xfc, 0x0c,
+  0x00, 0x01, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x34, 0xe5,
+  0xff, 0x05, 0xff, 0x3a, 0x00, 0x09, 0x01, 0xff, 0x04, 0x15, 0x48, 0x3b,
+  0x00, 0xff, 0x00, 0x04, 0x02, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe,
+  0x02, 0xb3, 0x35, 0xfa, 0x00, 0x00, 0x00, 0x12, 0x14, 0x1a, 0x01, 0xff,
+  0x00, 0x04, 0x07, 0xfe, 0x01, 0xff, 0xff, 0x26, 0x0f, 0xd7, 0x03, 0xfd,
+  0x01, 0x26, 0x2b, 0xd6, 0xfd, 0x00, 0xfd, 0x18, 0x24, 0xec, 0x01, 0x01,
+  0x00, 0xfd, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0xfe, 0xf7,
+  0xe1, 0xea, 0x00, 0xff, 0xff, 0x0b, 0x19, 0x10, 0x01, 0xff, 0x01, 0xff,
+  0x08, 0xfc, 0xfe, 0xff, 0xfe, 0xdd, 0xf9, 0x21, 0x03, 0xfb, 0x03, 0x21,
+  0x0c, 0xd1, 0xfc, 0xfc, 0xfb, 0x3b, 0x07, 0xa6, 0x01, 0x00, 0xff, 0xf9,
+  0xff, 0x01, 0xfc, 0x00, 0xff, 0x00, 0xfe, 0x02, 0xfd, 0x08, 0xfa, 0x07,
+  0x00, 0x00, 0x00, 0x08, 0x05, 0xf5, 0x00, 0x00, 0x00, 0xff, 0xfd, 0x01,
+  0x00, 0x00, 0x00, 0xde, 0x1b, 0xd4, 0x00, 0x02, 0x00, 0x31, 0x2e, 0x29,
+  0x00, 0xfe, 0x00, 0x92, 0x13, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0xff, 0x00, 0x01, 0x00, 0x95, 0x02, 0xe6, 0x00, 0x00,
+  0x00, 0xee, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00, 0xff, 0x00,
+  0x00, 0xde, 0xe0, 0xed, 0x01, 0x01, 0x01, 0x09, 0x26, 0x32, 0xff, 0x00,
+  0x00, 0x8b, 0x2a, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0x50, 0xd4, 0xd2, 0x00, 0x00, 0x00, 0xfb,
+  0x03, 0xfd, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0xfe,
+  0xe5, 0xe4, 0x00, 0x00, 0x01, 0xf3, 0x36, 0x34, 0xff, 0x01, 0x01, 0xdc,
+  0xb5, 0xd1, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xb1, 0x2c, 0xc4, 0x00, 0x00, 0x00, 0xf9, 0x0b, 0x0c,
+  0x00, 0x00, 0x00, 0xff, 0x02, 0xff, 0x00, 0x00, 0x00, 0xe5, 0xf2, 0x1e,
+  0x00, 0x00, 0x00, 0xff, 0x04, 0xf4, 0x00, 0xff, 0x00, 0x68, 0x3e, 0x6c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x13, 0xe3, 0x21, 0x00, 0x00, 0x00, 0xff, 0x0a, 0x05, 0x00, 0x00,
+  0x00, 0x01, 0xff, 0x00, 0x01, 0x00, 0x00, 0x32, 0x02, 0x1b, 0x00, 0x00,
+  0xff, 0xcd, 0xf8, 0x26, 0x01, 0x00, 0x00, 0x53, 0x4a, 0x10, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xe0,
+  0x05, 0x2d, 0x00, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x30, 0x29, 0xeb, 0x00, 0x01, 0xff, 0xfa,
+  0xed, 0xe9, 0x01, 0x01, 0x01, 0x7f, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x0c, 0x3e,
+  0x00, 0xff, 0xff, 0x0d, 0x0a, 0x20, 0x00, 0xff, 0x00, 0xff, 0xfd, 0xfd,
+  0xfd, 0xff, 0xfe, 0x07, 0xd6, 0x11, 0x02, 0xfb, 0x02, 0xe4, 0x1b, 0xd7,
+  0xfb, 0xff, 0xfb, 0xd1, 0x37, 0xab, 0x00, 0x01, 0xff, 0xfb, 0xff, 0x00,
+  0xfe, 0x00, 0xff, 0x00, 0xfd, 0x02, 0xfe, 0x1a, 0x01, 0xfc, 0x00, 0x00,
+  0x00, 0xe0, 0xf4, 0xe4, 0x00, 0x01, 0xff, 0x01, 0xfa, 0xfd, 0x03, 0x01,
+  0xfe, 0x11, 0xff, 0xd9, 0x00, 0xfd, 0xfc, 0x01, 0xfc, 0x25, 0x03, 0x05,
+  0x01, 0x0f, 0xf5, 0x30, 0x00, 0x01, 0x01, 0xff, 0xfe, 0xfd, 0x03, 0xff,
+  0x01, 0x01, 0x02, 0x06, 0x02, 0x4e, 0xf9, 0x43, 0x00, 0x00, 0x00, 0xef,
+  0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x01, 0xff, 0x00, 0xff, 0xc1,
+  0x0d, 0x23, 0x01, 0x01, 0x00, 0x41, 0x37, 0xdb, 0x00, 0xff, 0x00, 0x9e,
+  0xa7, 0xfb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0xe0, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xe3, 0x1c,
+  0xff, 0x00, 0xff, 0xf7, 0xdb, 0xd3, 0x00, 0xff, 0x01, 0x6c, 0x1a, 0xcd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0xd1, 0x37, 0x46, 0x00, 0x01, 0x01, 0xe9, 0xf0, 0xed, 0x00, 0x01,
+  0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x17, 0x0a, 0x12, 0xfd, 0x04,
+  0x01, 0x12, 0x01, 0xe6, 0x05, 0x01, 0x03, 0x00, 0xfd, 0xe9, 0x01, 0x00,
+  0x01, 0x04, 0x01, 0x00, 0x04, 0xff, 0x01, 0x01, 0x03, 0xfe, 0x01, 0xe3,
+  0xfd, 0x0a, 0xff, 0xff, 0xff, 0x10, 0x04, 0x02, 0x00, 0xfe, 0xff, 0x00,
+  0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xd4, 0x14, 0x12, 0x03, 0xf9, 0x01, 0x29,
+  0xee, 0xf2, 0xfd, 0xfb, 0xfb, 0x4c, 0xe0, 0xd6, 0x00, 0x01, 0xff, 0xf5,
+  0xfd, 0xfe, 0xfd, 0x01, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x03, 0x04, 0x10,
+  0x00, 0x00, 0x00, 0xde, 0xf0, 0xe9, 0x00, 0x01, 0xff, 0xfd, 0xfb, 0x00,
+  0x01, 0x01, 0xff, 0x1a, 0xed, 0x03, 0x00, 0x00, 0xfd, 0x0b, 0x1c, 0x00,
+  0x01, 0x04, 0x02, 0x26, 0x0f, 0xd4, 0x00, 0x01, 0x01, 0x00, 0xff, 0xfd,
+  0x01, 0x00, 0x00, 0x01, 0x01, 0x05, 0x02, 0x16, 0x1d, 0x6b, 0x00, 0x00,
+  0x00, 0x04, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0xe9, 0x10, 0x3f, 0xff, 0xfe, 0x00, 0xe3, 0xde, 0xcd, 0x01, 0x01,
+  0x01, 0x69, 0xd9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x00, 0x46, 0x48, 0xe5, 0x00, 0x00, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x34,
+  0xec, 0xf3, 0x00, 0x01, 0x00, 0x23, 0xcb, 0xdb, 0x00, 0x02, 0x01, 0x73,
+  0x0f, 0x4d, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x4e, 0x34, 0x40, 0x00, 0x00, 0x00, 0x03, 0x07, 0x02,
+  0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0x07, 0xe4, 0x12,
+  0x01, 0xfc, 0x00, 0x0e, 0x2e, 0xe8, 0x00, 0xff, 0xff, 0x52, 0xab, 0xe9,
+  0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x01,
+  0xfe, 0x07, 0x08, 0xb2, 0x00, 0xff, 0x00, 0x09, 0xf7, 0xfd, 0x00, 0xff,
+  0x00, 0xfd, 0x08, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0xea, 0xf8, 0x01, 0xfe,
+  0x02, 0xe3, 0x1a, 0xd9, 0xfd, 0xfd, 0xfd, 0x37, 0xbe, 0xb4, 0x00, 0x00,
+  0xff, 0xfc, 0xfe, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xca,
+  0xc6, 0x44, 0x00, 0x00, 0x00, 0xf3, 0x0e, 0xfb, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0x00, 0x00, 0x00, 0x01, 0x45, 0x22, 0x13, 0xff, 0xfe, 0x00, 0xcc,
+  0x0f, 0xd7, 0x00, 0x00, 0x00, 0xc4, 0x09, 0x7d, 0x00, 0x00, 0x00, 0xfe,
+  0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x08, 0x21, 0x17,
+  0x00, 0xff, 0x00, 0x02, 0x00, 0x07, 0x00, 0xff, 0x00, 0xfe, 0x07, 0xfe,
+  0xff, 0xff, 0xfe, 0x25, 0xfb, 0xd9, 0x01, 0xfb, 0x01, 0xd1, 0xf5, 0xff,
+  0x00, 0x00, 0xfb, 0xdd, 0xc5, 0xfd, 0x00, 0x00, 0xff, 0xfc, 0xfe, 0x00,
+  0xff, 0x00, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xe8, 0x17, 0xe5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x08, 0x00,
+  0x07, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x00, 0x3c, 0xfc, 0xff, 0xff, 0xff,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00
+};
+const int fall_model_int8_data_len = 3776;
@@ -0,0 +1,23 @@
+/**
+  *
+  *
+  * @file:    fall_model_f46_int8.h
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    The int8 quantized version of the model f46, in a C byte array form
+  *
+  *
+  *
+  *
+**/
+
+// Generated from the float model with the host tool:
+// quantize_model --out adaptive_fall_detection_system f46
+
+#ifndef FALL_MODEL_F46_INT8_H_
+#define FALL_MODEL_F46_INT8_H_
+
+extern const unsigned char fall_model_int8_data[];
+extern const int fall_model_int8_data_len;
+
+#endif  // FALL_MODEL_F46_INT8_H_
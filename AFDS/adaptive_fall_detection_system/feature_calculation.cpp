@@ -16,318 +16,464 @@
 
 #include <Arduino.h>
 
-void feature_calc(float calc_feat[], float acc_x_sig[], float acc_y_sig[],
-                         float acc_z_sig[], float gyro_x_sig[], float gyro_y_sig[],
-                         float gyro_z_sig[], int signal_len) {
-  // Instanciate x-axis variables with first signal value
-  float max_x_acc = acc_x_sig[0], min_x_acc = acc_x_sig[0], tot_x_acc = acc_x_sig[0];
-  float max_slope_x_acc = 0, sum_acc_x = 0;
-  float max_x_peaks[3] = {0}, min_x_peaks[3] = {0};
-  max_x_peaks[0] = acc_x_sig[0], min_x_peaks[0] = acc_x_sig[0];
-  // Instanciate y-axis variables with first signal value
-  float max_y_acc = acc_y_sig[0], min_y_acc = acc_y_sig[0], tot_y_acc = acc_y_sig[0];
-  float max_slope_y_acc = 0, sum_acc_y = 0;
-  float max_y_peaks[3] = {0}, min_y_peaks[3] = {0};
-  max_y_peaks[0] = acc_y_sig[0], min_y_peaks[0] = acc_y_sig[0];
-  min_y_peaks[1] = acc_y_sig[0], min_y_peaks[2] = acc_y_sig[0];
-  // Instanciate z-axis variables with first signal value
-  float max_z_acc = acc_z_sig[0], min_z_acc = acc_z_sig[0], tot_z_acc = acc_z_sig[0];
-  float max_slope_z_acc = 0, sum_acc_z = 0;
-  float max_z_peaks[3] = {0}, min_z_peaks[3] = {0};
-  max_z_peaks[0] = acc_z_sig[0], min_z_peaks[0] = acc_z_sig[0];
-  // Instanciate x-axis variables with first signal value
-  float max_x_gyro = gyro_x_sig[0], min_x_gyro = gyro_x_sig[0], tot_x_gyro = gyro_x_sig[0];
-  float max_slope_x_gyro = 0, sum_gyro_x = 0;
-  // Instanciate y-axis variables with first signal value
-  float max_y_gyro = gyro_y_sig[0], min_y_gyro = gyro_y_sig[0], tot_y_gyro = gyro_y_sig[0];
-  float max_slope_y_gyro = 0, sum_gyro_y = 0;
-  // Instanciate z-axis variables with first signal value
-  float max_z_gyro = gyro_z_sig[0], min_z_gyro = gyro_z_sig[0], tot_z_gyro = gyro_z_sig[0];
-  float max_slope_z_gyro = 0, sum_gyro_z = 0;
-  // Instanciate magnitude calculation variables
-  float accel_mag = sqrt(sq(acc_x_sig[0])+sq(acc_y_sig[0])+sq(acc_z_sig[0]));
-  float max_accel_mag = accel_mag, min_accel_mag = accel_mag;
-  // Instanciate windowed standard deviation magnitude variables
-  float mean_std_x = 0, mean_std_y = 0, mean_std_z = 0;
-  float sum_std_x = 0, sum_std_y = 0, sum_std_z = 0;
-  float std = 0, std_hoz = 0, max_std = 0, max_std_hoz = 0;
-  float window_len = 20;
-  // Run through signal making calculations
-  for (int index = 1; index < signal_len; index++) {
-    // Calculate acc X-axis features
-    max_x_acc = max(acc_x_sig[index], max_x_acc);
-    min_x_acc = min(acc_x_sig[index], min_x_acc);
-    max_slope_x_acc = max(abs(acc_x_sig[index-1]-acc_x_sig[index]), max_slope_x_acc);
-    tot_x_acc += acc_x_sig[index];
-    // Calculate acc Y-axis features
-    max_y_acc = max(acc_y_sig[index], max_y_acc);
-    min_y_acc = min(acc_y_sig[index], min_y_acc);
-    max_slope_y_acc = max(abs(acc_y_sig[index-1]-acc_y_sig[index]), max_slope_y_acc);
-    tot_y_acc += acc_y_sig[index];
-    // Calculate acc Z-axis features
-    max_z_acc = max(acc_z_sig[index], max_z_acc);
-    min_z_acc = min(acc_z_sig[index], min_z_acc);
-    max_slope_z_acc = max(abs(acc_z_sig[index-1]-acc_z_sig[index]), max_slope_z_acc);
-    tot_z_acc += acc_z_sig[index];
-    // Calculate gyro X-axis features
-    max_x_gyro = max(gyro_x_sig[index], max_x_gyro);
-    min_x_gyro = min(gyro_x_sig[index], min_x_gyro);
-    max_slope_x_gyro = max(abs(gyro_x_sig[index-1]-gyro_x_sig[index]), max_slope_x_gyro);
-    tot_x_gyro += gyro_x_sig[index];
-    // Calculate gyro Y-axis features
-    max_y_gyro = max(gyro_y_sig[index], max_y_gyro);
-    min_y_gyro = min(gyro_y_sig[index], min_y_gyro);
-    max_slope_y_gyro = max(abs(gyro_y_sig[index-1]-gyro_y_sig[index]), max_slope_y_gyro);
-    tot_y_gyro += gyro_y_sig[index];
-    // Calculate gyro Z-axis features
-    max_z_gyro = max(gyro_z_sig[index], max_z_gyro);
-    min_z_gyro = min(gyro_z_sig[index], min_z_gyro);
-    max_slope_z_gyro = max(abs(gyro_z_sig[index-1]-gyro_z_sig[index]), max_slope_z_gyro);
-    tot_z_gyro += gyro_z_sig[index];
-    // Calculate acceleration magnitude
-    accel_mag = sqrt(sq(acc_x_sig[index])+sq(acc_y_sig[index])+sq(acc_z_sig[index]));
-    max_accel_mag = max(accel_mag, max_accel_mag);
-    min_accel_mag = min(accel_mag, min_accel_mag);
-    // Calculate average of max and min peaks
-    if (index < signal_len-1) { // This is to make sure, the loop doesn't reach end of signal
-      // Calculate the x max peaks
-      if (acc_x_sig[index-1] < acc_x_sig[index] && acc_x_sig[index] >= acc_x_sig[index+1]) {
-        if(index < signal_len-2 && acc_x_sig[index] == acc_x_sig[index+1] && acc_x_sig[index+2] > acc_x_sig[index+1]) {
-           // This is for checking for the definition of a peak, if it evens out and the next sample is bigger, it is not defined as a peak
-           // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-           // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (max_x_peaks[0] <= acc_x_sig[index]) {
-            max_x_peaks[2] = max_x_peaks[1];
-            max_x_peaks[1] = max_x_peaks[0];
-            max_x_peaks[0] = acc_x_sig[index];
-          }
-          else if (max_x_peaks[1] <= acc_x_sig[index] ) {
-            max_x_peaks[2] = max_x_peaks[1];
-            max_x_peaks[1] = acc_x_sig[index];
-          }
-          else if (max_x_peaks[2] <= acc_x_sig[index] ) {
-            max_x_peaks[2] = acc_x_sig[index];
-          }
-        }
-      }
-      // Calculate the x min peaks
-      else if (acc_x_sig[index-1] > acc_x_sig[index] && acc_x_sig[index] <= acc_x_sig[index+1]) {
-        if(index < signal_len-2 && acc_x_sig[index] == acc_x_sig[index+1] && acc_x_sig[index+2] < acc_x_sig[index+1]) {
-        // This is for checking for the definition of a peak, if it evens out and the next sample is smaller, it is not defined as a peak
-        // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-        // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (min_x_peaks[0] >= acc_x_sig[index]) {
-            min_x_peaks[2] = min_x_peaks[1];
-            min_x_peaks[1] = min_x_peaks[0];
-            min_x_peaks[0] = acc_x_sig[index];
-          }
-          else if (min_x_peaks[1] >= acc_x_sig[index] ) {
-            min_x_peaks[2] = min_x_peaks[1];
-            min_x_peaks[1] = acc_x_sig[index];
-          }
-          else if (min_x_peaks[2] >= acc_x_sig[index] ) {
-            min_x_peaks[2] = acc_x_sig[index];
-          }
-        }
-      }
-      // Calculate the y max peaks
-      if (acc_y_sig[index-1] < acc_y_sig[index] && acc_y_sig[index] >= acc_y_sig[index+1]) {
-        if(index < signal_len-2 && acc_y_sig[index] == acc_y_sig[index+1] && acc_y_sig[index+2] > acc_y_sig[index+1]) {
-           // This is for checking for the definition of a peak, if it evens out and the next sample is bigger, it is not defined as a peak
-           // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-           // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (max_y_peaks[0] <= acc_y_sig[index]) {
-            max_y_peaks[2] = max_y_peaks[1];
-            max_y_peaks[1] = max_y_peaks[0];
-            max_y_peaks[0] = acc_y_sig[index];
-          }
-          else if (max_y_peaks[1] <= acc_y_sig[index] ) {
-            max_y_peaks[2] = max_y_peaks[1];
-            max_y_peaks[1] = acc_y_sig[index];
-          }
-          else if (max_y_peaks[2] <= acc_y_sig[index] ) {
-            max_y_peaks[2] = acc_y_sig[index];
-          }
-        }
-      }
-      // Calculate the y min peaks
-      else if (acc_y_sig[index-1] > acc_y_sig[index] && acc_y_sig[index] <= acc_y_sig[index+1]) {
-        if(index < signal_len-2 && acc_y_sig[index] == acc_y_sig[index+1] && acc_y_sig[index+2] < acc_y_sig[index+1]) {
-        // This is for checking for the definition of a peak, if it evens out and the next sample is smaller, it is not defined as a peak
-        // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-        // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (min_y_peaks[0] >= acc_y_sig[index]) {
-            min_y_peaks[2] = min_y_peaks[1];
-            min_y_peaks[1] = min_y_peaks[0];
-            min_y_peaks[0] = acc_y_sig[index];
-          }
-          else if (min_y_peaks[1] >= acc_y_sig[index] ) {
-            min_y_peaks[2] = min_y_peaks[1];
-            min_y_peaks[1] = acc_y_sig[index];
-          }
-          else if (min_y_peaks[2] >= acc_y_sig[index] ) {
-            min_y_peaks[2] = acc_y_sig[index];
-          }
-        }
-      }
-      // Calculate the z max peaks
-      if (acc_z_sig[index-1] < acc_z_sig[index] && acc_z_sig[index] >= acc_z_sig[index+1]) {
-        if(index < signal_len-2 && acc_z_sig[index] == acc_z_sig[index+1] && acc_z_sig[index+2] > acc_z_sig[index+1]) {
-        // This is for checking for the definition of a peak, if it evens out and the next sample is bigger, it is not defined as a peak
-        // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-        // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (max_z_peaks[0] <= acc_z_sig[index]) {
-            max_z_peaks[2] = max_z_peaks[1];
-            max_z_peaks[1] = max_z_peaks[0];
-            max_z_peaks[0] = acc_z_sig[index];
-          }
-          else if (max_z_peaks[1] <= acc_z_sig[index] ) {
-            max_z_peaks[2] = max_z_peaks[1];
-            max_z_peaks[1] = acc_z_sig[index];
-          }
-          else if (max_z_peaks[2] <= acc_z_sig[index] ) {
-            max_z_peaks[2] = acc_z_sig[index];
-          }
-        }
+// Insert a max peak into the three biggest peaks, biggest first
+template <typename T>
+static void insert_max_peak(T peaks[3], T value) {
+  if (peaks[0] <= value) {
+    peaks[2] = peaks[1];
+    peaks[1] = peaks[0];
+    peaks[0] = value;
+  }
+  else if (peaks[1] <= value) {
+    peaks[2] = peaks[1];
+    peaks[1] = value;
+  }
+  else if (peaks[2] <= value) {
+    peaks[2] = value;
+  }
+}
+
+// Insert a min peak into the three smallest peaks, smallest first
+template <typename T>
+static void insert_min_peak(T peaks[3], T value) {
+  if (peaks[0] >= value) {
+    peaks[2] = peaks[1];
+    peaks[1] = peaks[0];
+    peaks[0] = value;
+  }
+  else if (peaks[1] >= value) {
+    peaks[2] = peaks[1];
+    peaks[1] = value;
+  }
+  else if (peaks[2] >= value) {
+    peaks[2] = value;
+  }
+}
+
+// The peak lists used for training start as {newest, fill, fill}, and the peaks are then
+// inserted from the newest to the oldest. If the newest value is smaller than fill, the start
+// list isn't sorted, and the result only depends on how many peaks are bigger than or equal
+// to the newest value. The three biggest peaks are therefore enough to get the same result,
+// no matter in which order the peaks were found. The sum of the three peaks is returned.
+template <typename T>
+static T sum_max_peaks(const T found[3], T newest, T fill) {
+  T peaks[3] = {newest, fill, fill};
+  if (newest >= fill) {
+    for (int i = 0; i < 3; i++) {
+      insert_max_peak(peaks, found[i]);
+    }
+  }
+  else if (found[1] >= newest) {
+    peaks[0] = found[0];
+    peaks[1] = found[1];
+    peaks[2] = newest;
+    insert_max_peak(peaks, found[2]);
+  }
+  else if (found[0] >= newest) {
+    peaks[0] = found[0];
+    peaks[1] = newest;
+  }
+  return peaks[0]+peaks[1]+peaks[2];
+}
+
+// Same as sum_max_peaks(), but for the smallest min peaks
+template <typename T>
+static T sum_min_peaks(const T found[3], T newest, T fill) {
+  T peaks[3] = {newest, fill, fill};
+  if (newest <= fill) {
+    for (int i = 0; i < 3; i++) {
+      insert_min_peak(peaks, found[i]);
+    }
+  }
+  else if (found[1] <= newest) {
+    peaks[0] = found[0];
+    peaks[1] = found[1];
+    peaks[2] = newest;
+    insert_min_peak(peaks, found[2]);
+  }
+  else if (found[0] <= newest) {
+    peaks[0] = found[0];
+    peaks[1] = newest;
+  }
+  return peaks[0]+peaks[1]+peaks[2];
+}
+
+FeatureExtractor::FeatureExtractor() {
+  reset();
+}
+
+void FeatureExtractor::reset() {
+  for (int axis = 0; axis < 3; axis++) {
+    for (int i = 0; i < 3; i++) {
+      // Start with values that any peak will replace
+      accel[axis].max_peaks[i] = -INFINITY;
+      accel[axis].min_peaks[i] = INFINITY;
+    }
+    accel[axis].window_mean = 0;
+    accel[axis].window_m2 = 0;
+  }
+  max_std = max_std_hoz = 0;
+  window_pos = 0;
+  samples = 0;
+}
+
+void FeatureExtractor::update_signal(SignalStats& stats, float value) {
+  if (samples == 0) {
+    // Instanciate the variables with the first signal value
+    stats.max = stats.min = stats.sum = stats.welford_mean = value;
+    stats.welford_m2 = 0;
+    stats.max_slope = 0;
+  }
+  else {
+    stats.max = max(value, stats.max);
+    stats.min = min(value, stats.min);
+    stats.max_slope = max(fabs(stats.last-value), stats.max_slope);
+    stats.sum += value;
+    // Welford's method for the variance
+    float delta = value - stats.welford_mean;
+    stats.welford_mean += delta / (samples + 1);
+    stats.welford_m2 += delta * (value - stats.welford_mean);
+  }
+  stats.last = value;
+}
+
+void FeatureExtractor::update_accel(AccelStats& stats, float value) {
+  // Now that the sample after it is known, check if the last sample is a peak. The first
+  // and the newest sample of the signal are never peaks.
+  if (samples >= 2) {
+    float peak = stats.last[0];
+    float prev = stats.last[1];
+    // If it evens out and the sample before is bigger, it is not defined as a max peak,
+    // this is only checked if the sample before exists
+    bool check_even = samples >= 3 && peak == prev;
+    if (value < peak && peak >= prev) {
+      if (!(check_even && stats.last[2] > prev)) {
+        insert_max_peak(stats.max_peaks, peak);
       }
-      // Calculate the z min peaks
-      else if (acc_z_sig[index-1] > acc_z_sig[index] && acc_z_sig[index] <= acc_z_sig[index+1]) {
-        if(index < signal_len-2 && acc_z_sig[index] == acc_z_sig[index+1] && acc_z_sig[index+2] < acc_z_sig[index+1]) {
-        // This is for checking for the definition of a peak, if it evens out and the next sample is smaller, it is not defined as a peak
-        // So first there is a check to see if the function is at the end of the signal, and since it is evaluated first, incase it is
-        // at the end of the signal the function won't reach beyond the 
-        }
-        else {
-          if (min_z_peaks[0] >= acc_z_sig[index]) {
-            min_z_peaks[2] = min_z_peaks[1];
-            min_z_peaks[1] = min_z_peaks[0];
-            min_z_peaks[0] = acc_z_sig[index];
-          }
-          else if (min_z_peaks[1] >= acc_z_sig[index] ) {
-            min_z_peaks[2] = min_z_peaks[1];
-            min_z_peaks[1] = acc_z_sig[index];
-          }
-          else if (min_z_peaks[2] >= acc_z_sig[index] ) {
-            min_z_peaks[2] = acc_z_sig[index];
-          }
-        }
+    }
+    else if (value > peak && peak <= prev) {
+      if (!(check_even && stats.last[2] < prev)) {
+        insert_min_peak(stats.min_peaks, peak);
       }
     }
   }
-  // Calculate the means accelerometer
-  float mean_acc_x = tot_x_acc / signal_len;
-  float mean_acc_y = tot_y_acc / signal_len;
-  float mean_acc_z = tot_z_acc / signal_len;
-  // Calculate the means gyroscope
-  float mean_gyro_x = tot_x_gyro / signal_len;
-  float mean_gyro_y = tot_y_gyro / signal_len;
-  float mean_gyro_z = tot_z_gyro / signal_len;
-  // Run through signal again to calculate standard deviation and the
-  // standard deviation magnitude
-  for (int index = 0; index < signal_len-window_len; index++) {
-    // Calculate the mean for the window
-    for (int i = 0; i < window_len; i++) {
-      mean_std_x += acc_x_sig[index+i];
-      mean_std_y += acc_y_sig[index+i];
-      mean_std_z += acc_z_sig[index+i];
-    }
-    // Calculate the standard deviation for the window
-    for (int i = 0; i < window_len; i++) {
-      sum_std_x += sq(acc_x_sig[index+i]-(mean_std_x/window_len));
-      sum_std_y += sq(acc_y_sig[index+i]-(mean_std_y/window_len));
-      sum_std_z += sq(acc_z_sig[index+i]-(mean_std_z/window_len));
+  stats.last[2] = stats.last[1];
+  stats.last[1] = stats.last[0];
+  stats.last[0] = value;
+
+  // Update the standard deviation window with the new sample
+  if (samples < STD_WINDOW_LEN) {
+    // The window is not full yet, so only add the sample (Welford's method)
+    float delta = value - stats.window_mean;
+    stats.window_mean += delta / (samples + 1);
+    stats.window_m2 += delta * (value - stats.window_mean);
+  }
+  else {
+    // Slide the window, replacing the oldest sample with the new one
+    float oldest = stats.window[window_pos];
+    float old_mean = stats.window_mean;
+    stats.window_mean += (value - oldest) / STD_WINDOW_LEN;
+    stats.window_m2 += (value - oldest) * (value - stats.window_mean + oldest - old_mean);
+    // Rounding can make the sum go slightly below zero for a constant signal
+    if (stats.window_m2 < 0) {
+      stats.window_m2 = 0;
     }
-    // Calculate the standard deviation magnitudes and save the maximum
-    std_hoz = sqrt(sq(sqrt(sum_std_x/window_len))+sq(sqrt(sum_std_z/window_len)));
-    max_std_hoz = max(max_std_hoz, std_hoz);
-    std = sqrt(sq(sqrt(sum_std_x/window_len))+sq(sqrt(sum_std_y/window_len))+sq(sqrt(sum_std_z/window_len)));
-    max_std = max(max_std, std);
-    // Reset the windows variables
-    mean_std_x = mean_std_y = mean_std_z = 0;
-    sum_std_x = sum_std_y = sum_std_z = 0;
-    // Sum for standard deviation accelerometer
-    sum_acc_x += sq(acc_x_sig[index]-mean_acc_x);
-    sum_acc_y += sq(acc_y_sig[index]-mean_acc_y);
-    sum_acc_z += sq(acc_z_sig[index]-mean_acc_z);
-    // Sum for standard deviation gyroscope
-    sum_gyro_x += sq(gyro_x_sig[index]-mean_gyro_x);
-    sum_gyro_y += sq(gyro_y_sig[index]-mean_gyro_y);
-    sum_gyro_z += sq(gyro_z_sig[index]-mean_gyro_z);
-  }
-  // Run through the last 20 samples to get the full sum of the signal
-  for (int index = signal_len-window_len; index < signal_len; index++) {
-    // Sum for standard deviation accelerometer
-    sum_acc_x += sq(acc_x_sig[index]-mean_acc_x);
-    sum_acc_y += sq(acc_y_sig[index]-mean_acc_y);
-    sum_acc_z += sq(acc_z_sig[index]-mean_acc_z);
-    // Sum for standard deviation gyroscope
-    sum_gyro_x += sq(gyro_x_sig[index]-mean_gyro_x);
-    sum_gyro_y += sq(gyro_y_sig[index]-mean_gyro_y);
-    sum_gyro_z += sq(gyro_z_sig[index]-mean_gyro_z);
-  }
-  // Calculate the standard deviations accelerometer
-  float std_dev_acc_x = sqrt(sum_acc_x/signal_len);
-  float std_dev_acc_y = sqrt(sum_acc_y/signal_len);
-  float std_dev_acc_z = sqrt(sum_acc_z/signal_len);
-  // Calculate the standard deviations gyroscope
-  float std_dev_gyro_x = sqrt(sum_gyro_x/signal_len);
-  float std_dev_gyro_y = sqrt(sum_gyro_y/signal_len);
-  float std_dev_gyro_z = sqrt(sum_gyro_z/signal_len);
-  // Add the features to
-  calc_feat[0] = std_dev_acc_x; // Standard deviation of signal
-  calc_feat[1] = std_dev_acc_y; // Standard deviation of signal
-  calc_feat[2] = std_dev_acc_z; // Standard deviation of signal
-  calc_feat[3] = std_dev_gyro_x; // Standard deviation of signal
-  calc_feat[4] = std_dev_gyro_y; // Standard deviation of signal
-  calc_feat[5] = std_dev_gyro_z; // Standard deviation of signal
-  calc_feat[6] = mean_acc_x; // Mean of signal
-  calc_feat[7] = mean_acc_y; // Mean of signal
-  calc_feat[8] = mean_acc_z; // Mean of signal
-  calc_feat[9] = mean_gyro_x; // Mean of signal
-  calc_feat[10] = mean_gyro_y; // Mean of signal
-  calc_feat[11] = mean_gyro_z; // Mean of signal
-  calc_feat[12] = max_x_acc; // Maximum of signal
-  calc_feat[13] = max_y_acc; // Maximum of signal
-  calc_feat[14] = max_z_acc; // Maximum of signal
-  calc_feat[15] = max_x_gyro; // Maximum of signal
-  calc_feat[16] = max_y_gyro; // Maximum of signal
-  calc_feat[17] = max_z_gyro; // Maximum of signal
-  calc_feat[18] = min_x_acc; // Minimum of signal
-  calc_feat[19] = min_y_acc; // Minimum of signal
-  calc_feat[20] = min_z_acc; // Minimum of signal
-  calc_feat[21] = min_x_gyro; // Minimum of signal
-  calc_feat[22] = min_y_gyro; // Minimum of signal
-  calc_feat[23] = min_z_gyro; // Minimum of signal
-  calc_feat[24] = max_x_acc-min_x_acc; // P2P of signal
-  calc_feat[25] = max_y_acc-min_y_acc; // P2P of signal
-  calc_feat[26] = max_z_acc-min_z_acc; // P2P of signal
-  calc_feat[27] = max_x_gyro-min_x_gyro; // P2P of signal
-  calc_feat[28] = max_y_gyro-min_y_gyro; // P2P of signal
-  calc_feat[29] = max_z_gyro-min_z_gyro; // P2P of signal
-  calc_feat[30] = (max_x_peaks[0]+max_x_peaks[1]+max_x_peaks[2])/3; // Avr of peaks
-  calc_feat[31] = (min_x_peaks[0]+min_x_peaks[1]+min_x_peaks[2])/3; // Avr of peaks
-  calc_feat[32] = (max_y_peaks[0]+max_y_peaks[1]+max_y_peaks[2])/3; // Avr of peaks
-  calc_feat[33] = (min_y_peaks[0]+min_y_peaks[1]+min_y_peaks[2])/3; // Avr of peaks
-  calc_feat[34] = (max_z_peaks[0]+max_z_peaks[1]+max_z_peaks[2])/3; // Avr of peaks
-  calc_feat[35] = (min_z_peaks[0]+min_z_peaks[1]+min_z_peaks[2])/3; // Avr of peaks
+  }
+  stats.window[window_pos] = value;
+}
+
+void FeatureExtractor::add_sample(float acc_x, float acc_y, float acc_z,
+                                  float gyro_x, float gyro_y, float gyro_z) {
+  update_signal(acc[0], acc_x);
+  update_signal(acc[1], acc_y);
+  update_signal(acc[2], acc_z);
+  update_signal(gyro[0], gyro_x);
+  update_signal(gyro[1], gyro_y);
+  update_signal(gyro[2], gyro_z);
+  update_accel(accel[0], acc_x);
+  update_accel(accel[1], acc_y);
+  update_accel(accel[2], acc_z);
+
+  // Calculate acceleration magnitude
+  float accel_mag = sqrt(sq(acc_x)+sq(acc_y)+sq(acc_z));
+  if (samples == 0) {
+    max_accel_mag = min_accel_mag = accel_mag;
+  }
+  else {
+    max_accel_mag = max(accel_mag, max_accel_mag);
+    min_accel_mag = min(accel_mag, min_accel_mag);
+  }
+
+  window_pos++;
+  if (window_pos >= STD_WINDOW_LEN) {
+    window_pos = 0;
+  }
+  samples++;
+
+  // The window starting with the first sample of the signal is not used for the
+  // features, so the standard deviation magnitudes are saved from the next window
+  if (samples > STD_WINDOW_LEN) {
+    float var_x = accel[0].window_m2 / STD_WINDOW_LEN;
+    float var_y = accel[1].window_m2 / STD_WINDOW_LEN;
+    float var_z = accel[2].window_m2 / STD_WINDOW_LEN;
+    max_std_hoz = max(max_std_hoz, sqrt(var_x + var_z));
+    max_std = max(max_std, sqrt(var_x + var_y + var_z));
+  }
+}
+
+void FeatureExtractor::calc_features(float calc_feat[]) const {
+  calc_feat[0] = sqrt(acc[0].welford_m2/samples); // Standard deviation of signal
+  calc_feat[1] = sqrt(acc[1].welford_m2/samples); // Standard deviation of signal
+  calc_feat[2] = sqrt(acc[2].welford_m2/samples); // Standard deviation of signal
+  calc_feat[3] = sqrt(gyro[0].welford_m2/samples); // Standard deviation of signal
+  calc_feat[4] = sqrt(gyro[1].welford_m2/samples); // Standard deviation of signal
+  calc_feat[5] = sqrt(gyro[2].welford_m2/samples); // Standard deviation of signal
+  calc_feat[6] = acc[0].sum/samples; // Mean of signal
+  calc_feat[7] = acc[1].sum/samples; // Mean of signal
+  calc_feat[8] = acc[2].sum/samples; // Mean of signal
+  calc_feat[9] = gyro[0].sum/samples; // Mean of signal
+  calc_feat[10] = gyro[1].sum/samples; // Mean of signal
+  calc_feat[11] = gyro[2].sum/samples; // Mean of signal
+  calc_feat[12] = acc[0].max; // Maximum of signal
+  calc_feat[13] = acc[1].max; // Maximum of signal
+  calc_feat[14] = acc[2].max; // Maximum of signal
+  calc_feat[15] = gyro[0].max; // Maximum of signal
+  calc_feat[16] = gyro[1].max; // Maximum of signal
+  calc_feat[17] = gyro[2].max; // Maximum of signal
+  calc_feat[18] = acc[0].min; // Minimum of signal
+  calc_feat[19] = acc[1].min; // Minimum of signal
+  calc_feat[20] = acc[2].min; // Minimum of signal
+  calc_feat[21] = gyro[0].min; // Minimum of signal
+  calc_feat[22] = gyro[1].min; // Minimum of signal
+  calc_feat[23] = gyro[2].min; // Minimum of signal
+  calc_feat[24] = acc[0].max-acc[0].min; // P2P of signal
+  calc_feat[25] = acc[1].max-acc[1].min; // P2P of signal
+  calc_feat[26] = acc[2].max-acc[2].min; // P2P of signal
+  calc_feat[27] = gyro[0].max-gyro[0].min; // P2P of signal
+  calc_feat[28] = gyro[1].max-gyro[1].min; // P2P of signal
+  calc_feat[29] = gyro[2].max-gyro[2].min; // P2P of signal
+  calc_feat[30] = sum_max_peaks(accel[0].max_peaks, accel[0].last[0], 0.0f)/3; // Avr of peaks
+  calc_feat[31] = sum_min_peaks(accel[0].min_peaks, accel[0].last[0], 0.0f)/3; // Avr of peaks
+  calc_feat[32] = sum_max_peaks(accel[1].max_peaks, accel[1].last[0], 0.0f)/3; // Avr of peaks
+  calc_feat[33] = sum_min_peaks(accel[1].min_peaks, accel[1].last[0], accel[1].last[0])/3; // Avr of peaks
+  calc_feat[34] = sum_max_peaks(accel[2].max_peaks, accel[2].last[0], 0.0f)/3; // Avr of peaks
+  calc_feat[35] = sum_min_peaks(accel[2].min_peaks, accel[2].last[0], 0.0f)/3; // Avr of peaks
   calc_feat[36] = max_accel_mag; // Max acceleration magnitude
   calc_feat[37] = min_accel_mag; // Min acceleration magnitude
   calc_feat[38] = max_std_hoz; // Std horizon
   calc_feat[39] = max_std; // std dev magnitude
-  calc_feat[40] = max_slope_x_acc;
-  calc_feat[41] = max_slope_y_acc;
-  calc_feat[42] = max_slope_z_acc;
-  calc_feat[43] = max_slope_x_gyro;
-  calc_feat[44] = max_slope_y_gyro;
-  calc_feat[45] = max_slope_z_gyro;
+  calc_feat[40] = acc[0].max_slope;
+  calc_feat[41] = acc[1].max_slope;
+  calc_feat[42] = acc[2].max_slope;
+  calc_feat[43] = gyro[0].max_slope;
+  calc_feat[44] = gyro[1].max_slope;
+  calc_feat[45] = gyro[2].max_slope;
+}
+
+int FeatureExtractor::sample_count() const {
+  return samples;
+}
+
+RawFeatureExtractor::RawFeatureExtractor() {
+  reset();
+}
+
+void RawFeatureExtractor::reset() {
+  for (int axis = 0; axis < 3; axis++) {
+    for (int i = 0; i < 3; i++) {
+      // Start with values outside the 16-bit range, so any peak will replace them
+      accel[axis].max_peaks[i] = INT32_MIN;
+      accel[axis].min_peaks[i] = INT32_MAX;
+    }
+    accel[axis].window_sum = 0;
+    accel[axis].window_sum_sq = 0;
+  }
+  max_var = max_var_hoz = 0;
+  window_pos = 0;
+  samples = 0;
+}
+
+void RawFeatureExtractor::update_signal(SignalStats& stats, int16_t value) {
+  if (samples == 0) {
+    // Instanciate the variables with the first signal value
+    stats.max = stats.min = value;
+    stats.max_slope = 0;
+    stats.sum = 0;
+    stats.sum_sq = 0;
+  }
+  else {
+    stats.max = max(value, stats.max);
+    stats.min = min(value, stats.min);
+    int32_t slope = static_cast<int32_t>(stats.last) - value;
+    stats.max_slope = max(slope < 0 ? -slope : slope, stats.max_slope);
+  }
+  stats.sum += value;
+  stats.sum_sq += static_cast<int32_t>(value) * value;
+  stats.last = value;
+}
+
+void RawFeatureExtractor::update_accel(AccelStats& stats, int16_t value) {
+  // Same peak detection as FeatureExtractor::update_accel()
+  if (samples >= 2) {
+    int32_t peak = stats.last[0];
+    int32_t prev = stats.last[1];
+    bool check_even = samples >= 3 && peak == prev;
+    if (value < peak && peak >= prev) {
+      if (!(check_even && stats.last[2] > prev)) {
+        insert_max_peak(stats.max_peaks, peak);
+      }
+    }
+    else if (value > peak && peak <= prev) {
+      if (!(check_even && stats.last[2] < prev)) {
+        insert_min_peak(stats.min_peaks, peak);
+      }
+    }
+  }
+  stats.last[2] = stats.last[1];
+  stats.last[1] = stats.last[0];
+  stats.last[0] = value;
+
+  // Slide the standard deviation window, the sums are exact so nothing drifts
+  if (samples >= STD_WINDOW_LEN) {
+    int32_t oldest = stats.window[window_pos];
+    stats.window_sum -= oldest;
+    stats.window_sum_sq -= oldest * oldest;
+  }
+  stats.window_sum += value;
+  stats.window_sum_sq += static_cast<int32_t>(value) * value;
+  stats.window[window_pos] = value;
+}
+
+void RawFeatureExtractor::add_sample(int16_t acc_x, int16_t acc_y, int16_t acc_z,
+                                     int16_t gyro_x, int16_t gyro_y, int16_t gyro_z) {
+  update_signal(acc[0], acc_x);
+  update_signal(acc[1], acc_y);
+  update_signal(acc[2], acc_z);
+  update_signal(gyro[0], gyro_x);
+  update_signal(gyro[1], gyro_y);
+  update_signal(gyro[2], gyro_z);
+  update_accel(accel[0], acc_x);
+  update_accel(accel[1], acc_y);
+  update_accel(accel[2], acc_z);
+
+  // The magnitude is compared squared, so the square root is only taken for the features
+  uint32_t accel_mag_sq = static_cast<uint32_t>(static_cast<int32_t>(acc_x) * acc_x) +
+                          static_cast<uint32_t>(static_cast<int32_t>(acc_y) * acc_y) +
+                          static_cast<uint32_t>(static_cast<int32_t>(acc_z) * acc_z);
+  if (samples == 0) {
+    max_accel_mag_sq = min_accel_mag_sq = accel_mag_sq;
+  }
+  else {
+    max_accel_mag_sq = max(accel_mag_sq, max_accel_mag_sq);
+    min_accel_mag_sq = min(accel_mag_sq, min_accel_mag_sq);
+  }
+
+  window_pos++;
+  if (window_pos >= STD_WINDOW_LEN) {
+    window_pos = 0;
+  }
+  samples++;
+
+  // Like in FeatureExtractor, the window starting with the first sample isn't used. The variances
+  // are kept as STD_WINDOW_LEN squared times the variance, which is exact in integers.
+  if (samples > STD_WINDOW_LEN) {
+    int64_t var[3];
+    for (int axis = 0; axis < 3; axis++) {
+      int64_t sum = accel[axis].window_sum;
+      var[axis] = STD_WINDOW_LEN * accel[axis].window_sum_sq - sum * sum;
+    }
+    max_var_hoz = max(max_var_hoz, var[0] + var[2]);
+    max_var = max(max_var, var[0] + var[1] + var[2]);
+  }
+}
+
+// Standard deviation of a signal scaled to physical units
+static float raw_std(int32_t sum, int64_t sum_sq, int samples, float resolution) {
+  int64_t scaled_var = samples * sum_sq - static_cast<int64_t>(sum) * sum;
+  return sqrt(static_cast<float>(scaled_var)) / samples * resolution;
+}
+
+void RawFeatureExtractor::calc_features(float calc_feat[], float accel_resolution, float gyro_resolution) const {
+  const float res[6] = {accel_resolution, accel_resolution, accel_resolution,
+                        gyro_resolution, gyro_resolution, gyro_resolution};
+  const SignalStats* stats[6] = {&acc[0], &acc[1], &acc[2], &gyro[0], &gyro[1], &gyro[2]};
+  for (int s = 0; s < 6; s++) {
+    calc_feat[s] = raw_std(stats[s]->sum, stats[s]->sum_sq, samples, res[s]); // Standard deviation of signal
+    calc_feat[6 + s] = static_cast<float>(stats[s]->sum) / samples * res[s]; // Mean of signal
+    calc_feat[12 + s] = stats[s]->max * res[s]; // Maximum of signal
+    calc_feat[18 + s] = stats[s]->min * res[s]; // Minimum of signal
+    calc_feat[24 + s] = (static_cast<int32_t>(stats[s]->max) - stats[s]->min) * res[s]; // P2P of signal
+    calc_feat[40 + s] = stats[s]->max_slope * res[s]; // Max slope of signal
+  }
+  const float peak_res = accel_resolution / 3;
+  calc_feat[30] = sum_max_peaks<int32_t>(accel[0].max_peaks, accel[0].last[0], 0) * peak_res; // Avr of peaks
+  calc_feat[31] = sum_min_peaks<int32_t>(accel[0].min_peaks, accel[0].last[0], 0) * peak_res; // Avr of peaks
+  calc_feat[32] = sum_max_peaks<int32_t>(accel[1].max_peaks, accel[1].last[0], 0) * peak_res; // Avr of peaks
+  calc_feat[33] = sum_min_peaks<int32_t>(accel[1].min_peaks, accel[1].last[0], accel[1].last[0]) * peak_res; // Avr of peaks
+  calc_feat[34] = sum_max_peaks<int32_t>(accel[2].max_peaks, accel[2].last[0], 0) * peak_res; // Avr of peaks
+  calc_feat[35] = sum_min_peaks<int32_t>(accel[2].min_peaks, accel[2].last[0], 0) * peak_res; // Avr of peaks
+  calc_feat[36] = sqrt(static_cast<float>(max_accel_mag_sq)) * accel_resolution; // Max acceleration magnitude
+  calc_feat[37] = sqrt(static_cast<float>(min_accel_mag_sq)) * accel_resolution; // Min acceleration magnitude
+  calc_feat[38] = sqrt(static_cast<float>(max_var_hoz)) / STD_WINDOW_LEN * accel_resolution; // Std horizon
+  calc_feat[39] = sqrt(static_cast<float>(max_var)) / STD_WINDOW_LEN * accel_resolution; // std dev magnitude
+}
+
+int RawFeatureExtractor::sample_count() const {
+  return samples;
+}
+
+// Shared between the plain arrays and the ring buffers. Signal only needs to support []
+// where index 0 is the newest value of the signal, so it is added from the end.
+template <typename Signal>
+static void extract_features(float calc_feat[], const Signal& acc_x_sig, const Signal& acc_y_sig,
+                             const Signal& acc_z_sig, const Signal& gyro_x_sig, const Signal& gyro_y_sig,
+                             const Signal& gyro_z_sig, int signal_len) {
+  FeatureExtractor extractor;
+  for (int index = signal_len-1; index >= 0; index--) {
+    extractor.add_sample(acc_x_sig[index], acc_y_sig[index], acc_z_sig[index],
+                         gyro_x_sig[index], gyro_y_sig[index], gyro_z_sig[index]);
+  }
+  extractor.calc_features(calc_feat);
+}
+
+void feature_calc(float calc_feat[], float acc_x_sig[], float acc_y_sig[],
+                  float acc_z_sig[], float gyro_x_sig[], float gyro_y_sig[],
+                  float gyro_z_sig[], int signal_len) {
+  extract_features(calc_feat, acc_x_sig, acc_y_sig, acc_z_sig,
+                   gyro_x_sig, gyro_y_sig, gyro_z_sig, signal_len);
+}
+
+void feature_calc(float calc_feat[], const SignalBuffer& acc_x_sig, const SignalBuffer& acc_y_sig,
+                  const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig, const SignalBuffer& gyro_y_sig,
+                  const SignalBuffer& gyro_z_sig) {
+  extract_features(calc_feat, acc_x_sig, acc_y_sig, acc_z_sig,
+                   gyro_x_sig, gyro_y_sig, gyro_z_sig, acc_x_sig.capacity());
+}
+
+
+// Same as extract_features(), but for the raw signals
+template <typename Signal>
+static void extract_raw_features(float calc_feat[], const Signal& acc_x_sig, const Signal& acc_y_sig,
+                                 const Signal& acc_z_sig, const Signal& gyro_x_sig, const Signal& gyro_y_sig,
+                                 const Signal& gyro_z_sig, int signal_len, float accel_resolution, float gyro_resolution) {
+  RawFeatureExtractor extractor;
+  for (int index = signal_len-1; index >= 0; index--) {
+    extractor.add_sample(acc_x_sig[index], acc_y_sig[index], acc_z_sig[index],
+                         gyro_x_sig[index], gyro_y_sig[index], gyro_z_sig[index]);
+  }
+  extractor.calc_features(calc_feat, accel_resolution, gyro_resolution);
+}
+
+void feature_calc(float calc_feat[], const int16_t acc_x_sig[], const int16_t acc_y_sig[],
+                  const int16_t acc_z_sig[], const int16_t gyro_x_sig[], const int16_t gyro_y_sig[],
+                  const int16_t gyro_z_sig[], int signal_len, float accel_resolution, float gyro_resolution) {
+  extract_raw_features(calc_feat, acc_x_sig, acc_y_sig, acc_z_sig,
+                       gyro_x_sig, gyro_y_sig, gyro_z_sig, signal_len, accel_resolution, gyro_resolution);
+}
+
+void feature_calc(float calc_feat[], const RawSignalBuffer& acc_x_sig, const RawSignalBuffer& acc_y_sig,
+                  const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig, const RawSignalBuffer& gyro_y_sig,
+                  const RawSignalBuffer& gyro_z_sig, float accel_resolution, float gyro_resolution) {
+  extract_raw_features(calc_feat, acc_x_sig, acc_y_sig, acc_z_sig,
+                       gyro_x_sig, gyro_y_sig, gyro_z_sig, acc_x_sig.capacity(), accel_resolution, gyro_resolution);
 }
@@ -0,0 +1,158 @@
+/**
+  *
+  *
+  * @file:    lopy_link.cpp
+  * @date:    17-10-2026 08:08:06
+  *
+  * @brief    Framed protocol between the Nano and the LoPy on Serial1
+  *
+  *
+  *
+  *
+**/
+
+#include "lopy_link.h"
+
+#include <string.h>
+
+// The fields are copied byte by byte, because they aren't aligned
+template <typename T>
+static void put(uint8_t* data, int offset, T value) {
+  memcpy(data + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static T get(const uint8_t* data, int offset) {
+  T value;
+  memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+uint16_t link_crc16(const uint8_t* data, size_t length, uint16_t crc) {
+  for (size_t i = 0; i < length; i++) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+int link_encode(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length, uint8_t* frame) {
+  if (length > LINK_MAX_PAYLOAD) {
+    return 0;
+  }
+  frame[0] = LINK_SYNC;
+  frame[1] = type;
+  frame[2] = seq;
+  frame[3] = length;
+  if (length > 0) {
+    memcpy(frame + LINK_HEADER_SIZE, payload, length);
+  }
+  put<uint16_t>(frame, LINK_HEADER_SIZE + length, link_crc16(frame + 1, LINK_HEADER_SIZE - 1 + length));
+  return LINK_HEADER_SIZE + length + LINK_CRC_SIZE;
+}
+
+uint8_t link_encode_alarm(const AlarmMessage& alarm, uint8_t* payload) {
+  uint8_t gps_length = alarm.gps_length <= LINK_GPS_MAX_SIZE ? alarm.gps_length : 0;
+  payload[0] = alarm.fall_number;
+  payload[1] = alarm.confidence;
+  put<uint32_t>(payload, 2, alarm.features_digest);
+  memcpy(payload + LINK_ALARM_HEADER_SIZE, alarm.gps, gps_length);
+  return LINK_ALARM_HEADER_SIZE + gps_length;
+}
+
+bool link_decode_alarm(const LinkFrame& frame, AlarmMessage* alarm) {
+  if (frame.type != LINK_ALARM || frame.length < LINK_ALARM_HEADER_SIZE ||
+      frame.length > LINK_ALARM_HEADER_SIZE + LINK_GPS_MAX_SIZE) {
+    return false;
+  }
+  alarm->fall_number = frame.payload[0];
+  alarm->confidence = frame.payload[1];
+  alarm->features_digest = get<uint32_t>(frame.payload, 2);
+  alarm->gps_length = frame.length - LINK_ALARM_HEADER_SIZE;
+  memcpy(alarm->gps, frame.payload + LINK_ALARM_HEADER_SIZE, alarm->gps_length);
+  return true;
+}
+
+uint32_t link_features_digest(const float* features, int count) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(features);
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < count * sizeof(float); i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+void LinkDecoder::drop(int bytes) {
+  count -= bytes;
+  memmove(buffer, buffer + bytes, count);
+}
+
+bool LinkDecoder::push(uint8_t byte) {
+  if (count == 0 && byte != LINK_SYNC) {
+    return false;
+  }
+  buffer[count++] = byte;
+  // After a dropped frame the buffered bytes are searched for the next frame
+  while (count > 0) {
+    if (buffer[0] != LINK_SYNC) {
+      drop(1);
+      continue;
+    }
+    if (count < LINK_HEADER_SIZE) {
+      return false;
+    }
+    int length = buffer[3];
+    if (length > LINK_MAX_PAYLOAD) {
+      drop(1);
+      continue;
+    }
+    int size = LINK_HEADER_SIZE + length + LINK_CRC_SIZE;
+    if (count < size) {
+      return false;
+    }
+    if (get<uint16_t>(buffer, LINK_HEADER_SIZE + length) != link_crc16(buffer + 1, LINK_HEADER_SIZE - 1 + length)) {
+      crc_errors++;
+      drop(1);
+      continue;
+    }
+    decoded.type = buffer[1];
+    decoded.seq = buffer[2];
+    decoded.length = length;
+    memcpy(decoded.payload, buffer + LINK_HEADER_SIZE, length);
+    drop(size);
+    frames++;
+    return true;
+  }
+  return false;
+}
+
+uint8_t LopyLink::send(uint8_t type, const uint8_t* payload, uint8_t length) {
+  uint8_t seq = next_seq++;
+  resend(type, seq, payload, length);
+  return seq;
+}
+
+void LopyLink::resend(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length) {
+  uint8_t frame[LINK_MAX_FRAME];
+  int size = link_encode(type, seq, payload, length, frame);
+  uart.write(frame, size);
+}
+
+bool LopyLink::receive(LinkFrame* frame) {
+  for (int i = 0; i < LINK_POLL_MAX_BYTES && uart.available() > 0; i++) {
+    if (decode.push(static_cast<uint8_t>(uart.read()))) {
+      *frame = decode.frame();
+      return true;
+    }
+  }
+  return false;
+}
+
+void LopyLink::flush() {
+  while (uart.available() > 0) {
+    uart.read();
+  }
+  decode.reset();
+}
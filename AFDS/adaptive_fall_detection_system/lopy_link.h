@@ -0,0 +1,272 @@
+/**
+  *
+  *
+  * @file:    lopy_link.h
+  * @date:    17-10-2026 08:08:06
+  *
+  * @brief    Framed protocol between the Nano and the LoPy on Serial1
+  *
+  *   Every message is a frame with a sync byte, its type, a sequence number,
+  *   the length of the payload, the payload and a CRC16 (CRC-16/CCITT-FALSE
+  *   of the type, sequence number, length and payload). A frame with a wrong
+  *   CRC is dropped, and the decoder looks for the next sync byte from the byte
+  *   after the dropped sync byte, so a broken frame only loses itself.
+  *
+  *   Frame (all values little-endian):
+  *   | Offset | Type       | Content                                       |
+  *   |--------|------------|-----------------------------------------------|
+  *   | 0      | uint8      | LINK_SYNC                                     |
+  *   | 1      | uint8      | Type (LinkType)                               |
+  *   | 2      | uint8      | Sequence number                               |
+  *   | 3      | uint8      | Payload length, at most LINK_MAX_PAYLOAD      |
+  *   | 4      | uint8[]    | Payload                                       |
+  *   | 4 + n  | uint16     | CRC16                                         |
+  *
+  *   Messages:
+  *   - LINK_ALARM, Nano to LoPy: a fall, payload in AlarmMessage. The frame is
+  *     sent again with the same sequence number until it is acknowledged, as
+  *     the LoPy may still be starting after it has been woken up.
+  *   - LINK_ACK: acknowledges the frame with the same sequence number, no
+  *     payload. The LoPy acknowledges an alarm when it has sent it with LoRa.
+  *   - LINK_CANCEL, LoPy to Nano: the stop button has been pressed, no payload.
+  *   - LINK_HEARTBEAT: the sender is alive, no payload.
+  *   CANCEL and HEARTBEAT are acknowledged by the Nano.
+  *
+  *   Alarm payload:
+  *   | Offset | Type       | Content                                       |
+  *   |--------|------------|-----------------------------------------------|
+  *   | 0      | uint8      | Fall number, of the FALL##.afl log            |
+  *   | 1      | uint8      | Fall probability of the model * 255           |
+  *   | 2      | uint32     | Digest of the features (link_features_digest) |
+  *   | 6      | uint8[]    | GPS packet of the GPS driver, 0 bytes without |
+  *   |        |            | a fix                                         |
+  *
+**/
+
+#ifndef LOPY_LINK_H_
+#define LOPY_LINK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino.h>
+
+const uint8_t LINK_SYNC = 0xA5;             /**<  First byte of every frame   */
+const int LINK_HEADER_SIZE = 4;             /**<  Sync, type, sequence number and length   */
+const int LINK_CRC_SIZE = 2;                /**<  Size of the CRC16 after the payload   */
+const int LINK_MAX_PAYLOAD = 32;            /**<  Largest payload of a frame   */
+const int LINK_MAX_FRAME = LINK_HEADER_SIZE + LINK_MAX_PAYLOAD + LINK_CRC_SIZE;  /**<  Largest frame in bytes   */
+const int LINK_POLL_MAX_BYTES = 64;         /**<  Bytes read by one poll at most, so the loop is never held up   */
+const int LINK_GPS_MAX_SIZE = 16;           /**<  Largest GPS packet (GPS_PACKET_MAX_SIZE of the GPS driver)   */
+const int LINK_ALARM_HEADER_SIZE = 6;       /**<  Alarm payload before the GPS packet   */
+
+// Types of the frames
+enum LinkType {
+  LINK_ALARM = 1,                     /**<  A fall, sent from the Nano to the LoPy   */
+  LINK_ACK = 2,                       /**<  Acknowledges the frame with the same sequence number   */
+  LINK_CANCEL = 3,                    /**<  The stop button of the LoPy has been pressed   */
+  LINK_HEARTBEAT = 4                  /**<  The sender is alive   */
+};
+
+/**
+* @brief  LinkFrame: A received frame
+*
+**/
+struct LinkFrame {
+  uint8_t type;                       /**<  Type of the frame (LinkType)   */
+  uint8_t seq;                        /**<  Sequence number   */
+  uint8_t length;                     /**<  Length of the payload   */
+  uint8_t payload[LINK_MAX_PAYLOAD];  /**<  The payload   */
+};
+
+/**
+* @brief  AlarmMessage: The payload of an alarm
+*
+**/
+struct AlarmMessage {
+  uint8_t fall_number;                /**<  Number of the fall, the same as in the name of its fall log   */
+  uint8_t confidence;                 /**<  Fall probability of the model, 255 is 1.0   */
+  uint32_t features_digest;           /**<  Digest of the features the model classified   */
+  uint8_t gps_length;                 /**<  Length of the GPS packet, 0 without a fix   */
+  uint8_t gps[LINK_GPS_MAX_SIZE];     /**<  GPS packet of the last known fix   */
+};
+
+/**
+* @brief  link_crc16(): CRC-16/CCITT-FALSE of the bytes
+*
+* @param const uint8_t* data: The bytes.
+* @param size_t length: Amount of bytes.
+* @param uint16_t crc: The CRC of the bytes before, or 0xFFFF.
+* @return uint16_t: The CRC
+*
+**/
+uint16_t link_crc16(const uint8_t* data, size_t length, uint16_t crc = 0xFFFF);
+
+/**
+* @brief  link_encode(): Frame a payload
+*
+* @param uint8_t type: Type of the frame (LinkType).
+* @param uint8_t seq: Sequence number.
+* @param const uint8_t* payload: The payload, or nullptr when length is 0.
+* @param uint8_t length: Length of the payload.
+* @param uint8_t* frame: Buffer of at least LINK_MAX_FRAME bytes.
+* @return int: Size of the frame, 0 if the payload is larger than LINK_MAX_PAYLOAD
+*
+**/
+int link_encode(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length, uint8_t* frame);
+
+/**
+* @brief  link_encode_alarm(): Write the payload of an alarm
+*
+* @param const AlarmMessage& alarm: The alarm.
+* @param uint8_t* payload: Buffer of at least LINK_MAX_PAYLOAD bytes.
+* @return uint8_t: Length of the payload
+*
+**/
+uint8_t link_encode_alarm(const AlarmMessage& alarm, uint8_t* payload);
+
+/**
+* @brief  link_decode_alarm(): Read the payload of an alarm
+*
+* @param const LinkFrame& frame: A LINK_ALARM frame.
+* @param AlarmMessage* alarm: The alarm.
+* @return bool: false if the frame isn't an alarm, or its payload is too short or too long
+*
+**/
+bool link_decode_alarm(const LinkFrame& frame, AlarmMessage* alarm);
+
+/**
+* @brief  link_features_digest(): FNV-1a hash of the features
+*
+*   Identifies the features the model classified, so the alarm can be matched
+*   with the features calculated from its fall log.
+*
+* @param const float* features: The features.
+* @param int count: Amount of features.
+* @return uint32_t: The digest
+*
+**/
+uint32_t link_features_digest(const float* features, int count);
+
+/**
+* @brief  LinkDecoder: Finds the frames in the received bytes
+*
+**/
+class LinkDecoder {
+  public:
+    unsigned long frames = 0;         /**<  Frames decoded   */
+    unsigned long crc_errors = 0;     /**<  Frames dropped because of a wrong CRC   */
+
+    /**
+    * @brief  push(): Add a received byte
+    *
+    * @param uint8_t byte: The byte.
+    * @return bool: true when a frame has been decoded, it is in frame()
+    *
+    **/
+    bool push(uint8_t byte);
+
+    /**
+    * @brief  frame(): The last decoded frame
+    *
+    * @param none
+    * @return const LinkFrame&: The frame
+    *
+    **/
+    const LinkFrame& frame() const { return decoded; };
+
+    /**
+    * @brief  reset(): Forget the bytes of a partly received frame
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset() { count = 0; };
+
+  private:
+    uint8_t buffer[LINK_MAX_FRAME];   /**<  Bytes from the sync byte of the frame being received   */
+    int count = 0;                    /**<  Bytes in the buffer   */
+    LinkFrame decoded;                /**<  The last decoded frame   */
+
+    void drop(int bytes);
+};
+
+/**
+* @brief  LopyLink: One end of the link on a UART
+*
+**/
+class LopyLink {
+  public:
+    explicit LopyLink(HardwareSerial& serial) : uart(serial) {};
+
+    /**
+    * @brief  begin(): Start the UART
+    *
+    * @param unsigned long baud: The baud rate, LINK_BAUD on both ends.
+    * @return void:
+    *
+    **/
+    void begin(unsigned long baud) { uart.begin(baud); };
+
+    /**
+    * @brief  send(): Send a frame with a new sequence number
+    *
+    * @param uint8_t type: Type of the frame (LinkType).
+    * @param const uint8_t* payload: The payload, or nullptr when length is 0.
+    * @param uint8_t length: Length of the payload.
+    * @return uint8_t: The sequence number of the frame
+    *
+    **/
+    uint8_t send(uint8_t type, const uint8_t* payload = nullptr, uint8_t length = 0);
+
+    /**
+    * @brief  resend(): Send a frame with the sequence number of an earlier frame
+    *
+    * @param uint8_t type: Type of the frame (LinkType).
+    * @param uint8_t seq: The sequence number.
+    * @param const uint8_t* payload: The payload, or nullptr when length is 0.
+    * @param uint8_t length: Length of the payload.
+    * @return void:
+    *
+    **/
+    void resend(uint8_t type, uint8_t seq, const uint8_t* payload = nullptr, uint8_t length = 0);
+
+    /**
+    * @brief  send_ack(): Acknowledge a received frame
+    *
+    * @param uint8_t seq: The sequence number of the frame.
+    * @return void:
+    *
+    **/
+    void send_ack(uint8_t seq) { resend(LINK_ACK, seq); };
+
+    /**
+    * @brief  receive(): Read the bytes waiting on the UART, until a frame has been received
+    *
+    *   At most LINK_POLL_MAX_BYTES bytes are read, the rest are read by the next call.
+    *
+    * @param LinkFrame* frame: The received frame.
+    * @return bool: true when a frame has been received
+    *
+    **/
+    bool receive(LinkFrame* frame);
+
+    /**
+    * @brief  flush(): Drop the received bytes, and the partly received frame
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void flush();
+
+    const LinkDecoder& decoder() const { return decode; };
+
+  private:
+    HardwareSerial& uart;             /**<  The UART of the link   */
+    LinkDecoder decode;               /**<  Decoder of the received bytes   */
+    uint8_t next_seq = 0;             /**<  Sequence number of the next new frame   */
+};
+
+#endif  // LOPY_LINK_H_
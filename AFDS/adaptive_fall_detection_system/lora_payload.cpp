@@ -0,0 +1,110 @@
+/**
+  *
+  *
+  * @file:    lora_payload.cpp
+  * @date:    17-10-2026 08:22:07
+  *
+  * @brief    Bit-packed payload of the LoRa uplink of a fall alarm
+  *
+  *
+  *
+  *
+**/
+
+#include "lora_payload.h"
+
+#include <math.h>
+#include <string.h>
+
+static const uint32_t LATITUDE_STEPS = LORA_NO_POSITION - 1;         // Codes 0 to 2^22 - 2 are positions
+static const uint32_t LONGITUDE_CODES = 1UL << LORA_LONGITUDE_BITS;  // -180 and 180 degrees are the same code
+static const uint32_t BATTERY_STEPS = (1UL << LORA_BATTERY_BITS) - 1;
+static const uint32_t CONFIDENCE_STEPS = (1UL << LORA_CONFIDENCE_BITS) - 1;
+static const float CONFIDENCE_MIN = 0.5f;
+
+// The bits are written and read most significant bit first
+static void put_bits(uint8_t* payload, int* offset, uint32_t value, int bits) {
+  for (int bit = bits - 1; bit >= 0; bit--) {
+    if ((value >> bit) & 1) {
+      payload[*offset / 8] |= static_cast<uint8_t>(0x80 >> (*offset % 8));
+    }
+    (*offset)++;
+  }
+}
+
+static uint32_t get_bits(const uint8_t* payload, int* offset, int bits) {
+  uint32_t value = 0;
+  for (int bit = 0; bit < bits; bit++) {
+    value = (value << 1) | ((payload[*offset / 8] >> (7 - *offset % 8)) & 1);
+    (*offset)++;
+  }
+  return value;
+}
+
+// Rounds a value in the range 0 to 1 to a code from 0 to steps
+static uint32_t quantize(double value, uint32_t steps) {
+  if (!(value > 0.0)) {
+    return 0;
+  }
+  if (value >= 1.0) {
+    return steps;
+  }
+  return static_cast<uint32_t>(lround(value * steps));
+}
+
+int lora_encode(const LoraUplink& uplink, uint8_t* payload) {
+  memset(payload, 0, LORA_PAYLOAD_SIZE);
+  uint32_t latitude = LORA_NO_POSITION;
+  uint32_t longitude = 0;
+  if (uplink.has_position) {
+    latitude = quantize((uplink.latitude + 90.0) / 180.0, LATITUDE_STEPS);
+    double turns = (uplink.longitude + 180.0) / 360.0;
+    turns -= floor(turns);
+    longitude = static_cast<uint32_t>(lround(turns * LONGITUDE_CODES)) % LONGITUDE_CODES;
+  }
+  int offset = 0;
+  put_bits(payload, &offset, latitude, LORA_LATITUDE_BITS);
+  put_bits(payload, &offset, longitude, LORA_LONGITUDE_BITS);
+  put_bits(payload, &offset, quantize(static_cast<double>(uplink.battery) / LORA_BATTERY_MAX, BATTERY_STEPS),
+           LORA_BATTERY_BITS);
+  put_bits(payload, &offset, quantize((uplink.confidence - CONFIDENCE_MIN) / (1.0f - CONFIDENCE_MIN), CONFIDENCE_STEPS),
+           LORA_CONFIDENCE_BITS);
+  put_bits(payload, &offset, uplink.counter, LORA_COUNTER_BITS);
+  return LORA_PAYLOAD_SIZE;
+}
+
+bool lora_decode(const uint8_t* payload, size_t length, LoraUplink* uplink) {
+  if (length != LORA_PAYLOAD_SIZE) {
+    return false;
+  }
+  int offset = 0;
+  uint32_t latitude = get_bits(payload, &offset, LORA_LATITUDE_BITS);
+  uint32_t longitude = get_bits(payload, &offset, LORA_LONGITUDE_BITS);
+  uplink->has_position = latitude != LORA_NO_POSITION;
+  uplink->latitude = uplink->has_position ? latitude * 180.0 / LATITUDE_STEPS - 90.0 : 0.0;
+  uplink->longitude = uplink->has_position ? longitude * 360.0 / LONGITUDE_CODES - 180.0 : 0.0;
+  uint32_t battery = get_bits(payload, &offset, LORA_BATTERY_BITS);
+  uplink->battery = static_cast<uint16_t>((battery * LORA_BATTERY_MAX + BATTERY_STEPS / 2) / BATTERY_STEPS);
+  uint32_t confidence = get_bits(payload, &offset, LORA_CONFIDENCE_BITS);
+  uplink->confidence = CONFIDENCE_MIN + (1.0f - CONFIDENCE_MIN) * confidence / CONFIDENCE_STEPS;
+  uplink->counter = static_cast<uint8_t>(get_bits(payload, &offset, LORA_COUNTER_BITS));
+  return true;
+}
+
+bool lora_decode_legacy(const uint8_t* payload, size_t length, LoraUplink* uplink) {
+  if (length != LORA_LEGACY_PAYLOAD_SIZE) {
+    return false;
+  }
+  // struct.pack("fff") on the LoPy, little endian like the Nano and the host
+  float values[3];
+  memcpy(values, payload, sizeof(values));
+  uplink->has_position = true;
+  uplink->latitude = values[0];
+  uplink->longitude = values[1];
+  float battery = values[2];
+  uplink->battery = battery > 0.0f ? static_cast<uint16_t>(battery < LORA_BATTERY_MAX ? battery + 0.5f : LORA_BATTERY_MAX)
+                                   : 0;
+  uplink->confidence = 0.0f;
+  uplink->counter = 0;
+  return true;
+}
@@ -0,0 +1,100 @@
+/**
+  *
+  *
+  * @file:    lora_payload.h
+  * @date:    17-10-2026 08:22:07
+  *
+  * @brief    Bit-packed payload of the LoRa uplink of a fall alarm
+  *
+  *   The LoPy sends at data rate 0 (SF12, 125 kHz), where the airtime grows in
+  *   steps of 5 symbols (about 164 ms) for every 5 bytes. With the 13 bytes of
+  *   the LoRaWAN header, MIC and FPort, the 12 byte payload of three floats is
+  *   33 symbols, and a payload of 7 bytes or less is 28 symbols. So the uplink
+  *   is packed into 56 bits, most significant bit first:
+  *
+  *   | Bits | Content                                                      |
+  *   |------|--------------------------------------------------------------|
+  *   | 22   | Latitude, -90 to 90 degrees in 180 / (2^22 - 2) steps, 4.8 m |
+  *   |      | (LORA_NO_POSITION without a fix)                             |
+  *   | 23   | Longitude, -180 to 180 degrees in 360 / 2^23 steps, 4.8 m at |
+  *   |      | the equator                                                  |
+  *   | 4    | Battery, ADC value 0 to 4095 in 15 steps                     |
+  *   | 3    | Fall probability, 0.5 to 1.0 in 7 steps, as an alarm is only |
+  *   |      | given above 0.5                                              |
+  *   | 4    | Event counter, the number of the fall modulo 16              |
+  *
+  *   The packed uplinks are sent on LORA_PORT, and the 12 byte uplinks of
+  *   struct.pack("fff", lat, lon, batt) are still decoded on LORA_LEGACY_PORT.
+  *   The network server decodes both with the codec in Docker/lora_decoder.js.
+  *
+**/
+
+#ifndef LORA_PAYLOAD_H_
+#define LORA_PAYLOAD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+const int LORA_PAYLOAD_SIZE = 7;              /**<  Size of a packed uplink in bytes   */
+const int LORA_LEGACY_PAYLOAD_SIZE = 12;      /**<  Size of an uplink of three floats in bytes   */
+const uint8_t LORA_PORT = 3;                  /**<  FPort of the packed uplinks   */
+const uint8_t LORA_LEGACY_PORT = 2;           /**<  FPort of the uplinks of three floats   */
+const int LORA_LATITUDE_BITS = 22;            /**<  Bits of the latitude   */
+const int LORA_LONGITUDE_BITS = 23;           /**<  Bits of the longitude   */
+const int LORA_BATTERY_BITS = 4;              /**<  Bits of the battery   */
+const int LORA_CONFIDENCE_BITS = 3;           /**<  Bits of the fall probability   */
+const int LORA_COUNTER_BITS = 4;              /**<  Bits of the event counter   */
+const uint32_t LORA_NO_POSITION = (1UL << LORA_LATITUDE_BITS) - 1;  /**<  Latitude of an uplink without a fix   */
+const uint16_t LORA_BATTERY_MAX = 4095;       /**<  Largest battery ADC value   */
+
+/**
+* @brief  LoraUplink: The values of an uplink
+*
+**/
+struct LoraUplink {
+  bool has_position;                  /**<  false when the GPS had no fix   */
+  double latitude;                    /**<  Degrees, negative south of equator   */
+  double longitude;                   /**<  Degrees, negative west of Greenwich   */
+  uint16_t battery;                   /**<  ADC value of the battery, 0 to LORA_BATTERY_MAX   */
+  float confidence;                   /**<  Fall probability of the model   */
+  uint8_t counter;                    /**<  Event counter, the number of the fall   */
+};
+
+/**
+* @brief  lora_encode(): Pack an uplink
+*
+* @param const LoraUplink& uplink: The uplink, values out of range are clamped.
+* @param uint8_t* payload: Buffer of at least LORA_PAYLOAD_SIZE bytes.
+* @return int: Size of the payload, LORA_PAYLOAD_SIZE
+*
+**/
+int lora_encode(const LoraUplink& uplink, uint8_t* payload);
+
+/**
+* @brief  lora_decode(): Unpack an uplink
+*
+*   The position is rounded to the nearest step, so it is within 3.4 m of the
+*   encoded position. The event counter is modulo 16.
+*
+* @param const uint8_t* payload: The payload.
+* @param size_t length: Length of the payload.
+* @param LoraUplink* uplink: The uplink.
+* @return bool: false if the payload isn't LORA_PAYLOAD_SIZE bytes
+*
+**/
+bool lora_decode(const uint8_t* payload, size_t length, LoraUplink* uplink);
+
+/**
+* @brief  lora_decode_legacy(): Read an uplink of three floats, latitude, longitude and battery
+*
+*   These uplinks have no fall probability and event counter, so they are 0.
+*
+* @param const uint8_t* payload: The payload.
+* @param size_t length: Length of the payload.
+* @param LoraUplink* uplink: The uplink.
+* @return bool: false if the payload isn't LORA_LEGACY_PAYLOAD_SIZE bytes
+*
+**/
+bool lora_decode_legacy(const uint8_t* payload, size_t length, LoraUplink* uplink);
+
+#endif  // LORA_PAYLOAD_H_
@@ -61,16 +61,20 @@ void setup();
 // repeatedly from the application code. The name needs to be loop() for Arduino
 // compatibility.
 /**
-* @brief  loop(): Gathers the IMU data, checks if threshold is exceeded, save an extra amount of data, calculates the features and then runs inference. Incase of a predicted fall, the system wakes up the LoPy and waits for reply.
+* @brief  loop(): Gathers the IMU data, checks if threshold is exceeded, save an extra amount of data, calculates the features and then runs inference. Incase of a predicted fall, the system wakes up the LoPy and handles its reply, while it keeps gathering IMU data.
 *
 *   The main loop, with the functionality of gathering data and performing inferens from it.
+*   Every call reads the samples stored in the IMU FIFO in one burst, and handles them one at a time,
+*   see afdsdCtrl1::process_sample() for step 1 to 3. A fall alarm is handled by afdsdCtrl1::update_alarm()
+*   before every sample, so the IMU data keeps being gathered while the alarm is sent. Between two calls the
+*   system sleeps for FIFO_READ_INTERVAL ms, while the IMU fills its FIFO.
 *   
 *   1: (Get data) Gathers enough new IMU data, so inferens can be run <br>
 *   2: (Check for threshold) Gathers new IMU data, as long as the threshold is not exceeded. <br>
-*   3: (Save extra amount of signal) When the threshold is exceeded gather an extra amount of IMU data. <br>
+*   3: (Save extra amount of signal) When the threshold is exceeded gather an extra amount of IMU data, and update the features with every new sample. <br>
 *   4: (Predict fall) Calculate the features and run inferens to predict if a fall has occured. If a fall was predicted, go to 5 if not go to 7. <br>
-*   5: (LoPy communication) Wake up the LoPy, start the audio alarm, save the signal to the microSD card and then wait for reply from the LoPy. <br>
-*   6: (Reset fall variables) After communication with the LoPy the system sets the wakeup pin low and stops the audio. It then sets the boolean got_data variable to false. <br>
+*   5: (LoPy communication) Wake up the LoPy and start the audio alarm. The signal is saved to the microSD card and the reply from the LoPy is handled in the following loops, where the LoPy is woken again if it doesn't answer in time. <br>
+*   6: (Reset fall variables) The system sets the boolean got_data variable to false, so the signal after the fall is gathered from the start. <br>
 *   7: (Reset variables) Here the system resets the threshold variable, so it is below the defined threshold, and resets the extra signal variable. If a fall was predicted the system starts from 1 and if not the system starts from 2. <br>
 *
 * @return void
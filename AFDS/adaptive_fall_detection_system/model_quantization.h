@@ -0,0 +1,129 @@
+/**
+  *
+  *
+  * @file:    model_quantization.h
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Quantization of the features for the int8 fall models
+  *
+  *   The int8 models take the features as int8 values, with the scale and
+  *   zero point of the input tensor: value = scale * (q - zero_point).
+  *
+  *   The features are in g, dps and other units with very different ranges,
+  *   so quantize_model divides every feature by its own scale and multiplies
+  *   the hidden weights by it. One int8 input scale then covers the small
+  *   features as well as the large ones. The feature scales are kept in the
+  *   model, as the metadata named FEATURE_SCALES_METADATA.
+  *
+**/
+
+#ifndef MODEL_QUANTIZATION_H_
+#define MODEL_QUANTIZATION_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define FEATURE_SCALES_METADATA "feature_scales"   /**<  Name of the metadata holding the feature scales   */
+
+/**
+* @brief  quantize_value(): Quantize a value with the scale and zero point of a tensor
+*
+* @param float value: The value.
+* @param float scale: Scale of the tensor.
+* @param int zero_point: Zero point of the tensor.
+* @return int8_t: The rounded value, saturated to the int8 range
+*
+**/
+inline int8_t quantize_value(float value, float scale, int zero_point) {
+  float q = roundf(value / scale) + zero_point;
+  if (q > 127.0f) {
+    return 127;
+  }
+  if (q < -128.0f) {
+    return -128;
+  }
+  return static_cast<int8_t>(q);
+}
+
+/**
+* @brief  dequantize_value(): The value of a quantized value of a tensor
+*
+* @param int8_t q: The quantized value.
+* @param float scale: Scale of the tensor.
+* @param int zero_point: Zero point of the tensor.
+* @return float: The value
+*
+**/
+inline float dequantize_value(int8_t q, float scale, int zero_point) {
+  return scale * (q - zero_point);
+}
+
+/**
+* @brief  quantize_features(): Quantize the features for the input tensor of an int8 model
+*
+*   Every feature is divided by its feature scale as well as the scale of the
+*   input tensor.
+*
+* @param const float features[]: The features.
+* @param const float feature_scales[]: The feature scales of the model, from model_feature_scales().
+* @param int8_t input[]: The quantized features.
+* @param int n: Amount of features.
+* @param float scale: Scale of the input tensor.
+* @param int zero_point: Zero point of the input tensor.
+* @return void
+*
+**/
+inline void quantize_features(const float features[], const float feature_scales[], int8_t input[], int n,
+                              float scale, int zero_point) {
+  for (int i = 0; i < n; i++) {
+    input[i] = quantize_value(features[i], feature_scales[i] * scale, zero_point);
+  }
+}
+
+/**
+* @brief  model_feature_scales(): The feature scales kept in an int8 model
+*
+* @param const tflite::Model* model: The int8 model.
+* @param int n: Amount of features.
+* @return const float*: The n feature scales, or nullptr if the model has none
+*
+**/
+inline const float* model_feature_scales(const tflite::Model* model, int n) {
+  if (model->metadata() == nullptr || model->buffers() == nullptr) {
+    return nullptr;
+  }
+  for (const tflite::Metadata* metadata : *model->metadata()) {
+    if (metadata->name() == nullptr || strcmp(metadata->name()->c_str(), FEATURE_SCALES_METADATA) != 0 ||
+        metadata->buffer() >= model->buffers()->size()) {
+      continue;
+    }
+    const flatbuffers::Vector<uint8_t>* data = model->buffers()->Get(metadata->buffer())->data();
+    if (data != nullptr && data->size() == n * sizeof(float)) {
+      // The buffer is aligned by quantize_model, so the floats are read in place
+      return reinterpret_cast<const float*>(data->data());
+    }
+  }
+  return nullptr;
+}
+
+/**
+* @brief  dequantize_outputs(): The values of the int8 output tensor of a model
+*
+* @param const int8_t output[]: The quantized outputs.
+* @param float values[]: The values of the outputs.
+* @param int n: Amount of outputs.
+* @param float scale: Scale of the output tensor.
+* @param int zero_point: Zero point of the output tensor.
+* @return void
+*
+**/
+inline void dequantize_outputs(const int8_t output[], float values[], int n, float scale, int zero_point) {
+  for (int i = 0; i < n; i++) {
+    values[i] = dequantize_value(output[i], scale, zero_point);
+  }
+}
+
+#endif  // MODEL_QUANTIZATION_H_
@@ -0,0 +1,179 @@
+/**
+  *
+  *
+  * @file:    op_profiler.cpp
+  * @date:    17-10-2026 07:48:51
+  *
+  * @brief    Profiles every operation of a model run by the MicroInterpreter
+  *
+  *
+  *
+  *
+**/
+
+#include "op_profiler.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__ARM_ARCH_7EM__) && !defined(__ARM_ARCH_7M__)
+#include <Arduino.h>
+#endif
+
+namespace {
+
+typedef TfLiteStatus (*InvokeFunction)(TfLiteContext* context, TfLiteNode* node);
+
+// A profiled registration. The interpreter only passes the context and the node to invoke(), so every
+// profiled registration has its own invoke() knowing its slot.
+struct ProfiledOp {
+  TfLiteRegistration registration;    /**<  The copy given to the interpreter   */
+  const TfLiteRegistration* original; /**<  The wrapped registration   */
+  OpProfiler* profiler;               /**<  The profiler of the model   */
+};
+
+ProfiledOp profiled_ops[PROFILER_MAX_OPS];
+int profiled_op_count = 0;
+
+template <int Slot>
+TfLiteStatus profiled_invoke(TfLiteContext* context, TfLiteNode* node) {
+  ProfiledOp& op = profiled_ops[Slot];
+  uint32_t start = profiler_cycles();
+  TfLiteStatus status = op.original->invoke(context, node);
+  op.profiler->record(op.original, profiler_cycles() - start);
+  return status;
+}
+
+const InvokeFunction PROFILED_INVOKES[PROFILER_MAX_OPS] = {
+  profiled_invoke<0>, profiled_invoke<1>, profiled_invoke<2>, profiled_invoke<3>,
+  profiled_invoke<4>, profiled_invoke<5>, profiled_invoke<6>, profiled_invoke<7>,
+  profiled_invoke<8>, profiled_invoke<9>, profiled_invoke<10>, profiled_invoke<11>,
+  profiled_invoke<12>, profiled_invoke<13>, profiled_invoke<14>, profiled_invoke<15>,
+};
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+// The DWT cycle counter of the Cortex-M4
+volatile uint32_t* const DEMCR = reinterpret_cast<volatile uint32_t*>(0xE000EDFC);
+volatile uint32_t* const DWT_CTRL = reinterpret_cast<volatile uint32_t*>(0xE0001000);
+volatile uint32_t* const DWT_CYCCNT = reinterpret_cast<volatile uint32_t*>(0xE0001004);
+const uint32_t DEMCR_TRCENA = 1UL << 24;
+const uint32_t DWT_CTRL_CYCCNTENA = 1UL;
+#endif
+
+void start_cycle_counter() {
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+  *DEMCR |= DEMCR_TRCENA;
+  *DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+#endif
+}
+
+}  // namespace
+
+uint32_t profiler_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return static_cast<uint32_t>(__rdtsc());
+#elif defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+  return *DWT_CYCCNT;
+#else
+  // Without a cycle counter the profile is in microseconds
+  return micros();
+#endif
+}
+
+OpProfiler::OpProfiler(const tflite::OpResolver& resolver) : resolver(resolver) {
+  start_cycle_counter();
+  reset();
+}
+
+void OpProfiler::reset() {
+  memset(node_profiles, 0, sizeof(node_profiles));
+  node_count = 0;
+  next_node = 0;
+  invoke_count = 0;
+}
+
+const TfLiteRegistration* OpProfiler::profile(const TfLiteRegistration* registration) const {
+  if (registration == nullptr || registration->invoke == nullptr) {
+    return registration;
+  }
+  // The profiler only counts the cycles, so it is changed through the registrations the interpreter calls
+  OpProfiler* profiler = const_cast<OpProfiler*>(this);
+  for (int slot = 0; slot < profiled_op_count; slot++) {
+    if (profiled_ops[slot].original == registration && profiled_ops[slot].profiler == profiler) {
+      return &profiled_ops[slot].registration;
+    }
+  }
+  if (profiled_op_count >= PROFILER_MAX_OPS) {
+    return registration;
+  }
+  ProfiledOp& op = profiled_ops[profiled_op_count];
+  op.registration = *registration;
+  op.registration.invoke = PROFILED_INVOKES[profiled_op_count];
+  op.original = registration;
+  op.profiler = profiler;
+  profiled_op_count++;
+  return &op.registration;
+}
+
+const TfLiteRegistration* OpProfiler::FindOp(tflite::BuiltinOperator op, int version) const {
+  return profile(resolver.FindOp(op, version));
+}
+
+const TfLiteRegistration* OpProfiler::FindOp(const char* op, int version) const {
+  return profile(resolver.FindOp(op, version));
+}
+
+void OpProfiler::record(const TfLiteRegistration* registration, uint32_t cycles) {
+  int index = next_node++;
+  if (index >= PROFILER_MAX_NODES) {
+    return;
+  }
+  NodeProfile& node = node_profiles[index];
+  if (node.invokes == 0) {
+    node.op = registration->builtin_code;
+    node.version = registration->version;
+    node.min_cycles = cycles;
+  }
+  node.invokes++;
+  node.cycles += cycles;
+  if (cycles < node.min_cycles) {
+    node.min_cycles = cycles;
+  }
+  if (cycles > node.max_cycles) {
+    node.max_cycles = cycles;
+  }
+  if (index >= node_count) {
+    node_count = index + 1;
+  }
+}
+
+uint64_t OpProfiler::total_cycles() const {
+  uint64_t total = 0;
+  for (int i = 0; i < node_count; i++) {
+    total += node_profiles[i].cycles;
+  }
+  return total;
+}
+
+void OpProfiler::report(tflite::ErrorReporter* error_reporter, const char* name) const {
+  uint64_t total = total_cycles();
+  uint32_t invokes = invoke_count > 0 ? invoke_count : 1;
+  error_reporter->Report("Profile of %s: %d cycles per Invoke() in %d nodes", name,
+                         static_cast<int>(total / invokes), node_count);
+  // The micro error reporter only prints integers, so the parts are in per mille
+  for (int i = 0; i < node_count; i++) {
+    const NodeProfile& node = node_profiles[i];
+    error_reporter->Report("  %d %s v%d: %d cycles, %d per mille", i, op_name(node.op),
+                           static_cast<int>(node.version),
+                           static_cast<int>(node.cycles / (node.invokes > 0 ? node.invokes : 1)),
+                           static_cast<int>(total > 0 ? node.cycles * 1000 / total : 0));
+  }
+}
+
+const char* OpProfiler::op_name(int32_t op) {
+  if (op < tflite::BuiltinOperator_MIN || op > tflite::BuiltinOperator_MAX) {
+    return "UNKNOWN";
+  }
+  return tflite::EnumNameBuiltinOperator(static_cast<tflite::BuiltinOperator>(op));
+}
@@ -0,0 +1,193 @@
+/**
+  *
+  *
+  * @file:    op_profiler.h
+  * @date:    17-10-2026 07:48:51
+  *
+  * @brief    Profiles every operation of a model run by the MicroInterpreter
+  *
+  *   The interpreter can't be changed, as it is part of the prebuilt
+  *   TensorFlow Lite library, so the profiler is an op resolver wrapping the
+  *   resolver of the model. Every registration it returns is a copy of the
+  *   wrapped one with another invoke(), which counts the cycles of the
+  *   original invoke(). The interpreter invokes the nodes in order, so the
+  *   node of a measurement is the amount of operations invoked since
+  *   begin_invoke().
+  *
+  *   The cycles are counted by the DWT cycle counter on the board, and by the
+  *   time stamp counter on the workstation, where the same profiler is used by
+  *   the host tool afds_profile.
+  *
+**/
+
+#ifndef OP_PROFILER_H_
+#define OP_PROFILER_H_
+
+#include <stdint.h>
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/core/api/op_resolver.h"
+
+const int PROFILER_MAX_OPS = 16;      /**<  Registrations that can be profiled, by all profilers together   */
+const int PROFILER_MAX_NODES = 32;    /**<  Nodes profiled per model   */
+
+/**
+* @brief  NodeProfile: The cycles of a node of the model
+*
+**/
+struct NodeProfile {
+  int32_t op;                         /**<  The tflite::BuiltinOperator of the node   */
+  int32_t version;                    /**<  Version of the operation   */
+  uint32_t invokes;                   /**<  Times the node has been invoked   */
+  uint32_t min_cycles;                /**<  Fewest cycles of an invoke   */
+  uint32_t max_cycles;                /**<  Most cycles of an invoke   */
+  uint64_t cycles;                    /**<  Cycles of all the invokes   */
+};
+
+/**
+* @brief  profiler_cycles(): The cycle counter
+*
+* @param none
+* @return uint32_t: The DWT cycle counter on the board, the time stamp counter on the workstation
+*
+**/
+uint32_t profiler_cycles();
+
+/**
+* @brief  OpProfiler: Op resolver counting the cycles of every node
+*
+**/
+class OpProfiler : public tflite::OpResolver {
+  public:
+    /**
+    * @brief  OpProfiler(): Wrap the resolver of a model, and start the cycle counter
+    *
+    * @param const tflite::OpResolver& resolver: The resolver of the operations, which has to live as long as the profiler.
+    *
+    **/
+    explicit OpProfiler(const tflite::OpResolver& resolver);
+
+    /**
+    * @brief  FindOp(): The profiled registration of a builtin operation
+    *
+    * @param tflite::BuiltinOperator op: The operation.
+    * @param int version: The version of the operation in the model.
+    * @return const TfLiteRegistration*: The profiled registration, the unprofiled one if all PROFILER_MAX_OPS
+    *   are used, or nullptr if the operation isn't supported
+    *
+    **/
+    const TfLiteRegistration* FindOp(tflite::BuiltinOperator op, int version) const override;
+
+    /**
+    * @brief  FindOp(): The profiled registration of a custom operation
+    *
+    * @param const char* op: Name of the operation.
+    * @param int version: The version of the operation in the model.
+    * @return const TfLiteRegistration*: The profiled registration, like for the builtin operations
+    *
+    **/
+    const TfLiteRegistration* FindOp(const char* op, int version) const override;
+
+    /**
+    * @brief  begin_invoke(): Called before Invoke(), so the next operation is node 0
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void begin_invoke() { next_node = 0; };
+
+    /**
+    * @brief  end_invoke(): Called after Invoke(), counts the profiled Invoke() calls
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void end_invoke() { invoke_count++; };
+
+    /**
+    * @brief  reset(): Forget the measurements, the profiled registrations are kept
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  record(): Add the cycles of the next node, called by the profiled registrations
+    *
+    * @param const TfLiteRegistration* registration: The registration of the operation.
+    * @param uint32_t cycles: Cycles of its invoke().
+    * @return void:
+    *
+    **/
+    void record(const TfLiteRegistration* registration, uint32_t cycles);
+
+    /**
+    * @brief  nodes(): Amount of profiled nodes
+    *
+    * @param none
+    * @return int: Up to PROFILER_MAX_NODES
+    *
+    **/
+    int nodes() const { return node_count; };
+
+    /**
+    * @brief  node(): The profile of a node
+    *
+    * @param int i: Index of the node in the model.
+    * @return const NodeProfile&: Its profile
+    *
+    **/
+    const NodeProfile& node(int i) const { return node_profiles[i]; };
+
+    /**
+    * @brief  invokes(): Amount of profiled Invoke() calls
+    *
+    * @param none
+    * @return uint32_t: Calls of end_invoke() since the last reset
+    *
+    **/
+    uint32_t invokes() const { return invoke_count; };
+
+    /**
+    * @brief  total_cycles(): Cycles of all the profiled nodes
+    *
+    * @param none
+    * @return uint64_t: The sum of the cycles
+    *
+    **/
+    uint64_t total_cycles() const;
+
+    /**
+    * @brief  report(): Report the mean cycles of every node, and its part of the model
+    *
+    * @param tflite::ErrorReporter* error_reporter: Where the profile is reported.
+    * @param const char* name: Name of the model.
+    * @return void:
+    *
+    **/
+    void report(tflite::ErrorReporter* error_reporter, const char* name) const;
+
+    /**
+    * @brief  op_name(): Name of an operation
+    *
+    * @param int32_t op: The tflite::BuiltinOperator.
+    * @return const char*: The name, like "FULLY_CONNECTED"
+    *
+    **/
+    static const char* op_name(int32_t op);
+
+  private:
+    const TfLiteRegistration* profile(const TfLiteRegistration* registration) const;
+
+    const tflite::OpResolver& resolver;                 /**<  The wrapped resolver   */
+    NodeProfile node_profiles[PROFILER_MAX_NODES];      /**<  The profile of every node   */
+    int node_count;                                     /**<  Nodes profiled   */
+    int next_node;                                      /**<  Node of the next recorded operation   */
+    uint32_t invoke_count;                              /**<  Profiled Invoke() calls   */
+};
+
+#endif  // OP_PROFILER_H_
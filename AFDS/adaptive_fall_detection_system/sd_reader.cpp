@@ -0,0 +1,181 @@
+/**
+  *
+  *
+  * @file:    sd_reader.cpp
+  * @date:    17-10-2026 08:25:28
+  *
+  * @brief    Buffered reading and number parsing of the files on the MicroSD card
+  *
+  *
+  *
+  *
+**/
+
+#include "sd_reader.h"
+
+#include <math.h>
+
+// Powers of ten, which are exact as doubles
+static const double POWERS_OF_TEN[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+static const int MAX_EXACT_POWER = 22;
+static const int MAX_DIGITS = 19;     // Digits which fit in an uint64_t
+
+// Powers of ten, which are exact as floats
+static const float FLOAT_POWERS_OF_TEN[] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+static const int MAX_EXACT_FLOAT_POWER = 10;
+static const uint32_t MAX_EXACT_FLOAT_MANTISSA = 1UL << 24;   // Integers which are exact as floats
+static const int MAX_FAST_DIGITS = 9;                          // Digits which fit in an uint32_t
+
+bool SdBlockReader::fill() {
+  int read = file->read(block, SD_BLOCK_SIZE);
+  position = 0;
+  length = read > 0 ? read : 0;
+  if (length > 0) {
+    block_count++;
+  }
+  return length > 0;
+}
+
+static bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// Matches the lower case word, like the Arduino String prints "nan" and "inf"
+static bool starts_with(const char* str, const char* word) {
+  for (; *word != '\0'; str++, word++) {
+    if ((*str | 0x20) != *word) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Numbers with any amount of digits and an exponent, through an uint64_t and a double
+static float parse_float_slow(const char* str, const char** end) {
+  const char* c = str;
+  bool negative = *c == '-';
+  if (*c == '-' || *c == '+') {
+    c++;
+  }
+  if (starts_with(c, "nan") || starts_with(c, "inf")) {
+    if (end != nullptr) {
+      *end = c + 3;
+    }
+    float special = *c == 'n' || *c == 'N' ? NAN : INFINITY;
+    return negative ? -special : special;
+  }
+
+  // The digits are collected as an integer, and scaled once by the power of ten
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  bool any_digit = false;
+  for (; is_digit(*c); c++) {
+    any_digit = true;
+    if (digits < MAX_DIGITS) {
+      mantissa = mantissa * 10 + (*c - '0');
+      digits += mantissa > 0 ? 1 : 0;
+    }
+    else {
+      exponent++;
+    }
+  }
+  if (*c == '.') {
+    for (c++; is_digit(*c); c++) {
+      any_digit = true;
+      if (digits < MAX_DIGITS) {
+        mantissa = mantissa * 10 + (*c - '0');
+        digits += mantissa > 0 ? 1 : 0;
+        exponent--;
+      }
+    }
+  }
+  if (!any_digit) {
+    if (end != nullptr) {
+      *end = str;
+    }
+    return 0.0f;
+  }
+  if (*c == 'e' || *c == 'E') {
+    const char* e = c + 1;
+    bool negative_exponent = *e == '-';
+    if (*e == '-' || *e == '+') {
+      e++;
+    }
+    if (is_digit(*e)) {
+      int value = 0;
+      for (; is_digit(*e); e++) {
+        value = value < 1000 ? value * 10 + (*e - '0') : value;
+      }
+      exponent += negative_exponent ? -value : value;
+      c = e;
+    }
+  }
+  if (end != nullptr) {
+    *end = c;
+  }
+
+  // A single multiplication or division by an exact power of ten is rounded once to
+  // a double, and once more to the float
+  double value = static_cast<double>(mantissa);
+  if (mantissa != 0) {
+    for (; exponent > MAX_EXACT_POWER; exponent -= MAX_EXACT_POWER) {
+      value *= POWERS_OF_TEN[MAX_EXACT_POWER];
+    }
+    for (; exponent < -MAX_EXACT_POWER; exponent += MAX_EXACT_POWER) {
+      value /= POWERS_OF_TEN[MAX_EXACT_POWER];
+    }
+    value = exponent >= 0 ? value * POWERS_OF_TEN[exponent] : value / POWERS_OF_TEN[-exponent];
+  }
+  return static_cast<float>(negative ? -value : value);
+}
+
+float parse_float(const char* str, const char** end) {
+  const char* c = str;
+  bool negative = *c == '-';
+  if (*c == '-' || *c == '+') {
+    c++;
+  }
+
+  // The fields of the datalogger have a few digits and no exponent, so their digits fit in an
+  // uint32_t. Anything else is left to the slow path.
+  uint32_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  bool any_digit = false;
+  for (; is_digit(*c); c++) {
+    if (digits == MAX_FAST_DIGITS) {
+      return parse_float_slow(str, end);
+    }
+    any_digit = true;
+    mantissa = mantissa * 10 + (*c - '0');
+    digits += mantissa > 0 ? 1 : 0;
+  }
+  if (*c == '.') {
+    for (c++; is_digit(*c); c++) {
+      if (digits == MAX_FAST_DIGITS) {
+        return parse_float_slow(str, end);
+      }
+      any_digit = true;
+      mantissa = mantissa * 10 + (*c - '0');
+      digits += mantissa > 0 ? 1 : 0;
+      exponent--;
+    }
+  }
+  if (!any_digit || *c == 'e' || *c == 'E' || mantissa > MAX_EXACT_FLOAT_MANTISSA ||
+      exponent < -MAX_EXACT_FLOAT_POWER) {
+    return parse_float_slow(str, end);
+  }
+  if (end != nullptr) {
+    *end = c;
+  }
+
+  // The mantissa and the power of ten are exact floats, so the division is rounded once, like strtof()
+  float value = static_cast<float>(mantissa) / FLOAT_POWERS_OF_TEN[-exponent];
+  return negative ? -value : value;
+}
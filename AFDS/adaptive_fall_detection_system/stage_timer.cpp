@@ -0,0 +1,175 @@
+/**
+  *
+  *
+  * @file:    stage_timer.cpp
+  * @date:    17-10-2026 07:43:12
+  *
+  * @brief    Timing of the stages of the main loop, and its binary dump
+  *
+  *
+  *
+  *
+**/
+
+#include "stage_timer.h"
+
+#include <string.h>
+
+#include <SD.h>
+
+static const char STAGE_DUMP_MAGIC[4] = {'A', 'F', 'D', 'T'};
+
+static const char* const STAGE_NAMES[STAGE_COUNT] = {"fifo_read", "sample", "features", "invoke", "sd_write", "lopy"};
+
+// The fields are copied byte by byte, because they aren't aligned
+template <typename T>
+static void put(uint8_t* data, int offset, T value) {
+  memcpy(data + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static T get(const uint8_t* data, int offset) {
+  T value;
+  memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+const char* stage_name(int stage) {
+  return stage >= 0 && stage < STAGE_COUNT ? STAGE_NAMES[stage] : "unknown";
+}
+
+StageTimer::StageTimer() {
+  reset();
+}
+
+void StageTimer::reset() {
+  memset(stage_stats, 0, sizeof(stage_stats));
+  memset(started, 0, sizeof(started));
+  next_event = 0;
+  event_count = 0;
+  dump_time = 0;
+}
+
+void StageTimer::record(Stage stage, uint32_t start_us, uint32_t duration_us) {
+  StageStats& stats = stage_stats[stage];
+  if (stats.count == 0 || duration_us < stats.min_us) {
+    stats.min_us = duration_us;
+  }
+  if (duration_us > stats.max_us) {
+    stats.max_us = duration_us;
+  }
+  stats.count++;
+  stats.total_us += duration_us;
+  int bin = 0;
+  while (bin < STAGE_HISTOGRAM_BINS - 1 && (duration_us >> (bin + 1)) != 0) {
+    bin++;
+  }
+  // The bins stop counting when they are full, instead of starting over
+  if (stats.histogram[bin] != UINT16_MAX) {
+    stats.histogram[bin]++;
+  }
+
+  StageEvent& event = ring[next_event];
+  event.start_us = start_us;
+  event.duration_us = duration_us;
+  event.stage = static_cast<uint8_t>(stage);
+  next_event = (next_event + 1) % STAGE_RING_SIZE;
+  if (event_count < STAGE_RING_SIZE) {
+    event_count++;
+  }
+}
+
+const StageEvent& StageTimer::event(int i) const {
+  return ring[(next_event - event_count + i + STAGE_RING_SIZE) % STAGE_RING_SIZE];
+}
+
+size_t StageTimer::dump_size() const {
+  return STAGE_DUMP_HEADER_SIZE + STAGE_COUNT * STAGE_DUMP_STATS_SIZE + event_count * STAGE_DUMP_EVENT_SIZE;
+}
+
+size_t StageTimer::dump(Print& out) const {
+  uint8_t data[STAGE_DUMP_STATS_SIZE];
+  size_t written = 0;
+
+  memcpy(data, STAGE_DUMP_MAGIC, sizeof(STAGE_DUMP_MAGIC));
+  put<uint16_t>(data, 4, STAGE_DUMP_VERSION);
+  put<uint8_t>(data, 6, STAGE_COUNT);
+  put<uint8_t>(data, 7, STAGE_HISTOGRAM_BINS);
+  put<uint16_t>(data, 8, static_cast<uint16_t>(event_count));
+  put<uint16_t>(data, 10, 0);
+  put<uint32_t>(data, 12, static_cast<uint32_t>(micros()));
+  written += out.write(data, STAGE_DUMP_HEADER_SIZE);
+
+  for (int s = 0; s < STAGE_COUNT; s++) {
+    const StageStats& stats = stage_stats[s];
+    put<uint32_t>(data, 0, stats.count);
+    put<uint32_t>(data, 4, stats.min_us);
+    put<uint32_t>(data, 8, stats.max_us);
+    put<uint64_t>(data, 12, stats.total_us);
+    for (int b = 0; b < STAGE_HISTOGRAM_BINS; b++) {
+      put<uint16_t>(data, 20 + 2 * b, stats.histogram[b]);
+    }
+    written += out.write(data, STAGE_DUMP_STATS_SIZE);
+  }
+
+  for (int i = 0; i < event_count; i++) {
+    const StageEvent& e = event(i);
+    put<uint8_t>(data, 0, e.stage);
+    put<uint32_t>(data, 1, e.start_us);
+    put<uint32_t>(data, 5, e.duration_us);
+    written += out.write(data, STAGE_DUMP_EVENT_SIZE);
+  }
+  return written;
+}
+
+bool StageTimer::save(const char* name) const {
+  if (SD.exists(name)) {
+    SD.remove(name);
+  }
+  File file = SD.open(name, FILE_WRITE);
+  if (!file) {
+    return false;
+  }
+  bool written = dump(file) == dump_size();
+  file.close();
+  return written;
+}
+
+bool StageTimer::decode(const uint8_t* data, size_t size) {
+  if (size < static_cast<size_t>(STAGE_DUMP_HEADER_SIZE) ||
+      memcmp(data, STAGE_DUMP_MAGIC, sizeof(STAGE_DUMP_MAGIC)) != 0 ||
+      get<uint16_t>(data, 4) != STAGE_DUMP_VERSION || get<uint8_t>(data, 6) != STAGE_COUNT ||
+      get<uint8_t>(data, 7) != STAGE_HISTOGRAM_BINS) {
+    return false;
+  }
+  int events = get<uint16_t>(data, 8);
+  if (events > STAGE_RING_SIZE ||
+      size < static_cast<size_t>(STAGE_DUMP_HEADER_SIZE + STAGE_COUNT * STAGE_DUMP_STATS_SIZE +
+                                 events * STAGE_DUMP_EVENT_SIZE)) {
+    return false;
+  }
+
+  reset();
+  dump_time = get<uint32_t>(data, 12);
+  const uint8_t* stats_data = data + STAGE_DUMP_HEADER_SIZE;
+  for (int s = 0; s < STAGE_COUNT; s++, stats_data += STAGE_DUMP_STATS_SIZE) {
+    StageStats& stats = stage_stats[s];
+    stats.count = get<uint32_t>(stats_data, 0);
+    stats.min_us = get<uint32_t>(stats_data, 4);
+    stats.max_us = get<uint32_t>(stats_data, 8);
+    stats.total_us = get<uint64_t>(stats_data, 12);
+    for (int b = 0; b < STAGE_HISTOGRAM_BINS; b++) {
+      stats.histogram[b] = get<uint16_t>(stats_data, 20 + 2 * b);
+    }
+  }
+  const uint8_t* event_data = stats_data;
+  for (int i = 0; i < events; i++, event_data += STAGE_DUMP_EVENT_SIZE) {
+    StageEvent& e = ring[i];
+    e.stage = get<uint8_t>(event_data, 0);
+    e.start_us = get<uint32_t>(event_data, 1);
+    e.duration_us = get<uint32_t>(event_data, 5);
+  }
+  event_count = events;
+  next_event = events % STAGE_RING_SIZE;
+  return true;
+}
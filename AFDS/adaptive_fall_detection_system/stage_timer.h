@@ -0,0 +1,260 @@
+/**
+  *
+  *
+  * @file:    stage_timer.h
+  * @date:    17-10-2026 07:43:12
+  *
+  * @brief    Timing of the stages of the main loop, and its binary dump
+  *
+  *   Every measured stage is recorded with its micros() timestamp and duration
+  *   in a ring buffer of the last STAGE_RING_SIZE events, and in the count,
+  *   min, max, total and a histogram of its stage. The histogram has a bin for
+  *   every power of two microseconds.
+  *
+  *   The stages are measured with the STAGE_SCOPE(), STAGE_BEGIN() and
+  *   STAGE_END() macros, which only measure anything when STAGE_TIMING is
+  *   defined before this header is included. Without it they are empty, and
+  *   the timer isn't in the sketch at all. With STAGE_TIMING the sketch has
+  *   to define the StageTimer stage_timer.
+  *
+  *   Dump (all values little-endian):
+  *   | Offset | Type       | Content                                       |
+  *   |--------|------------|-----------------------------------------------|
+  *   | 0      | char[4]    | "AFDT"                                        |
+  *   | 4      | uint16     | Format version (STAGE_DUMP_VERSION)           |
+  *   | 6      | uint8      | Amount of stages (STAGE_COUNT)                |
+  *   | 7      | uint8      | Histogram bins per stage (STAGE_HISTOGRAM_BINS)|
+  *   | 8      | uint16     | Amount of events                              |
+  *   | 10     | uint16     | Reserved (zero)                               |
+  *   | 12     | uint32     | micros() when the dump was made               |
+  *   | 16     | stage[]    | Per stage: uint32 count, min, max in us,      |
+  *   |        |            | uint64 total in us, uint16 histogram[]        |
+  *   | ...    | event[]    | Oldest first: uint8 stage, uint32 start and   |
+  *   |        |            | uint32 duration in us                         |
+  *
+**/
+
+#ifndef STAGE_TIMER_H_
+#define STAGE_TIMER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Arduino.h>
+
+// The measured stages of the main loop
+enum Stage {
+  STAGE_FIFO_READ,                    /**<  Reading a burst of samples from the IMU FIFO   */
+  STAGE_SAMPLE,                       /**<  Adding a sample to the signal, and checking the threshold   */
+  STAGE_FEATURES,                     /**<  feature_calculation() of a signal   */
+  STAGE_INVOKE,                       /**<  Inference of a signal   */
+  STAGE_SD_WRITE,                     /**<  Saving a fall signal on the MicroSD card   */
+  STAGE_LOPY,                         /**<  From waking up the LoPy until it acknowledges the alarm   */
+  STAGE_COUNT
+};
+
+const int STAGE_RING_SIZE = 64;               /**<  Events kept in the ring buffer   */
+const int STAGE_HISTOGRAM_BINS = 20;          /**<  Histogram bins, the last one holds everything from 2^19 us   */
+const uint16_t STAGE_DUMP_VERSION = 1;        /**<  Version of the dump format   */
+const int STAGE_DUMP_HEADER_SIZE = 16;        /**<  Size of the dump header in bytes   */
+const int STAGE_DUMP_STATS_SIZE = 20 + 2 * STAGE_HISTOGRAM_BINS;  /**<  Size of the statistics of a stage in bytes   */
+const int STAGE_DUMP_EVENT_SIZE = 9;          /**<  Size of an event in bytes   */
+const char STAGE_DUMP_NAME[] = "TIMING.bin";  /**<  Name of the dump on the MicroSD card   */
+
+/**
+* @brief  StageStats: The durations measured of a stage
+*
+**/
+struct StageStats {
+  uint32_t count;                             /**<  Amount of measurements   */
+  uint32_t min_us;                            /**<  Shortest duration in us   */
+  uint32_t max_us;                            /**<  Longest duration in us   */
+  uint64_t total_us;                          /**<  Sum of the durations in us   */
+  uint16_t histogram[STAGE_HISTOGRAM_BINS];   /**<  Measurements of every bin, bin b holds 2^b to 2^(b+1) - 1 us   */
+
+  float mean_us() const { return count > 0 ? static_cast<float>(total_us) / count : 0.0f; };
+};
+
+/**
+* @brief  StageEvent: A single measurement in the ring buffer
+*
+**/
+struct StageEvent {
+  uint32_t start_us;                          /**<  micros() at the start of the stage   */
+  uint32_t duration_us;                       /**<  Duration of the stage in us   */
+  uint8_t stage;                              /**<  The measured Stage   */
+};
+
+/**
+* @brief  StageTimer: The statistics and the last events of every stage
+*
+**/
+class StageTimer {
+  public:
+    StageTimer();
+
+    /**
+    * @brief  reset(): Forget all measurements
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  record(): Record a measurement of a stage
+    *
+    * @param Stage stage: The measured stage.
+    * @param uint32_t start_us: micros() at the start of the stage.
+    * @param uint32_t duration_us: Duration of the stage in us.
+    * @return void:
+    *
+    **/
+    void record(Stage stage, uint32_t start_us, uint32_t duration_us);
+
+    /**
+    * @brief  begin(): Start measuring a stage which ends in another function, or in a later loop
+    *
+    * @param Stage stage: The measured stage.
+    * @return void:
+    *
+    **/
+    void begin(Stage stage) { started[stage] = micros(); };
+
+    /**
+    * @brief  end(): Record the stage started with begin()
+    *
+    * @param Stage stage: The measured stage.
+    * @return void:
+    *
+    **/
+    void end(Stage stage) { record(stage, started[stage], micros() - started[stage]); };
+
+    /**
+    * @brief  stats(): The statistics of a stage
+    *
+    * @param Stage stage: The stage.
+    * @return const StageStats&: Its statistics
+    *
+    **/
+    const StageStats& stats(Stage stage) const { return stage_stats[stage]; };
+
+    /**
+    * @brief  events(): Amount of events in the ring buffer
+    *
+    * @param none
+    * @return int: Up to STAGE_RING_SIZE
+    *
+    **/
+    int events() const { return event_count; };
+
+    /**
+    * @brief  event(): An event of the ring buffer
+    *
+    * @param int i: Index of the event, 0 is the oldest.
+    * @return const StageEvent&: The event
+    *
+    **/
+    const StageEvent& event(int i) const;
+
+    /**
+    * @brief  dump_size(): Size of the dump of the current measurements
+    *
+    * @param none
+    * @return size_t: The size in bytes
+    *
+    **/
+    size_t dump_size() const;
+
+    /**
+    * @brief  dump(): Write the measurements in the binary format
+    *
+    *   The dump is written in small parts, so no buffer of the whole dump is needed.
+    *   Serial and the files of the MicroSD card can both be written to.
+    *
+    * @param Print& out: Where the dump is written.
+    * @return size_t: The bytes written
+    *
+    **/
+    size_t dump(Print& out) const;
+
+    /**
+    * @brief  save(): Save the dump on the MicroSD card, replacing an older dump
+    *
+    * @param const char* name: Name of the dump file.
+    * @return bool: true when the whole dump is written
+    *
+    **/
+    bool save(const char* name) const;
+
+    /**
+    * @brief  decode(): Restore the measurements from a dump
+    *
+    * @param const uint8_t* data: The dump.
+    * @param size_t size: Size of the dump in bytes.
+    * @return bool: true when the dump is valid, otherwise the timer is unchanged
+    *
+    **/
+    bool decode(const uint8_t* data, size_t size);
+
+    /**
+    * @brief  dumped_at(): micros() when the decoded dump was made
+    *
+    * @param none
+    * @return uint32_t: The time in us
+    *
+    **/
+    uint32_t dumped_at() const { return dump_time; };
+
+  private:
+    StageStats stage_stats[STAGE_COUNT];      /**<  Statistics of every stage   */
+    StageEvent ring[STAGE_RING_SIZE];         /**<  The last events   */
+    uint32_t started[STAGE_COUNT];            /**<  micros() of the stages started with begin()   */
+    int next_event;                           /**<  Index in the ring buffer of the next event   */
+    int event_count;                          /**<  Events in the ring buffer   */
+    uint32_t dump_time;                       /**<  micros() of the decoded dump   */
+};
+
+/**
+* @brief  stage_name(): Name of a stage
+*
+* @param int stage: The stage.
+* @return const char*: The name, or "unknown"
+*
+**/
+const char* stage_name(int stage);
+
+#ifdef STAGE_TIMING
+
+extern StageTimer stage_timer;
+
+/**
+* @brief  StageScope: Records the time from its construction until the end of its scope
+*
+**/
+class StageScope {
+  public:
+    StageScope(Stage stage) : stage(stage), start(micros()) {};
+    ~StageScope() { stage_timer.record(stage, start, micros() - start); };
+
+  private:
+    Stage stage;
+    uint32_t start;
+};
+
+#define STAGE_CONCAT_(a, b) a##b
+#define STAGE_CONCAT(a, b) STAGE_CONCAT_(a, b)
+#define STAGE_SCOPE(stage) StageScope STAGE_CONCAT(stage_scope_, __LINE__)(stage)
+#define STAGE_BEGIN(stage) stage_timer.begin(stage)
+#define STAGE_END(stage) stage_timer.end(stage)
+
+#else
+
+#define STAGE_SCOPE(stage)
+#define STAGE_BEGIN(stage)
+#define STAGE_END(stage)
+
+#endif  // STAGE_TIMING
+
+#endif  // STAGE_TIMER_H_
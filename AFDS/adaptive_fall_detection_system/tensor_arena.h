@@ -0,0 +1,149 @@
+/**
+  *
+  *
+  * @file:    tensor_arena.h
+  * @date:    17-10-2026 07:07:41
+  *
+  * @brief    Size of the tensor arena of each fall model, and measurement of the used arena
+  *
+  *   The MicroAllocator of TensorFlow Lite Micro 1.15 places the tensor data
+  *   planned by the memory planner at the start of the arena, and the
+  *   persistent structures (runtime tensors and quantization) at the end.
+  *   While AllocateTensors() plans the tensor data, the planner uses the free
+  *   arena between them as scratch. The allocator doesn't report any of this,
+  *   so the arena is painted with a pattern before the interpreter is made,
+  *   and the painted bytes left in the middle show how much of it was used.
+  *
+**/
+
+#ifndef TENSOR_ARENA_H_
+#define TENSOR_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Tensor arena sizes of the models, printed by "arena_plan --header" on the host. arena_plan replays
+// the allocation of the Cortex-M4 library for each model: the tensor data the planner places at the
+// start of the arena, the scratch of the planning beyond it, and the persistent runtime tensors and
+// quantization at the end. The sizes add 15 bytes for the alignment of the arena and are rounded up
+// to 16 bytes. MEASURE_TENSOR_ARENA in the sketch reports the arena used on the board.
+const int FALL_MODEL_ARENA_SIZE = 992;           /**<  tensor data 336, scratch 24, persistent 604   */
+const int FALL_MODEL_2_ARENA_SIZE = 2160;        /**<  tensor data 1536, scratch 0, persistent 604   */
+const int FALL_MODEL_3_ARENA_SIZE = 1200;        /**<  tensor data 576, scratch 0, persistent 604   */
+const int FALL_MODEL_INT8_ARENA_SIZE = 1584;     /**<  tensor data 288, scratch 240, persistent 1032   */
+const int FALL_MODEL_2_INT8_ARENA_SIZE = 2592;   /**<  tensor data 1536, scratch 0, persistent 1032   */
+const int FALL_MODEL_3_INT8_ARENA_SIZE = 1632;   /**<  tensor data 576, scratch 0, persistent 1032   */
+
+// The cascade runs fall_model_f46 and fall_model_f46_2 in one arena, split between them. The input
+// of fall_model_f46 is preallocated in the cascade, so it needs less than FALL_MODEL_ARENA_SIZE.
+const int CASCADE_ARENA_SIZE = FALL_MODEL_ARENA_SIZE + FALL_MODEL_2_ARENA_SIZE;   /**<  Tensor arena of the cascade   */
+
+// The 70 KB arena of the earlier sketch, which the RAM of the board was budgeted with
+const int ARENA_BUDGET = 70 * 1024;   /**<  Largest tensor arena of the sketch   */
+static_assert(CASCADE_ARENA_SIZE <= ARENA_BUDGET, "The arenas of both cascade models have to fit in the arena budget");
+
+// The arena of the sketch, which the sketch sets for the model it runs. Can be set when building,
+// like -DTENSOR_ARENA_SIZE=FALL_MODEL_2_ARENA_SIZE.
+#ifndef TENSOR_ARENA_SIZE
+#ifdef CASCADE_MODE
+#define TENSOR_ARENA_SIZE CASCADE_ARENA_SIZE
+#else
+#define TENSOR_ARENA_SIZE FALL_MODEL_ARENA_SIZE
+#endif
+#endif
+
+// The pattern the arena is painted with before it's used
+const uint8_t ARENA_PAINT = 0xA5;
+
+/**
+* @brief  ArenaUsage: The parts of the tensor arena used by a model
+*
+**/
+struct ArenaUsage {
+  size_t tensor_data;   /**<  Bytes of the planned tensor data at the start of the arena   */
+  size_t scratch;       /**<  Bytes of the planner scratch used beyond the tensor data   */
+  size_t persistent;    /**<  Bytes of the runtime tensors and quantization at the end of the arena   */
+
+  size_t total() const {
+    return tensor_data + scratch + persistent;
+  }
+};
+
+/**
+* @brief  paint_arena(): Paint the tensor arena, before the interpreter is made
+*
+* @param uint8_t arena[]: The tensor arena.
+* @param size_t size: Size of the arena in bytes.
+* @return void
+*
+**/
+inline void paint_arena(uint8_t arena[], size_t size) {
+  memset(arena, ARENA_PAINT, size);
+}
+
+/**
+* @brief  arena_tensor_data(): The end of the tensor data in the arena, after AllocateTensors()
+*
+*   The constant tensors point into the model, so only tensors with data in the
+*   arena are counted.
+*
+* @param Interpreter& interpreter: The interpreter, a tflite::MicroInterpreter.
+* @param const uint8_t arena[]: The tensor arena of the interpreter.
+* @param size_t size: Size of the arena in bytes.
+* @return size_t: Offset of the first byte after the tensor data
+*
+**/
+template <typename Interpreter>
+size_t arena_tensor_data(Interpreter& interpreter, const uint8_t arena[], size_t size) {
+  size_t end = 0;
+  for (size_t i = 0; i < interpreter.tensors_size(); i++) {
+    auto* tensor = interpreter.tensor(i);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(tensor->data.raw);
+    if (data >= arena && data < arena + size && static_cast<size_t>(data - arena) + tensor->bytes > end) {
+      end = static_cast<size_t>(data - arena) + tensor->bytes;
+    }
+  }
+  return end;
+}
+
+/**
+* @brief  measure_arena(): Measure the used parts of a painted tensor arena
+*
+*   The longest run of painted bytes is the unused middle of the arena. Tensor
+*   data can end with the paint pattern, so the start of the arena is at least
+*   the end of the tensor data. The planner spreads its scratch over the free
+*   arena, so with a large arena some of it can be left out of the measured
+*   scratch; arena_plan on the host gives the scratch the planning needs.
+*
+* @param const uint8_t arena[]: The tensor arena, painted with paint_arena() before it was used.
+* @param size_t size: Size of the arena in bytes.
+* @param size_t tensor_data: End of the tensor data, from arena_tensor_data().
+* @return ArenaUsage: The used parts of the arena
+*
+**/
+inline ArenaUsage measure_arena(const uint8_t arena[], size_t size, size_t tensor_data) {
+  size_t gap_start = 0;
+  size_t gap_length = 0;
+  size_t run_start = 0;
+  for (size_t i = 0; i <= size; i++) {
+    if (i < size && arena[i] == ARENA_PAINT) {
+      continue;
+    }
+    if (i - run_start > gap_length) {
+      gap_start = run_start;
+      gap_length = i - run_start;
+    }
+    run_start = i + 1;
+  }
+
+  ArenaUsage usage;
+  size_t head = gap_start > tensor_data ? gap_start : tensor_data;
+  size_t gap_end = gap_start + gap_length;
+  usage.tensor_data = tensor_data;
+  usage.scratch = head - tensor_data;
+  usage.persistent = size - (gap_end > head ? gap_end : head);
+  return usage;
+}
+
+#endif  // TENSOR_ARENA_H_
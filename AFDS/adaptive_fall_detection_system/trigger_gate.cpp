@@ -0,0 +1,188 @@
+/**
+  *
+  *
+  * @file:    trigger_gate.cpp
+  * @date:    17-10-2026 07:39:47
+  *
+  * @brief    Adaptive trigger gate, and saving it on the MicroSD card
+  *
+  *
+  *
+  *
+**/
+
+#include "trigger_gate.h"
+
+#include <string.h>
+
+#include <SD.h>
+
+static const char GATE_MAGIC[4] = {'A', 'F', 'D', 'G'};
+
+// The fields are copied byte by byte, because they aren't aligned
+template <typename T>
+static void put(uint8_t* data, int offset, T value) {
+  memcpy(data + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static T get(const uint8_t* data, int offset) {
+  T value;
+  memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+TriggerGate::TriggerGate() {
+  reset();
+}
+
+void TriggerGate::reset() {
+  memset(bins, 0, sizeof(bins));
+  total = 0;
+  unsaved = 0;
+  samples = 0;
+  triggers = 0;
+  inferences = 0;
+  alarms = 0;
+  above = 0;
+  armed = true;
+  on_level = THRESHOLD;
+}
+
+void TriggerGate::learn(float magnitude) {
+  int bin = magnitude > 0 ? static_cast<int>(magnitude / GATE_BIN_WIDTH) : 0;
+  bins[bin < GATE_BINS ? bin : GATE_BINS - 1]++;
+  total++;
+  // Forget the older half, so the gate follows the wearer and the counts fit in 16 bits
+  if (total >= GATE_HISTORY) {
+    total = 0;
+    for (int b = 0; b < GATE_BINS; b++) {
+      bins[b] /= 2;
+      total += bins[b];
+    }
+  }
+}
+
+void TriggerGate::update_level() {
+  if (total < GATE_WARMUP) {
+    on_level = THRESHOLD;
+    return;
+  }
+  float level = quantile(GATE_QUANTILE) + GATE_MARGIN;
+  on_level = level < THRESHOLD ? THRESHOLD : (level > GATE_MAX_LEVEL ? GATE_MAX_LEVEL : level);
+}
+
+float TriggerGate::quantile(float q) const {
+  if (total == 0) {
+    return 0.0f;
+  }
+  float target = q * total;
+  unsigned long below = 0;
+  for (int b = 0; b < GATE_BINS; b++) {
+    if (bins[b] > 0 && below + bins[b] >= target) {
+      // The magnitudes are taken as evenly spread over the bin
+      return (b + (target - below) / bins[b]) * GATE_BIN_WIDTH;
+    }
+    below += bins[b];
+  }
+  return GATE_BINS * GATE_BIN_WIDTH;
+}
+
+bool TriggerGate::update(float magnitude) {
+  samples++;
+  unsaved++;
+  learn(magnitude);
+  update_level();
+
+  if (!armed) {
+    // The gate can open again once the magnitude has dropped below the hysteresis
+    armed = magnitude < on_level - GATE_HYSTERESIS;
+    return false;
+  }
+  if (magnitude < on_level) {
+    above = 0;
+    return false;
+  }
+  above++;
+  // A hard impact opens the gate at once
+  if (above < GATE_MIN_SAMPLES && magnitude < GATE_MAX_LEVEL) {
+    return false;
+  }
+  above = 0;
+  armed = false;
+  triggers++;
+  return true;
+}
+
+int TriggerGate::encode(uint8_t data[]) const {
+  memcpy(data, GATE_MAGIC, sizeof(GATE_MAGIC));
+  put<uint16_t>(data, 4, GATE_FILE_VERSION);
+  put<uint16_t>(data, 6, GATE_BINS);
+  put<uint32_t>(data, 8, samples);
+  put<uint32_t>(data, 12, triggers);
+  put<uint32_t>(data, 16, inferences);
+  put<uint32_t>(data, 20, alarms);
+  put<uint32_t>(data, 24, total);
+  for (int b = 0; b < GATE_BINS; b++) {
+    put<uint16_t>(data, 28 + 2 * b, bins[b]);
+  }
+  return GATE_FILE_SIZE;
+}
+
+bool TriggerGate::decode(const uint8_t* data, size_t size) {
+  if (size < static_cast<size_t>(GATE_FILE_SIZE) || memcmp(data, GATE_MAGIC, sizeof(GATE_MAGIC)) != 0 ||
+      get<uint16_t>(data, 4) != GATE_FILE_VERSION || get<uint16_t>(data, 6) != GATE_BINS) {
+    return false;
+  }
+  // The histogram has to add up to its total, otherwise the file is damaged
+  unsigned long sum = 0;
+  for (int b = 0; b < GATE_BINS; b++) {
+    sum += get<uint16_t>(data, 28 + 2 * b);
+  }
+  if (sum != get<uint32_t>(data, 24) || sum >= GATE_HISTORY) {
+    return false;
+  }
+
+  samples = get<uint32_t>(data, 8);
+  triggers = get<uint32_t>(data, 12);
+  inferences = get<uint32_t>(data, 16);
+  alarms = get<uint32_t>(data, 20);
+  total = sum;
+  for (int b = 0; b < GATE_BINS; b++) {
+    bins[b] = get<uint16_t>(data, 28 + 2 * b);
+  }
+  unsaved = 0;
+  above = 0;
+  armed = true;
+  update_level();
+  return true;
+}
+
+bool TriggerGate::save(const char* name) {
+  uint8_t data[GATE_FILE_SIZE];
+  int size = encode(data);
+  if (SD.exists(name)) {
+    SD.remove(name);
+  }
+  File file = SD.open(name, FILE_WRITE);
+  if (!file) {
+    return false;
+  }
+  bool written = file.write(data, size) == static_cast<size_t>(size);
+  file.close();
+  if (written) {
+    unsaved = 0;
+  }
+  return written;
+}
+
+bool TriggerGate::load(const char* name) {
+  File file = SD.open(name);
+  if (!file) {
+    return false;
+  }
+  uint8_t data[GATE_FILE_SIZE];
+  int size = file.read(data, GATE_FILE_SIZE);
+  file.close();
+  return size > 0 && decode(data, size);
+}
@@ -0,0 +1,168 @@
+/**
+  *
+  *
+  * @file:    trigger_gate.h
+  * @date:    17-10-2026 07:39:47
+  *
+  * @brief    Adaptive trigger gate, which sets the threshold from the magnitudes of the wearer
+  *
+  *   The fixed THRESHOLD is exceeded many times a day by an active wearer, and
+  *   every time a signal is recorded and run through the model. The gate
+  *   learns a histogram of the signal vector magnitudes of the wearer, and
+  *   only opens when the magnitude is above the GATE_QUANTILE of the wearer
+  *   plus GATE_MARGIN for GATE_MIN_SAMPLES samples in a row. The level is never
+  *   below THRESHOLD, and a single sample above GATE_MAX_LEVEL always opens the
+  *   gate, so hard impacts are classified like without the gate.
+  *
+  *   The histogram and the counters are saved on the MicroSD card, so the gate
+  *   doesn't have to learn the wearer again after a reboot.
+  *
+  *   Gate file:
+  *   | Offset | Type       | Content                                      |
+  *   |--------|------------|----------------------------------------------|
+  *   | 0      | char[4]    | "AFDG"                                       |
+  *   | 4      | uint16     | Format version (GATE_FILE_VERSION)           |
+  *   | 6      | uint16     | Amount of bins (GATE_BINS)                   |
+  *   | 8      | uint32     | Samples seen                                 |
+  *   | 12     | uint32     | Times the gate opened                        |
+  *   | 16     | uint32     | Inferences                                   |
+  *   | 20     | uint32     | Falls predicted                              |
+  *   | 24     | uint32     | Samples in the histogram                     |
+  *   | 28     | uint16[]   | Count of every bin                           |
+  *
+**/
+
+#ifndef TRIGGER_GATE_H_
+#define TRIGGER_GATE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constants.h"
+
+const int GATE_BINS = 64;                   /**<  Bins of the magnitude histogram   */
+const float GATE_BIN_WIDTH = 0.0625f;       /**<  Width of a bin in g's, the last bin holds everything above 4 g   */
+const uint16_t GATE_FILE_VERSION = 1;       /**<  Version of the gate file format   */
+const int GATE_FILE_SIZE = 28 + 2 * GATE_BINS;  /**<  Size of the gate file in bytes   */
+const char GATE_FILE_NAME[] = "GATE.dat";       /**<  Name of the gate file on the MicroSD card   */
+
+/**
+* @brief  TriggerGate: Threshold learned from the signal vector magnitudes of the wearer
+*
+**/
+class TriggerGate {
+  public:
+    unsigned long samples = 0;      /**<  Samples seen by the gate   */
+    unsigned long triggers = 0;     /**<  Times the gate opened, and a signal was recorded   */
+    unsigned long inferences = 0;   /**<  Signals classified by the model   */
+    unsigned long alarms = 0;       /**<  Signals predicted as a fall   */
+
+    TriggerGate();
+
+    /**
+    * @brief  reset(): Forget the learned magnitudes and the counters
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  update(): Learn the magnitude of a sample, and check if it opens the gate
+    *
+    *   After the gate has opened, it is closed until the magnitude has been
+    *   GATE_HYSTERESIS below the level, so one impact only opens it once.
+    *
+    * @param float magnitude: The signal vector magnitude of the sample in g's.
+    * @return bool: true when the gate opens, and the signal has to be recorded
+    *
+    **/
+    bool update(float magnitude);
+
+    /**
+    * @brief  quantile(): The magnitude below which the part q of the learned magnitudes is
+    *
+    * @param float q: The quantile, 0 to 1.
+    * @return float: The magnitude in g's, interpolated within its bin
+    *
+    **/
+    float quantile(float q) const;
+
+    /**
+    * @brief  level(): The magnitude that opens the gate
+    *
+    * @param none
+    * @return float: THRESHOLD until GATE_WARMUP samples are learned, then the learned level in g's
+    *
+    **/
+    float level() const { return on_level; };
+
+    /**
+    * @brief  learned(): Samples in the histogram
+    *
+    * @param none
+    * @return unsigned long: The samples, halved every time GATE_HISTORY is reached
+    *
+    **/
+    unsigned long learned() const { return total; };
+
+    /**
+    * @brief  encode(): Encode the histogram and the counters as a gate file
+    *
+    * @param uint8_t data[]: Array of GATE_FILE_SIZE bytes where the gate file is stored.
+    * @return int: The size of the gate file, GATE_FILE_SIZE.
+    *
+    **/
+    int encode(uint8_t data[]) const;
+
+    /**
+    * @brief  decode(): Restore the histogram and the counters from a gate file
+    *
+    * @param const uint8_t* data: The gate file.
+    * @param size_t size: Size of the gate file in bytes.
+    * @return bool: true when the gate file is valid, otherwise the gate is unchanged
+    *
+    **/
+    bool decode(const uint8_t* data, size_t size);
+
+    /**
+    * @brief  save(): Save the gate on the MicroSD card
+    *
+    * @param const char* name: Name of the gate file.
+    * @return bool: true when the whole gate file is written
+    *
+    **/
+    bool save(const char* name);
+
+    /**
+    * @brief  load(): Load the gate from the MicroSD card
+    *
+    * @param const char* name: Name of the gate file.
+    * @return bool: true when the gate file is read and valid
+    *
+    **/
+    bool load(const char* name);
+
+    /**
+    * @brief  save_due(): Check if GATE_SAVE_INTERVAL samples have been seen since the last save
+    *
+    * @param none
+    * @return bool: true when the gate should be saved
+    *
+    **/
+    bool save_due() const { return unsaved >= GATE_SAVE_INTERVAL; };
+
+  private:
+    uint16_t bins[GATE_BINS];       /**<  Count of the learned magnitudes of every bin   */
+    unsigned long total;            /**<  Samples in the histogram   */
+    unsigned long unsaved;          /**<  Samples seen since the last save   */
+    float on_level;                 /**<  Magnitude that opens the gate   */
+    int above;                      /**<  Samples in a row at or above the level   */
+    bool armed;                     /**<  false after the gate opened, until the magnitude falls below the hysteresis   */
+
+    void learn(float magnitude);
+    void update_level();
+};
+
+#endif  // TRIGGER_GATE_H_
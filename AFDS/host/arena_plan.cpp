@@ -0,0 +1,187 @@
+/**
+  *
+  *
+  * @file:    arena_plan.cpp
+  * @date:    17-10-2026 10:12:48
+  *
+  * @brief    The tensor arena a fall model needs on the Cortex-M4, worked out from its flatbuffer
+  *
+  *
+  *
+  *
+**/
+
+#include "arena_plan.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+size_t type_size(tflite::TensorType type) {
+  switch (type) {
+    case tflite::TensorType_INT64:
+      return 8;
+    case tflite::TensorType_FLOAT32:
+    case tflite::TensorType_INT32:
+      return 4;
+    case tflite::TensorType_INT16:
+      return 2;
+    case tflite::TensorType_INT8:
+    case tflite::TensorType_UINT8:
+    case tflite::TensorType_BOOL:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+size_t align_up(size_t size, size_t alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+// A buffer of the plan, with the operators it's used by
+struct PlannedBuffer {
+  int size;
+  int first_time_used;
+  int last_time_used;
+  int offset;
+};
+
+// The GreedyMemoryPlanner: the buffers are placed largest first, in the first gap between the placed
+// buffers used at the same time that is large enough, or after the last of them. Returns the end of
+// the last buffer.
+int greedy_plan(std::vector<PlannedBuffer>& buffers) {
+  // The planner sorts the buffers with a bubble sort, so buffers of the same size keep their order
+  std::vector<int> order;
+  for (size_t i = 0; i < buffers.size(); i++) {
+    order.push_back(static_cast<int>(i));
+  }
+  bool swapped = true;
+  while (swapped) {
+    swapped = false;
+    for (size_t i = 1; i < order.size(); i++) {
+      if (buffers[order[i - 1]].size < buffers[order[i]].size) {
+        std::swap(order[i - 1], order[i]);
+        swapped = true;
+      }
+    }
+  }
+
+  // The placed buffers, ordered by their offset
+  std::vector<int> placed;
+  int end = 0;
+  for (int id : order) {
+    PlannedBuffer& wanted = buffers[id];
+    int candidate_offset = 0;
+    for (size_t p = 0; p < placed.size(); p++) {
+      const PlannedBuffer& other = buffers[placed[p]];
+      if (other.first_time_used > wanted.last_time_used || wanted.first_time_used > other.last_time_used) {
+        continue;
+      }
+      if (other.offset - candidate_offset >= wanted.size) {
+        break;
+      }
+      if (other.offset + other.size > candidate_offset) {
+        candidate_offset = other.offset + other.size;
+      }
+    }
+    wanted.offset = candidate_offset;
+    // A buffer goes after the placed buffers with the same offset
+    size_t insert = 0;
+    while (insert < placed.size() && buffers[placed[insert]].offset <= candidate_offset) {
+      insert++;
+    }
+    placed.insert(placed.begin() + insert, id);
+    if (wanted.offset + wanted.size > end) {
+      end = wanted.offset + wanted.size;
+    }
+  }
+  return end;
+}
+
+}  // namespace
+
+bool plan_arena(const unsigned char* data, bool preallocated_input, ArenaUsage& usage) {
+  const tflite::Model* model = tflite::GetModel(data);
+  if (model->subgraphs() == nullptr || model->subgraphs()->size() != 1) {
+    return false;
+  }
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  const auto* tensors = subgraph->tensors();
+  const auto* operators = subgraph->operators();
+  if (tensors == nullptr || operators == nullptr || subgraph->inputs() == nullptr ||
+      subgraph->outputs() == nullptr) {
+    return false;
+  }
+  const int tensor_count = static_cast<int>(tensors->size());
+  const int operator_count = static_cast<int>(operators->size());
+
+  // The persistent structures of InitializeRuntimeTensor()
+  usage.persistent = tensor_count * M4_TENSOR_BYTES;
+  for (const tflite::Tensor* tensor : *tensors) {
+    if (tensor->shape() == nullptr) {
+      return false;
+    }
+    usage.persistent += (tensor->shape()->size() + 1) * sizeof(int32_t);
+    const tflite::QuantizationParameters* quantization = tensor->quantization();
+    if (quantization != nullptr && quantization->scale() != nullptr && quantization->scale()->size() > 0 &&
+        quantization->zero_point() != nullptr && quantization->zero_point()->size() > 0) {
+      size_t channels = quantization->scale()->size();
+      usage.persistent += M4_QUANTIZATION_BYTES + 2 * (channels + 1) * sizeof(int32_t);
+    }
+  }
+
+  // The lifetimes of AllocateTensors(), the operators a tensor is made and used by
+  std::vector<int> first_created(tensor_count, -1);
+  std::vector<int> last_used(tensor_count, -1);
+  std::vector<bool> preallocated(tensor_count, false);
+  for (int32_t index : *subgraph->inputs()) {
+    first_created[index] = 0;
+    preallocated[index] = preallocated_input;
+  }
+  for (int32_t index : *subgraph->outputs()) {
+    last_used[index] = operator_count - 1;
+  }
+  for (int i = operator_count - 1; i >= 0; i--) {
+    const tflite::Operator* op = operators->Get(i);
+    for (int32_t index : *op->inputs()) {
+      if (last_used[index] == -1 || last_used[index] < i) {
+        last_used[index] = i;
+      }
+    }
+    for (int32_t index : *op->outputs()) {
+      if (first_created[index] == -1 || first_created[index] > i) {
+        first_created[index] = i;
+      }
+    }
+  }
+
+  // Every tensor that isn't read only, or given to the interpreter, is planned
+  std::vector<PlannedBuffer> buffers;
+  for (int i = 0; i < tensor_count; i++) {
+    bool read_only = first_created[i] == -1 && last_used[i] != -1;
+    if (read_only || preallocated[i]) {
+      continue;
+    }
+    if (first_created[i] == -1 || last_used[i] == -1) {
+      return false;
+    }
+    const tflite::Tensor* tensor = tensors->Get(i);
+    size_t bytes = type_size(tensor->type());
+    for (int32_t dim : *tensor->shape()) {
+      bytes *= dim;
+    }
+    if (bytes == 0) {
+      return false;
+    }
+    buffers.push_back({static_cast<int>(align_up(bytes, M4_BUFFER_ALIGNMENT)), first_created[i], last_used[i], 0});
+  }
+
+  usage.tensor_data = greedy_plan(buffers);
+  size_t planning = tensor_count * M4_TENSOR_INFO_BYTES + buffers.size() * M4_PLANNER_BUFFER_BYTES;
+  usage.scratch = planning > usage.tensor_data ? planning - usage.tensor_data : 0;
+  return true;
+}
@@ -0,0 +1,59 @@
+/**
+  *
+  *
+  * @file:    arena_plan.h
+  * @date:    17-10-2026 10:12:48
+  *
+  * @brief    The tensor arena a fall model needs on the Cortex-M4, worked out from its flatbuffer
+  *
+  *   Follows the allocation of the TensorFlow Lite Micro 1.15 library for the
+  *   Cortex-M4 in AFDS/src/cortex-m4:
+  *
+  *     - The MicroAllocator takes the TfLiteTensor array from the end of the
+  *       arena, and for every tensor a copy of its dims, and for every
+  *       quantized tensor a TfLiteAffineQuantization with its scale and zero
+  *       point arrays. This is the persistent part.
+  *     - AllocateTensors() takes a TensorInfo for every tensor below it, and
+  *       gives the rest of the arena to the GreedyMemoryPlanner, which needs 36
+  *       bytes for every buffer it plans. Both are freed after the planning.
+  *     - The planner places the input, intermediate and output tensors, 16 byte
+  *       aligned, at the start of the arena.
+  *
+  *   The nodes and the operator data are on the stack while Invoke() runs, so
+  *   they don't take any arena. The structure sizes are the 32 bit sizes of
+  *   the library, and only the flatbuffer schema is needed, not the
+  *   TensorFlow Lite sources.
+  *
+**/
+
+#ifndef HOST_ARENA_PLAN_H_
+#define HOST_ARENA_PLAN_H_
+
+#include <stddef.h>
+
+#include "tensor_arena.h"
+
+// Sizes of the structures in the Cortex-M4 library
+const size_t M4_TENSOR_BYTES = 56;            /**<  TfLiteTensor   */
+const size_t M4_QUANTIZATION_BYTES = 12;      /**<  TfLiteAffineQuantization   */
+const size_t M4_TENSOR_INFO_BYTES = 20;       /**<  TensorInfo of AllocateTensors()   */
+const size_t M4_PLANNER_BUFFER_BYTES = 36;    /**<  Scratch of the GreedyMemoryPlanner for every buffer   */
+const size_t M4_BUFFER_ALIGNMENT = 16;        /**<  Alignment of the planned tensor data   */
+
+/**
+* @brief  plan_arena(): The parts of the tensor arena a model needs on the Cortex-M4
+*
+*   The arena has to hold the tensor data, or the scratch of the planning if it
+*   is larger, and the persistent structures. scratch is how much the planning
+*   needs beyond the tensor data, so total() is the smallest arena
+*   AllocateTensors() succeeds with, when the arena is 16 byte aligned.
+*
+* @param const unsigned char* data: The flatbuffer of the model.
+* @param bool preallocated_input: true if the input is given with RegisterPreallocatedInput(), so it isn't planned.
+* @param ArenaUsage& usage: The tensor data, planner scratch and persistent bytes of the model.
+* @return bool: true if the model could be read
+*
+**/
+bool plan_arena(const unsigned char* data, bool preallocated_input, ArenaUsage& usage);
+
+#endif  // HOST_ARENA_PLAN_H_
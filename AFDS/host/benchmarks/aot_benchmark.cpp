@@ -0,0 +1,117 @@
+/**
+  *
+  *
+  * @file:    aot_benchmark.cpp
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    Host benchmark of the fall models compiled ahead of time against the interpreter kernels
+  *
+  *   Runs every float model with infer() of its aot header, and with the
+  *   reference kernels Invoke() runs, and reports the time per inference, the
+  *   RAM each needs and the flash of the weights against the flatbuffer. The
+  *   RAM of the interpreter is the tensor arena arena_plan plans for the
+  *   Cortex-M4, without the margin for its alignment. The
+  *   kernels are run without the interpreter, so their time is the least
+  *   Invoke() can take; afds_compare reports Invoke() itself.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+#include "constants.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_aot.h"
+#include "fall_model_f46_2_aot.h"
+#include "fall_model_f46_3_aot.h"
+#include "arena_plan.h"
+#include "model_quantizer.h"
+
+// Amount of inferences of every model
+const int INFERENCES = 20000;
+
+static float features[16][FEATURE_AMOUNT];
+
+static void fully_connected(const DenseLayer& layer, const float* input, float* output) {
+  tflite::FullyConnectedParams params;
+  params.float_activation_min = -INFINITY;
+  params.float_activation_max = INFINITY;
+  tflite::reference_ops::FullyConnected(params, tflite::RuntimeShape({1, layer.inputs}), input,
+                                        tflite::RuntimeShape({layer.outputs, layer.inputs}), layer.weights.data(),
+                                        tflite::RuntimeShape({layer.outputs}), layer.bias.data(),
+                                        tflite::RuntimeShape({1, layer.outputs}), output);
+}
+
+static void run_kernels(const DenseModel& model, const float* input, float output[2]) {
+  float hidden[256];
+  float logits[2];
+  fully_connected(model.hidden, input, hidden);
+  if (model.tanh) {
+    for (int i = 0; i < model.hidden.outputs; i++) {
+      hidden[i] = std::tanh(hidden[i]);
+    }
+  } else {
+    tflite::RuntimeShape shape({1, model.hidden.outputs});
+    tflite::reference_ops::Logistic(shape, hidden, shape, hidden);
+  }
+  fully_connected(model.output, hidden, logits);
+  tflite::reference_ops::Softmax(logits, 2, 1, 1.0f, output);
+}
+
+template <typename Infer>
+static double bench(Infer infer, float* checksum) {
+  float output[2];
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < INFERENCES; n++) {
+    infer(features[n % 16], output);
+    *checksum += output[1];
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / INFERENCES;
+}
+
+template <typename Infer>
+static void compare(const char* name, const unsigned char* data, int len, int hidden, Infer infer) {
+  DenseModel model;
+  ArenaUsage arena;
+  if (!model.read(data) || !plan_arena(data, false, arena)) {
+    printf("%-8s can't be read\n", name);
+    return;
+  }
+  float aot_checksum = 0;
+  float kernel_checksum = 0;
+  double aot_us = bench(infer, &aot_checksum);
+  double kernel_us = bench([&](const float* in, float* out) { run_kernels(model, in, out); }, &kernel_checksum);
+  size_t weights = (model.hidden.weights.size() + model.hidden.bias.size() + model.output.weights.size() +
+                    model.output.bias.size()) * sizeof(float);
+  // infer() only keeps the hidden layer and the logits, on the stack
+  size_t stack = (hidden + 2) * sizeof(float);
+  printf("%-8s %12.3f %12.3f %8.1fx %10zu %10zu %12zu %12d %s\n", name, kernel_us, aot_us, kernel_us / aot_us,
+         stack, arena.total(), weights, len, aot_checksum == kernel_checksum ? "same" : "DIFFERENT");
+}
+
+int main() {
+  for (int n = 0; n < 16; n++) {
+    for (int f = 0; f < FEATURE_AMOUNT; f++) {
+      features[n][f] = ((n * 397 + f * 1051) % 2000 - 1000) / 500.0f;
+    }
+  }
+
+  printf("Running every model %d times\n", INFERENCES);
+  printf("%-8s %12s %12s %9s %10s %10s %12s %12s %s\n", "model", "kernels [us]", "aot [us]", "speedup",
+         "stack [B]", "arena [B]", "weights [B]", "model [B]", "outputs");
+  compare("f46", fall_model_data, fall_model_data_len, fall_model_f46_aot::kHidden, fall_model_f46_aot::infer);
+  compare("f46_2", fall_model_2_data, fall_model_2_data_len, fall_model_f46_2_aot::kHidden,
+          fall_model_f46_2_aot::infer);
+  compare("f46_3", fall_model_3_data, fall_model_3_data_len, fall_model_f46_3_aot::kHidden,
+          fall_model_f46_3_aot::infer);
+  return 0;
+}
@@ -0,0 +1,125 @@
+/**
+  *
+  *
+  * @file:    continuous_benchmark.cpp
+  * @date:    17-10-2026 07:26:46
+  *
+  * @brief    Host benchmark of the continuous mode for a range of hops
+  *
+  *   Streams raw samples through the overlapping signals and classifies every
+  *   completed signal with fall_model_f46 compiled ahead of time, and fills a
+  *   ContinuousBudget with the measured times at the 14.9 Hz of the IMU. The
+  *   signals are also compared with recalculating the features of the ring
+  *   buffers at every hop, which costs the same per second but all of it in
+  *   the sample completing the signal.
+  *
+  *   The times are those of the workstation. The sketch reports the same budget
+  *   measured on the board when it is built with CONTINUOUS_MODE.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+
+#include "constants.h"
+#include "continuous_windows.h"
+#include "fall_model_f46_aot.h"
+#include "feature_calculation.h"
+#include "signal_buffer.h"
+
+// Amount of samples streamed for every hop
+const int SAMPLES = 200000;
+
+const float SAMPLE_RATE = 14.9f;
+const float ACCEL_RES = 0.000732f;
+const float GYRO_RES = 0.07f;
+
+static int16_t raw[1024][6];
+
+typedef std::chrono::steady_clock Clock;
+
+static unsigned long elapsed_ns(Clock::time_point start) {
+  return static_cast<unsigned long>(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+}
+
+// The budget is filled in ns, so the us of the board are ns here and the results are scaled back
+static ContinuousBudget bench_windows(int hop, float* checksum) {
+  static ContinuousWindows windows;
+  windows = ContinuousWindows(hop);
+  ContinuousBudget budget(SAMPLE_RATE, windows.hop());
+  float features[FEATURE_AMOUNT];
+  float prediction[2];
+  for (int n = 0; n < SAMPLES; n++) {
+    const int16_t* s = raw[n % 1024];
+    Clock::time_point start = Clock::now();
+    bool ready = windows.add_sample(s[0], s[1], s[2], s[3], s[4], s[5]);
+    budget.add_sample(elapsed_ns(start));
+    if (ready) {
+      start = Clock::now();
+      windows.calc_features(features, ACCEL_RES, GYRO_RES);
+      fall_model_f46_aot::infer(features, prediction);
+      budget.add_window(elapsed_ns(start));
+      *checksum += prediction[1];
+    }
+  }
+  return budget;
+}
+
+// Recalculating the features of the ring buffers every hop, the longest sample is the one completing a signal
+static ContinuousBudget bench_recalculate(int hop, float* checksum) {
+  RawSignalBuffer signals[6];
+  ContinuousBudget budget(SAMPLE_RATE, hop);
+  float features[FEATURE_AMOUNT];
+  float prediction[2];
+  for (int n = 0; n < SAMPLES; n++) {
+    const int16_t* s = raw[n % 1024];
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < 6; i++) {
+      signals[i].push(s[i]);
+    }
+    budget.add_sample(elapsed_ns(start));
+    if (n + 1 >= SIGNAL_SIZE && (n + 1 - SIGNAL_SIZE) % hop == 0) {
+      start = Clock::now();
+      feature_calc(features, signals[0], signals[1], signals[2], signals[3], signals[4], signals[5],
+                   ACCEL_RES, GYRO_RES);
+      fall_model_f46_aot::infer(features, prediction);
+      budget.add_window(elapsed_ns(start));
+      *checksum += prediction[1];
+    }
+  }
+  return budget;
+}
+
+int main() {
+  // The wearer walking, with a spike now and then
+  for (int i = 0; i < 1024; i++) {
+    raw[i][0] = static_cast<int16_t>((i * 37) % 400 - 200);
+    raw[i][1] = static_cast<int16_t>((i * 53) % 300 - 150);
+    raw[i][2] = static_cast<int16_t>(1366 + (i * 29) % 200 + (i % 97 == 0 ? 3000 : 0));
+    raw[i][3] = static_cast<int16_t>((i * 71) % 1000 - 500);
+    raw[i][4] = static_cast<int16_t>((i * 13) % 600 - 300);
+    raw[i][5] = static_cast<int16_t>((i * 7) % 800 - 400);
+  }
+
+  printf("Streaming %d samples at %.1f Hz, signals of %d samples, ContinuousWindows is %zu bytes\n", SAMPLES,
+         SAMPLE_RATE, SIGNAL_SIZE, sizeof(ContinuousWindows));
+  printf("%4s %8s %12s %12s %14s %12s %12s %16s\n", "hop", "windows", "sample [ns]", "signal [ns]",
+         "duty [ppm]", "latency [ms]", "recalc [ns]", "recalc duty [ppm]");
+  const int hops[] = {5, 10, 15, 30, 60, 120};
+  float checksum = 0;
+  float recalc_checksum = 0;
+  for (int hop : hops) {
+    ContinuousBudget continuous = bench_windows(hop, &checksum);
+    ContinuousBudget recalc = bench_recalculate(hop, &recalc_checksum);
+    // The budget was filled in ns, so its duty cycle is in thousandths of the real one
+    printf("%4d %8d %12.1f %12.1f %14.3f %12.1f %12.1f %16.3f\n", hop, ContinuousWindows(hop).windows(),
+           static_cast<double>(continuous.sample_us) / continuous.samples,
+           static_cast<double>(continuous.window_us) / continuous.windows, continuous.duty_cycle() * 1e3,
+           hop * 1000.0f / SAMPLE_RATE + continuous.max_window_us / 1e6f,
+           static_cast<double>(recalc.window_us) / recalc.windows, recalc.duty_cycle() * 1e3);
+  }
+  printf("Predictions %s\n", checksum == recalc_checksum ? "same" : "DIFFERENT");
+  return 0;
+}
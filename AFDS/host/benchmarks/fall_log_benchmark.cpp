@@ -0,0 +1,108 @@
+/**
+  *
+  *
+  * @file:    fall_log_benchmark.cpp
+  * @date:    17-10-2026 06:47:17
+  *
+  * @brief    Host benchmark of saving a fall signal as CSV against saving it as a binary fall log
+  *
+  *   Saves the same signal with datalogger::writeSignalValues() and with
+  *   datalogger::writeSignalLog() on the simulated MicroSD card, and reports the
+  *   time, the size of the file and the amount of heap allocations of every save.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <SD.h>
+
+#include "constants.h"
+#include "datalogger.h"
+#include "fall_log.h"
+#include "signal_buffer.h"
+
+// Amount of times every signal is saved
+const int SAVES = 2000;
+
+// Heap allocations, counted by the replaced operator new
+static long allocations = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  void* ptr = malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+struct Result {
+  double us;
+  long size;
+  long allocations;
+};
+
+template <typename Save>
+static Result bench(const char* name, Save save) {
+  long start_allocations = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < SAVES; i++) {
+    save();
+  }
+  auto end = std::chrono::steady_clock::now();
+  Result result;
+  result.us = std::chrono::duration<double, std::micro>(end - start).count() / SAVES;
+  result.allocations = (allocations - start_allocations) / SAVES;
+  File file = SD.open(name, FILE_READ);
+  result.size = file ? static_cast<long>(file.size()) : -1;
+  file.close();
+  return result;
+}
+
+int main() {
+  static SignalBuffer sig[FALL_LOG_CHANNELS];
+  const FallLogInfo info = {14.9f, 0.000732f, 0.07f, FIRMWARE_VERSION, 1};
+  for (int n = 0; n < SIGNAL_SIZE; n++) {
+    for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+      float resolution = c < 3 ? info.accel_resolution : info.gyro_resolution;
+      sig[c].push(((n * 397 + c * 1051) % 20000 - 10000) * resolution);
+    }
+  }
+  if (!SD.begin(CS)) {
+    printf("Can't use the simulated MicroSD card\n");
+    return 1;
+  }
+
+  datalogger logger;
+  char csv_name[] = "BENCH.csv";
+  char log_name[] = "BENCH.afl";
+  Result csv = bench(csv_name, [&]() {
+    logger.writeSignalValues(CS, csv_name, sig[0], sig[1], sig[2], sig[3], sig[4], sig[5], true);
+  });
+  Result log = bench(log_name, [&]() {
+    logger.writeSignalLog(CS, log_name, info, sig[0], sig[1], sig[2], sig[3], sig[4], sig[5], true);
+  });
+
+  printf("Saving a signal of %d samples, %d times\n", SIGNAL_SIZE, SAVES);
+  printf("%-18s %12s %12s %14s\n", "format", "time [us]", "size [B]", "allocations");
+  printf("%-18s %12.1f %12ld %14ld\n", "CSV", csv.us, csv.size, csv.allocations);
+  printf("%-18s %12.1f %12ld %14ld\n", "binary fall log", log.us, log.size, log.allocations);
+  printf("Binary fall log: %.1fx faster, %.1fx smaller\n", csv.us / log.us,
+         static_cast<double>(csv.size) / log.size);
+  SD.remove(csv_name);
+  SD.remove(log_name);
+  return 0;
+}
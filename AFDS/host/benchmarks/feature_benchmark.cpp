@@ -0,0 +1,87 @@
+/**
+  *
+  *
+  * @file:    feature_benchmark.cpp
+  * @date:    17-10-2026 06:58:13
+  *
+  * @brief    Host benchmark of the float feature extraction against the integer extraction on raw IMU values
+  *
+  *   Runs a signal through the FeatureExtractor, converting every raw sample
+  *   to g's and degrees per second first like the sketch used to, and through
+  *   the RawFeatureExtractor, and reports the time per sample and the memory of
+  *   the six signal buffers of the controller.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+
+#include "constants.h"
+#include "feature_calculation.h"
+#include "signal_buffer.h"
+
+// Amount of signals run through each extractor
+const int SIGNALS = 20000;
+
+const float ACCEL_RES = 0.000732f;
+const float GYRO_RES = 0.07f;
+
+static int16_t raw[SIGNAL_SIZE][6];
+
+static double bench_float(float* checksum) {
+  float features[FEATURE_AMOUNT];
+  FeatureExtractor extractor;
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < SIGNALS; n++) {
+    extractor.reset();
+    for (int i = 0; i < SIGNAL_SIZE; i++) {
+      extractor.add_sample(raw[i][0] * ACCEL_RES, raw[i][1] * ACCEL_RES, raw[i][2] * ACCEL_RES,
+                           raw[i][3] * GYRO_RES, raw[i][4] * GYRO_RES, raw[i][5] * GYRO_RES);
+    }
+    extractor.calc_features(features);
+    *checksum += features[n % FEATURE_AMOUNT];
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / (SIGNALS * SIGNAL_SIZE);
+}
+
+static double bench_raw(float* checksum) {
+  float features[FEATURE_AMOUNT];
+  RawFeatureExtractor extractor;
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < SIGNALS; n++) {
+    extractor.reset();
+    for (int i = 0; i < SIGNAL_SIZE; i++) {
+      extractor.add_sample(raw[i][0], raw[i][1], raw[i][2], raw[i][3], raw[i][4], raw[i][5]);
+    }
+    extractor.calc_features(features, ACCEL_RES, GYRO_RES);
+    *checksum += features[n % FEATURE_AMOUNT];
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / (SIGNALS * SIGNAL_SIZE);
+}
+
+int main() {
+  // A wearer lying still with some noise, and a fall in the middle of the signal
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    for (int c = 0; c < 6; c++) {
+      raw[i][c] = static_cast<int16_t>((i * 397 + c * 1051) % 200 - 100);
+    }
+    raw[i][2] += 1366;
+  }
+  raw[SIGNAL_SIZE / 2][2] = 4000;
+  raw[SIGNAL_SIZE / 2][3] = 3500;
+
+  // The checksum makes sure the compiler can't remove the extraction
+  float checksum = 0;
+  double float_ns = bench_float(&checksum);
+  double raw_ns = bench_raw(&checksum);
+  printf("Feature extraction of %d signals of %d samples\n", SIGNALS, SIGNAL_SIZE);
+  printf("%-10s %16s %20s\n", "extractor", "ns/sample", "signal buffers [B]");
+  printf("%-10s %16.1f %20zu\n", "float", float_ns, 6 * sizeof(SignalBuffer));
+  printf("%-10s %16.1f %20zu\n", "raw int16", raw_ns, 6 * sizeof(RawSignalBuffer));
+  printf("checksum: %f\n", checksum);
+  return 0;
+}
@@ -0,0 +1,114 @@
+/**
+  *
+  *
+  * @file:    fully_connected_benchmark.cpp
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    Host benchmark of the vectorized fully connected kernel on the layers of the fall models
+  *
+  *   Runs every layer shape of the fall models with the reference kernel of
+  *   TensorFlow Lite and with every version of fully_connected_kernel.h the
+  *   CPU supports, for one signal and for a batch of signals, and reports the
+  *   time of every layer.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "fully_connected_kernel.h"
+
+// Amount of multiply-adds every layer is run for, so every shape runs about as long
+const long WORK = 50000000;
+
+struct Layer {
+  const char* model;
+  int depth;
+  int outputs;
+};
+
+const Layer LAYERS[] = {
+  {"f46", 46, 33}, {"f46", 33, 2},
+  {"f46_2", 46, 192}, {"f46_2", 192, 2},
+  {"f46_3", 46, 69}, {"f46_3", 69, 2},
+};
+
+const int BATCHES[] = {1, 64};
+
+template <typename Run>
+static double bench(long runs, Run run) {
+  auto start = std::chrono::steady_clock::now();
+  for (long r = 0; r < runs; r++) {
+    run();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / runs;
+}
+
+int main() {
+  const FcIsa isas[] = {FC_SCALAR, FC_SSE, FC_AVX2};
+  printf("Best kernel on this CPU: %s\n", fc_isa_name(fc_best_isa()));
+  printf("%-6s %-10s %6s %14s", "model", "layer", "batch", "reference [us]");
+  for (FcIsa isa : isas) {
+    printf(" %10s [us]", fc_isa_name(isa));
+  }
+  printf(" %9s\n", "speedup");
+
+  // The outputs are stored here, so the runs aren't optimized away
+  volatile float sink = 0;
+  for (const Layer& layer : LAYERS) {
+    for (int batches : BATCHES) {
+      std::vector<float> input(batches * layer.depth);
+      std::vector<float> weights(layer.outputs * layer.depth);
+      std::vector<float> bias(layer.outputs, 0.1f);
+      std::vector<float> output(batches * layer.outputs);
+      for (size_t i = 0; i < input.size(); i++) {
+        input[i] = ((i * 397) % 2000 - 1000) / 500.0f;
+      }
+      for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = ((i * 1051) % 2000 - 1000) / 1000.0f;
+      }
+      long runs = WORK / (static_cast<long>(batches) * layer.depth * layer.outputs);
+
+      tflite::FullyConnectedParams params;
+      params.float_activation_min = -INFINITY;
+      params.float_activation_max = INFINITY;
+      tflite::RuntimeShape input_shape({batches, layer.depth});
+      tflite::RuntimeShape weights_shape({layer.outputs, layer.depth});
+      tflite::RuntimeShape bias_shape({layer.outputs});
+      tflite::RuntimeShape output_shape({batches, layer.outputs});
+      double reference_us = bench(runs, [&]() {
+        tflite::reference_ops::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                                              bias_shape, bias.data(), output_shape, output.data());
+        sink = output[0];
+      });
+
+      char name[16];
+      snprintf(name, sizeof(name), "%dx%d", layer.depth, layer.outputs);
+      printf("%-6s %-10s %6d %14.3f", layer.model, name, batches, reference_us);
+      double best_us = reference_us;
+      FcShape shape = {batches, layer.depth, layer.outputs, -INFINITY, INFINITY};
+      for (FcIsa isa : isas) {
+        if (!fc_isa_supported(isa)) {
+          printf(" %15s", "-");
+          continue;
+        }
+        double us = bench(runs, [&]() {
+          fully_connected(isa, shape, input.data(), weights.data(), bias.data(), output.data());
+          sink = output[0];
+        });
+        if (isa == fc_best_isa()) {
+          best_us = us;
+        }
+        printf(" %15.3f", us);
+      }
+      printf(" %8.1fx\n", reference_us / best_us);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+/**
+  *
+  *
+  * @file:    nmea_benchmark.cpp
+  * @date:    17-10-2026 07:55:32
+  *
+  * @brief    Host benchmark of the incremental NMEA parser against TinyGPS++
+  *
+  *   Feeds the same NMEA stream through NMEAParser::encode() and
+  *   TinyGPSPlus::encode() and reports the characters parsed per second by
+  *   each. The stream is an hour of the simulated GPS output, or the NMEA log
+  *   given as argument, like a capture of the serial port of the GPS.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include <Arduino.h>
+
+#include "NMEAParser.h"
+#include "TinyGPS++.h"
+#include "nmea_sim.h"
+
+// Amount of times the stream is parsed
+const int PASSES = 20;
+
+struct Result {
+  double chars_per_second;
+  uint32_t sentences;
+  uint32_t failed;
+};
+
+template <typename Parser>
+static Result bench(const std::string& log) {
+  Result result = {0, 0, 0};
+  uint32_t sentences = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < PASSES; pass++) {
+    Parser parser;
+    for (char c : log) {
+      sentences += parser.encode(c);
+    }
+    result.failed = parser.failedChecksum();
+  }
+  auto end = std::chrono::steady_clock::now();
+  result.chars_per_second = static_cast<double>(log.size()) * PASSES /
+                            std::chrono::duration<double>(end - start).count();
+  result.sentences = sentences / PASSES;
+  return result;
+}
+
+int main(int argc, char** argv) {
+  std::string log;
+  if (argc > 1) {
+    if (!load_nmea_log(argv[1], &log)) {
+      printf("Can't read %s\n", argv[1]);
+      return 1;
+    }
+  } else {
+    NmeaWalk walk;
+    walk.seconds_without_fix = 30;
+    log = simulate_nmea(3600, walk);
+  }
+
+  Result tiny = bench<TinyGPSPlus>(log);
+  Result parser = bench<NMEAParser>(log);
+
+  printf("Parsing %zu characters of NMEA%s, %d times\n", log.size(), argc > 1 ? "" : " (an hour of simulated GPS)",
+         PASSES);
+  printf("%-12s %14s %12s %10s\n", "parser", "chars/s", "sentences", "failed");
+  printf("%-12s %14.0f %12u %10u\n", "TinyGPS++", tiny.chars_per_second, tiny.sentences, tiny.failed);
+  printf("%-12s %14.0f %12u %10u\n", "NMEAParser", parser.chars_per_second, parser.sentences, parser.failed);
+  printf("NMEAParser: %.1fx faster\n", parser.chars_per_second / tiny.chars_per_second);
+  return 0;
+}
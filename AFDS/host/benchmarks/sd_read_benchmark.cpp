@@ -0,0 +1,142 @@
+/**
+  *
+  *
+  * @file:    sd_read_benchmark.cpp
+  * @date:    17-10-2026 08:25:28
+  *
+  * @brief    Host benchmark of loading a saved fall signal from the MicroSD card
+  *
+  *   Loads the same CSV signal with datalogger::readSignalValues(), which
+  *   reads a sector at a time and parses the fields with parse_float(), and
+  *   with the earlier reader, which read a byte at a time, parsed with
+  *   strtod(), and started the card with SD.begin() and a 3 s delay on every
+  *   load. Both are run on the simulated MicroSD card, and the time on the
+  *   workstation and the time of the board including the delays are reported.
+  *
+  *   Built and run by "make bench" in AFDS/host.
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <SD.h>
+
+#include "constants.h"
+#include "datalogger.h"
+#include "sd_reader.h"
+
+// Amount of times the signal is loaded
+const int LOADS = 500;
+const int CHANNELS = 6;
+
+// The reader before the block reader, kept as the reference of the benchmark
+static void read_byte_at_a_time(int cs, char name[], float* columns[CHANNELS]) {
+  if (!SD.begin(cs)) {
+    return;
+  }
+  delay(3000);
+  File file = SD.open(name, FILE_READ);
+  if (!file) {
+    return;
+  }
+  char str[20];
+  int column = 0;
+  int l = 0;
+  while (true) {
+    char ch;
+    size_t n = 0;
+    while ((n + 1) < sizeof(str) && file.read(&ch, 1) == 1) {
+      if (ch == '\r') {
+        continue;
+      }
+      str[n++] = ch;
+      if (strchr(",\n", ch)) {
+        break;
+      }
+    }
+    str[n] = '\0';
+    if (n == 0) {
+      break;
+    }
+    bool end_of_line = str[n - 1] == '\n';
+    str[n - 1] = '\0';
+    if (column < CHANNELS) {
+      columns[column][l] = strtod(str, nullptr);
+    }
+    column++;
+    if (end_of_line) {
+      column = 0;
+      l++;
+    }
+  }
+  file.close();
+}
+
+struct Result {
+  double host_us;
+  double board_ms;
+};
+
+template <typename Load>
+static Result bench(Load load) {
+  unsigned long board_start = millis();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < LOADS; i++) {
+    load();
+  }
+  auto end = std::chrono::steady_clock::now();
+  Result result;
+  result.host_us = std::chrono::duration<double, std::micro>(end - start).count() / LOADS;
+  result.board_ms = static_cast<double>(millis() - board_start) / LOADS;
+  return result;
+}
+
+int main() {
+  static float written[CHANNELS][SIGNAL_SIZE];
+  static float fast[CHANNELS][SIGNAL_SIZE];
+  static float reference[CHANNELS][SIGNAL_SIZE];
+  for (int n = 0; n < SIGNAL_SIZE; n++) {
+    for (int c = 0; c < CHANNELS; c++) {
+      written[c][n] = ((n * 397 + c * 1051) % 20000 - 10000) * (c < 3 ? 0.000732f : 0.07f);
+    }
+  }
+  if (!SD.begin(CS)) {
+    printf("Can't use the simulated MicroSD card\n");
+    return 1;
+  }
+
+  datalogger logger;
+  char name[] = "BENCH.csv";
+  logger.writeSignalValues(CS, name, written[0], written[1], written[2], written[3], written[4], written[5],
+                           SIGNAL_SIZE, true);
+  File file = SD.open(name, FILE_READ);
+  long size = file ? static_cast<long>(file.size()) : -1;
+  file.close();
+
+  float* reference_columns[CHANNELS] = {reference[0], reference[1], reference[2],
+                                        reference[3], reference[4], reference[5]};
+  Result old_reader = bench([&]() { read_byte_at_a_time(CS, name, reference_columns); });
+  int lines = 0;
+  Result block_reader = bench([&]() {
+    lines = logger.readSignalValues(CS, name, fast[0], fast[1], fast[2], fast[3], fast[4], fast[5]);
+  });
+
+  int different = 0;
+  for (int c = 0; c < CHANNELS; c++) {
+    for (int n = 0; n < SIGNAL_SIZE; n++) {
+      different += fast[c][n] == reference[c][n] ? 0 : 1;
+    }
+  }
+
+  printf("Loading a signal of %d samples (%ld bytes), %d times\n", SIGNAL_SIZE, size, LOADS);
+  printf("%-22s %14s %14s\n", "reader", "host [us]", "board [ms]");
+  printf("%-22s %14.1f %14.1f\n", "byte at a time", old_reader.host_us, old_reader.board_ms);
+  printf("%-22s %14.1f %14.1f\n", "block reader", block_reader.host_us, block_reader.board_ms);
+  printf("Block reader: %.1fx faster on the host, %d lines, %d values different from strtod()\n",
+         old_reader.host_us / block_reader.host_us, lines, different);
+  SD.remove(name);
+  return lines == SIGNAL_SIZE && different == 0 ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+/**
+  *
+  *
+  * @file:    signal_buffer_benchmark.cpp
+  * @date:    17-10-2026 06:27:55
+  *
+  * @brief    Host benchmark of the shift-register arrays against the signal ring buffers
+  *
+  *   Pushes samples into six signals, like afdsdCtrl1::readIMU() does, for a
+  *   range of signal sizes. The old shift-register push grows with the signal
+  *   size, while the ring buffer push stays the same.
+  *
+  *   Built and run by "make bench" in AFDS/host, or from the repository root with:
+  *   g++ -O2 -std=c++11 -IAFDS/adaptive_fall_detection_system AFDS/host/benchmarks/signal_buffer_benchmark.cpp -o signal_buffer_benchmark
+  *   ./signal_buffer_benchmark
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+
+#include "signal_buffer.h"
+
+// Amount of samples pushed for every signal size
+const int SAMPLES = 200000;
+// Amount of signals pushed per sample (acc x, y, z and gyro x, y, z)
+const int SIGNALS = 6;
+
+/**
+* @brief  push_array(): The old shift-register push from afdsdCtrl1
+*
+* @param float new_value: The new value to push into the array.
+* @param float chosen_array[]: Pointer to the chosen array for pushing the new value.
+* @param int array_length: Int for the length of the chosen array
+* @return void:
+*
+**/
+static void push_array(float new_value, float chosen_array[], int array_length) {
+  for (int i = array_length-1; i >= 0; i--) {
+    if (i == 0) {
+      chosen_array[i] = new_value;
+    }
+    else {
+      chosen_array[i] = chosen_array[i-1];
+    }
+  }
+}
+
+template <int N>
+static double bench_shift(float* checksum) {
+  static float signals[SIGNALS][N];
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < SAMPLES; n++) {
+    for (int s = 0; s < SIGNALS; s++) {
+      push_array(static_cast<float>(n + s), signals[s], N);
+    }
+    *checksum += signals[n % SIGNALS][N - 1];
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / SAMPLES;
+}
+
+template <int N>
+static double bench_ring(float* checksum) {
+  static RingBuffer<float, N> signals[SIGNALS];
+  auto start = std::chrono::steady_clock::now();
+  for (int n = 0; n < SAMPLES; n++) {
+    for (int s = 0; s < SIGNALS; s++) {
+      signals[s].push(static_cast<float>(n + s));
+    }
+    *checksum += signals[n % SIGNALS][N - 1];
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / SAMPLES;
+}
+
+template <int N>
+static void bench_size(float* checksum) {
+  double shift_ns = bench_shift<N>(checksum);
+  double ring_ns = bench_ring<N>(checksum);
+  printf("%6d %18.1f %18.1f %10.1fx\n", N, shift_ns, ring_ns, shift_ns / ring_ns);
+}
+
+int main() {
+  // The checksum makes sure the compiler can't remove the pushes
+  float checksum = 0;
+  printf("%6s %18s %18s %11s\n", "N", "shift ns/sample", "ring ns/sample", "speedup");
+  bench_size<30>(&checksum);
+  bench_size<60>(&checksum);
+  bench_size<SIGNAL_SIZE>(&checksum);
+  bench_size<240>(&checksum);
+  bench_size<480>(&checksum);
+  bench_size<960>(&checksum);
+  printf("checksum: %f\n", checksum);
+  return 0;
+}
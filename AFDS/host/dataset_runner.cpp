@@ -0,0 +1,288 @@
+/**
+  *
+  *
+  * @file:    dataset_runner.cpp
+  * @date:    17-10-2026 07:23:47
+  *
+  * @brief    Evaluates the fall models on a directory of recordings with all cores
+  *
+**/
+
+#include "dataset_runner.h"
+
+#include <ctype.h>
+#include <dirent.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <Arduino.h>
+
+#include "afds_controller.h"
+#include "trace_replay.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double seconds_since(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool has_extension(const std::string& name, const char* extension) {
+  size_t length = strlen(extension);
+  return name.size() > length && name.compare(name.size() - length, length, extension) == 0;
+}
+
+// The queue of recordings of a thread, which the other threads can steal from
+struct WorkQueue {
+  std::mutex lock;
+  std::deque<int> recordings;
+};
+
+// Takes the next recording of a thread, from its own queue or stolen from another one
+int next_recording(std::vector<std::unique_ptr<WorkQueue>>& queues, int thread, bool* stolen) {
+  {
+    WorkQueue& own = *queues[thread];
+    std::lock_guard<std::mutex> guard(own.lock);
+    if (!own.recordings.empty()) {
+      int recording = own.recordings.back();
+      own.recordings.pop_back();
+      *stolen = false;
+      return recording;
+    }
+  }
+  for (size_t i = 1; i < queues.size(); i++) {
+    WorkQueue& victim = *queues[(thread + i) % queues.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if (!victim.recordings.empty()) {
+      int recording = victim.recordings.front();
+      victim.recordings.pop_front();
+      *stolen = true;
+      return recording;
+    }
+  }
+  return -1;
+}
+
+// Runs a recording through a new controller, and every signal through the classifiers
+void evaluate_recording(const Recording& recording, bool fall_log,
+                        std::vector<DatasetRunner::Classifier>& classifiers, DatasetReport& report) {
+  Clock::time_point start = Clock::now();
+  std::vector<TraceSample> samples;
+  bool loaded = load_trace(recording.path.c_str(), fall_log, samples);
+  report.load_s += seconds_since(start);
+  if (!loaded) {
+    report.failed++;
+    return;
+  }
+
+  // The controller holds the signals, so it's not placed on the stack
+  std::unique_ptr<afdsdCtrl1> ctrl(new afdsdCtrl1());
+  std::vector<bool> predicted_fall(classifiers.size(), false);
+  double inference_s = 0;
+  start = Clock::now();
+  for (const TraceSample& sample : samples) {
+    if (!ctrl->process_sample(sample.ax, sample.ay, sample.az, sample.gx, sample.gy, sample.gz)) {
+      continue;
+    }
+    ctrl->feature_calculation();
+    report.windows++;
+    for (size_t m = 0; m < classifiers.size(); m++) {
+      float output[2];
+      Clock::time_point inference_start = Clock::now();
+      bool ok = classifiers[m](ctrl->features, output);
+      double model_s = seconds_since(inference_start);
+      report.models[m].inference_s += model_s;
+      inference_s += model_s;
+      // The same decision as predictor(), a fifty / fifty signal is a fall
+      if (ok && output[1] >= output[0]) {
+        report.models[m].fall_windows++;
+        predicted_fall[m] = true;
+      }
+    }
+    // Like predict_fall(), the controller waits for the next threshold
+    ctrl->reset_variables();
+  }
+  report.features_s += seconds_since(start) - inference_s;
+  report.samples += static_cast<long>(samples.size());
+  report.recordings++;
+
+  if (recording.label >= 0) {
+    for (size_t m = 0; m < classifiers.size(); m++) {
+      report.models[m].recordings.add(recording.label == 1, predicted_fall[m]);
+    }
+  }
+  // Only the results are kept, not the debug output of the controller
+  Serial.host_take_transmitted();
+}
+
+}  // namespace
+
+int recording_label(const std::string& path) {
+  int label = -1;
+  std::string word;
+  for (size_t i = 0; i <= path.size(); i++) {
+    char c = i < path.size() ? static_cast<char>(tolower(static_cast<unsigned char>(path[i]))) : '/';
+    if (c != '/' && c != '_' && c != '-' && c != '.' && c != ' ') {
+      word.push_back(c);
+      continue;
+    }
+    // The words of the file name come last, so they decide over the directories
+    if (word == "adl" || word.compare(0, 5, "daily") == 0) {
+      label = 0;
+    } else if (word.compare(0, 4, "fall") == 0) {
+      label = 1;
+    }
+    word.clear();
+  }
+  return label;
+}
+
+bool find_recordings(const std::string& directory, std::vector<Recording>& recordings) {
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) {
+    return false;
+  }
+  std::vector<std::string> names;
+  while (struct dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      names.push_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  // The same order on every run
+  std::sort(names.begin(), names.end());
+
+  for (const std::string& name : names) {
+    std::string path = directory + "/" + name;
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+      continue;
+    }
+    if (S_ISDIR(info.st_mode)) {
+      find_recordings(path, recordings);
+    } else if (has_extension(name, ".csv") || has_extension(name, ".bin") || has_extension(name, ".afl")) {
+      Recording recording = {path, recording_label(path), static_cast<long>(info.st_size)};
+      recordings.push_back(recording);
+    }
+  }
+  return true;
+}
+
+void ConfusionMatrix::add(bool fall, bool predicted_fall) {
+  if (fall) {
+    predicted_fall ? true_positives++ : false_negatives++;
+  } else {
+    predicted_fall ? false_positives++ : true_negatives++;
+  }
+}
+
+void ConfusionMatrix::merge(const ConfusionMatrix& other) {
+  true_positives += other.true_positives;
+  false_positives += other.false_positives;
+  true_negatives += other.true_negatives;
+  false_negatives += other.false_negatives;
+}
+
+float ConfusionMatrix::accuracy() const {
+  return total() > 0 ? static_cast<float>(true_positives + true_negatives) / total() : 0.0f;
+}
+
+float ConfusionMatrix::sensitivity() const {
+  long falls = true_positives + false_negatives;
+  return falls > 0 ? static_cast<float>(true_positives) / falls : 0.0f;
+}
+
+float ConfusionMatrix::specificity() const {
+  long no_falls = true_negatives + false_positives;
+  return no_falls > 0 ? static_cast<float>(true_negatives) / no_falls : 0.0f;
+}
+
+void DatasetReport::merge(const DatasetReport& other) {
+  recordings += other.recordings;
+  failed += other.failed;
+  samples += other.samples;
+  windows += other.windows;
+  steals += other.steals;
+  load_s += other.load_s;
+  features_s += other.features_s;
+  if (models.size() < other.models.size()) {
+    models.resize(other.models.size());
+  }
+  for (size_t m = 0; m < other.models.size(); m++) {
+    models[m].recordings.merge(other.models[m].recordings);
+    models[m].fall_windows += other.models[m].fall_windows;
+    models[m].inference_s += other.models[m].inference_s;
+  }
+}
+
+DatasetRunner::DatasetRunner(int models, ClassifierFactory factory, int threads)
+  : threads(threads), models(models), factory(factory) {
+  if (this->threads <= 0) {
+    this->threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+DatasetReport DatasetRunner::run(const std::vector<Recording>& recordings, bool fall_log) {
+  // The largest recordings are dealt first, so the small ones even out the end
+  std::vector<int> order(recordings.size());
+  for (size_t i = 0; i < order.size(); i++) {
+    order[i] = static_cast<int>(i);
+  }
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return recordings[a].bytes > recordings[b].bytes;
+  });
+  std::vector<std::unique_ptr<WorkQueue>> queues;
+  for (int t = 0; t < threads; t++) {
+    queues.emplace_back(new WorkQueue());
+  }
+  // Every thread takes from the back of its queue, so the largest recording goes last in the queue
+  for (size_t i = 0; i < order.size(); i++) {
+    queues[i % threads]->recordings.push_front(order[i]);
+  }
+
+  // The classifiers are made before the threads start, so the factory doesn't need to be thread safe
+  std::vector<std::vector<Classifier>> classifiers(threads);
+  std::vector<DatasetReport> reports(threads);
+  for (int t = 0; t < threads; t++) {
+    for (int m = 0; m < models; m++) {
+      classifiers[t].push_back(factory(m, t));
+    }
+    reports[t].models.resize(models);
+  }
+
+  Serial.host_set_echo(nullptr);
+  Clock::time_point start = Clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&, t]() {
+      bool stolen = false;
+      int recording;
+      while ((recording = next_recording(queues, t, &stolen)) >= 0) {
+        reports[t].steals += stolen ? 1 : 0;
+        evaluate_recording(recordings[recording], fall_log, classifiers[t], reports[t]);
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  DatasetReport report;
+  report.threads = threads;
+  report.models.resize(models);
+  for (const DatasetReport& thread_report : reports) {
+    report.merge(thread_report);
+  }
+  report.seconds = seconds_since(start);
+  Serial.host_take_transmitted();
+  Serial.host_set_echo(stdout);
+  return report;
+}
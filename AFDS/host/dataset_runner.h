@@ -0,0 +1,159 @@
+/**
+  *
+  *
+  * @file:    dataset_runner.h
+  * @date:    17-10-2026 07:23:47
+  *
+  * @brief    Evaluates the fall models on a directory of recordings with all cores
+  *
+  *   Every recording is run through process_sample() and feature_calculation()
+  *   of its own controller, and every signal exceeding the threshold is
+  *   classified by each model. A recording is predicted as a fall when any of
+  *   its signals is, like the board raises the alarm, and is compared with the
+  *   label found in its path.
+  *
+  *   The recordings are dealt to the worker threads largest first. A thread
+  *   takes its recordings from the back of its own queue, and when the queue is
+  *   empty it steals from the front of the queue of another thread, so long
+  *   recordings don't leave the other threads idle at the end. Every thread
+  *   has its own classifiers, like one interpreter and tensor arena per thread.
+  *
+**/
+
+#ifndef HOST_DATASET_RUNNER_H_
+#define HOST_DATASET_RUNNER_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+
+/**
+* @brief  Recording: A recording of the dataset and its label
+*
+**/
+struct Recording {
+  std::string path;
+  int label;              /**<  1 = fall, 0 = no fall (ADL), -1 = unknown   */
+  long bytes;             /**<  Size of the file, used to deal the largest recordings first   */
+};
+
+/**
+* @brief  recording_label(): The label of a recording, from the words of its path
+*
+*   The path is split in words at '/', '_', '-', '.' and spaces. A word "adl"
+*   or starting with "daily" is no fall, and a word starting with "fall" is a
+*   fall, like "UMAFall_Subject_01_Fall_forwardFall_1.csv" or
+*   "falling_signal_nr1.csv". Case is ignored.
+*
+* @param const std::string& path: Path of the recording.
+* @return int: 1 = fall, 0 = no fall, -1 = unknown
+*
+**/
+int recording_label(const std::string& path);
+
+/**
+* @brief  find_recordings(): Find the recordings in a directory and its subdirectories
+*
+* @param const std::string& directory: The directory.
+* @param std::vector<Recording>& recordings: The CSV (.csv), binary trace (.bin) and fall log (.afl) recordings are appended.
+* @return bool: true if the directory could be read
+*
+**/
+bool find_recordings(const std::string& directory, std::vector<Recording>& recordings);
+
+/**
+* @brief  ConfusionMatrix: Predictions against the labels
+*
+**/
+struct ConfusionMatrix {
+  long true_positives = 0;      /**<  Falls predicted as falls   */
+  long false_positives = 0;     /**<  No falls predicted as falls   */
+  long true_negatives = 0;      /**<  No falls predicted as no falls   */
+  long false_negatives = 0;     /**<  Falls predicted as no falls   */
+
+  void add(bool fall, bool predicted_fall);
+  void merge(const ConfusionMatrix& other);
+  long total() const { return true_positives + false_positives + true_negatives + false_negatives; };
+  float accuracy() const;
+  float sensitivity() const;    /**<  Part of the falls predicted as falls   */
+  float specificity() const;    /**<  Part of the no falls predicted as no falls   */
+};
+
+/**
+* @brief  ModelResult: The result of one model on the dataset
+*
+**/
+struct ModelResult {
+  ConfusionMatrix recordings;   /**<  The labelled recordings   */
+  long fall_windows = 0;        /**<  Signals predicted as falls   */
+  double inference_s = 0;       /**<  Thread time of the classifier   */
+};
+
+/**
+* @brief  DatasetReport: The result of a dataset evaluation
+*
+*   The stage times are summed over the threads, the seconds are the wall
+*   time of the evaluation.
+*
+**/
+struct DatasetReport {
+  int threads = 0;
+  long recordings = 0;          /**<  Recordings evaluated   */
+  long failed = 0;              /**<  Recordings, which couldn't be loaded   */
+  long samples = 0;             /**<  Samples run through the controllers   */
+  long windows = 0;             /**<  Signals exceeding the threshold, classified by every model   */
+  long steals = 0;              /**<  Recordings taken from the queue of another thread   */
+  double load_s = 0;            /**<  Thread time of loading the recordings   */
+  double features_s = 0;        /**<  Thread time of process_sample() and feature_calculation()   */
+  double seconds = 0;
+  std::vector<ModelResult> models;
+
+  void merge(const DatasetReport& other);
+  double windows_per_second() const { return seconds > 0 ? windows / seconds : 0; };
+  double samples_per_second() const { return seconds > 0 ? samples / seconds : 0; };
+};
+
+/**
+* @brief  DatasetRunner: Evaluates models on recordings with a pool of threads
+*
+**/
+class DatasetRunner {
+  public:
+    // Runs a model on the features and writes the two outputs, like Invoke() does
+    typedef std::function<bool(const float features[FEATURE_AMOUNT], float output[2])> Classifier;
+    // Makes the classifier of a model for a thread, called for every thread before the threads start
+    typedef std::function<Classifier(int model, int thread)> ClassifierFactory;
+
+    /**
+    * @brief  DatasetRunner(): The models and the threads of the evaluation
+    *
+    * @param int models: Amount of models every window is classified by.
+    * @param ClassifierFactory factory: Makes the classifiers of every thread.
+    * @param int threads: Amount of worker threads, 0 for one per core.
+    *
+    **/
+    DatasetRunner(int models, ClassifierFactory factory, int threads = 0);
+
+    /**
+    * @brief  run(): Evaluate the models on the recordings
+    *
+    *   The debug output of the controllers on Serial is not echoed while the
+    *   recordings are evaluated.
+    *
+    * @param const std::vector<Recording>& recordings: The recordings.
+    * @param bool fall_log: true if the CSV recordings are fall signals saved by the datalogger.
+    * @return DatasetReport: The confusion matrices, stage times and throughput
+    *
+    **/
+    DatasetReport run(const std::vector<Recording>& recordings, bool fall_log = false);
+
+    int threads;                  /**<  Amount of worker threads   */
+
+  private:
+    int models;
+    ClassifierFactory factory;
+};
+
+#endif  // HOST_DATASET_RUNNER_H_
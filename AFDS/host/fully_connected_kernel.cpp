@@ -0,0 +1,200 @@
+/**
+  *
+  *
+  * @file:    fully_connected_kernel.cpp
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    Float fully connected kernel with AVX2, SSE and scalar versions, chosen at run time
+  *
+  *   The vector versions are compiled with the target attribute of GCC, so the
+  *   rest of the host build doesn't need -mavx2 and still runs on any x86-64.
+  *
+**/
+
+#include "fully_connected_kernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FC_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Outputs computed together, sharing the loads of the input
+const int ROWS = 4;
+
+// The shape is passed by value to the versions, so the compiler knows the outputs don't change it
+inline float clamp(float value, const FcShape& shape) {
+  return value < shape.activation_min ? shape.activation_min
+                                      : (value > shape.activation_max ? shape.activation_max : value);
+}
+
+// The same loops as reference_ops::FullyConnected
+void fully_connected_scalar(const FcShape shape, const float* input, const float* weights, const float* bias,
+                            float* output) {
+  const int depth = shape.depth;
+  for (int b = 0; b < shape.batches; b++) {
+    const float* in = input + b * depth;
+    float* out = output + b * shape.outputs;
+    for (int o = 0; o < shape.outputs; o++) {
+      const float* w = weights + o * depth;
+      float total = 0.f;
+      for (int d = 0; d < depth; d++) {
+        total += in[d] * w[d];
+      }
+      float bias_value = bias ? bias[o] : 0.0f;
+      out[o] = clamp(total + bias_value, shape);
+    }
+  }
+}
+
+#ifdef FC_X86
+__attribute__((target("sse3"))) inline float sum_sse(__m128 v) {
+  v = _mm_hadd_ps(v, v);
+  v = _mm_hadd_ps(v, v);
+  return _mm_cvtss_f32(v);
+}
+
+__attribute__((target("sse3"))) void fully_connected_sse(const FcShape shape, const float* input,
+                                                          const float* weights, const float* bias, float* output) {
+  const int depth = shape.depth;
+  const int vector_depth = depth & ~3;
+  for (int b = 0; b < shape.batches; b++) {
+    const float* in = input + b * depth;
+    float* out = output + b * shape.outputs;
+    int o = 0;
+    for (; o + ROWS <= shape.outputs; o += ROWS) {
+      const float* w = weights + o * depth;
+      __m128 acc[ROWS] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+      int d = 0;
+      for (; d < vector_depth; d += 4) {
+        __m128 x = _mm_loadu_ps(in + d);
+        for (int r = 0; r < ROWS; r++) {
+          acc[r] = _mm_add_ps(acc[r], _mm_mul_ps(x, _mm_loadu_ps(w + r * depth + d)));
+        }
+      }
+      for (int r = 0; r < ROWS; r++) {
+        float total = sum_sse(acc[r]);
+        for (int t = d; t < depth; t++) {
+          total += in[t] * w[r * depth + t];
+        }
+        out[o + r] = clamp(total + (bias ? bias[o + r] : 0.0f), shape);
+      }
+    }
+    for (; o < shape.outputs; o++) {
+      const float* w = weights + o * depth;
+      __m128 acc = _mm_setzero_ps();
+      int d = 0;
+      for (; d < vector_depth; d += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(in + d), _mm_loadu_ps(w + d)));
+      }
+      float total = sum_sse(acc);
+      for (; d < depth; d++) {
+        total += in[d] * w[d];
+      }
+      out[o] = clamp(total + (bias ? bias[o] : 0.0f), shape);
+    }
+  }
+}
+
+__attribute__((target("avx2,fma"))) inline float sum_avx(__m256 v) {
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  sum = _mm_hadd_ps(sum, sum);
+  sum = _mm_hadd_ps(sum, sum);
+  return _mm_cvtss_f32(sum);
+}
+
+__attribute__((target("avx2,fma"))) void fully_connected_avx2(const FcShape shape, const float* input,
+                                                               const float* weights, const float* bias,
+                                                               float* output) {
+  const int depth = shape.depth;
+  const int vector_depth = depth & ~7;
+  for (int b = 0; b < shape.batches; b++) {
+    const float* in = input + b * depth;
+    float* out = output + b * shape.outputs;
+    int o = 0;
+    for (; o + ROWS <= shape.outputs; o += ROWS) {
+      const float* w = weights + o * depth;
+      __m256 acc[ROWS] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+      int d = 0;
+      for (; d < vector_depth; d += 8) {
+        __m256 x = _mm256_loadu_ps(in + d);
+        for (int r = 0; r < ROWS; r++) {
+          acc[r] = _mm256_fmadd_ps(x, _mm256_loadu_ps(w + r * depth + d), acc[r]);
+        }
+      }
+      for (int r = 0; r < ROWS; r++) {
+        float total = sum_avx(acc[r]);
+        for (int t = d; t < depth; t++) {
+          total += in[t] * w[r * depth + t];
+        }
+        out[o + r] = clamp(total + (bias ? bias[o + r] : 0.0f), shape);
+      }
+    }
+    for (; o < shape.outputs; o++) {
+      const float* w = weights + o * depth;
+      __m256 acc = _mm256_setzero_ps();
+      int d = 0;
+      for (; d < vector_depth; d += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(in + d), _mm256_loadu_ps(w + d), acc);
+      }
+      float total = sum_avx(acc);
+      for (; d < depth; d++) {
+        total += in[d] * w[d];
+      }
+      out[o] = clamp(total + (bias ? bias[o] : 0.0f), shape);
+    }
+  }
+}
+#endif
+
+}  // namespace
+
+bool fc_isa_supported(FcIsa isa) {
+#ifdef FC_X86
+  __builtin_cpu_init();
+  if (isa == FC_AVX2) {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  }
+  if (isa == FC_SSE) {
+    return __builtin_cpu_supports("sse3");
+  }
+#endif
+  return isa == FC_SCALAR;
+}
+
+FcIsa fc_best_isa() {
+  static const FcIsa best = fc_isa_supported(FC_AVX2) ? FC_AVX2 : (fc_isa_supported(FC_SSE) ? FC_SSE : FC_SCALAR);
+  return best;
+}
+
+const char* fc_isa_name(FcIsa isa) {
+  switch (isa) {
+    case FC_AVX2:
+      return "avx2";
+    case FC_SSE:
+      return "sse";
+    default:
+      return "scalar";
+  }
+}
+
+void fully_connected(const FcShape& shape, const float input[], const float weights[], const float bias[],
+                     float output[]) {
+  fully_connected(fc_best_isa(), shape, input, weights, bias, output);
+}
+
+void fully_connected(FcIsa isa, const FcShape& shape, const float input[], const float weights[],
+                     const float bias[], float output[]) {
+#ifdef FC_X86
+  if (isa == FC_AVX2) {
+    fully_connected_avx2(shape, input, weights, bias, output);
+    return;
+  }
+  if (isa == FC_SSE) {
+    fully_connected_sse(shape, input, weights, bias, output);
+    return;
+  }
+#endif
+  fully_connected_scalar(shape, input, weights, bias, output);
+}
@@ -0,0 +1,102 @@
+/**
+  *
+  *
+  * @file:    fully_connected_kernel.h
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    Float fully connected kernel with AVX2, SSE and scalar versions, chosen at run time
+  *
+  *   Evaluating the fall models on the workstation spends nearly all its time in
+  *   the fully connected layers. The reference kernel of TensorFlow Lite is a
+  *   plain loop over the batches, outputs and depth. This kernel computes four
+  *   outputs at a time, so every input value loaded is used four times, and
+  *   sums eight (AVX2) or four (SSE) products in each instruction. The best
+  *   version the CPU supports is chosen the first time the kernel is called.
+  *
+  *   The scalar version sums in the same order as the reference kernel and
+  *   gives the same bits. The vector versions sum in another order, so their
+  *   outputs differ from it by a few float roundings.
+  *
+**/
+
+#ifndef HOST_FULLY_CONNECTED_KERNEL_H_
+#define HOST_FULLY_CONNECTED_KERNEL_H_
+
+/**
+* @brief  FcIsa: The instruction sets the kernel has a version for
+*
+**/
+enum FcIsa {
+  FC_SCALAR,
+  FC_SSE,
+  FC_AVX2
+};
+
+/**
+* @brief  FcShape: The shape of a fully connected layer
+*
+**/
+struct FcShape {
+  int batches;          /**<  Amount of input vectors   */
+  int depth;            /**<  Amount of values of every input vector   */
+  int outputs;          /**<  Amount of outputs of every input vector   */
+  float activation_min; /**<  The outputs are clamped to [activation_min, activation_max]   */
+  float activation_max;
+};
+
+/**
+* @brief  fc_isa_supported(): Check if the CPU can run a version of the kernel
+*
+* @param FcIsa isa: The version of the kernel.
+* @return bool: true if the CPU supports the instruction set
+*
+**/
+bool fc_isa_supported(FcIsa isa);
+
+/**
+* @brief  fc_best_isa(): The fastest version of the kernel the CPU supports
+*
+* @return FcIsa: The version fully_connected() runs
+*
+**/
+FcIsa fc_best_isa();
+
+/**
+* @brief  fc_isa_name(): Name of a version of the kernel
+*
+* @param FcIsa isa: The version of the kernel.
+* @return const char*: "scalar", "sse" or "avx2"
+*
+**/
+const char* fc_isa_name(FcIsa isa);
+
+/**
+* @brief  fully_connected(): Run a fully connected layer with the fastest version of the kernel
+*
+* @param const FcShape& shape: The shape of the layer.
+* @param const float input[]: batches x depth input values.
+* @param const float weights[]: outputs x depth weights, row major.
+* @param const float bias[]: The outputs biases, or nullptr for no bias.
+* @param float output[]: batches x outputs output values.
+* @return void
+*
+**/
+void fully_connected(const FcShape& shape, const float input[], const float weights[], const float bias[],
+                     float output[]);
+
+/**
+* @brief  fully_connected(): Run a fully connected layer with one version of the kernel
+*
+* @param FcIsa isa: The version of the kernel, which the CPU has to support.
+* @param const FcShape& shape: The shape of the layer.
+* @param const float input[]: batches x depth input values.
+* @param const float weights[]: outputs x depth weights, row major.
+* @param const float bias[]: The outputs biases, or nullptr for no bias.
+* @param float output[]: batches x outputs output values.
+* @return void
+*
+**/
+void fully_connected(FcIsa isa, const FcShape& shape, const float input[], const float weights[],
+                     const float bias[], float output[]);
+
+#endif  // HOST_FULLY_CONNECTED_KERNEL_H_
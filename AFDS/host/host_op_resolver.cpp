@@ -0,0 +1,73 @@
+/**
+  *
+  *
+  * @file:    host_op_resolver.cpp
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    The operations of the interpreter on the workstation, with the vectorized FULLY_CONNECTED
+  *
+**/
+
+#include "host_op_resolver.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/experimental/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "fully_connected_kernel.h"
+
+namespace {
+
+// Versions of FULLY_CONNECTED the vectorized kernel is used for, like the micro kernel has
+const int FULLY_CONNECTED_VERSIONS = 8;
+
+// The micro kernel, which still runs the quantized layers
+TfLiteRegistration* reference_fully_connected = nullptr;
+
+TfLiteStatus eval_fully_connected(TfLiteContext* context, TfLiteNode* node) {
+  const TfLiteTensor* input = tflite::GetInput(context, node, 0);
+  const TfLiteTensor* filter = tflite::GetInput(context, node, 1);
+  const TfLiteTensor* bias = tflite::GetOptionalInputTensor(context, node, 2);
+  TfLiteTensor* output = tflite::GetOutput(context, node, 0);
+  if (input->type != kTfLiteFloat32 || filter->type != kTfLiteFloat32) {
+    return reference_fully_connected->invoke(context, node);
+  }
+
+  const TfLiteFullyConnectedParams* params = reinterpret_cast<TfLiteFullyConnectedParams*>(node->builtin_data);
+  FcShape shape;
+  tflite::CalculateActivationRange(params->activation, &shape.activation_min, &shape.activation_max);
+  shape.outputs = filter->dims->data[0];
+  shape.depth = filter->dims->data[1];
+  shape.batches = static_cast<int>(tflite::NumElements(input) / shape.depth);
+  fully_connected(shape, input->data.f, filter->data.f, bias ? bias->data.f : nullptr, output->data.f);
+  return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration* Register_FAST_FULLY_CONNECTED() {
+  static TfLiteRegistration registration = {};
+  if (reference_fully_connected == nullptr) {
+    reference_fully_connected = tflite::ops::micro::Register_FULLY_CONNECTED();
+    registration = *reference_fully_connected;
+    registration.invoke = eval_fully_connected;
+  }
+  return &registration;
+}
+
+const TfLiteRegistration* HostOpResolver::FindOp(tflite::BuiltinOperator op, int version) const {
+  const TfLiteRegistration* registration = all_ops.FindOp(op, version);
+  if (registration != nullptr && op == tflite::BuiltinOperator_FULLY_CONNECTED &&
+      version < FULLY_CONNECTED_VERSIONS) {
+    // The versions of the micro kernel, with another invoke(). The interpreter keeps the pointer.
+    static TfLiteRegistration fast[FULLY_CONNECTED_VERSIONS];
+    fast[version] = *Register_FAST_FULLY_CONNECTED();
+    fast[version].builtin_code = registration->builtin_code;
+    fast[version].version = registration->version;
+    return &fast[version];
+  }
+  return registration;
+}
+
+const TfLiteRegistration* HostOpResolver::FindOp(const char* op, int version) const {
+  return all_ops.FindOp(op, version);
+}
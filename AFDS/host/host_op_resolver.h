@@ -0,0 +1,60 @@
+/**
+  *
+  *
+  * @file:    host_op_resolver.h
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    The operations of the interpreter on the workstation, with the vectorized FULLY_CONNECTED
+  *
+  *   All operations come from the AllOpsResolver of the sketch, except
+  *   FULLY_CONNECTED. Its float version runs the kernel of
+  *   fully_connected_kernel.h, and the int8 and uint8 versions still run the
+  *   reference kernel. Only built when the TensorFlow Lite sources are given
+  *   with TFLM_DIR.
+  *
+**/
+
+#ifndef HOST_HOST_OP_RESOLVER_H_
+#define HOST_HOST_OP_RESOLVER_H_
+
+#include "tensorflow/lite/experimental/micro/kernels/all_ops_resolver.h"
+
+/**
+* @brief  Register_FAST_FULLY_CONNECTED(): FULLY_CONNECTED running the float layers with the vectorized kernel
+*
+* @return TfLiteRegistration*: The registration, a copy of the micro kernel with another invoke()
+*
+**/
+TfLiteRegistration* Register_FAST_FULLY_CONNECTED();
+
+/**
+* @brief  HostOpResolver: The AllOpsResolver with FULLY_CONNECTED replaced
+*
+**/
+class HostOpResolver : public tflite::OpResolver {
+  public:
+    /**
+    * @brief  FindOp(): The registration of a builtin operation
+    *
+    * @param tflite::BuiltinOperator op: The operation.
+    * @param int version: The version of the operation in the model.
+    * @return const TfLiteRegistration*: The registration, or nullptr if the operation isn't supported
+    *
+    **/
+    const TfLiteRegistration* FindOp(tflite::BuiltinOperator op, int version) const override;
+
+    /**
+    * @brief  FindOp(): The registration of a custom operation
+    *
+    * @param const char* op: Name of the operation.
+    * @param int version: The version of the operation in the model.
+    * @return const TfLiteRegistration*: The registration, or nullptr if the operation isn't supported
+    *
+    **/
+    const TfLiteRegistration* FindOp(const char* op, int version) const override;
+
+  private:
+    tflite::ops::micro::AllOpsResolver all_ops;
+};
+
+#endif  // HOST_HOST_OP_RESOLVER_H_
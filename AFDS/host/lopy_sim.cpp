@@ -0,0 +1,125 @@
+/**
+  *
+  *
+  * @file:    lopy_sim.cpp
+  * @date:    17-10-2026 08:08:06
+  *
+  * @brief    Simulated UART wire and LoPy on the link of the Nano
+  *
+  *
+  *
+  *
+**/
+
+#include "lopy_sim.h"
+
+#include <string.h>
+
+#include "constants.h"
+
+static bool same_alarm(const AlarmMessage& a, const AlarmMessage& b) {
+  return a.fall_number == b.fall_number && a.confidence == b.confidence &&
+         a.features_digest == b.features_digest && a.gps_length == b.gps_length &&
+         memcmp(a.gps, b.gps, a.gps_length) == 0;
+}
+
+UartLoopback::UartLoopback(HardwareSerial& a, HardwareSerial& b) {
+  forward.from = &a;
+  forward.to = &b;
+  forward.line_free_us = 0;
+  backward.from = &b;
+  backward.to = &a;
+  backward.line_free_us = 0;
+}
+
+void UartLoopback::transfer() {
+  transfer(forward);
+  transfer(backward);
+}
+
+void UartLoopback::transfer(Direction& direction) {
+  double now = micros();
+  std::string written = direction.from->host_take_transmitted();
+  if (!written.empty()) {
+    // A start bit, 8 data bits and a stop bit for every byte
+    double byte_us = 10e6 / direction.from->host_baud();
+    if (direction.line_free_us < now) {
+      direction.line_free_us = now;
+    }
+    for (char c : written) {
+      direction.line_free_us += byte_us;
+      direction.bytes.push_back(std::make_pair(direction.line_free_us, static_cast<uint8_t>(c)));
+    }
+  }
+
+  bool garbled = direction.from->host_baud() != direction.to->host_baud();
+  while (!direction.bytes.empty() && direction.bytes.front().first <= now) {
+    uint8_t byte = direction.bytes.front().second;
+    if (garbled) {
+      byte = static_cast<uint8_t>((byte << 3 | byte >> 5) ^ 0x5A);
+    }
+    direction.to->host_receive(&byte, 1);
+    direction.bytes.pop_front();
+  }
+}
+
+SimulatedLoPy::SimulatedLoPy(unsigned long answer, HardwareSerial& nano)
+    : answer_ms(answer), uart(nullptr), nano_uart(nano), loopback(nano, uart), link(uart) {
+  uart.begin(LINK_BAUD);
+  nano_uart.begin(LINK_BAUD);
+  nano_uart.host_take_transmitted();
+  nano_uart.host_set_peer([this](HardwareSerial&) { poll(); });
+}
+
+SimulatedLoPy::~SimulatedLoPy() {
+  nano_uart.host_set_peer(nullptr);
+}
+
+void SimulatedLoPy::watch() {
+  bool wake_pin = host::pin_value(WAKE_UP) == HIGH;
+  if (wake_pin && !awake) {
+    // The LoPy starts from deep sleep, and doesn't remember the earlier alarms
+    wake_ups++;
+    woken_at = millis();
+    last_alarm_seq = -1;
+    alarm_pending = false;
+  }
+  awake = wake_pin;
+}
+
+void SimulatedLoPy::poll() {
+  watch();
+  loopback.transfer();
+  if (!awake || millis() - woken_at < boot_ms) {
+    // The bytes sent while the LoPy sleeps or starts are lost
+    link.flush();
+    return;
+  }
+
+  LinkFrame frame;
+  while (link.receive(&frame)) {
+    if (frame.type == LINK_ALARM) {
+      alarm_frames++;
+      AlarmMessage alarm;
+      if (frame.seq != last_alarm_seq && link_decode_alarm(frame, &alarm)) {
+        alarms.push_back(alarm);
+        last_alarm_seq = frame.seq;
+        alarm_pending = true;
+        alarm_received_at = millis();
+      }
+      else if (frame.seq == last_alarm_seq && link_decode_alarm(frame, &alarm) && !same_alarm(alarm, alarms.back())) {
+        changed_alarms++;
+      }
+    }
+    else if (frame.type == LINK_ACK) {
+      acks++;
+    }
+  }
+
+  if (alarm_pending && answer_ms != 0 && millis() - alarm_received_at >= answer_ms) {
+    link.send_ack(static_cast<uint8_t>(last_alarm_seq));
+    answers++;
+    alarm_pending = false;
+    loopback.transfer();
+  }
+}
@@ -0,0 +1,148 @@
+/**
+  *
+  *
+  * @file:    lopy_sim.h
+  * @date:    17-10-2026 08:08:06
+  *
+  * @brief    Simulated UART wire and LoPy on the link of the Nano
+  *
+  *   UartLoopback connects two host UARTs like a wire. The bytes written by
+  *   one end arrive at the other end one at a time, 10 bits per byte at the
+  *   baud rate on the virtual clock, so the latency and throughput of the link
+  *   can be measured on the host. Bytes sent with another baud rate than the
+  *   one of the receiver arrive garbled.
+  *
+  *   SimulatedLoPy is the LoPy with the same protocol as the firmware. It is
+  *   woken up by the wake up pin, misses the bytes sent while it starts, and
+  *   acknowledges an alarm a chosen time after receiving it, like when it has
+  *   sent the alarm with LoRa. It is a peer of the UART of the Nano, so it is
+  *   polled whenever the sketch reads from the UART.
+  *
+**/
+
+#ifndef HOST_LOPY_SIM_H_
+#define HOST_LOPY_SIM_H_
+
+#include <deque>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "lopy_link.h"
+
+/**
+* @brief  UartLoopback: Wire between two UARTs
+*
+**/
+class UartLoopback {
+  public:
+    UartLoopback(HardwareSerial& a, HardwareSerial& b);
+
+    /**
+    * @brief  transfer(): Move the bytes written by both ends on the wire, and deliver the arrived bytes
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void transfer();
+
+    /**
+    * @brief  in_flight(): Bytes on the wire, which haven't arrived yet
+    *
+    * @param none
+    * @return size_t: The amount of bytes
+    *
+    **/
+    size_t in_flight() const { return forward.bytes.size() + backward.bytes.size(); };
+
+  private:
+    struct Direction {
+      HardwareSerial* from;           /**<  The transmitting end   */
+      HardwareSerial* to;             /**<  The receiving end   */
+      std::deque<std::pair<double, uint8_t> > bytes;  /**<  Arrival time in us and value of the bytes on the wire   */
+      double line_free_us;            /**<  Time in us when the last byte on the wire has been sent   */
+    };
+    Direction forward;                /**<  From a to b   */
+    Direction backward;               /**<  From b to a   */
+
+    static void transfer(Direction& direction);
+};
+
+/**
+* @brief  SimulatedLoPy: The LoPy on the other end of the link
+*
+**/
+class SimulatedLoPy {
+  public:
+    unsigned long answer_ms;          /**<  Time in ms from receiving an alarm until it is acknowledged, never when 0   */
+    unsigned long boot_ms = 0;        /**<  Time in ms from the wake up until the LoPy reads its UART   */
+    int wake_ups = 0;                 /**<  Times the LoPy has been woken up   */
+    int alarm_frames = 0;             /**<  Alarm frames received, also the ones sent again   */
+    int answers = 0;                  /**<  Alarms acknowledged   */
+    int acks = 0;                     /**<  Acknowledgements received from the Nano   */
+    std::vector<AlarmMessage> alarms; /**<  Alarms received, once for every sequence number   */
+    int changed_alarms = 0;           /**<  Alarm frames sent again with the sequence number of the last alarm, but another alarm   */
+    HardwareSerial uart;              /**<  UART1 of the LoPy   */
+
+    /**
+    * @brief  SimulatedLoPy(): Connect a LoPy to the UART of the Nano, both at LINK_BAUD
+    *
+    * @param unsigned long answer: Time in ms from receiving an alarm until it is acknowledged, never when 0.
+    * @param HardwareSerial& nano: The UART of the Nano.
+    *
+    **/
+    explicit SimulatedLoPy(unsigned long answer, HardwareSerial& nano = Serial1);
+    ~SimulatedLoPy();
+
+    /**
+    * @brief  watch(): Follow the wake up pin, the LoPy is woken up by its rising edge
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void watch();
+
+    /**
+    * @brief  poll(): Move the bytes on the wire, and handle the frames received by the LoPy
+    *
+    * @param none
+    * @return void
+    *
+    **/
+    void poll();
+
+    /**
+    * @brief  press_stop_button(): Send a cancel to the Nano
+    *
+    * @param none
+    * @return uint8_t: The sequence number of the cancel
+    *
+    **/
+    uint8_t press_stop_button() { return link.send(LINK_CANCEL); };
+
+    /**
+    * @brief  send_heartbeat(): Send a heartbeat to the Nano
+    *
+    * @param none
+    * @return uint8_t: The sequence number of the heartbeat
+    *
+    **/
+    uint8_t send_heartbeat() { return link.send(LINK_HEARTBEAT); };
+
+    const LopyLink& lopy_link() const { return link; };
+    const UartLoopback& wire() const { return loopback; };
+
+  private:
+    HardwareSerial& nano_uart;        /**<  The UART of the Nano   */
+    UartLoopback loopback;            /**<  The wire between the two UARTs   */
+    LopyLink link;                    /**<  The LoPy end of the link   */
+    bool awake = false;               /**<  The wake up pin is high   */
+    unsigned long woken_at = 0;       /**<  Time in ms of the last wake up   */
+    int last_alarm_seq = -1;          /**<  Sequence number of the last alarm since the wake up, or -1   */
+    bool alarm_pending = false;       /**<  An alarm is received, but not acknowledged   */
+    unsigned long alarm_received_at = 0;  /**<  Time in ms when the pending alarm was received   */
+};
+
+#endif  // HOST_LOPY_SIM_H_
@@ -0,0 +1,206 @@
+/**
+  *
+  *
+  * @file:    lsm9ds1_sim.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Simulated LSM9DS1 IMU on the host I2C bus
+  *
+  *
+  *
+  *
+**/
+
+#include "lsm9ds1_sim.h"
+
+#include "LSM9DS1_Registers.h"
+
+// I2C addresses of the two parts of the IMU
+const uint8_t AG_ADDRESS = 0x6b;
+const uint8_t M_ADDRESS = 0x1e;
+// Samples the FIFO holds
+const size_t FIFO_SIZE = 32;
+
+static int16_t to_raw(float value, float resolution) {
+  float raw = roundf(value / resolution);
+  return static_cast<int16_t>(constrain(raw, -32768.0f, 32767.0f));
+}
+
+LSM9DS1Sim::LSM9DS1Sim()
+  : ag_port(this, false), m_port(this, true), period(0), next_due(0), overrun(false), lost(0),
+    accel_read(false), gyro_read(false) {
+  memset(ag_regs, 0, sizeof(ag_regs));
+  memset(m_regs, 0, sizeof(m_regs));
+  ag_regs[WHO_AM_I_XG] = WHO_AM_I_AG_RSP;
+  m_regs[WHO_AM_I_M] = WHO_AM_I_M_RSP;
+}
+
+void LSM9DS1Sim::attach(TwoWire& wire) {
+  wire.host_attach(AG_ADDRESS, &ag_port);
+  wire.host_attach(M_ADDRESS, &m_port);
+}
+
+float LSM9DS1Sim::accel_resolution() const {
+  switch ((ag_regs[CTRL_REG6_XL] >> 3) & 0x3) {
+    case 0x1: return 0.000732f;
+    case 0x2: return 0.000122f;
+    case 0x3: return 0.000244f;
+    default:  return 0.000061f;
+  }
+}
+
+float LSM9DS1Sim::gyro_resolution() const {
+  switch ((ag_regs[CTRL_REG1_G] >> 3) & 0x3) {
+    case 0x1: return 0.0175f;
+    case 0x3: return 0.07f;
+    default:  return 0.00875f;
+  }
+}
+
+void LSM9DS1Sim::push_sample(float ax, float ay, float az, float gx, float gy, float gz) {
+  Sample sample;
+  sample.accel[0] = to_raw(ax, accel_resolution());
+  sample.accel[1] = to_raw(ay, accel_resolution());
+  sample.accel[2] = to_raw(az, accel_resolution());
+  sample.gyro[0] = to_raw(gx, gyro_resolution());
+  sample.gyro[1] = to_raw(gy, gyro_resolution());
+  sample.gyro[2] = to_raw(gz, gyro_resolution());
+  push_raw(sample);
+}
+
+void LSM9DS1Sim::push_raw(const Sample& sample) {
+  Queued queued = {sample, next_due};
+  if (period != 0) {
+    next_due += period;
+  }
+  samples.push_back(queued);
+}
+
+void LSM9DS1Sim::pace(float rate) {
+  period = rate > 0 ? static_cast<unsigned long>(1000000.0f / rate + 0.5f) : 0;
+  next_due = micros();
+  for (Queued& queued : samples) {
+    queued.due = next_due;
+    if (period != 0) {
+      next_due += period;
+    }
+  }
+}
+
+bool LSM9DS1Sim::fifo_enabled() const {
+  // FIFO_EN in CTRL_REG9 and a FIFO mode in FIFO_CTRL
+  return (ag_regs[CTRL_REG9] & 0x02) && (ag_regs[FIFO_CTRL] >> 5) != 0;
+}
+
+size_t LSM9DS1Sim::available() {
+  if (samples.empty() && empty_handler) {
+    empty_handler();
+  }
+  unsigned long now = micros();
+  size_t count = 0;
+  while (count < samples.size() && static_cast<long>(now - samples[count].due) >= 0) {
+    count++;
+  }
+  // A full FIFO in continuous mode overwrites the oldest sample
+  if (fifo_enabled() && count > FIFO_SIZE) {
+    size_t dropped = count - FIFO_SIZE;
+    samples.erase(samples.begin(), samples.begin() + dropped);
+    accel_read = false;
+    gyro_read = false;
+    lost += dropped;
+    overrun = true;
+    count = FIFO_SIZE;
+  }
+  return count;
+}
+
+uint8_t LSM9DS1Sim::status() {
+  if (available() == 0) {
+    return 0;
+  }
+  return (accel_read ? 0 : 0x01) | (gyro_read ? 0 : 0x02);
+}
+
+uint8_t LSM9DS1Sim::fifo_status() {
+  size_t count = available();
+  uint8_t threshold = ag_regs[FIFO_CTRL] & 0x1F;
+  return (count > threshold ? 0x80 : 0) | (overrun ? 0x40 : 0) | static_cast<uint8_t>(count);
+}
+
+uint8_t LSM9DS1Sim::read_register(uint8_t reg) {
+  // Output registers of the current sample, the sample is done when both have been read
+  if (reg >= OUT_X_L_XL && reg < OUT_X_L_XL + 6) {
+    if (samples.empty()) {
+      return 0;
+    }
+    int16_t value = samples.front().sample.accel[(reg - OUT_X_L_XL) / 2];
+    if (reg == OUT_X_L_XL + 5) {
+      accel_read = true;
+    }
+    return (reg - OUT_X_L_XL) % 2 ? (value >> 8) & 0xFF : value & 0xFF;
+  }
+  if (reg >= OUT_X_L_G && reg < OUT_X_L_G + 6) {
+    if (samples.empty()) {
+      return 0;
+    }
+    int16_t value = samples.front().sample.gyro[(reg - OUT_X_L_G) / 2];
+    if (reg == OUT_X_L_G + 5) {
+      gyro_read = true;
+    }
+    return (reg - OUT_X_L_G) % 2 ? (value >> 8) & 0xFF : value & 0xFF;
+  }
+  if (reg == STATUS_REG_0 || reg == STATUS_REG_1) {
+    return status();
+  }
+  if (reg == FIFO_SRC) {
+    return fifo_status();
+  }
+  return ag_regs[reg];
+}
+
+uint8_t LSM9DS1Sim::next_register(uint8_t reg) const {
+  // With the FIFO enabled the address rolls over from the gyroscope to the accelerometer
+  // output registers, and from there to the gyroscope output registers of the next sample
+  if (fifo_enabled()) {
+    if (reg == OUT_X_L_G + 5) {
+      return OUT_X_L_XL;
+    }
+    if (reg == OUT_X_L_XL + 5) {
+      return OUT_X_L_G;
+    }
+  }
+  return (reg + 1) & 0x7F;
+}
+
+void LSM9DS1Sim::Port::i2c_write(const uint8_t* data, size_t length) {
+  if (length == 0) {
+    return;
+  }
+  // The first byte is the register, the driver sets bit 7 for reading more registers
+  reg = data[0] & 0x7F;
+  uint8_t* regs = magnetometer ? sim->m_regs : sim->ag_regs;
+  for (size_t i = 1; i < length; i++) {
+    regs[reg] = data[i];
+    reg = (reg + 1) & 0x7F;
+  }
+}
+
+size_t LSM9DS1Sim::Port::i2c_read(uint8_t* data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if (magnetometer) {
+      data[i] = sim->m_regs[reg];
+      reg = (reg + 1) & 0x7F;
+      continue;
+    }
+    data[i] = sim->read_register(reg);
+    reg = sim->next_register(reg);
+    // The sample is done when both the accelerometer and gyroscope values have been read
+    if (sim->accel_read && sim->gyro_read) {
+      sim->samples.pop_front();
+      sim->accel_read = false;
+      sim->gyro_read = false;
+      sim->overrun = false;
+    }
+  }
+  return length;
+}
@@ -0,0 +1,134 @@
+/**
+  *
+  *
+  * @file:    lsm9ds1_sim.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Simulated LSM9DS1 IMU on the host I2C bus
+  *
+  *   Answers the registers used by LSM9DS1Class, so the sketch reads its
+  *   samples through the real IMU driver. The samples are queued by the host
+  *   and are converted to the raw 16-bit values of the chosen scales, so the
+  *   sketch gets the same resolution as on the board.
+  *
+  *   When the driver enables the FIFO, the queued samples are read through
+  *   FIFO_SRC and burst reads from OUT_X_L_G like on the LSM9DS1. With pace()
+  *   the samples only become available at the sample rate on the virtual
+  *   clock, and the FIFO overruns if it isn't read in time.
+  *
+**/
+
+#ifndef HOST_LSM9DS1_SIM_H_
+#define HOST_LSM9DS1_SIM_H_
+
+#include <deque>
+#include <functional>
+
+#include <Wire.h>
+
+/**
+* @brief  LSM9DS1Sim: Simulated accelerometer/gyroscope and magnetometer
+*
+**/
+class LSM9DS1Sim {
+  public:
+    struct Sample {
+      int16_t accel[3];               /**<  Raw accelerometer x, y and z values   */
+      int16_t gyro[3];                /**<  Raw gyroscope x, y and z values   */
+    };
+
+    LSM9DS1Sim();
+
+    /**
+    * @brief  attach(): Attach the accelerometer/gyroscope and magnetometer to the bus
+    *
+    * @param TwoWire& wire: The bus used by the IMU driver.
+    * @return void
+    *
+    **/
+    void attach(TwoWire& wire);
+
+    /**
+    * @brief  push_sample(): Queue a sample in g's and degrees per second
+    *
+    *   The values are converted with the scales set in the registers by the driver,
+    *   so the driver must have been started before samples are pushed.
+    *
+    * @return void
+    *
+    **/
+    void push_sample(float ax, float ay, float az, float gx, float gy, float gz);
+
+    /**
+    * @brief  push_raw(): Queue a sample with raw 16-bit values
+    *
+    * @param const Sample& sample: The raw sample.
+    * @return void
+    *
+    **/
+    void push_raw(const Sample& sample);
+
+    /**
+    * @brief  pace(): Make the queued and following samples available at a sample rate
+    *
+    *   The first queued sample is available now, and the following ones one sample period
+    *   after each other on the virtual clock. A rate of 0 makes every sample available at once.
+    *
+    * @param float rate: Sample rate in Hz.
+    * @return void
+    *
+    **/
+    void pace(float rate);
+
+    // Amount of queued samples, which haven't been read by the driver
+    size_t pending() const { return samples.size(); };
+
+    // Amount of samples lost, because the FIFO was full
+    unsigned long overruns() const { return lost; };
+
+    // Called when the driver polls for a sample and none is queued
+    void on_empty(std::function<void()> handler) { empty_handler = handler; };
+
+    // Accelerometer resolution in g's per tick and gyroscope resolution in degrees per second per tick
+    float accel_resolution() const;
+    float gyro_resolution() const;
+
+  private:
+    class Port : public I2CDevice {
+      public:
+        Port(LSM9DS1Sim* sim, bool magnetometer) : sim(sim), magnetometer(magnetometer), reg(0) {};
+        void i2c_write(const uint8_t* data, size_t length) override;
+        size_t i2c_read(uint8_t* data, size_t length) override;
+      private:
+        LSM9DS1Sim* sim;
+        bool magnetometer;
+        uint8_t reg;                  /**<  Register pointer set by the last write   */
+    };
+
+    struct Queued {
+      Sample sample;
+      unsigned long due;              /**<  Time in us when the sample is available   */
+    };
+
+    uint8_t read_register(uint8_t reg);
+    uint8_t next_register(uint8_t reg) const;
+    uint8_t status();
+    uint8_t fifo_status();
+    bool fifo_enabled() const;
+    size_t available();
+
+    Port ag_port;                     /**<  Accelerometer/gyroscope on address 0x6b   */
+    Port m_port;                      /**<  Magnetometer on address 0x1e   */
+    uint8_t ag_regs[128];             /**<  Accelerometer/gyroscope register file   */
+    uint8_t m_regs[128];              /**<  Magnetometer register file   */
+    std::deque<Queued> samples;       /**<  Queued samples, front is the current sample   */
+    unsigned long period;             /**<  Time in us between two samples, 0 when not paced   */
+    unsigned long next_due;           /**<  Time in us when the next pushed sample is available   */
+    bool overrun;                     /**<  Bool for samples lost since the FIFO was last read   */
+    unsigned long lost;               /**<  Amount of samples lost, because the FIFO was full   */
+    bool accel_read;                  /**<  Bool for whether the current accelerometer values have been read   */
+    bool gyro_read;                   /**<  Bool for whether the current gyroscope values have been read   */
+    std::function<void()> empty_handler;
+};
+
+#endif  // HOST_LSM9DS1_SIM_H_
@@ -0,0 +1,106 @@
+/**
+  *
+  *
+  * @file:    model_batching.cpp
+  * @date:    17-10-2026 07:19:36
+  *
+  * @brief    Copies of the fall models with a batch dimension, to run many feature vectors per Invoke()
+  *
+**/
+
+#include "model_batching.h"
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+size_t type_size(tflite::TensorType type) {
+  switch (type) {
+    case tflite::TensorType_FLOAT32:
+    case tflite::TensorType_INT32:
+      return 4;
+    case tflite::TensorType_INT16:
+      return 2;
+    case tflite::TensorType_INT8:
+    case tflite::TensorType_UINT8:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// The tensors planned in the arena, which have no data in the model
+bool has_data(const tflite::Model* model, const tflite::Tensor* tensor) {
+  const tflite::Buffer* buffer = model->buffers()->Get(tensor->buffer());
+  return buffer->data() != nullptr && buffer->data()->size() > 0;
+}
+
+const tflite::SubGraph* main_subgraph(const tflite::Model* model) {
+  if (model->subgraphs() == nullptr || model->subgraphs()->size() != 1 || model->buffers() == nullptr) {
+    return nullptr;
+  }
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  if (subgraph->tensors() == nullptr || subgraph->inputs() == nullptr || subgraph->inputs()->size() != 1) {
+    return nullptr;
+  }
+  return subgraph;
+}
+
+}  // namespace
+
+int model_batch(const unsigned char* data) {
+  const tflite::Model* model = tflite::GetModel(data);
+  const tflite::SubGraph* subgraph = main_subgraph(model);
+  if (subgraph == nullptr) {
+    return 0;
+  }
+  const tflite::Tensor* input = subgraph->tensors()->Get(subgraph->inputs()->Get(0));
+  return input->shape() != nullptr && input->shape()->size() > 0 ? input->shape()->Get(0) : 0;
+}
+
+size_t batch_row_bytes(const unsigned char* data) {
+  const tflite::Model* model = tflite::GetModel(data);
+  const tflite::SubGraph* subgraph = main_subgraph(model);
+  int batch = model_batch(data);
+  if (subgraph == nullptr || batch <= 0) {
+    return 0;
+  }
+  size_t bytes = 0;
+  for (const tflite::Tensor* tensor : *subgraph->tensors()) {
+    if (has_data(model, tensor) || tensor->shape() == nullptr || tensor->shape()->size() == 0 ||
+        tensor->shape()->Get(0) != batch) {
+      continue;
+    }
+    size_t elements = 1;
+    for (size_t d = 1; d < tensor->shape()->size(); d++) {
+      elements *= tensor->shape()->Get(d);
+    }
+    bytes += elements * type_size(tensor->type());
+  }
+  return bytes;
+}
+
+bool batch_model(const unsigned char* data, int length, int batch, std::vector<uint8_t>& flatbuffer) {
+  if (length <= 0 || batch < 1) {
+    return false;
+  }
+  flatbuffer.assign(data, data + length);
+  flatbuffers::Verifier verifier(flatbuffer.data(), flatbuffer.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    return false;
+  }
+  int current = model_batch(flatbuffer.data());
+  if (current <= 0) {
+    return false;
+  }
+
+  // The shapes have the same size in the copy, so they are changed in place
+  const tflite::Model* model = tflite::GetModel(flatbuffer.data());
+  for (const tflite::Tensor* tensor : *main_subgraph(model)->tensors()) {
+    if (!has_data(model, tensor) && tensor->shape() != nullptr && tensor->shape()->size() > 0 &&
+        tensor->shape()->Get(0) == current) {
+      const_cast<flatbuffers::Vector<int32_t>*>(tensor->shape())->Mutate(0, batch);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,62 @@
+/**
+  *
+  *
+  * @file:    model_batching.h
+  * @date:    17-10-2026 07:19:36
+  *
+  * @brief    Copies of the fall models with a batch dimension, to run many feature vectors per Invoke()
+  *
+  *   The models take a [1, 46] input, and the MicroInterpreter of TensorFlow
+  *   Lite Micro 1.15 can't resize its input. The copy of a model has the first
+  *   dimension of every tensor without data, the input, the intermediate
+  *   tensors and the output, set to the batch. The weights, the operators and
+  *   their versions are the same as in the model, and the fully connected,
+  *   activation and softmax kernels run every row of the batch like a single
+  *   feature vector.
+  *
+  *   Only the flatbuffer schema is needed, not the TensorFlow Lite sources.
+  *
+**/
+
+#ifndef HOST_MODEL_BATCHING_H_
+#define HOST_MODEL_BATCHING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+/**
+* @brief  model_batch(): The batch dimension of a model
+*
+* @param const unsigned char* data: The flatbuffer of the model.
+* @return int: The first dimension of the input, 0 if the model has no input
+*
+**/
+int model_batch(const unsigned char* data);
+
+/**
+* @brief  batch_row_bytes(): Bytes of the tensors growing with the batch, for every row of the batch
+*
+*   The tensor arena of a batched model needs about this many bytes more for
+*   every row beyond the first.
+*
+* @param const unsigned char* data: The flatbuffer of the model.
+* @return size_t: Bytes of the input, intermediate and output tensors of one row
+*
+**/
+size_t batch_row_bytes(const unsigned char* data);
+
+/**
+* @brief  batch_model(): Copy a model with another batch dimension
+*
+* @param const unsigned char* data: The flatbuffer of the model.
+* @param int length: Length of the flatbuffer in bytes.
+* @param int batch: The batch of the copy, at least 1.
+* @param std::vector<uint8_t>& flatbuffer: The flatbuffer of the copy.
+* @return bool: true if the model could be read and copied
+*
+**/
+bool batch_model(const unsigned char* data, int length, int batch, std::vector<uint8_t>& flatbuffer);
+
+#endif  // HOST_MODEL_BATCHING_H_
@@ -0,0 +1,481 @@
+/**
+  *
+  *
+  * @file:    model_quantizer.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Post-training int8 quantization of the fall models, and a reference of the int8 inference
+  *
+  *
+  *
+  *
+**/
+
+#include "model_quantizer.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "model_quantization.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+namespace {
+
+// Tensors of the int8 models made by quantize_model()
+enum Int8Tensor {
+  kInput,
+  kHiddenWeights,
+  kHiddenBias,
+  kHiddenOutput,
+  kHiddenOutputFloat,
+  kActivation,
+  kActivationInt8,
+  kOutputWeights,
+  kOutputBias,
+  kOutputOutput,
+  kOutputOutputFloat,
+  kIdentity,
+  kTensorAmount
+};
+
+// Operators of the int8 models, in the order they are run
+const tflite::BuiltinOperator kInt8Operators[] = {
+  tflite::BuiltinOperator_FULLY_CONNECTED, tflite::BuiltinOperator_DEQUANTIZE,
+  tflite::BuiltinOperator_LOGISTIC,        tflite::BuiltinOperator_QUANTIZE,
+  tflite::BuiltinOperator_FULLY_CONNECTED, tflite::BuiltinOperator_DEQUANTIZE,
+  tflite::BuiltinOperator_SOFTMAX,
+};
+const int kInt8OperatorAmount = sizeof(kInt8Operators) / sizeof(kInt8Operators[0]);
+
+// Scale and zero point of a quantized tensor
+struct QuantParams {
+  float scale;
+  int zero_point;
+};
+
+// Asymmetric int8 parameters covering [min, max], which always includes 0 so it is exact
+QuantParams asymmetric_params(float min, float max) {
+  min = std::min(min, 0.0f);
+  max = std::max(max, 0.0f);
+  QuantParams params;
+  params.scale = max > min ? (max - min) / 255.0f : 1.0f;
+  float zero_point = roundf(-128.0f - min / params.scale);
+  params.zero_point = static_cast<int>(std::max(-128.0f, std::min(127.0f, zero_point)));
+  return params;
+}
+
+// Symmetric int8 parameters of a weight tensor, the zero point is always 0
+QuantParams symmetric_params(const std::vector<float>& values) {
+  float max = 0;
+  for (float value : values) {
+    max = std::max(max, fabsf(value));
+  }
+  QuantParams params;
+  params.scale = max > 0 ? max / 127.0f : 1.0f;
+  params.zero_point = 0;
+  return params;
+}
+
+// The multiplier as a Q31 value and a power of two exponent, like QuantizeMultiplier() of TensorFlow Lite
+void quantize_multiplier(double multiplier, int32_t* quantized, int* shift) {
+  if (multiplier == 0) {
+    *quantized = 0;
+    *shift = 0;
+    return;
+  }
+  double q = frexp(multiplier, shift);
+  int64_t q_fixed = static_cast<int64_t>(round(q * (1ll << 31)));
+  if (q_fixed == (1ll << 31)) {
+    q_fixed /= 2;
+    ++*shift;
+  }
+  *quantized = static_cast<int32_t>(q_fixed);
+}
+
+float sigmoid(float x) {
+  return 1.0f / (1.0f + expf(-x));
+}
+
+void softmax(const float in[2], float out[2]) {
+  float max = std::max(in[0], in[1]);
+  float e0 = expf(in[0] - max);
+  float e1 = expf(in[1] - max);
+  out[0] = e0 / (e0 + e1);
+  out[1] = e1 / (e0 + e1);
+}
+
+// Float fully connected layer without activation
+void dense(const DenseLayer& layer, const float in[], float out[]) {
+  for (int o = 0; o < layer.outputs; o++) {
+    float acc = layer.bias[o];
+    const float* w = &layer.weights[o * layer.inputs];
+    for (int i = 0; i < layer.inputs; i++) {
+      acc += w[i] * in[i];
+    }
+    out[o] = acc;
+  }
+}
+
+void update_range(const float values[], int n, float range[2]) {
+  for (int i = 0; i < n; i++) {
+    range[0] = std::min(range[0], values[i]);
+    range[1] = std::max(range[1], values[i]);
+  }
+}
+
+// Copies the float values of a constant tensor
+bool read_floats(const tflite::Model* model, const tflite::Tensor* tensor, std::vector<float>& values) {
+  if (tensor->type() != tflite::TensorType_FLOAT32 || tensor->buffer() >= model->buffers()->size()) {
+    return false;
+  }
+  const flatbuffers::Vector<uint8_t>* data = model->buffers()->Get(tensor->buffer())->data();
+  if (data == nullptr || data->size() % sizeof(float) != 0) {
+    return false;
+  }
+  values.resize(data->size() / sizeof(float));
+  memcpy(values.data(), data->data(), data->size());
+  return true;
+}
+
+bool read_layer(const tflite::Model* model, const tflite::Operator* op, DenseLayer& layer) {
+  const auto* tensors = model->subgraphs()->Get(0)->tensors();
+  if (op->inputs()->size() != 3) {
+    return false;
+  }
+  // The activation is its own operator, a fused one isn't run by the models reading the layer
+  const tflite::FullyConnectedOptions* options = op->builtin_options_as_FullyConnectedOptions();
+  if (options != nullptr && options->fused_activation_function() != tflite::ActivationFunctionType_NONE) {
+    return false;
+  }
+  const tflite::Tensor* weights = tensors->Get(op->inputs()->Get(1));
+  const tflite::Tensor* bias = tensors->Get(op->inputs()->Get(2));
+  if (weights->shape()->size() != 2 || !read_floats(model, weights, layer.weights) ||
+      !read_floats(model, bias, layer.bias)) {
+    return false;
+  }
+  layer.outputs = weights->shape()->Get(0);
+  layer.inputs = weights->shape()->Get(1);
+  return layer.weights.size() == static_cast<size_t>(layer.outputs * layer.inputs) &&
+         layer.bias.size() == static_cast<size_t>(layer.outputs);
+}
+
+// Builds the int8 model flatbuffer
+class Int8ModelBuilder {
+  public:
+    Int8ModelBuilder() : builder(4096) {
+      // Buffer 0 is the empty buffer of the tensors without data
+      buffers.push_back(tflite::CreateBuffer(builder));
+    }
+
+    // Adds a tensor with its own buffer, holding the data of constant tensors
+    void add_tensor(const char* name, tflite::TensorType type, std::vector<int32_t> shape, QuantParams* params,
+                    const void* data = nullptr, size_t bytes = 0) {
+      flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data_vector = 0;
+      if (data != nullptr) {
+        // The int32 biases are read in place, so the data is aligned like the converter does
+        builder.ForceVectorAlignment(bytes, sizeof(uint8_t), 16);
+        data_vector = builder.CreateVector(static_cast<const uint8_t*>(data), bytes);
+      }
+      int buffer = static_cast<int>(buffers.size());
+      buffers.push_back(tflite::CreateBuffer(builder, data_vector));
+
+      flatbuffers::Offset<tflite::QuantizationParameters> quantization = 0;
+      if (params != nullptr) {
+        std::vector<float> scale(1, params->scale);
+        std::vector<int64_t> zero_point(1, params->zero_point);
+        quantization = tflite::CreateQuantizationParametersDirect(builder, nullptr, nullptr, &scale, &zero_point);
+      }
+      tensors.push_back(tflite::CreateTensorDirect(builder, &shape, type, buffer, name, quantization));
+    }
+
+    void add_operator(int opcode, std::vector<int32_t> inputs, std::vector<int32_t> outputs,
+                      tflite::BuiltinOptions options_type = tflite::BuiltinOptions_NONE,
+                      flatbuffers::Offset<void> options = 0) {
+      operators.push_back(tflite::CreateOperatorDirect(builder, opcode, &inputs, &outputs, options_type, options));
+    }
+
+    // Adds a metadata entry with its own buffer
+    void add_metadata(const char* name, const void* data, size_t bytes) {
+      builder.ForceVectorAlignment(bytes, sizeof(uint8_t), 16);
+      flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data_vector =
+        builder.CreateVector(static_cast<const uint8_t*>(data), bytes);
+      uint32_t buffer = static_cast<uint32_t>(buffers.size());
+      buffers.push_back(tflite::CreateBuffer(builder, data_vector));
+      metadata.push_back(tflite::CreateMetadataDirect(builder, name, buffer));
+    }
+
+    void finish(const std::vector<tflite::BuiltinOperator>& opcodes, std::vector<uint8_t>& flatbuffer) {
+      std::vector<flatbuffers::Offset<tflite::OperatorCode>> codes;
+      for (tflite::BuiltinOperator opcode : opcodes) {
+        // Version 1 of every operator, the micro op resolver registers the int8 kernels as version 1
+        codes.push_back(tflite::CreateOperatorCode(builder, opcode, 0, 1));
+      }
+      std::vector<int32_t> inputs(1, kInput);
+      std::vector<int32_t> outputs(1, kIdentity);
+      std::vector<flatbuffers::Offset<tflite::SubGraph>> subgraphs(
+        1, tflite::CreateSubGraphDirect(builder, &tensors, &inputs, &outputs, &operators, "main"));
+      flatbuffers::Offset<tflite::Model> model = tflite::CreateModelDirect(
+        builder, TFLITE_SCHEMA_VERSION, &codes, &subgraphs, "Quantized to int8 by quantize_model", &buffers,
+        nullptr, &metadata);
+      tflite::FinishModelBuffer(builder, model);
+      flatbuffer.assign(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+
+  private:
+    std::vector<flatbuffers::Offset<tflite::Buffer>> buffers;
+    std::vector<flatbuffers::Offset<tflite::Tensor>> tensors;
+    std::vector<flatbuffers::Offset<tflite::Operator>> operators;
+    std::vector<flatbuffers::Offset<tflite::Metadata>> metadata;
+};
+
+std::vector<int8_t> quantize_weights(const std::vector<float>& weights, QuantParams params) {
+  std::vector<int8_t> q(weights.size());
+  for (size_t i = 0; i < weights.size(); i++) {
+    q[i] = quantize_value(weights[i], params.scale, params.zero_point);
+  }
+  return q;
+}
+
+// The bias is added to the int32 accumulator, so its scale is the input scale times the weights scale
+std::vector<int32_t> quantize_bias(const std::vector<float>& bias, float scale) {
+  std::vector<int32_t> q(bias.size());
+  for (size_t i = 0; i < bias.size(); i++) {
+    q[i] = static_cast<int32_t>(round(bias[i] / scale));
+  }
+  return q;
+}
+
+QuantParams tensor_params(const tflite::Tensor* tensor) {
+  QuantParams params = {0, 0};
+  const tflite::QuantizationParameters* quantization = tensor->quantization();
+  if (quantization != nullptr && quantization->scale() != nullptr && quantization->scale()->size() == 1 &&
+      quantization->zero_point() != nullptr && quantization->zero_point()->size() == 1) {
+    params.scale = quantization->scale()->Get(0);
+    params.zero_point = static_cast<int>(quantization->zero_point()->Get(0));
+  }
+  return params;
+}
+
+}  // namespace
+
+bool DenseModel::read(const unsigned char* data) {
+  const tflite::Model* model = tflite::GetModel(data);
+  if (model->subgraphs() == nullptr || model->subgraphs()->size() != 1 || model->buffers() == nullptr) {
+    return false;
+  }
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  const auto* ops = subgraph->operators();
+  if (ops == nullptr || ops->size() != 4) {
+    return false;
+  }
+  tflite::BuiltinOperator codes[4];
+  for (int i = 0; i < 4; i++) {
+    codes[i] = model->operator_codes()->Get(ops->Get(i)->opcode_index())->builtin_code();
+  }
+  if (codes[0] != tflite::BuiltinOperator_FULLY_CONNECTED || codes[2] != tflite::BuiltinOperator_FULLY_CONNECTED ||
+      codes[3] != tflite::BuiltinOperator_SOFTMAX ||
+      (codes[1] != tflite::BuiltinOperator_LOGISTIC && codes[1] != tflite::BuiltinOperator_TANH)) {
+    return false;
+  }
+  // The softmax is run without a beta
+  const tflite::SoftmaxOptions* softmax = ops->Get(3)->builtin_options_as_SoftmaxOptions();
+  if (softmax == nullptr || softmax->beta() != 1.0f) {
+    return false;
+  }
+  tanh = codes[1] == tflite::BuiltinOperator_TANH;
+  return read_layer(model, ops->Get(0), hidden) && read_layer(model, ops->Get(2), output) &&
+         hidden.inputs == FEATURE_AMOUNT && output.inputs == hidden.outputs && output.outputs == 2;
+}
+
+void DenseModel::classify(const float features[FEATURE_AMOUNT], float result[2],
+                          float hidden_range[2], float output_range[2]) const {
+  std::vector<float> h(hidden.outputs);
+  dense(hidden, features, h.data());
+  if (hidden_range != nullptr) {
+    update_range(h.data(), hidden.outputs, hidden_range);
+  }
+  for (float& value : h) {
+    value = tanh ? tanhf(value) : sigmoid(value);
+  }
+  float logits[2];
+  dense(output, h.data(), logits);
+  if (output_range != nullptr) {
+    update_range(logits, 2, output_range);
+  }
+  softmax(logits, result);
+}
+
+void quantize_model(const DenseModel& model, const float* const calibration[], int count,
+                    std::vector<uint8_t>& flatbuffer) {
+  // The scale of every feature is its largest magnitude in the calibration features
+  std::vector<float> feature_scales(FEATURE_AMOUNT, 0.0f);
+  for (int n = 0; n < count; n++) {
+    for (int i = 0; i < FEATURE_AMOUNT; i++) {
+      feature_scales[i] = std::max(feature_scales[i], fabsf(calibration[n][i]));
+    }
+  }
+  for (float& scale : feature_scales) {
+    scale = scale > 0 ? scale : 1.0f;
+  }
+  // The hidden layer multiplies the scaled features by the scaled weights, which gives the same outputs
+  DenseLayer hidden = model.hidden;
+  for (int o = 0; o < hidden.outputs; o++) {
+    for (int i = 0; i < hidden.inputs; i++) {
+      hidden.weights[o * hidden.inputs + i] *= feature_scales[i];
+    }
+  }
+
+  // Ranges of the scaled input and of the fully connected outputs, found with the float model
+  float input_range[2] = {0, 0};
+  float hidden_range[2] = {0, 0};
+  float output_range[2] = {0, 0};
+  for (int n = 0; n < count; n++) {
+    float result[2];
+    float scaled[FEATURE_AMOUNT];
+    for (int i = 0; i < FEATURE_AMOUNT; i++) {
+      scaled[i] = calibration[n][i] / feature_scales[i];
+    }
+    update_range(scaled, FEATURE_AMOUNT, input_range);
+    model.classify(calibration[n], result, hidden_range, output_range);
+  }
+  QuantParams input = asymmetric_params(input_range[0], input_range[1]);
+  QuantParams hidden_out = asymmetric_params(hidden_range[0], hidden_range[1]);
+  QuantParams output_out = asymmetric_params(output_range[0], output_range[1]);
+  // The fixed output ranges of the activations, [0, 1] and [-1, 1]
+  QuantParams activation = model.tanh ? QuantParams{1.0f / 128.0f, 0} : QuantParams{1.0f / 256.0f, -128};
+
+  QuantParams hidden_w = symmetric_params(hidden.weights);
+  QuantParams output_w = symmetric_params(model.output.weights);
+  QuantParams hidden_b = {static_cast<float>(static_cast<double>(input.scale) * hidden_w.scale), 0};
+  QuantParams output_b = {static_cast<float>(static_cast<double>(activation.scale) * output_w.scale), 0};
+  std::vector<int8_t> hidden_weights = quantize_weights(hidden.weights, hidden_w);
+  std::vector<int32_t> hidden_bias = quantize_bias(hidden.bias, hidden_b.scale);
+  std::vector<int8_t> output_weights = quantize_weights(model.output.weights, output_w);
+  std::vector<int32_t> output_bias = quantize_bias(model.output.bias, output_b.scale);
+
+  const int32_t H = model.hidden.outputs;
+  Int8ModelBuilder b;
+  b.add_tensor("input", tflite::TensorType_INT8, {1, FEATURE_AMOUNT}, &input);
+  b.add_tensor("hidden/weights", tflite::TensorType_INT8, {H, FEATURE_AMOUNT}, &hidden_w,
+               hidden_weights.data(), hidden_weights.size());
+  b.add_tensor("hidden/bias", tflite::TensorType_INT32, {H}, &hidden_b,
+               hidden_bias.data(), hidden_bias.size() * sizeof(int32_t));
+  b.add_tensor("hidden/output", tflite::TensorType_INT8, {1, H}, &hidden_out);
+  b.add_tensor("hidden/output_float", tflite::TensorType_FLOAT32, {1, H}, nullptr);
+  b.add_tensor(model.tanh ? "hidden/tanh" : "hidden/sigmoid", tflite::TensorType_FLOAT32, {1, H}, nullptr);
+  b.add_tensor("hidden/activation", tflite::TensorType_INT8, {1, H}, &activation);
+  b.add_tensor("output/weights", tflite::TensorType_INT8, {2, H}, &output_w,
+               output_weights.data(), output_weights.size());
+  b.add_tensor("output/bias", tflite::TensorType_INT32, {2}, &output_b,
+               output_bias.data(), output_bias.size() * sizeof(int32_t));
+  b.add_tensor("output/output", tflite::TensorType_INT8, {1, 2}, &output_out);
+  b.add_tensor("output/output_float", tflite::TensorType_FLOAT32, {1, 2}, nullptr);
+  b.add_tensor("Identity", tflite::TensorType_FLOAT32, {1, 2}, nullptr);
+
+  std::vector<tflite::BuiltinOperator> opcodes(kInt8Operators, kInt8Operators + kInt8OperatorAmount);
+  if (model.tanh) {
+    opcodes[2] = tflite::BuiltinOperator_TANH;
+  }
+  b.add_operator(0, {kInput, kHiddenWeights, kHiddenBias}, {kHiddenOutput},
+                 tflite::BuiltinOptions_FullyConnectedOptions,
+                 tflite::CreateFullyConnectedOptions(b.builder).Union());
+  b.add_operator(1, {kHiddenOutput}, {kHiddenOutputFloat});
+  b.add_operator(2, {kHiddenOutputFloat}, {kActivation});
+  b.add_operator(3, {kActivation}, {kActivationInt8});
+  b.add_operator(4, {kActivationInt8, kOutputWeights, kOutputBias}, {kOutputOutput},
+                 tflite::BuiltinOptions_FullyConnectedOptions,
+                 tflite::CreateFullyConnectedOptions(b.builder).Union());
+  b.add_operator(5, {kOutputOutput}, {kOutputOutputFloat});
+  b.add_operator(6, {kOutputOutputFloat}, {kIdentity}, tflite::BuiltinOptions_SoftmaxOptions,
+                 tflite::CreateSoftmaxOptions(b.builder, 1.0f).Union());
+  b.add_metadata(FEATURE_SCALES_METADATA, feature_scales.data(), feature_scales.size() * sizeof(float));
+  b.finish(opcodes, flatbuffer);
+}
+
+bool Int8Reference::begin(const unsigned char* data) {
+  const tflite::Model* model = tflite::GetModel(data);
+  if (model->subgraphs() == nullptr || model->subgraphs()->size() != 1 || model->operator_codes() == nullptr ||
+      model->operator_codes()->size() != kInt8OperatorAmount) {
+    return false;
+  }
+  for (int i = 0; i < kInt8OperatorAmount; i++) {
+    tflite::BuiltinOperator code = model->operator_codes()->Get(i)->builtin_code();
+    bool activation = i == 2 && code == tflite::BuiltinOperator_TANH;
+    if (code != kInt8Operators[i] && !activation) {
+      return false;
+    }
+  }
+  tanh = model->operator_codes()->Get(2)->builtin_code() == tflite::BuiltinOperator_TANH;
+
+  const auto* tensors = model->subgraphs()->Get(0)->tensors();
+  if (tensors == nullptr || tensors->size() != kTensorAmount) {
+    return false;
+  }
+  QuantParams input = tensor_params(tensors->Get(kInput));
+  QuantParams activation = tensor_params(tensors->Get(kActivationInt8));
+  input_scale = input.scale;
+  input_zero_point = input.zero_point;
+  feature_scales = model_feature_scales(model, FEATURE_AMOUNT);
+  activation_scale = activation.scale;
+  activation_zero_point = activation.zero_point;
+
+  // Sets up a layer the same way as Prepare() of the int8 FULLY_CONNECTED kernel
+  auto setup = [&](Layer& layer, QuantParams in, int weights, int bias, int out) {
+    const tflite::Tensor* w = tensors->Get(weights);
+    QuantParams w_params = tensor_params(w);
+    QuantParams out_params = tensor_params(tensors->Get(out));
+    layer.outputs = w->shape()->Get(0);
+    layer.inputs = w->shape()->Get(1);
+    layer.weights = reinterpret_cast<const int8_t*>(model->buffers()->Get(w->buffer())->data()->data());
+    layer.bias = reinterpret_cast<const int32_t*>(
+      model->buffers()->Get(tensors->Get(bias)->buffer())->data()->data());
+    layer.input_offset = -in.zero_point;
+    layer.weights_offset = -w_params.zero_point;
+    layer.output_offset = out_params.zero_point;
+    layer.output_scale = out_params.scale;
+    double multiplier = static_cast<double>(in.scale) * w_params.scale / out_params.scale;
+    quantize_multiplier(multiplier, &layer.output_multiplier, &layer.output_shift);
+  };
+  setup(hidden, input, kHiddenWeights, kHiddenBias, kHiddenOutput);
+  setup(output, activation, kOutputWeights, kOutputBias, kOutputOutput);
+  return feature_scales != nullptr && input_scale > 0 && activation_scale > 0 && hidden.inputs == FEATURE_AMOUNT &&
+         output.inputs == hidden.outputs && output.outputs == 2;
+}
+
+void Int8Reference::classify(const float features[FEATURE_AMOUNT], float result[2]) const {
+  auto run = [](const Layer& layer, const int8_t* in, int8_t* out) {
+    tflite::FullyConnectedParams params;
+    params.input_offset = layer.input_offset;
+    params.weights_offset = layer.weights_offset;
+    params.output_offset = layer.output_offset;
+    params.output_multiplier = layer.output_multiplier;
+    params.output_shift = layer.output_shift;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+    tflite::reference_integer_ops::FullyConnected(
+      params, tflite::RuntimeShape({1, layer.inputs}), in, tflite::RuntimeShape({layer.outputs, layer.inputs}),
+      layer.weights, tflite::RuntimeShape({layer.outputs}), layer.bias, tflite::RuntimeShape({1, layer.outputs}),
+      out);
+  };
+
+  int8_t input[FEATURE_AMOUNT];
+  quantize_features(features, feature_scales, input, FEATURE_AMOUNT, input_scale, input_zero_point);
+  std::vector<int8_t> h(hidden.outputs);
+  run(hidden, input, h.data());
+  for (int8_t& q : h) {
+    float value = dequantize_value(q, hidden.output_scale, hidden.output_offset);
+    value = tanh ? tanhf(value) : sigmoid(value);
+    q = quantize_value(value, activation_scale, activation_zero_point);
+  }
+  int8_t logits_q[2];
+  run(output, h.data(), logits_q);
+  float logits[2];
+  dequantize_outputs(logits_q, logits, 2, output.output_scale, output.output_offset);
+  softmax(logits, result);
+}
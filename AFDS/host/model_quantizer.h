@@ -0,0 +1,153 @@
+/**
+  *
+  *
+  * @file:    model_quantizer.h
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Post-training int8 quantization of the fall models, and a reference of the int8 inference
+  *
+  *   The fall models are two fully connected layers, with a LOGISTIC or TANH
+  *   activation between them and a SOFTMAX at the end. The TensorFlow Lite
+  *   Micro 1.15 kernels only have int8 versions of FULLY_CONNECTED, QUANTIZE
+  *   and DEQUANTIZE, so the int8 models run both fully connected layers in int8
+  *   and the activations in float:
+  *
+  *     int8 input -> FULLY_CONNECTED -> DEQUANTIZE -> LOGISTIC/TANH -> QUANTIZE
+  *                -> FULLY_CONNECTED -> DEQUANTIZE -> SOFTMAX -> float output
+  *
+  *   The weights are quantized symmetrically per tensor and the biases to
+  *   int32, like the TensorFlow Lite converter does. The ranges of the input and
+  *   the fully connected outputs are calibrated with the float model on a set
+  *   of features.
+  *
+  *   None of this needs the TensorFlow Lite sources, only the flatbuffer schema
+  *   and the reference kernel headers in AFDS/src.
+  *
+**/
+
+#ifndef HOST_MODEL_QUANTIZER_H_
+#define HOST_MODEL_QUANTIZER_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "constants.h"
+
+/**
+* @brief  DenseLayer: A fully connected layer of a float model
+*
+**/
+struct DenseLayer {
+  int inputs;
+  int outputs;
+  std::vector<float> weights;   /**<  outputs x inputs weights, row major   */
+  std::vector<float> bias;      /**<  The outputs biases   */
+};
+
+/**
+* @brief  DenseModel: A float fall model
+*
+**/
+struct DenseModel {
+  DenseLayer hidden;
+  DenseLayer output;
+  bool tanh;                    /**<  The activation of the hidden layer is TANH, else LOGISTIC   */
+
+  /**
+  * @brief  read(): Read a float fall model from its flatbuffer
+  *
+  * @param const unsigned char* data: The flatbuffer.
+  * @return bool: true if the model is a float FULLY_CONNECTED, activation, FULLY_CONNECTED, SOFTMAX model,
+  *   without fused activations and with a softmax beta of 1
+  *
+  **/
+  bool read(const unsigned char* data);
+
+  /**
+  * @brief  classify(): Run float inference on the features
+  *
+  * @param const float features[]: The FEATURE_AMOUNT features of the signal.
+  * @param float output[]: The two outputs of the model (no fall, fall).
+  * @param float hidden_range[]: Updated with the minimum and maximum output of the hidden layer, if not null.
+  * @param float output_range[]: Updated with the minimum and maximum output of the output layer, if not null.
+  * @return void
+  *
+  **/
+  void classify(const float features[FEATURE_AMOUNT], float output[2],
+                float hidden_range[2] = nullptr, float output_range[2] = nullptr) const;
+};
+
+/**
+* @brief  quantize_model(): Quantize a float fall model to an int8 model
+*
+*   Every feature is scaled by the largest magnitude it has in the calibration
+*   features, and the scale is folded into the hidden weights, so the features
+*   share the int8 input range evenly. The feature scales are kept in the model.
+*
+* @param const DenseModel& model: The float model.
+* @param const float* const calibration[]: Features used to calibrate the ranges of the tensors.
+* @param int count: Amount of calibration features.
+* @param std::vector<uint8_t>& flatbuffer: The flatbuffer of the int8 model.
+* @return void
+*
+**/
+void quantize_model(const DenseModel& model, const float* const calibration[], int count,
+                    std::vector<uint8_t>& flatbuffer);
+
+/**
+* @brief  Int8Reference: Runs an int8 fall model with the int8 reference kernels of TensorFlow Lite
+*
+*   Used to check the accuracy of the int8 models without the TensorFlow Lite
+*   Micro interpreter. The fully connected layers use the same integer
+*   arithmetic as the int8 kernel of the interpreter.
+*
+**/
+class Int8Reference {
+  public:
+    /**
+    * @brief  begin(): Read an int8 model made by quantize_model()
+    *
+    * @param const unsigned char* data: The flatbuffer.
+    * @return bool: true if the model has the layout made by quantize_model()
+    *
+    **/
+    bool begin(const unsigned char* data);
+
+    /**
+    * @brief  classify(): Quantize the features and run int8 inference
+    *
+    * @param const float features[]: The FEATURE_AMOUNT features of the signal.
+    * @param float output[]: The two outputs of the model (no fall, fall).
+    * @return void
+    *
+    **/
+    void classify(const float features[FEATURE_AMOUNT], float output[2]) const;
+
+    float input_scale;
+    int input_zero_point;
+    const float* feature_scales;   /**<  The feature scales kept in the model   */
+
+  private:
+    // A quantized fully connected layer
+    struct Layer {
+      int inputs;
+      int outputs;
+      const int8_t* weights;
+      const int32_t* bias;
+      int32_t input_offset;
+      int32_t weights_offset;
+      int32_t output_offset;
+      int32_t output_multiplier;
+      int output_shift;
+      float output_scale;
+    };
+
+    Layer hidden;
+    Layer output;
+    bool tanh;
+    float activation_scale;
+    int activation_zero_point;
+};
+
+#endif  // HOST_MODEL_QUANTIZER_H_
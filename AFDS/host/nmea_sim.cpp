@@ -0,0 +1,128 @@
+/**
+  *
+  *
+  * @file:    nmea_sim.cpp
+  * @date:    17-10-2026 07:55:32
+  *
+  * @brief    Simulated NMEA output of the GPS module
+  *
+  *
+  *
+  *
+**/
+
+#include "nmea_sim.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace {
+
+const double METRES_PER_DEGREE = 111320.0;
+const double KNOTS_PER_MPS = 1.943844;
+
+// The satellites in view, as number, elevation, azimuth and signal to noise ratio
+const int SATELLITES[12][4] = {
+  {1, 40, 83, 46}, {2, 17, 308, 41}, {12, 7, 344, 39}, {14, 22, 228, 45},
+  {15, 52, 156, 48}, {17, 61, 52, 47}, {24, 33, 263, 44}, {32, 12, 119, 40},
+  {3, 5, 12, 0}, {6, 9, 200, 22}, {19, 3, 98, 0}, {22, 2, 287, 0},
+};
+
+std::string format(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+std::string format(const char* format, ...) {
+  char buffer[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  return buffer;
+}
+
+}  // namespace
+
+std::string nmea_sentence(const std::string& body) {
+  uint8_t checksum = 0;
+  for (char c : body) {
+    checksum ^= static_cast<uint8_t>(c);
+  }
+  return "$" + body + format("*%02X\r\n", checksum);
+}
+
+std::string nmea_degrees(double degrees, int degree_digits) {
+  degrees = fabs(degrees);
+  int whole = static_cast<int>(degrees);
+  long minutes = lround((degrees - whole) * 60 * 100000);
+  if (minutes >= 60 * 100000L) {
+    whole++;
+    minutes -= 60 * 100000L;
+  }
+  return format("%0*d%02ld.%05ld", degree_digits, whole, minutes / 100000, minutes % 100000);
+}
+
+void nmea_walk_position(const NmeaWalk& walk, int second, double* latitude, double* longitude) {
+  const double course = walk.course * M_PI / 180;
+  const double distance = walk.speed * second;
+  *latitude = walk.latitude + distance * cos(course) / METRES_PER_DEGREE;
+  *longitude = walk.longitude + distance * sin(course) / (METRES_PER_DEGREE * cos(walk.latitude * M_PI / 180));
+}
+
+std::string simulate_nmea(int seconds, const NmeaWalk& walk) {
+  std::string log;
+  for (int second = 0; second < seconds; second++) {
+    // The walk starts at 12:00:00 UTC
+    int time = (12 * 3600 + second) % (24 * 3600);
+    std::string utc = format("%02d%02d%02d.00", time / 3600, time / 60 % 60, time % 60);
+    const char* date = "181026";
+
+    if (second < walk.seconds_without_fix) {
+      log += nmea_sentence("GPRMC," + utc + ",V,,,,,,," + date + ",,,N");
+      log += nmea_sentence("GPVTG,,,,,,,,,N");
+      log += nmea_sentence("GPGGA," + utc + ",,,,,0,00,99.99,,,,,,");
+      log += nmea_sentence("GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+      log += nmea_sentence("GPGSV,1,1,00");
+      log += nmea_sentence("GPGLL,,,,," + utc + ",V,N");
+      continue;
+    }
+
+    double latitude, longitude;
+    nmea_walk_position(walk, second, &latitude, &longitude);
+    std::string position = nmea_degrees(latitude, 2) + (latitude < 0 ? ",S," : ",N,") +
+                           nmea_degrees(longitude, 3) + (longitude < 0 ? ",W" : ",E");
+    double knots = walk.speed * KNOTS_PER_MPS;
+
+    log += nmea_sentence("GPRMC," + utc + ",A," + position + format(",%.3f,%.2f,", knots, walk.course) + date +
+                         ",,,A");
+    log += nmea_sentence(format("GPVTG,%.2f,T,,M,%.3f,N,%.3f,K,A", walk.course, knots, walk.speed * 3.6));
+    log += nmea_sentence("GPGGA," + utc + "," + position + format(",1,08,0.92,%.1f,M,42.9,M,,", walk.altitude));
+    log += nmea_sentence("GPGSA,A,3,01,02,12,14,15,17,24,32,,,,,1.65,0.92,1.37");
+    for (int message = 0; message < 3; message++) {
+      std::string gsv = format("GPGSV,3,%d,12", message + 1);
+      for (int i = message * 4; i < message * 4 + 4; i++) {
+        gsv += format(",%02d,%02d,%03d,", SATELLITES[i][0], SATELLITES[i][1], SATELLITES[i][2]);
+        if (SATELLITES[i][3] > 0) {
+          gsv += format("%02d", SATELLITES[i][3]);
+        }
+      }
+      log += nmea_sentence(gsv);
+    }
+    log += nmea_sentence("GPGLL," + position + "," + utc + ",A,A");
+  }
+  return log;
+}
+
+bool load_nmea_log(const char* path, std::string* log) {
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  log->clear();
+  char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    log->append(buffer, n);
+  }
+  fclose(file);
+  return true;
+}
@@ -0,0 +1,86 @@
+/**
+  *
+  *
+  * @file:    nmea_sim.h
+  * @date:    17-10-2026 07:55:32
+  *
+  * @brief    Simulated NMEA output of the GPS module
+  *
+  *   Generates the sentences a u-blox NEO-6M sends every second with its
+  *   default configuration (RMC, VTG, GGA, GSA, three GSV and GLL), for a
+  *   wearer walking from a starting position. The first seconds can be without
+  *   a fix, where the GPS sends the same sentences with empty fields. Recorded
+  *   NMEA logs of the GPS can be used instead with load_nmea_log().
+  *
+**/
+
+#ifndef HOST_NMEA_SIM_H_
+#define HOST_NMEA_SIM_H_
+
+#include <string>
+
+/**
+* @brief  NmeaWalk: The simulated walk
+*
+**/
+struct NmeaWalk {
+  double latitude = 56.167794;        /**<  Start in degrees, negative south   */
+  double longitude = 10.190551;       /**<  Start in degrees, negative west   */
+  double altitude = 45.3;             /**<  Metres above mean sea level   */
+  double speed = 1.4;                 /**<  Walking speed in m/s   */
+  double course = 45.0;               /**<  Course over ground in degrees   */
+  int seconds_without_fix = 0;        /**<  Seconds before the first fix   */
+};
+
+/**
+* @brief  nmea_sentence(): Frame a sentence with '$', its checksum and CR LF
+*
+* @param const std::string& body: The sentence between '$' and '*', like "GPGLL,,,,,,V,N".
+* @return std::string: The sentence
+*
+**/
+std::string nmea_sentence(const std::string& body);
+
+/**
+* @brief  nmea_degrees(): Degrees in the DDMM.MMMMM format of the NMEA sentences
+*
+* @param double degrees: The degrees, the sign is left out.
+* @param int degree_digits: 2 for latitudes and 3 for longitudes.
+* @return std::string: The field
+*
+**/
+std::string nmea_degrees(double degrees, int degree_digits);
+
+/**
+* @brief  simulate_nmea(): The NMEA output of the GPS during a walk
+*
+* @param int seconds: Length of the walk, one epoch of sentences per second.
+* @param const NmeaWalk& walk: The walk.
+* @return std::string: The sentences
+*
+**/
+std::string simulate_nmea(int seconds, const NmeaWalk& walk = NmeaWalk());
+
+/**
+* @brief  nmea_walk_position(): Position of the walk after some seconds
+*
+* @param const NmeaWalk& walk: The walk.
+* @param int second: Seconds since the start.
+* @param double* latitude: Latitude in degrees.
+* @param double* longitude: Longitude in degrees.
+* @return void
+*
+**/
+void nmea_walk_position(const NmeaWalk& walk, int second, double* latitude, double* longitude);
+
+/**
+* @brief  load_nmea_log(): Load the NMEA sentences recorded from the GPS
+*
+* @param const char* path: The log, as received from the serial port.
+* @param std::string* log: The sentences.
+* @return bool: True if the log could be read
+*
+**/
+bool load_nmea_log(const char* path, std::string* log);
+
+#endif  // HOST_NMEA_SIM_H_
@@ -0,0 +1,353 @@
+/**
+  *
+  *
+  * @file:    Arduino.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino core used by the sketch
+  *
+  *
+  *
+  *
+**/
+
+#include "Arduino.h"
+
+#include <chrono>
+
+namespace {
+
+const int PIN_COUNT = 256;
+
+struct PinState {
+  uint8_t mode;
+  int value;
+  int analog_value;
+  int input;
+};
+
+PinState pins[PIN_COUNT];
+
+std::chrono::steady_clock::time_point clock_start = std::chrono::steady_clock::now();
+unsigned long long virtual_us = 0;
+
+unsigned long long elapsed_us() {
+  auto now = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(now - clock_start).count() + virtual_us;
+}
+
+}  // namespace
+
+unsigned long millis() {
+  return static_cast<unsigned long>(elapsed_us() / 1000);
+}
+
+unsigned long micros() {
+  return static_cast<unsigned long>(elapsed_us());
+}
+
+void delay(unsigned long ms) {
+  virtual_us += static_cast<unsigned long long>(ms) * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  virtual_us += us;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  pins[pin].mode = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  pins[pin].value = value ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin) {
+  return pins[pin].input;
+}
+
+void analogWrite(uint8_t pin, int value) {
+  pins[pin].analog_value = value;
+}
+
+int analogRead(uint8_t pin) {
+  return pins[pin].input;
+}
+
+namespace host {
+
+void advance_time_us(unsigned long us) {
+  virtual_us += us;
+}
+
+void reset_time() {
+  clock_start = std::chrono::steady_clock::now();
+  virtual_us = 0;
+}
+
+uint8_t pin_mode(uint8_t pin) {
+  return pins[pin].mode;
+}
+
+int pin_value(uint8_t pin) {
+  return pins[pin].value;
+}
+
+int pin_analog_value(uint8_t pin) {
+  return pins[pin].analog_value;
+}
+
+void set_pin_input(uint8_t pin, int value) {
+  pins[pin].input = value;
+}
+
+}  // namespace host
+
+// String
+
+static std::string number_to_string(unsigned long value, unsigned char base) {
+  if (base < 2) {
+    base = 10;
+  }
+  char buffer[8 * sizeof(unsigned long) + 1];
+  char* str = &buffer[sizeof(buffer) - 1];
+  *str = '\0';
+  do {
+    char digit = value % base;
+    value /= base;
+    *--str = digit < 10 ? digit + '0' : digit + 'A' - 10;
+  } while (value);
+  return std::string(str);
+}
+
+static std::string float_to_string(double value, unsigned char decimals) {
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  return std::string(buffer);
+}
+
+String::String(const char* str) : value(str ? str : "") {}
+
+String::String(const std::string& str) : value(str) {}
+
+String::String(char c) : value(1, c) {}
+
+String::String(int value, unsigned char base) {
+  if (value < 0 && base == DEC) {
+    this->value = "-" + number_to_string(-static_cast<long>(value), base);
+  } else {
+    this->value = number_to_string(static_cast<unsigned int>(value), base);
+  }
+}
+
+String::String(unsigned int value, unsigned char base) : value(number_to_string(value, base)) {}
+
+String::String(long value, unsigned char base) {
+  if (value < 0 && base == DEC) {
+    this->value = "-" + number_to_string(-static_cast<unsigned long>(value), base);
+  } else {
+    this->value = number_to_string(static_cast<unsigned long>(value), base);
+  }
+}
+
+String::String(unsigned long value, unsigned char base) : value(number_to_string(value, base)) {}
+
+String::String(float value, unsigned char decimals) : value(float_to_string(value, decimals)) {}
+
+String::String(double value, unsigned char decimals) : value(float_to_string(value, decimals)) {}
+
+// Print
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (write(*buffer++)) {
+      n++;
+    } else {
+      break;
+    }
+  }
+  return n;
+}
+
+size_t Print::print_number(unsigned long value, int base) {
+  return write(number_to_string(value, base).c_str());
+}
+
+size_t Print::print(const char str[]) {
+  return write(str);
+}
+
+size_t Print::print(const String& str) {
+  return write(str.c_str(), str.length());
+}
+
+size_t Print::print(char c) {
+  return write(static_cast<uint8_t>(c));
+}
+
+size_t Print::print(unsigned char value, int base) {
+  return print_number(value, base);
+}
+
+size_t Print::print(int value, int base) {
+  return print(static_cast<long>(value), base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return print_number(value, base);
+}
+
+size_t Print::print(long value, int base) {
+  if (base == DEC && value < 0) {
+    return print('-') + print_number(-static_cast<unsigned long>(value), base);
+  }
+  return print_number(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return print_number(value, base);
+}
+
+size_t Print::print(double value, int digits) {
+  // Same special cases as the Arduino core
+  if (std::isnan(value)) return print("nan");
+  if (std::isinf(value)) return print("inf");
+  if (value > 4294967040.0 || value < -4294967040.0) return print("ovf");
+  return write(float_to_string(value, digits).c_str());
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+size_t Print::println(const char str[]) {
+  return print(str) + println();
+}
+
+size_t Print::println(const String& str) {
+  return print(str) + println();
+}
+
+size_t Print::println(char c) {
+  return print(c) + println();
+}
+
+size_t Print::println(unsigned char value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+  return print(value, digits) + println();
+}
+
+size_t Print::printf(const char* format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  return write(buffer, min(static_cast<size_t>(length), sizeof(buffer) - 1));
+}
+
+// HardwareSerial
+
+HardwareSerial Serial(stdout);
+HardwareSerial Serial1(nullptr);
+
+HardwareSerial::HardwareSerial(FILE* echo_stream)
+  : echo(echo_stream), baud_rate(0), timeout(1000) {}
+
+void HardwareSerial::begin(unsigned long baud) {
+  baud_rate = baud;
+}
+
+void HardwareSerial::end() {
+  baud_rate = 0;
+}
+
+void HardwareSerial::poll_peer() {
+  if (received.empty() && peer) {
+    peer(*this);
+  }
+}
+
+int HardwareSerial::available() {
+  poll_peer();
+  return static_cast<int>(received.size());
+}
+
+int HardwareSerial::peek() {
+  poll_peer();
+  if (received.empty()) {
+    return -1;
+  }
+  return received.front();
+}
+
+int HardwareSerial::read() {
+  poll_peer();
+  if (received.empty()) {
+    return -1;
+  }
+  int c = received.front();
+  received.pop_front();
+  return c;
+}
+
+size_t HardwareSerial::readBytes(char* buffer, size_t length) {
+  size_t count = 0;
+  poll_peer();
+  while (count < length && !received.empty()) {
+    buffer[count++] = static_cast<char>(received.front());
+    received.pop_front();
+  }
+  // On the board readBytes() waits for the rest of the bytes until it times out
+  if (count < length) {
+    delay(timeout);
+  }
+  return count;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  std::lock_guard<std::mutex> guard(transmit_lock);
+  transmitted.push_back(static_cast<char>(c));
+  if (echo) {
+    fputc(c, echo);
+  }
+  return 1;
+}
+
+void HardwareSerial::host_receive(const uint8_t* data, size_t length) {
+  received.insert(received.end(), data, data + length);
+}
+
+void HardwareSerial::host_receive(const char* str) {
+  host_receive(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+std::string HardwareSerial::host_take_transmitted() {
+  std::string data;
+  std::lock_guard<std::mutex> guard(transmit_lock);
+  data.swap(transmitted);
+  return data;
+}
@@ -0,0 +1,250 @@
+/**
+  *
+  *
+  * @file:    Arduino.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino core used by the sketch
+  *
+  *   Only the part of the Arduino API used by the sketch is implemented. The
+  *   time functions run on a virtual clock, where delay() moves the clock
+  *   forward instead of sleeping, so the sketch can run faster than real time
+  *   on the workstation. The pins are kept in a table, so tests can check what
+  *   the sketch has written to them. Everything in the host namespace is only
+  *   available on the workstation and is used by the host tests and tools.
+  *
+**/
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+// The core defines min() and max() as templates instead of macros, so the
+// standard library headers can still be included after this header
+template <class T, class L>
+auto min(const T& a, const L& b) -> decltype((b < a) ? b : a) {
+  return (b < a) ? b : a;
+}
+
+template <class T, class L>
+auto max(const T& a, const L& b) -> decltype((b < a) ? b : a) {
+  return (a < b) ? b : a;
+}
+
+using std::abs;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+#define sq(x) ((x) * (x))
+
+#define F(string_literal) (string_literal)
+
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+// Time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Pins
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+int analogRead(uint8_t pin);
+
+/**
+* @brief  String: Minimal version of the Arduino String class
+*
+*   Numbers are converted the same way as by the Arduino String class, so
+*   floats get two decimals unless anything else is chosen.
+*
+**/
+class String {
+  public:
+    String(const char* str = "");
+    String(const std::string& str);
+    explicit String(char c);
+    explicit String(int value, unsigned char base = DEC);
+    explicit String(unsigned int value, unsigned char base = DEC);
+    explicit String(long value, unsigned char base = DEC);
+    explicit String(unsigned long value, unsigned char base = DEC);
+    explicit String(float value, unsigned char decimals = 2);
+    explicit String(double value, unsigned char decimals = 2);
+
+    const char* c_str() const { return value.c_str(); };
+    unsigned int length() const { return value.length(); };
+    char operator[](unsigned int index) const { return value[index]; };
+    float toFloat() const { return strtof(value.c_str(), nullptr); };
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); };
+
+    String& operator+=(const String& rhs) { value += rhs.value; return *this; };
+    String& operator+=(const char* rhs) { value += rhs; return *this; };
+    String& operator+=(char rhs) { value += rhs; return *this; };
+    bool operator==(const String& rhs) const { return value == rhs.value; };
+    bool operator==(const char* rhs) const { return value == rhs; };
+    bool operator!=(const String& rhs) const { return value != rhs.value; };
+
+    friend String operator+(const String& lhs, const String& rhs) { return String(lhs.value + rhs.value); };
+    friend String operator+(const String& lhs, const char* rhs) { return String(lhs.value + rhs); };
+    friend String operator+(const char* lhs, const String& rhs) { return String(lhs + rhs.value); };
+
+  private:
+    std::string value;
+};
+
+/**
+* @brief  Print: Base class for everything that can be printed to
+*
+*   Same interface as the Arduino Print class. The classes only need to
+*   implement write() of a single byte.
+*
+**/
+class Print {
+  public:
+    virtual ~Print() {};
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) { return write(reinterpret_cast<const uint8_t*>(str), strlen(str)); };
+    size_t write(const char* buffer, size_t size) { return write(reinterpret_cast<const uint8_t*>(buffer), size); };
+
+    size_t print(const char str[]);
+    size_t print(const String& str);
+    size_t print(char c);
+    size_t print(unsigned char value, int base = DEC);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    size_t println(const char str[]);
+    size_t println(const String& str);
+    size_t println(char c);
+    size_t println(unsigned char value, int base = DEC);
+    size_t println(int value, int base = DEC);
+    size_t println(unsigned int value, int base = DEC);
+    size_t println(long value, int base = DEC);
+    size_t println(unsigned long value, int base = DEC);
+    size_t println(double value, int digits = 2);
+
+    size_t printf(const char* format, ...);
+
+  private:
+    size_t print_number(unsigned long value, int base);
+};
+
+/**
+* @brief  HardwareSerial: UART of the board
+*
+*   Everything written by the sketch is kept, so it can be read by the host,
+*   and can be echoed to a stream on the workstation. Bytes for the sketch to
+*   read are queued by the host with host_receive(). Writing and taking the
+*   transmitted bytes are thread safe, so the controllers of a host tool can
+*   print from several threads.
+*
+**/
+class HardwareSerial : public Print {
+  public:
+    explicit HardwareSerial(FILE* echo_stream);
+
+    void begin(unsigned long baud);
+    void end();
+    int available();
+    int peek();
+    int read();
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes(reinterpret_cast<char*>(buffer), length); };
+    void setTimeout(unsigned long timeout_ms) { timeout = timeout_ms; };
+    void flush() {};
+    operator bool() const { return true; };
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // Host side of the UART
+    void host_receive(const uint8_t* data, size_t length);
+    void host_receive(const char* str);
+    const std::string& host_transmitted() const { return transmitted; };
+    std::string host_take_transmitted();
+    void host_set_echo(FILE* echo_stream) { echo = echo_stream; };
+    // Simulated peer, called when the sketch polls the UART and no bytes are waiting
+    void host_set_peer(std::function<void(HardwareSerial&)> peer_callback) { peer = peer_callback; };
+    unsigned long host_baud() const { return baud_rate; };
+
+  private:
+    FILE* echo;                       /**<  Stream the transmitted bytes are echoed to, or nullptr   */
+    std::deque<uint8_t> received;     /**<  Bytes waiting to be read by the sketch   */
+    std::string transmitted;          /**<  Bytes written by the sketch   */
+    std::mutex transmit_lock;         /**<  Guards transmitted and the echo   */
+    unsigned long baud_rate;          /**<  Baud rate chosen with begin()   */
+    unsigned long timeout;            /**<  Timeout of readBytes() in milliseconds   */
+    std::function<void(HardwareSerial&)> peer;
+    void poll_peer();
+};
+
+extern HardwareSerial Serial;         /**<  USB serial used for debugging, echoed to stdout   */
+extern HardwareSerial Serial1;        /**<  UART connected to the LoPy   */
+
+namespace host {
+
+// Move the virtual clock forward, as if the time had passed on the board
+void advance_time_us(unsigned long us);
+// Reset the virtual clock to zero
+void reset_time();
+
+// Last mode, digital and analog value written to a pin by the sketch
+uint8_t pin_mode(uint8_t pin);
+int pin_value(uint8_t pin);
+int pin_analog_value(uint8_t pin);
+// Set the value the sketch reads from a pin
+void set_pin_input(uint8_t pin, int value);
+
+}  // namespace host
+
+#endif  // HOST_ARDUINO_H_
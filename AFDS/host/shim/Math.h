@@ -0,0 +1,19 @@
+/**
+  *
+  *
+  * @file:    Math.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim for the <Math.h> include used by the sketch
+  *
+  *   The board toolchain doesn't care about the case of the header name, but
+  *   the workstation does.
+  *
+**/
+
+#ifndef HOST_MATH_H_
+#define HOST_MATH_H_
+
+#include <math.h>
+
+#endif  // HOST_MATH_H_
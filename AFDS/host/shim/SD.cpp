@@ -0,0 +1,160 @@
+/**
+  *
+  *
+  * @file:    SD.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino SD library
+  *
+  *
+  *
+  *
+**/
+
+#include "SD.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+// The Makefile places the card in the build directory, so it is never in the sources
+#ifndef HOST_SD_DEFAULT_ROOT
+#define HOST_SD_DEFAULT_ROOT "sd_card"
+#endif
+
+SDClass SD;
+
+File::File() {}
+
+File::File(FILE* file, const char* name) : file(file, fclose), file_name(name) {}
+
+size_t File::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  if (!file) {
+    return 0;
+  }
+  return fwrite(buffer, 1, size, file.get());
+}
+
+int File::read() {
+  if (!file) {
+    return -1;
+  }
+  int c = fgetc(file.get());
+  return c == EOF ? -1 : c;
+}
+
+int File::read(void* buffer, uint16_t nbyte) {
+  if (!file) {
+    return -1;
+  }
+  return static_cast<int>(fread(buffer, 1, nbyte, file.get()));
+}
+
+int File::peek() {
+  int c = read();
+  if (c >= 0) {
+    ungetc(c, file.get());
+  }
+  return c;
+}
+
+int File::available() {
+  if (!file) {
+    return 0;
+  }
+  return static_cast<int>(size() - position());
+}
+
+void File::flush() {
+  if (file) {
+    fflush(file.get());
+  }
+}
+
+bool File::seek(uint32_t pos) {
+  return file && fseek(file.get(), pos, SEEK_SET) == 0;
+}
+
+uint32_t File::position() {
+  if (!file) {
+    return 0;
+  }
+  return static_cast<uint32_t>(ftell(file.get()));
+}
+
+uint32_t File::size() {
+  if (!file) {
+    return 0;
+  }
+  fflush(file.get());
+  struct stat st;
+  if (fstat(fileno(file.get()), &st) != 0) {
+    return 0;
+  }
+  return static_cast<uint32_t>(st.st_size);
+}
+
+void File::close() {
+  file.reset();
+}
+
+File::operator bool() const {
+  return static_cast<bool>(file);
+}
+
+bool SDClass::begin(uint8_t cs_pin) {
+  (void)cs_pin;
+  begin_count++;
+  if (root.empty()) {
+    const char* env_root = getenv("AFDS_SD_ROOT");
+    root = env_root ? env_root : HOST_SD_DEFAULT_ROOT;
+  }
+  struct stat st;
+  if (stat(root.c_str(), &st) == 0) {
+    return S_ISDIR(st.st_mode);
+  }
+  return ::mkdir(root.c_str(), 0755) == 0;
+}
+
+File SDClass::open(const char* filename, uint8_t mode) {
+  std::string path = host_path(filename);
+  FILE* file = nullptr;
+  if (mode == FILE_READ) {
+    file = fopen(path.c_str(), "rb");
+  } else {
+    // Like on the board, a file opened for writing is created and written at the end
+    file = fopen(path.c_str(), "a+b");
+  }
+  if (!file) {
+    return File();
+  }
+  return File(file, filename);
+}
+
+bool SDClass::exists(const char* filename) {
+  struct stat st;
+  return stat(host_path(filename).c_str(), &st) == 0;
+}
+
+bool SDClass::remove(const char* filename) {
+  return ::remove(host_path(filename).c_str()) == 0;
+}
+
+bool SDClass::mkdir(const char* filepath) {
+  return ::mkdir(host_path(filepath).c_str(), 0755) == 0;
+}
+
+void SDClass::host_set_root(const char* path) {
+  root = path;
+}
+
+std::string SDClass::host_path(const char* filename) {
+  if (root.empty()) {
+    const char* env_root = getenv("AFDS_SD_ROOT");
+    root = env_root ? env_root : HOST_SD_DEFAULT_ROOT;
+  }
+  return root + "/" + filename;
+}
@@ -0,0 +1,83 @@
+/**
+  *
+  *
+  * @file:    SD.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino SD library
+  *
+  *   The MicroSD card is a directory on the workstation. The directory is
+  *   "sd_card" in the build directory of AFDS/host, or the directory set in
+  *   the AFDS_SD_ROOT environment variable, and is created by SD.begin().
+  *
+  *
+**/
+
+#ifndef HOST_SD_H_
+#define HOST_SD_H_
+
+#include <memory>
+#include <string>
+
+#include "Arduino.h"
+
+#define FILE_READ 0x01
+#define FILE_WRITE 0x13
+
+/**
+* @brief  File: File on the MicroSD card
+*
+*   Copies of a File share the same open file, like on the board.
+*
+**/
+class File : public Print {
+  public:
+    File();
+    File(FILE* file, const char* name);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    int read();
+    int read(void* buffer, uint16_t nbyte);
+    int peek();
+    int available();
+    void flush();
+    bool seek(uint32_t pos);
+    uint32_t position();
+    uint32_t size();
+    void close();
+    const char* name() const { return file_name.c_str(); };
+    operator bool() const;
+
+  private:
+    std::shared_ptr<FILE> file;       /**<  The open file, shared between copies   */
+    std::string file_name;            /**<  Name of the file on the card   */
+};
+
+/**
+* @brief  SDClass: The MicroSD card
+*
+**/
+class SDClass {
+  public:
+    bool begin(uint8_t cs_pin = 10);
+    File open(const char* filename, uint8_t mode = FILE_READ);
+    bool exists(const char* filename);
+    bool remove(const char* filename);
+    bool mkdir(const char* filepath);
+
+    // Host side of the card
+    void host_set_root(const char* path);
+    std::string host_path(const char* filename);
+    unsigned long host_begin_count() const { return begin_count; };
+
+  private:
+    unsigned long begin_count = 0;    /**<  Amount of calls to begin()   */
+    std::string root;                 /**<  Directory used as the card   */
+};
+
+extern SDClass SD;
+
+#endif  // HOST_SD_H_
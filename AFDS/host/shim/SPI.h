@@ -0,0 +1,19 @@
+/**
+  *
+  *
+  * @file:    SPI.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino SPI library
+  *
+  *   The SPI bus is only used by the SD library, which is simulated on the
+  *   workstation, so nothing is needed here.
+  *
+**/
+
+#ifndef HOST_SPI_H_
+#define HOST_SPI_H_
+
+#include "Arduino.h"
+
+#endif  // HOST_SPI_H_
@@ -0,0 +1,89 @@
+/**
+  *
+  *
+  * @file:    Wire.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino Wire (I2C) library
+  *
+  *
+  *
+  *
+**/
+
+#include "Wire.h"
+
+TwoWire Wire;
+TwoWire Wire1;
+
+TwoWire::TwoWire() : tx_address(0), rx_pos(0), transactions(0), bytes(0) {
+  for (int i = 0; i < 128; i++) {
+    devices[i] = nullptr;
+  }
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  tx_address = address;
+  tx_buffer.clear();
+}
+
+size_t TwoWire::write(uint8_t data) {
+  tx_buffer.push_back(data);
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t length) {
+  tx_buffer.insert(tx_buffer.end(), data, data + length);
+  return length;
+}
+
+uint8_t TwoWire::endTransmission(bool stop_bit) {
+  (void)stop_bit;
+  transactions++;
+  bytes += tx_buffer.size();
+  I2CDevice* device = devices[tx_address & 0x7F];
+  if (!device) {
+    // Address not acknowledged
+    return 2;
+  }
+  device->i2c_write(tx_buffer.data(), tx_buffer.size());
+  tx_buffer.clear();
+  return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t length, bool stop_bit) {
+  (void)stop_bit;
+  transactions++;
+  rx_buffer.assign(length, 0);
+  rx_pos = 0;
+  I2CDevice* device = devices[address & 0x7F];
+  if (!device) {
+    rx_buffer.clear();
+    return 0;
+  }
+  rx_buffer.resize(device->i2c_read(rx_buffer.data(), length));
+  bytes += rx_buffer.size();
+  return rx_buffer.size();
+}
+
+int TwoWire::available() {
+  return static_cast<int>(rx_buffer.size() - rx_pos);
+}
+
+int TwoWire::peek() {
+  if (rx_pos >= rx_buffer.size()) {
+    return -1;
+  }
+  return rx_buffer[rx_pos];
+}
+
+int TwoWire::read() {
+  if (rx_pos >= rx_buffer.size()) {
+    return -1;
+  }
+  return rx_buffer[rx_pos++];
+}
+
+void TwoWire::host_attach(uint8_t address, I2CDevice* device) {
+  devices[address & 0x7F] = device;
+}
@@ -0,0 +1,91 @@
+/**
+  *
+  *
+  * @file:    Wire.h
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host shim of the Arduino Wire (I2C) library
+  *
+  *   Devices on the bus are simulated by classes implementing I2CDevice, which
+  *   are attached to the bus on their address. A transmission to an address
+  *   without a device is not acknowledged, like on the board.
+  *
+**/
+
+#ifndef HOST_WIRE_H_
+#define HOST_WIRE_H_
+
+#include <vector>
+
+#include "Arduino.h"
+
+/**
+* @brief  I2CDevice: Simulated device on the I2C bus
+*
+**/
+class I2CDevice {
+  public:
+    virtual ~I2CDevice() {};
+
+    /**
+    * @brief  i2c_write(): Bytes written to the device in one transmission
+    *
+    * @param const uint8_t* data: Pointer to the bytes written.
+    * @param size_t length: Amount of bytes written.
+    * @return void
+    *
+    **/
+    virtual void i2c_write(const uint8_t* data, size_t length) = 0;
+
+    /**
+    * @brief  i2c_read(): Bytes requested from the device
+    *
+    * @param uint8_t* data: Pointer to the array where the read bytes are stored.
+    * @param size_t length: Amount of bytes requested.
+    * @return size_t: Amount of bytes the device returned
+    *
+    **/
+    virtual size_t i2c_read(uint8_t* data, size_t length) = 0;
+};
+
+/**
+* @brief  TwoWire: The I2C bus
+*
+**/
+class TwoWire {
+  public:
+    TwoWire();
+
+    void begin() {};
+    void end() {};
+    void setClock(uint32_t frequency) { (void)frequency; };
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* data, size_t length);
+    uint8_t endTransmission(bool stop_bit = true);
+    size_t requestFrom(uint8_t address, size_t length, bool stop_bit = true);
+    int available();
+    int peek();
+    int read();
+
+    // Host side of the bus
+    void host_attach(uint8_t address, I2CDevice* device);
+    unsigned long host_transactions() const { return transactions; };
+    unsigned long host_bytes() const { return bytes; };
+    void host_reset_counters() { transactions = 0; bytes = 0; };
+
+  private:
+    I2CDevice* devices[128];          /**<  Devices attached to the bus on their address   */
+    uint8_t tx_address;               /**<  Address of the current transmission   */
+    std::vector<uint8_t> tx_buffer;   /**<  Bytes written in the current transmission   */
+    std::vector<uint8_t> rx_buffer;   /**<  Bytes read by the last request   */
+    size_t rx_pos;                    /**<  Position of the next byte to read in rx_buffer   */
+    unsigned long transactions;       /**<  Amount of transmissions and requests on the bus   */
+    unsigned long bytes;              /**<  Amount of bytes written and read on the bus   */
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif  // HOST_WIRE_H_
@@ -0,0 +1,45 @@
+/**
+  *
+  *
+  * @file:    micro_error_reporter.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Host version of the TensorFlow Lite error reporters
+  *
+  *   Only the prebuilt Cortex-M4 library is shipped with the sketch, so when
+  *   the host is built without the TensorFlow Lite sources (TFLM_DIR) the
+  *   error reporters used by the tests are implemented here. The reports are
+  *   printed to stdout with the standard printf formatting.
+  *
+**/
+
+#include <stdio.h>
+
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+
+namespace tflite {
+
+int ErrorReporter::Report(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int code = Report(format, args);
+  va_end(args);
+  return code;
+}
+
+int ErrorReporter::ReportError(void*, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int code = Report(format, args);
+  va_end(args);
+  return code;
+}
+
+int MicroErrorReporter::Report(const char* format, va_list args) {
+  vprintf(format, args);
+  printf("\n");
+  return 0;
+}
+
+}  // namespace tflite
@@ -0,0 +1,99 @@
+/**
+  *
+  *
+  * @file:    sketch_main.cpp
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Runs the sketch setup() and loop() on the workstation
+  *
+  *   The IMU samples are read from a CSV file with one sample per line in the
+  *   order they were recorded: ax,ay,az,gx,gy,gz in g's and degrees per second.
+  *   The samples are read by the sketch through the simulated LSM9DS1, and the
+  *   LoPy is simulated, acknowledging the alarms as soon as it receives them.
+  *   The samples arrive at the sample rate of the IMU on the virtual clock, so
+  *   the run takes far less time than the recording.
+  *   When all samples have been read the run stops and the time spent is
+  *   printed.
+  *
+  *   Usage: afds_sketch <signal.csv> [sd_card_directory]
+  *
+**/
+
+#include <chrono>
+#include <cstdio>
+
+#include <Arduino.h>
+#include <SD.h>
+#include <Wire.h>
+
+#include "constants.h"
+#include "lopy_sim.h"
+#include "lsm9ds1_sim.h"
+#include "main_functions.h"
+#include "SetupIMU.h"
+
+namespace {
+
+// Thrown by the simulated IMU, when the sketch asks for a sample after the last one
+struct EndOfSignal {};
+
+LSM9DS1Sim imu_sim;
+
+bool load_samples(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+  float ax, ay, az, gx, gy, gz;
+  while (fscanf(file, " %f , %f , %f , %f , %f , %f", &ax, &ay, &az, &gx, &gy, &gz) == 6) {
+    imu_sim.push_sample(ax, ay, az, gx, gy, gz);
+  }
+  fclose(file);
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <signal.csv> [sd_card_directory]\n", argv[0]);
+    return 1;
+  }
+  if (argc > 2) {
+    SD.host_set_root(argv[2]);
+  }
+
+  // The IMU driver uses Wire on every other board than the Nano 33 BLE
+  imu_sim.attach(Wire);
+  // The LoPy on the other end of Serial1
+  SimulatedLoPy lopy(1);
+
+  setup();
+
+  // The scales are set by setup(), so the samples can be converted now
+  if (!load_samples(argv[1])) {
+    return 1;
+  }
+  size_t samples = imu_sim.pending();
+  // The samples arrive in the FIFO at the sample rate on the virtual clock, which delay() in loop() advances
+  imu_sim.pace(IMUSampleRate());
+  imu_sim.on_empty([]() { throw EndOfSignal(); });
+
+  unsigned long loops = 0;
+  auto start = std::chrono::steady_clock::now();
+  try {
+    while (true) {
+      loop();
+      loops++;
+    }
+  } catch (const EndOfSignal&) {
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  fprintf(stderr, "\n%zu samples, %lu loop() iterations in %.3f s (%.0f samples/s)\n",
+          samples, loops, seconds, samples / seconds);
+  fprintf(stderr, "%lu samples lost to IMU FIFO overruns\n", imu_sim.overruns());
+  return 0;
+}
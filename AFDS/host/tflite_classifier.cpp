@@ -0,0 +1,261 @@
+/**
+  *
+  *
+  * @file:    tflite_classifier.cpp
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Runs a fall model with the TensorFlow Lite Micro interpreter on the workstation
+  *
+  *
+  *
+  *
+**/
+
+#include "tflite_classifier.h"
+
+#include <string.h>
+
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_int8.h"
+#include "fall_model_f46_2_int8.h"
+#include "fall_model_f46_3_int8.h"
+#include "host_op_resolver.h"
+#include "model_batching.h"
+#include "model_quantization.h"
+#include "tensorflow/lite/experimental/micro/kernels/all_ops_resolver.h"
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+namespace {
+
+// Used while searching for the smallest arena, where most allocations fail
+class SilentErrorReporter : public tflite::ErrorReporter {
+  public:
+    int Report(const char* format, va_list args) override {
+      return 0;
+    }
+};
+
+// The resolver of the workstation, and the one of the sketch with the micro kernels
+HostOpResolver host_resolver;
+tflite::ops::micro::AllOpsResolver reference_resolver;
+
+uint64_t cycle_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+}  // namespace
+
+const size_t TfliteClassifier::DEFAULT_ARENA_SIZE;
+
+TfliteClassifier::~TfliteClassifier() {
+  delete interpreter;
+}
+
+const unsigned char* TfliteClassifier::model_data(const char* name, int* length) {
+  const unsigned char* data = nullptr;
+  int data_len = 0;
+  if (strcmp(name, "f46") == 0) {
+    data = fall_model_data;
+    data_len = fall_model_data_len;
+  } else if (strcmp(name, "f46_2") == 0) {
+    data = fall_model_2_data;
+    data_len = fall_model_2_data_len;
+  } else if (strcmp(name, "f46_3") == 0) {
+    data = fall_model_3_data;
+    data_len = fall_model_3_data_len;
+  } else if (strcmp(name, "f46_int8") == 0) {
+    data = fall_model_int8_data;
+    data_len = fall_model_int8_data_len;
+  } else if (strcmp(name, "f46_2_int8") == 0) {
+    data = fall_model_2_int8_data;
+    data_len = fall_model_2_int8_data_len;
+  } else if (strcmp(name, "f46_3_int8") == 0) {
+    data = fall_model_3_int8_data;
+    data_len = fall_model_3_int8_data_len;
+  }
+  if (length != nullptr) {
+    *length = data_len;
+  }
+  return data;
+}
+
+bool TfliteClassifier::begin(const char* name, size_t arena_size, bool report_errors, int batch) {
+  static tflite::MicroErrorReporter micro_error_reporter;
+  static SilentErrorReporter silent_error_reporter;
+  tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+  if (!report_errors) {
+    error_reporter = &silent_error_reporter;
+  }
+  const tflite::OpResolver& resolver = profiler ? static_cast<const tflite::OpResolver&>(*profiler) : host_resolver;
+
+  int length = 0;
+  const unsigned char* data = model_data(name, &length);
+  if (data == nullptr) {
+    error_reporter->Report("Unknown model %s", name);
+    return false;
+  }
+  this->batch = 1;
+  if (batch > 1) {
+    // The interpreter runs the copy, which has to live as long as it
+    if (!batch_model(data, length, batch, batched_model)) {
+      error_reporter->Report("Can't make a batch of %d of model %s", batch, name);
+      return false;
+    }
+    arena_size += (batch - 1) * batch_row_bytes(data);
+    data = batched_model.data();
+    this->batch = batch;
+  }
+
+  const tflite::Model* model = tflite::GetModel(data);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    error_reporter->Report("Model provided is schema version %d not equal "
+                           "to supported version %d.",
+                           model->version(), TFLITE_SCHEMA_VERSION);
+    return false;
+  }
+
+  // Every classifier has its own arena, so the float and int8 models can be run side by side
+  delete interpreter;
+  tensor_arena.assign(arena_size, ARENA_PAINT);
+  interpreter = new tflite::MicroInterpreter(model, resolver, tensor_arena.data(),
+                                             tensor_arena.size(), error_reporter);
+  if (interpreter->AllocateTensors() != kTfLiteOk) {
+    error_reporter->Report("AllocateTensors() failed");
+    return false;
+  }
+
+  TfLiteTensor* input = interpreter->input(0);
+  if ((input->dims->size != 2) || (input->dims->data[0] != this->batch) ||
+      (input->dims->data[1] != FEATURE_AMOUNT) ||
+      (input->type != kTfLiteFloat32 && input->type != kTfLiteInt8)) {
+    error_reporter->Report("Bad input tensor parameters in model");
+    return false;
+  }
+  feature_scales = model_feature_scales(model, FEATURE_AMOUNT);
+  if (input->type == kTfLiteInt8 && feature_scales == nullptr) {
+    error_reporter->Report("The int8 model has no feature scales");
+    return false;
+  }
+  TfLiteTensor* output = interpreter->output(0);
+  if (output->type != kTfLiteFloat32 && output->type != kTfLiteInt8) {
+    error_reporter->Report("Bad output tensor type in model");
+    return false;
+  }
+  return true;
+}
+
+ArenaUsage TfliteClassifier::arena_usage() {
+  return measure_arena(tensor_arena.data(), tensor_arena.size(),
+                       arena_tensor_data(*interpreter, tensor_arena.data(), tensor_arena.size()));
+}
+
+bool TfliteClassifier::classify(const float features[FEATURE_AMOUNT], float output[2]) {
+  TfLiteTensor* input = interpreter->input(0);
+  if (input->type == kTfLiteInt8) {
+    quantize_features(features, feature_scales, input->data.int8, FEATURE_AMOUNT, input->params.scale,
+                      input->params.zero_point);
+  } else {
+    for (int i = 0; i < FEATURE_AMOUNT; ++i) {
+      input->data.f[i] = features[i];
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t start_cycles = cycle_counter();
+  TfLiteStatus status = invoke();
+  invoke_cycles = cycle_counter() - start_cycles;
+  invoke_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  if (status != kTfLiteOk) {
+    return false;
+  }
+
+  const TfLiteTensor* result = interpreter->output(0);
+  if (result->type == kTfLiteInt8) {
+    dequantize_outputs(result->data.int8, output, 2, result->params.scale, result->params.zero_point);
+  } else {
+    output[0] = result->data.f[0];
+    output[1] = result->data.f[1];
+  }
+  return true;
+}
+
+bool TfliteClassifier::classify_batch(const float* const features[], int count, float output[][2]) {
+  TfLiteTensor* input = interpreter->input(0);
+  invoke_us = 0;
+  invoke_cycles = 0;
+  for (int first = 0; first < count; first += batch) {
+    int rows = count - first < batch ? count - first : batch;
+    for (int r = 0; r < batch; r++) {
+      if (input->type == kTfLiteInt8) {
+        int8_t* row = input->data.int8 + r * FEATURE_AMOUNT;
+        if (r < rows) {
+          quantize_features(features[first + r], feature_scales, row, FEATURE_AMOUNT, input->params.scale,
+                            input->params.zero_point);
+        } else {
+          memset(row, 0, FEATURE_AMOUNT);
+        }
+      } else {
+        float* row = input->data.f + r * FEATURE_AMOUNT;
+        if (r < rows) {
+          memcpy(row, features[first + r], FEATURE_AMOUNT * sizeof(float));
+        } else {
+          memset(row, 0, FEATURE_AMOUNT * sizeof(float));
+        }
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = cycle_counter();
+    TfLiteStatus status = invoke();
+    invoke_cycles += cycle_counter() - start_cycles;
+    invoke_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    if (status != kTfLiteOk) {
+      return false;
+    }
+
+    const TfLiteTensor* result = interpreter->output(0);
+    for (int r = 0; r < rows; r++) {
+      if (result->type == kTfLiteInt8) {
+        dequantize_outputs(result->data.int8 + 2 * r, output[first + r], 2, result->params.scale,
+                           result->params.zero_point);
+      } else {
+        output[first + r][0] = result->data.f[2 * r];
+        output[first + r][1] = result->data.f[2 * r + 1];
+      }
+    }
+  }
+  return true;
+}
+
+OpProfiler* TfliteClassifier::enable_profiler(bool reference_kernels) {
+  if (reference_kernels) {
+    profiler.reset(new OpProfiler(reference_resolver));
+  } else {
+    profiler.reset(new OpProfiler(host_resolver));
+  }
+  return profiler.get();
+}
+
+TfLiteStatus TfliteClassifier::invoke() {
+  if (!profiler) {
+    return interpreter->Invoke();
+  }
+  profiler->begin_invoke();
+  TfLiteStatus status = interpreter->Invoke();
+  profiler->end_invoke();
+  return status;
+}
@@ -0,0 +1,129 @@
+/**
+  *
+  *
+  * @file:    tflite_classifier.h
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Runs a fall model with the TensorFlow Lite Micro interpreter on the workstation
+  *
+  *   The interpreter is set up the same way as in setup() of the sketch. The
+  *   features are quantized for the int8 models, like loop() does. The float
+  *   FULLY_CONNECTED layers run the vectorized kernel of the HostOpResolver.
+  *   With a batch, the model is run on a copy with a batch dimension, and
+  *   classify_batch() runs that many feature vectors in every Invoke().
+  *   Only built when the TensorFlow Lite sources are given with TFLM_DIR.
+  *
+**/
+
+#ifndef HOST_TFLITE_CLASSIFIER_H_
+#define HOST_TFLITE_CLASSIFIER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "constants.h"
+#include "op_profiler.h"
+#include "tensor_arena.h"
+
+namespace tflite {
+class MicroInterpreter;
+}  // namespace tflite
+
+/**
+* @brief  TfliteClassifier: A fall model and its interpreter
+*
+**/
+class TfliteClassifier {
+  public:
+    // The arena size the sketch used before the arenas were sized for each model
+    static const size_t DEFAULT_ARENA_SIZE = 70 * 1024;
+
+    TfliteClassifier()
+      : batch(1), invoke_us(0), invoke_cycles(0), interpreter(nullptr), feature_scales(nullptr) {};
+    ~TfliteClassifier();
+
+    /**
+    * @brief  begin(): Map the model and allocate its tensors
+    *
+    * @param const char* name: Name of the model: "f46", "f46_2", "f46_3" or one of them with "_int8" appended.
+    * @param size_t arena_size: Size of the tensor arena in bytes.
+    * @param bool report_errors: false to set up the model without reporting errors.
+    * @param int batch: Feature vectors run in every Invoke(). The arena is made larger for every row beyond the first.
+    * @return bool: true if the model could be set up
+    *
+    **/
+    bool begin(const char* name, size_t arena_size = DEFAULT_ARENA_SIZE, bool report_errors = true, int batch = 1);
+
+    /**
+    * @brief  classify(): Run inference on the features
+    *
+    * @param const float features[]: The FEATURE_AMOUNT features of the signal.
+    * @param float output[]: The two outputs of the model (no fall, fall).
+    * @return bool: true if Invoke() succeeded
+    *
+    **/
+    bool classify(const float features[FEATURE_AMOUNT], float output[2]);
+
+    /**
+    * @brief  classify_batch(): Run inference on many feature vectors, a batch in every Invoke()
+    *
+    *   The rows of the last batch without feature vectors are set to zero.
+    *   invoke_us and invoke_cycles are the totals of all the Invoke() calls.
+    *
+    * @param const float* const features[]: The FEATURE_AMOUNT features of every signal.
+    * @param int count: Amount of signals.
+    * @param float output[][2]: The two outputs of the model (no fall, fall) for every signal.
+    * @return bool: true if every Invoke() succeeded
+    *
+    **/
+    bool classify_batch(const float* const features[], int count, float output[][2]);
+
+    /**
+    * @brief  arena_usage(): The parts of the tensor arena used by the model
+    *
+    *   The arena is painted in begin(), so this measures what AllocateTensors()
+    *   and the Invoke() calls since then have used.
+    *
+    * @return ArenaUsage: The used parts of the arena
+    *
+    **/
+    ArenaUsage arena_usage();
+
+    /**
+    * @brief  model_data(): The flatbuffer of a model
+    *
+    * @param const char* name: Name of the model, like for begin().
+    * @param int* length: Set to the length of the flatbuffer in bytes, if not null.
+    * @return const unsigned char*: The flatbuffer, or nullptr if there is no model with the name
+    *
+    **/
+    static const unsigned char* model_data(const char* name, int* length = nullptr);
+
+    /**
+    * @brief  enable_profiler(): Profile every operation of the model, has to be called before begin()
+    *
+    * @param bool reference_kernels: true to run the micro kernels like the board, instead of the vectorized
+    *   FULLY_CONNECTED of the HostOpResolver.
+    * @return OpProfiler*: The profiler, which lives as long as the classifier
+    *
+    **/
+    OpProfiler* enable_profiler(bool reference_kernels = false);
+
+    int batch;                      /**<  Feature vectors run in every Invoke()   */
+    double invoke_us;               /**<  Time of the last Invoke() in microseconds   */
+    uint64_t invoke_cycles;         /**<  Time stamp counter cycles of the last Invoke(), 0 if the workstation has none   */
+
+  private:
+    TfLiteStatus invoke();
+
+    tflite::MicroInterpreter* interpreter;
+    const float* feature_scales;          /**<  The feature scales of an int8 model   */
+    std::unique_ptr<OpProfiler> profiler; /**<  Profiler wrapping the resolver, if enabled   */
+    std::vector<uint8_t> tensor_arena;
+    std::vector<uint8_t> batched_model;   /**<  The copy of the model with the batch dimension   */
+};
+
+#endif  // HOST_TFLITE_CLASSIFIER_H_
@@ -0,0 +1,108 @@
+/**
+  *
+  *
+  * @file:    afds_arena.cpp
+  * @date:    17-10-2026 07:07:41
+  *
+  * @brief    Measures the tensor arena used by each fall model
+  *
+  *   Usage: afds_arena [--header] [<model> ...]
+  *
+  *     --header    Print the arena sizes as the constants of tensor_arena.h
+  *
+  *   Every model is set up in a painted arena, runs Invoke() once, and the used
+  *   arena is reported split into tensor data, planner scratch and persistent
+  *   structures. The arena sizes add a margin and are rounded up to 256 bytes.
+  *   Without models all the float and int8 models are measured.
+  *
+  *   The persistent structures hold pointers, so the workstation uses more of
+  *   the arena than the 32 bit Cortex-M4. The measurement on the board is done
+  *   by the sketch with MEASURE_TENSOR_ARENA.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "tflite_classifier.h"
+
+namespace {
+
+struct ModelEntry {
+  const char* name;
+  const char* constant;   /**<  Name of the arena size in tensor_arena.h   */
+};
+
+const ModelEntry MODELS[] = {
+  {"f46", "FALL_MODEL_ARENA_SIZE"},
+  {"f46_2", "FALL_MODEL_2_ARENA_SIZE"},
+  {"f46_3", "FALL_MODEL_3_ARENA_SIZE"},
+  {"f46_int8", "FALL_MODEL_INT8_ARENA_SIZE"},
+  {"f46_2_int8", "FALL_MODEL_2_INT8_ARENA_SIZE"},
+  {"f46_3_int8", "FALL_MODEL_3_INT8_ARENA_SIZE"},
+};
+
+// Margin added to the used arena, for the alignment of the arena on the board
+const size_t ARENA_MARGIN = 256;
+
+size_t arena_size(const ArenaUsage& usage) {
+  return (usage.total() + ARENA_MARGIN + 255) / 256 * 256;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--header] [f46|f46_2|f46_3|f46_int8|f46_2_int8|f46_3_int8 ...]\n", name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool header = false;
+  std::vector<const ModelEntry*> models;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--header") == 0) {
+      header = true;
+      continue;
+    }
+    const ModelEntry* model = nullptr;
+    for (const ModelEntry& entry : MODELS) {
+      if (strcmp(argv[arg], entry.name) == 0) {
+        model = &entry;
+      }
+    }
+    if (model == nullptr) {
+      return usage(argv[0]);
+    }
+    models.push_back(model);
+  }
+  if (models.empty()) {
+    for (const ModelEntry& entry : MODELS) {
+      models.push_back(&entry);
+    }
+  }
+
+  if (!header) {
+    printf("%-12s %12s %10s %12s %10s %12s\n", "model", "tensor data", "scratch", "persistent", "total",
+           "arena size");
+  }
+  for (const ModelEntry* model : models) {
+    TfliteClassifier classifier;
+    float features[FEATURE_AMOUNT] = {};
+    float output[2];
+    if (!classifier.begin(model->name) || !classifier.classify(features, output)) {
+      fprintf(stderr, "Can't run %s\n", model->name);
+      return 1;
+    }
+    ArenaUsage used = classifier.arena_usage();
+    if (header) {
+      printf("const int %s = %zu;\n", model->constant, arena_size(used));
+    } else {
+      printf("%-12s %12zu %10zu %12zu %10zu %12zu\n", model->name, used.tensor_data, used.scratch,
+             used.persistent, used.total(), arena_size(used));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,136 @@
+/**
+  *
+  *
+  * @file:    afds_batch.cpp
+  * @date:    17-10-2026 07:19:36
+  *
+  * @brief    Scores many feature vectors with the fall models, one at a time and in batches
+  *
+  *   Usage: afds_batch [--batch <n>] [--windows <n>] [<model> ...]
+  *
+  *     --batch <n>     Feature vectors run in every Invoke() (default 64)
+  *     --windows <n>   Feature vectors scored (default 100000)
+  *
+  *   The windows are the features of the fall and daily signals of the Arduino
+  *   test suite, repeated. Every model scores all of them with one Invoke() per
+  *   window and with the batched model, and the windows per second of both and
+  *   the largest difference of their outputs are reported. The models are
+  *   f46, f46_2, f46_3 and their int8 versions, and without models the three
+  *   float models are scored.
+  *
+**/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "daily_features_data.h"
+#include "fall_features_data.h"
+#include "tflite_classifier.h"
+
+namespace {
+
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+struct Score {
+  bool ok;
+  double seconds;
+  double invoke_us;
+  int falls;
+};
+
+Score score(const char* model, int batch, const std::vector<const float*>& windows, float (*output)[2]) {
+  Score result = {};
+  TfliteClassifier classifier;
+  if (!classifier.begin(model, TfliteClassifier::DEFAULT_ARENA_SIZE, true, batch)) {
+    return result;
+  }
+  auto start = std::chrono::steady_clock::now();
+  if (batch == 1) {
+    for (size_t n = 0; n < windows.size(); n++) {
+      if (!classifier.classify(windows[n], output[n])) {
+        return result;
+      }
+      result.invoke_us += classifier.invoke_us;
+    }
+  } else {
+    if (!classifier.classify_batch(windows.data(), static_cast<int>(windows.size()), output)) {
+      return result;
+    }
+    result.invoke_us = classifier.invoke_us;
+  }
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (size_t n = 0; n < windows.size(); n++) {
+    result.falls += output[n][1] > output[n][0];
+  }
+  result.ok = true;
+  return result;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--batch n] [--windows n] [f46|f46_2|f46_3|f46_int8|f46_2_int8|f46_3_int8 ...]\n",
+          name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int batch = 64;
+  int window_amount = 100000;
+  std::vector<std::string> models;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--batch") == 0 && arg + 1 < argc) {
+      batch = atoi(argv[++arg]);
+    } else if (strcmp(argv[arg], "--windows") == 0 && arg + 1 < argc) {
+      window_amount = atoi(argv[++arg]);
+    } else if (TfliteClassifier::model_data(argv[arg]) != nullptr) {
+      models.push_back(argv[arg]);
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (batch < 1 || window_amount < 1) {
+    return usage(argv[0]);
+  }
+  if (models.empty()) {
+    models = {"f46", "f46_2", "f46_3"};
+  }
+
+  std::vector<const float*> windows(window_amount);
+  for (int n = 0; n < window_amount; n++) {
+    windows[n] = FEATURES[n % FEATURE_SETS];
+  }
+  std::vector<float> single(2 * window_amount);
+  std::vector<float> batched(2 * window_amount);
+
+  printf("Scoring %d windows, %d per batch\n", window_amount, batch);
+  printf("%-12s %16s %16s %10s %14s %8s\n", "model", "single [win/s]", "batched [win/s]", "speedup",
+         "max difference", "falls");
+  int failed = 0;
+  for (const std::string& model : models) {
+    Score one = score(model.c_str(), 1, windows, reinterpret_cast<float (*)[2]>(single.data()));
+    Score many = score(model.c_str(), batch, windows, reinterpret_cast<float (*)[2]>(batched.data()));
+    if (!one.ok || !many.ok) {
+      printf("%-12s failed to run\n", model.c_str());
+      failed = 1;
+      continue;
+    }
+    float difference = 0;
+    for (size_t i = 0; i < single.size(); i++) {
+      difference = fmaxf(difference, fabsf(single[i] - batched[i]));
+    }
+    printf("%-12s %16.0f %16.0f %9.1fx %14g %8d\n", model.c_str(), window_amount / one.seconds,
+           window_amount / many.seconds, one.seconds / many.seconds, difference, many.falls);
+  }
+  return failed;
+}
@@ -0,0 +1,223 @@
+/**
+  *
+  *
+  * @file:    afds_compare.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Runs the float and int8 fall models side by side with the TensorFlow Lite Micro interpreter
+  *
+  *   Usage: afds_compare [--runs <n>] [<f46|f46_2|f46_3> ...]
+  *
+  *     --runs <n>    Times every feature set is classified for the timing (default 100)
+  *
+  *   Every model and its int8 version classify the features of the fall and
+  *   daily signals of the Arduino test suite. For each the accuracy, the
+  *   smallest tensor arena AllocateTensors() succeeds with, and the mean time
+  *   and time stamp counter cycles of Invoke() are reported. The model compiled
+  *   ahead of time by aot_compile is run too, with the largest difference of
+  *   its outputs from Invoke() of the float model. Without models all three
+  *   are compared.
+  *
+**/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <x86intrin.h>
+
+#include "daily_features_data.h"
+#include "fall_features_data.h"
+#include "fall_model_f46_aot.h"
+#include "fall_model_f46_2_aot.h"
+#include "fall_model_f46_3_aot.h"
+#include "tflite_classifier.h"
+
+namespace {
+
+// The features of the test suite, and if they are of a fall
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int LABELS[] = {1, 1, 1, 0, 0, 0};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+// The arena sizes are searched with this granularity
+const size_t ARENA_STEP = 16;
+
+// The infer() of the model compiled ahead of time
+typedef void (*AotInfer)(const float*, float*);
+
+AotInfer aot_infer(const std::string& model) {
+  if (model == "f46") {
+    return fall_model_f46_aot::infer;
+  }
+  if (model == "f46_2") {
+    return fall_model_f46_2_aot::infer;
+  }
+  if (model == "f46_3") {
+    return fall_model_f46_3_aot::infer;
+  }
+  return nullptr;
+}
+
+struct Result {
+  bool ok;
+  int correct;
+  float output[FEATURE_SETS][2];
+  float p_fall[FEATURE_SETS];
+  size_t arena;
+  double invoke_us;
+  double invoke_cycles;
+};
+
+// The smallest arena the model can be set up in, found by bisection
+size_t smallest_arena(const char* name) {
+  size_t low = 0;
+  size_t high = TfliteClassifier::DEFAULT_ARENA_SIZE;
+  TfliteClassifier classifier;
+  if (!classifier.begin(name, high, false)) {
+    return 0;
+  }
+  while (high - low > ARENA_STEP) {
+    size_t mid = (low + high) / 2;
+    if (classifier.begin(name, mid, false)) {
+      high = mid;
+    } else {
+      low = mid;
+    }
+  }
+  return high;
+}
+
+Result run_model(const char* name, int runs) {
+  Result result = {};
+  TfliteClassifier classifier;
+  if (!classifier.begin(name)) {
+    return result;
+  }
+  double total_us = 0;
+  double total_cycles = 0;
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    float output[2];
+    for (int r = 0; r < runs; r++) {
+      if (!classifier.classify(FEATURES[n], output)) {
+        return result;
+      }
+      total_us += classifier.invoke_us;
+      total_cycles += classifier.invoke_cycles;
+    }
+    result.output[n][0] = output[0];
+    result.output[n][1] = output[1];
+    result.p_fall[n] = output[1];
+    result.correct += (output[1] > output[0]) == (LABELS[n] == 1);
+  }
+  result.invoke_us = total_us / (runs * FEATURE_SETS);
+  result.invoke_cycles = total_cycles / (runs * FEATURE_SETS);
+  result.arena = smallest_arena(name);
+  result.ok = true;
+  return result;
+}
+
+// The model compiled ahead of time needs no arena, and is timed like Invoke()
+Result run_aot(AotInfer infer, int runs) {
+  Result result = {};
+  double total_us = 0;
+  double total_cycles = 0;
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    float output[2];
+    for (int r = 0; r < runs; r++) {
+      uint64_t start_cycles = __rdtsc();
+      auto start = std::chrono::steady_clock::now();
+      infer(FEATURES[n], output);
+      auto end = std::chrono::steady_clock::now();
+      total_cycles += static_cast<double>(__rdtsc() - start_cycles);
+      total_us += std::chrono::duration<double, std::micro>(end - start).count();
+    }
+    result.output[n][0] = output[0];
+    result.output[n][1] = output[1];
+    result.p_fall[n] = output[1];
+    result.correct += (output[1] > output[0]) == (LABELS[n] == 1);
+  }
+  result.invoke_us = total_us / (runs * FEATURE_SETS);
+  result.invoke_cycles = total_cycles / (runs * FEATURE_SETS);
+  result.ok = true;
+  return result;
+}
+
+// The largest difference of the outputs of two runs of the feature sets
+float max_difference(const Result& a, const Result& b) {
+  float difference = 0;
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    for (int o = 0; o < 2; o++) {
+      difference = fmaxf(difference, fabsf(a.output[n][o] - b.output[n][o]));
+    }
+  }
+  return difference;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--runs n] [f46|f46_2|f46_3 ...]\n", name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int runs = 100;
+  std::vector<std::string> models;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--runs") == 0 && arg + 1 < argc) {
+      runs = atoi(argv[++arg]);
+    } else if (TfliteClassifier::model_data(argv[arg]) != nullptr &&
+               strstr(argv[arg], "_int8") == nullptr) {
+      models.push_back(argv[arg]);
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (runs <= 0) {
+    return usage(argv[0]);
+  }
+  if (models.empty()) {
+    models = {"f46", "f46_2", "f46_3"};
+  }
+
+  int failed = 0;
+  for (const std::string& model : models) {
+    std::string int8_model = model + "_int8";
+    std::string aot_model = model + "_aot";
+    Result results[3] = {run_model(model.c_str(), runs), run_model(int8_model.c_str(), runs),
+                         run_aot(aot_infer(model), runs)};
+    const char* names[3] = {model.c_str(), int8_model.c_str(), aot_model.c_str()};
+
+    printf("=== %s\n", model.c_str());
+    printf("%-12s %10s %12s %12s %14s   P(fall) of the feature sets\n", "model", "accuracy", "arena [B]",
+           "Invoke [us]", "Invoke cycles");
+    for (int m = 0; m < 3; m++) {
+      if (!results[m].ok) {
+        printf("%-12s failed to run\n", names[m]);
+        failed = 1;
+        continue;
+      }
+      printf("%-12s %7d/%-2d %12zu %12.2f %14.0f  ", names[m], results[m].correct, FEATURE_SETS,
+             results[m].arena, results[m].invoke_us, results[m].invoke_cycles);
+      for (int n = 0; n < FEATURE_SETS; n++) {
+        printf(" %5.3f", results[m].p_fall[n]);
+      }
+      printf("\n");
+    }
+    if (results[0].ok) {
+      printf("%s differs at most %g from Invoke() of %s\n", aot_model.c_str(),
+             max_difference(results[2], results[0]), model.c_str());
+    }
+    printf("\n");
+  }
+  return failed;
+}
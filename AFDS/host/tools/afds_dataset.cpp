@@ -0,0 +1,113 @@
+/**
+  *
+  *
+  * @file:    afds_dataset.cpp
+  * @date:    17-10-2026 07:23:47
+  *
+  * @brief    Evaluates the fall models on a directory of recordings with all cores
+  *
+  *   Usage: afds_dataset [--threads <n>] [--model <name> ...] [--fall-log] <directory>
+  *
+  *     --threads <n>     Worker threads (default one per core)
+  *     --model <name>    Model every signal is classified by, can be repeated
+  *                       (default f46, f46_2 and f46_3)
+  *     --fall-log        The CSV recordings are fall signals saved by the datalogger
+  *
+  *   Every .csv, .bin and .afl recording in the directory and its
+  *   subdirectories is run through the controller, and every signal exceeding
+  *   the threshold through the models, with one interpreter and tensor arena
+  *   per model and thread. The recordings with "fall" or "adl" in their path
+  *   are counted in the confusion matrix of every model.
+  *
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dataset_runner.h"
+#include "tflite_classifier.h"
+
+namespace {
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--threads n] [--model f46|f46_2|f46_3|f46_int8|f46_2_int8|f46_3_int8 ...] "
+          "[--fall-log] <directory>\n", name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int threads = 0;
+  bool fall_log = false;
+  std::vector<std::string> models;
+  std::string directory;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--threads") == 0 && arg + 1 < argc) {
+      threads = atoi(argv[++arg]);
+    } else if (strcmp(argv[arg], "--model") == 0 && arg + 1 < argc &&
+               TfliteClassifier::model_data(argv[arg + 1]) != nullptr) {
+      models.push_back(argv[++arg]);
+    } else if (strcmp(argv[arg], "--fall-log") == 0) {
+      fall_log = true;
+    } else if (directory.empty() && argv[arg][0] != '-') {
+      directory = argv[arg];
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (directory.empty() || threads < 0) {
+    return usage(argv[0]);
+  }
+  if (models.empty()) {
+    models = {"f46", "f46_2", "f46_3"};
+  }
+
+  std::vector<Recording> recordings;
+  if (!find_recordings(directory, recordings)) {
+    fprintf(stderr, "Can't read the directory %s\n", directory.c_str());
+    return 1;
+  }
+
+  // The classifiers live as long as the runner, every thread runs its own
+  std::vector<std::shared_ptr<TfliteClassifier>> classifiers;
+  bool setup_failed = false;
+  DatasetRunner runner(static_cast<int>(models.size()), [&](int model, int thread) -> DatasetRunner::Classifier {
+    std::shared_ptr<TfliteClassifier> classifier(new TfliteClassifier());
+    if (!classifier->begin(models[model].c_str())) {
+      setup_failed = true;
+    }
+    classifiers.push_back(classifier);
+    return [classifier](const float features[FEATURE_AMOUNT], float output[2]) {
+      return classifier->classify(features, output);
+    };
+  }, threads);
+
+  printf("Evaluating %zu recordings in %s with %d threads\n", recordings.size(), directory.c_str(), runner.threads);
+  DatasetReport report = runner.run(recordings, fall_log);
+  if (setup_failed) {
+    fprintf(stderr, "Can't set up the models\n");
+    return 1;
+  }
+
+  printf("%ld recordings (%ld failed to load), %ld samples, %ld signals, %ld stolen by idle threads\n",
+         report.recordings, report.failed, report.samples, report.windows, report.steals);
+  printf("%.3f s: %.0f samples/s, %.0f signals/s\n", report.seconds, report.samples_per_second(),
+         report.windows_per_second());
+  printf("Thread time: load %.3f s, features %.3f s\n\n", report.load_s, report.features_s);
+  printf("%-12s %5s %5s %5s %5s %9s %12s %12s %14s\n", "model", "TP", "FP", "TN", "FN", "accuracy",
+         "sensitivity", "specificity", "inference [s]");
+  for (size_t m = 0; m < models.size(); m++) {
+    const ModelResult& result = report.models[m];
+    const ConfusionMatrix& matrix = result.recordings;
+    printf("%-12s %5ld %5ld %5ld %5ld %9.3f %12.3f %12.3f %14.3f\n", models[m].c_str(), matrix.true_positives,
+           matrix.false_positives, matrix.true_negatives, matrix.false_negatives, matrix.accuracy(),
+           matrix.sensitivity(), matrix.specificity(), result.inference_s);
+  }
+  return report.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+/**
+  *
+  *
+  * @file:    afds_profile.cpp
+  * @date:    17-10-2026 07:48:51
+  *
+  * @brief    Profiles every operation of the fall models with the TensorFlow Lite Micro interpreter
+  *
+  *   Usage: afds_profile [--runs <n>] [--reference] [--csv] [<model> ...]
+  *
+  *     --runs <n>      Times every feature set is classified (default 1000)
+  *     --reference     Run the micro kernels like the board, instead of the
+  *                     vectorized FULLY_CONNECTED of the workstation
+  *     --csv           Print the profile as CSV, one line per node
+  *
+  *   The features of the fall and daily signals of the Arduino test suite are
+  *   classified by every model, and the mean time stamp counter cycles of
+  *   every node are printed with the part of the model they take. The CSV of
+  *   two models, or of a model and its int8 version, can be compared with
+  *   diff. Without models all six are profiled.
+  *
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "daily_features_data.h"
+#include "fall_features_data.h"
+#include "op_profiler.h"
+#include "tflite_classifier.h"
+
+namespace {
+
+// The features of the test suite
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--runs n] [--reference] [--csv] [f46|f46_2|f46_3|f46_int8|f46_2_int8|f46_3_int8 ...]\n",
+          name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int runs = 1000;
+  bool reference = false;
+  bool csv = false;
+  std::vector<std::string> models;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--runs") == 0 && arg + 1 < argc) {
+      runs = atoi(argv[++arg]);
+    } else if (strcmp(argv[arg], "--reference") == 0) {
+      reference = true;
+    } else if (strcmp(argv[arg], "--csv") == 0) {
+      csv = true;
+    } else if (TfliteClassifier::model_data(argv[arg]) != nullptr) {
+      models.push_back(argv[arg]);
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (runs < 1) {
+    return usage(argv[0]);
+  }
+  if (models.empty()) {
+    models = {"f46", "f46_2", "f46_3", "f46_int8", "f46_2_int8", "f46_3_int8"};
+  }
+
+  if (csv) {
+    printf("model,node,op,version,mean_cycles,min_cycles,max_cycles,per_mille\n");
+  }
+  for (const std::string& name : models) {
+    TfliteClassifier classifier;
+    OpProfiler* profiler = classifier.enable_profiler(reference);
+    if (!classifier.begin(name.c_str())) {
+      return 1;
+    }
+    // The first Invoke() is left out, as the caches are cold
+    float output[2];
+    classifier.classify(FEATURES[0], output);
+    profiler->reset();
+    for (int run = 0; run < runs; run++) {
+      for (int f = 0; f < FEATURE_SETS; f++) {
+        if (!classifier.classify(FEATURES[f], output)) {
+          fprintf(stderr, "Invoke() of %s failed\n", name.c_str());
+          return 1;
+        }
+      }
+    }
+
+    uint64_t total = profiler->total_cycles();
+    if (!csv) {
+      printf("%s (%s kernels): %.0f cycles per Invoke() in %d nodes\n", name.c_str(),
+             reference ? "micro" : "host", static_cast<double>(total) / profiler->invokes(), profiler->nodes());
+      printf("%5s %-20s %8s %12s %12s %12s %8s\n", "node", "op", "version", "mean", "min", "max", "part");
+    }
+    for (int i = 0; i < profiler->nodes(); i++) {
+      const NodeProfile& node = profiler->node(i);
+      double mean = static_cast<double>(node.cycles) / node.invokes;
+      double part = total > 0 ? static_cast<double>(node.cycles) / total : 0.0;
+      if (csv) {
+        printf("%s,%d,%s,%d,%.0f,%u,%u,%.0f\n", name.c_str(), i, OpProfiler::op_name(node.op), node.version, mean,
+               node.min_cycles, node.max_cycles, part * 1000);
+      } else {
+        printf("%5d %-20s %8d %12.0f %12u %12u %7.1f%%\n", i, OpProfiler::op_name(node.op), node.version, mean,
+               node.min_cycles, node.max_cycles, part * 100);
+      }
+    }
+    if (!csv) {
+      printf("\n");
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,141 @@
+/**
+  *
+  *
+  * @file:    afds_replay.cpp
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Replays recorded IMU signals through the fall detection faster than real time
+  *
+  *   Usage: afds_replay [options] <trace> [<trace> ...]
+  *
+  *     --model <f46|f46_2|f46_3>   Model used for inference (default f46, like the sketch)
+  *     --cascade                   Run f46 on every signal and f46_2 when f46 is uncertain, like the
+  *                                 sketch with CASCADE_MODE
+  *     --fall-log                  The CSV traces are fall signals saved by the datalogger
+  *     --rate <hz>                 Sample rate of the traces, used for the latency (default 14.9)
+  *     --sd <directory>            Directory used as the MicroSD card (default build/sd_card)
+  *     --save-binary <file.bin>    Save the loaded samples as a binary trace, and exit
+  *
+  *   Traces ending in .bin are binary traces, all other traces are CSV. The traces
+  *   are replayed one after another as one recording.
+  *
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SD.h>
+
+#include "fall_cascade.h"
+#include "tflite_classifier.h"
+#include "trace_replay.h"
+
+static int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--model f46|f46_2|f46_3] [--cascade] [--fall-log] [--rate hz] [--sd dir] "
+                  "[--save-binary file.bin] <trace> [<trace> ...]\n", name);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  const char* model = "f46";
+  const char* binary_path = nullptr;
+  bool fall_log = false;
+  bool cascade_mode = false;
+  // The output data rate of sample rate setting 1, used by SetupIMUDefaults()
+  float rate = 14.9f;
+  std::vector<TraceSample> samples;
+
+  int arg = 1;
+  for (; arg < argc && strncmp(argv[arg], "--", 2) == 0; arg++) {
+    if (strcmp(argv[arg], "--fall-log") == 0) {
+      fall_log = true;
+    } else if (strcmp(argv[arg], "--cascade") == 0) {
+      cascade_mode = true;
+    } else if (arg + 1 >= argc) {
+      return usage(argv[0]);
+    } else if (strcmp(argv[arg], "--model") == 0) {
+      model = argv[++arg];
+    } else if (strcmp(argv[arg], "--rate") == 0) {
+      rate = strtof(argv[++arg], nullptr);
+    } else if (strcmp(argv[arg], "--sd") == 0) {
+      SD.host_set_root(argv[++arg]);
+    } else if (strcmp(argv[arg], "--save-binary") == 0) {
+      binary_path = argv[++arg];
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (arg >= argc || rate <= 0) {
+    return usage(argv[0]);
+  }
+  for (; arg < argc; arg++) {
+    if (!load_trace(argv[arg], fall_log, samples)) {
+      fprintf(stderr, "Can't read trace %s\n", argv[arg]);
+      return 1;
+    }
+  }
+
+  if (binary_path) {
+    if (!save_trace_binary(binary_path, samples)) {
+      fprintf(stderr, "Can't write %s\n", binary_path);
+      return 1;
+    }
+    printf("Saved %zu samples to %s\n", samples.size(), binary_path);
+    return 0;
+  }
+
+  TfliteClassifier classifier;
+  TfliteClassifier large_classifier;
+  FallCascade cascade(CASCADE_LOW, CASCADE_HIGH);
+  if (cascade_mode) {
+    model = "f46";
+  }
+  if (!classifier.begin(model) || (cascade_mode && !large_classifier.begin("f46_2"))) {
+    return 1;
+  }
+  // The fall signals are saved on the simulated card, like on the board
+  SD.begin();
+
+  TraceReplay replay([&](const float features[FEATURE_AMOUNT], float output[2]) {
+    if (!classifier.classify(features, output)) {
+      return false;
+    }
+    if (cascade_mode && cascade.escalate(output)) {
+      return large_classifier.classify(features, output);
+    }
+    return true;
+  });
+  ReplayReport report = replay.run(samples);
+
+  // The latency is the time from the sample exceeding the threshold until the decision
+  printf("%10s %10s %10s %12s %8s %10s %12s\n", "trigger", "decision", "time [s]", "latency [s]",
+         "P(fall)", "prediction", "compute [us]");
+  for (const ReplayDecision& decision : report.decisions) {
+    printf("%10ld %10ld %10.2f %12.2f %8.3f %10s %12.1f\n", decision.trigger_sample, decision.decision_sample,
+           decision.decision_sample / rate, (decision.decision_sample - decision.trigger_sample) / rate,
+           decision.fall_probability,
+           decision.prediction == 1 ? "fall" : "no fall", decision.compute_us);
+  }
+
+  double recorded_seconds = report.samples / rate;
+  printf("\n%ld samples (%.1f s recorded) replayed in %.3f s: %.0f samples/s, %.0fx real time\n",
+         report.samples, recorded_seconds, report.seconds, report.samples_per_second(),
+         report.seconds > 0 ? recorded_seconds / report.seconds : 0.0);
+  printf("%zu triggers, %d falls, %zu no falls\n", report.decisions.size(), report.falls(),
+         report.decisions.size() - report.falls());
+  if (!report.decisions.empty()) {
+    double total_us = 0;
+    double max_us = 0;
+    for (const ReplayDecision& decision : report.decisions) {
+      total_us += decision.compute_us;
+      max_us = decision.compute_us > max_us ? decision.compute_us : max_us;
+    }
+    printf("Decision compute: mean %.1f us, max %.1f us\n", total_us / report.decisions.size(), max_us);
+  }
+  if (cascade_mode) {
+    printf("Cascade: f46_2 ran for %lu of %lu signals (%.1f %%), band [%.2f, %.2f]\n", cascade.escalations,
+           cascade.decisions, 100.0f * cascade.escalation_rate(), cascade.low, cascade.high);
+  }
+  return 0;
+}
@@ -0,0 +1,97 @@
+/**
+  *
+  *
+  * @file:    afds_timing.cpp
+  * @date:    17-10-2026 07:43:12
+  *
+  * @brief    Decodes the stage timing dumped by a sketch built with STAGE_TIMING
+  *
+  *   Usage: afds_timing [--events] <TIMING.bin or serial log>
+  *
+  *     --events    Also print the last events, oldest first
+  *
+  *   The input is either the dump saved on the MicroSD card, or a capture of
+  *   the serial port, in which the last dump is found by its "AFDT" magic
+  *   between the printed text. For every stage the count, min, mean and max
+  *   are printed, and the histogram of the durations.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "stage_timer.h"
+
+static int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--events] <TIMING.bin or serial log>\n", name);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  bool print_events = false;
+  if (arg < argc && strcmp(argv[arg], "--events") == 0) {
+    print_events = true;
+    arg++;
+  }
+  if (arg + 1 != argc) {
+    return usage(argv[0]);
+  }
+
+  FILE* input = fopen(argv[arg], "rb");
+  if (!input) {
+    fprintf(stderr, "Can't read %s\n", argv[arg]);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buffer[512];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+    data.insert(data.end(), buffer, buffer + n);
+  }
+  fclose(input);
+
+  // The last complete dump in the input
+  StageTimer timer;
+  bool found = false;
+  for (size_t offset = data.size(); offset-- > 0 && !found;) {
+    found = data[offset] == 'A' && timer.decode(data.data() + offset, data.size() - offset);
+  }
+  if (!found) {
+    fprintf(stderr, "No stage timing found in %s\n", argv[arg]);
+    return 1;
+  }
+
+  printf("Dumped at %.3f s\n\n", timer.dumped_at() / 1e6);
+  printf("%-10s %8s %10s %10s %10s %12s\n", "stage", "count", "min [us]", "mean [us]", "max [us]", "total [ms]");
+  for (int s = 0; s < STAGE_COUNT; s++) {
+    const StageStats& stats = timer.stats(static_cast<Stage>(s));
+    printf("%-10s %8u %10u %10.1f %10u %12.1f\n", stage_name(s), stats.count, stats.min_us, stats.mean_us(),
+           stats.max_us, stats.total_us / 1e3);
+  }
+
+  printf("\nHistogram (us from)\n%-10s", "stage");
+  for (int b = 0; b < STAGE_HISTOGRAM_BINS; b++) {
+    printf(" %6lu", b == 0 ? 0UL : 1UL << b);
+  }
+  printf("\n");
+  for (int s = 0; s < STAGE_COUNT; s++) {
+    const StageStats& stats = timer.stats(static_cast<Stage>(s));
+    printf("%-10s", stage_name(s));
+    for (int b = 0; b < STAGE_HISTOGRAM_BINS; b++) {
+      printf(" %6u", stats.histogram[b]);
+    }
+    printf("\n");
+  }
+
+  if (print_events) {
+    printf("\n%-10s %14s %14s\n", "stage", "start [us]", "duration [us]");
+    for (int i = 0; i < timer.events(); i++) {
+      const StageEvent& event = timer.event(i);
+      printf("%-10s %14u %14u\n", stage_name(event.stage), event.start_us, event.duration_us);
+    }
+  }
+  return 0;
+}
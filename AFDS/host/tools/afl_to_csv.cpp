@@ -0,0 +1,93 @@
+/**
+  *
+  *
+  * @file:    afl_to_csv.cpp
+  * @date:    17-10-2026 06:47:17
+  *
+  * @brief    Decodes the binary fall logs saved on the MicroSD card to CSV
+  *
+  *   Usage: afl_to_csv [--info] <FALL##.afl> [<output.csv>]
+  *
+  *     --info    Only print the header of the fall log
+  *
+  *   The CSV has the same layout as the fall signals saved by
+  *   datalogger::writeSignalValues(), newest sample first with the x-axes
+  *   reversed, so it can be read by datalogger::readSignalValues() and the
+  *   trace replay with --fall-log. Without an output file the CSV is printed.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "fall_log.h"
+
+static int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--info] <FALL##.afl> [<output.csv>]\n", name);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  bool info_only = false;
+  if (arg < argc && strcmp(argv[arg], "--info") == 0) {
+    info_only = true;
+    arg++;
+  }
+  if (arg >= argc || argc - arg > 2) {
+    return usage(argv[0]);
+  }
+  const char* input_path = argv[arg];
+  const char* output_path = arg + 1 < argc ? argv[arg + 1] : nullptr;
+
+  FILE* input = fopen(input_path, "rb");
+  if (!input) {
+    fprintf(stderr, "Can't read %s\n", input_path);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buffer[FALL_LOG_SECTOR_SIZE];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+    data.insert(data.end(), buffer, buffer + n);
+  }
+  fclose(input);
+
+  FallLogInfo info;
+  int max_samples = static_cast<int>(data.size() / (FALL_LOG_CHANNELS * sizeof(int16_t)));
+  std::vector<float> values(max_samples * FALL_LOG_CHANNELS + FALL_LOG_CHANNELS);
+  float (*samples)[FALL_LOG_CHANNELS] = reinterpret_cast<float (*)[FALL_LOG_CHANNELS]>(values.data());
+  int count = fall_log_decode(data.data(), data.size(), info, samples, max_samples);
+  if (count < 0) {
+    fprintf(stderr, "%s isn't a fall log\n", input_path);
+    return 1;
+  }
+
+  if (info_only) {
+    printf("samples:           %d\n", count);
+    printf("sample rate:       %.1f Hz\n", info.sample_rate);
+    printf("accel resolution:  %g g/LSB\n", info.accel_resolution);
+    printf("gyro resolution:   %g dps/LSB\n", info.gyro_resolution);
+    printf("firmware version:  %u\n", info.firmware_version);
+    printf("model id:          %u\n", info.model_id);
+    return 0;
+  }
+
+  FILE* output = output_path ? fopen(output_path, "w") : stdout;
+  if (!output) {
+    fprintf(stderr, "Can't write %s\n", output_path);
+    return 1;
+  }
+  // Same amount of decimals as the CSV fall signals
+  for (int i = 0; i < count; i++) {
+    fprintf(output, "%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\r\n", samples[i][0], samples[i][1], samples[i][2],
+            samples[i][3], samples[i][4], samples[i][5]);
+  }
+  if (output_path && fclose(output) != 0) {
+    fprintf(stderr, "Can't write %s\n", output_path);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,200 @@
+/**
+  *
+  *
+  * @file:    aot_compile.cpp
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    Compiles a float fall model ahead of time to C++ without the interpreter
+  *
+  *   Usage: aot_compile [--out <directory>] <f46|f46_2|f46_3>
+  *
+  *     --out <directory>   Directory of the generated header (default .)
+  *
+  *   Writes fall_model_<model>_aot.h, with the weights as constexpr arrays and
+  *   an infer() function running the two fully connected layers, the
+  *   activation and the softmax. infer() does the same float operations in the
+  *   same order as the reference kernels of TensorFlow Lite Micro 1.15, so it
+  *   gives the same outputs as Invoke() when compiled with the same floating
+  *   point settings.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "model_quantizer.h"
+
+namespace {
+
+struct ModelEntry {
+  const char* name;
+  const unsigned char* data;
+  const char* array;      /**<  Name of the array of the float model   */
+};
+
+const ModelEntry MODELS[] = {
+  {"f46", fall_model_data, "fall_model_data"},
+  {"f46_2", fall_model_2_data, "fall_model_2_data"},
+  {"f46_3", fall_model_3_data, "fall_model_3_data"},
+};
+
+// %.9g gives the exact float back, so the weights are the same as in the flatbuffer
+void write_values(FILE* file, const float* values, int n, const char* indent) {
+  for (int i = 0; i < n; i++) {
+    char literal[32];
+    snprintf(literal, sizeof(literal), "%.9g", values[i]);
+    // A float literal needs a point or an exponent before the suffix
+    const char* point = strpbrk(literal, ".e") == nullptr ? ".0" : "";
+    fprintf(file, "%s%s%sf%s", i % 6 == 0 ? indent : " ", literal, point, i + 1 < n ? "," : "");
+    if (i % 6 == 5 || i + 1 == n) {
+      fprintf(file, "\n");
+    }
+  }
+}
+
+void write_layer(FILE* file, const DenseLayer& layer, const char* name) {
+  fprintf(file, "constexpr float k%sWeights[%d][%d] = {\n", name, layer.outputs, layer.inputs);
+  for (int o = 0; o < layer.outputs; o++) {
+    fprintf(file, "  {\n");
+    write_values(file, &layer.weights[o * layer.inputs], layer.inputs, "    ");
+    fprintf(file, "  }%s\n", o + 1 < layer.outputs ? "," : "");
+  }
+  fprintf(file, "};\n\nconstexpr float k%sBias[%d] = {\n", name, layer.outputs);
+  write_values(file, layer.bias.data(), layer.outputs, "  ");
+  fprintf(file, "};\n\n");
+}
+
+bool write_header(const std::string& dir, const ModelEntry& entry, const DenseModel& model) {
+  std::string base = "fall_model_" + std::string(entry.name) + "_aot";
+  std::string path = dir + "/" + base + ".h";
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  std::string guard = base + "_H_";
+  for (char& c : guard) {
+    c = static_cast<char>(toupper(c));
+  }
+  const char* activation = model.tanh ? "std::tanh(total + kHiddenBias[o])"
+                                      : "1.f / (1.f + std::exp(-(total + kHiddenBias[o])))";
+
+  fprintf(file,
+    "/**\n"
+    "  *\n"
+    "  *\n"
+    "  * @file:    %s.h\n"
+    "  * @date:    17-10-2026 07:13:09\n"
+    "  *\n"
+    "  * @brief    The model %s compiled ahead of time to C++\n"
+    "  *\n"
+    "  *   Runs the model without the interpreter and the tensor arena. The\n"
+    "  *   layers do the same float operations in the same order as the reference\n"
+    "  *   kernels of TensorFlow Lite Micro, so the outputs are the same as Invoke().\n"
+    "  *\n"
+    "**/\n\n"
+    "// Generated from %s with the host tool:\n"
+    "// aot_compile --out adaptive_fall_detection_system %s\n\n",
+    base.c_str(), entry.name, entry.array, entry.name);
+  fprintf(file, "#ifndef %s\n#define %s\n\n#include <cmath>\n\n", guard.c_str(), guard.c_str());
+  fprintf(file, "namespace %s {\n\n", base.c_str());
+  fprintf(file, "constexpr int kInputs = %d;      /**<  Amount of features   */\n", model.hidden.inputs);
+  fprintf(file, "constexpr int kHidden = %d;      /**<  Amount of neurons in the hidden layer   */\n",
+          model.hidden.outputs);
+  fprintf(file, "constexpr int kOutputs = %d;      /**<  The outputs (no fall, fall)   */\n\n", model.output.outputs);
+  write_layer(file, model.hidden, "Hidden");
+  write_layer(file, model.output, "Output");
+
+  fprintf(file,
+    "/**\n"
+    "* @brief  infer(): Run the model on the features\n"
+    "*\n"
+    "* @param const float in[]: The features of the signal.\n"
+    "* @param float out[]: The two outputs of the model (no fall, fall).\n"
+    "* @return void\n"
+    "*\n"
+    "**/\n"
+    "inline void infer(const float in[kInputs], float out[kOutputs]) {\n"
+    "  // FULLY_CONNECTED and %s\n"
+    "  float hidden[kHidden];\n"
+    "  for (int o = 0; o < kHidden; o++) {\n"
+    "    float total = 0.f;\n"
+    "    for (int d = 0; d < kInputs; d++) {\n"
+    "      total += in[d] * kHiddenWeights[o][d];\n"
+    "    }\n"
+    "    hidden[o] = %s;\n"
+    "  }\n\n"
+    "  // FULLY_CONNECTED\n"
+    "  float logits[kOutputs];\n"
+    "  for (int o = 0; o < kOutputs; o++) {\n"
+    "    float total = 0.f;\n"
+    "    for (int d = 0; d < kHidden; d++) {\n"
+    "      total += hidden[d] * kOutputWeights[o][d];\n"
+    "    }\n"
+    "    logits[o] = total + kOutputBias[o];\n"
+    "  }\n\n"
+    "  // SOFTMAX with beta 1\n"
+    "  float max_coeff = logits[0];\n"
+    "  for (int i = 1; i < kOutputs; i++) {\n"
+    "    if (logits[i] > max_coeff) max_coeff = logits[i];\n"
+    "  }\n"
+    "  float exp_sum = 0.0;\n"
+    "  for (int i = 0; i < kOutputs; i++) {\n"
+    "    out[i] = std::exp((logits[i] - max_coeff) * 1.0f);\n"
+    "    exp_sum += out[i];\n"
+    "  }\n"
+    "  float reciprocal_sum_exp = 1.f / exp_sum;\n"
+    "  for (int i = 0; i < kOutputs; i++) {\n"
+    "    out[i] *= reciprocal_sum_exp;\n"
+    "  }\n"
+    "}\n\n",
+    model.tanh ? "TANH" : "LOGISTIC", activation);
+  fprintf(file, "}  // namespace %s\n\n#endif  // %s\n", base.c_str(), guard.c_str());
+  return fclose(file) == 0;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--out directory] <f46|f46_2|f46_3>\n", name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string dir = ".";
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "--out") == 0) {
+    dir = argv[arg + 1];
+    arg += 2;
+  }
+  if (arg + 1 != argc) {
+    return usage(argv[0]);
+  }
+  const ModelEntry* entry = nullptr;
+  for (const ModelEntry& model : MODELS) {
+    if (strcmp(argv[arg], model.name) == 0) {
+      entry = &model;
+    }
+  }
+  if (entry == nullptr) {
+    return usage(argv[0]);
+  }
+
+  DenseModel model;
+  if (!model.read(entry->data)) {
+    fprintf(stderr, "The model %s isn't a float dense fall model\n", entry->name);
+    return 1;
+  }
+  if (!write_header(dir, *entry, model)) {
+    fprintf(stderr, "Can't write the header in %s\n", dir.c_str());
+    return 1;
+  }
+  printf("Wrote %s/fall_model_%s_aot.h: %d x %d hidden, %zu weights\n", dir.c_str(), entry->name,
+         model.hidden.outputs, model.hidden.inputs, model.hidden.weights.size() + model.output.weights.size());
+  return 0;
+}
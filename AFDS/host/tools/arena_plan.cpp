@@ -0,0 +1,119 @@
+/**
+  *
+  *
+  * @file:    arena_plan.cpp
+  * @date:    17-10-2026 10:12:48
+  *
+  * @brief    Works out the tensor arena each fall model needs on the Cortex-M4
+  *
+  *   Usage: arena_plan [--header] [--preallocated-input] [<model> ...]
+  *
+  *     --header                Print the arena sizes as the constants of tensor_arena.h
+  *     --preallocated-input    The input is given with RegisterPreallocatedInput(), like the cascade does
+  *
+  *   The arena of every model is split into tensor data, planner scratch and
+  *   persistent structures, following the allocation of the TensorFlow Lite
+  *   Micro library for the Cortex-M4 (see arena_plan.h). The arena sizes add a
+  *   margin for the alignment of the arena and are rounded up to 16 bytes.
+  *   Without models all the float and int8 models are planned.
+  *
+  *   Unlike afds_arena, this doesn't need the TensorFlow Lite sources, and gives
+  *   the 32 bit sizes of the board instead of the sizes on the workstation.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "arena_plan.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_int8.h"
+#include "fall_model_f46_2_int8.h"
+#include "fall_model_f46_3_int8.h"
+
+namespace {
+
+struct ModelEntry {
+  const char* name;
+  const unsigned char* data;
+  const char* constant;   /**<  Name of the arena size in tensor_arena.h   */
+};
+
+const ModelEntry MODELS[] = {
+  {"f46", fall_model_data, "FALL_MODEL_ARENA_SIZE"},
+  {"f46_2", fall_model_2_data, "FALL_MODEL_2_ARENA_SIZE"},
+  {"f46_3", fall_model_3_data, "FALL_MODEL_3_ARENA_SIZE"},
+  {"f46_int8", fall_model_int8_data, "FALL_MODEL_INT8_ARENA_SIZE"},
+  {"f46_2_int8", fall_model_2_int8_data, "FALL_MODEL_2_INT8_ARENA_SIZE"},
+  {"f46_3_int8", fall_model_3_int8_data, "FALL_MODEL_3_INT8_ARENA_SIZE"},
+};
+
+// Margin added to the planned arena, for an arena that isn't 16 byte aligned on the board
+const size_t ARENA_MARGIN = M4_BUFFER_ALIGNMENT - 1;
+
+size_t arena_size(const ArenaUsage& usage) {
+  return (usage.total() + ARENA_MARGIN + 15) / 16 * 16;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--header] [--preallocated-input] [f46|f46_2|f46_3|f46_int8|f46_2_int8|f46_3_int8 ...]\n",
+          name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool header = false;
+  bool preallocated_input = false;
+  std::vector<const ModelEntry*> models;
+  for (int arg = 1; arg < argc; arg++) {
+    if (strcmp(argv[arg], "--header") == 0) {
+      header = true;
+      continue;
+    }
+    if (strcmp(argv[arg], "--preallocated-input") == 0) {
+      preallocated_input = true;
+      continue;
+    }
+    const ModelEntry* model = nullptr;
+    for (const ModelEntry& entry : MODELS) {
+      if (strcmp(argv[arg], entry.name) == 0) {
+        model = &entry;
+      }
+    }
+    if (model == nullptr) {
+      return usage(argv[0]);
+    }
+    models.push_back(model);
+  }
+  if (models.empty()) {
+    for (const ModelEntry& entry : MODELS) {
+      models.push_back(&entry);
+    }
+  }
+
+  if (!header) {
+    printf("%-12s %12s %10s %12s %10s %12s\n", "model", "tensor data", "scratch", "persistent", "total",
+           "arena size");
+  }
+  for (const ModelEntry* model : models) {
+    ArenaUsage planned;
+    if (!plan_arena(model->data, preallocated_input, planned)) {
+      fprintf(stderr, "Can't plan %s\n", model->name);
+      return 1;
+    }
+    if (header) {
+      printf("const int %s = %zu;   /**<  tensor data %zu, scratch %zu, persistent %zu   */\n", model->constant,
+             arena_size(planned), planned.tensor_data, planned.scratch, planned.persistent);
+    } else {
+      printf("%-12s %12zu %10zu %12zu %10zu %12zu\n", model->name, planned.tensor_data, planned.scratch,
+             planned.persistent, planned.total(), arena_size(planned));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,197 @@
+/**
+  *
+  *
+  * @file:    quantize_model.cpp
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Quantizes a float fall model to an int8 model for the sketch
+  *
+  *   Usage: quantize_model [--out <directory>] <f46|f46_2|f46_3>
+  *
+  *     --out <directory>   Directory of the generated model (default .)
+  *
+  *   The ranges of the tensors are calibrated on the features of the fall and
+  *   daily signals of the Arduino test suite. The int8 model is written as
+  *   fall_model_<model>_int8.cpp and .h, in the same form as the float models.
+  *   The accuracy of the int8 reference inference is checked on data it wasn't
+  *   calibrated on: every signal is classified by an int8 model calibrated on
+  *   the other signals, and printed with the float model.
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "daily_features_data.h"
+#include "fall_features_data.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "model_quantizer.h"
+
+namespace {
+
+// The features of the test suite, and if they are of a fall
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int LABELS[] = {1, 1, 1, 0, 0, 0};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+struct ModelEntry {
+  const char* name;
+  const unsigned char* data;
+  int len;
+  const char* array;      /**<  Name of the array of the int8 model   */
+};
+
+const ModelEntry MODELS[] = {
+  {"f46", fall_model_data, fall_model_data_len, "fall_model_int8_data"},
+  {"f46_2", fall_model_2_data, fall_model_2_data_len, "fall_model_2_int8_data"},
+  {"f46_3", fall_model_3_data, fall_model_3_data_len, "fall_model_3_int8_data"},
+};
+
+const char* HEADER_TEMPLATE =
+  "/**\n"
+  "  *\n"
+  "  *\n"
+  "  * @file:    %s\n"
+  "  * @date:    17-10-2026 07:05:29\n"
+  "  *\n"
+  "  * @brief    The int8 quantized version of the model %s, in a C byte array form\n"
+  "  *\n"
+  "  *\n"
+  "  *\n"
+  "  *\n"
+  "**/\n\n";
+
+bool write_header(const std::string& dir, const ModelEntry& model, const std::string& base) {
+  std::string path = dir + "/" + base + ".h";
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  std::string guard = "FALL_MODEL_" + std::string(model.name) + "_INT8_H_";
+  for (char& c : guard) {
+    c = static_cast<char>(toupper(c));
+  }
+  fprintf(file, HEADER_TEMPLATE, (base + ".h").c_str(), model.name);
+  fprintf(file, "// Generated from the float model with the host tool:\n"
+                "// quantize_model --out adaptive_fall_detection_system %s\n\n", model.name);
+  fprintf(file, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+  fprintf(file, "extern const unsigned char %s[];\nextern const int %s_len;\n\n", model.array, model.array);
+  fprintf(file, "#endif  // %s\n", guard.c_str());
+  return fclose(file) == 0;
+}
+
+bool write_source(const std::string& dir, const ModelEntry& model, const std::string& base,
+                  const std::vector<uint8_t>& flatbuffer) {
+  std::string path = dir + "/" + base + ".cpp";
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, HEADER_TEMPLATE, (base + ".cpp").c_str(), model.name);
+  fprintf(file, "// Generated from the float model with the host tool:\n"
+                "// quantize_model --out adaptive_fall_detection_system %s\n\n", model.name);
+  fprintf(file, "#include \"%s.h\"\n\n", base.c_str());
+  fprintf(file, "// We need to keep the data array aligned on some architectures.\n"
+                "#ifdef __has_attribute\n"
+                "#define HAVE_ATTRIBUTE(x) __has_attribute(x)\n"
+                "#else\n"
+                "#define HAVE_ATTRIBUTE(x) 0\n"
+                "#endif\n"
+                "#if HAVE_ATTRIBUTE(aligned) || (defined(__GNUC__) && !defined(__clang__))\n"
+                "#define DATA_ALIGN_ATTRIBUTE __attribute__((aligned(16)))\n"
+                "#else\n"
+                "#define DATA_ALIGN_ATTRIBUTE\n"
+                "#endif\n\n");
+  fprintf(file, "const unsigned char %s[] DATA_ALIGN_ATTRIBUTE = {", model.array);
+  for (size_t i = 0; i < flatbuffer.size(); i++) {
+    fprintf(file, "%s0x%02x", i % 12 == 0 ? (i == 0 ? "\n  " : ",\n  ") : ", ", flatbuffer[i]);
+  }
+  fprintf(file, "\n};\nconst int %s_len = %zu;\n", model.array, flatbuffer.size());
+  return fclose(file) == 0;
+}
+
+int usage(const char* name) {
+  fprintf(stderr, "Usage: %s [--out directory] <f46|f46_2|f46_3>\n", name);
+  return 1;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::string dir = ".";
+  int arg = 1;
+  if (arg + 1 < argc && strcmp(argv[arg], "--out") == 0) {
+    dir = argv[arg + 1];
+    arg += 2;
+  }
+  if (arg + 1 != argc) {
+    return usage(argv[0]);
+  }
+  const ModelEntry* model = nullptr;
+  for (const ModelEntry& entry : MODELS) {
+    if (strcmp(argv[arg], entry.name) == 0) {
+      model = &entry;
+    }
+  }
+  if (model == nullptr) {
+    return usage(argv[0]);
+  }
+
+  DenseModel float_model;
+  if (!float_model.read(model->data)) {
+    fprintf(stderr, "The model %s isn't a float dense fall model\n", model->name);
+    return 1;
+  }
+  std::vector<uint8_t> flatbuffer;
+  quantize_model(float_model, FEATURES, FEATURE_SETS, flatbuffer);
+  Int8Reference int8_model;
+  if (!int8_model.begin(flatbuffer.data())) {
+    fprintf(stderr, "The quantized model can't be read back\n");
+    return 1;
+  }
+
+  std::string base = "fall_model_" + std::string(model->name) + "_int8";
+  if (!write_header(dir, *model, base) || !write_source(dir, *model, base, flatbuffer)) {
+    fprintf(stderr, "Can't write %s/%s.cpp\n", dir.c_str(), base.c_str());
+    return 1;
+  }
+
+  printf("%-8s %12s %12s %12s\n", "features", "label", "P(fall) f32", "P(fall) int8");
+  int float_correct = 0;
+  int int8_correct = 0;
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    // Every signal is left out of the calibration of the int8 model it's classified by
+    const float* calibration[FEATURE_SETS - 1];
+    for (int c = 0; c < FEATURE_SETS - 1; c++) {
+      calibration[c] = FEATURES[c < n ? c : c + 1];
+    }
+    std::vector<uint8_t> held_out;
+    Int8Reference held_out_model;
+    quantize_model(float_model, calibration, FEATURE_SETS - 1, held_out);
+    if (!held_out_model.begin(held_out.data())) {
+      fprintf(stderr, "The quantized model can't be read back\n");
+      return 1;
+    }
+    float float_out[2];
+    float int8_out[2];
+    float_model.classify(FEATURES[n], float_out);
+    held_out_model.classify(FEATURES[n], int8_out);
+    float_correct += (float_out[1] > float_out[0]) == (LABELS[n] == 1);
+    int8_correct += (int8_out[1] > int8_out[0]) == (LABELS[n] == 1);
+    printf("%-8d %12s %12.3f %12.3f\n", n, LABELS[n] ? "fall" : "no fall", float_out[1], int8_out[1]);
+  }
+  printf("\n%s: %d bytes float, %zu bytes int8\n", model->name, model->len, flatbuffer.size());
+  printf("Accuracy: float %d/%d, int8 %d/%d (calibrated without the signal)\n", float_correct, FEATURE_SETS,
+         int8_correct, FEATURE_SETS);
+  printf("Input scale %g, zero point %d\n", int8_model.input_scale, int8_model.input_zero_point);
+  printf("Wrote %s/%s.cpp and .h\n", dir.c_str(), base.c_str());
+  return 0;
+}
@@ -0,0 +1,215 @@
+/**
+  *
+  *
+  * @file:    trace_replay.cpp
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Replays recorded IMU signals through the controller of the sketch
+  *
+  *
+  *
+  *
+**/
+
+#include "trace_replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include <Arduino.h>
+
+#include "afds_controller.h"
+#include "fall_log.h"
+#include "lopy_sim.h"
+
+// Header of the binary trace
+static const char TRACE_MAGIC[4] = {'A', 'F', 'D', 'T'};
+static const uint32_t TRACE_VERSION = 1;
+
+bool load_trace_csv(const char* path, bool fall_log, std::vector<TraceSample>& samples) {
+  FILE* file = fopen(path, "r");
+  if (!file) {
+    return false;
+  }
+  size_t first = samples.size();
+  char line[256];
+  while (fgets(line, sizeof(line), file)) {
+    float values[6];
+    char* pos = line;
+    int count = 0;
+    for (; count < 6; count++) {
+      char* end;
+      values[count] = strtof(pos, &end);
+      if (end == pos) {
+        break;
+      }
+      pos = end;
+      while (*pos == ',' || *pos == ' ' || *pos == '\t') {
+        pos++;
+      }
+    }
+    // Lines without six values, like a header, are skipped
+    if (count < 6) {
+      continue;
+    }
+    TraceSample sample = {values[0], values[1], values[2], values[3], values[4], values[5]};
+    if (fall_log) {
+      // The datalogger saves the ring buffers, where the x-axes are reversed
+      sample.ax = -sample.ax;
+      sample.gx = -sample.gx;
+    }
+    samples.push_back(sample);
+  }
+  fclose(file);
+  if (fall_log) {
+    // The datalogger saves the newest sample first
+    std::reverse(samples.begin() + first, samples.end());
+  }
+  return true;
+}
+
+bool load_trace_binary(const char* path, std::vector<TraceSample>& samples) {
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  char magic[4];
+  uint32_t version = 0;
+  uint32_t count = 0;
+  bool valid = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+               memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0 &&
+               fread(&version, sizeof(version), 1, file) == 1 && version == TRACE_VERSION &&
+               fread(&count, sizeof(count), 1, file) == 1;
+  if (valid) {
+    size_t first = samples.size();
+    samples.resize(first + count);
+    valid = fread(&samples[first], sizeof(TraceSample), count, file) == count;
+    if (!valid) {
+      samples.resize(first);
+    }
+  }
+  fclose(file);
+  return valid;
+}
+
+bool save_trace_binary(const char* path, const std::vector<TraceSample>& samples) {
+  FILE* file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  uint32_t count = static_cast<uint32_t>(samples.size());
+  bool written = fwrite(TRACE_MAGIC, 1, sizeof(TRACE_MAGIC), file) == sizeof(TRACE_MAGIC) &&
+                 fwrite(&TRACE_VERSION, sizeof(TRACE_VERSION), 1, file) == 1 &&
+                 fwrite(&count, sizeof(count), 1, file) == 1 &&
+                 fwrite(samples.data(), sizeof(TraceSample), count, file) == count;
+  return fclose(file) == 0 && written;
+}
+
+bool load_trace_fall_log(const char* path, std::vector<TraceSample>& samples) {
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buffer[FALL_LOG_SECTOR_SIZE];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + n);
+  }
+  fclose(file);
+
+  FallLogInfo info;
+  std::vector<float> values(data.size() / sizeof(int16_t) + 1);
+  int count = fall_log_decode(data.data(), data.size(), info, reinterpret_cast<float (*)[FALL_LOG_CHANNELS]>(values.data()),
+                              static_cast<int>(values.size() / FALL_LOG_CHANNELS));
+  if (count < 0) {
+    return false;
+  }
+  // Like the CSV fall signals, the fall log is saved newest first with the x-axes reversed
+  for (int i = count - 1; i >= 0; i--) {
+    const float* value = &values[i * FALL_LOG_CHANNELS];
+    TraceSample sample = {-value[0], value[1], value[2], -value[3], value[4], value[5]};
+    samples.push_back(sample);
+  }
+  return true;
+}
+
+bool load_trace(const char* path, bool fall_log, std::vector<TraceSample>& samples) {
+  size_t length = strlen(path);
+  if (length > 4 && strcmp(path + length - 4, ".bin") == 0) {
+    return load_trace_binary(path, samples);
+  }
+  if (length > 4 && strcmp(path + length - 4, ".afl") == 0) {
+    return load_trace_fall_log(path, samples);
+  }
+  return load_trace_csv(path, fall_log, samples);
+}
+
+int ReplayReport::falls() const {
+  int count = 0;
+  for (const ReplayDecision& decision : decisions) {
+    count += decision.prediction == 1 ? 1 : 0;
+  }
+  return count;
+}
+
+ReplayReport TraceReplay::run(const std::vector<TraceSample>& samples) {
+  typedef std::chrono::steady_clock Clock;
+
+  // The controller holds the signals, so it's not placed on the stack
+  std::unique_ptr<afdsdCtrl1> ctrl(new afdsdCtrl1());
+
+  // The LoPy acknowledges the alarms as soon as it receives them
+  SimulatedLoPy lopy(1);
+  Serial.host_set_echo(nullptr);
+
+  ReplayReport report;
+  report.samples = static_cast<long>(samples.size());
+  long trigger_sample = -1;
+  float output[2];
+
+  Clock::time_point start = Clock::now();
+  for (size_t n = 0; n < samples.size(); n++) {
+    const TraceSample& sample = samples[n];
+    // Like loop(), the fall alarm is handled before the next sample
+    ctrl->update_alarm();
+    bool signal_ready = ctrl->process_sample(sample.ax, sample.ay, sample.az,
+                                             sample.gx, sample.gy, sample.gz);
+    if (!signal_ready) {
+      // The sample exceeding the threshold starts the signal
+      if (ctrl->threshold >= THRESHOLD && ctrl->extra_signal == 0) {
+        trigger_sample = static_cast<long>(n);
+      }
+      continue;
+    }
+
+    Clock::time_point decision_start = Clock::now();
+    ctrl->feature_calculation();
+    // Like loop(), the signal isn't handled if inference fails
+    if (!classifier(ctrl->features, output)) {
+      continue;
+    }
+    int fall_nr = ctrl->fall_nr;
+    ctrl->predict_fall(output);
+    Clock::time_point decision_end = Clock::now();
+
+    ReplayDecision decision;
+    decision.trigger_sample = trigger_sample;
+    decision.decision_sample = static_cast<long>(n);
+    decision.fall_probability = output[1];
+    decision.prediction = ctrl->fall_nr != fall_nr ? 1 : 0;
+    decision.compute_us = std::chrono::duration<double, std::micro>(decision_end - decision_start).count();
+    report.decisions.push_back(decision);
+
+    // Only the decisions are kept, not the debug output of the controller
+    Serial.host_take_transmitted();
+  }
+  // Save the signal of a fall at the end of the trace
+  ctrl->update_alarm();
+  report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  Serial.host_take_transmitted();
+  Serial.host_set_echo(stdout);
+  return report;
+}
@@ -0,0 +1,142 @@
+/**
+  *
+  *
+  * @file:    trace_replay.h
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Replays recorded IMU signals through the controller of the sketch
+  *
+  *   Every sample goes through afdsdCtrl1::update_alarm() and process_sample(),
+  *   and every finished signal through feature_calculation(), the classifier and
+  *   predict_fall(), the same path as loop() on the board. The replay runs as fast as the
+  *   workstation allows, and reports the throughput, the decisions and the
+  *   latency of every trigger.
+  *
+**/
+
+#ifndef HOST_TRACE_REPLAY_H_
+#define HOST_TRACE_REPLAY_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+
+/**
+* @brief  TraceSample: One IMU sample, in g's and degrees per second in the frame of the IMU
+*
+**/
+struct TraceSample {
+  float ax, ay, az;
+  float gx, gy, gz;
+};
+
+/**
+* @brief  load_trace_csv(): Load a CSV signal with one ax,ay,az,gx,gy,gz sample per line
+*
+*   Recordings are stored oldest sample first in the frame of the IMU. The fall signals
+*   saved by datalogger::writeSignalValues() are stored newest sample first, with the
+*   x-axes reversed like in the signal ring buffers, and are loaded with fall_log set.
+*
+* @param const char* path: Path of the CSV file.
+* @param bool fall_log: true for a fall signal saved by the datalogger.
+* @param std::vector<TraceSample>& samples: The loaded samples are appended to this vector, oldest first.
+* @return bool: true if the file could be read
+*
+**/
+bool load_trace_csv(const char* path, bool fall_log, std::vector<TraceSample>& samples);
+
+/**
+* @brief  load_trace_binary(): Load a binary trace written by save_trace_binary()
+*
+* @param const char* path: Path of the binary trace.
+* @param std::vector<TraceSample>& samples: The loaded samples are appended to this vector, oldest first.
+* @return bool: true if the file could be read and has a valid header
+*
+**/
+bool load_trace_binary(const char* path, std::vector<TraceSample>& samples);
+
+/**
+* @brief  save_trace_binary(): Save samples as a binary trace
+*
+*   The binary trace is the "AFDT" magic, a uint32 version and a uint32 sample count,
+*   followed by six little-endian floats per sample. Loading it doesn't need any
+*   parsing, so long recordings can be replayed many times without the CSV cost.
+*
+* @param const char* path: Path of the binary trace.
+* @param const std::vector<TraceSample>& samples: The samples to save, oldest first.
+* @return bool: true if the file could be written
+*
+**/
+bool save_trace_binary(const char* path, const std::vector<TraceSample>& samples);
+
+/**
+* @brief  load_trace_fall_log(): Load a binary fall log saved by datalogger::writeSignalLog()
+*
+* @param const char* path: Path of the fall log.
+* @param std::vector<TraceSample>& samples: The loaded samples are appended to this vector, oldest first in the frame of the IMU.
+* @return bool: true if the file could be read and is a valid fall log
+*
+**/
+bool load_trace_fall_log(const char* path, std::vector<TraceSample>& samples);
+
+/**
+* @brief  load_trace(): Load a CSV trace, binary trace (.bin) or fall log (.afl), chosen by the extension of the path
+*
+**/
+bool load_trace(const char* path, bool fall_log, std::vector<TraceSample>& samples);
+
+/**
+* @brief  ReplayDecision: The result of one signal, which exceeded the threshold
+*
+**/
+struct ReplayDecision {
+  long trigger_sample;                /**<  Index of the sample, which exceeded the threshold   */
+  long decision_sample;               /**<  Index of the sample, which finished the signal   */
+  float fall_probability;             /**<  output[1] of the model   */
+  int prediction;                     /**<  1 = fall, 0 = no fall, as returned by predictor()   */
+  double compute_us;                  /**<  Host time of feature_calculation(), the classifier and predict_fall()   */
+};
+
+/**
+* @brief  ReplayReport: The result of a replay
+*
+**/
+struct ReplayReport {
+  long samples;                       /**<  Amount of replayed samples   */
+  double seconds;                     /**<  Host time of the replay   */
+  std::vector<ReplayDecision> decisions;
+
+  double samples_per_second() const { return seconds > 0 ? samples / seconds : 0; };
+  int falls() const;
+};
+
+/**
+* @brief  TraceReplay: Drives the controller of the sketch with recorded samples
+*
+**/
+class TraceReplay {
+  public:
+    // Runs the model on the features and writes the two outputs, like Invoke() does
+    typedef std::function<bool(const float features[FEATURE_AMOUNT], float output[2])> Classifier;
+
+    explicit TraceReplay(Classifier classifier) : classifier(classifier) {};
+
+    /**
+    * @brief  run(): Replay the samples through a new controller
+    *
+    *   The LoPy is simulated by acknowledging the alarms on Serial1 at once, and
+    *   the debug output of the controller on Serial is not echoed.
+    *
+    * @param const std::vector<TraceSample>& samples: The samples to replay, oldest first.
+    * @return ReplayReport: The throughput and the decisions of the replay
+    *
+    **/
+    ReplayReport run(const std::vector<TraceSample>& samples);
+
+  private:
+    Classifier classifier;
+};
+
+#endif  // HOST_TRACE_REPLAY_H_
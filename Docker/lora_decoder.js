@@ -0,0 +1,97 @@
+/**
+  *
+  *
+  * @file:    lora_decoder.js
+  * @date:    17-10-2026 11:02:17
+  *
+  * @brief    Payload codec of the fall alarm uplinks for the network server
+  *
+  *   Decode() is the custom JavaScript codec of the application on the
+  *   ChirpStack network server, which gives the objectJSON of the uplinks
+  *   stored in premade_test_files. It decodes like lora_payload.cpp:
+  *
+  *     - FPort 3: the 7 byte bit-packed uplink of lora_payload.h, 22 bits
+  *       latitude, 23 bits longitude, 4 bits battery, 3 bits fall probability
+  *       and 4 bits event counter, most significant bit first. Lat and Lon are
+  *       left out when the GPS had no fix.
+  *     - FPort 2: the 12 byte struct.pack("fff", lat, lon, batt) uplink of the
+  *       earlier firmware, three little endian floats.
+  *
+  *   The codec engine of ChirpStack is ES5, without typed arrays, so the bits
+  *   and floats are read by hand.
+  *
+**/
+
+var LORA_PORT = 3;              // FPort of the packed uplinks
+var LORA_LEGACY_PORT = 2;       // FPort of the uplinks of three floats
+var LORA_PAYLOAD_SIZE = 7;
+var LORA_LEGACY_PAYLOAD_SIZE = 12;
+var LORA_NO_POSITION = 4194303; // 2^22 - 1, latitude of an uplink without a fix
+var LATITUDE_STEPS = 4194302;   // 2^22 - 2
+var LONGITUDE_CODES = 8388608;  // 2^23
+var BATTERY_STEPS = 15;
+var BATTERY_MAX = 4095;
+var CONFIDENCE_STEPS = 7;
+
+// Reads bits most significant bit first, from the bit at offset.at
+function getBits(bytes, offset, bits) {
+  var value = 0;
+  for (var bit = 0; bit < bits; bit++) {
+    value = value * 2 + ((bytes[offset.at >> 3] >> (7 - offset.at % 8)) & 1);
+    offset.at++;
+  }
+  return value;
+}
+
+// IEEE 754 single precision float of 4 little endian bytes
+function getFloat(bytes, start) {
+  var bits = bytes[start] | (bytes[start + 1] << 8) | (bytes[start + 2] << 16) | (bytes[start + 3] << 24);
+  var sign = bits < 0 ? -1 : 1;
+  var exponent = (bits >>> 23) & 0xFF;
+  var mantissa = bits & 0x7FFFFF;
+  if (exponent === 0xFF) {
+    return mantissa ? NaN : sign * Infinity;
+  }
+  if (exponent === 0) {
+    return sign * mantissa * Math.pow(2, -149);
+  }
+  return sign * (mantissa + 0x800000) * Math.pow(2, exponent - 150);
+}
+
+function decodePacked(bytes) {
+  var offset = {at: 0};
+  var latitude = getBits(bytes, offset, 22);
+  var longitude = getBits(bytes, offset, 23);
+  var battery = getBits(bytes, offset, 4);
+  var confidence = getBits(bytes, offset, 3);
+  var counter = getBits(bytes, offset, 4);
+  var uplink = {
+    Battery: Math.floor((battery * BATTERY_MAX + Math.floor(BATTERY_STEPS / 2)) / BATTERY_STEPS),
+    Confidence: 0.5 + 0.5 * confidence / CONFIDENCE_STEPS,
+    Counter: counter
+  };
+  if (latitude !== LORA_NO_POSITION) {
+    uplink.Lat = latitude * 180 / LATITUDE_STEPS - 90;
+    uplink.Lon = longitude * 360 / LONGITUDE_CODES - 180;
+  }
+  return uplink;
+}
+
+function decodeLegacy(bytes) {
+  return {Lat: getFloat(bytes, 0), Lon: getFloat(bytes, 4), Battery: getFloat(bytes, 8)};
+}
+
+function Decode(fPort, bytes) {
+  if (fPort === LORA_PORT && bytes.length === LORA_PAYLOAD_SIZE) {
+    return decodePacked(bytes);
+  }
+  if (fPort === LORA_LEGACY_PORT && bytes.length === LORA_LEGACY_PAYLOAD_SIZE) {
+    return decodeLegacy(bytes);
+  }
+  return {};
+}
+
+// Lets the codec be checked with node on the host, the network server has no module object
+if (typeof module !== "undefined") {
+  module.exports = {Decode: Decode};
+}
@@ -1,5 +1,5 @@
 import binascii
-from pycom import heartbeat, wifi_on_boot, rgbled
+from pycom import heartbeat, wifi_on_boot, rgbled, nvs_set, nvs_get
 import socket
 from time import sleep
 import machine
@@ -26,8 +26,8 @@ lora = LoRa(mode=LoRa.LORAWAN, region=LoRa.EU868)
 ##------------------------------------------------------------------------------------------##
 ##-------------------------------PIN_setup--------------------------------------------------##
 ##-------------------------------UART-------------------------------------------------------##
-uart1 = UART(1) #Usage of default RX = P4 and TX = P3. UART communication with Arduino Nano. 
-uart1.init(9600, bits=8, parity=None, stop=1)
+uart1 = UART(1) #Usage of default RX = P4 and TX = P3. Framed UART communication with Arduino Nano (lopy_link.h)
+uart1.init(115200, bits=8, parity=None, stop=1)
 uart2 = UART(2)
 uart2.init(baudrate=9600, bits=8, parity=None, 
         stop=1, pins=('P20','P21')) #P20: Tx, P21: Rx. Datareception from GPS module
@@ -46,20 +46,84 @@ machine.pin_sleep_wakeup(['P13'], machine.WAKEUP_ANY_HIGH, True)
 class UI():
     def interrupt_handler(self, arg):
         print("Interrupt is called")
-        uart1.write("OK")
-        print("OK written to Arduino")
+        Nano_link().send(LINK_CANCEL)
+        print("Cancel sent to Arduino")
         afdsdCtrl2().go_to_sleep(3600000)
 
     def indicate(self, rgbHex):
         rgbled(rgbHex)
+##-------------------------------Nano link--------------------------------------------------##
+#Frames: sync, type, sequence number, payload length, payload, CRC16 (CRC-16/CCITT-FALSE of type to payload)
+LINK_SYNC = 0xA5
+LINK_ALARM = 1
+LINK_ACK = 2
+LINK_CANCEL = 3
+LINK_HEARTBEAT = 4
+
+class Nano_link():
+    seq = 0
+
+    def crc16(self, data):
+        crc = 0xFFFF
+        for byte in data:
+            crc ^= byte << 8
+            for _ in range(8):
+                crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+        return crc
+
+    def send(self, frame_type, seq=None, payload=b''):
+        if seq is None:
+            seq = Nano_link.seq
+            Nano_link.seq = (Nano_link.seq + 1) & 0xFF
+        body = bytes([frame_type, seq, len(payload)]) + payload
+        uart1.write(bytes([LINK_SYNC]) + body + struct.pack("<H", self.crc16(body)))
+
+    def read_frame(self, timeout_ms):
+        #Returns (type, seq, payload) of the first frame with a correct CRC, or None after timeout_ms
+        buffer = b''
+        waited = 0
+        while waited <= timeout_ms:
+            data = uart1.read()
+            if data:
+                buffer += data
+            while len(buffer) >= 6:
+                if buffer[0] != LINK_SYNC or buffer[3] > 32:
+                    buffer = buffer[1:]
+                    continue
+                size = 6 + buffer[3]
+                if len(buffer) < size:
+                    break
+                if struct.unpack("<H", buffer[size - 2:size])[0] == self.crc16(buffer[1:size - 2]):
+                    return buffer[1], buffer[2], buffer[4:size - 2]
+                buffer = buffer[1:]
+            sleep(0.01)
+            waited += 10
+        return None
+
+    def read_alarm(self, timeout_ms):
+        #Returns (seq, fall number, confidence, lat, lon) of the alarm from the Nano, lat and lon are None without a fix
+        frame = self.read_frame(timeout_ms)
+        while frame is not None and frame[0] != LINK_ALARM:
+            frame = self.read_frame(timeout_ms)
+        if frame is None or len(frame[2]) < 6:
+            return None
+        seq, payload = frame[1], frame[2]
+        lat = lon = None
+        #Absolute GPS packet (GPSPacket.h): header, int32 lat and lon in micro-degrees, int16 altitude, satellites, time
+        #The Nano only sends absolute packets, since the key of the delta packets is lost in deep sleep
+        if len(payload) >= 6 + 16 and payload[6] >> 4 == 1 and payload[6] & 0x08:
+            lat_ud, lon_ud = struct.unpack("<ii", payload[7:15])
+            lat, lon = lat_ud / 1e6, lon_ud / 1e6
+        return seq, payload[0], payload[1] / 255, lat, lon
+##------------------------------------------------------------------------------------------##
 ##-------------------------------Interrupt--------------------------------------------------##
 pin_stop_button = Pin('G17', mode=Pin.IN, pull=Pin.PULL_UP)
 pin_stop_button.callback(Pin.IRQ_FALLING | Pin.IRQ_RISING, UI().interrupt_handler)
 ##------------------------------------------------------------------------------------------##
 
 class Uart_IF():
-    def write_ok_to_arduino(self):
-        uart1.write("OK")
+    def write_ok_to_arduino(self, seq):
+        Nano_link().send(LINK_ACK, seq)
     def get_gps_buffer(self):
         raw_gps_buffer = str(uart2.read())
         telegram_splitted_gps_buffer = raw_gps_buffer.split("$") #Telegrams starts with "$"
@@ -130,19 +194,47 @@ class LoRa_IF():
         lora.nvram_save()
         afdsdCtrl2().go_to_sleep(3600000)
 
-    def send_packet(self, s, lat, lon, batt) :
-	#Serverside will receive a 12 byte payload on the form
-        #lat = payload[0:3] lon = payload[4:7] , battery = payload[8:11]
-        payload = bytes(struct.pack("fff", lat, lon, batt)) 
+    def pack_uplink(self, lat, lon, batt, confidence, counter):
+        #7 byte payload on FPort 3, bit-packed like lora_payload.h: 22 bits latitude, 23 bits longitude,
+        #4 bits battery, 3 bits fall probability and 4 bits event counter, most significant bit first
+        if lat is None or lon is None:
+            lat_code, lon_code = (1 << 22) - 1, 0
+        else:
+            lat_code = int(round(min(max((lat + 90) / 180, 0), 1) * ((1 << 22) - 2)))
+            lon_code = int(round(((lon + 180) / 360 % 1) * (1 << 23))) % (1 << 23)
+        batt_code = int(round(min(max(batt / 4095, 0), 1) * 15))
+        conf_code = int(round(min(max((confidence - 0.5) / 0.5, 0), 1) * 7))
+        bits = lat_code
+        bits = (bits << 23) | lon_code
+        bits = (bits << 4) | batt_code
+        bits = (bits << 3) | conf_code
+        bits = (bits << 4) | (counter & 0x0F)
+        return bytes([(bits >> shift) & 0xFF for shift in range(48, -8, -8)])
+
+    def send_packet(self, s, lat, lon, batt, confidence=0, counter=0) :
+        #Serverside receives the packed payload on FPort 3, the 12 byte struct.pack("fff", lat, lon, batt)
+        #payload of the earlier firmware is still on FPort 2
+        s.bind(3)
+        payload = self.pack_uplink(lat, lon, batt, confidence, counter)
         count = s.send(payload)
         print('Sent %s bytes' % count)
 
+ALARM_SEQ_KEY = "alarm_seq" #NVRAM key of the sequence number of the last alarm sent
+
 class afdsdCtrl2():
     get_current_pos= GPS_module().get_current_pos
     indicate = UI().indicate
     write_ok_to_arduino = Uart_IF().write_ok_to_arduino
+    read_alarm = Nano_link().read_alarm
     lora_if = LoRa_IF()
 
+    def last_alarm_seq(self):
+        #Sequence number of the last alarm sent, kept in NVRAM through deep sleep
+        try:
+            return nvs_get(ALARM_SEQ_KEY)
+        except ValueError: #No alarm sent yet
+            return None
+
     def go_to_sleep(self, sleeptime):
         while True:
             self.indicate(green)
@@ -158,9 +250,24 @@ class afdsdCtrl2():
         self.indicate(red) #Red when package sending is started
         s = self.lora_if.set_socket_configuration()
 
+        ##Alarm from the Nano, which sends it again every second until it is acknowledged##
+        alarm = self.read_alarm(3000)
+        seq = alarm[0] if alarm is not None else 0
+        if alarm is not None:
+            #Acknowledged right away, so the Nano stops sending it while the GPS and LoRa take their time
+            self.write_ok_to_arduino(seq)
+            print("Alarm acknowledged to Ardunio")
+            #An alarm sent again before the acknowledgement arrived has the sequence number of the last uplink
+            if self.last_alarm_seq() == seq:
+                print("Alarm {} already sent".format(seq))
+                self.go_to_sleep(1000)
+
         ##GPS section##
-        lat, lon, waittime = self.get_current_pos(second_to_gps_try)
-        print(waittime)
+        if alarm is not None and alarm[3] is not None:
+            lat, lon = alarm[3], alarm[4]
+        else:
+            lat, lon, waittime = self.get_current_pos(second_to_gps_try)
+            print(waittime)
         self.indicate(pink)
         sleep(0.1 )#float(waittime)) #0.1 required else too fast for rgbled
 
@@ -169,10 +276,12 @@ class afdsdCtrl2():
 
         ##Transmission section##
         self.indicate(blue) #Switching to blue when GPS is done.
-        self.lora_if.send_packet(s, lat, lon, batt)
+        if alarm is not None:
+            self.lora_if.send_packet(s, lat, lon, batt, alarm[2], alarm[1])
+            nvs_set(ALARM_SEQ_KEY, seq)
+        else:
+            self.lora_if.send_packet(s, lat, lon, batt)
 
-        self.write_ok_to_arduino()
-        print("OK written to Ardunio")
         print("{} \n {}".format(lat,lon))
         
         self.go_to_sleep(1000)
@@ -0,0 +1,73 @@
+
+/**
+  *
+  *
+  * @file:    constants.h
+  * @date:    26-03-2020 09:32:41
+  * @author:  Morten Sahlertz
+  *
+  * @brief    Constants needed for the system
+  *
+  *
+  *
+  *
+**/
+
+#ifndef CONSTANTS_H_
+#define CONSTANTS_H_
+
+// Define the RBG LED pins
+#define LEDR (22u)                    /**<  Red RBG LED on arduino nano 33 board  */
+#define LEDG (23u)                    /**<  Green RBG LED on arduino nano 33 board  */
+#define LEDB (24u)                    /**<  Blue RBG LED on arduino nano 33 board  */
+// Define the AUDIO pin
+#define AUDIO (3u)                    /**<  Pin for the audio device (digital pin number 3)  */
+// Define the wake up pin for the LoPy, on digital pin 5
+#define WAKE_UP (5u)                  /**<  Pin for the waking up the LoPy (digital pin number 5) */
+
+// This constant is the chip select pin number for the SPI communaction between the
+// Arduino Nano 33 BLE and the SD card reader module 
+const int CS = 10;                  /**<  Chip select pin number for SPI communication between Arduino Nano 33 BLE and SD card reader  */
+// This constant is the amount of features needed to calculate in the model
+const int FEATURE_AMOUNT = 46;      /**<  Amounts of features calculated from the accelerometer and gyroscope data */
+// This constant is the size of the name used to save the fall signal on the SD card
+const int NAME_SIZE = 11;           /**<  Size of the array used to generate the name for the fall signal ("FALL##.afl" and the terminating zero) */
+// This constant is the size of the signal, that we want to calculate features on
+const int SIGNAL_SIZE = 120;        /**<  Size of the signal saved in the signal array */
+// This constant is the version of the firmware, saved in the header of the fall logs
+const int FIRMWARE_VERSION = 1;     /**<  Version of the firmware   */
+// Time the system sleeps between two reads of the IMU FIFO. At 14.9 Hz about 7 of the 32 FIFO samples are filled.
+const unsigned long FIFO_READ_INTERVAL = 500;   /**<  Time in ms between two burst reads of the IMU FIFO   */
+// Time to wait for the "OK" from the LoPy, which has to get a GPS position and send the LoRa alarm
+const unsigned long ALARM_TIMEOUT = 30000;    /**<  Time in ms the LoPy has to answer a fall alarm   */
+// Amount of times the LoPy is woken up for a fall alarm, before the alarm is given up
+const int ALARM_ATTEMPTS = 3;       /**<  Attempts of sending a fall alarm through the LoPy   */
+// Time the wake up pin is low before the LoPy is woken up again
+const unsigned long ALARM_WAKE_PULSE = 100;   /**<  Time in ms the wake up pin is low between two attempts   */
+// The framed link with the LoPy on Serial1. The LoPy misses the frames sent while it starts after being woken up,
+// so the alarm is sent again until it is acknowledged.
+const unsigned long LINK_BAUD = 115200;       /**<  Baud rate of Serial1 on the Nano and UART1 on the LoPy   */
+const unsigned long LINK_RESEND_INTERVAL = 1000;  /**<  Time in ms between two sends of an unacknowledged alarm   */
+// The uncertainty band of the cascade. The large model classifies the signals the small model gives a fall
+// probability inside the band.
+const float CASCADE_LOW = 0.2f;       /**<  Lowest fall probability of the small model escalated to the large model   */
+const float CASCADE_HIGH = 0.8f;      /**<  Highest fall probability of the small model escalated to the large model   */
+// The hop of the continuous mode, where the features and inference run on a sliding signal every hop samples
+// instead of after the threshold. The signals overlap by SIGNAL_SIZE - hop samples.
+const int CONTINUOUS_HOP = 15;      /**<  Samples between two signals of the continuous mode, about a second at 14.9 Hz   */
+const int CONTINUOUS_MIN_HOP = 5;   /**<  Smallest hop, every signal in progress needs its own feature extractor   */
+// The adaptive trigger gate, which learns the distribution of the signal vector magnitude of the wearer. It opens
+// when the magnitude exceeds the GATE_QUANTILE of the wearer plus GATE_MARGIN for GATE_MIN_SAMPLES samples,
+// never below THRESHOLD or above GATE_MAX_LEVEL.
+const float GATE_QUANTILE = 0.99f;    /**<  Quantile of the magnitudes of the wearer the gate is set above   */
+const float GATE_MARGIN = 0.1f;       /**<  Margin in g's above the quantile   */
+const float GATE_MAX_LEVEL = 2.5f;    /**<  Highest level of the gate in g's, so hard impacts always open it   */
+const float GATE_HYSTERESIS = 0.1f;   /**<  The magnitude has to fall this many g's below the level, before the gate opens again   */
+const int GATE_MIN_SAMPLES = 2;       /**<  Samples in a row above the level that open the gate   */
+const unsigned long GATE_WARMUP = 900;        /**<  Samples learned before the gate adapts, about a minute at 14.9 Hz   */
+const unsigned long GATE_HISTORY = 18000;     /**<  Samples after which the older half is forgotten, about 20 minutes   */
+const unsigned long GATE_SAVE_INTERVAL = 8940;  /**<  Samples between two saves of the gate, about 10 minutes   */
+// The threshold of the signal vector magnitude
+const float THRESHOLD = 1.5022;        /**<  Threshold of the signal vector magnitude  */
+
+#endif  // CONSTANTS_H_
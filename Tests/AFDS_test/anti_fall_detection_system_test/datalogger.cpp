@@ -17,9 +17,15 @@
 
 #include <SD.h>
 
-void datalogger::writeSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
-                      float acc_z_arr[], float gyro_x_arr[], float gyro_y_arr[],
-                      float gyro_z_arr[], int signal_length, bool overwrite) {
+// Amount of decimals the signal values are saved with
+const unsigned char SAVE_DECIMALS = 4;
+
+// Shared by the array and the ring buffer version of writeSignalValues. Signal only
+// needs to support [], so the ring buffers can be written without copying them.
+template <typename Signal>
+static void writeSignals(int cs, char name[], const Signal& acc_x_arr, const Signal& acc_y_arr,
+                         const Signal& acc_z_arr, const Signal& gyro_x_arr, const Signal& gyro_y_arr,
+                         const Signal& gyro_z_arr, int signal_length, bool overwrite) {
 
   File file;
   pinMode(cs, OUTPUT);
@@ -33,9 +39,10 @@ void datalogger::writeSignalValues(int cs, char name[], float acc_x_arr[], float
   }
   file = SD.open(name, FILE_WRITE);
   for (int i = 0; i < signal_length; i++) {
-    dataString = String(acc_x_arr[i]) + "," + String(acc_y_arr[i]) + "," +
-                 String(acc_z_arr[i]) + "," + String(gyro_x_arr[i]) + "," +
-                 String(gyro_y_arr[i]) + "," + String(gyro_z_arr[i]);
+    // Saved with SAVE_DECIMALS decimals, because the default two decimals is coarser than the IMU resolution
+    dataString = String(acc_x_arr[i], SAVE_DECIMALS) + "," + String(acc_y_arr[i], SAVE_DECIMALS) + "," +
+                 String(acc_z_arr[i], SAVE_DECIMALS) + "," + String(gyro_x_arr[i], SAVE_DECIMALS) + "," +
+                 String(gyro_y_arr[i], SAVE_DECIMALS) + "," + String(gyro_z_arr[i], SAVE_DECIMALS);
     if (file) {
       file.println(dataString);
     }
@@ -48,107 +55,126 @@ void datalogger::writeSignalValues(int cs, char name[], float acc_x_arr[], float
     }
   } 
   file.close();
-};  
+}
+
+void datalogger::writeSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
+                      float acc_z_arr[], float gyro_x_arr[], float gyro_y_arr[],
+                      float gyro_z_arr[], int signal_length, bool overwrite) {
+  writeSignals(cs, name, acc_x_arr, acc_y_arr, acc_z_arr,
+               gyro_x_arr, gyro_y_arr, gyro_z_arr, signal_length, overwrite);
+};
+
+void datalogger::writeSignalValues(int cs, char name[], const SignalBuffer& acc_x_sig, const SignalBuffer& acc_y_sig,
+                      const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig, const SignalBuffer& gyro_y_sig,
+                      const SignalBuffer& gyro_z_sig, bool overwrite) {
+  writeSignals(cs, name, acc_x_sig, acc_y_sig, acc_z_sig,
+               gyro_x_sig, gyro_y_sig, gyro_z_sig, acc_x_sig.capacity(), overwrite);
+};
+
+// Shared by the float and the raw version of writeSignalLog. fall_log_encode() has an
+// overload for both kinds of ring buffers.
+template <typename Signal>
+static bool writeLog(int cs, char name[], const FallLogInfo& info, const Signal& acc_x_sig,
+                     const Signal& acc_y_sig, const Signal& acc_z_sig, const Signal& gyro_x_sig,
+                     const Signal& gyro_y_sig, const Signal& gyro_z_sig, bool overwrite) {
+  // Static, so the block isn't placed on the stack while the alarm is handled
+  static uint8_t block[FALL_LOG_BLOCK_SIZE];
+
+  pinMode(cs, OUTPUT);
+  if(overwrite == true) {
+    if(SD.exists(name)) {
+      SD.remove(name);
+    }
+  }
+  int size = fall_log_encode(block, info, acc_x_sig, acc_y_sig, acc_z_sig, gyro_x_sig, gyro_y_sig, gyro_z_sig);
+  File file = SD.open(name, FILE_WRITE);
+  if (!file) {
+    Serial.println("Error writing to file!");
+    return false;
+  }
+  // The whole fall log is written at once, so the SD library can write the sectors directly
+  bool written = file.write(block, size) == static_cast<size_t>(size);
+  file.close();
+  if (!written) {
+    Serial.println("Error writing to file!");
+  }
+  return written;
+}
+
+bool datalogger::writeSignalLog(int cs, char name[], const FallLogInfo& info, const SignalBuffer& acc_x_sig,
+                                const SignalBuffer& acc_y_sig, const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig,
+                                const SignalBuffer& gyro_y_sig, const SignalBuffer& gyro_z_sig, bool overwrite) {
+  return writeLog(cs, name, info, acc_x_sig, acc_y_sig, acc_z_sig, gyro_x_sig, gyro_y_sig, gyro_z_sig, overwrite);
+}
+
+bool datalogger::writeSignalLog(int cs, char name[], const FallLogInfo& info, const RawSignalBuffer& acc_x_sig,
+                                const RawSignalBuffer& acc_y_sig, const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig,
+                                const RawSignalBuffer& gyro_y_sig, const RawSignalBuffer& gyro_z_sig, bool overwrite) {
+  return writeLog(cs, name, info, acc_x_sig, acc_y_sig, acc_z_sig, gyro_x_sig, gyro_y_sig, gyro_z_sig, overwrite);
+}
 
-size_t datalogger::readField(File* file, char* str, size_t size, char* delim) {
-  char ch;
+size_t datalogger::readField(SdBlockReader* reader, char* str, size_t size, char* delimiter) {
   size_t n = 0;
-  while ((n + 1) < size && file->read(&ch, 1) == 1) {
-    // Delete CR.
-    if (ch == '\r') {
-      continue;
+  int ch;
+  *delimiter = 0;
+  while ((ch = reader->read()) >= 0) {
+    if (ch == ',' || ch == '\n') {
+      *delimiter = static_cast<char>(ch);
+      break;
     }
-    str[n++] = ch;
-    if (strchr(delim, ch)) {
-        break;
+    // Delete CR, and the end of a field which is too long
+    if (ch != '\r' && (n + 1) < size) {
+      str[n++] = static_cast<char>(ch);
     }
   }
   str[n] = '\0';
   return n;
 }
 
-void datalogger::readSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
+int datalogger::readSignalValues(int cs, char name[], float acc_x_arr[], float acc_y_arr[],
                       float acc_z_arr[], float gyro_x_arr[], float gyro_y_arr[],
                       float gyro_z_arr[]) {
+  // Static, so the block isn't placed on the stack, like the block of writeLog()
+  static uint8_t block[SD_BLOCK_SIZE];
+  float* columns[] = {acc_x_arr, acc_y_arr, acc_z_arr, gyro_x_arr, gyro_y_arr, gyro_z_arr};
+  const int column_count = sizeof(columns) / sizeof(columns[0]);
 
-  File file;
   pinMode(cs, OUTPUT);
-
-  int l = 0;
-  int line = 0;
-
-  // for testing!
-  Serial.print("Initializing SD card...");
-
-  // see if the card is present and can be initialized:
-  if (!SD.begin(cs)) {
-    Serial.println("Card failed, or not present");
-    // don't do anything more:
-    while (1);
-  }
-  Serial.println("card initialized.");
-
-  delay(3000);
-
-  file = SD.open(name, FILE_READ);
+  // The card is started once by SD.begin() in setup(), so it is only opened here
+  File file = SD.open(name, FILE_READ);
   if (!file) {
     Serial.println("open error");
-    return;
+    return -1;
   }
 
-  file.seek(0);
-
-  size_t n;      // Length of returned field with delimiter.
-  char str[20];  // Must hold longest field with delimiter and zero byte.
+  SdBlockReader reader(&file, block);
+  char str[20];  // Must hold longest field and zero byte.
+  char delimiter;
+  int column = 0;
+  int line = 0;
 
-  // Read the file and print fields.
   while (true) {
-    n = readField(&file, str, sizeof(str), ",\n");
-    // done if Error or at EOF.
-    if (n == 0) break;
-
-    // Print the type of delimiter.
-    if (str[n-1] == ',') {
-      //Serial.print(str[n-1] == ',' ? F("comma: ") : F("endl:  "));
-
-      // Remove the delimiter.
-      str[n-1] = 0;
-      // Increment line count
-      line++;
-
-    } else if (str[n-1] == '\n') {
-      //Serial.print(str[n-1] == ',' ? F("comma: ") : F("endl:  "));
-
-      // Remove the delimiter.
-      str[n-1] = 0;
-      // Reset line count
-      line = 0;
-    } else {
-      // At eof, too long, or read error.  Too long is error.
-      //Serial.print(file.available() ? F("error: ") : F("eof:   "));
+    size_t n = readField(&reader, str, sizeof(str), &delimiter);
+    // Done at EOF
+    if (n == 0 && delimiter == 0) {
+      break;
     }
-    // Print the field.
-    //Serial.println(str);
-    if(line == 1){
-      acc_x_arr[l] = strtod(str, nullptr);
+    if (n > 0 && column < column_count) {
+      columns[column][line] = parse_float(str);
     }
-    if(line == 2){
-      acc_y_arr[l] = strtod(str, nullptr);
-    }
-    if(line == 3){
-      acc_z_arr[l] = strtod(str, nullptr);
-    }
-    if(line == 4){
-      gyro_x_arr[l] = strtod(str, nullptr);
-    }
-    if(line == 5){
-      gyro_y_arr[l] = strtod(str, nullptr);
+    column++;
+    // The line ends with a line break, or with the end of the file
+    if (delimiter != ',') {
+      // Empty lines are skipped
+      if (n > 0 || column > 1) {
+        line++;
+      }
+      column = 0;
     }
-    if(line == 0){
-      gyro_z_arr[l] = strtod(str, nullptr);
-      l++;
+    if (delimiter == 0) {
+      break;
     }
-
   }
   file.close();
+  return line;
 }
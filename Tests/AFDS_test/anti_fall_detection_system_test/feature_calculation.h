@@ -17,13 +17,214 @@
 
 #include <Arduino.h>
 
+#include "signal_buffer.h"
+
+// Length of the windows used for the windowed standard deviation features
+const int STD_WINDOW_LEN = 20;        /**<  Amount of samples in each window for the standard deviation magnitude features  */
+
+/**
+* @brief  FeatureExtractor: Single-pass calculation of the features
+*
+*   Updates the statistics needed for the features every time a new sample is added,
+*   so the features are ready as soon as the last sample of the signal has been added.
+*   The samples must be added oldest first, and the features are the same as calculated
+*   by feature_calc() on arrays where index 0 is the newest sample.
+*
+*   The mean and min/max values are running values, the standard deviation is
+*   calculated with Welford's method, and the windowed standard deviation is
+*   updated by sliding the window one sample at a time instead of recalculating it.
+*
+**/
+class FeatureExtractor {
+  public:
+    FeatureExtractor();
+
+    /**
+    * @brief  reset(): Forget all added samples, so a new signal can be started
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  add_sample(): Add the next sample of the signal
+    *
+    *   Updates all the running statistics with the new sample. The cost is the same
+    *   for every sample, no matter how long the signal is.
+    *
+    * @param float acc_x: The new accelerometer X-axis value.
+    * @param float acc_y: The new accelerometer Y-axis value.
+    * @param float acc_z: The new accelerometer Z-axis value.
+    * @param float gyro_x: The new gyroscope X-axis value.
+    * @param float gyro_y: The new gyroscope Y-axis value.
+    * @param float gyro_z: The new gyroscope Z-axis value.
+    * @return void:
+    *
+    **/
+    void add_sample(float acc_x, float acc_y, float acc_z,
+                    float gyro_x, float gyro_y, float gyro_z);
+
+    /**
+    * @brief  calc_features(): Put the features of the added samples in the features array
+    *
+    *   Only combines the running statistics, so it does not depend on the signal length.
+    *   At least STD_WINDOW_LEN + 1 samples must have been added.
+    *
+    * @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+    * @return void:
+    *
+    **/
+    void calc_features(float calc_feat[]) const;
+
+    /**
+    * @brief  sample_count(): Get the amount of samples added since the last reset
+    *
+    * @param none
+    * @return int: Amount of samples
+    *
+    **/
+    int sample_count() const;
+
+  private:
+    // Running statistics for one signal
+    struct SignalStats {
+      float last;           /**<  The newest sample of the signal   */
+      float max;            /**<  Maximum value of the signal   */
+      float min;            /**<  Minimum value of the signal   */
+      float sum;            /**<  Sum of the signal, used for the mean   */
+      float welford_mean;   /**<  Running mean used by Welford's method   */
+      float welford_m2;     /**<  Sum of squared differences from the mean (Welford's method)   */
+      float max_slope;      /**<  Maximum absolute difference between two samples   */
+    };
+
+    // Statistics only needed for the accelerometer signals
+    struct AccelStats {
+      float last[3];        /**<  The last three samples, last[0] is the newest   */
+      float max_peaks[3];   /**<  The three biggest max peaks found, biggest first   */
+      float min_peaks[3];   /**<  The three smallest min peaks found, smallest first   */
+      float window[STD_WINDOW_LEN];   /**<  The samples in the current standard deviation window   */
+      float window_mean;    /**<  Mean of the current window   */
+      float window_m2;      /**<  Sum of squared differences from the mean of the current window   */
+    };
+
+    void update_signal(SignalStats& stats, float value);
+    void update_accel(AccelStats& stats, float value);
+
+    SignalStats acc[3];     /**<  Running statistics for the accelerometer x, y and z-axis   */
+    SignalStats gyro[3];    /**<  Running statistics for the gyroscope x, y and z-axis   */
+    AccelStats accel[3];    /**<  Peaks and windows for the accelerometer x, y and z-axis   */
+    float max_accel_mag;    /**<  Maximum acceleration magnitude   */
+    float min_accel_mag;    /**<  Minimum acceleration magnitude   */
+    float max_std;          /**<  Maximum windowed standard deviation magnitude   */
+    float max_std_hoz;      /**<  Maximum windowed horizontal standard deviation magnitude   */
+    int window_pos;         /**<  Index in the windows where the next sample is stored   */
+    int samples;            /**<  Amount of samples added since the last reset   */
+};
+
+/**
+* @brief  RawFeatureExtractor: Single-pass calculation of the features from the raw IMU values
+*
+*   Same features as the FeatureExtractor, but the samples are the raw 16-bit values read from
+*   the IMU, and the statistics are updated in integer arithmetic. The sums, extrema, slopes and
+*   peaks are exact, and the variances are calculated from the sums and sums of squares, so only
+*   the final features are scaled with the IMU resolutions and need floating point.
+*
+**/
+class RawFeatureExtractor {
+  public:
+    RawFeatureExtractor();
+
+    /**
+    * @brief  reset(): Forget all added samples, so a new signal can be started
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void reset();
+
+    /**
+    * @brief  add_sample(): Add the next raw sample of the signal
+    *
+    * @param int16_t acc_x: The new raw accelerometer X-axis value.
+    * @param int16_t acc_y: The new raw accelerometer Y-axis value.
+    * @param int16_t acc_z: The new raw accelerometer Z-axis value.
+    * @param int16_t gyro_x: The new raw gyroscope X-axis value.
+    * @param int16_t gyro_y: The new raw gyroscope Y-axis value.
+    * @param int16_t gyro_z: The new raw gyroscope Z-axis value.
+    * @return void:
+    *
+    **/
+    void add_sample(int16_t acc_x, int16_t acc_y, int16_t acc_z,
+                    int16_t gyro_x, int16_t gyro_y, int16_t gyro_z);
+
+    /**
+    * @brief  calc_features(): Put the features of the added samples in the features array
+    *
+    *   The features are scaled to g's and degrees per second with the resolutions of the IMU.
+    *   At least STD_WINDOW_LEN + 1 samples must have been added.
+    *
+    * @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+    * @param float accel_resolution: Accelerometer resolution in g's per LSB.
+    * @param float gyro_resolution: Gyroscope resolution in degrees per second per LSB.
+    * @return void:
+    *
+    **/
+    void calc_features(float calc_feat[], float accel_resolution, float gyro_resolution) const;
+
+    /**
+    * @brief  sample_count(): Get the amount of samples added since the last reset
+    *
+    * @param none
+    * @return int: Amount of samples
+    *
+    **/
+    int sample_count() const;
+
+  private:
+    // Running statistics for one signal
+    struct SignalStats {
+      int16_t last;         /**<  The newest sample of the signal   */
+      int16_t max;          /**<  Maximum value of the signal   */
+      int16_t min;          /**<  Minimum value of the signal   */
+      int32_t max_slope;    /**<  Maximum absolute difference between two samples   */
+      int32_t sum;          /**<  Sum of the signal   */
+      int64_t sum_sq;       /**<  Sum of the squared signal   */
+    };
+
+    // Statistics only needed for the accelerometer signals
+    struct AccelStats {
+      int32_t last[3];      /**<  The last three samples, last[0] is the newest   */
+      int32_t max_peaks[3]; /**<  The three biggest max peaks found, biggest first   */
+      int32_t min_peaks[3]; /**<  The three smallest min peaks found, smallest first   */
+      int16_t window[STD_WINDOW_LEN];   /**<  The samples in the current standard deviation window   */
+      int32_t window_sum;   /**<  Sum of the current window   */
+      int64_t window_sum_sq;  /**<  Sum of the squared samples of the current window   */
+    };
+
+    void update_signal(SignalStats& stats, int16_t value);
+    void update_accel(AccelStats& stats, int16_t value);
+
+    SignalStats acc[3];     /**<  Running statistics for the accelerometer x, y and z-axis   */
+    SignalStats gyro[3];    /**<  Running statistics for the gyroscope x, y and z-axis   */
+    AccelStats accel[3];    /**<  Peaks and windows for the accelerometer x, y and z-axis   */
+    uint32_t max_accel_mag_sq;  /**<  Maximum squared acceleration magnitude   */
+    uint32_t min_accel_mag_sq;  /**<  Minimum squared acceleration magnitude   */
+    int64_t max_var;        /**<  Maximum windowed variance magnitude, times STD_WINDOW_LEN squared   */
+    int64_t max_var_hoz;    /**<  Maximum windowed horizontal variance magnitude, times STD_WINDOW_LEN squared   */
+    int window_pos;         /**<  Index in the windows where the next sample is stored   */
+    int samples;            /**<  Amount of samples added since the last reset   */
+};
 
 /**
 * @brief  feature_calc(): Calculate the features from the signal data from the IMU
 *
 *   Calculates the features from the signals data arrays, accelerometer x-axis, y-axis and z-axis
 *   data arrays and gyroscopes x-axis, y-axus and z-axis data arrays. The calculated features will
-*   be put in the features array.
+*   be put in the features array. The arrays are run through once with a FeatureExtractor,
+*   starting from the end of the arrays.
 *
 *¨@param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
 * @param float acc_x_arr[]: Pointer to the array with the stored accelerometer x-axis data.
@@ -41,4 +242,67 @@ void feature_calc(float calc_feat[], float acc_x_sig[], float acc_y_sig[],
                   float acc_z_sig[], float gyro_x_sig[], float gyro_y_sig[],
                   float gyro_z_sig[], int signal_len);
 
+/**
+* @brief  feature_calc(): Calculate the features from the signal ring buffers
+*
+*   Same calculation as above, but reads the values directly from the signal ring
+*   buffers, so the signals don't need to be copied into arrays first. The full
+*   capacity of the buffers is used as the signal length.
+*
+* @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+* @param SignalBuffer acc_x_sig: Ring buffer with the stored accelerometer x-axis data.
+* @param SignalBuffer acc_y_sig: Ring buffer with the stored accelerometer y-axis data.
+* @param SignalBuffer acc_z_sig: Ring buffer with the stored accelerometer z-axis data.
+* @param SignalBuffer gyro_x_sig: Ring buffer with the stored gyroscope x-axis data.
+* @param SignalBuffer gyro_y_sig: Ring buffer with the stored gyroscope y-axis data.
+* @param SignalBuffer gyro_z_sig: Ring buffer with the stored gyroscope z-axis data.
+* @return void:
+*
+**/
+void feature_calc(float calc_feat[], const SignalBuffer& acc_x_sig, const SignalBuffer& acc_y_sig,
+                  const SignalBuffer& acc_z_sig, const SignalBuffer& gyro_x_sig, const SignalBuffer& gyro_y_sig,
+                  const SignalBuffer& gyro_z_sig);
+
+/**
+* @brief  feature_calc(): Calculate the features from the raw signal data from the IMU
+*
+*   Same calculation as above, but on the raw IMU values with a RawFeatureExtractor. The features
+*   are scaled with the IMU resolutions.
+*
+* @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+* @param const int16_t acc_x_arr[]: Pointer to the array with the raw accelerometer x-axis data.
+* @param const int16_t acc_y_arr[]: Pointer to the array with the raw accelerometer y-axis data.
+* @param const int16_t acc_z_arr[]: Pointer to the array with the raw accelerometer z-axis data.
+* @param const int16_t gyro_x_arr[]: Pointer to the array with the raw gyroscope x-axis data.
+* @param const int16_t gyro_y_arr[]: Pointer to the array with the raw gyroscope y-axis data.
+* @param const int16_t gyro_z_arr[]: Pointer to the array with the raw gyroscope z-axis data.
+* @param int signal_len: Amount of samples in the arrays.
+* @param float accel_resolution: Accelerometer resolution in g's per LSB.
+* @param float gyro_resolution: Gyroscope resolution in degrees per second per LSB.
+* @return void:
+*
+**/
+void feature_calc(float calc_feat[], const int16_t acc_x_sig[], const int16_t acc_y_sig[],
+                  const int16_t acc_z_sig[], const int16_t gyro_x_sig[], const int16_t gyro_y_sig[],
+                  const int16_t gyro_z_sig[], int signal_len, float accel_resolution, float gyro_resolution);
+
+/**
+* @brief  feature_calc(): Calculate the features from the raw signal ring buffers
+*
+* @param float calc_feat[]: Pointer to the array where the user wants to store the calculated feature values
+* @param RawSignalBuffer acc_x_sig: Ring buffer with the raw accelerometer x-axis data.
+* @param RawSignalBuffer acc_y_sig: Ring buffer with the raw accelerometer y-axis data.
+* @param RawSignalBuffer acc_z_sig: Ring buffer with the raw accelerometer z-axis data.
+* @param RawSignalBuffer gyro_x_sig: Ring buffer with the raw gyroscope x-axis data.
+* @param RawSignalBuffer gyro_y_sig: Ring buffer with the raw gyroscope y-axis data.
+* @param RawSignalBuffer gyro_z_sig: Ring buffer with the raw gyroscope z-axis data.
+* @param float accel_resolution: Accelerometer resolution in g's per LSB.
+* @param float gyro_resolution: Gyroscope resolution in degrees per second per LSB.
+* @return void:
+*
+**/
+void feature_calc(float calc_feat[], const RawSignalBuffer& acc_x_sig, const RawSignalBuffer& acc_y_sig,
+                  const RawSignalBuffer& acc_z_sig, const RawSignalBuffer& gyro_x_sig, const RawSignalBuffer& gyro_y_sig,
+                  const RawSignalBuffer& gyro_z_sig, float accel_resolution, float gyro_resolution);
+
 #endif  // FEATURE_CALCULATION_H_
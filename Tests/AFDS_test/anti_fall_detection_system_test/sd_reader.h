@@ -0,0 +1,88 @@
+/**
+  *
+  *
+  * @file:    sd_reader.h
+  * @date:    17-10-2026 08:25:28
+  *
+  * @brief    Buffered reading and number parsing of the files on the MicroSD card
+  *
+  *   Reading a file one byte at a time goes through the SD library for every
+  *   byte. SdBlockReader reads whole 512 byte sectors into a block given by
+  *   the caller, and hands out the bytes from the block.
+  *
+  *   parse_float() converts the decimal numbers written by
+  *   datalogger::writeSignalValues() without strtod(), which handles locales,
+  *   hexadecimal numbers and every rounding case, and is slow on the Nano.
+  *
+**/
+
+#ifndef SD_READER_H_
+#define SD_READER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <SD.h>
+
+const int SD_BLOCK_SIZE = 512;        /**<  Bytes read from the MicroSD card at a time, one sector   */
+
+/**
+* @brief  SdBlockReader: Reads a file a block at a time
+*
+**/
+class SdBlockReader {
+  public:
+    /**
+    * @brief  SdBlockReader(): Read a file from its current position
+    *
+    * @param File* file: The open file.
+    * @param uint8_t* block: Buffer of the read bytes, at least SD_BLOCK_SIZE bytes.
+    *
+    **/
+    SdBlockReader(File* file, uint8_t* block) : file(file), block(block) {};
+
+    /**
+    * @brief  read(): Read the next byte of the file
+    *
+    * @param none
+    * @return int: The byte, or -1 at the end of the file or after a read error
+    *
+    **/
+    int read() {
+      if (position == length && !fill()) {
+        return -1;
+      }
+      return block[position++];
+    };
+
+    unsigned long blocks() const { return block_count; };
+
+  private:
+    File* file;                       /**<  The file being read   */
+    uint8_t* block;                   /**<  The last block read from the file   */
+    int position = 0;                 /**<  Index of the next byte in the block   */
+    int length = 0;                   /**<  Amount of bytes in the block   */
+    unsigned long block_count = 0;    /**<  Amount of blocks read from the file   */
+
+    bool fill();
+};
+
+/**
+* @brief  parse_float(): Convert a decimal number like "-1.2345" to a float
+*
+*   Handles a sign, the decimals, an exponent like "1.5e-3", and "nan" and
+*   "inf" as printed by the Arduino String. Numbers of up to 9 digits with at
+*   most 10 decimals, like the fields of the datalogger, are collected in an
+*   uint32_t and divided by a float power of ten, which gives the float of
+*   strtof(). Longer numbers, exponents and mantissas beyond 2^24 go through an
+*   uint64_t and a double, where in rare cases halfway between two floats the
+*   float can be one unit in the last place off.
+*
+* @param const char* str: The number.
+* @param const char** end: Set to the character after the number, when not nullptr.
+* @return float: The number, or 0 if str doesn't start with a number
+*
+**/
+float parse_float(const char* str, const char** end = nullptr);
+
+#endif  // SD_READER_H_
@@ -0,0 +1,163 @@
+/**
+  *
+  *
+  * @file:    signal_buffer.h
+  * @date:    17-10-2026 06:27:55
+  *
+  * @brief    Ring buffer used to store the IMU signals
+  *
+  *
+  *
+  *
+**/
+
+#ifndef SIGNAL_BUFFER_H_
+#define SIGNAL_BUFFER_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "constants.h"
+
+/**
+* @brief  RingBuffer: Fixed size ring buffer for a single signal
+*
+*   Stores the last N values of a signal. Pushing a new value only moves the
+*   head index, so the cost of a push is constant and not dependent on the
+*   signal size. Index 0 is always the newest value and index N-1 the oldest,
+*   which is the same ordering as the old shift-register arrays, so the
+*   buffer can be read with [] just like an array.
+*
+**/
+template <typename T, int N>
+class RingBuffer {
+  public:
+    RingBuffer() {
+      clear();
+    };
+
+    /**
+    * @brief  push(): Push the new value into the buffer
+    *
+    *   Pushes the new value into the buffer, overwriting the oldest value.
+    *
+    * @param T new_value: The new value to push into the buffer.
+    * @return void:
+    *
+    **/
+    void push(T new_value) {
+      head = (head == 0) ? (N - 1) : (head - 1);
+      values[head] = new_value;
+    };
+
+    /**
+    * @brief  operator[](): Get a value from the buffer
+    *
+    * @param int i: Age of the value, where 0 is the newest and N-1 the oldest value.
+    * @return T: The value
+    *
+    **/
+    T operator[](int i) const {
+      int pos = head + i;
+      if (pos >= N) {
+        pos -= N;
+      }
+      return values[pos];
+    };
+
+    /**
+    * @brief  newest(): Get the newest value in the buffer
+    *
+    * @param none
+    * @return T: The newest value
+    *
+    **/
+    T newest() const {
+      return values[head];
+    };
+
+    /**
+    * @brief  capacity(): Get the amount of values the buffer holds
+    *
+    * @param none
+    * @return int: The capacity of the buffer
+    *
+    **/
+    int capacity() const {
+      return N;
+    };
+
+    /**
+    * @brief  linearize(): Copy the buffer into a caller array
+    *
+    *   Copies the values newest first into the chosen array, so the array
+    *   gets the same layout as the old shift-register arrays.
+    *
+    * @param T out[]: Pointer to the array of at least N values, where the values are stored.
+    * @return void:
+    *
+    **/
+    void linearize(T out[]) const {
+      memcpy(out, &values[head], (N - head) * sizeof(T));
+      memcpy(&out[N - head], values, head * sizeof(T));
+    };
+
+    /**
+    * @brief  clear(): Reset all values in the buffer to zero
+    *
+    * @param none
+    * @return void:
+    *
+    **/
+    void clear() {
+      memset(values, 0, sizeof(values));
+      head = 0;
+    };
+
+  private:
+    T values[N];      /**<  Array used to store the values of the signal   */
+    int head;         /**<  Index of the newest value in the values array   */
+};
+
+// The buffer type used for the accelerometer and gyroscope signals in g's and degrees per second
+typedef RingBuffer<float, SIGNAL_SIZE> SignalBuffer;
+
+// The buffer type used for the raw accelerometer and gyroscope signals read from the IMU. The values
+// are only scaled with the IMU resolutions when the features are calculated, so the signals use half
+// the memory of a SignalBuffer.
+typedef RingBuffer<int16_t, SIGNAL_SIZE> RawSignalBuffer;
+
+/**
+* @brief  to_raw(): Convert a value in g's or degrees per second to the raw IMU value
+*
+*   Rounds to the nearest raw value, and saturates instead of wrapping around.
+*
+* @param float value: The value to convert.
+* @param float inv_resolution: One divided by the resolution of the IMU in g's or degrees per second per LSB.
+* @return int16_t: The raw value
+*
+**/
+inline int16_t to_raw(float value, float inv_resolution) {
+  float raw = roundf(value * inv_resolution);
+  if (raw > 32767.0f) {
+    return 32767;
+  }
+  if (raw < -32768.0f) {
+    return -32768;
+  }
+  return static_cast<int16_t>(raw);
+}
+
+/**
+* @brief  negate_raw(): Negate a raw IMU value, saturating instead of wrapping around
+*
+* @param int16_t value: The raw value.
+* @return int16_t: The negated raw value
+*
+**/
+inline int16_t negate_raw(int16_t value) {
+  return value == -32768 ? 32767 : static_cast<int16_t>(-value);
+}
+
+#endif  // SIGNAL_BUFFER_H_
@@ -21,13 +21,10 @@
 #include "tensorflow/lite/experimental/micro/testing/micro_test.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/version.h"
+#include "constants.h"
 #include "datalogger.h"
 #include "feature_calculation.h"
 
-// Feature amount needed for input to fall algorithm
-const int FEATURE_AMOUNT = 46;
-const int CS = 10;
-
 datalogger sd;
 
 TF_LITE_MICRO_TESTS_BEGIN
@@ -272,7 +269,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationFallSignalNr1) {
   float* falling_features_pointer = falling_features_data_nr1;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], falling_features_pointer[i], abs(0.05*features[i]));
   }
@@ -327,7 +324,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationFallSignalNr2) {
   float* falling_features_pointer = falling_features_data_nr2;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], falling_features_pointer[i], abs(0.05*features[i]));
   }
@@ -382,7 +379,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationFallSignalNr3) {
   float* falling_features_pointer = falling_features_data_nr3;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], falling_features_pointer[i], abs(0.05*features[i]));
   }
@@ -437,7 +434,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationDailySignalNr1) {
   float* daily_features_pointer = daily_features_data_nr2;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], daily_features_pointer[i], abs(0.05*features[i]));
   }
@@ -492,7 +489,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationDailySignalNr2) {
   float* daily_features_pointer = daily_features_data_nr2;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], daily_features_pointer[i], abs(0.05*features[i]));
   }
@@ -547,7 +544,7 @@ TF_LITE_MICRO_TEST(SDFeatureCalculationDailySignalNr3) {
   float* daily_features_pointer = daily_features_data_nr3;
 
   // Check if the calculated feature data is within 5% of the features calculated for training algorithm
-  // Reason for not checking if equal, is because of the SD float are saved with only 2 decimals.
+  // Reason for not checking if equal, is because of the SD float are saved with only 4 decimals.
   for (int i = 0; i < FEATURE_AMOUNT; i++) {
     TF_LITE_MICRO_EXPECT_NEAR(features[i], daily_features_pointer[i], abs(0.05*features[i]));
   }
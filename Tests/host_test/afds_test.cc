@@ -0,0 +1,15 @@
+/**
+  *
+  *
+  * @file:    afds_test.cc
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Runs the Arduino test suite of Tests/AFDS_test on the workstation
+  *
+  *   The feature calculation and datalogger tests are built against the sources
+  *   of the sketch and the Arduino shim, so the MicroSD card tests use the
+  *   simulated card in the build directory.
+  *
+**/
+
+#include "../AFDS_test/anti_fall_detection_system_test/testing.h"
@@ -0,0 +1,114 @@
+/**
+  *
+  *
+  * @file:    aot_model_test.cc
+  * @date:    17-10-2026 07:13:09
+  *
+  * @brief    Tests of the fall models compiled ahead of time against the interpreter kernels
+  *
+  *   Invoke() of the float models runs the reference kernels FULLY_CONNECTED,
+  *   LOGISTIC and SOFTMAX of TensorFlow Lite Micro. The interpreter can't be
+  *   linked on the host, so the same kernels are run here on the weights read
+  *   from the flatbuffer, and infer() has to give the same bits.
+  *
+**/
+
+#include <cmath>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+#include "../AFDS_test/anti_fall_detection_system_test/daily_features_data.h"
+#include "../AFDS_test/anti_fall_detection_system_test/fall_features_data.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_aot.h"
+#include "fall_model_f46_2_aot.h"
+#include "fall_model_f46_3_aot.h"
+#include "model_quantizer.h"
+
+namespace {
+
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+void fully_connected(const DenseLayer& layer, const float* input, float* output) {
+  tflite::FullyConnectedParams params;
+  params.float_activation_min = -INFINITY;
+  params.float_activation_max = INFINITY;
+  tflite::reference_ops::FullyConnected(params, tflite::RuntimeShape({1, layer.inputs}), input,
+                                        tflite::RuntimeShape({layer.outputs, layer.inputs}), layer.weights.data(),
+                                        tflite::RuntimeShape({layer.outputs}), layer.bias.data(),
+                                        tflite::RuntimeShape({1, layer.outputs}), output);
+}
+
+// The graph of the float models, run with the kernels of the interpreter
+void invoke(const DenseModel& model, const float* features, float output[2]) {
+  float hidden[256];
+  float logits[2];
+  fully_connected(model.hidden, features, hidden);
+  if (model.tanh) {
+    // TANH has no kernel in this TensorFlow Lite Micro, so std::tanh stands in for it
+    for (int i = 0; i < model.hidden.outputs; i++) {
+      hidden[i] = std::tanh(hidden[i]);
+    }
+  } else {
+    tflite::RuntimeShape shape({1, model.hidden.outputs});
+    tflite::reference_ops::Logistic(shape, hidden, shape, hidden);
+  }
+  fully_connected(model.output, hidden, logits);
+  tflite::reference_ops::Softmax(logits, 2, 1, 1.0f, output);
+}
+
+template <typename Infer>
+bool same_as_invoke(const unsigned char* model_data, Infer infer) {
+  DenseModel model;
+  if (!model.read(model_data)) {
+    return false;
+  }
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    float expected[2];
+    float output[2];
+    invoke(model, FEATURES[n], expected);
+    infer(FEATURES[n], output);
+    if (output[0] != expected[0] || output[1] != expected[1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(AotModelsHaveTheShapeOfTheFlatbuffers) {
+  TF_LITE_MICRO_EXPECT_EQ(fall_model_f46_aot::kInputs, 46);
+  TF_LITE_MICRO_EXPECT_EQ(fall_model_f46_aot::kHidden, 33);
+  TF_LITE_MICRO_EXPECT_EQ(fall_model_f46_2_aot::kHidden, 192);
+  TF_LITE_MICRO_EXPECT_EQ(fall_model_f46_3_aot::kHidden, 69);
+  TF_LITE_MICRO_EXPECT_EQ(fall_model_f46_3_aot::kOutputs, 2);
+}
+
+TF_LITE_MICRO_TEST(AotModelsGiveTheSameBitsAsTheKernels) {
+  TF_LITE_MICRO_EXPECT_TRUE(same_as_invoke(fall_model_data, fall_model_f46_aot::infer));
+  TF_LITE_MICRO_EXPECT_TRUE(same_as_invoke(fall_model_2_data, fall_model_f46_2_aot::infer));
+  TF_LITE_MICRO_EXPECT_TRUE(same_as_invoke(fall_model_3_data, fall_model_f46_3_aot::infer));
+}
+
+TF_LITE_MICRO_TEST(AotModelsClassifyTheTestSignals) {
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    float output[2];
+    fall_model_f46_aot::infer(FEATURES[n], output);
+    TF_LITE_MICRO_EXPECT_EQ(output[1] > output[0], n < 3);
+    TF_LITE_MICRO_EXPECT_NEAR(output[0] + output[1], 1.0f, 1e-6f);
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,135 @@
+/**
+  *
+  *
+  * @file:    continuous_windows_test.cc
+  * @date:    17-10-2026 07:26:46
+  *
+  * @brief    Tests of the overlapping signals of the continuous mode
+  *
+**/
+
+#include <memory>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "afds_controller.h"
+#include "constants.h"
+#include "continuous_windows.h"
+#include "feature_calculation.h"
+#include "signal_buffer.h"
+
+namespace {
+
+const float ACCEL_RES = 0.000732f;
+const float GYRO_RES = 0.07f;
+
+void make_sample(int n, int16_t sample[6]) {
+  sample[0] = static_cast<int16_t>((n * 37) % 400 - 200);
+  sample[1] = static_cast<int16_t>((n * 53) % 300 - 150);
+  sample[2] = static_cast<int16_t>(1366 + (n * 29) % 200 + (n % 97 == 0 ? 3000 : 0));
+  sample[3] = static_cast<int16_t>((n * 71) % 1000 - 500);
+  sample[4] = static_cast<int16_t>((n * 13) % 600 - 300);
+  sample[5] = static_cast<int16_t>((n * 7) % 800 - 400);
+}
+
+// Counts the completed signals of a hop, and the ones with other features than the ring buffers
+void stream(int hop, int samples, int* completed, int* different) {
+  static ContinuousWindows windows;
+  windows = ContinuousWindows(hop);
+  RawSignalBuffer signals[6];
+  *completed = 0;
+  *different = 0;
+  for (int n = 0; n < samples; n++) {
+    int16_t s[6];
+    make_sample(n, s);
+    for (int i = 0; i < 6; i++) {
+      signals[i].push(s[i]);
+    }
+    if (!windows.add_sample(s[0], s[1], s[2], s[3], s[4], s[5])) {
+      continue;
+    }
+    (*completed)++;
+    float features[FEATURE_AMOUNT];
+    float expected[FEATURE_AMOUNT];
+    windows.calc_features(features, ACCEL_RES, GYRO_RES);
+    feature_calc(expected, signals[0], signals[1], signals[2], signals[3], signals[4], signals[5],
+                 ACCEL_RES, GYRO_RES);
+    for (int f = 0; f < FEATURE_AMOUNT; f++) {
+      if (features[f] != expected[f]) {
+        (*different)++;
+        break;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(SignalsHaveTheFeaturesOfTheRingBuffers) {
+  // 17 doesn't divide the signal, so the signals in progress change between 7 and 8
+  const int hops[] = {5, 15, 17, 60, 120};
+  for (int hop : hops) {
+    int completed;
+    int different;
+    stream(hop, 1000, &completed, &different);
+    TF_LITE_MICRO_EXPECT_EQ((1000 - SIGNAL_SIZE) / hop + 1, completed);
+    TF_LITE_MICRO_EXPECT_EQ(0, different);
+  }
+}
+
+TF_LITE_MICRO_TEST(HopIsClamped) {
+  TF_LITE_MICRO_EXPECT_EQ(CONTINUOUS_MIN_HOP, ContinuousWindows(1).hop());
+  TF_LITE_MICRO_EXPECT_EQ(CONTINUOUS_MAX_WINDOWS, ContinuousWindows(1).windows());
+  TF_LITE_MICRO_EXPECT_EQ(SIGNAL_SIZE, ContinuousWindows(1000).hop());
+  TF_LITE_MICRO_EXPECT_EQ(1, ContinuousWindows(1000).windows());
+  TF_LITE_MICRO_EXPECT_EQ(8, ContinuousWindows(CONTINUOUS_HOP).windows());
+}
+
+TF_LITE_MICRO_TEST(ControllerStartsOverAfterAFall) {
+  std::unique_ptr<afdsdCtrl1> ctrl(new afdsdCtrl1());
+  std::unique_ptr<ContinuousWindows> windows(new ContinuousWindows(CONTINUOUS_HOP));
+  int ready_at[3] = {0, 0, 0};
+  int ready = 0;
+  for (int n = 1; n <= 400 && ready < 3; n++) {
+    int16_t s[6];
+    make_sample(n, s);
+    if (!ctrl->process_continuous_sample(*windows, s[0], s[1], s[2], s[3], s[4], s[5])) {
+      continue;
+    }
+    ctrl->continuous_feature_calculation(*windows);
+    ready_at[ready++] = n;
+    // The first signal is predicted as a fall
+    if (ready == 1) {
+      ctrl->reset_fall_variables();
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(SIGNAL_SIZE, ready_at[0]);
+  // After the fall a whole new signal is recorded, then one is ready every hop
+  TF_LITE_MICRO_EXPECT_EQ(2 * SIGNAL_SIZE, ready_at[1]);
+  TF_LITE_MICRO_EXPECT_EQ(2 * SIGNAL_SIZE + CONTINUOUS_HOP, ready_at[2]);
+
+  // The features are those of the ring buffers of the controller, which are saved with a fall
+  float expected[FEATURE_AMOUNT];
+  feature_calc(expected, ctrl->acc_x_arr, ctrl->acc_y_arr, ctrl->acc_z_arr, ctrl->gyro_x_arr, ctrl->gyro_y_arr,
+               ctrl->gyro_z_arr, ctrl->log_info.accel_resolution, ctrl->log_info.gyro_resolution);
+  for (int f = 0; f < FEATURE_AMOUNT; f++) {
+    TF_LITE_MICRO_EXPECT_EQ(expected[f], ctrl->features[f]);
+  }
+}
+
+TF_LITE_MICRO_TEST(BudgetOfTheHop) {
+  ContinuousBudget budget(15.0f, 15);
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, budget.duty_cycle());
+  for (int n = 0; n < 30; n++) {
+    budget.add_sample(100);
+  }
+  budget.add_window(3000);
+  budget.add_window(5000);
+  // 15 samples of 100 us and a signal of 4000 us on average every second
+  TF_LITE_MICRO_EXPECT_NEAR(0.0055f, budget.duty_cycle(), 1e-6f);
+  // A hop of a second, and the longest signal
+  TF_LITE_MICRO_EXPECT_NEAR(1005.0f, budget.latency_ms(), 1e-3f);
+}
+
+TF_LITE_MICRO_TESTS_END
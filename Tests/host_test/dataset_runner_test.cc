@@ -0,0 +1,186 @@
+/**
+  *
+  *
+  * @file:    dataset_runner_test.cc
+  * @date:    17-10-2026 07:23:47
+  *
+  * @brief    Tests of the multi-threaded dataset evaluation
+  *
+  *   The recordings are written to dataset_test/ in the directory the test is
+  *   run in. The models are the float fall model run without the interpreter
+  *   and a classifier deciding on the peak acceleration, so the tests don't
+  *   need the TensorFlow Lite sources.
+  *
+**/
+
+#include <math.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "constants.h"
+#include "dataset_runner.h"
+#include "fall_model_f46.h"
+#include "model_quantizer.h"
+#include "trace_replay.h"
+
+namespace {
+
+const char* const DIRECTORY = "dataset_test";
+
+// The wearer at rest, with a spike exceeding the threshold every period samples
+std::vector<TraceSample> make_recording(int length, int period, float peak) {
+  std::vector<TraceSample> samples;
+  for (int n = 0; n < length; n++) {
+    float wobble = 0.01f * sinf(0.3f * n);
+    TraceSample sample = {0.02f + wobble, -0.01f, 1.0f + wobble, 1.5f, -2.0f, 0.5f + wobble};
+    if (n % period == period / 2) {
+      sample.az = peak;
+      sample.gx = 250.0f;
+    }
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+bool write_csv(const std::string& path, const std::vector<TraceSample>& samples) {
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  for (const TraceSample& s : samples) {
+    fprintf(file, "%f,%f,%f,%f,%f,%f\n", s.ax, s.ay, s.az, s.gx, s.gy, s.gz);
+  }
+  return fclose(file) == 0;
+}
+
+// Four falls and four ADLs of different lengths, two of each in a subdirectory
+std::vector<std::string> write_dataset() {
+  mkdir(DIRECTORY, 0755);
+  mkdir((std::string(DIRECTORY) + "/subject_02").c_str(), 0755);
+  std::vector<std::string> paths;
+  for (int n = 0; n < 8; n++) {
+    bool fall = n % 2 == 0;
+    std::string dir = std::string(DIRECTORY) + (n < 4 ? "" : "/subject_02");
+    std::string name = dir + (fall ? "/Fall_forward_" : "/ADL_walking_") + std::to_string(n);
+    std::vector<TraceSample> samples = make_recording(300 + 150 * n, 200, fall ? 4.0f : 2.0f);
+    if (n % 4 < 2) {
+      save_trace_binary((name + ".bin").c_str(), samples);
+      paths.push_back(name + ".bin");
+    } else {
+      write_csv(name + ".csv", samples);
+      paths.push_back(name + ".csv");
+    }
+  }
+  return paths;
+}
+
+void remove_dataset(const std::vector<std::string>& paths) {
+  for (const std::string& path : paths) {
+    remove(path.c_str());
+  }
+  rmdir((std::string(DIRECTORY) + "/subject_02").c_str());
+  rmdir(DIRECTORY);
+}
+
+DatasetRunner::ClassifierFactory make_factory(const DenseModel& model) {
+  return [&model](int m, int thread) -> DatasetRunner::Classifier {
+    if (m == 0) {
+      return [&model](const float features[FEATURE_AMOUNT], float output[2]) {
+        model.classify(features, output);
+        return true;
+      };
+    }
+    // Feature 36 is the maximum acceleration magnitude of the signal
+    return [](const float features[FEATURE_AMOUNT], float output[2]) {
+      output[1] = features[36] > 3.0f ? 1.0f : 0.0f;
+      output[0] = 1.0f - output[1];
+      return true;
+    };
+  };
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(LabelsComeFromThePath) {
+  TF_LITE_MICRO_EXPECT_EQ(1, recording_label("UMAFall_Subject_01_Fall_forwardFall_1.csv"));
+  TF_LITE_MICRO_EXPECT_EQ(0, recording_label("UMAFall_Subject_01_ADL_Walking_1.csv"));
+  TF_LITE_MICRO_EXPECT_EQ(1, recording_label("data/falling_signal_nr1.csv"));
+  TF_LITE_MICRO_EXPECT_EQ(0, recording_label("data/daily_signal_nr1.csv"));
+  TF_LITE_MICRO_EXPECT_EQ(0, recording_label("falls/adl_sitting.bin"));
+  TF_LITE_MICRO_EXPECT_EQ(-1, recording_label("recordings/session_3.bin"));
+}
+
+TF_LITE_MICRO_TEST(FindsRecordingsInSubdirectories) {
+  std::vector<std::string> paths = write_dataset();
+  std::vector<Recording> recordings;
+  TF_LITE_MICRO_EXPECT_TRUE(find_recordings(DIRECTORY, recordings));
+  TF_LITE_MICRO_EXPECT_EQ(8, static_cast<int>(recordings.size()));
+  int falls = 0;
+  for (const Recording& recording : recordings) {
+    falls += recording.label == 1;
+    TF_LITE_MICRO_EXPECT_TRUE((recording.bytes > 0));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(4, falls);
+  TF_LITE_MICRO_EXPECT_TRUE(!find_recordings("dataset_test_missing", recordings));
+  remove_dataset(paths);
+}
+
+TF_LITE_MICRO_TEST(ThreadsGiveTheSameResultAsOneThread) {
+  std::vector<std::string> paths = write_dataset();
+  std::vector<Recording> recordings;
+  find_recordings(DIRECTORY, recordings);
+  // The same recordings many times, so the threads have to steal
+  std::vector<Recording> dataset;
+  for (int n = 0; n < 6; n++) {
+    dataset.insert(dataset.end(), recordings.begin(), recordings.end());
+  }
+  DenseModel model;
+  TF_LITE_MICRO_EXPECT_TRUE(model.read(fall_model_data));
+
+  DatasetReport one = DatasetRunner(2, make_factory(model), 1).run(dataset);
+  DatasetReport four = DatasetRunner(2, make_factory(model), 4).run(dataset);
+
+  TF_LITE_MICRO_EXPECT_EQ(1, one.threads);
+  TF_LITE_MICRO_EXPECT_EQ(4, four.threads);
+  TF_LITE_MICRO_EXPECT_EQ(48, static_cast<int>(one.recordings));
+  TF_LITE_MICRO_EXPECT_EQ(48, static_cast<int>(four.recordings));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(four.failed));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(one.steals));
+  TF_LITE_MICRO_EXPECT_EQ(one.samples, four.samples);
+  TF_LITE_MICRO_EXPECT_EQ(one.windows, four.windows);
+  TF_LITE_MICRO_EXPECT_TRUE((one.windows > 0));
+  for (int m = 0; m < 2; m++) {
+    const ConfusionMatrix& a = one.models[m].recordings;
+    const ConfusionMatrix& b = four.models[m].recordings;
+    TF_LITE_MICRO_EXPECT_EQ(48, static_cast<int>(b.total()));
+    TF_LITE_MICRO_EXPECT_EQ(a.true_positives, b.true_positives);
+    TF_LITE_MICRO_EXPECT_EQ(a.false_positives, b.false_positives);
+    TF_LITE_MICRO_EXPECT_EQ(a.true_negatives, b.true_negatives);
+    TF_LITE_MICRO_EXPECT_EQ(a.false_negatives, b.false_negatives);
+    TF_LITE_MICRO_EXPECT_EQ(one.models[m].fall_windows, four.models[m].fall_windows);
+  }
+  // The peak acceleration tells the falls from the ADLs of the dataset
+  TF_LITE_MICRO_EXPECT_EQ(24, static_cast<int>(four.models[1].recordings.true_positives));
+  TF_LITE_MICRO_EXPECT_EQ(24, static_cast<int>(four.models[1].recordings.true_negatives));
+  TF_LITE_MICRO_EXPECT_NEAR(1.0f, four.models[1].recordings.accuracy(), 1e-6f);
+  remove_dataset(paths);
+}
+
+TF_LITE_MICRO_TEST(UnreadableRecordingsAreCounted) {
+  std::vector<Recording> dataset = {{"dataset_test_missing/fall_1.bin", 1, 10}};
+  DenseModel model;
+  model.read(fall_model_data);
+  DatasetReport report = DatasetRunner(2, make_factory(model), 2).run(dataset);
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(report.failed));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(report.recordings));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(report.models[0].recordings.total()));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,260 @@
+/**
+  *
+  *
+  * @file:    fall_alarm_test.cc
+  * @date:    17-10-2026 06:49:46
+  *
+  * @brief    Tests of the non-blocking fall alarm of the controller with a simulated LoPy
+  *
+  *   The LoPy is simulated on the other end of Serial1, where it acknowledges
+  *   the alarm frames a chosen time after receiving them. The time is the
+  *   virtual clock of the shim, which is advanced by the samples fed to the
+  *   controller, like on the board.
+  *
+**/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <string.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "afds_controller.h"
+#include "constants.h"
+#include "lopy_link.h"
+#include "lopy_sim.h"
+
+namespace {
+
+// Time between two samples at the default sample rate of 14.9 Hz
+const unsigned long SAMPLE_US = 67114;
+
+// Runs one loop of the sketch with a sample of the wearer lying still, and returns whether the signal is ready
+bool loop_once(afdsdCtrl1& ctrl, SimulatedLoPy& lopy) {
+  lopy.poll();
+  ctrl.update_alarm();
+  host::advance_time_us(SAMPLE_US);
+  return ctrl.process_sample(0.01f, 0.02f, 1.0f, 0.0f, 0.0f, 0.0f);
+}
+
+// Starts a fall alarm on a controller with a full signal
+void fall(afdsdCtrl1& ctrl, float probability = 0.9f) {
+  float fall_output[2] = {1.0f - probability, probability};
+  ctrl.got_data = true;
+  ctrl.predict_fall(fall_output);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(SamplingContinuesWhileLoPySendsAlarm) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  SD.remove("FALL01.afl");
+  Serial.host_set_echo(nullptr);
+  static afdsdCtrl1 ctrl;
+  SimulatedLoPy lopy(12000);
+
+  fall(ctrl);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_WAITING));
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), HIGH);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 50);
+
+  // The signal is saved in the first loop after the fall
+  loop_once(ctrl, lopy);
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL01.afl"));
+
+  // Every loop takes a sample while the LoPy gets a position and sends the alarm
+  int samples = 1;
+  while (ctrl.alarm_state != ALARM_IDLE && samples < 1000) {
+    loop_once(ctrl, lopy);
+    samples++;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_IDLE));
+  TF_LITE_MICRO_EXPECT_EQ(lopy.wake_ups, 1);
+  // The LoPy receives the alarm frame in the loop after the fall, and the acknowledgement arrives in the loop after
+  // it has been sent
+  TF_LITE_MICRO_EXPECT_NEAR(samples, 12000 * 1000 / static_cast<int>(SAMPLE_US) + 3, 2);
+  // The signal after the fall has been collected, so a new fall can be detected
+  TF_LITE_MICRO_EXPECT_TRUE(ctrl.got_data);
+  TF_LITE_MICRO_EXPECT_NEAR(ctrl.acc_z_arr.newest() * ctrl.log_info.accel_resolution, 1.0f, ctrl.log_info.accel_resolution);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), LOW);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 0);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(LEDG), HIGH);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 0);
+
+  // The alarm frame tells the LoPy which fall it is, and how sure the model is
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(lopy.alarms.size()));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(lopy.alarms[0].fall_number));
+  TF_LITE_MICRO_EXPECT_EQ(230, static_cast<int>(lopy.alarms[0].confidence));
+  TF_LITE_MICRO_EXPECT_EQ(link_features_digest(ctrl.features, FEATURE_AMOUNT), lopy.alarms[0].features_digest);
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(lopy.alarms[0].gps_length));
+}
+
+TF_LITE_MICRO_TEST(LoPyIsWokenAgainWhenItDoesNotAnswer) {
+  static afdsdCtrl1 ctrl;
+  // The LoPy never answers
+  SimulatedLoPy lopy(0);
+
+  fall(ctrl);
+  unsigned long start = millis();
+  while (ctrl.alarm_state != ALARM_IDLE && millis() - start < 10 * ALARM_TIMEOUT) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(lopy.wake_ups, ALARM_ATTEMPTS);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 1);
+  TF_LITE_MICRO_EXPECT_TRUE((millis() - start >= ALARM_ATTEMPTS * ALARM_TIMEOUT));
+  TF_LITE_MICRO_EXPECT_TRUE((millis() - start < ALARM_ATTEMPTS * (ALARM_TIMEOUT + ALARM_WAKE_PULSE) + 1000));
+  // The alarm has been given up, which is shown with the red LED
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_IDLE));
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), LOW);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 0);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(LEDR), LOW);
+
+  // The next alarm is answered on the second attempt, which turns off the red LED. In the first attempt the
+  // UART of the LoPy has the wrong baud rate, so the alarm frames arrive garbled.
+  lopy.answer_ms = 1000;
+  lopy.uart.begin(9600);
+  size_t alarms = lopy.alarms.size();
+  fall(ctrl);
+  while (ctrl.alarm_state != ALARM_IDLE) {
+    if (lopy.wake_ups == ALARM_ATTEMPTS + 2) {
+      lopy.uart.begin(LINK_BAUD);
+    }
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(alarms + 1, lopy.alarms.size());
+  TF_LITE_MICRO_EXPECT_EQ(lopy.wake_ups, ALARM_ATTEMPTS + 2);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 1);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(LEDR), HIGH);
+}
+
+TF_LITE_MICRO_TEST(StaleAnswerIsNotTakenForTheAlarm) {
+  static afdsdCtrl1 ctrl;
+  SimulatedLoPy lopy(5000);
+  // An acknowledgement with the sequence number of the next alarm, received before the fall
+  uint8_t frame[LINK_MAX_FRAME];
+  Serial1.host_receive(frame, link_encode(LINK_ACK, 0, nullptr, 0, frame));
+
+  fall(ctrl);
+  loop_once(ctrl, lopy);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_WAITING));
+  while (ctrl.alarm_state != ALARM_IDLE) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(lopy.answers, 1);
+}
+
+TF_LITE_MICRO_TEST(SecondFallDuringAlarmIsSentAgain) {
+  SD.remove("FALL01.afl");
+  SD.remove("FALL02.afl");
+  static afdsdCtrl1 ctrl;
+  SimulatedLoPy lopy(20000);
+
+  fall(ctrl);
+  loop_once(ctrl, lopy);
+  // The wearer falls again while the first alarm is sent
+  for (int i = 0; i < 100; i++) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_WAITING));
+  fall(ctrl);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.fall_nr, 2);
+  loop_once(ctrl, lopy);
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL01.afl"));
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL02.afl"));
+
+  while (ctrl.alarm_state != ALARM_IDLE) {
+    loop_once(ctrl, lopy);
+  }
+  // One alarm for each fall
+  TF_LITE_MICRO_EXPECT_EQ(lopy.wake_ups, 2);
+  TF_LITE_MICRO_EXPECT_EQ(lopy.answers, 2);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 0);
+  TF_LITE_MICRO_EXPECT_EQ(2, static_cast<int>(lopy.alarms[1].fall_number));
+}
+
+TF_LITE_MICRO_TEST(AlarmKeepsItsFallUntilAcknowledged) {
+  static afdsdCtrl1 ctrl;
+  SimulatedLoPy lopy(5000);
+  uint8_t gps[LINK_GPS_MAX_SIZE];
+  for (int i = 0; i < LINK_GPS_MAX_SIZE; i++) {
+    gps[i] = static_cast<uint8_t>(0x10 + i);
+  }
+
+  fall(ctrl, 0.9f);
+  for (int i = 0; i < 20; i++) {
+    loop_once(ctrl, lopy);
+  }
+  // The wearer falls again, and a position is found, while the first alarm is sent again
+  ctrl.set_gps_packet(gps, sizeof(gps));
+  fall(ctrl, 0.8f);
+  while (ctrl.alarm_state != ALARM_IDLE) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(lopy.answers, 2);
+  TF_LITE_MICRO_EXPECT_TRUE((lopy.alarm_frames > 2));
+
+  // Every sequence number acknowledged by the LoPy is one fall, also in the frames sent again
+  TF_LITE_MICRO_EXPECT_EQ(0, lopy.changed_alarms);
+  TF_LITE_MICRO_EXPECT_EQ(2, static_cast<int>(lopy.alarms.size()));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(lopy.alarms[0].fall_number));
+  TF_LITE_MICRO_EXPECT_EQ(230, static_cast<int>(lopy.alarms[0].confidence));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(lopy.alarms[0].gps_length));
+  TF_LITE_MICRO_EXPECT_EQ(2, static_cast<int>(lopy.alarms[1].fall_number));
+  TF_LITE_MICRO_EXPECT_EQ(204, static_cast<int>(lopy.alarms[1].confidence));
+  TF_LITE_MICRO_EXPECT_EQ(LINK_GPS_MAX_SIZE, static_cast<int>(lopy.alarms[1].gps_length));
+  TF_LITE_MICRO_EXPECT_EQ(0, memcmp(gps, lopy.alarms[1].gps, sizeof(gps)));
+}
+
+TF_LITE_MICRO_TEST(AlarmIsSentAgainWhileLoPyStarts) {
+  static afdsdCtrl1 ctrl;
+  SimulatedLoPy lopy(1000);
+  // The frames sent in the first 2.5 s after the wake up are lost
+  lopy.boot_ms = 2500;
+
+  fall(ctrl);
+  while (ctrl.alarm_state != ALARM_IDLE) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(lopy.wake_ups, 1);
+  TF_LITE_MICRO_EXPECT_EQ(lopy.answers, 1);
+  // The alarm frames sent again are the same alarm for the LoPy
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(lopy.alarms.size()));
+  TF_LITE_MICRO_EXPECT_TRUE((lopy.alarm_frames >= 1));
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 0);
+}
+
+TF_LITE_MICRO_TEST(StopButtonCancelsAlarm) {
+  static afdsdCtrl1 ctrl;
+  // The LoPy never gets the alarm sent
+  SimulatedLoPy lopy(0);
+
+  fall(ctrl);
+  for (int i = 0; i < 50; i++) {
+    loop_once(ctrl, lopy);
+  }
+  // A heartbeat is acknowledged, and the alarm goes on
+  lopy.send_heartbeat();
+  for (int i = 0; i < 5; i++) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(1, lopy.acks);
+  TF_LITE_MICRO_EXPECT_TRUE((ctrl.lopy_heartbeat > 0));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_WAITING));
+
+  // The wearer presses the stop button
+  lopy.press_stop_button();
+  for (int i = 0; i < 5; i++) {
+    loop_once(ctrl, lopy);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(ctrl.alarm_state), static_cast<int>(ALARM_IDLE));
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_cancels, 1);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.alarm_failures, 0);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), LOW);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 0);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(LEDR), HIGH);
+  Serial.host_set_echo(stdout);
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,82 @@
+/**
+  *
+  *
+  * @file:    fall_cascade_test.cc
+  * @date:    17-10-2026 07:09:41
+  *
+  * @brief    Tests of the cascade of the small and the large fall model
+  *
+  *   The models are run with the float reference inference of the host, so the
+  *   tests don't need the TensorFlow Lite Micro interpreter.
+  *
+**/
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "../AFDS_test/anti_fall_detection_system_test/daily_features_data.h"
+#include "../AFDS_test/anti_fall_detection_system_test/fall_features_data.h"
+#include "constants.h"
+#include "fall_cascade.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "model_quantizer.h"
+
+namespace {
+
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(OnlyUncertainSignalsAreEscalated) {
+  FallCascade cascade(CASCADE_LOW, CASCADE_HIGH);
+  TF_LITE_MICRO_EXPECT_EQ(cascade.escalation_rate(), 0.0f);
+  const float certain_fall[2] = {0.05f, 0.95f};
+  const float certain_no_fall[2] = {0.9f, 0.1f};
+  const float uncertain[2] = {0.45f, 0.55f};
+  const float low_edge[2] = {1.0f - CASCADE_LOW, CASCADE_LOW};
+  const float high_edge[2] = {1.0f - CASCADE_HIGH, CASCADE_HIGH};
+  TF_LITE_MICRO_EXPECT_TRUE(!cascade.escalate(certain_fall));
+  TF_LITE_MICRO_EXPECT_TRUE(!cascade.escalate(certain_no_fall));
+  TF_LITE_MICRO_EXPECT_TRUE(cascade.escalate(uncertain));
+  TF_LITE_MICRO_EXPECT_TRUE(cascade.escalate(low_edge));
+  TF_LITE_MICRO_EXPECT_TRUE(cascade.escalate(high_edge));
+  TF_LITE_MICRO_EXPECT_EQ(cascade.decisions, 5ul);
+  TF_LITE_MICRO_EXPECT_EQ(cascade.escalations, 3ul);
+  TF_LITE_MICRO_EXPECT_NEAR(cascade.escalation_rate(), 0.6f, 1e-6f);
+}
+
+TF_LITE_MICRO_TEST(CascadeDecidesLikeTheLargeModelWhenUncertain) {
+  DenseModel small_model;
+  DenseModel large_model;
+  TF_LITE_MICRO_EXPECT_TRUE(small_model.read(fall_model_data));
+  TF_LITE_MICRO_EXPECT_TRUE(large_model.read(fall_model_2_data));
+
+  // A wide band, so the fall f46 is least sure of (P(fall) 0.89) is escalated
+  FallCascade cascade(0.01f, 0.95f);
+  for (int n = 0; n < FEATURE_SETS; n++) {
+    float small_output[2];
+    float large_output[2];
+    float output[2];
+    small_model.classify(FEATURES[n], small_output);
+    large_model.classify(FEATURES[n], large_output);
+    small_model.classify(FEATURES[n], output);
+    bool escalated = cascade.escalate(output);
+    if (escalated) {
+      large_model.classify(FEATURES[n], output);
+    }
+    const float* expected = escalated ? large_output : small_output;
+    TF_LITE_MICRO_EXPECT_EQ(output[1], expected[1]);
+    // Every test signal is classified correctly either way
+    TF_LITE_MICRO_EXPECT_EQ(output[1] >= output[0], n < 3);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(cascade.decisions, static_cast<unsigned long>(FEATURE_SETS));
+  TF_LITE_MICRO_EXPECT_EQ(cascade.escalations, 1ul);
+}
+
+TF_LITE_MICRO_TESTS_END
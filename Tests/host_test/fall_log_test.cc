@@ -0,0 +1,175 @@
+/**
+  *
+  *
+  * @file:    fall_log_test.cc
+  * @date:    17-10-2026 06:47:17
+  *
+  * @brief    Tests of the binary fall log format and of saving it on the MicroSD card
+  *
+  *
+  *
+  *
+**/
+
+#include <math.h>
+#include <string.h>
+
+#include <SD.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "constants.h"
+#include "datalogger.h"
+#include "fall_log.h"
+#include "signal_buffer.h"
+
+namespace {
+
+const FallLogInfo kInfo = {14.9f, 0.000732f, 0.07f, FIRMWARE_VERSION, 2};
+
+// The signals of a fall, as raw IMU values converted with the resolutions of kInfo
+struct Signals {
+  SignalBuffer sig[FALL_LOG_CHANNELS];
+  int16_t raw[SIGNAL_SIZE][FALL_LOG_CHANNELS];
+
+  Signals() {
+    // Pushed oldest first, so raw[i] is the sample at index i of the ring buffers
+    for (int n = SIGNAL_SIZE - 1; n >= 0; n--) {
+      for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+        raw[n][c] = static_cast<int16_t>((n * 397 + c * 1051) % 20000 - 10000);
+        float resolution = c < 3 ? kInfo.accel_resolution : kInfo.gyro_resolution;
+        sig[c].push(raw[n][c] * resolution);
+      }
+    }
+  }
+};
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FallLogIsWholeSectors) {
+  TF_LITE_MICRO_EXPECT_EQ(FALL_LOG_BLOCK_SIZE % FALL_LOG_SECTOR_SIZE, 0);
+  TF_LITE_MICRO_EXPECT_TRUE((FALL_LOG_BLOCK_SIZE >= FALL_LOG_HEADER_SIZE + SIGNAL_SIZE * FALL_LOG_CHANNELS * 2));
+  TF_LITE_MICRO_EXPECT_TRUE((FALL_LOG_BLOCK_SIZE < FALL_LOG_HEADER_SIZE + SIGNAL_SIZE * FALL_LOG_CHANNELS * 2 +
+                             FALL_LOG_SECTOR_SIZE));
+}
+
+TF_LITE_MICRO_TEST(FallLogRoundTripIsLossless) {
+  static Signals signals;
+  static uint8_t block[FALL_LOG_BLOCK_SIZE];
+  int size = fall_log_encode(block, kInfo, signals.sig[0], signals.sig[1], signals.sig[2],
+                             signals.sig[3], signals.sig[4], signals.sig[5]);
+  TF_LITE_MICRO_EXPECT_EQ(size, FALL_LOG_BLOCK_SIZE);
+  TF_LITE_MICRO_EXPECT_EQ(memcmp(block, "AFDL", 4), 0);
+
+  // The samples are the raw IMU values
+  int16_t first[FALL_LOG_CHANNELS];
+  memcpy(first, block + FALL_LOG_HEADER_SIZE, sizeof(first));
+  for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+    TF_LITE_MICRO_EXPECT_EQ(first[c], signals.raw[0][c]);
+  }
+
+  FallLogInfo info;
+  static float values[SIGNAL_SIZE][FALL_LOG_CHANNELS];
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(block, size, info, values, SIGNAL_SIZE), SIGNAL_SIZE);
+  TF_LITE_MICRO_EXPECT_EQ(info.sample_rate, kInfo.sample_rate);
+  TF_LITE_MICRO_EXPECT_EQ(info.accel_resolution, kInfo.accel_resolution);
+  TF_LITE_MICRO_EXPECT_EQ(info.gyro_resolution, kInfo.gyro_resolution);
+  TF_LITE_MICRO_EXPECT_EQ(info.firmware_version, kInfo.firmware_version);
+  TF_LITE_MICRO_EXPECT_EQ(info.model_id, kInfo.model_id);
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+      TF_LITE_MICRO_EXPECT_EQ(values[i][c], signals.sig[c][i]);
+    }
+  }
+
+  // Only the requested amount of samples is decoded
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(block, size, info, values, 10), 10);
+}
+
+TF_LITE_MICRO_TEST(RawSignalsAreSavedAsTheyAre) {
+  static Signals signals;
+  RawSignalBuffer raw[FALL_LOG_CHANNELS];
+  for (int n = SIGNAL_SIZE - 1; n >= 0; n--) {
+    for (int c = 0; c < FALL_LOG_CHANNELS; c++) {
+      raw[c].push(signals.raw[n][c]);
+    }
+  }
+  // The raw and the float ring buffers of the same signal give the same fall log
+  static uint8_t block[FALL_LOG_BLOCK_SIZE];
+  static uint8_t raw_block[FALL_LOG_BLOCK_SIZE];
+  fall_log_encode(block, kInfo, signals.sig[0], signals.sig[1], signals.sig[2],
+                  signals.sig[3], signals.sig[4], signals.sig[5]);
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_encode(raw_block, kInfo, raw[0], raw[1], raw[2], raw[3], raw[4], raw[5]),
+                          FALL_LOG_BLOCK_SIZE);
+  TF_LITE_MICRO_EXPECT_EQ(memcmp(block, raw_block, FALL_LOG_BLOCK_SIZE), 0);
+}
+
+TF_LITE_MICRO_TEST(FallLogSaturatesOutOfRangeValues) {
+  SignalBuffer sig[FALL_LOG_CHANNELS];
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    sig[0].push(100.0f);
+    sig[3].push(-10000.0f);
+  }
+  static uint8_t block[FALL_LOG_BLOCK_SIZE];
+  fall_log_encode(block, kInfo, sig[0], sig[1], sig[2], sig[3], sig[4], sig[5]);
+  int16_t first[FALL_LOG_CHANNELS];
+  memcpy(first, block + FALL_LOG_HEADER_SIZE, sizeof(first));
+  TF_LITE_MICRO_EXPECT_EQ(first[0], 32767);
+  TF_LITE_MICRO_EXPECT_EQ(first[1], 0);
+  TF_LITE_MICRO_EXPECT_EQ(first[3], -32768);
+}
+
+TF_LITE_MICRO_TEST(InvalidFallLogIsRejected) {
+  static Signals signals;
+  static uint8_t block[FALL_LOG_BLOCK_SIZE];
+  static float values[SIGNAL_SIZE][FALL_LOG_CHANNELS];
+  FallLogInfo info;
+  int size = fall_log_encode(block, kInfo, signals.sig[0], signals.sig[1], signals.sig[2],
+                             signals.sig[3], signals.sig[4], signals.sig[5]);
+
+  // Cut off in the middle of the samples
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(block, FALL_LOG_HEADER_SIZE + 100, info, values, SIGNAL_SIZE), -1);
+  // Not a fall log
+  const char csv[] = "0.0100,0.0200,1.0000,0.0000,0.0000,0.0000\r\n";
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(reinterpret_cast<const uint8_t*>(csv), sizeof(csv), info, values,
+                                          SIGNAL_SIZE), -1);
+  // Unknown version
+  block[4] = 99;
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(block, size, info, values, SIGNAL_SIZE), -1);
+}
+
+TF_LITE_MICRO_TEST(DataloggerWritesFallLogAsOneBlock) {
+  static Signals signals;
+  datalogger logger;
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  char name[] = "LOGTEST.afl";
+  char csv_name[] = "LOGTEST.csv";
+
+  // Writing twice with overwrite leaves a single fall log
+  for (int i = 0; i < 2; i++) {
+    TF_LITE_MICRO_EXPECT_TRUE(logger.writeSignalLog(CS, name, kInfo, signals.sig[0], signals.sig[1], signals.sig[2],
+                                                    signals.sig[3], signals.sig[4], signals.sig[5], true));
+  }
+  File file = SD.open(name, FILE_READ);
+  TF_LITE_MICRO_EXPECT_TRUE(file);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(file.size()), FALL_LOG_BLOCK_SIZE);
+  static uint8_t data[FALL_LOG_BLOCK_SIZE];
+  TF_LITE_MICRO_EXPECT_EQ(file.read(data, sizeof(data)), FALL_LOG_BLOCK_SIZE);
+  file.close();
+
+  FallLogInfo info;
+  static float values[SIGNAL_SIZE][FALL_LOG_CHANNELS];
+  TF_LITE_MICRO_EXPECT_EQ(fall_log_decode(data, sizeof(data), info, values, SIGNAL_SIZE), SIGNAL_SIZE);
+  TF_LITE_MICRO_EXPECT_EQ(values[SIGNAL_SIZE - 1][5], signals.sig[5][SIGNAL_SIZE - 1]);
+
+  // The same signal saved as CSV is several times bigger
+  logger.writeSignalValues(CS, csv_name, signals.sig[0], signals.sig[1], signals.sig[2],
+                           signals.sig[3], signals.sig[4], signals.sig[5], true);
+  file = SD.open(csv_name, FILE_READ);
+  TF_LITE_MICRO_EXPECT_GT(static_cast<int>(file.size()), 3 * FALL_LOG_BLOCK_SIZE);
+  file.close();
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,124 @@
+/**
+  *
+  *
+  * @file:    fully_connected_kernel_test.cc
+  * @date:    17-10-2026 07:16:52
+  *
+  * @brief    Tests of the vectorized fully connected kernel against the reference kernel
+  *
+  *   Every version the CPU supports is run on the layer shapes of the fall
+  *   models, and on odd shapes reaching the tails of the vector loops.
+  *
+**/
+
+#include <math.h>
+
+#include <vector>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "fully_connected_kernel.h"
+
+namespace {
+
+const FcIsa ISAS[] = {FC_SCALAR, FC_SSE, FC_AVX2};
+
+// Deterministic values in [-2, 2]
+void fill(std::vector<float>& values, int seed) {
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<float>((static_cast<int>(i) * 7919 + seed * 104729) % 4001 - 2000) / 1000.0f;
+  }
+}
+
+void reference(const FcShape& shape, const float* input, const float* weights, const float* bias, float* output) {
+  tflite::FullyConnectedParams params;
+  params.float_activation_min = shape.activation_min;
+  params.float_activation_max = shape.activation_max;
+  tflite::reference_ops::FullyConnected(params, tflite::RuntimeShape({shape.batches, shape.depth}), input,
+                                        tflite::RuntimeShape({shape.outputs, shape.depth}), weights,
+                                        tflite::RuntimeShape({shape.outputs}), bias,
+                                        tflite::RuntimeShape({shape.batches, shape.outputs}), output);
+}
+
+// The largest difference from the reference kernel, relative to the sum of the absolute products
+float max_error(FcIsa isa, const FcShape& shape, bool with_bias) {
+  std::vector<float> input(shape.batches * shape.depth);
+  std::vector<float> weights(shape.outputs * shape.depth);
+  std::vector<float> bias(shape.outputs);
+  std::vector<float> expected(shape.batches * shape.outputs);
+  std::vector<float> output(shape.batches * shape.outputs);
+  fill(input, 1);
+  fill(weights, 2);
+  fill(bias, 3);
+  const float* bias_data = with_bias ? bias.data() : nullptr;
+  reference(shape, input.data(), weights.data(), bias_data, expected.data());
+  fully_connected(isa, shape, input.data(), weights.data(), bias_data, output.data());
+
+  float error = 0;
+  for (int b = 0; b < shape.batches; b++) {
+    for (int o = 0; o < shape.outputs; o++) {
+      float magnitude = 1.0f;
+      for (int d = 0; d < shape.depth; d++) {
+        magnitude += fabsf(input[b * shape.depth + d] * weights[o * shape.depth + d]);
+      }
+      int i = b * shape.outputs + o;
+      error = fmaxf(error, fabsf(output[i] - expected[i]) / magnitude);
+    }
+  }
+  return error;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ScalarIsAlwaysSupportedAndBestIsSupported) {
+  TF_LITE_MICRO_EXPECT_TRUE(fc_isa_supported(FC_SCALAR));
+  TF_LITE_MICRO_EXPECT_TRUE(fc_isa_supported(fc_best_isa()));
+  TF_LITE_MICRO_EXPECT_TRUE((fc_best_isa() != FC_AVX2 || fc_isa_supported(FC_SSE)));
+}
+
+TF_LITE_MICRO_TEST(ScalarGivesTheSameBitsAsTheReference) {
+  const FcShape shapes[] = {{1, 46, 33, -INFINITY, INFINITY}, {1, 192, 2, -INFINITY, INFINITY},
+                            {3, 13, 5, 0.0f, 6.0f}};
+  for (const FcShape& shape : shapes) {
+    TF_LITE_MICRO_EXPECT_EQ(max_error(FC_SCALAR, shape, true), 0.0f);
+  }
+}
+
+TF_LITE_MICRO_TEST(EveryVersionMatchesTheReferenceOnTheModelLayers) {
+  // The layers of f46, f46_2 and f46_3, one signal and a batch of signals
+  const FcShape shapes[] = {
+    {1, 46, 33, -INFINITY, INFINITY}, {1, 33, 2, -INFINITY, INFINITY},
+    {1, 46, 192, -INFINITY, INFINITY}, {1, 192, 2, -INFINITY, INFINITY},
+    {1, 46, 69, -INFINITY, INFINITY}, {1, 69, 2, -INFINITY, INFINITY},
+    {64, 46, 33, -INFINITY, INFINITY},
+  };
+  for (FcIsa isa : ISAS) {
+    if (!fc_isa_supported(isa)) {
+      continue;
+    }
+    for (const FcShape& shape : shapes) {
+      TF_LITE_MICRO_EXPECT_TRUE((max_error(isa, shape, true) < 1e-6f));
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(EveryVersionHandlesTailsActivationsAndNoBias) {
+  // Depths and outputs that aren't multiples of the vector widths, clamped like RELU, RELU6 and RELU_N1_TO_1
+  const FcShape shapes[] = {
+    {2, 1, 1, 0.0f, INFINITY}, {2, 7, 3, 0.0f, 6.0f}, {5, 9, 6, -1.0f, 1.0f}, {3, 17, 11, 0.0f, INFINITY},
+  };
+  for (FcIsa isa : ISAS) {
+    if (!fc_isa_supported(isa)) {
+      continue;
+    }
+    for (const FcShape& shape : shapes) {
+      TF_LITE_MICRO_EXPECT_TRUE((max_error(isa, shape, true) < 1e-6f));
+      TF_LITE_MICRO_EXPECT_TRUE((max_error(isa, shape, false) < 1e-6f));
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
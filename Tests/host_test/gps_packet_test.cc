@@ -0,0 +1,176 @@
+/**
+  *
+  *
+  * @file:    gps_packet_test.cc
+  * @date:    17-10-2026 08:00:59
+  *
+  * @brief    Round trip tests of the packed GPS packets sent from the Nano to the LoPy
+  *
+**/
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "GPSPacket.h"
+
+namespace {
+
+GPSPackage make_parcel(double latitude, double longitude, double altitude, uint32_t timestamp) {
+  GPSPackage parcel = GPSPackage();
+  parcel.Latitude = latitude;
+  parcel.Longitude = longitude;
+  parcel.Altitude = altitude;
+  parcel.Elevation = 40;
+  parcel.Azimuth = 120;
+  parcel.Sattelites = 8;
+  setGPSTimestamp(parcel, timestamp);
+  return parcel;
+}
+
+// 18-10-2026 12:00:01 UTC
+const uint32_t NOON = 845640001UL;
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(PacketsAreSmallerThanThePackage) {
+  TF_LITE_MICRO_EXPECT_TRUE((GPS_PACKET_MAX_SIZE * 2 < sizeof(GPSPackage)));
+  GPSPacketKey key = GPSPacketKey();
+  uint8_t buffer[GPS_PACKET_MAX_SIZE];
+  TF_LITE_MICRO_EXPECT_EQ(GPS_PACKET_ABSOLUTE_SIZE,
+                          encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON), key, buffer, sizeof(buffer)));
+  TF_LITE_MICRO_EXPECT_EQ(GPS_PACKET_VERSION, buffer[0] >> 4);
+  TF_LITE_MICRO_EXPECT_EQ(GPS_PACKET_DELTA_SIZE,
+                          encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON + 1), key, buffer, sizeof(buffer)));
+  // A buffer too small for the packet isn't written
+  TF_LITE_MICRO_EXPECT_EQ(0, encodeGPSPacket(make_parcel(0, 0, 0, NOON + 2), key, buffer, GPS_PACKET_DELTA_SIZE - 1));
+}
+
+TF_LITE_MICRO_TEST(TimestampsAreSecondsSince2000) {
+  GPSPackage parcel = GPSPackage();
+  parcel.DateYear = 2026;
+  parcel.DateMonth = 10;
+  parcel.DateDay = 18;
+  parcel.TimeHour = 12;
+  parcel.TimeSecond = 1;
+  TF_LITE_MICRO_EXPECT_EQ(NOON, gpsTimestamp(parcel));
+
+  const uint32_t timestamps[] = {0, 762566399UL, 762566400UL, 3155759999UL};
+  for (uint32_t timestamp : timestamps) {
+    setGPSTimestamp(parcel, timestamp);
+    TF_LITE_MICRO_EXPECT_EQ(timestamp, gpsTimestamp(parcel));
+  }
+  // 29-02-2024 23:59:59 is followed by 01-03-2024
+  setGPSTimestamp(parcel, 762566399UL);
+  TF_LITE_MICRO_EXPECT_EQ(29, static_cast<int>(parcel.DateDay));
+  setGPSTimestamp(parcel, 762566400UL);
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(parcel.DateMonth));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(parcel.DateDay));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(parcel.TimeHour));
+
+  // Without a date only the time of day is counted
+  GPSPackage no_date = GPSPackage();
+  no_date.TimeHour = 1;
+  TF_LITE_MICRO_EXPECT_EQ(3600, static_cast<int>(gpsTimestamp(no_date)));
+}
+
+TF_LITE_MICRO_TEST(PacketsRoundTrip) {
+  const GPSPackage parcels[] = {
+    make_parcel(56.167794, 10.190551, 45.3, NOON),
+    make_parcel(-33.8567844, 151.213108, 58.7, NOON + 10),
+    make_parcel(40.6892494, -74.0445004, -2.4, NOON + 3600),
+    make_parcel(-90.0, -180.0, 0.0, NOON + UINT16_MAX + 3600),
+  };
+  GPSPacketKey sender = GPSPacketKey();
+  GPSPacketKey receiver = GPSPacketKey();
+  for (const GPSPackage& parcel : parcels) {
+    uint8_t buffer[GPS_PACKET_MAX_SIZE];
+    uint8_t length = encodeGPSPacket(parcel, sender, buffer, sizeof(buffer));
+    GPSPackage decoded;
+    TF_LITE_MICRO_EXPECT_EQ(length, decodeGPSPacket(buffer, length, receiver, decoded));
+    TF_LITE_MICRO_EXPECT_NEAR(parcel.Latitude, decoded.Latitude, 0.5e-6 + 1e-12);
+    TF_LITE_MICRO_EXPECT_NEAR(parcel.Longitude, decoded.Longitude, 0.5e-6 + 1e-12);
+    TF_LITE_MICRO_EXPECT_NEAR(parcel.Altitude, decoded.Altitude, 0.05 + 1e-9);
+    TF_LITE_MICRO_EXPECT_EQ(parcel.Sattelites, decoded.Sattelites);
+    TF_LITE_MICRO_EXPECT_EQ(gpsTimestamp(parcel), gpsTimestamp(decoded));
+    TF_LITE_MICRO_EXPECT_EQ(parcel.DateYear, decoded.DateYear);
+    TF_LITE_MICRO_EXPECT_EQ(parcel.TimeMinute, decoded.TimeMinute);
+    TF_LITE_MICRO_EXPECT_EQ(0, decoded.Elevation);
+    TF_LITE_MICRO_EXPECT_EQ(0, decoded.Azimuth);
+  }
+  // The deltas fit, until the last parcel is more than 18 hours after the key
+  TF_LITE_MICRO_EXPECT_EQ(NOON + UINT16_MAX + 3600, sender.Timestamp);
+  TF_LITE_MICRO_EXPECT_EQ(sender.Timestamp, receiver.Timestamp);
+}
+
+TF_LITE_MICRO_TEST(AltitudeIsClamped) {
+  GPSPacketKey sender = GPSPacketKey();
+  GPSPacketKey receiver = GPSPacketKey();
+  uint8_t buffer[GPS_PACKET_MAX_SIZE];
+  GPSPackage decoded;
+  uint8_t length = encodeGPSPacket(make_parcel(27.988056, 86.925278, 8848.9, NOON), sender, buffer, sizeof(buffer));
+  TF_LITE_MICRO_EXPECT_EQ(length, decodeGPSPacket(buffer, length, receiver, decoded));
+  TF_LITE_MICRO_EXPECT_NEAR(3276.7, decoded.Altitude, 1e-9);
+  length = encodeGPSPacket(make_parcel(31.5, 35.5, -4000.0, NOON + 1), sender, buffer, sizeof(buffer));
+  TF_LITE_MICRO_EXPECT_EQ(length, decodeGPSPacket(buffer, length, receiver, decoded));
+  TF_LITE_MICRO_EXPECT_NEAR(-3276.8, decoded.Altitude, 1e-9);
+}
+
+TF_LITE_MICRO_TEST(InvalidPacketsAreRejected) {
+  GPSPacketKey sender = GPSPacketKey();
+  uint8_t absolute[GPS_PACKET_MAX_SIZE];
+  uint8_t delta[GPS_PACKET_MAX_SIZE];
+  uint8_t absolute_length = encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON), sender, absolute,
+                                            sizeof(absolute));
+  uint8_t delta_length = encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON + 5), sender, delta,
+                                         sizeof(delta));
+  GPSPackage decoded;
+
+  // A delta without a key, like when the LoPy has been reset
+  GPSPacketKey receiver = GPSPacketKey();
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(delta, delta_length, receiver, decoded));
+  // A delta of another key
+  receiver.Timestamp = NOON - 1;
+  receiver.Valid = true;
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(delta, delta_length, receiver, decoded));
+  // Truncated packets
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(absolute, absolute_length - 1, receiver, decoded));
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(delta, delta_length - 1, receiver, decoded));
+  // Another version
+  absolute[0] ^= 0x30;
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(absolute, absolute_length, receiver, decoded));
+  absolute[0] ^= 0x30;
+  TF_LITE_MICRO_EXPECT_EQ(NOON - 1, receiver.Timestamp);
+
+  // When the absolute packet is received, the delta can be decoded
+  TF_LITE_MICRO_EXPECT_EQ(absolute_length, decodeGPSPacket(absolute, absolute_length, receiver, decoded));
+  TF_LITE_MICRO_EXPECT_EQ(delta_length, decodeGPSPacket(delta, delta_length, receiver, decoded));
+  TF_LITE_MICRO_EXPECT_EQ(NOON + 5, gpsTimestamp(decoded));
+}
+
+TF_LITE_MICRO_TEST(AbsolutePacketsNeedNoKey) {
+  // A sender streaming deltas, and a receiver which has been reset after the first packet
+  GPSPacketKey sender = GPSPacketKey();
+  GPSPacketKey receiver = GPSPacketKey();
+  uint8_t buffer[GPS_PACKET_MAX_SIZE];
+  uint8_t length = encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON), sender, buffer, sizeof(buffer));
+  GPSPackage decoded;
+  TF_LITE_MICRO_EXPECT_EQ(length, decodeGPSPacket(buffer, length, receiver, decoded));
+  receiver = GPSPacketKey();
+  length = encodeGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON + 60), sender, buffer, sizeof(buffer));
+  TF_LITE_MICRO_EXPECT_EQ(GPS_PACKET_DELTA_SIZE, static_cast<int>(length));
+  TF_LITE_MICRO_EXPECT_EQ(0, decodeGPSPacket(buffer, length, receiver, decoded));
+
+  // Every absolute packet is decoded without the key
+  for (uint32_t second = 0; second < 3; second++) {
+    length = encodeAbsoluteGPSPacket(make_parcel(56.167794, 10.190551, 45.3, NOON + 120 + second), buffer,
+                                     sizeof(buffer));
+    TF_LITE_MICRO_EXPECT_EQ(GPS_PACKET_ABSOLUTE_SIZE, static_cast<int>(length));
+    TF_LITE_MICRO_EXPECT_TRUE((buffer[0] & GPS_PACKET_ABSOLUTE));
+    receiver = GPSPacketKey();
+    TF_LITE_MICRO_EXPECT_EQ(length, decodeGPSPacket(buffer, length, receiver, decoded));
+    TF_LITE_MICRO_EXPECT_EQ(NOON + 120 + second, gpsTimestamp(decoded));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(0, encodeAbsoluteGPSPacket(make_parcel(0, 0, 0, NOON), buffer, GPS_PACKET_DELTA_SIZE));
+}
+
+TF_LITE_MICRO_TESTS_END
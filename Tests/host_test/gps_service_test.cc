@@ -0,0 +1,170 @@
+/**
+  *
+  *
+  * @file:    gps_service_test.cc
+  * @date:    17-10-2026 07:58:33
+  *
+  * @brief    Tests of the non-blocking GPS service, replaying NMEA logs on the simulated UART
+  *
+**/
+
+#include <string>
+
+#include <Arduino.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "GPSHelper.h"
+#include "GPSService.h"
+#include "nmea_sim.h"
+
+namespace {
+
+const unsigned long GPS_BAUD = 9600;
+const unsigned long LOOP_US = 10000;  // The loop polls the GPS every 10 ms
+
+// Replays a log like the GPS sends it, 10 bits per character at the baud rate, polling every loop.
+// Returns the most characters parsed by a poll.
+int replay(GPSService& service, HardwareSerial& uart, const std::string& log, size_t* offset, unsigned long ms) {
+  int most = 0;
+  const size_t chars_per_loop = GPS_BAUD / 10 * LOOP_US / 1000000;
+  for (unsigned long t = 0; t < ms * 1000; t += LOOP_US) {
+    if (*offset < log.size()) {
+      size_t n = std::min(chars_per_loop, log.size() - *offset);
+      uart.host_receive(reinterpret_cast<const uint8_t*>(log.data() + *offset), n);
+      *offset += n;
+    }
+    host::advance_time_us(LOOP_US);
+    int parsed = service.poll();
+    most = parsed > most ? parsed : most;
+  }
+  return most;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(MissingGpsIsReportedWithoutHalting) {
+  host::reset_time();
+  HardwareSerial uart(nullptr);
+  GPSService service(uart);
+  service.begin(GPS_BAUD);
+  TF_LITE_MICRO_EXPECT_EQ(GPS_BAUD, uart.host_baud());
+  TF_LITE_MICRO_EXPECT_EQ(GPS_STARTING, service.status());
+  host::advance_time_us((GPS_DETECT_TIMEOUT_MS + 1) * 1000UL);
+  TF_LITE_MICRO_EXPECT_EQ(0, service.poll());
+  TF_LITE_MICRO_EXPECT_EQ(GPS_NOT_DETECTED, service.status());
+  TF_LITE_MICRO_EXPECT_TRUE(!service.lastFix().Valid);
+  TF_LITE_MICRO_EXPECT_EQ(UINT32_MAX, service.fixAge());
+
+  // The helper on Serial1 reports it once, and returns
+  Serial.host_take_transmitted();
+  InitGPS();
+  host::advance_time_us((GPS_DETECT_TIMEOUT_MS + 1) * 1000UL);
+  PollGPS();
+  PollGPS();
+  std::string printed = Serial.host_take_transmitted();
+  TF_LITE_MICRO_EXPECT_TRUE((printed == "No GPS detected - check wireing and restart.\r\n"));
+  TF_LITE_MICRO_EXPECT_TRUE(!isDataReady());
+}
+
+TF_LITE_MICRO_TEST(FixIsCachedWhileReplaying) {
+  host::reset_time();
+  NmeaWalk walk;
+  walk.seconds_without_fix = 10;
+  std::string log = simulate_nmea(60, walk);
+  HardwareSerial uart(nullptr);
+  GPSService service(uart);
+  service.begin(GPS_BAUD);
+  size_t offset = 0;
+
+  // Without a fix the GPS is detected, but there is no position
+  replay(service, uart, log, &offset, 2000);
+  TF_LITE_MICRO_EXPECT_EQ(GPS_NO_FIX, service.status());
+  TF_LITE_MICRO_EXPECT_TRUE(!service.lastFix().Valid);
+
+  // An epoch of sentences takes about half a second at 9600 baud, so the replay stops in the middle of the walk
+  int most = replay(service, uart, log, &offset, 20000);
+  TF_LITE_MICRO_EXPECT_TRUE((offset < log.size()));
+  TF_LITE_MICRO_EXPECT_TRUE((most <= GPS_POLL_MAX_CHARS));
+  TF_LITE_MICRO_EXPECT_EQ(GPS_FIX, service.status());
+  const GPSFix& fix = service.lastFix();
+  TF_LITE_MICRO_EXPECT_TRUE(fix.Valid);
+  TF_LITE_MICRO_EXPECT_TRUE((service.fixAge() < 1000));
+  TF_LITE_MICRO_EXPECT_EQ(8, static_cast<int>(fix.Satellites));
+  TF_LITE_MICRO_EXPECT_EQ(92, static_cast<int>(fix.HDOP));
+  TF_LITE_MICRO_EXPECT_EQ(4530, fix.Altitude);
+  TF_LITE_MICRO_EXPECT_EQ(181026, static_cast<int>(fix.Date));
+  TF_LITE_MICRO_EXPECT_EQ(service.parser().data().Latitude, fix.Latitude);
+  TF_LITE_MICRO_EXPECT_EQ(service.parser().data().Longitude, fix.Longitude);
+  // The fix is the position of the walk at its time
+  int second = (fix.Time / 1000000 - 12) * 3600 + fix.Time / 10000 % 100 * 60 + fix.Time / 100 % 100;
+  double latitude, longitude;
+  nmea_walk_position(walk, second, &latitude, &longitude);
+  TF_LITE_MICRO_EXPECT_NEAR(latitude, fix.Latitude * 1e-7, 2e-7);
+  TF_LITE_MICRO_EXPECT_NEAR(longitude, fix.Longitude * 1e-7, 2e-7);
+}
+
+TF_LITE_MICRO_TEST(FixGetsStaleWhenTheGpsStops) {
+  host::reset_time();
+  std::string log = simulate_nmea(3);
+  HardwareSerial uart(nullptr);
+  GPSService service(uart);
+  service.begin(GPS_BAUD);
+  size_t offset = 0;
+  replay(service, uart, log, &offset, 5000);
+  TF_LITE_MICRO_EXPECT_EQ(GPS_FIX, service.status());
+  GPSFix fix = service.lastFix();
+
+  // Nothing is received for a while, and the last known fix is kept
+  replay(service, uart, log, &offset, GPS_FIX_STALE_MS + 1000);
+  TF_LITE_MICRO_EXPECT_EQ(GPS_STALE, service.status());
+  TF_LITE_MICRO_EXPECT_TRUE((service.fixAge() > GPS_FIX_STALE_MS));
+  TF_LITE_MICRO_EXPECT_TRUE(service.lastFix().Valid);
+  TF_LITE_MICRO_EXPECT_EQ(fix.Latitude, service.lastFix().Latitude);
+  TF_LITE_MICRO_EXPECT_EQ(fix.FixMillis, service.lastFix().FixMillis);
+}
+
+TF_LITE_MICRO_TEST(PollIsBounded) {
+  HardwareSerial uart(nullptr);
+  GPSService service(uart);
+  service.begin(GPS_BAUD);
+  std::string log = simulate_nmea(2);
+  uart.host_receive(log.c_str());
+  TF_LITE_MICRO_EXPECT_EQ(GPS_POLL_MAX_CHARS, service.poll());
+  TF_LITE_MICRO_EXPECT_EQ(10, service.poll(10));
+  TF_LITE_MICRO_EXPECT_EQ(GPS_POLL_MAX_CHARS + 10, static_cast<int>(service.parser().charsProcessed()));
+  while (service.poll() > 0) {
+  }
+  TF_LITE_MICRO_EXPECT_EQ(log.size(), static_cast<size_t>(service.parser().charsProcessed()));
+}
+
+TF_LITE_MICRO_TEST(HelperReadsTheCachedFix) {
+  host::reset_time();
+  InitGPS();
+  NmeaWalk walk;
+  Serial1.host_receive(simulate_nmea(2, walk).c_str());
+  for (int loop = 0; loop < 100; loop++) {
+    PollGPS();
+  }
+  TF_LITE_MICRO_EXPECT_TRUE(isDataReady());
+  // Nothing is waiting on the UART, and the fix is returned at once
+  TF_LITE_MICRO_EXPECT_EQ(0, Serial1.available());
+  unsigned long start = micros();
+  GPSPackage parcel = ReadGPSData();
+  TF_LITE_MICRO_EXPECT_TRUE((micros() - start < 1000));
+  double latitude, longitude;
+  nmea_walk_position(walk, 1, &latitude, &longitude);
+  TF_LITE_MICRO_EXPECT_NEAR(latitude, parcel.Latitude, 2e-7);
+  TF_LITE_MICRO_EXPECT_NEAR(longitude, parcel.Longitude, 2e-7);
+  TF_LITE_MICRO_EXPECT_NEAR(45.3, parcel.Altitude, 1e-9);
+  TF_LITE_MICRO_EXPECT_EQ(8, static_cast<int>(parcel.Sattelites));
+  TF_LITE_MICRO_EXPECT_EQ(2026, static_cast<int>(parcel.DateYear));
+  TF_LITE_MICRO_EXPECT_EQ(10, static_cast<int>(parcel.DateMonth));
+  TF_LITE_MICRO_EXPECT_EQ(18, static_cast<int>(parcel.DateDay));
+  TF_LITE_MICRO_EXPECT_EQ(12, static_cast<int>(parcel.TimeHour));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(parcel.TimeSecond));
+  TF_LITE_MICRO_EXPECT_TRUE((GPSFixAge() < 1000));
+}
+
+TF_LITE_MICRO_TESTS_END
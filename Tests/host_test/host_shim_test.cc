@@ -0,0 +1,181 @@
+/**
+  *
+  *
+  * @file:    host_shim_test.cc
+  * @date:    17-10-2026 06:40:12
+  *
+  * @brief    Tests of the Arduino shim and the controller running on it
+  *
+  *
+  *
+  *
+**/
+
+#include <Arduino.h>
+#include <SD.h>
+#include <Wire.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "afds_controller.h"
+#include "constants.h"
+#include "lsm9ds1_sim.h"
+#include "SetupIMU.h"
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(StringFormatsLikeArduino) {
+  TF_LITE_MICRO_EXPECT_TRUE((String(-0.25f) == "-0.25"));
+  TF_LITE_MICRO_EXPECT_TRUE((String(3.14159f, 4) == "3.1416"));
+  TF_LITE_MICRO_EXPECT_TRUE((String(-42) == "-42"));
+  TF_LITE_MICRO_EXPECT_TRUE((String(255, HEX) == "FF"));
+  TF_LITE_MICRO_EXPECT_TRUE(((String("a") + "," + String(2)) == "a,2"));
+}
+
+TF_LITE_MICRO_TEST(SerialKeepsTransmittedBytes) {
+  Serial1.host_take_transmitted();
+  Serial1.print("F: ");
+  Serial1.println(0.5f);
+  Serial1.print(-7);
+  TF_LITE_MICRO_EXPECT_TRUE((Serial1.host_take_transmitted() == "F: 0.50\r\n-7"));
+
+  char bytes[2] = {0, 0};
+  Serial1.host_receive("OK");
+  TF_LITE_MICRO_EXPECT_EQ(Serial1.available(), 2);
+  TF_LITE_MICRO_EXPECT_EQ(Serial1.readBytes(bytes, 2), static_cast<size_t>(2));
+  TF_LITE_MICRO_EXPECT_EQ(bytes[0], 'O');
+  TF_LITE_MICRO_EXPECT_EQ(bytes[1], 'K');
+  TF_LITE_MICRO_EXPECT_EQ(Serial1.available(), 0);
+}
+
+TF_LITE_MICRO_TEST(DelayMovesTheVirtualClock) {
+  unsigned long start = millis();
+  delay(10000);
+  unsigned long elapsed = millis() - start;
+  TF_LITE_MICRO_EXPECT_GE(elapsed, 10000ul);
+  // The delay must not be slept on the workstation
+  TF_LITE_MICRO_EXPECT_LT(elapsed, 11000ul);
+}
+
+TF_LITE_MICRO_TEST(PinsKeepTheWrittenValues) {
+  pinMode(WAKE_UP, OUTPUT);
+  digitalWrite(WAKE_UP, HIGH);
+  analogWrite(AUDIO, 50);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_mode(WAKE_UP), OUTPUT);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), HIGH);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 50);
+  digitalWrite(WAKE_UP, LOW);
+  analogWrite(AUDIO, 0);
+}
+
+TF_LITE_MICRO_TEST(SDFileRoundTrip) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  SD.remove("SHIM.csv");
+  TF_LITE_MICRO_EXPECT_TRUE(!SD.exists("SHIM.csv"));
+
+  File file = SD.open("SHIM.csv", FILE_WRITE);
+  TF_LITE_MICRO_EXPECT_TRUE(file);
+  file.println("1.25,2.50");
+  file.close();
+  TF_LITE_MICRO_EXPECT_TRUE(!file);
+
+  // Opening for writing again appends to the file
+  file = SD.open("SHIM.csv", FILE_WRITE);
+  file.print("3");
+  file.close();
+
+  file = SD.open("SHIM.csv", FILE_READ);
+  TF_LITE_MICRO_EXPECT_TRUE(file);
+  TF_LITE_MICRO_EXPECT_EQ(file.size(), static_cast<uint32_t>(12));
+  char text[16];
+  int n = file.read(text, sizeof(text) - 1);
+  text[n < 0 ? 0 : n] = '\0';
+  TF_LITE_MICRO_EXPECT_EQ(strcmp(text, "1.25,2.50\r\n3"), 0);
+  TF_LITE_MICRO_EXPECT_EQ(file.available(), 0);
+  TF_LITE_MICRO_EXPECT_EQ(file.read(), -1);
+  file.close();
+
+  TF_LITE_MICRO_EXPECT_TRUE(!SD.open("MISSING.csv", FILE_READ));
+}
+
+TF_LITE_MICRO_TEST(WireNacksMissingDevice) {
+  TwoWire bus;
+  bus.beginTransmission(0x42);
+  bus.write(0x0F);
+  TF_LITE_MICRO_EXPECT_EQ(bus.endTransmission(), 2);
+  TF_LITE_MICRO_EXPECT_EQ(bus.requestFrom(0x42, 1), static_cast<size_t>(0));
+}
+
+TF_LITE_MICRO_TEST(IMUDriverReadsSimulatedSamples) {
+  LSM9DS1Sim imu_sim;
+  imu_sim.attach(Wire);
+
+  SetupIMUDefaults();
+  TF_LITE_MICRO_EXPECT_EQ(IMU.begin(), 1);
+  TF_LITE_MICRO_EXPECT_EQ(IMU.accelerationAvailable(), 0);
+
+  imu_sim.push_sample(0.5f, -1.0f, 2.0f, 100.0f, -250.0f, 0.0f);
+  TF_LITE_MICRO_EXPECT_EQ(IMU.accelerationAvailable(), 1);
+  TF_LITE_MICRO_EXPECT_EQ(IMU.gyroscopeAvailable(), 1);
+  IMU.readAccel();
+  IMU.readGyro();
+  // The values are quantized to the 16 g and 2000 dps resolution of the IMU
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcAccel(IMU.ax), 0.5f, 0.000732f);
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcAccel(IMU.ay), -1.0f, 0.000732f);
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcAccel(IMU.az), 2.0f, 0.000732f);
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcGyro(IMU.gx), 100.0f, 0.07f);
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcGyro(IMU.gy), -250.0f, 0.07f);
+  TF_LITE_MICRO_EXPECT_NEAR(IMU.calcGyro(IMU.gz), 0.0f, 0.07f);
+  // Both parts of the sample have been read
+  TF_LITE_MICRO_EXPECT_EQ(IMU.accelerationAvailable(), 0);
+  TF_LITE_MICRO_EXPECT_EQ(imu_sim.pending(), static_cast<size_t>(0));
+
+  Wire.host_attach(0x6b, nullptr);
+  Wire.host_attach(0x1e, nullptr);
+}
+
+TF_LITE_MICRO_TEST(ControllerSavesFallAndWaitsForLoPy) {
+  static afdsdCtrl1 ctrl;
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    ctrl.readIMU(10 * i, 0, 1366, 0, 0, 0);
+  }
+  // The x-axes are reversed compared to the model
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.acc_x_arr.newest(), -10 * (SIGNAL_SIZE - 1));
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.acc_z_arr.newest(), 1366);
+
+  // The LoPy acknowledges the alarm frame when it has been woken up
+  bool lopy_was_woken = false;
+  Serial1.host_set_peer([&lopy_was_woken](HardwareSerial& uart) {
+    std::string sent = uart.host_take_transmitted();
+    if (host::pin_value(WAKE_UP) == HIGH && sent.size() > 2 && sent[1] == LINK_ALARM) {
+      lopy_was_woken = true;
+      uint8_t frame[LINK_MAX_FRAME];
+      uart.host_receive(frame, link_encode(LINK_ACK, sent[2], nullptr, 0, frame));
+    }
+  });
+  SD.remove("FALL01.afl");
+
+  float fall_output[2] = {0.1f, 0.9f};
+  ctrl.predict_fall(fall_output);
+  // The signal is saved and the answer read in the next loop
+  ctrl.update_alarm();
+  Serial1.host_set_peer(nullptr);
+
+  TF_LITE_MICRO_EXPECT_TRUE(lopy_was_woken);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.fall_nr, 1);
+  TF_LITE_MICRO_EXPECT_EQ(strcmp(ctrl.fall_name_array, "FALL01.afl"), 0);
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL01.afl"));
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_value(WAKE_UP), LOW);
+  TF_LITE_MICRO_EXPECT_EQ(host::pin_analog_value(AUDIO), 0);
+  TF_LITE_MICRO_EXPECT_TRUE(!ctrl.got_data);
+
+  // A window predicted as not a fall only resets the threshold
+  ctrl.got_data = true;
+  float daily_output[2] = {0.9f, 0.1f};
+  ctrl.predict_fall(daily_output);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.fall_nr, 1);
+  TF_LITE_MICRO_EXPECT_TRUE(ctrl.got_data);
+  TF_LITE_MICRO_EXPECT_EQ(ctrl.threshold, 1.0f);
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,223 @@
+/**
+  *
+  *
+  * @file:    lopy_link_test.cc
+  * @date:    17-10-2026 08:08:06
+  *
+  * @brief    Tests of the framed Nano to LoPy protocol, and its latency and throughput on a simulated wire
+  *
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "GPSPacket.h"
+#include "constants.h"
+#include "lopy_link.h"
+#include "lopy_sim.h"
+
+namespace {
+
+// Decodes the bytes one at a time, and returns the amount of frames
+int feed(LinkDecoder& decoder, const uint8_t* bytes, int length) {
+  int frames = 0;
+  for (int i = 0; i < length; i++) {
+    frames += decoder.push(bytes[i]) ? 1 : 0;
+  }
+  return frames;
+}
+
+AlarmMessage make_alarm() {
+  AlarmMessage alarm = {};
+  alarm.fall_number = 7;
+  alarm.confidence = 230;
+  float features[FEATURE_AMOUNT];
+  for (int i = 0; i < FEATURE_AMOUNT; i++) {
+    features[i] = i * 0.25f;
+  }
+  alarm.features_digest = link_features_digest(features, FEATURE_AMOUNT);
+  GPSPackage parcel = GPSPackage();
+  parcel.Latitude = 56.167794;
+  parcel.Longitude = 10.190551;
+  parcel.Altitude = 45.3;
+  parcel.Sattelites = 8;
+  setGPSTimestamp(parcel, 845640001UL);
+  alarm.gps_length = encodeAbsoluteGPSPacket(parcel, alarm.gps, sizeof(alarm.gps));
+  return alarm;
+}
+
+// Two ends of the link on a wire, at the given baud rates
+struct LinkWire {
+  HardwareSerial nano_uart;
+  HardwareSerial lopy_uart;
+  UartLoopback wire;
+  LopyLink nano;
+  LopyLink lopy;
+
+  LinkWire(unsigned long nano_baud, unsigned long lopy_baud)
+      : nano_uart(nullptr), lopy_uart(nullptr), wire(nano_uart, lopy_uart), nano(nano_uart), lopy(lopy_uart) {
+    nano.begin(nano_baud);
+    lopy.begin(lopy_baud);
+  }
+};
+
+// Sends the alarms from the Nano, and returns the time in us until the LoPy has received them
+unsigned long send_alarms(LinkWire& link, int count, int* received) {
+  const unsigned long STEP_US = 10;
+  uint8_t payload[LINK_MAX_PAYLOAD];
+  uint8_t length = link_encode_alarm(make_alarm(), payload);
+  for (int i = 0; i < count; i++) {
+    link.nano.send(LINK_ALARM, payload, length);
+  }
+  *received = 0;
+  unsigned long start = micros();
+  LinkFrame frame;
+  link.wire.transfer();
+  while (link.wire.in_flight() > 0 || link.lopy_uart.available() > 0) {
+    host::advance_time_us(STEP_US);
+    link.wire.transfer();
+    while (link.lopy.receive(&frame)) {
+      (*received)++;
+    }
+  }
+  return micros() - start;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(CrcIsCcittFalse) {
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  TF_LITE_MICRO_EXPECT_EQ(0x29B1, link_crc16(check, sizeof(check)));
+  // The CRC can be calculated in parts
+  TF_LITE_MICRO_EXPECT_EQ(0x29B1, link_crc16(check + 4, 5, link_crc16(check, 4)));
+}
+
+TF_LITE_MICRO_TEST(FramesRoundTrip) {
+  static_assert(LINK_GPS_MAX_SIZE == GPS_PACKET_MAX_SIZE, "Every GPS packet fits in an alarm");
+  uint8_t payload[LINK_MAX_PAYLOAD];
+  AlarmMessage alarm = make_alarm();
+  uint8_t length = link_encode_alarm(alarm, payload);
+  TF_LITE_MICRO_EXPECT_EQ(LINK_ALARM_HEADER_SIZE + GPS_PACKET_ABSOLUTE_SIZE, static_cast<int>(length));
+
+  uint8_t frame[LINK_MAX_FRAME];
+  int size = link_encode(LINK_ALARM, 200, payload, length, frame);
+  TF_LITE_MICRO_EXPECT_EQ(LINK_HEADER_SIZE + length + LINK_CRC_SIZE, size);
+  TF_LITE_MICRO_EXPECT_EQ(LINK_SYNC, frame[0]);
+
+  LinkDecoder decoder;
+  // The frame is only decoded with its last byte
+  TF_LITE_MICRO_EXPECT_EQ(0, feed(decoder, frame, size - 1));
+  TF_LITE_MICRO_EXPECT_TRUE(decoder.push(frame[size - 1]));
+  TF_LITE_MICRO_EXPECT_EQ(LINK_ALARM, decoder.frame().type);
+  TF_LITE_MICRO_EXPECT_EQ(200, decoder.frame().seq);
+
+  AlarmMessage decoded;
+  TF_LITE_MICRO_EXPECT_TRUE(link_decode_alarm(decoder.frame(), &decoded));
+  TF_LITE_MICRO_EXPECT_EQ(alarm.fall_number, decoded.fall_number);
+  TF_LITE_MICRO_EXPECT_EQ(alarm.confidence, decoded.confidence);
+  TF_LITE_MICRO_EXPECT_EQ(alarm.features_digest, decoded.features_digest);
+  TF_LITE_MICRO_EXPECT_EQ(alarm.gps_length, decoded.gps_length);
+  TF_LITE_MICRO_EXPECT_EQ(0, memcmp(alarm.gps, decoded.gps, alarm.gps_length));
+  GPSPacketKey key = GPSPacketKey();
+  GPSPackage parcel;
+  TF_LITE_MICRO_EXPECT_EQ(decoded.gps_length, decodeGPSPacket(decoded.gps, decoded.gps_length, key, parcel));
+  TF_LITE_MICRO_EXPECT_NEAR(56.167794, parcel.Latitude, 1e-6);
+
+  // The frames without a payload
+  const uint8_t types[] = {LINK_ACK, LINK_CANCEL, LINK_HEARTBEAT};
+  for (uint8_t type : types) {
+    size = link_encode(type, 3, nullptr, 0, frame);
+    TF_LITE_MICRO_EXPECT_EQ(LINK_HEADER_SIZE + LINK_CRC_SIZE, size);
+    TF_LITE_MICRO_EXPECT_EQ(1, feed(decoder, frame, size));
+    TF_LITE_MICRO_EXPECT_EQ(type, decoder.frame().type);
+    TF_LITE_MICRO_EXPECT_EQ(0, decoder.frame().length);
+    TF_LITE_MICRO_EXPECT_TRUE(!link_decode_alarm(decoder.frame(), &decoded));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(4, static_cast<int>(decoder.frames));
+  TF_LITE_MICRO_EXPECT_EQ(0, link_encode(LINK_ALARM, 0, payload, LINK_MAX_PAYLOAD + 1, frame));
+}
+
+TF_LITE_MICRO_TEST(CorruptFramesAreDropped) {
+  uint8_t payload[LINK_MAX_PAYLOAD];
+  uint8_t length = link_encode_alarm(make_alarm(), payload);
+  uint8_t frame[LINK_MAX_FRAME];
+  int size = link_encode(LINK_ALARM, 1, payload, length, frame);
+
+  LinkDecoder decoder;
+  for (int i = 1; i < size; i++) {
+    uint8_t corrupt[LINK_MAX_FRAME];
+    memcpy(corrupt, frame, size);
+    corrupt[i] ^= 0x10;
+    TF_LITE_MICRO_EXPECT_EQ(0, feed(decoder, corrupt, size));
+    // The next frame is decoded, even after a corrupt length
+    decoder.reset();
+    TF_LITE_MICRO_EXPECT_EQ(1, feed(decoder, frame, size));
+  }
+  TF_LITE_MICRO_EXPECT_TRUE((decoder.crc_errors > 0));
+}
+
+TF_LITE_MICRO_TEST(DecoderFindsFramesAfterGarbage) {
+  uint8_t frame[LINK_MAX_FRAME];
+  int size = link_encode(LINK_HEARTBEAT, 9, nullptr, 0, frame);
+
+  // Garbage with sync bytes and short lengths, a frame cut off after its header, and then the frame
+  uint8_t bytes[64] = {0x00, LINK_SYNC, 0x01, 0x02, 0x03, 0x7F, LINK_SYNC, LINK_SYNC, 0x02};
+  int count = 9;
+  memcpy(bytes + count, frame, LINK_HEADER_SIZE);
+  count += LINK_HEADER_SIZE;
+  memcpy(bytes + count, frame, size);
+  count += size;
+
+  LinkDecoder decoder;
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(decoder, bytes, count));
+  TF_LITE_MICRO_EXPECT_EQ(LINK_HEARTBEAT, decoder.frame().type);
+  TF_LITE_MICRO_EXPECT_EQ(9, decoder.frame().seq);
+}
+
+TF_LITE_MICRO_TEST(LatencyOfAnAlarm) {
+  LinkWire fast(LINK_BAUD, LINK_BAUD);
+  int received = 0;
+  unsigned long fast_us = send_alarms(fast, 1, &received);
+  TF_LITE_MICRO_EXPECT_EQ(1, received);
+  LinkWire slow(9600, 9600);
+  unsigned long slow_us = send_alarms(slow, 1, &received);
+  TF_LITE_MICRO_EXPECT_EQ(1, received);
+
+  // An alarm with a GPS fix is 28 bytes, 2.4 ms at 115200 baud and 29 ms at 9600 baud
+  const int frame_bytes = LINK_HEADER_SIZE + LINK_ALARM_HEADER_SIZE + GPS_PACKET_ABSOLUTE_SIZE + LINK_CRC_SIZE;
+  TF_LITE_MICRO_EXPECT_NEAR(frame_bytes * 10e6 / LINK_BAUD, fast_us, 100);
+  TF_LITE_MICRO_EXPECT_NEAR(frame_bytes * 10e6 / 9600, slow_us, 100);
+  TF_LITE_MICRO_EXPECT_TRUE((fast_us < 3000));
+  printf("Alarm latency: %lu us at %lu baud, %lu us at 9600 baud\n", fast_us, LINK_BAUD, slow_us);
+}
+
+TF_LITE_MICRO_TEST(ThroughputOfAlarms) {
+  const int ALARMS = 200;
+  LinkWire link(LINK_BAUD, LINK_BAUD);
+  int received = 0;
+  unsigned long us = send_alarms(link, ALARMS, &received);
+  TF_LITE_MICRO_EXPECT_EQ(ALARMS, received);
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(link.lopy.decoder().crc_errors));
+
+  // Back to back frames use the whole line
+  const int frame_bytes = LINK_HEADER_SIZE + LINK_ALARM_HEADER_SIZE + GPS_PACKET_ABSOLUTE_SIZE + LINK_CRC_SIZE;
+  double line_rate = LINK_BAUD / 10.0 / frame_bytes;
+  double frames_per_second = ALARMS * 1e6 / us;
+  TF_LITE_MICRO_EXPECT_TRUE((frames_per_second > 0.99 * line_rate));
+  printf("Alarm throughput: %.0f frames/s at %lu baud (line rate %.0f frames/s)\n", frames_per_second, LINK_BAUD,
+         line_rate);
+}
+
+TF_LITE_MICRO_TEST(MismatchedBaudRatesGiveNoFrames) {
+  LinkWire link(LINK_BAUD, 9600);
+  int received = 0;
+  send_alarms(link, 10, &received);
+  TF_LITE_MICRO_EXPECT_EQ(0, received);
+}
+
+TF_LITE_MICRO_TESTS_END
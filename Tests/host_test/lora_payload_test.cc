@@ -0,0 +1,288 @@
+/**
+  *
+  *
+  * @file:    lora_payload_test.cc
+  * @date:    17-10-2026 08:22:07
+  *
+  * @brief    Tests of the bit-packed LoRa uplink, against the uplinks received by the network server in the field tests
+  *
+**/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "lora_payload.h"
+
+#ifndef UPLINK_DIR
+#define UPLINK_DIR "../../Docker/premade_test_files"
+#endif
+
+namespace {
+
+const char* UPLINK_FILES[] = {
+  "filtered_csv_file.csv",
+  "filtered_csv_file_04_23_2020_13_48_27.csv",
+  "filtered_csv_file_04_24_2020_10_07_36.csv",
+  "filtered_csv_file_22_04_morgen.csv",
+};
+
+// Splits a line of the CSV files, where quoted fields have commas and "" for quotes
+std::vector<std::string> split_csv(const std::string& line) {
+  std::vector<std::string> fields(1);
+  bool quoted = false;
+  for (size_t i = 0; i < line.size(); i++) {
+    char c = line[i];
+    if (quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+      fields.back() += c;
+      i++;
+    }
+    else if (c == '"') {
+      quoted = !quoted;
+    }
+    else if (c == ',' && !quoted) {
+      fields.push_back(std::string());
+    }
+    else if (c != '\r') {
+      fields.back() += c;
+    }
+  }
+  return fields;
+}
+
+int base64_decode(const std::string& text, uint8_t* bytes, int size) {
+  static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  uint32_t bits = 0;
+  int bit_count = 0;
+  int length = 0;
+  for (char c : text) {
+    const char* found = strchr(ALPHABET, c);
+    if (c == '=' || c == '\0' || found == nullptr) {
+      break;
+    }
+    bits = (bits << 6) | static_cast<uint32_t>(found - ALPHABET);
+    bit_count += 6;
+    if (bit_count >= 8) {
+      bit_count -= 8;
+      if (length == size) {
+        return -1;
+      }
+      bytes[length++] = static_cast<uint8_t>(bits >> bit_count);
+    }
+  }
+  return length;
+}
+
+int column(const std::vector<std::string>& header, const char* name) {
+  for (size_t i = 0; i < header.size(); i++) {
+    if (header[i] == name) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+// Distance in metres between two positions, which are close to each other
+double distance_m(double lat_a, double lon_a, double lat_b, double lon_b) {
+  const double METRES_PER_DEGREE = 6371000.0 * M_PI / 180.0;
+  double dlon = fmod(lon_a - lon_b + 540.0, 360.0) - 180.0;
+  double dy = (lat_a - lat_b) * METRES_PER_DEGREE;
+  double dx = dlon * METRES_PER_DEGREE * cos((lat_a + lat_b) * M_PI / 360.0);
+  return sqrt(dx * dx + dy * dy);
+}
+
+// Symbols of a LoRaWAN uplink at SF12, 125 kHz, coding rate 4/5, explicit header and low data rate optimization
+int sf12_payload_symbols(int app_payload) {
+  const int SF = 12;
+  int phy_payload = 13 + app_payload;  // MHDR, FHDR without FOpts, FPort and MIC
+  int numerator = 8 * phy_payload - 4 * SF + 28 + 16;
+  int denominator = 4 * (SF - 2);
+  int blocks = (numerator + denominator - 1) / denominator;
+  return 8 + (blocks > 0 ? blocks : 0) * 5;
+}
+
+LoraUplink round_trip(const LoraUplink& uplink) {
+  uint8_t payload[LORA_PAYLOAD_SIZE];
+  LoraUplink decoded = {};
+  int length = lora_encode(uplink, payload);
+  if (!lora_decode(payload, length, &decoded)) {
+    decoded.counter = 0xFF;
+  }
+  return decoded;
+}
+
+LoraUplink make_uplink(double latitude, double longitude) {
+  LoraUplink uplink = {};
+  uplink.has_position = true;
+  uplink.latitude = latitude;
+  uplink.longitude = longitude;
+  uplink.battery = 3000;
+  uplink.confidence = 0.8f;
+  uplink.counter = 5;
+  return uplink;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(PackedPayloadSavesAirtime) {
+  // Every 5 bytes more is 5 symbols more, so 7 bytes is the largest payload of the shortest uplink
+  TF_LITE_MICRO_EXPECT_EQ(33, sf12_payload_symbols(LORA_LEGACY_PAYLOAD_SIZE));
+  TF_LITE_MICRO_EXPECT_EQ(28, sf12_payload_symbols(LORA_PAYLOAD_SIZE));
+  TF_LITE_MICRO_EXPECT_EQ(33, sf12_payload_symbols(LORA_PAYLOAD_SIZE + 1));
+  TF_LITE_MICRO_EXPECT_EQ(LORA_PAYLOAD_SIZE * 8, LORA_LATITUDE_BITS + LORA_LONGITUDE_BITS + LORA_BATTERY_BITS +
+                                                    LORA_CONFIDENCE_BITS + LORA_COUNTER_BITS);
+  // 4.25 symbols of preamble and 32.768 ms per symbol
+  double legacy_ms = (12.25 + sf12_payload_symbols(LORA_LEGACY_PAYLOAD_SIZE)) * 32.768;
+  double packed_ms = (12.25 + sf12_payload_symbols(LORA_PAYLOAD_SIZE)) * 32.768;
+  printf("Uplink airtime at SF12: %.0f ms for %d bytes, %.0f ms for %d bytes\n", legacy_ms, LORA_LEGACY_PAYLOAD_SIZE,
+         packed_ms, LORA_PAYLOAD_SIZE);
+}
+
+TF_LITE_MICRO_TEST(ArchivedUplinksArePackedWithinMetres) {
+  int uplinks = 0;
+  int damaged = 0;
+  double largest_error_m = 0.0;
+  for (const char* file : UPLINK_FILES) {
+    std::string path = std::string(UPLINK_DIR) + "/" + file;
+    std::ifstream csv(path.c_str());
+    TF_LITE_MICRO_EXPECT_TRUE(csv.good());
+    std::string line;
+    std::getline(csv, line);
+    std::vector<std::string> header = split_csv(line);
+    int data = column(header, "payload__data");
+    int port = column(header, "payload__fPort");
+    int count = column(header, "payload__fCnt");
+    int latitude = column(header, "Latitude");
+    int longitude = column(header, "Longitude");
+    int battery = column(header, "Battery");
+    TF_LITE_MICRO_EXPECT_TRUE((data >= 0 && port >= 0 && count >= 0 && latitude >= 0 && longitude >= 0 &&
+                               battery >= 0));
+
+    while (std::getline(csv, line)) {
+      std::vector<std::string> fields = split_csv(line);
+      if (fields.size() != header.size()) {
+        continue;
+      }
+      TF_LITE_MICRO_EXPECT_EQ(LORA_LEGACY_PORT, atoi(fields[port].c_str()));
+      uint8_t payload[LORA_LEGACY_PAYLOAD_SIZE];
+      int length = base64_decode(fields[data], payload, sizeof(payload));
+      LoraUplink legacy;
+      if (lora_decode_legacy(payload, length, &legacy)) {
+        // The network server decoded the same floats
+        TF_LITE_MICRO_EXPECT_NEAR(atof(fields[latitude].c_str()), legacy.latitude, 1e-9);
+        TF_LITE_MICRO_EXPECT_NEAR(atof(fields[longitude].c_str()), legacy.longitude, 1e-9);
+        TF_LITE_MICRO_EXPECT_EQ(atoi(fields[battery].c_str()), legacy.battery);
+      }
+      else {
+        // A spreadsheet replaced a few payloads with "#NAVN?", so the values decoded by the server are packed
+        TF_LITE_MICRO_EXPECT_TRUE((fields[data][0] == '#'));
+        legacy.has_position = true;
+        legacy.latitude = atof(fields[latitude].c_str());
+        legacy.longitude = atof(fields[longitude].c_str());
+        legacy.battery = static_cast<uint16_t>(atoi(fields[battery].c_str()));
+        damaged++;
+      }
+
+      legacy.confidence = 0.93f;
+      legacy.counter = static_cast<uint8_t>(atoi(fields[count].c_str()));
+      LoraUplink packed = round_trip(legacy);
+      TF_LITE_MICRO_EXPECT_TRUE(packed.has_position);
+      double error_m = distance_m(legacy.latitude, legacy.longitude, packed.latitude, packed.longitude);
+      TF_LITE_MICRO_EXPECT_TRUE((error_m < 3.5));
+      if (error_m > largest_error_m) {
+        largest_error_m = error_m;
+      }
+      TF_LITE_MICRO_EXPECT_EQ(legacy.battery, packed.battery);
+      TF_LITE_MICRO_EXPECT_EQ(legacy.counter % 16, packed.counter);
+      TF_LITE_MICRO_EXPECT_NEAR(0.93f, packed.confidence, 0.5f / 14);
+
+      // The archived uplinks all have a full battery, so the battery is also packed across its range,
+      // within half of the 15 steps
+      LoraUplink draining = legacy;
+      draining.battery = static_cast<uint16_t>(uplinks * 37 % (LORA_BATTERY_MAX + 1));
+      int battery_error = static_cast<int>(round_trip(draining).battery) - draining.battery;
+      TF_LITE_MICRO_EXPECT_TRUE((battery_error >= -(LORA_BATTERY_MAX / 30 + 1) &&
+                                 battery_error <= LORA_BATTERY_MAX / 30 + 1));
+      uplinks++;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_TRUE((uplinks > 200));
+  TF_LITE_MICRO_EXPECT_TRUE((damaged < 10));
+  printf("%d archived uplinks packed (%d without payload), largest position error %.2f m\n", uplinks, damaged,
+         largest_error_m);
+}
+
+TF_LITE_MICRO_TEST(PositionsRoundTripEverywhere) {
+  double largest_error_m = 0.0;
+  for (int lat = -89; lat <= 89; lat += 7) {
+    for (int lon = -179; lon <= 179; lon += 11) {
+      double latitude = lat + 0.123456;
+      double longitude = lon + 0.654321;
+      LoraUplink decoded = round_trip(make_uplink(latitude, longitude));
+      TF_LITE_MICRO_EXPECT_TRUE(decoded.has_position);
+      TF_LITE_MICRO_EXPECT_NEAR(latitude, decoded.latitude, 180.0 / (LORA_NO_POSITION - 1));
+      TF_LITE_MICRO_EXPECT_NEAR(longitude, decoded.longitude, 360.0 / (1UL << LORA_LONGITUDE_BITS));
+      double error_m = distance_m(latitude, longitude, decoded.latitude, decoded.longitude);
+      if (error_m > largest_error_m) {
+        largest_error_m = error_m;
+      }
+    }
+  }
+  // Half a step of latitude and longitude at the equator
+  TF_LITE_MICRO_EXPECT_TRUE((largest_error_m < 3.4));
+}
+
+TF_LITE_MICRO_TEST(EdgesOfTheRanges) {
+  // The poles and the date line
+  LoraUplink decoded = round_trip(make_uplink(90.0, 180.0));
+  TF_LITE_MICRO_EXPECT_TRUE(decoded.has_position);
+  TF_LITE_MICRO_EXPECT_NEAR(90.0, decoded.latitude, 1e-9);
+  TF_LITE_MICRO_EXPECT_NEAR(-180.0, decoded.longitude, 1e-9);
+  decoded = round_trip(make_uplink(-90.0, -180.0));
+  TF_LITE_MICRO_EXPECT_NEAR(-90.0, decoded.latitude, 1e-9);
+  TF_LITE_MICRO_EXPECT_NEAR(-180.0, decoded.longitude, 1e-9);
+  decoded = round_trip(make_uplink(0.0, 179.99999));
+  TF_LITE_MICRO_EXPECT_TRUE((distance_m(0.0, 179.99999, decoded.latitude, decoded.longitude) < 3.0));
+  decoded = round_trip(make_uplink(95.0, 540.5));
+  TF_LITE_MICRO_EXPECT_NEAR(90.0, decoded.latitude, 1e-9);
+  TF_LITE_MICRO_EXPECT_NEAR(-179.5, decoded.longitude, 1e-5);
+
+  // Without a fix
+  LoraUplink uplink = make_uplink(56.0, 10.0);
+  uplink.has_position = false;
+  decoded = round_trip(uplink);
+  TF_LITE_MICRO_EXPECT_TRUE(!decoded.has_position);
+  TF_LITE_MICRO_EXPECT_EQ(uplink.counter, decoded.counter);
+  TF_LITE_MICRO_EXPECT_EQ(3003, decoded.battery);
+
+  // The battery, fall probability and counter are clamped or wrapped
+  uplink = make_uplink(56.0, 10.0);
+  uplink.battery = 0;
+  uplink.confidence = 0.2f;
+  uplink.counter = 17;
+  decoded = round_trip(uplink);
+  TF_LITE_MICRO_EXPECT_EQ(0, decoded.battery);
+  TF_LITE_MICRO_EXPECT_NEAR(0.5f, decoded.confidence, 1e-6f);
+  TF_LITE_MICRO_EXPECT_EQ(1, decoded.counter);
+  uplink.battery = 65535;
+  uplink.confidence = 1.5f;
+  uplink.counter = 15;
+  decoded = round_trip(uplink);
+  TF_LITE_MICRO_EXPECT_EQ(LORA_BATTERY_MAX, decoded.battery);
+  TF_LITE_MICRO_EXPECT_NEAR(1.0f, decoded.confidence, 1e-6f);
+  TF_LITE_MICRO_EXPECT_EQ(15, decoded.counter);
+
+  uint8_t payload[LORA_LEGACY_PAYLOAD_SIZE] = {};
+  TF_LITE_MICRO_EXPECT_TRUE(!lora_decode(payload, LORA_PAYLOAD_SIZE + 1, &decoded));
+  TF_LITE_MICRO_EXPECT_TRUE(!lora_decode_legacy(payload, LORA_PAYLOAD_SIZE, &decoded));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,182 @@
+/**
+  *
+  *
+  * @file:    lsm9ds1_fifo_test.cc
+  * @date:    17-10-2026 06:53:26
+  *
+  * @brief    Tests of the burst reads of the LSM9DS1 FIFO on the simulated I2C bus
+  *
+  *
+  *
+  *
+**/
+
+#include <stdio.h>
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "lsm9ds1_sim.h"
+#include "SetupIMU.h"
+
+namespace {
+
+LSM9DS1Sim imu_sim;
+int16_t accel[LSM9DS1_FIFO_SIZE][3];
+int16_t gyro[LSM9DS1_FIFO_SIZE][3];
+
+// A sample with different raw values on every axis
+LSM9DS1Sim::Sample make_sample(int n) {
+  LSM9DS1Sim::Sample sample;
+  for (int axis = 0; axis < 3; axis++) {
+    sample.accel[axis] = static_cast<int16_t>(100 * n + axis);
+    sample.gyro[axis] = static_cast<int16_t>(-100 * n - 10 * axis);
+  }
+  return sample;
+}
+
+bool is_sample(int i, int n) {
+  LSM9DS1Sim::Sample sample = make_sample(n);
+  for (int axis = 0; axis < 3; axis++) {
+    if (accel[i][axis] != sample.accel[axis] || gyro[i][axis] != sample.gyro[axis]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Starts the IMU with the default settings and the FIFO in continuous mode
+void start_imu(bool fifo) {
+  imu_sim.attach(Wire);
+  imu_sim.pace(0);
+  SetupIMUDefaults();
+  IMU.begin();
+  if (fifo) {
+    IMU.setContinuousMode();
+  }
+  else {
+    IMU.setOneShotMode();
+  }
+  Wire.host_reset_counters();
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FifoIsReadInOneBurst) {
+  start_imu(true);
+  for (int n = 0; n < 10; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  bool overrun = true;
+  TF_LITE_MICRO_EXPECT_EQ(IMU.fifoSamples(&overrun), 10);
+  TF_LITE_MICRO_EXPECT_TRUE(!overrun);
+
+  Wire.host_reset_counters();
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE, &overrun), 10);
+  TF_LITE_MICRO_EXPECT_TRUE(!overrun);
+  for (int i = 0; i < 10; i++) {
+    TF_LITE_MICRO_EXPECT_TRUE(is_sample(i, i));
+  }
+  // FIFO_SRC and a single burst, each a register write and a read
+  TF_LITE_MICRO_EXPECT_EQ(Wire.host_transactions(), 4ul);
+  TF_LITE_MICRO_EXPECT_EQ(imu_sim.pending(), static_cast<size_t>(0));
+
+  // An empty FIFO only reads FIFO_SRC
+  Wire.host_reset_counters();
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE), 0);
+  TF_LITE_MICRO_EXPECT_EQ(Wire.host_transactions(), 2ul);
+}
+
+TF_LITE_MICRO_TEST(FullFifoIsReadInBurstsFittingTheWireBuffer) {
+  start_imu(true);
+  for (int n = 0; n < LSM9DS1_FIFO_SIZE; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE), LSM9DS1_FIFO_SIZE);
+  for (int i = 0; i < LSM9DS1_FIFO_SIZE; i++) {
+    TF_LITE_MICRO_EXPECT_TRUE(is_sample(i, i));
+  }
+  // FIFO_SRC and two bursts, as 32 samples don't fit in the 256 byte buffer of Wire
+  TF_LITE_MICRO_EXPECT_EQ(Wire.host_transactions(), 6ul);
+  TF_LITE_MICRO_EXPECT_EQ(Wire.host_bytes(), static_cast<unsigned long>(2 + 2 + LSM9DS1_FIFO_SIZE * LSM9DS1_FIFO_SAMPLE_BYTES));
+}
+
+TF_LITE_MICRO_TEST(ReadIsLimitedToTheArrays) {
+  start_imu(true);
+  for (int n = 0; n < 10; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, 4), 4);
+  TF_LITE_MICRO_EXPECT_TRUE(is_sample(3, 3));
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE), 6);
+  TF_LITE_MICRO_EXPECT_TRUE(is_sample(0, 4));
+  TF_LITE_MICRO_EXPECT_TRUE(is_sample(5, 9));
+}
+
+TF_LITE_MICRO_TEST(OverrunIsReportedWhenFifoIsReadTooLate) {
+  start_imu(true);
+  const float rate = 14.9f;
+  imu_sim.pace(rate);
+  for (int n = 0; n < 50; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  // 50 samples arrive before the FIFO is read, so the oldest 18 are overwritten
+  host::advance_time_us(static_cast<unsigned long>(49.5f * 1000000.0f / rate));
+  bool overrun = false;
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE, &overrun), LSM9DS1_FIFO_SIZE);
+  TF_LITE_MICRO_EXPECT_TRUE(overrun);
+  TF_LITE_MICRO_EXPECT_TRUE(is_sample(0, 18));
+  TF_LITE_MICRO_EXPECT_TRUE(is_sample(LSM9DS1_FIFO_SIZE - 1, 49));
+  TF_LITE_MICRO_EXPECT_EQ(imu_sim.overruns(), 18ul);
+
+  // Read in time, no samples are lost
+  TF_LITE_MICRO_EXPECT_EQ(IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE, &overrun), 0);
+  TF_LITE_MICRO_EXPECT_TRUE(!overrun);
+}
+
+TF_LITE_MICRO_TEST(FifoCutsI2CTransactionsPerSample) {
+  const int samples = 300;
+  const float rate = 14.9f;
+
+  // Polling the status and reading the output registers of every sample
+  start_imu(false);
+  for (int n = 0; n < samples; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  int read = 0;
+  while (IMU.accelerationAvailable() && IMU.gyroscopeAvailable()) {
+    IMU.readAccel();
+    IMU.readGyro();
+    read++;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(read, samples);
+  double polling = static_cast<double>(Wire.host_transactions()) / samples;
+
+  // Reading the FIFO every 500 ms, like loop()
+  start_imu(true);
+  imu_sim.pace(rate);
+  for (int n = 0; n < samples; n++) {
+    imu_sim.push_raw(make_sample(n));
+  }
+  read = 0;
+  bool lost = false;
+  while (read < samples) {
+    bool overrun = false;
+    int count = IMU.readFIFO(accel, gyro, LSM9DS1_FIFO_SIZE, &overrun);
+    TF_LITE_MICRO_EXPECT_TRUE((count == 0 || is_sample(count - 1, read + count - 1)));
+    lost = lost || overrun;
+    read += count;
+    host::advance_time_us(500000);
+  }
+  TF_LITE_MICRO_EXPECT_TRUE(!lost);
+  double fifo = static_cast<double>(Wire.host_transactions()) / samples;
+
+  printf("I2C transactions per sample: polling %.2f, FIFO %.2f\n", polling, fifo);
+  TF_LITE_MICRO_EXPECT_TRUE((fifo * 8 < polling));
+}
+
+TF_LITE_MICRO_TESTS_END
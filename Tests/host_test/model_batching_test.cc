@@ -0,0 +1,94 @@
+/**
+  *
+  *
+  * @file:    model_batching_test.cc
+  * @date:    17-10-2026 07:19:36
+  *
+  * @brief    Tests of the copies of the fall models with a batch dimension
+  *
+**/
+
+#include <string.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_int8.h"
+#include "model_batching.h"
+#include "model_quantizer.h"
+
+namespace {
+
+// The first dimension of a tensor of the main subgraph
+int first_dimension(const std::vector<uint8_t>& flatbuffer, int tensor) {
+  const tflite::SubGraph* subgraph = tflite::GetModel(flatbuffer.data())->subgraphs()->Get(0);
+  return subgraph->tensors()->Get(tensor)->shape()->Get(0);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ModelsHaveABatchOfOne) {
+  TF_LITE_MICRO_EXPECT_EQ(model_batch(fall_model_data), 1);
+  TF_LITE_MICRO_EXPECT_EQ(model_batch(fall_model_int8_data), 1);
+  // Input, FULLY_CONNECTED and LOGISTIC outputs, logits and softmax of f46 and f46_2
+  TF_LITE_MICRO_EXPECT_EQ(batch_row_bytes(fall_model_data), static_cast<size_t>((46 + 33 + 33 + 2 + 2) * 4));
+  TF_LITE_MICRO_EXPECT_EQ(batch_row_bytes(fall_model_2_data), static_cast<size_t>((46 + 192 + 192 + 2 + 2) * 4));
+}
+
+TF_LITE_MICRO_TEST(BatchedModelHasTheBatchOnEveryTensorWithoutData) {
+  std::vector<uint8_t> batched;
+  TF_LITE_MICRO_EXPECT_TRUE(batch_model(fall_model_data, fall_model_data_len, 64, batched));
+  TF_LITE_MICRO_EXPECT_EQ(model_batch(batched.data()), 64);
+  TF_LITE_MICRO_EXPECT_EQ(batch_row_bytes(batched.data()), batch_row_bytes(fall_model_data));
+
+  const tflite::Model* model = tflite::GetModel(batched.data());
+  const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+  int batched_tensors = 0;
+  for (size_t t = 0; t < subgraph->tensors()->size(); t++) {
+    const tflite::Tensor* tensor = subgraph->tensors()->Get(t);
+    const tflite::Buffer* buffer = model->buffers()->Get(tensor->buffer());
+    bool constant = buffer->data() != nullptr && buffer->data()->size() > 0;
+    batched_tensors += first_dimension(batched, t) == 64;
+    TF_LITE_MICRO_EXPECT_EQ(first_dimension(batched, t) == 64, !constant);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(batched_tensors, 5);
+}
+
+TF_LITE_MICRO_TEST(BatchedModelHasTheSameWeights) {
+  std::vector<uint8_t> batched;
+  DenseModel model;
+  DenseModel batched_model;
+  TF_LITE_MICRO_EXPECT_TRUE(batch_model(fall_model_2_data, fall_model_2_data_len, 16, batched));
+  TF_LITE_MICRO_EXPECT_TRUE(model.read(fall_model_2_data));
+  TF_LITE_MICRO_EXPECT_TRUE(batched_model.read(batched.data()));
+  TF_LITE_MICRO_EXPECT_TRUE((model.hidden.weights == batched_model.hidden.weights));
+  TF_LITE_MICRO_EXPECT_TRUE((model.output.bias == batched_model.output.bias));
+  TF_LITE_MICRO_EXPECT_EQ(batched.size(), static_cast<size_t>(fall_model_2_data_len));
+
+  // Back to a batch of one gives the model again
+  std::vector<uint8_t> single;
+  TF_LITE_MICRO_EXPECT_TRUE(batch_model(batched.data(), static_cast<int>(batched.size()), 1, single));
+  TF_LITE_MICRO_EXPECT_EQ(memcmp(single.data(), fall_model_2_data, single.size()), 0);
+}
+
+TF_LITE_MICRO_TEST(Int8ModelIsBatchedToo) {
+  std::vector<uint8_t> batched;
+  TF_LITE_MICRO_EXPECT_TRUE(batch_model(fall_model_int8_data, fall_model_int8_data_len, 8, batched));
+  TF_LITE_MICRO_EXPECT_EQ(model_batch(batched.data()), 8);
+  // int8 input, hidden and activation, float hidden, sigmoid, logits and softmax
+  TF_LITE_MICRO_EXPECT_EQ(batch_row_bytes(batched.data()),
+                          static_cast<size_t>(46 + 33 + 33 + 33 * 4 + 33 * 4 + 2 + 2 * 4 + 2 * 4));
+}
+
+TF_LITE_MICRO_TEST(BadBatchesAndModelsAreRefused) {
+  std::vector<uint8_t> batched;
+  const unsigned char garbage[64] = {0};
+  TF_LITE_MICRO_EXPECT_TRUE(!batch_model(fall_model_data, fall_model_data_len, 0, batched));
+  TF_LITE_MICRO_EXPECT_TRUE(!batch_model(garbage, sizeof(garbage), 4, batched));
+}
+
+TF_LITE_MICRO_TESTS_END
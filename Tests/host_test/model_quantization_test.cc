@@ -0,0 +1,170 @@
+/**
+  *
+  *
+  * @file:    model_quantization_test.cc
+  * @date:    17-10-2026 07:05:29
+  *
+  * @brief    Tests of the int8 fall models and the quantization of their features
+  *
+  *   The int8 models are run with the int8 reference inference, so the tests
+  *   don't need the TensorFlow Lite Micro interpreter.
+  *
+**/
+
+#include <math.h>
+
+#include <memory>
+#include <vector>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "../AFDS_test/anti_fall_detection_system_test/daily_features_data.h"
+#include "../AFDS_test/anti_fall_detection_system_test/fall_features_data.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_int8.h"
+#include "fall_model_f46_2_int8.h"
+#include "fall_model_f46_3_int8.h"
+#include "model_quantization.h"
+#include "model_quantizer.h"
+
+namespace {
+
+const float* const FEATURES[] = {
+  falling_features_data_nr1, falling_features_data_nr2, falling_features_data_nr3,
+  daily_features_data_nr1, daily_features_data_nr2, daily_features_data_nr3,
+};
+const int FEATURE_SETS = sizeof(FEATURES) / sizeof(FEATURES[0]);
+
+// A float model and its int8 version
+struct ModelPair {
+  const unsigned char* float_data;
+  int float_len;
+  const unsigned char* int8_data;
+  int int8_len;
+};
+
+const ModelPair MODELS[] = {
+  {fall_model_data, fall_model_data_len, fall_model_int8_data, fall_model_int8_data_len},
+  {fall_model_2_data, fall_model_2_data_len, fall_model_2_int8_data, fall_model_2_int8_data_len},
+  {fall_model_3_data, fall_model_3_data_len, fall_model_3_int8_data, fall_model_3_int8_data_len},
+};
+
+// The flatbuffer of fall_model_f46, changed by edit
+template <typename Edit>
+std::vector<uint8_t> edited_model(Edit edit) {
+  std::unique_ptr<tflite::ModelT> model(tflite::GetModel(fall_model_data)->UnPack());
+  edit(*model->subgraphs[0]);
+  flatbuffers::FlatBufferBuilder builder;
+  builder.Finish(tflite::Model::Pack(builder, model.get()), tflite::ModelIdentifier());
+  return std::vector<uint8_t>(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(FeaturesAreRoundedAndSaturated) {
+  TF_LITE_MICRO_EXPECT_EQ(quantize_value(0.0f, 0.5f, -10), -10);
+  TF_LITE_MICRO_EXPECT_EQ(quantize_value(1.2f, 0.5f, -10), -8);
+  TF_LITE_MICRO_EXPECT_EQ(quantize_value(-1.3f, 0.5f, -10), -13);
+  TF_LITE_MICRO_EXPECT_EQ(quantize_value(1000.0f, 0.5f, -10), 127);
+  TF_LITE_MICRO_EXPECT_EQ(quantize_value(-1000.0f, 0.5f, -10), -128);
+
+  // Every feature is quantized with its feature scale times the input scale
+  const float features[3] = {2.0f, -0.5f, 0.75f};
+  const float feature_scales[3] = {1.0f, 2.0f, 0.5f};
+  const int8_t expected[3] = {11, 2, 9};
+  int8_t input[3];
+  quantize_features(features, feature_scales, input, 3, 0.25f, 3);
+  for (int i = 0; i < 3; i++) {
+    TF_LITE_MICRO_EXPECT_EQ(input[i], expected[i]);
+    TF_LITE_MICRO_EXPECT_EQ(dequantize_value(input[i], feature_scales[i] * 0.25f, 3), features[i]);
+  }
+}
+
+TF_LITE_MICRO_TEST(Int8ModelsAreValidFlatbuffers) {
+  for (const ModelPair& pair : MODELS) {
+    flatbuffers::Verifier verifier(pair.int8_data, pair.int8_len);
+    TF_LITE_MICRO_EXPECT_TRUE(tflite::VerifyModelBuffer(verifier));
+    const tflite::SubGraph* subgraph = tflite::GetModel(pair.int8_data)->subgraphs()->Get(0);
+    TF_LITE_MICRO_EXPECT_EQ(subgraph->tensors()->Get(subgraph->inputs()->Get(0))->type(), tflite::TensorType_INT8);
+    // The weights are a quarter of the float weights
+    TF_LITE_MICRO_EXPECT_TRUE((pair.int8_len * 2 < pair.float_len));
+  }
+}
+
+TF_LITE_MICRO_TEST(FloatModelsWithOtherOptionsAreNotRead) {
+  DenseModel model;
+  TF_LITE_MICRO_EXPECT_TRUE(model.read(edited_model([](tflite::SubGraphT&) {}).data()));
+
+  // A fused activation of a layer
+  std::vector<uint8_t> fused = edited_model([](tflite::SubGraphT& subgraph) {
+    subgraph.operators[0]->builtin_options.AsFullyConnectedOptions()->fused_activation_function =
+        tflite::ActivationFunctionType_RELU;
+  });
+  TF_LITE_MICRO_EXPECT_FALSE(model.read(fused.data()));
+
+  // A softmax beta other than 1
+  std::vector<uint8_t> beta = edited_model([](tflite::SubGraphT& subgraph) {
+    subgraph.operators[3]->builtin_options.AsSoftmaxOptions()->beta = 2.0f;
+  });
+  TF_LITE_MICRO_EXPECT_FALSE(model.read(beta.data()));
+}
+
+TF_LITE_MICRO_TEST(Int8ModelsAreUpToDate) {
+  // Quantizing the float models again gives the int8 models in the sketch, byte for byte
+  for (const ModelPair& pair : MODELS) {
+    DenseModel model;
+    TF_LITE_MICRO_EXPECT_TRUE(model.read(pair.float_data));
+    std::vector<uint8_t> flatbuffer;
+    quantize_model(model, FEATURES, FEATURE_SETS, flatbuffer);
+    TF_LITE_MICRO_EXPECT_EQ(flatbuffer.size(), static_cast<size_t>(pair.int8_len));
+    TF_LITE_MICRO_EXPECT_TRUE((flatbuffer == std::vector<uint8_t>(pair.int8_data, pair.int8_data + pair.int8_len)));
+  }
+}
+
+TF_LITE_MICRO_TEST(Int8ModelsFollowTheFloatModels) {
+  for (const ModelPair& pair : MODELS) {
+    DenseModel model;
+    Int8Reference int8_model;
+    TF_LITE_MICRO_EXPECT_TRUE(model.read(pair.float_data));
+    TF_LITE_MICRO_EXPECT_TRUE(int8_model.begin(pair.int8_data));
+    for (int n = 0; n < FEATURE_SETS; n++) {
+      float expected[2];
+      float output[2];
+      model.classify(FEATURES[n], expected);
+      int8_model.classify(FEATURES[n], output);
+      TF_LITE_MICRO_EXPECT_NEAR(output[0] + output[1], 1.0f, 1e-5f);
+      TF_LITE_MICRO_EXPECT_EQ(output[1] > 0.5f, expected[1] > 0.5f);
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(Int8ModelsClassifySignalsLeftOutOfTheCalibration) {
+  // Every signal is classified by an int8 model calibrated on the other signals, so the feature
+  // scales and ranges aren't fitted to it
+  for (const ModelPair& pair : MODELS) {
+    DenseModel model;
+    TF_LITE_MICRO_EXPECT_TRUE(model.read(pair.float_data));
+    for (int n = 0; n < FEATURE_SETS; n++) {
+      const float* calibration[FEATURE_SETS - 1];
+      for (int c = 0; c < FEATURE_SETS - 1; c++) {
+        calibration[c] = FEATURES[c < n ? c : c + 1];
+      }
+      std::vector<uint8_t> flatbuffer;
+      Int8Reference int8_model;
+      quantize_model(model, calibration, FEATURE_SETS - 1, flatbuffer);
+      TF_LITE_MICRO_EXPECT_TRUE(int8_model.begin(flatbuffer.data()));
+      float expected[2];
+      float output[2];
+      model.classify(FEATURES[n], expected);
+      int8_model.classify(FEATURES[n], output);
+      TF_LITE_MICRO_EXPECT_EQ(output[1] > 0.5f, expected[1] > 0.5f);
+    }
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
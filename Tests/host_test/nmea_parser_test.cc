@@ -0,0 +1,168 @@
+/**
+  *
+  *
+  * @file:    nmea_parser_test.cc
+  * @date:    17-10-2026 07:55:32
+  *
+  * @brief    Tests of the incremental NMEA parser of the GPS driver
+  *
+**/
+
+#include <ctype.h>
+#include <math.h>
+
+#include <string>
+
+#include <Arduino.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "NMEAParser.h"
+#include "TinyGPS++.h"
+#include "nmea_sim.h"
+
+namespace {
+
+// Sentences completed by feeding the text to the parser
+int feed(NMEAParser& parser, const std::string& text) {
+  int sentences = 0;
+  for (char c : text) {
+    sentences += parser.encode(c);
+  }
+  return sentences;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(SentenceIdsAreHashedAtCompileTime) {
+  static_assert(nmeaHash("GPRMC") != nmeaHash("GNRMC"), "The hashes of the ids differ");
+  static_assert(nmeaHash("") == NMEA_HASH_BASIS, "The hash of nothing is the basis");
+  // The FNV-1a hash of "a"
+  TF_LITE_MICRO_EXPECT_EQ(0xE40C292CUL, static_cast<unsigned long>(nmeaHash("a")));
+}
+
+TF_LITE_MICRO_TEST(RmcAndGgaAreParsedToFixedPoint) {
+  NMEAParser parser;
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, nmea_sentence("GPRMC,123519.25,A,4807.038,N,01131.000,E,022.4,084.4,"
+                                                        "230394,003.1,W")));
+  TF_LITE_MICRO_EXPECT_EQ(NMEA_SENTENCE_RMC, parser.lastSentence());
+  const NMEAData& data = parser.data();
+  TF_LITE_MICRO_EXPECT_EQ(12351925, static_cast<int>(data.Time));
+  TF_LITE_MICRO_EXPECT_EQ(230394, static_cast<int>(data.Date));
+  // 48 degrees and 7.038 minutes
+  TF_LITE_MICRO_EXPECT_EQ(481173000, data.Latitude);
+  TF_LITE_MICRO_EXPECT_EQ(115166667, data.Longitude);
+  TF_LITE_MICRO_EXPECT_EQ(2240, static_cast<int>(data.Speed));
+  TF_LITE_MICRO_EXPECT_EQ(8440, static_cast<int>(data.Course));
+  TF_LITE_MICRO_EXPECT_TRUE(parser.isValid(NMEA_LOCATION | NMEA_TIME | NMEA_DATE | NMEA_SPEED | NMEA_COURSE));
+  TF_LITE_MICRO_EXPECT_TRUE(!parser.isValid(NMEA_ALTITUDE));
+
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, nmea_sentence("GNGGA,092750.000,5321.6802,S,00630.3372,W,1,8,1.03,"
+                                                        "-61.7,M,55.2,M,,")));
+  TF_LITE_MICRO_EXPECT_EQ(NMEA_SENTENCE_GGA, parser.lastSentence());
+  TF_LITE_MICRO_EXPECT_EQ(-533613367, data.Latitude);
+  TF_LITE_MICRO_EXPECT_EQ(-65056200, data.Longitude);
+  TF_LITE_MICRO_EXPECT_EQ(-6170, data.Altitude);
+  TF_LITE_MICRO_EXPECT_EQ(8, static_cast<int>(data.Satellites));
+  TF_LITE_MICRO_EXPECT_EQ(103, static_cast<int>(data.HDOP));
+  TF_LITE_MICRO_EXPECT_EQ(9275000, static_cast<int>(data.Time));
+  TF_LITE_MICRO_EXPECT_EQ(2, static_cast<int>(parser.sentencesWithFix()));
+
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, nmea_sentence("GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,"
+                                                        "13,06,292,00")));
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(data.Elevation));
+  TF_LITE_MICRO_EXPECT_EQ(111, static_cast<int>(data.Azimuth));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(parser.failedChecksum()));
+}
+
+TF_LITE_MICRO_TEST(WrongChecksumIsNotCommitted) {
+  NMEAParser parser;
+  std::string sentence = nmea_sentence("GPGGA,120000.00,5610.06764,N,01011.43309,E,1,08,0.92,45.3,M,42.9,M,,");
+  std::string corrupted = sentence;
+  corrupted[20] = '7';
+  TF_LITE_MICRO_EXPECT_EQ(0, feed(parser, corrupted));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(parser.failedChecksum()));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(parser.valid()));
+  // A cut off sentence and a sentence without checksum are never committed
+  TF_LITE_MICRO_EXPECT_EQ(0, feed(parser, sentence.substr(0, 30) + "$GPGLL,,,,,,V,N\r\n"));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(parser.valid()));
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, "noise" + sentence));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(parser.passedChecksum()));
+  TF_LITE_MICRO_EXPECT_EQ(NMEAParser::parseDegrees("5610.06764"), parser.data().Latitude);
+  // Lower case checksums are accepted
+  std::string lower = nmea_sentence("GPTXT,01,01,02,ANTSTATUS=OK");
+  for (size_t i = lower.size() - 4; i < lower.size() - 2; i++) {
+    lower[i] = tolower(lower[i]);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, lower));
+  TF_LITE_MICRO_EXPECT_EQ(NMEA_SENTENCE_OTHER, parser.lastSentence());
+}
+
+TF_LITE_MICRO_TEST(EmptyFieldsWithoutFix) {
+  NmeaWalk walk;
+  walk.seconds_without_fix = 5;
+  NMEAParser parser;
+  std::string log = simulate_nmea(5, walk);
+  TF_LITE_MICRO_EXPECT_EQ(30, feed(parser, log));
+  TF_LITE_MICRO_EXPECT_TRUE(parser.isValid(NMEA_TIME | NMEA_DATE | NMEA_SATELLITES | NMEA_HDOP));
+  TF_LITE_MICRO_EXPECT_TRUE(!parser.isValid(NMEA_LOCATION));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(parser.sentencesWithFix()));
+  TF_LITE_MICRO_EXPECT_EQ(9999, static_cast<int>(parser.data().HDOP));
+  TF_LITE_MICRO_EXPECT_EQ(12000400, static_cast<int>(parser.data().Time));
+}
+
+TF_LITE_MICRO_TEST(SameValuesAsTinyGps) {
+  NmeaWalk walk;
+  walk.seconds_without_fix = 3;
+  walk.latitude = -33.856784;
+  walk.longitude = -151.215297;
+  std::string log = simulate_nmea(120, walk);
+  NMEAParser parser;
+  TinyGPSPlus gps;
+  int ours = 0;
+  int theirs = 0;
+  int compared = 0;
+  for (char c : log) {
+    ours += parser.encode(c);
+    // TinyGPS++ completes the sentence at the CR after the checksum, one character after the parser
+    if (gps.encode(c)) {
+      theirs++;
+      TF_LITE_MICRO_EXPECT_EQ(theirs, ours);
+    }
+    if (gps.location.isUpdated() && parser.isValid(NMEA_LOCATION)) {
+      const NMEAData& data = parser.data();
+      TF_LITE_MICRO_EXPECT_NEAR(gps.location.lat(), data.Latitude * 1e-7, 1.5e-7);
+      TF_LITE_MICRO_EXPECT_NEAR(gps.location.lng(), data.Longitude * 1e-7, 1.5e-7);
+      TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(gps.time.value()), static_cast<int>(data.Time));
+      TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(gps.date.value()), static_cast<int>(data.Date));
+      TF_LITE_MICRO_EXPECT_EQ(gps.altitude.value(), data.Altitude);
+      TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(gps.speed.value()), static_cast<int>(data.Speed));
+      TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(gps.satellites.value()), static_cast<int>(data.Satellites));
+      TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(gps.hdop.value()), static_cast<int>(data.HDOP));
+      compared++;
+    }
+  }
+  TF_LITE_MICRO_EXPECT_EQ(gps.charsProcessed(), parser.charsProcessed());
+  TF_LITE_MICRO_EXPECT_EQ(gps.passedChecksum(), parser.passedChecksum());
+  TF_LITE_MICRO_EXPECT_EQ(gps.sentencesWithFix(), parser.sentencesWithFix());
+  // The location is committed by the RMC and GGA of every second with a fix
+  TF_LITE_MICRO_EXPECT_EQ(117 * 2, compared);
+  // The walk ends where the simulation says
+  double latitude, longitude;
+  nmea_walk_position(walk, 119, &latitude, &longitude);
+  TF_LITE_MICRO_EXPECT_NEAR(latitude, parser.data().Latitude * 1e-7, 2e-7);
+  TF_LITE_MICRO_EXPECT_NEAR(longitude, parser.data().Longitude * 1e-7, 2e-7);
+}
+
+TF_LITE_MICRO_TEST(OverlongFieldsAreIgnored) {
+  NMEAParser parser;
+  feed(parser, nmea_sentence("GPGGA,120000.00,5610.06764,N,01011.43309,E,1,08,0.92,45.3,M,42.9,M,,"));
+  int32_t altitude = parser.data().Altitude;
+  TF_LITE_MICRO_EXPECT_EQ(1, feed(parser, nmea_sentence("GPGGA,120001.00,5610.06764,N,01011.43309,E,1,08,0.92,"
+                                                        "99999999999999.9,M,42.9,M,,")));
+  TF_LITE_MICRO_EXPECT_EQ(altitude, parser.data().Altitude);
+  TF_LITE_MICRO_EXPECT_EQ(12000100, static_cast<int>(parser.data().Time));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,190 @@
+/**
+  *
+  *
+  * @file:    op_profiler_test.cc
+  * @date:    17-10-2026 07:48:51
+  *
+  * @brief    Tests of the per operation profiler
+  *
+**/
+
+#include <string.h>
+
+#include <string>
+
+#include <Arduino.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "op_profiler.h"
+
+namespace {
+
+int fully_connected_calls = 0;
+int softmax_calls = 0;
+
+TfLiteStatus fully_connected_invoke(TfLiteContext*, TfLiteNode*) {
+  fully_connected_calls++;
+  // Work enough for the cycle counter to move
+  delayMicroseconds(50);
+  return kTfLiteOk;
+}
+
+TfLiteStatus softmax_invoke(TfLiteContext*, TfLiteNode*) {
+  softmax_calls++;
+  return kTfLiteError;
+}
+
+// Resolves FULLY_CONNECTED and SOFTMAX, like a resolver of only the operations of the model
+class FakeResolver : public tflite::OpResolver {
+  public:
+    FakeResolver() {
+      memset(&fully_connected, 0, sizeof(fully_connected));
+      fully_connected.invoke = fully_connected_invoke;
+      fully_connected.builtin_code = tflite::BuiltinOperator_FULLY_CONNECTED;
+      fully_connected.version = 2;
+      memset(&softmax, 0, sizeof(softmax));
+      softmax.invoke = softmax_invoke;
+      softmax.builtin_code = tflite::BuiltinOperator_SOFTMAX;
+      softmax.version = 1;
+    };
+    const TfLiteRegistration* FindOp(tflite::BuiltinOperator op, int) const override {
+      if (op == tflite::BuiltinOperator_FULLY_CONNECTED) {
+        return &fully_connected;
+      }
+      if (op == tflite::BuiltinOperator_SOFTMAX) {
+        return &softmax;
+      }
+      return nullptr;
+    };
+    const TfLiteRegistration* FindOp(const char*, int) const override { return nullptr; };
+
+    TfLiteRegistration fully_connected;
+    TfLiteRegistration softmax;
+};
+
+// Keeps the reports
+class CaptureReporter : public tflite::ErrorReporter {
+  public:
+    std::string text;
+    int Report(const char* format, va_list args) override {
+      char line[128];
+      vsnprintf(line, sizeof(line), format, args);
+      text += line;
+      text += "\n";
+      return 0;
+    };
+};
+
+// Invokes the nodes of a model of three FULLY_CONNECTED and a SOFTMAX, like the interpreter
+void invoke_model(OpProfiler& profiler, const TfLiteRegistration* fully_connected,
+                  const TfLiteRegistration* softmax) {
+  profiler.begin_invoke();
+  for (int i = 0; i < 3; i++) {
+    fully_connected->invoke(nullptr, nullptr);
+  }
+  softmax->invoke(nullptr, nullptr);
+  profiler.end_invoke();
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(RegistrationsAreWrapped) {
+  FakeResolver resolver;
+  OpProfiler profiler(resolver);
+  const TfLiteRegistration* fully_connected = profiler.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  TF_LITE_MICRO_EXPECT_TRUE((fully_connected != nullptr));
+  TF_LITE_MICRO_EXPECT_TRUE((fully_connected != &resolver.fully_connected));
+  TF_LITE_MICRO_EXPECT_TRUE((fully_connected->invoke != resolver.fully_connected.invoke));
+  TF_LITE_MICRO_EXPECT_EQ(resolver.fully_connected.builtin_code, fully_connected->builtin_code);
+  TF_LITE_MICRO_EXPECT_EQ(resolver.fully_connected.version, fully_connected->version);
+  // The same operation gets the same registration
+  TF_LITE_MICRO_EXPECT_TRUE((fully_connected == profiler.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2)));
+  // Unsupported operations are still unsupported
+  TF_LITE_MICRO_EXPECT_TRUE((profiler.FindOp(tflite::BuiltinOperator_CONV_2D, 1) == nullptr));
+  TF_LITE_MICRO_EXPECT_TRUE((profiler.FindOp("custom", 1) == nullptr));
+}
+
+TF_LITE_MICRO_TEST(EveryNodeIsProfiled) {
+  FakeResolver resolver;
+  OpProfiler profiler(resolver);
+  const TfLiteRegistration* fully_connected = profiler.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  const TfLiteRegistration* softmax = profiler.FindOp(tflite::BuiltinOperator_SOFTMAX, 1);
+  fully_connected_calls = 0;
+  softmax_calls = 0;
+  for (int n = 0; n < 5; n++) {
+    invoke_model(profiler, fully_connected, softmax);
+  }
+  // The original operations are invoked
+  TF_LITE_MICRO_EXPECT_EQ(15, fully_connected_calls);
+  TF_LITE_MICRO_EXPECT_EQ(5, softmax_calls);
+
+  TF_LITE_MICRO_EXPECT_EQ(5, static_cast<int>(profiler.invokes()));
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.nodes());
+  for (int i = 0; i < 3; i++) {
+    const NodeProfile& node = profiler.node(i);
+    TF_LITE_MICRO_EXPECT_EQ(tflite::BuiltinOperator_FULLY_CONNECTED, node.op);
+    TF_LITE_MICRO_EXPECT_EQ(2, node.version);
+    TF_LITE_MICRO_EXPECT_EQ(5, static_cast<int>(node.invokes));
+    TF_LITE_MICRO_EXPECT_TRUE((node.min_cycles > 0));
+    TF_LITE_MICRO_EXPECT_TRUE((node.min_cycles <= node.max_cycles));
+    TF_LITE_MICRO_EXPECT_TRUE((node.cycles >= 5ULL * node.min_cycles));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(tflite::BuiltinOperator_SOFTMAX, profiler.node(3).op);
+  TF_LITE_MICRO_EXPECT_EQ(5, static_cast<int>(profiler.node(3).invokes));
+  uint64_t total = 0;
+  for (int i = 0; i < profiler.nodes(); i++) {
+    total += profiler.node(i).cycles;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(total, profiler.total_cycles());
+  // The FULLY_CONNECTED sleeping in the host shim take most of the model
+  TF_LITE_MICRO_EXPECT_TRUE((profiler.node(0).cycles > profiler.node(3).cycles));
+  // The status of the original operation is returned
+  TF_LITE_MICRO_EXPECT_EQ(kTfLiteError, softmax->invoke(nullptr, nullptr));
+}
+
+TF_LITE_MICRO_TEST(ResetKeepsTheRegistrations) {
+  FakeResolver resolver;
+  OpProfiler profiler(resolver);
+  const TfLiteRegistration* fully_connected = profiler.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  const TfLiteRegistration* softmax = profiler.FindOp(tflite::BuiltinOperator_SOFTMAX, 1);
+  invoke_model(profiler, fully_connected, softmax);
+  profiler.reset();
+  TF_LITE_MICRO_EXPECT_EQ(0, profiler.nodes());
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(profiler.invokes()));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(profiler.total_cycles()));
+  invoke_model(profiler, fully_connected, softmax);
+  TF_LITE_MICRO_EXPECT_EQ(4, profiler.nodes());
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(profiler.node(0).invokes));
+}
+
+TF_LITE_MICRO_TEST(ProfilersOfTwoModelsAreSeparate) {
+  FakeResolver resolver;
+  OpProfiler small(resolver);
+  OpProfiler large(resolver);
+  const TfLiteRegistration* small_fully_connected = small.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  const TfLiteRegistration* large_fully_connected = large.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  TF_LITE_MICRO_EXPECT_TRUE((small_fully_connected != large_fully_connected));
+  invoke_model(large, large_fully_connected, large.FindOp(tflite::BuiltinOperator_SOFTMAX, 1));
+  TF_LITE_MICRO_EXPECT_EQ(0, small.nodes());
+  TF_LITE_MICRO_EXPECT_EQ(4, large.nodes());
+}
+
+TF_LITE_MICRO_TEST(ReportNamesTheOperations) {
+  TF_LITE_MICRO_EXPECT_EQ(0, strcmp("FULLY_CONNECTED", OpProfiler::op_name(tflite::BuiltinOperator_FULLY_CONNECTED)));
+  TF_LITE_MICRO_EXPECT_EQ(0, strcmp("UNKNOWN", OpProfiler::op_name(-1)));
+
+  FakeResolver resolver;
+  OpProfiler profiler(resolver);
+  const TfLiteRegistration* fully_connected = profiler.FindOp(tflite::BuiltinOperator_FULLY_CONNECTED, 2);
+  const TfLiteRegistration* softmax = profiler.FindOp(tflite::BuiltinOperator_SOFTMAX, 1);
+  invoke_model(profiler, fully_connected, softmax);
+  CaptureReporter reporter;
+  profiler.report(&reporter, "fall_model_f46");
+  TF_LITE_MICRO_EXPECT_TRUE((reporter.text.find("Profile of fall_model_f46") != std::string::npos));
+  TF_LITE_MICRO_EXPECT_TRUE((reporter.text.find("  2 FULLY_CONNECTED v2") != std::string::npos));
+  TF_LITE_MICRO_EXPECT_TRUE((reporter.text.find("  3 SOFTMAX v1") != std::string::npos));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,141 @@
+/**
+  *
+  *
+  * @file:    raw_feature_test.cc
+  * @date:    17-10-2026 06:58:13
+  *
+  * @brief    Tests of the integer feature calculation on the raw IMU values
+  *
+  *   The signals of the Arduino test suite are rounded to the raw values of the
+  *   default IMU resolutions, and the features of the raw signals are compared
+  *   with the float feature calculation of the same signals.
+  *
+**/
+
+#include <math.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "../AFDS_test/anti_fall_detection_system_test/daily_features_data.h"
+#include "../AFDS_test/anti_fall_detection_system_test/fall_features_data.h"
+#include "constants.h"
+#include "feature_calculation.h"
+#include "signal_buffer.h"
+
+namespace {
+
+const float ACCEL_RES = 0.000732f;
+const float GYRO_RES = 0.07f;
+// Length of the signals in the test suite
+const int VECTOR_LEN = 300;
+
+// A signal of the test suite
+struct TestVector {
+  const float* sig[6];
+};
+
+const TestVector VECTORS[] = {
+  {{falling_acc_x_signal_nr1, falling_acc_y_signal_nr1, falling_acc_z_signal_nr1,
+    falling_gyro_x_signal_nr1, falling_gyro_y_signal_nr1, falling_gyro_z_signal_nr1}},
+  {{falling_acc_x_signal_nr2, falling_acc_y_signal_nr2, falling_acc_z_signal_nr2,
+    falling_gyro_x_signal_nr2, falling_gyro_y_signal_nr2, falling_gyro_z_signal_nr2}},
+  {{falling_acc_x_signal_nr3, falling_acc_y_signal_nr3, falling_acc_z_signal_nr3,
+    falling_gyro_x_signal_nr3, falling_gyro_y_signal_nr3, falling_gyro_z_signal_nr3}},
+  {{daily_acc_x_signal_nr1, daily_acc_y_signal_nr1, daily_acc_z_signal_nr1,
+    daily_gyro_x_signal_nr1, daily_gyro_y_signal_nr1, daily_gyro_z_signal_nr1}},
+  {{daily_acc_x_signal_nr2, daily_acc_y_signal_nr2, daily_acc_z_signal_nr2,
+    daily_gyro_x_signal_nr2, daily_gyro_y_signal_nr2, daily_gyro_z_signal_nr2}},
+  {{daily_acc_x_signal_nr3, daily_acc_y_signal_nr3, daily_acc_z_signal_nr3,
+    daily_gyro_x_signal_nr3, daily_gyro_y_signal_nr3, daily_gyro_z_signal_nr3}},
+};
+const int VECTOR_AMOUNT = sizeof(VECTORS) / sizeof(VECTORS[0]);
+
+// A test vector read by the IMU, as raw values and as the values the float calculation would get
+struct RawSignals {
+  int16_t raw[6][VECTOR_LEN];
+  float values[6][VECTOR_LEN];
+
+  explicit RawSignals(const TestVector& vector) {
+    for (int s = 0; s < 6; s++) {
+      float res = s < 3 ? ACCEL_RES : GYRO_RES;
+      for (int i = 0; i < VECTOR_LEN; i++) {
+        raw[s][i] = to_raw(vector.sig[s][i], 1.0f / res);
+        values[s][i] = raw[s][i] * res;
+      }
+    }
+  }
+
+  void raw_features(float features[]) const {
+    feature_calc(features, raw[0], raw[1], raw[2], raw[3], raw[4], raw[5], VECTOR_LEN, ACCEL_RES, GYRO_RES);
+  }
+
+  void float_features(float features[]) {
+    feature_calc(features, values[0], values[1], values[2], values[3], values[4], values[5], VECTOR_LEN);
+  }
+};
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(RawSignalsUseHalfTheMemory) {
+  // Besides the head index, the values take half the memory
+  TF_LITE_MICRO_EXPECT_EQ(sizeof(RawSignalBuffer) - sizeof(int), (sizeof(SignalBuffer) - sizeof(int)) / 2);
+}
+
+TF_LITE_MICRO_TEST(RawFeaturesMatchFloatFeatures) {
+  for (int v = 0; v < VECTOR_AMOUNT; v++) {
+    RawSignals* signals = new RawSignals(VECTORS[v]);
+    float raw[FEATURE_AMOUNT];
+    float expected[FEATURE_AMOUNT];
+    signals->raw_features(raw);
+    signals->float_features(expected);
+    // The integer sums are exact, so only the rounding of the float calculation differs
+    for (int i = 0; i < FEATURE_AMOUNT; i++) {
+      TF_LITE_MICRO_EXPECT_NEAR(raw[i], expected[i], fabsf(0.0001f * expected[i]) + 1e-5f);
+    }
+    delete signals;
+  }
+}
+
+TF_LITE_MICRO_TEST(RawRingBufferMatchesRawArrays) {
+  RawSignals* signals = new RawSignals(VECTORS[0]);
+  RawSignalBuffer sig[6];
+  // Pushed oldest first, so the buffers hold the newest SIGNAL_SIZE samples of the arrays
+  for (int i = SIGNAL_SIZE - 1; i >= 0; i--) {
+    for (int s = 0; s < 6; s++) {
+      sig[s].push(signals->raw[s][i]);
+    }
+  }
+  float from_buffers[FEATURE_AMOUNT];
+  float from_arrays[FEATURE_AMOUNT];
+  feature_calc(from_buffers, sig[0], sig[1], sig[2], sig[3], sig[4], sig[5], ACCEL_RES, GYRO_RES);
+  feature_calc(from_arrays, signals->raw[0], signals->raw[1], signals->raw[2], signals->raw[3], signals->raw[4],
+               signals->raw[5], SIGNAL_SIZE, ACCEL_RES, GYRO_RES);
+  for (int i = 0; i < FEATURE_AMOUNT; i++) {
+    TF_LITE_MICRO_EXPECT_EQ(from_buffers[i], from_arrays[i]);
+  }
+  delete signals;
+}
+
+TF_LITE_MICRO_TEST(FullScaleSignalsDontOverflow) {
+  // The wearer hits the floor hard enough to saturate every axis
+  static int16_t raw[6][SIGNAL_SIZE];
+  static float values[6][SIGNAL_SIZE];
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    for (int s = 0; s < 6; s++) {
+      raw[s][i] = (i / 3 + s) % 2 == 0 ? 32767 : -32768;
+      values[s][i] = raw[s][i] * (s < 3 ? ACCEL_RES : GYRO_RES);
+    }
+  }
+  float from_raw[FEATURE_AMOUNT];
+  float expected[FEATURE_AMOUNT];
+  feature_calc(from_raw, raw[0], raw[1], raw[2], raw[3], raw[4], raw[5], SIGNAL_SIZE, ACCEL_RES, GYRO_RES);
+  feature_calc(expected, values[0], values[1], values[2], values[3], values[4], values[5], SIGNAL_SIZE);
+  for (int i = 0; i < FEATURE_AMOUNT; i++) {
+    TF_LITE_MICRO_EXPECT_NEAR(from_raw[i], expected[i], fabsf(0.0001f * expected[i]) + 1e-5f);
+  }
+  TF_LITE_MICRO_EXPECT_NEAR(from_raw[36], sqrtf(3.0f) * 32768 * ACCEL_RES, 0.001f);
+}
+
+TF_LITE_MICRO_TESTS_END
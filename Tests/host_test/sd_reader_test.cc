@@ -0,0 +1,178 @@
+/**
+  *
+  *
+  * @file:    sd_reader_test.cc
+  * @date:    17-10-2026 08:25:28
+  *
+  * @brief    Tests of the buffered MicroSD reader, the float parser and reading the CSV signals back
+  *
+**/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SD.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "constants.h"
+#include "datalogger.h"
+#include "sd_reader.h"
+
+namespace {
+
+// Writes the text as a file on the simulated card
+void write_file(const char* name, const char* text) {
+  if (SD.exists(name)) {
+    SD.remove(name);
+  }
+  File file = SD.open(name, FILE_WRITE);
+  file.write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+  file.close();
+}
+
+bool same_float(float a, float b) {
+  return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ParseFloatMatchesStrtof) {
+  // Numbers like the ones written by the datalogger with 4 decimals
+  char text[32];
+  int different = 0;
+  for (long i = -400000; i <= 400000; i += 7) {
+    snprintf(text, sizeof(text), "%.4f", i * 0.0137);
+    different += same_float(strtof(text, nullptr), parse_float(text)) ? 0 : 1;
+  }
+  TF_LITE_MICRO_EXPECT_EQ(0, different);
+
+  const char* numbers[] = {"0", "-0.0000", "+12.5", "1e3", "1.5E-3", "-2.25e+2", "123456789.123456789",
+                           "0.000000000000000000000000000000000000012345", "3.4028234e38", "1e-45",
+                           "12345678901234567890123", ".5", "7."};
+  for (const char* number : numbers) {
+    const char* end = nullptr;
+    float value = parse_float(number, &end);
+    TF_LITE_MICRO_EXPECT_EQ(number + strlen(number), end);
+    TF_LITE_MICRO_EXPECT_NEAR(strtof(number, nullptr), value, fabsf(strtof(number, nullptr)) * 1e-7f);
+  }
+}
+
+TF_LITE_MICRO_TEST(ParseFloatOfLongFieldsMatchesStrtof) {
+  // Beyond the 9 digits, 10 decimals or the 2^24 mantissa of the fast path
+  const char* numbers[] = {"1677.7216", "1677.7217", "-99999.9999", "0.12345678901", "1234567890",
+                           "0.00000000001", "123456789", "16777216.5"};
+  for (const char* number : numbers) {
+    const char* end = nullptr;
+    TF_LITE_MICRO_EXPECT_TRUE(same_float(strtof(number, nullptr), parse_float(number, &end)));
+    TF_LITE_MICRO_EXPECT_EQ(number + strlen(number), end);
+  }
+}
+
+TF_LITE_MICRO_TEST(ParseFloatStopsAtTheEndOfTheNumber) {
+  const char* end = nullptr;
+  TF_LITE_MICRO_EXPECT_EQ(-1.25f, parse_float("-1.25,3.5", &end));
+  TF_LITE_MICRO_EXPECT_EQ(',', *end);
+  TF_LITE_MICRO_EXPECT_EQ(2.0f, parse_float("2e", &end));
+  TF_LITE_MICRO_EXPECT_EQ('e', *end);
+
+  // Not a number
+  const char* text = "ovf";
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, parse_float(text, &end));
+  TF_LITE_MICRO_EXPECT_EQ(text, end);
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, parse_float("-.", &end));
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, parse_float("", &end));
+
+  // Printed by the Arduino String
+  TF_LITE_MICRO_EXPECT_TRUE(isnan(parse_float("nan")));
+  TF_LITE_MICRO_EXPECT_TRUE((isinf(parse_float("-inf")) && parse_float("-inf") < 0));
+}
+
+TF_LITE_MICRO_TEST(BlockReaderReadsWholeSectors) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  const int SIZE = 2 * SD_BLOCK_SIZE + 100;
+  static char text[SIZE + 1];
+  for (int i = 0; i < SIZE; i++) {
+    text[i] = static_cast<char>('a' + i % 26);
+  }
+  text[SIZE] = '\0';
+  write_file("BLOCKS.txt", text);
+
+  static uint8_t block[SD_BLOCK_SIZE];
+  File file = SD.open("BLOCKS.txt", FILE_READ);
+  SdBlockReader reader(&file, block);
+  int count = 0;
+  int ch;
+  bool same = true;
+  while ((ch = reader.read()) >= 0) {
+    same = same && ch == text[count];
+    count++;
+  }
+  TF_LITE_MICRO_EXPECT_TRUE(same);
+  TF_LITE_MICRO_EXPECT_EQ(SIZE, count);
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(reader.blocks()));
+  TF_LITE_MICRO_EXPECT_EQ(-1, reader.read());
+  file.close();
+  SD.remove("BLOCKS.txt");
+}
+
+TF_LITE_MICRO_TEST(SignalValuesRoundTrip) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  static float written[6][SIGNAL_SIZE];
+  static float read[6][SIGNAL_SIZE];
+  for (int n = 0; n < SIGNAL_SIZE; n++) {
+    for (int c = 0; c < 6; c++) {
+      written[c][n] = ((n * 397 + c * 1051) % 20000 - 10000) * (c < 3 ? 0.000732f : 0.07f);
+    }
+  }
+  datalogger logger;
+  char name[] = "READTEST.csv";
+  logger.writeSignalValues(CS, name, written[0], written[1], written[2], written[3], written[4], written[5],
+                           SIGNAL_SIZE, true);
+
+  // Reading doesn't start the card again
+  unsigned long begins = SD.host_begin_count();
+  unsigned long start = millis();
+  TF_LITE_MICRO_EXPECT_EQ(SIGNAL_SIZE, logger.readSignalValues(CS, name, read[0], read[1], read[2], read[3],
+                                                               read[4], read[5]));
+  TF_LITE_MICRO_EXPECT_EQ(begins, SD.host_begin_count());
+  TF_LITE_MICRO_EXPECT_TRUE((millis() - start < 100));
+  for (int n = 0; n < SIGNAL_SIZE; n++) {
+    for (int c = 0; c < 6; c++) {
+      // Saved with 4 decimals
+      TF_LITE_MICRO_EXPECT_NEAR(written[c][n], read[c][n], 0.00005f + fabsf(written[c][n]) * 1e-6f);
+    }
+  }
+  SD.remove(name);
+
+  char missing[] = "MISSING.csv";
+  TF_LITE_MICRO_EXPECT_EQ(-1, logger.readSignalValues(CS, missing, read[0], read[1], read[2], read[3], read[4],
+                                                      read[5]));
+}
+
+TF_LITE_MICRO_TEST(SignalValuesWithLineEndingsAndLongFields) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  // CRLF line endings, an empty line, an extra column, a field longer than the buffer, no line break at the end
+  write_file("EDGES.csv",
+             "1.5,2,3,4,5,6\r\n"
+             "\r\n"
+             "-1,-2,-3,-4,-5,-6,99\n"
+             "0.123456789012345678901234,8,9,10,11,12");
+  static float read[6][4];
+  datalogger logger;
+  char name[] = "EDGES.csv";
+  TF_LITE_MICRO_EXPECT_EQ(3, logger.readSignalValues(CS, name, read[0], read[1], read[2], read[3], read[4],
+                                                     read[5]));
+  TF_LITE_MICRO_EXPECT_EQ(1.5f, read[0][0]);
+  TF_LITE_MICRO_EXPECT_EQ(6.0f, read[5][0]);
+  TF_LITE_MICRO_EXPECT_EQ(-1.0f, read[0][1]);
+  TF_LITE_MICRO_EXPECT_EQ(-6.0f, read[5][1]);
+  TF_LITE_MICRO_EXPECT_NEAR(0.1234567f, read[0][2], 1e-6f);
+  TF_LITE_MICRO_EXPECT_EQ(12.0f, read[5][2]);
+  SD.remove(name);
+}
+
+TF_LITE_MICRO_TESTS_END
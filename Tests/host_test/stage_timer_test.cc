@@ -0,0 +1,135 @@
+/**
+  *
+  *
+  * @file:    stage_timer_test.cc
+  * @date:    17-10-2026 07:43:12
+  *
+  * @brief    Tests of the stage timing and its binary dump
+  *
+**/
+
+#define STAGE_TIMING
+
+#include <string.h>
+
+#include <vector>
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "constants.h"
+#include "stage_timer.h"
+
+StageTimer stage_timer;
+
+namespace {
+
+// Keeps everything written to it, like a capture of the serial port
+class CapturePrint : public Print {
+  public:
+    std::vector<uint8_t> data;
+    size_t write(uint8_t c) override { data.push_back(c); return 1; };
+    using Print::write;
+};
+
+void measured_stage(unsigned long ms) {
+  STAGE_SCOPE(STAGE_FEATURES);
+  delay(ms);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(StatisticsOfAStage) {
+  StageTimer timer;
+  timer.record(STAGE_INVOKE, 0, 100);
+  timer.record(STAGE_INVOKE, 200, 3);
+  timer.record(STAGE_INVOKE, 400, 1000);
+  timer.record(STAGE_SD_WRITE, 500, 4000000);
+  const StageStats& invoke = timer.stats(STAGE_INVOKE);
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(invoke.count));
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(invoke.min_us));
+  TF_LITE_MICRO_EXPECT_EQ(1000, static_cast<int>(invoke.max_us));
+  TF_LITE_MICRO_EXPECT_NEAR(367.67f, invoke.mean_us(), 0.01f);
+  // 3 us is in the bin from 2 us, 100 us from 64 us and 1000 us from 512 us
+  TF_LITE_MICRO_EXPECT_EQ(1, invoke.histogram[1]);
+  TF_LITE_MICRO_EXPECT_EQ(1, invoke.histogram[6]);
+  TF_LITE_MICRO_EXPECT_EQ(1, invoke.histogram[9]);
+  // Everything from 2^19 us is in the last bin
+  TF_LITE_MICRO_EXPECT_EQ(1, timer.stats(STAGE_SD_WRITE).histogram[STAGE_HISTOGRAM_BINS - 1]);
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(timer.stats(STAGE_LOPY).count));
+}
+
+TF_LITE_MICRO_TEST(RingKeepsTheLastEvents) {
+  StageTimer timer;
+  for (int n = 0; n < 100; n++) {
+    timer.record(static_cast<Stage>(n % STAGE_COUNT), n * 10, n);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(STAGE_RING_SIZE, timer.events());
+  TF_LITE_MICRO_EXPECT_EQ(360, static_cast<int>(timer.event(0).start_us));
+  TF_LITE_MICRO_EXPECT_EQ(99, static_cast<int>(timer.event(STAGE_RING_SIZE - 1).duration_us));
+  TF_LITE_MICRO_EXPECT_EQ(99 % STAGE_COUNT, static_cast<int>(timer.event(STAGE_RING_SIZE - 1).stage));
+}
+
+TF_LITE_MICRO_TEST(MacrosMeasureWithMicros) {
+  measured_stage(5);
+  STAGE_BEGIN(STAGE_LOPY);
+  delay(250);
+  STAGE_END(STAGE_LOPY);
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(stage_timer.stats(STAGE_FEATURES).count));
+  TF_LITE_MICRO_EXPECT_TRUE((stage_timer.stats(STAGE_FEATURES).min_us >= 5000));
+  TF_LITE_MICRO_EXPECT_TRUE((stage_timer.stats(STAGE_LOPY).min_us >= 250000));
+  TF_LITE_MICRO_EXPECT_EQ(2, stage_timer.events());
+}
+
+TF_LITE_MICRO_TEST(DumpIsDecoded) {
+  StageTimer timer;
+  for (int n = 0; n < 80; n++) {
+    timer.record(static_cast<Stage>(n % STAGE_COUNT), n * 1000, 10 * n);
+  }
+  // The dump is found between the text printed on the serial port
+  CapturePrint serial;
+  serial.write("Inferens starting!\r\n");
+  size_t written = timer.dump(serial);
+  TF_LITE_MICRO_EXPECT_EQ(timer.dump_size(), written);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<size_t>(STAGE_DUMP_HEADER_SIZE + STAGE_COUNT * STAGE_DUMP_STATS_SIZE +
+                                              STAGE_RING_SIZE * STAGE_DUMP_EVENT_SIZE), written);
+  serial.write("0\r\n");
+
+  StageTimer decoded;
+  const uint8_t* dump = serial.data.data() + strlen("Inferens starting!\r\n");
+  TF_LITE_MICRO_EXPECT_TRUE(!decoded.decode(serial.data.data(), serial.data.size()));
+  TF_LITE_MICRO_EXPECT_TRUE(!decoded.decode(dump, written - 1));
+  TF_LITE_MICRO_EXPECT_TRUE(decoded.decode(dump, written));
+  for (int s = 0; s < STAGE_COUNT; s++) {
+    const StageStats& a = timer.stats(static_cast<Stage>(s));
+    const StageStats& b = decoded.stats(static_cast<Stage>(s));
+    TF_LITE_MICRO_EXPECT_EQ(a.count, b.count);
+    TF_LITE_MICRO_EXPECT_EQ(a.min_us, b.min_us);
+    TF_LITE_MICRO_EXPECT_EQ(a.max_us, b.max_us);
+    TF_LITE_MICRO_EXPECT_EQ(a.total_us, b.total_us);
+    TF_LITE_MICRO_EXPECT_EQ(0, memcmp(a.histogram, b.histogram, sizeof(a.histogram)));
+  }
+  TF_LITE_MICRO_EXPECT_EQ(timer.events(), decoded.events());
+  for (int i = 0; i < timer.events(); i++) {
+    TF_LITE_MICRO_EXPECT_EQ(timer.event(i).start_us, decoded.event(i).start_us);
+    TF_LITE_MICRO_EXPECT_EQ(timer.event(i).duration_us, decoded.event(i).duration_us);
+    TF_LITE_MICRO_EXPECT_EQ(timer.event(i).stage, decoded.event(i).stage);
+  }
+
+  // Saved on the simulated MicroSD card
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  TF_LITE_MICRO_EXPECT_TRUE(timer.save(STAGE_DUMP_NAME));
+  File file = SD.open(STAGE_DUMP_NAME);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<uint32_t>(written), file.size());
+  std::vector<uint8_t> saved(file.size());
+  file.read(saved.data(), saved.size());
+  file.close();
+  TF_LITE_MICRO_EXPECT_EQ(0, memcmp(saved.data() + STAGE_DUMP_HEADER_SIZE, dump + STAGE_DUMP_HEADER_SIZE,
+                                    written - STAGE_DUMP_HEADER_SIZE));
+  SD.remove(STAGE_DUMP_NAME);
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,138 @@
+/**
+  *
+  *
+  * @file:    tensor_arena_test.cc
+  * @date:    17-10-2026 07:07:41
+  *
+  * @brief    Tests of the measurement of the used tensor arena, and of the arena sizes of the models
+  *
+  *   The arena is used the way the MicroAllocator does, by a fake interpreter
+  *   with its tensor data at the start of the arena. The arena sizes are
+  *   checked against the arena planned for each model by arena_plan.
+  *
+**/
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "tensorflow/lite/c/c_api_internal.h"
+#include "tensor_arena.h"
+#include "arena_plan.h"
+#include "fall_model_f46.h"
+#include "fall_model_f46_2.h"
+#include "fall_model_f46_3.h"
+#include "fall_model_f46_int8.h"
+#include "fall_model_f46_2_int8.h"
+#include "fall_model_f46_3_int8.h"
+
+namespace {
+
+const size_t ARENA_SIZE = 4096;
+uint8_t arena[ARENA_SIZE];
+
+// The tensors the interpreter of the sketch is asked about
+struct FakeInterpreter {
+  TfLiteTensor tensors[3];
+
+  size_t tensors_size() const {
+    return 3;
+  }
+  TfLiteTensor* tensor(size_t index) {
+    return &tensors[index];
+  }
+};
+
+// Input and output in the arena, and a constant tensor in the model
+void setup_tensors(FakeInterpreter& interpreter, const uint8_t* model) {
+  interpreter.tensors[0].data.raw = reinterpret_cast<char*>(arena);
+  interpreter.tensors[0].bytes = 184;
+  interpreter.tensors[1].data.raw = reinterpret_cast<char*>(arena + 192);
+  interpreter.tensors[1].bytes = 132;
+  interpreter.tensors[2].data.raw = const_cast<char*>(reinterpret_cast<const char*>(model));
+  interpreter.tensors[2].bytes = 6072;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(TensorDataOnlyCountsTensorsInTheArena) {
+  static uint8_t model[6072];
+  FakeInterpreter interpreter;
+  setup_tensors(interpreter, model);
+  TF_LITE_MICRO_EXPECT_EQ(arena_tensor_data(interpreter, arena, ARENA_SIZE), static_cast<size_t>(192 + 132));
+}
+
+TF_LITE_MICRO_TEST(UsedArenaIsSplitInItsParts) {
+  paint_arena(arena, ARENA_SIZE);
+  // The planner scratch reaches beyond the tensor data, and the persistent structures fill the end
+  memset(arena, 0x11, 400);
+  memset(arena + ARENA_SIZE - 1000, 0x22, 1000);
+  ArenaUsage usage = measure_arena(arena, ARENA_SIZE, 324);
+  TF_LITE_MICRO_EXPECT_EQ(usage.tensor_data, static_cast<size_t>(324));
+  TF_LITE_MICRO_EXPECT_EQ(usage.scratch, static_cast<size_t>(76));
+  TF_LITE_MICRO_EXPECT_EQ(usage.persistent, static_cast<size_t>(1000));
+  TF_LITE_MICRO_EXPECT_EQ(usage.total(), static_cast<size_t>(1400));
+}
+
+TF_LITE_MICRO_TEST(PaintedValuesInTheUsedPartsAreCounted) {
+  paint_arena(arena, ARENA_SIZE);
+  // Tensor data ending with the paint pattern, and paint pattern bytes inside the persistent structures
+  memset(arena, 0x11, 300);
+  memset(arena + ARENA_SIZE - 1000, 0x22, 1000);
+  arena[ARENA_SIZE - 500] = ARENA_PAINT;
+  arena[ARENA_SIZE - 499] = ARENA_PAINT;
+  ArenaUsage usage = measure_arena(arena, ARENA_SIZE, 324);
+  TF_LITE_MICRO_EXPECT_EQ(usage.tensor_data, static_cast<size_t>(324));
+  TF_LITE_MICRO_EXPECT_EQ(usage.scratch, static_cast<size_t>(0));
+  TF_LITE_MICRO_EXPECT_EQ(usage.persistent, static_cast<size_t>(1000));
+}
+
+TF_LITE_MICRO_TEST(FullArenaIsAllUsed) {
+  memset(arena, 0x33, ARENA_SIZE);
+  ArenaUsage usage = measure_arena(arena, ARENA_SIZE, 324);
+  TF_LITE_MICRO_EXPECT_EQ(usage.total(), ARENA_SIZE);
+}
+
+TF_LITE_MICRO_TEST(FloatModelArenaIsPlannedLikeTheAllocator) {
+  // 9 runtime tensors of 56 bytes with their dims, the 16 byte aligned input, hidden, activation,
+  // logits and output buffers, and the TensorInfo and planner scratch of AllocateTensors()
+  ArenaUsage planned;
+  TF_LITE_MICRO_EXPECT_TRUE(plan_arena(fall_model_data, false, planned));
+  TF_LITE_MICRO_EXPECT_EQ(planned.persistent, static_cast<size_t>(9 * 56 + 100));
+  TF_LITE_MICRO_EXPECT_EQ(planned.tensor_data, static_cast<size_t>(192 + 144));
+  TF_LITE_MICRO_EXPECT_EQ(planned.scratch, static_cast<size_t>(9 * 20 + 5 * 36 - 336));
+
+  // The preallocated input of the cascade isn't planned
+  TF_LITE_MICRO_EXPECT_TRUE(plan_arena(fall_model_data, true, planned));
+  TF_LITE_MICRO_EXPECT_EQ(planned.tensor_data, static_cast<size_t>(144 + 144));
+}
+
+TF_LITE_MICRO_TEST(ModelArenasHoldTheirPlannedArena) {
+  TF_LITE_MICRO_EXPECT_TRUE((TENSOR_ARENA_SIZE == FALL_MODEL_ARENA_SIZE));
+  const unsigned char* models[] = {fall_model_data, fall_model_2_data, fall_model_3_data,
+                                   fall_model_int8_data, fall_model_2_int8_data, fall_model_3_int8_data};
+  const int sizes[] = {FALL_MODEL_ARENA_SIZE, FALL_MODEL_2_ARENA_SIZE, FALL_MODEL_3_ARENA_SIZE,
+                       FALL_MODEL_INT8_ARENA_SIZE, FALL_MODEL_2_INT8_ARENA_SIZE, FALL_MODEL_3_INT8_ARENA_SIZE};
+  for (int i = 0; i < 6; i++) {
+    ArenaUsage planned;
+    TF_LITE_MICRO_EXPECT_TRUE(plan_arena(models[i], false, planned));
+    // Room for an unaligned arena, and no more than the rounding to 16 bytes beyond it
+    size_t size = static_cast<size_t>(sizes[i]);
+    TF_LITE_MICRO_EXPECT_TRUE((size % 16 == 0 && size >= planned.total() + 15 && size < planned.total() + 31));
+  }
+}
+
+TF_LITE_MICRO_TEST(CascadeModelsFitInTheirPartOfTheArena) {
+  // The small model, with the features as its preallocated input, at the start of the arena
+  ArenaUsage small;
+  TF_LITE_MICRO_EXPECT_TRUE(plan_arena(fall_model_data, true, small));
+  TF_LITE_MICRO_EXPECT_TRUE((small.total() + 15 <= static_cast<size_t>(FALL_MODEL_ARENA_SIZE)));
+
+  // The large model, also with the features as its input, in the rest
+  ArenaUsage large;
+  TF_LITE_MICRO_EXPECT_TRUE(plan_arena(fall_model_2_data, true, large));
+  TF_LITE_MICRO_EXPECT_TRUE((large.total() <= static_cast<size_t>(CASCADE_ARENA_SIZE - FALL_MODEL_ARENA_SIZE)));
+  TF_LITE_MICRO_EXPECT_TRUE((CASCADE_ARENA_SIZE <= ARENA_BUDGET));
+}
+
+TF_LITE_MICRO_TESTS_END
@@ -0,0 +1,158 @@
+/**
+  *
+  *
+  * @file:    trace_replay_test.cc
+  * @date:    17-10-2026 06:43:52
+  *
+  * @brief    Tests of the trace replay driving the controller of the sketch
+  *
+  *   The model is replaced by a classifier with a fixed answer, so the tests
+  *   don't need the TensorFlow Lite sources.
+  *
+**/
+
+#include <math.h>
+
+#include <vector>
+
+#include <SD.h>
+
+#include "tensorflow/lite/experimental/micro/micro_error_reporter.h"
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "constants.h"
+#include "feature_calculation.h"
+#include "trace_replay.h"
+
+namespace {
+
+// Samples of the wearer at rest, with a single sample exceeding the threshold at spike
+std::vector<TraceSample> make_trace(int length, int spike) {
+  std::vector<TraceSample> samples;
+  for (int n = 0; n < length; n++) {
+    float wobble = 0.01f * sinf(0.3f * n);
+    TraceSample sample = {0.02f + wobble, -0.01f, 1.0f + wobble, 1.5f * n / length, -2.0f, 0.5f + wobble};
+    if (n == spike) {
+      sample.az = 3.0f;
+      sample.gx = 250.0f;
+    }
+    samples.push_back(sample);
+  }
+  return samples;
+}
+
+// Rounds a value to the default IMU resolution, like the samples read by the controller
+float quantize(float value, float resolution) {
+  return roundf(value / resolution) * resolution;
+}
+
+// Features of the signal ending at the sample last, calculated the way it's done before the streaming extractor
+void reference_features(const std::vector<TraceSample>& samples, int last, float features[]) {
+  const float accel_res = 0.000732f;
+  const float gyro_res = 0.07f;
+  float sig[6][SIGNAL_SIZE];
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    const TraceSample& sample = samples[last - i];
+    sig[0][i] = -quantize(sample.ax, accel_res);
+    sig[1][i] = quantize(sample.ay, accel_res);
+    sig[2][i] = quantize(sample.az, accel_res);
+    sig[3][i] = -quantize(sample.gx, gyro_res);
+    sig[4][i] = quantize(sample.gy, gyro_res);
+    sig[5][i] = quantize(sample.gz, gyro_res);
+  }
+  feature_calc(features, sig[0], sig[1], sig[2], sig[3], sig[4], sig[5], SIGNAL_SIZE);
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ReplayTriggersAfterHalfASignal) {
+  std::vector<TraceSample> samples = make_trace(400, 200);
+  std::vector<std::vector<float> > seen_features;
+  TraceReplay replay([&seen_features](const float features[FEATURE_AMOUNT], float output[2]) {
+    seen_features.push_back(std::vector<float>(features, features + FEATURE_AMOUNT));
+    output[0] = 0.8f;
+    output[1] = 0.2f;
+    return true;
+  });
+
+  ReplayReport report = replay.run(samples);
+  TF_LITE_MICRO_EXPECT_EQ(report.samples, 400l);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(report.decisions.size()), 1);
+  TF_LITE_MICRO_EXPECT_EQ(report.falls(), 0);
+  TF_LITE_MICRO_EXPECT_EQ(report.decisions[0].trigger_sample, 200l);
+  TF_LITE_MICRO_EXPECT_EQ(report.decisions[0].decision_sample, 200l + SIGNAL_SIZE / 2);
+  TF_LITE_MICRO_EXPECT_EQ(report.decisions[0].prediction, 0);
+  TF_LITE_MICRO_EXPECT_NEAR(report.decisions[0].fall_probability, 0.2f, 1e-6f);
+  TF_LITE_MICRO_EXPECT_GT(report.samples_per_second(), 0.0);
+
+  // The model gets the same features as the array feature calculation of the signal read by the IMU
+  float expected[FEATURE_AMOUNT];
+  reference_features(samples, report.decisions[0].decision_sample, expected);
+  for (int i = 0; i < FEATURE_AMOUNT; i++) {
+    TF_LITE_MICRO_EXPECT_NEAR(seen_features[0][i], expected[i], fabsf(0.0001f * expected[i]) + 1e-6f);
+  }
+}
+
+TF_LITE_MICRO_TEST(ReplayOfSignalWithoutThresholdHasNoDecisions) {
+  std::vector<TraceSample> samples = make_trace(1000, -1);
+  int calls = 0;
+  TraceReplay replay([&calls](const float features[FEATURE_AMOUNT], float output[2]) {
+    calls++;
+    return true;
+  });
+  ReplayReport report = replay.run(samples);
+  TF_LITE_MICRO_EXPECT_EQ(calls, 0);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(report.decisions.size()), 0);
+}
+
+TF_LITE_MICRO_TEST(ReplayedFallIsSavedAndCanBeReplayedAgain) {
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  SD.remove("FALL01.afl");
+
+  // Two spikes, where the first is a fall. After a fall the signal is collected from the start again.
+  std::vector<TraceSample> samples = make_trace(600, 150);
+  samples[400].az = 3.0f;
+  TraceReplay replay([](const float features[FEATURE_AMOUNT], float output[2]) {
+    output[0] = 0.3f;
+    output[1] = 0.7f;
+    return true;
+  });
+  ReplayReport report = replay.run(samples);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(report.decisions.size()), 2);
+  TF_LITE_MICRO_EXPECT_EQ(report.falls(), 2);
+  TF_LITE_MICRO_EXPECT_EQ(report.decisions[0].trigger_sample, 150l);
+  TF_LITE_MICRO_EXPECT_EQ(report.decisions[1].trigger_sample, 400l);
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL01.afl"));
+  TF_LITE_MICRO_EXPECT_TRUE(SD.exists("FALL02.afl"));
+
+  // The saved fall log is the signal ending at the decision, in the order it was recorded,
+  // rounded to the default IMU resolution
+  std::vector<TraceSample> fall_signal;
+  TF_LITE_MICRO_EXPECT_TRUE(load_trace(SD.host_path("FALL01.afl").c_str(), false, fall_signal));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(fall_signal.size()), SIGNAL_SIZE);
+  int first = report.decisions[0].decision_sample - SIGNAL_SIZE + 1;
+  for (int i = 0; i < SIGNAL_SIZE; i++) {
+    TF_LITE_MICRO_EXPECT_NEAR(fall_signal[i].ax, samples[first + i].ax, 0.000732f / 2 + 1e-6f);
+    TF_LITE_MICRO_EXPECT_NEAR(fall_signal[i].az, samples[first + i].az, 0.000732f / 2 + 1e-6f);
+    TF_LITE_MICRO_EXPECT_NEAR(fall_signal[i].gx, samples[first + i].gx, 0.07f / 2 + 1e-5f);
+  }
+}
+
+TF_LITE_MICRO_TEST(BinaryTraceRoundTrip) {
+  std::vector<TraceSample> samples = make_trace(300, 100);
+  std::string path = SD.host_path("trace.bin");
+  TF_LITE_MICRO_EXPECT_TRUE(save_trace_binary(path.c_str(), samples));
+
+  std::vector<TraceSample> loaded;
+  TF_LITE_MICRO_EXPECT_TRUE(load_trace(path.c_str(), false, loaded));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(loaded.size()), 300);
+  TF_LITE_MICRO_EXPECT_EQ(memcmp(loaded.data(), samples.data(), samples.size() * sizeof(TraceSample)), 0);
+
+  // A fall log isn't a binary trace
+  std::vector<TraceSample> not_binary;
+  TF_LITE_MICRO_EXPECT_TRUE(!load_trace_binary(SD.host_path("FALL01.afl").c_str(), not_binary));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(not_binary.size()), 0);
+}
+
+TF_LITE_MICRO_TESTS_END
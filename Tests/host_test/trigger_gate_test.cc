@@ -0,0 +1,191 @@
+/**
+  *
+  *
+  * @file:    trigger_gate_test.cc
+  * @date:    17-10-2026 07:39:47
+  *
+  * @brief    Tests of the adaptive trigger gate
+  *
+**/
+
+#include <string.h>
+
+#include <memory>
+
+#include <Arduino.h>
+#include <SD.h>
+
+#include "tensorflow/lite/experimental/micro/testing/micro_test.h"
+#include "afds_controller.h"
+#include "constants.h"
+#include "trigger_gate.h"
+
+namespace {
+
+const float ACCEL_RES = 0.000732f;
+
+// Learn GATE_WARMUP samples of 1 g, and a spike of two samples every period samples
+void learn_wearer(TriggerGate& gate, unsigned long length, int period, float spike) {
+  for (unsigned long n = 0; n < length; n++) {
+    gate.update(n % period < 2 ? spike : 1.0f);
+  }
+}
+
+// Runs a walking wearer through the controller, with a spike of two samples every 40 samples.
+// Returns the amount of signals ready for inference.
+int walk(afdsdCtrl1& ctrl, int samples) {
+  const float not_fall[2] = {0.9f, 0.1f};
+  int16_t g = static_cast<int16_t>(1.0f / ACCEL_RES);
+  int16_t spike = static_cast<int16_t>(1.7f / ACCEL_RES);
+  int signals = 0;
+  for (int n = 0; n < samples; n++) {
+    int16_t az = n % 40 < 2 ? spike : g;
+    if (ctrl.process_raw_sample(0, 0, az, 0, 0, 0)) {
+      ctrl.feature_calculation();
+      float output[2] = {not_fall[0], not_fall[1]};
+      ctrl.predict_fall(output);
+      signals++;
+    }
+  }
+  return signals;
+}
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(QuantilesOfTheLearnedMagnitudes) {
+  TriggerGate gate;
+  TF_LITE_MICRO_EXPECT_EQ(0.0f, gate.quantile(0.5f));
+  // Magnitudes evenly spread from 0 to 2 g
+  for (int n = 0; n < 2000; n++) {
+    gate.update(n * 0.001f);
+  }
+  TF_LITE_MICRO_EXPECT_EQ(2000, static_cast<int>(gate.learned()));
+  TF_LITE_MICRO_EXPECT_NEAR(0.5f, gate.quantile(0.25f), 0.01f);
+  TF_LITE_MICRO_EXPECT_NEAR(1.0f, gate.quantile(0.5f), 0.01f);
+  TF_LITE_MICRO_EXPECT_NEAR(1.98f, gate.quantile(0.99f), 0.01f);
+}
+
+TF_LITE_MICRO_TEST(HistoryIsHalved) {
+  TriggerGate gate;
+  learn_wearer(gate, GATE_HISTORY - 1, 1000, 1.0f);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(GATE_HISTORY - 1), static_cast<int>(gate.learned()));
+  gate.update(1.0f);
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(GATE_HISTORY / 2), static_cast<int>(gate.learned()));
+  TF_LITE_MICRO_EXPECT_EQ(static_cast<int>(GATE_HISTORY), static_cast<int>(gate.samples));
+}
+
+TF_LITE_MICRO_TEST(LevelIsBetweenThresholdAndMaxLevel) {
+  TriggerGate gate;
+  TF_LITE_MICRO_EXPECT_EQ(THRESHOLD, gate.level());
+  // A resting wearer keeps the fixed threshold
+  learn_wearer(gate, 2 * GATE_WARMUP, 1000, 1.0f);
+  TF_LITE_MICRO_EXPECT_EQ(THRESHOLD, gate.level());
+
+  // 5 % of the samples of an active wearer are at 1.7 g, which moves the gate just above them
+  gate.reset();
+  learn_wearer(gate, GATE_WARMUP - 1, 40, 1.7f);
+  TF_LITE_MICRO_EXPECT_EQ(THRESHOLD, gate.level());
+  learn_wearer(gate, 1, 40, 1.0f);
+  TF_LITE_MICRO_EXPECT_NEAR(1.7f + GATE_MARGIN, gate.level(), GATE_BIN_WIDTH);
+
+  // Never above GATE_MAX_LEVEL
+  gate.reset();
+  learn_wearer(gate, 2 * GATE_WARMUP, 40, 3.5f);
+  TF_LITE_MICRO_EXPECT_EQ(GATE_MAX_LEVEL, gate.level());
+}
+
+TF_LITE_MICRO_TEST(MinimumDurationAndHysteresis) {
+  TriggerGate gate;
+  // A single sample above the level doesn't open the gate
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.0f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(gate.triggers));
+
+  // Closed until the magnitude is GATE_HYSTERESIS below the level
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(THRESHOLD - GATE_HYSTERESIS / 2));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.0f));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.8f));
+  TF_LITE_MICRO_EXPECT_TRUE(gate.update(1.8f));
+
+  // A hard impact opens the gate with a single sample
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.update(1.0f));
+  TF_LITE_MICRO_EXPECT_TRUE(gate.update(GATE_MAX_LEVEL + 0.5f));
+  TF_LITE_MICRO_EXPECT_EQ(3, static_cast<int>(gate.triggers));
+}
+
+TF_LITE_MICRO_TEST(GateIsSavedAndLoaded) {
+  TriggerGate gate;
+  learn_wearer(gate, 2 * GATE_WARMUP, 40, 1.7f);
+  gate.inferences = 7;
+  gate.alarms = 2;
+  uint8_t data[GATE_FILE_SIZE];
+  TF_LITE_MICRO_EXPECT_EQ(GATE_FILE_SIZE, gate.encode(data));
+  TF_LITE_MICRO_EXPECT_EQ(0, memcmp(data, "AFDG", 4));
+
+  std::unique_ptr<TriggerGate> restored(new TriggerGate());
+  TF_LITE_MICRO_EXPECT_TRUE(restored->decode(data, sizeof(data)));
+  TF_LITE_MICRO_EXPECT_EQ(gate.level(), restored->level());
+  TF_LITE_MICRO_EXPECT_EQ(gate.learned(), restored->learned());
+  TF_LITE_MICRO_EXPECT_EQ(gate.samples, restored->samples);
+  TF_LITE_MICRO_EXPECT_EQ(gate.triggers, restored->triggers);
+  TF_LITE_MICRO_EXPECT_EQ(7, static_cast<int>(restored->inferences));
+  TF_LITE_MICRO_EXPECT_EQ(2, static_cast<int>(restored->alarms));
+
+  // A damaged or short file leaves the gate unchanged
+  TriggerGate fresh;
+  data[28] ^= 1;
+  TF_LITE_MICRO_EXPECT_TRUE(!fresh.decode(data, sizeof(data)));
+  data[28] ^= 1;
+  TF_LITE_MICRO_EXPECT_TRUE(!fresh.decode(data, sizeof(data) - 1));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(fresh.learned()));
+
+  // Saved on the simulated MicroSD card
+  TF_LITE_MICRO_EXPECT_TRUE(SD.begin(CS));
+  learn_wearer(gate, GATE_SAVE_INTERVAL, 40, 1.7f);
+  TF_LITE_MICRO_EXPECT_TRUE(gate.save_due());
+  TF_LITE_MICRO_EXPECT_TRUE(gate.save(GATE_FILE_NAME));
+  TF_LITE_MICRO_EXPECT_TRUE(!gate.save_due());
+  TF_LITE_MICRO_EXPECT_TRUE(fresh.load(GATE_FILE_NAME));
+  TF_LITE_MICRO_EXPECT_EQ(gate.level(), fresh.level());
+  TF_LITE_MICRO_EXPECT_EQ(gate.samples, fresh.samples);
+  SD.remove(GATE_FILE_NAME);
+  TF_LITE_MICRO_EXPECT_TRUE(!fresh.load(GATE_FILE_NAME));
+}
+
+TF_LITE_MICRO_TEST(GateCutsTheInferencesOfAnActiveWearer) {
+  Serial.host_set_echo(nullptr);
+  std::unique_ptr<afdsdCtrl1> fixed(new afdsdCtrl1());
+  fixed->log_info.accel_resolution = ACCEL_RES;
+  int fixed_signals = walk(*fixed, 20000);
+
+  std::unique_ptr<afdsdCtrl1> gated(new afdsdCtrl1());
+  std::unique_ptr<TriggerGate> gate(new TriggerGate());
+  gated->log_info.accel_resolution = ACCEL_RES;
+  gated->gate = gate.get();
+  int gated_signals = walk(*gated, 20000);
+
+  // Every other spike exceeds the fixed threshold, as a signal is recorded for 60 samples after it
+  TF_LITE_MICRO_EXPECT_TRUE((fixed_signals > 200));
+  // The gate only opens while it learns the wearer
+  TF_LITE_MICRO_EXPECT_TRUE((gated_signals < fixed_signals / 3));
+  TF_LITE_MICRO_EXPECT_EQ(gated_signals, static_cast<int>(gate->triggers));
+  TF_LITE_MICRO_EXPECT_EQ(gated_signals, static_cast<int>(gate->inferences));
+  TF_LITE_MICRO_EXPECT_EQ(0, static_cast<int>(gate->alarms));
+  TF_LITE_MICRO_EXPECT_TRUE((gate->level() > 1.7f));
+
+  // A predicted fall is counted as an alarm
+  float fall[2] = {0.1f, 0.9f};
+  gated->predict_fall(fall);
+  TF_LITE_MICRO_EXPECT_EQ(1, static_cast<int>(gate->alarms));
+  Serial.host_set_echo(stdout);
+}
+
+TF_LITE_MICRO_TESTS_END
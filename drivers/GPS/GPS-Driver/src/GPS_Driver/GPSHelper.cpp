@@ -18,12 +18,43 @@
 
 int GPSBaud = 9600;
 
-//  Creating an instance of the GPS object
-TinyGPSPlus gps;
+//  Creating an instance of the GPS service on the second hardware serial port
+GPSService gpsService(Serial1);
+
+//  Fix shown by PrintGPSData(), and if the missing GPS has been reported
+static uint32_t printedFixMillis = 0;
+static bool reportedNoGPS = false;
+
+//  Converting the cached fix and the satellite details of the parser to the parcel
+static GPSPackage toPackage(const GPSFix &fix, const NMEAData &data){
+  GPSPackage parcel;
+  parcel.Latitude   = fix.Latitude * 1e-7;
+  parcel.Longitude  = fix.Longitude * 1e-7;
+  parcel.Elevation  = data.Elevation;
+  parcel.Altitude   = fix.Altitude / 100.0;
+  parcel.Sattelites = fix.Satellites;
+  parcel.Azimuth    = data.Azimuth;
+  parcel.DateYear   = 2000 + fix.Date % 100;    //  ddmmyy
+  parcel.DateMonth  = fix.Date / 100 % 100;
+  parcel.DateDay    = fix.Date / 10000;
+  parcel.TimeHour   = fix.Time / 1000000;       //  hhmmsscc
+  parcel.TimeMinute = fix.Time / 10000 % 100;
+  parcel.TimeSecond = fix.Time / 100 % 100;
+  return parcel;
+}
 
 void InitGPS(){
   // Start the secondary hardware serial port at the GPS's default baud rate
-  Serial1.begin(GPSBaud);
+  gpsService.begin(GPSBaud);
+}
+
+void PollGPS(){
+  gpsService.poll();
+  //  Instead of halting, the missing GPS is reported once and the fix stays invalid
+  if (!reportedNoGPS && gpsService.status() == GPS_NOT_DETECTED){
+    Serial.println("No GPS detected - check wireing and restart.");
+    reportedNoGPS = true;
+  }
 }
 
 //  simple function to print out the GPS dataa directly to the serial port
@@ -31,7 +62,7 @@ void displayInfo() {
   GPSPackage parcel;
   parcel = ReadGPSData();
 
-  if (gps.location.isValid()) {
+  if (gpsService.lastFix().Valid) {
     Serial.print("# Sattelites in view: ");
     Serial.println(parcel.Sattelites);
     Serial.print("Latitude: ");
@@ -50,7 +81,7 @@ void displayInfo() {
   }
 
   Serial.print("Date(dd/mm/yyyy): ");
-  if (gps.date.isValid()) {
+  if (gpsService.parser().isValid(NMEA_DATE)) {
     Serial.print(parcel.DateDay);
     Serial.print("/");
     Serial.print(parcel.DateMonth);
@@ -62,7 +93,7 @@ void displayInfo() {
   }
 
   Serial.print("Time: ");
-  if (gps.time.isValid()) {
+  if (gpsService.parser().isValid(NMEA_TIME)) {
     if (parcel.TimeHour < 10) Serial.print(F("0"));
     Serial.print(parcel.TimeHour);
     Serial.print(":");
@@ -78,58 +109,28 @@ void displayInfo() {
 
   Serial.println();
   Serial.println();
-  delay(1000);
 }
 
 bool isDataReady(){
-  return Serial1.available();
+  return gpsService.lastFix().Valid;
 }
 
 GPSPackage ReadGPSData(){
-  GPSPackage parcel;
-  while (Serial1.available() > 0){
-    //  Reading the data from the serial port and saving it in the parcel object.
-    if (gps.encode(Serial1.read())){
-      parcel.Latitude   = gps.location.lat();
-      parcel.Longitude  = gps.location.lng();
-      parcel.Elevation  = gps.details.Elevation();
-      parcel.Altitude   = gps.altitude.meters();
-      parcel.Sattelites = gps.satellites.value();
-      parcel.Azimuth    = gps.details.Azimuth();
-      parcel.DateYear   = gps.date.year();
-      parcel.DateMonth  = gps.date.month();
-      parcel.DateDay    = gps.date.day();
-      parcel.TimeHour   = gps.time.hour();
-      parcel.TimeMinute = gps.time.minute();
-      parcel.TimeSecond = gps.time.second();
-      return parcel;
-    }
-  }
-  //  Timeout functionality. If 5000 milliseconds pass and there are no characters
-  //  coming from the serial port, show a "No GPS detected" error and "Halt"
-  if (millis() > 5000 && gps.charsProcessed() < 10)
-  {
-    Serial.println("No GPS detected - check wireing and restart.");
-    while(true);
-  }
-  //  Returning empty parcel - You should not reach this point unless you forget
-  //  to check if theres available data before calling this function.
-  return parcel;
+  //  The last known good fix is returned at once, the GPS is never waited for.
+  return toPackage(gpsService.lastFix(), gpsService.parser().data());
 }
 
+uint32_t GPSFixAge(){
+  return gpsService.fixAge();
+}
 
-void PrintGPSData(){
 
-  // This displays information every time a new sentence is correctly encoded.
-  while (Serial1.available() > 0)
-    if (gps.encode(Serial1.read()))
-      displayInfo();
+void PrintGPSData(){
+  PollGPS();
 
-  //  Timeout functionality. If 5000 milliseconds pass and there are no characters
-  //  coming from the serial port, show a "No GPS detected" error and "Halt"
-  if (millis() > 5000 && gps.charsProcessed() < 10)
-  {
-    Serial.println("No GPS detected - check wireing and restart.");
-    while(true);
+  // This displays information every time a new fix is received.
+  if (gpsService.lastFix().Valid && gpsService.lastFix().FixMillis != printedFixMillis){
+    printedFixMillis = gpsService.lastFix().FixMillis;
+    displayInfo();
   }
 }
@@ -11,29 +11,8 @@
  *	Major change #1:
  */
 
-#include "TinyGPS++.h"
-
-
-/**
- * @brief Struct containing all the data needed from GPS
- *
- * @param None.
- * @return n/a
- */
-struct GPSPackage{
-  double    Latitude;     // 4 byte
-  double    Longitude;    // 4 byte
-  double    Altitude;     // 4 byte
-  uint16_t  Elevation;    // 2 byte
-  uint16_t  Azimuth;      // 2 byte
-  uint8_t   Sattelites;   // 1 byte - There are 24 sattelites in orbit, of those a theoretical max of 14 is ever visible at any given time, thus we only need one byte.
-  uint16_t  DateYear;     // 2 Byte
-  uint8_t   DateMonth;    // 1 Byte
-  uint8_t   DateDay;      // 1 Byte
-  uint8_t   TimeHour;     // 1 Byte
-  uint8_t   TimeMinute;   // 1 Byte
-  uint8_t   TimeSecond;   // 1 Byte
-};
+#include "GPSPacket.h"
+#include "GPSService.h"
 
 
 /**
@@ -47,16 +26,36 @@ struct GPSPackage{
 */
 void InitGPS();
 
+/**
+* @brief Parses the characters received from the GPS, never blocking.
+*
+*  Call this every loop, so the last known good fix is kept up to date.
+*  A missing GPS is reported once on the serial port, instead of halting.
+*
+* @param None.
+* @return void
+*/
+void PollGPS();
+
 /**
 * @brief Function to do a Readout from the GPS.
 *
-* Do a check with isDataReady() to make sure data is ready before using.
+* Returns the last known good fix in O(1), without waiting for the GPS.
+* Do a check with isDataReady() to make sure there has been a fix before using.
 *
 * @param None.
 * @return GPSPackage
 */
 GPSPackage ReadGPSData();
 
+/**
+* @brief Age of the fix returned by ReadGPSData().
+*
+* @param None.
+* @return uint32_t milliseconds, UINT32_MAX if there hasn't been a fix
+*/
+uint32_t GPSFixAge();
+
 /**
 * @brief Function to do a printout to Serial Port of the collected GPS data.
 *
@@ -68,7 +67,7 @@ GPSPackage ReadGPSData();
 void PrintGPSData();
 
 /**
-* @brief Very simple function to check if data is ready from GPS.
+* @brief Very simple function to check if there has been a fix from the GPS.
 * @param None.
 * @return Bool
 */
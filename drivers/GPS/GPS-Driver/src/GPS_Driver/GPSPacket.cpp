@@ -0,0 +1,139 @@
+/*! \brief Packed wire format of the GPS data, sent from the Nano to the LoPy.
+ *
+ *			Encodes and decodes the packets described in GPSPacket.h.
+ *
+ *
+ *
+ *	Filename:	GPSPacket.cpp                                                      \n
+ *	Path:		./GPS_Driver/                                                        \n
+ *	Created:	17-10-2026 08:00:59                                                \n
+ *
+ *	Major change #1:
+ */
+
+#include "GPSPacket.h"
+
+#define SECONDS_PER_DAY   86400UL
+#define DAYS_TO_2000      10957L      //  Days from 01-01-1970 to 01-01-2000
+
+//  Days since 01-01-1970 of a date in the proleptic Gregorian calendar
+static int32_t daysFromCivil(int32_t year, uint8_t month, uint8_t day){
+  year -= month <= 2;
+  const int32_t era = year / 400;
+  const int32_t yearOfEra = year - era * 400;
+  const int32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const int32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+//  The date of days since 01-01-1970, the inverse of daysFromCivil()
+static void civilFromDays(int32_t days, uint16_t &year, uint8_t &month, uint8_t &day){
+  days += 719468;
+  const int32_t era = days / 146097;
+  const int32_t dayOfEra = days - era * 146097;
+  const int32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const int32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int32_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+  day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+  month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+  year = yearOfEra + era * 400 + (month <= 2);
+}
+
+//  Rounds to the nearest integer, and clamps to the range of the field
+static int32_t roundClamped(double value, int32_t low, int32_t high){
+  if (value <= low)
+    return low;
+  if (value >= high)
+    return high;
+  return static_cast<int32_t>(value < 0 ? value - 0.5 : value + 0.5);
+}
+
+static void putLittleEndian(uint8_t *buffer, uint32_t value, uint8_t bytes){
+  for (uint8_t i = 0; i < bytes; ++i)
+    buffer[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+static uint32_t getLittleEndian(const uint8_t *buffer, uint8_t bytes){
+  uint32_t value = 0;
+  for (uint8_t i = 0; i < bytes; ++i)
+    value |= static_cast<uint32_t>(buffer[i]) << (8 * i);
+  return value;
+}
+
+uint32_t gpsTimestamp(const GPSPackage &parcel){
+  uint32_t days = 0;
+  if (parcel.DateMonth >= 1 && parcel.DateMonth <= 12 && parcel.DateYear >= 2000)
+    days = daysFromCivil(parcel.DateYear, parcel.DateMonth, parcel.DateDay) - DAYS_TO_2000;
+  return days * SECONDS_PER_DAY + parcel.TimeHour * 3600UL + parcel.TimeMinute * 60UL + parcel.TimeSecond;
+}
+
+void setGPSTimestamp(GPSPackage &parcel, uint32_t timestamp){
+  civilFromDays(timestamp / SECONDS_PER_DAY + DAYS_TO_2000, parcel.DateYear, parcel.DateMonth, parcel.DateDay);
+  const uint32_t seconds = timestamp % SECONDS_PER_DAY;
+  parcel.TimeHour   = seconds / 3600;
+  parcel.TimeMinute = seconds / 60 % 60;
+  parcel.TimeSecond = seconds % 60;
+}
+
+uint8_t encodeGPSPacket(const GPSPackage &parcel, GPSPacketKey &key, uint8_t *buffer, uint8_t size){
+  const uint32_t timestamp = gpsTimestamp(parcel);
+  //  A delta is only sent, when it can be decoded with the key of the receiver
+  const bool delta = key.Valid && timestamp >= key.Timestamp && timestamp - key.Timestamp <= UINT16_MAX;
+  const uint8_t length = delta ? GPS_PACKET_DELTA_SIZE : GPS_PACKET_ABSOLUTE_SIZE;
+  if (size < length)
+    return 0;
+  if (!delta){
+    key.Timestamp = timestamp;
+    key.Valid = true;
+  }
+
+  buffer[0] = (GPS_PACKET_VERSION << 4) | (delta ? 0 : GPS_PACKET_ABSOLUTE) | (key.Timestamp & GPS_PACKET_KEY_MASK);
+  putLittleEndian(buffer + 1, roundClamped(parcel.Latitude * 1e6, -90000000L, 90000000L), 4);
+  putLittleEndian(buffer + 5, roundClamped(parcel.Longitude * 1e6, -180000000L, 180000000L), 4);
+  putLittleEndian(buffer + 9, roundClamped(parcel.Altitude * 10, INT16_MIN, INT16_MAX), 2);
+  buffer[11] = parcel.Sattelites;
+  if (delta)
+    putLittleEndian(buffer + 12, timestamp - key.Timestamp, 2);
+  else
+    putLittleEndian(buffer + 12, timestamp, 4);
+  return length;
+}
+
+uint8_t encodeAbsoluteGPSPacket(const GPSPackage &parcel, uint8_t *buffer, uint8_t size){
+  GPSPacketKey key = GPSPacketKey();
+  return encodeGPSPacket(parcel, key, buffer, size);
+}
+
+uint8_t decodeGPSPacket(const uint8_t *buffer, uint8_t length, GPSPacketKey &key, GPSPackage &parcel){
+  if (length < GPS_PACKET_DELTA_SIZE || buffer[0] >> 4 != GPS_PACKET_VERSION)
+    return 0;
+  const bool absolute = buffer[0] & GPS_PACKET_ABSOLUTE;
+  uint32_t timestamp;
+  if (absolute){
+    if (length < GPS_PACKET_ABSOLUTE_SIZE)
+      return 0;
+    timestamp = getLittleEndian(buffer + 12, 4);
+    if ((timestamp & GPS_PACKET_KEY_MASK) != (buffer[0] & GPS_PACKET_KEY_MASK))
+      return 0;
+    key.Timestamp = timestamp;
+    key.Valid = true;
+  }
+  else {
+    //  The key of the sender has to be the key of the receiver
+    if (!key.Valid || (key.Timestamp & GPS_PACKET_KEY_MASK) != (buffer[0] & GPS_PACKET_KEY_MASK))
+      return 0;
+    timestamp = key.Timestamp + getLittleEndian(buffer + 12, 2);
+  }
+
+  parcel.Latitude   = static_cast<int32_t>(getLittleEndian(buffer + 1, 4)) * 1e-6;
+  parcel.Longitude  = static_cast<int32_t>(getLittleEndian(buffer + 5, 4)) * 1e-6;
+  parcel.Altitude   = static_cast<int16_t>(getLittleEndian(buffer + 9, 2)) / 10.0;
+  parcel.Sattelites = buffer[11];
+  parcel.Elevation  = 0;
+  parcel.Azimuth    = 0;
+  setGPSTimestamp(parcel, timestamp);
+  return absolute ? GPS_PACKET_ABSOLUTE_SIZE : GPS_PACKET_DELTA_SIZE;
+}
+
+
+//  EOF
@@ -0,0 +1,135 @@
+/*! @brief Packed wire format of the GPS data, sent from the Nano to the LoPy.
+ *
+ *			GPSPackage is the GPS data as used on the Nano, with doubles. On the
+ *			link it is sent as a packed, versioned packet in little endian:
+ *
+ *			byte  0       header, version in the high nibble, GPS_PACKET_ABSOLUTE
+ *			              and the key id of the timestamp in the low nibble
+ *			byte  1 - 4   latitude, int32 micro-degrees
+ *			byte  5 - 8   longitude, int32 micro-degrees
+ *			byte  9 - 10  altitude, int16 decimetres, clamped to +-3276.7 m
+ *			byte 11       satellites
+ *			byte 12 - 15  absolute: uint32 seconds since 01-01-2000 00:00:00 UTC
+ *			byte 12 - 13  delta: uint16 seconds since the last absolute timestamp
+ *
+ *			The last absolute timestamp is the key of the delta packets. Its
+ *			lowest 3 bits are the key id of the header, so a delta packet
+ *			decoded against the wrong key is rejected instead of giving a wrong
+ *			time. The elevation and azimuth of the first satellite in view
+ *			aren't sent.
+ *
+ *	@file: ./GPS_Driver/GPSPacket.h
+ *	@date: 17-10-2026 08:00:59
+ *
+ *	Major change #1:
+ */
+
+#ifndef GPS_PACKET_H_
+#define GPS_PACKET_H_
+
+#include <stdint.h>
+
+#define GPS_PACKET_VERSION        1
+#define GPS_PACKET_ABSOLUTE       0x08    //  Header bit of a packet with an absolute timestamp
+#define GPS_PACKET_KEY_MASK       0x07    //  Header bits of the key id
+#define GPS_PACKET_DELTA_SIZE     14      //  Bytes of a packet with a delta timestamp
+#define GPS_PACKET_ABSOLUTE_SIZE  16      //  Bytes of a packet with an absolute timestamp
+#define GPS_PACKET_MAX_SIZE       GPS_PACKET_ABSOLUTE_SIZE
+
+
+/**
+ * @brief Struct containing all the data needed from GPS
+ *
+ * @param None.
+ * @return n/a
+ */
+struct GPSPackage{
+  double    Latitude;     // Degrees, negative south of equator
+  double    Longitude;    // Degrees, negative west of Greenwich
+  double    Altitude;     // Metres above mean sea level
+  uint16_t  Elevation;    // Degrees, of the first satellite in view
+  uint16_t  Azimuth;      // Degrees, of the first satellite in view
+  uint8_t   Sattelites;   // There are 24 sattelites in orbit, of those a theoretical max of 14 is ever visible at any given time, thus we only need one byte.
+  uint16_t  DateYear;
+  uint8_t   DateMonth;
+  uint8_t   DateDay;
+  uint8_t   TimeHour;
+  uint8_t   TimeMinute;
+  uint8_t   TimeSecond;
+};
+
+/**
+ * @brief The key of the delta timestamps, one for each end of the link
+ *
+ * @param None.
+ * @return n/a
+ */
+struct GPSPacketKey{
+  uint32_t  Timestamp;    // The last absolute timestamp, seconds since 01-01-2000
+  bool      Valid;        // False until an absolute timestamp is encoded or decoded
+};
+
+/**
+ * @brief Encodes the GPS data as a packet.
+ *
+ * The timestamp is sent as a delta when the key is valid and the delta fits,
+ * otherwise it is sent as absolute and becomes the new key. Deltas are only
+ * for receivers which keep the key between packets. The sender never learns
+ * if the receiver has lost it, so use encodeAbsoluteGPSPacket() for a receiver
+ * which is reset, like the LoPy, which deep-sleeps after every alarm.
+ *
+ * @param const GPSPackage &parcel: The GPS data.
+ * @param GPSPacketKey &key: The key of the sender.
+ * @param uint8_t *buffer: The packet.
+ * @param uint8_t size: Size of the buffer, GPS_PACKET_MAX_SIZE is always enough.
+ * @return uint8_t: Bytes of the packet, 0 if the buffer is too small
+ */
+uint8_t encodeGPSPacket(const GPSPackage &parcel, GPSPacketKey &key, uint8_t *buffer, uint8_t size);
+
+/**
+ * @brief Encodes the GPS data as a packet with an absolute timestamp.
+ *
+ * The packet can always be decoded, also by a receiver without a key.
+ *
+ * @param const GPSPackage &parcel: The GPS data.
+ * @param uint8_t *buffer: The packet.
+ * @param uint8_t size: Size of the buffer, at least GPS_PACKET_ABSOLUTE_SIZE.
+ * @return uint8_t: Bytes of the packet, 0 if the buffer is too small
+ */
+uint8_t encodeAbsoluteGPSPacket(const GPSPackage &parcel, uint8_t *buffer, uint8_t size);
+
+/**
+ * @brief Decodes a packet to the GPS data.
+ *
+ * The elevation and azimuth are 0.
+ *
+ * @param const uint8_t *buffer: The packet.
+ * @param uint8_t length: Bytes received.
+ * @param GPSPacketKey &key: The key of the receiver.
+ * @param GPSPackage &parcel: The GPS data.
+ * @return uint8_t: Bytes of the packet, 0 if it is truncated, of another version, or a delta of another key
+ */
+uint8_t decodeGPSPacket(const uint8_t *buffer, uint8_t length, GPSPacketKey &key, GPSPackage &parcel);
+
+/**
+ * @brief The date and time of the GPS data as seconds since 01-01-2000 00:00:00 UTC.
+ *
+ * Without a date (month 0) only the time of day is counted.
+ *
+ * @param const GPSPackage &parcel: The GPS data.
+ * @return uint32_t
+ */
+uint32_t gpsTimestamp(const GPSPackage &parcel);
+
+/**
+ * @brief Sets the date and time of the GPS data from seconds since 01-01-2000 00:00:00 UTC.
+ *
+ * @param GPSPackage &parcel: The GPS data.
+ * @param uint32_t timestamp: The seconds.
+ * @return void
+ */
+void setGPSTimestamp(GPSPackage &parcel, uint32_t timestamp);
+
+#endif  // GPS_PACKET_H_
+
+//  EOF
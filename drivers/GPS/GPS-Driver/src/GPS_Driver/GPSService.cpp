@@ -0,0 +1,62 @@
+/*! \brief Non-blocking GPS service keeping the last known good fix.
+ *
+ *			Drains the UART of the GPS from the main loop, and caches the fix.
+ *
+ *
+ *
+ *	Filename:	GPSService.cpp                                                     \n
+ *	Path:		./GPS_Driver/                                                        \n
+ *	Created:	17-10-2026 07:58:33                                                \n
+ *
+ *	Major change #1:
+ */
+
+#include "GPSService.h"
+
+GPSService::GPSService(HardwareSerial &serial)
+  :  uart(serial)
+  ,  startMillis(0)
+  ,  fixSentences(0)
+{
+  fix = GPSFix();
+}
+
+void GPSService::begin(unsigned long baud){
+  uart.begin(baud);
+  startMillis = millis();
+}
+
+uint16_t GPSService::poll(uint16_t maxChars){
+  uint16_t parsed = 0;
+  while (parsed < maxChars && uart.available() > 0){
+    ++parsed;
+    if (!nmea.encode(uart.read()))
+      continue;
+    //  A sentence with a fix has just been committed, so the location of the parser is new
+    if (nmea.sentencesWithFix() != fixSentences && nmea.isValid(NMEA_LOCATION)){
+      fixSentences = nmea.sentencesWithFix();
+      const NMEAData &data = nmea.data();
+      fix.Latitude   = data.Latitude;
+      fix.Longitude  = data.Longitude;
+      fix.Altitude   = data.Altitude;
+      fix.Time       = data.Time;
+      fix.Date       = data.Date;
+      fix.HDOP       = data.HDOP;
+      fix.Satellites = data.Satellites;
+      fix.FixMillis  = nmea.locationMillis();
+      fix.Valid      = true;
+    }
+  }
+  return parsed;
+}
+
+GPSStatus GPSService::status() const {
+  if (fix.Valid)
+    return fixAge() > GPS_FIX_STALE_MS ? GPS_STALE : GPS_FIX;
+  if (nmea.charsProcessed() >= GPS_DETECT_MIN_CHARS)
+    return GPS_NO_FIX;
+  return millis() - startMillis > GPS_DETECT_TIMEOUT_MS ? GPS_NOT_DETECTED : GPS_STARTING;
+}
+
+
+//  EOF
@@ -0,0 +1,125 @@
+/*! @brief Non-blocking GPS service keeping the last known good fix.
+ *
+ *			The service is polled from the main loop. Every poll drains the bytes
+ *			waiting on the UART of the GPS through the NMEA parser, up to a
+ *			bounded amount so the loop is never held up, and when a sentence with
+ *			a fix has been received the fix is copied to the cache. Reading the
+ *			fix is O(1), so an alarm can send the position at once instead of
+ *			waiting for the next sentence from the GPS.
+ *
+ *	@file: ./GPS_Driver/GPSService.h
+ *	@date: 17-10-2026 07:58:33
+ *
+ *	Major change #1:
+ */
+
+#ifndef GPS_SERVICE_H_
+#define GPS_SERVICE_H_
+
+#include <Arduino.h>
+
+#include "NMEAParser.h"
+
+#define GPS_POLL_MAX_CHARS      64      //  Characters parsed per poll at most
+#define GPS_DETECT_TIMEOUT_MS   5000    //  Time for the GPS to send its first characters
+#define GPS_DETECT_MIN_CHARS    10      //  Characters received before the GPS counts as detected
+#define GPS_FIX_STALE_MS        10000   //  Age of a fix before it is stale
+
+//  State of the GPS, as seen by the service
+enum GPSStatus : uint8_t {
+  GPS_STARTING,       //  Waiting for the first characters
+  GPS_NOT_DETECTED,   //  No characters within GPS_DETECT_TIMEOUT_MS
+  GPS_NO_FIX,         //  Sentences are received, but there hasn't been a fix
+  GPS_FIX,            //  The last fix is younger than GPS_FIX_STALE_MS
+  GPS_STALE           //  The last fix is older than GPS_FIX_STALE_MS
+};
+
+/**
+ * @brief The last known good fix, in the fixed point of the parser
+ *
+ * @param None.
+ * @return n/a
+ */
+struct GPSFix {
+  int32_t   Latitude;     // 1e-7 degrees, negative south of equator
+  int32_t   Longitude;    // 1e-7 degrees, negative west of Greenwich
+  int32_t   Altitude;     // Centimetres above mean sea level
+  uint32_t  Time;         // UTC as hhmmsscc
+  uint32_t  Date;         // ddmmyy
+  uint16_t  HDOP;         // 1/100
+  uint8_t   Satellites;   // Satellites used for the fix
+  bool      Valid;        // False until the first fix
+  uint32_t  FixMillis;    // millis() when the fix was received
+};
+
+class GPSService {
+public:
+  /**
+  * @brief Creates the service of the GPS on a UART.
+  *
+  * @param HardwareSerial &serial: The UART the GPS is connected to.
+  */
+  explicit GPSService(HardwareSerial &serial);
+
+  /**
+  * @brief Starts the UART, and the detection timeout of the GPS.
+  *
+  * @param unsigned long baud: The baud rate of the GPS.
+  * @return void
+  */
+  void begin(unsigned long baud);
+
+  /**
+  * @brief Parses the characters waiting on the UART, never blocking.
+  *
+  * Called every loop. At most maxChars characters are parsed, the rest are
+  * left for the next poll.
+  *
+  * @param uint16_t maxChars: Characters parsed at most.
+  * @return uint16_t: Characters parsed
+  */
+  uint16_t poll(uint16_t maxChars = GPS_POLL_MAX_CHARS);
+
+  /**
+  * @brief The last known good fix, check Valid before using it.
+  *
+  * @param None.
+  * @return const GPSFix&
+  */
+  const GPSFix &lastFix() const { return fix; }
+
+  /**
+  * @brief Milliseconds since the last fix.
+  *
+  * @param None.
+  * @return uint32_t: The age, or UINT32_MAX without a fix
+  */
+  uint32_t fixAge() const { return fix.Valid ? millis() - fix.FixMillis : UINT32_MAX; }
+
+  /**
+  * @brief The state of the GPS.
+  *
+  * @param None.
+  * @return GPSStatus
+  */
+  GPSStatus status() const;
+
+  /**
+  * @brief The parser, with its statistics.
+  *
+  * @param None.
+  * @return const NMEAParser&
+  */
+  const NMEAParser &parser() const { return nmea; }
+
+private:
+  HardwareSerial &uart;
+  NMEAParser nmea;
+  GPSFix fix;
+  uint32_t startMillis;
+  uint32_t fixSentences;      //  Sentences with a fix, when the fix was last copied
+};
+
+#endif  // GPS_SERVICE_H_
+
+//  EOF
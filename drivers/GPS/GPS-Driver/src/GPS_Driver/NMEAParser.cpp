@@ -0,0 +1,383 @@
+/*! \brief Incremental NMEA parser for the GPS module.
+ *
+ *			Parses the NMEA sentences of the GPS one character at a time, without
+ *			copying the fields into a term buffer like TinyGPS++.
+ *
+ *
+ *
+ *	Filename:	NMEAParser.cpp                                                     \n
+ *	Path:		./GPS_Driver/                                                        \n
+ *	Created:	17-10-2026 07:55:32                                                \n
+ *
+ *	Major change #1:
+ */
+
+#include "NMEAParser.h"
+
+#include <Arduino.h>
+
+//  Decimals kept of every field, in the order of NMEAParser::Field. Missing decimals
+//  are filled in with zeros and more decimals are truncated, so every field ends
+//  up as an integer in the unit of NMEAData.
+static const uint8_t FIELD_DECIMALS[] = {
+  0,  // FIELD_SKIP
+  2,  // FIELD_TIME         hhmmss.ss
+  0,  // FIELD_DATE         ddmmyy
+  5,  // FIELD_LATITUDE     ddmm.mmmmm
+  5,  // FIELD_LONGITUDE    dddmm.mmmmm
+  0,  // FIELD_NORTH_SOUTH
+  0,  // FIELD_EAST_WEST
+  0,  // FIELD_STATUS
+  0,  // FIELD_QUALITY
+  2,  // FIELD_SPEED        knots
+  2,  // FIELD_COURSE       degrees
+  0,  // FIELD_SATELLITES
+  2,  // FIELD_HDOP
+  2,  // FIELD_ALTITUDE     metres
+  0,  // FIELD_ELEVATION
+  0   // FIELD_AZIMUTH
+};
+
+#define COMBINE(sentence_type, term_number) (((unsigned)(sentence_type) << 5) | term_number)
+
+//  ddmm.mmmmm as ddmmmmmmm, to 1e-7 degrees. The minutes are rounded to the nearest 1e-7 degree.
+static int32_t toDegrees(uint32_t value) {
+  uint32_t degrees = value / 10000000UL;
+  uint32_t minutes = value % 10000000UL;   //  1e-5 minutes
+  return static_cast<int32_t>(degrees * 10000000UL + (minutes * 10 + 3) / 6);
+}
+
+static int fromHex(char a) {
+  if (a >= '0' && a <= '9')
+    return a - '0';
+  else if (a >= 'A' && a <= 'F')
+    return a - 'A' + 10;
+  else if (a >= 'a' && a <= 'f')
+    return a - 'a' + 10;
+  return -1;
+}
+
+NMEAParser::NMEAParser()
+  :  state(STATE_IDLE)
+  ,  parity(0)
+  ,  checksum(0)
+  ,  checksumDigits(0)
+  ,  termNumber(0)
+  ,  idHash(NMEA_HASH_BASIS)
+  ,  sentenceType(NMEA_SENTENCE_OTHER)
+  ,  sentenceHasFix(false)
+  ,  field(FIELD_SKIP)
+  ,  stagedSouth(false)
+  ,  stagedWest(false)
+  ,  validValues(0)
+  ,  lastSentenceType(NMEA_SENTENCE_OTHER)
+  ,  locationCommitTime(0)
+  ,  encodedCharCount(0)
+  ,  sentencesWithFixCount(0)
+  ,  failedChecksumCount(0)
+  ,  passedChecksumCount(0)
+{
+  staged = NMEAData();
+  committed = NMEAData();
+}
+
+// Handles the characters which aren't part of a field: the start of a sentence, the delimiters of the
+// fields, the checksum and the characters between the sentences
+bool NMEAParser::encodeDelimiter(char c)
+{
+  if (c == '$') {
+    // sentence begin, also when the last sentence was cut off
+    state = STATE_SENTENCE;
+    parity = 0;
+    termNumber = 0;
+    idHash = NMEA_HASH_BASIS;
+    sentenceType = NMEA_SENTENCE_OTHER;
+    sentenceHasFix = false;
+    field = FIELD_SKIP;
+    return false;
+  }
+
+  switch (state) {
+  case STATE_SENTENCE:
+    switch (c) {
+    case ',':
+      parity ^= ',';
+      endField();
+      ++termNumber;
+      startField();
+      return false;
+    case '*':
+      endField();
+      state = STATE_CHECKSUM;
+      checksum = 0;
+      checksumDigits = 0;
+      return false;
+    case '\r':
+    case '\n':
+      // sentences without checksum are never committed
+      state = STATE_IDLE;
+      return false;
+    default:
+      // control characters and the rest of the punctuation below ','
+      parity ^= static_cast<uint8_t>(c);
+      if (field != FIELD_SKIP)
+        accumulate(c);
+      else if (termNumber == 0)
+        idHash = static_cast<uint32_t>((idHash ^ static_cast<uint8_t>(c)) * NMEA_HASH_PRIME);
+      return false;
+    }
+
+  case STATE_CHECKSUM:
+    {
+      int digit = fromHex(c);
+      if (digit < 0) {
+        ++failedChecksumCount;
+        state = STATE_IDLE;
+        return false;
+      }
+      checksum = (checksum << 4) | digit;
+      if (++checksumDigits < 2)
+        return false;
+      state = STATE_IDLE;
+      return endChecksum();
+    }
+
+  default:
+    // characters between the sentences
+    return false;
+  }
+}
+
+int32_t NMEAParser::parseDegrees(const char *term)
+{
+  uint32_t value = 0;
+  uint8_t decimals = 0;
+  bool fraction = false;
+  for (; *term; ++term) {
+    if (*term == '.')
+      fraction = true;
+    else if (*term >= '0' && *term <= '9' && (!fraction || decimals < FIELD_DECIMALS[FIELD_LATITUDE])) {
+      value = value * 10 + (*term - '0');
+      decimals += fraction;
+    }
+  }
+  for (; decimals < FIELD_DECIMALS[FIELD_LATITUDE]; ++decimals)
+    value *= 10;
+  return toDegrees(value);
+}
+
+//
+// internal utilities
+//
+
+// Finds what the field starting now is accumulated as
+void NMEAParser::startField()
+{
+  switch (COMBINE(sentenceType, termNumber)) {
+  case COMBINE(NMEA_SENTENCE_RMC, 1): // Time in both sentences
+  case COMBINE(NMEA_SENTENCE_GGA, 1):
+    field = FIELD_TIME;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 2): // RMC validity
+    field = FIELD_STATUS;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 3): // Latitude
+  case COMBINE(NMEA_SENTENCE_GGA, 2):
+    field = FIELD_LATITUDE;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 4): // N/S
+  case COMBINE(NMEA_SENTENCE_GGA, 3):
+    field = FIELD_NORTH_SOUTH;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 5): // Longitude
+  case COMBINE(NMEA_SENTENCE_GGA, 4):
+    field = FIELD_LONGITUDE;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 6): // E/W
+  case COMBINE(NMEA_SENTENCE_GGA, 5):
+    field = FIELD_EAST_WEST;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 7): // Speed
+    field = FIELD_SPEED;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 8): // Course
+    field = FIELD_COURSE;
+    break;
+  case COMBINE(NMEA_SENTENCE_RMC, 9): // Date
+    field = FIELD_DATE;
+    break;
+  case COMBINE(NMEA_SENTENCE_GGA, 6): // Fix quality
+    field = FIELD_QUALITY;
+    break;
+  case COMBINE(NMEA_SENTENCE_GGA, 7): // Satellites used
+    field = FIELD_SATELLITES;
+    break;
+  case COMBINE(NMEA_SENTENCE_GGA, 8): // HDOP
+    field = FIELD_HDOP;
+    break;
+  case COMBINE(NMEA_SENTENCE_GGA, 9): // Altitude
+    field = FIELD_ALTITUDE;
+    break;
+  case COMBINE(NMEA_SENTENCE_GSV, 5): // Elevation of the first satellite in view
+    field = FIELD_ELEVATION;
+    break;
+  case COMBINE(NMEA_SENTENCE_GSV, 6): // Azimuth of the first satellite in view
+    field = FIELD_AZIMUTH;
+    break;
+  default:
+    field = FIELD_SKIP;
+    return;
+  }
+  fieldValue = 0;
+  fieldDecimals = 0;
+  fieldMaxDecimals = FIELD_DECIMALS[field];
+  fieldLetter = 0;
+  fieldFraction = false;
+  fieldNegative = false;
+  fieldEmpty = true;
+  fieldOverflow = false;
+}
+
+// Stores the field which has just been received. Empty fields keep the last value, like TinyGPS++.
+void NMEAParser::endField()
+{
+  if (termNumber == 0) {
+    // the first term determines the sentence type
+    switch (idHash) {
+    case nmeaHash("GPRMC"):
+    case nmeaHash("GNRMC"):
+      sentenceType = NMEA_SENTENCE_RMC;
+      break;
+    case nmeaHash("GPGGA"):
+    case nmeaHash("GNGGA"):
+      sentenceType = NMEA_SENTENCE_GGA;
+      break;
+    case nmeaHash("GPGSV"):
+    case nmeaHash("GNGSV"):
+      sentenceType = NMEA_SENTENCE_GSV;
+      break;
+    default:
+      sentenceType = NMEA_SENTENCE_OTHER;
+      break;
+    }
+    return;
+  }
+  if (field == FIELD_SKIP || fieldEmpty || fieldOverflow)
+    return;
+
+  for (uint8_t decimals = fieldDecimals; decimals < fieldMaxDecimals; ++decimals) {
+    if (fieldValue > UINT32_MAX / 10)
+      return;
+    fieldValue *= 10;
+  }
+
+  switch (field) {
+  case FIELD_TIME:
+    staged.Time = fieldValue;
+    break;
+  case FIELD_DATE:
+    staged.Date = fieldValue;
+    break;
+  case FIELD_LATITUDE:
+    staged.Latitude = toDegrees(fieldValue);
+    break;
+  case FIELD_LONGITUDE:
+    staged.Longitude = toDegrees(fieldValue);
+    break;
+  case FIELD_NORTH_SOUTH:
+    stagedSouth = fieldLetter == 'S';
+    break;
+  case FIELD_EAST_WEST:
+    stagedWest = fieldLetter == 'W';
+    break;
+  case FIELD_STATUS:
+    sentenceHasFix = fieldLetter == 'A';
+    break;
+  case FIELD_QUALITY:
+    sentenceHasFix = fieldValue > 0;
+    break;
+  case FIELD_SPEED:
+    staged.Speed = fieldValue;
+    break;
+  case FIELD_COURSE:
+    staged.Course = fieldValue;
+    break;
+  case FIELD_SATELLITES:
+    staged.Satellites = fieldValue > UINT8_MAX ? UINT8_MAX : fieldValue;
+    break;
+  case FIELD_HDOP:
+    staged.HDOP = fieldValue > UINT16_MAX ? UINT16_MAX : fieldValue;
+    break;
+  case FIELD_ALTITUDE:
+    staged.Altitude = fieldNegative ? -static_cast<int32_t>(fieldValue) : static_cast<int32_t>(fieldValue);
+    break;
+  case FIELD_ELEVATION:
+    staged.Elevation = fieldValue;
+    break;
+  case FIELD_AZIMUTH:
+    staged.Azimuth = fieldValue;
+    break;
+  default:
+    break;
+  }
+}
+
+// Checks the received checksum, and commits the sentence if it is correct
+bool NMEAParser::endChecksum()
+{
+  if (checksum != parity) {
+    ++failedChecksumCount;
+    return false;
+  }
+  ++passedChecksumCount;
+  if (sentenceHasFix)
+    ++sentencesWithFixCount;
+  commit();
+  return true;
+}
+
+void NMEAParser::commit()
+{
+  bool location = false;
+  switch (sentenceType) {
+  case NMEA_SENTENCE_RMC:
+    committed.Date = staged.Date;
+    committed.Time = staged.Time;
+    validValues |= NMEA_DATE | NMEA_TIME;
+    if (sentenceHasFix) {
+      location = true;
+      committed.Speed = staged.Speed;
+      committed.Course = staged.Course;
+      validValues |= NMEA_SPEED | NMEA_COURSE;
+    }
+    break;
+  case NMEA_SENTENCE_GGA:
+    committed.Time = staged.Time;
+    committed.Satellites = staged.Satellites;
+    committed.HDOP = staged.HDOP;
+    validValues |= NMEA_TIME | NMEA_SATELLITES | NMEA_HDOP;
+    if (sentenceHasFix) {
+      location = true;
+      committed.Altitude = staged.Altitude;
+      validValues |= NMEA_ALTITUDE;
+    }
+    break;
+  case NMEA_SENTENCE_GSV:
+    committed.Elevation = staged.Elevation;
+    committed.Azimuth = staged.Azimuth;
+    validValues |= NMEA_DETAILS;
+    break;
+  default:
+    break;
+  }
+  if (location) {
+    committed.Latitude = stagedSouth ? -staged.Latitude : staged.Latitude;
+    committed.Longitude = stagedWest ? -staged.Longitude : staged.Longitude;
+    validValues |= NMEA_LOCATION;
+    locationCommitTime = millis();
+  }
+  lastSentenceType = sentenceType;
+}
+
+
+//  EOF
@@ -0,0 +1,241 @@
+/*! @brief Incremental NMEA parser for the GPS module.
+ *
+ *			Parses the NMEA sentences of the GPS one character at a time, without
+ *			copying the fields. The sentence id is hashed while it is received and
+ *			dispatched on hashes computed at compile time, the checksum is
+ *			calculated on the fly, and every field is accumulated directly into
+ *			the fixed point value it is stored as. Like TinyGPS++ the values of a
+ *			sentence are only committed when its checksum is correct.
+ *
+ *	@file: ./GPS_Driver/NMEAParser.h
+ *	@date: 17-10-2026 07:55:32
+ *
+ *	Major change #1:
+ */
+
+#ifndef NMEA_PARSER_H_
+#define NMEA_PARSER_H_
+
+#include <stdint.h>
+
+#define NMEA_HASH_BASIS 2166136261UL   //  FNV-1a offset basis
+#define NMEA_HASH_PRIME 16777619UL     //  FNV-1a prime
+
+/**
+ * @brief Hash of a sentence id, like "GPRMC", calculated at compile time.
+ *
+ * The parser updates the same hash for every character of the id, so it is
+ * dispatched with a switch on these hashes. Colliding ids are duplicate cases,
+ * so they don't compile.
+ *
+ * @param const char *id: The sentence id.
+ * @param uint32_t hash: Hash of the characters before id.
+ * @return uint32_t: The FNV-1a hash of the id
+ */
+constexpr uint32_t nmeaHash(const char *id, uint32_t hash = NMEA_HASH_BASIS) {
+  return *id ? nmeaHash(id + 1, static_cast<uint32_t>((hash ^ static_cast<uint8_t>(*id)) * NMEA_HASH_PRIME)) : hash;
+}
+
+//  Sentences used by the parser
+enum NMEASentence : uint8_t {
+  NMEA_SENTENCE_OTHER,
+  NMEA_SENTENCE_RMC,
+  NMEA_SENTENCE_GGA,
+  NMEA_SENTENCE_GSV
+};
+
+//  The values of NMEAData, as bits of NMEAParser::valid()
+enum NMEAValue : uint16_t {
+  NMEA_LOCATION   = 1 << 0,
+  NMEA_ALTITUDE   = 1 << 1,
+  NMEA_TIME       = 1 << 2,
+  NMEA_DATE       = 1 << 3,
+  NMEA_SPEED      = 1 << 4,
+  NMEA_COURSE     = 1 << 5,
+  NMEA_SATELLITES = 1 << 6,
+  NMEA_HDOP       = 1 << 7,
+  NMEA_DETAILS    = 1 << 8
+};
+
+/**
+ * @brief The values of the GPS in fixed point
+ *
+ * @param None.
+ * @return n/a
+ */
+struct NMEAData {
+  int32_t   Latitude;     // 1e-7 degrees, negative south of equator
+  int32_t   Longitude;    // 1e-7 degrees, negative west of Greenwich
+  int32_t   Altitude;     // Centimetres above mean sea level
+  uint32_t  Time;         // UTC as hhmmsscc
+  uint32_t  Date;         // ddmmyy
+  uint32_t  Speed;        // 1/100 knots
+  uint32_t  Course;       // 1/100 degrees
+  uint16_t  HDOP;         // 1/100
+  uint16_t  Elevation;    // Degrees, of the first satellite in view
+  uint16_t  Azimuth;      // Degrees, of the first satellite in view
+  uint8_t   Satellites;   // Satellites used for the fix
+};
+
+class NMEAParser {
+public:
+  NMEAParser();
+
+  /**
+  * @brief Process one character received from the GPS.
+  *
+  * The characters of the fields are handled inline, only the delimiters call into the parser.
+  *
+  * @param char c: The character.
+  * @return bool: True when the character completed a sentence with a correct checksum
+  */
+  bool encode(char c) {
+    ++encodedCharCount;
+    //  ordinary characters of a field, everything above ',' in ASCII
+    if (c > ',' && state == STATE_SENTENCE) {
+      parity ^= static_cast<uint8_t>(c);
+      if (field != FIELD_SKIP)
+        accumulate(c);
+      else if (termNumber == 0)
+        idHash = static_cast<uint32_t>((idHash ^ static_cast<uint8_t>(c)) * NMEA_HASH_PRIME);
+      return false;
+    }
+    return encodeDelimiter(c);
+  }
+
+  /**
+  * @brief The committed values.
+  *
+  * Only the values set in valid() are meaningful.
+  *
+  * @param None.
+  * @return const NMEAData&
+  */
+  const NMEAData &data() const { return committed; }
+
+  /**
+  * @brief The values which have been committed at least once.
+  *
+  * @param None.
+  * @return uint16_t: NMEAValue bits
+  */
+  uint16_t valid() const { return validValues; }
+
+  /**
+  * @brief Checks if all the given values have been committed.
+  *
+  * @param uint16_t values: NMEAValue bits.
+  * @return bool
+  */
+  bool isValid(uint16_t values) const { return (validValues & values) == values; }
+
+  /**
+  * @brief The last sentence which passed the checksum.
+  *
+  * @param None.
+  * @return NMEASentence
+  */
+  NMEASentence lastSentence() const { return lastSentenceType; }
+
+  /**
+  * @brief millis() when the location was committed.
+  *
+  * @param None.
+  * @return uint32_t
+  */
+  uint32_t locationMillis() const { return locationCommitTime; }
+
+  uint32_t charsProcessed()   const { return encodedCharCount; }
+  uint32_t sentencesWithFix() const { return sentencesWithFixCount; }
+  uint32_t failedChecksum()   const { return failedChecksumCount; }
+  uint32_t passedChecksum()   const { return passedChecksumCount; }
+
+  /**
+  * @brief Parse the degrees of a DDMM.MMMMM field into 1e-7 degrees.
+  *
+  * Used by the tests, the parser itself never has the field as a string.
+  *
+  * @param const char *term: The field, like "5610.06764".
+  * @return int32_t
+  */
+  static int32_t parseDegrees(const char *term);
+
+private:
+  enum State : uint8_t {STATE_IDLE, STATE_SENTENCE, STATE_CHECKSUM};
+
+  //  What a field is accumulated as
+  enum Field : uint8_t {
+    FIELD_SKIP, FIELD_TIME, FIELD_DATE, FIELD_LATITUDE, FIELD_LONGITUDE, FIELD_NORTH_SOUTH, FIELD_EAST_WEST,
+    FIELD_STATUS, FIELD_QUALITY, FIELD_SPEED, FIELD_COURSE, FIELD_SATELLITES, FIELD_HDOP, FIELD_ALTITUDE,
+    FIELD_ELEVATION, FIELD_AZIMUTH
+  };
+
+  // parsing state variables
+  State state;
+  uint8_t parity;
+  uint8_t checksum;
+  uint8_t checksumDigits;
+  uint8_t termNumber;
+  uint32_t idHash;
+  NMEASentence sentenceType;
+  bool sentenceHasFix;
+
+  // the field being received
+  Field field;
+  uint32_t fieldValue;
+  uint8_t fieldDecimals;
+  uint8_t fieldMaxDecimals;
+  char fieldLetter;
+  bool fieldFraction;
+  bool fieldNegative;
+  bool fieldEmpty;
+  bool fieldOverflow;
+
+  // values of the sentence being received, and the committed values
+  NMEAData staged;
+  bool stagedSouth, stagedWest;
+  NMEAData committed;
+  uint16_t validValues;
+  NMEASentence lastSentenceType;
+  uint32_t locationCommitTime;
+
+  // statistics
+  uint32_t encodedCharCount;
+  uint32_t sentencesWithFixCount;
+  uint32_t failedChecksumCount;
+  uint32_t passedChecksumCount;
+
+  // internal utilities
+  bool encodeDelimiter(char c);
+  void startField();
+  void endField();
+  bool endChecksum();
+  void commit();
+
+  // Adds a character to the field being received
+  void accumulate(char c) {
+    fieldEmpty = false;
+    if (c >= '0' && c <= '9') {
+      if (fieldFraction) {
+        if (fieldDecimals >= fieldMaxDecimals)
+          return;
+        ++fieldDecimals;
+      }
+      if (fieldValue > (UINT32_MAX - 9) / 10) {
+        fieldOverflow = true;
+        return;
+      }
+      fieldValue = fieldValue * 10 + (c - '0');
+    }
+    else if (c == '.')
+      fieldFraction = true;
+    else if (c == '-')
+      fieldNegative = true;
+    else
+      fieldLetter = c;
+  }
+};
+
+#endif  // NMEA_PARSER_H_
+
+//  EOF
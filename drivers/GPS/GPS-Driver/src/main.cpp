@@ -2,7 +2,7 @@
 
 
 #include <Arduino.h>
-#include <./GPS_Driver/TinyGPS++.h>
+#include <./GPS_Driver/NMEAParser.h>
 #include <./GPS_Driver/GPSHelper.h>
 
 
@@ -11,8 +11,8 @@ void displayInfo();
 
 // int GPSBaud = 9600;
 
-// Create a TinyGPS++ object
-// TinyGPSPlus gps;
+// Create a NMEA parser object
+// NMEAParser gps;
 
 
 void setup()
@@ -30,6 +30,8 @@ void loop(){
   PrintGPSData();
 
   //  Use this to read GPS data to a parcel containing readout og all the needed stuff.
+  //  PollGPS() has to be called every loop, ReadGPSData() returns the last fix at once.
+  // PollGPS();
   // if (isDataReady()) { GPSPackage parcel = ReadGPSData(); }
 
 